@@ -14,6 +14,9 @@
 //  size - Size of the ROM in bytes             - 04 bytes 
 //  offset - Offset of the game in the flash    - 04 bytes 
 //
+// A ROM listed in the ROM database of the tools (romdb.h, shared with the multirom tool) gets the mapper and the title
+// listed for it, the mapper detection is only for the unknown ones.
+//
 // This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License. 
 // https://creativecommons.org/licenses/by-nc-sa/4.0/
 
@@ -23,6 +26,7 @@
 #include <dirent.h>
 #include "uf2format.h"
 #include "loadrom.h"
+#include "romdb.h"
 
 #define UF2FILENAME     "loadrom.uf2"          // this is the UF2 file to program the Raspberry Pi Pico
 
@@ -31,9 +35,11 @@
 #define MAX_ROM_SIZE            10*1024*1024    // Maximum size of a ROM file
 #define MAX_ANALYSIS_SIZE       131072         // 128KB for the mapper analysis
 #define FLASH_START             0x10000000     // Start of the flash memory on the Raspberry Pi Pico
+#define MAX_LOADROM_MAPPER      9              // Last mapper code of the loadROM firmware (NEO16)
 
 uint32_t file_size(const char *filename);
 uint8_t detect_rom_type(const char *filename, uint32_t size);
+int identify_rom(const char *filename, uint32_t size);
 void write_padding(FILE *file, size_t current_size, size_t target_size, uint8_t padding_byte);
 void create_uf2_file(const uint8_t *combined_data, size_t combined_size, const char *uf2_filename);
 
@@ -68,6 +74,30 @@ uint32_t file_size(const char *filename) {
     return size;
 }
 
+// identify_rom - Find the ROM in the ROM database by its SHA-1
+// Parameters:
+// filename - Name of the ROM file
+// size - Size of the ROM file
+// Returns:
+// Index of the dump in the database, -1 when it is not listed or the file cannot be read
+int identify_rom(const char *filename, uint32_t size) {
+    if (ROMDB_COUNT == 0) {
+        return -1;
+    }
+    FILE *file = fopen(filename, "rb");
+    if (!file) {
+        return -1;
+    }
+    uint8_t *rom = (uint8_t *)malloc(size);
+    int known = -1;
+    if (rom && fread(rom, 1, size, file) == size) {
+        known = romdb_identify(rom, size);
+    }
+    free(rom);
+    fclose(file);
+    return known;
+}
+
 // detect_rom_type - Detect the ROM type using a heuristic approach
 // Parameters:
 // filename - Name of the ROM file
@@ -328,8 +358,9 @@ int main(int argc, char *argv[])
             return 1;
         }
 
-        // Detect the ROM type
+        // Detect the ROM type, from the ROM database if it lists the ROM with a mapper of the loadROM firmware
         uint8_t rom_type = 0;
+        int known = -1;
         // Check if a forced mapper value was provided as a second parameter
         if (argc >= 3) {
             int forced_mapper = atoi(argv[2]);
@@ -342,7 +373,12 @@ int main(int argc, char *argv[])
             rom_type = forced_mapper;
             printf("ROM type: %s [Forced]\n", rom_types[rom_type]);
         }
+        else if ((known = identify_rom(argv[1], rom_size)) >= 0 && romdb_mapper(known) <= MAX_LOADROM_MAPPER) {
+            rom_type = romdb_mapper(known);
+            printf("ROM type: %s [Database]\n", rom_types[rom_type]);
+        }
         else {
+            known = -1;
             rom_type = detect_rom_type(argv[1], rom_size);
             if (rom_type == 0) {
                 printf("Failed to detect the ROM type. Please check the ROM file.\n");
@@ -353,14 +389,16 @@ int main(int argc, char *argv[])
         }
 
         // Write the ROM name to the configuration file
-        char rom_name[MAX_FILE_NAME_LENGTH] = {0};
+        char rom_name[MAX_FILE_NAME_LENGTH + 1] = {0}; // The record holds the first MAX_FILE_NAME_LENGTH characters
 
         // Extract the first part of the file name (up to the first '.ROM' or '.rom')
         char *dot_position = strstr(argv[1], ".ROM");
         if (dot_position == NULL) {
             dot_position = strstr(argv[1], ".rom");
         }
-        if (dot_position != NULL) {
+        if (known >= 0) {
+            strncpy(rom_name, romdb_title(known), MAX_FILE_NAME_LENGTH);
+        } else if (dot_position != NULL) {
             size_t name_length = dot_position - argv[1];
             if (name_length > MAX_FILE_NAME_LENGTH) {
                 name_length = MAX_FILE_NAME_LENGTH;
@@ -5,38 +5,74 @@
 // Define maximum files per page and screen properties
 #define FILES_PER_PAGE 19   // Maximum files per page on the menu
 #define MAX_FILE_NAME_LENGTH 50     // Maximum size of the ROM name
-#define ROM_RECORD_SIZE (MAX_FILE_NAME_LENGTH + 1 + sizeof(unsigned long) + sizeof(unsigned long))  // Size of the ROM record in bytes
-#define MAX_ROM_RECORDS 128 // Maximum ROM files supported
-#define MEMORY_START 0x8000 // Start of the memory area to read the ROM records
-#define ROM_SELECT_REGISTER 0x9D81 // Memory-mapped register that selects the ROM to load
+#define ROM_SELECT_REGISTER 0x9D81 // Memory-mapped register that selects the ROM to load, low byte of its index
+#define ROM_SELECT_HIGH 0x9D82 // High byte of the index, written before the low byte (see romconfig.h in the Pico firmware)
+#define CATALOG_PORT 0x9C // I/O port of the ROM catalog (see catalog.h in the Pico firmware)
+#define CATALOG_CMD_INFO 0x00 // Latch the number of ROMs and pages
+#define CATALOG_CMD_PAGE 0x01 // Latch the menu lines of a page
+#define CATALOG_CMD_ENTRY 0x02 // Latch the name and mapper of a ROM
+#define CATALOG_CMD_SEARCH 0x03 // Apply a key to the search query, latch the new counts and first page
+#define CATALOG_KEY_CLEAR 0x00 // Search key that empties the query
+#define CATALOG_KEY_DELETE 0x08 // Search key that removes the last character of the query
+#define CATALOG_QUERY_LENGTH 24 // Longest search query
+#define CATALOG_LINE_LENGTH 38 // Characters of a menu line
 #define JIFFY 0xFC9E
+#define PERF_PORT 0x9D // I/O port of the firmware performance counters (see perf.h in the Pico firmware)
+#define PERF_CMD_CURRENT 0x00 // Latch the counters of the running session
+#define PERF_CMD_LAST 0x01 // Latch the counters of the session before the last Pico reset
+#define PERF_HIST_BUCKETS 8 // Read latency histogram buckets
+#define PERF_FLAG_NO_LATENCY 0x01 // The engine of the session does not time its reads
 
-// Structure to represent a ROM record
-// The ROM record will contain the name of the ROM, the mapper code, the size of the ROM and the offset in the flash memory
-// Name: MAX_FILE_NAME_LENGTH bytes
+// Structure to represent a catalog entry, the ROM under the cursor
+// Name: MAX_FILE_NAME_LENGTH characters, padded with spaces by the firmware
 // Mapper: 1 byte
-// Size: 4 bytes
-// Offset: 4 bytes
+// Index: 2 bytes, the ROM to write to the select register (the list can be filtered by a search)
 typedef struct {
     char Name[MAX_FILE_NAME_LENGTH + 1];
     unsigned char Mapper;
-    unsigned long Size;
-    unsigned long Offset;
-} ROMRecord;
+    unsigned int Index;
+} CatalogEntry;
 
 
+// Structure of the performance counters block read from PERF_PORT (same layout as perf_counters_t in the firmware)
+typedef struct {
+    unsigned char Magic[4];     // "PERF" when the firmware was built with the counters
+    unsigned char Mapper;       // Mapper code being served (0 = menu)
+    unsigned char Flags;        // PERF_FLAG_* of the engine serving the session
+    unsigned char Reserved[2];
+    unsigned long Reads;
+    unsigned long Writes;
+    unsigned long BankSwitches;
+    unsigned long CacheHits;
+    unsigned long CacheMisses;
+    unsigned long IoPolls;
+    unsigned long IoBusy;
+    unsigned long LatencyMax;
+    unsigned long LatencyHist[PERF_HIST_BUCKETS];
+} PerfCounters;
+
 // Control Variables
 int currentPage;    // Current page
 int totalPages;     // Total pages
 int currentIndex;   // Current file index
-unsigned char totalFiles;     // Total files
-unsigned long totalSize;
-ROMRecord records[MAX_ROM_RECORDS]; // Array to store the ROM records
+int totalFiles;     // Total files
+CatalogEntry selected;  // Entry of the current file
+unsigned int lineStart; // VRAM address of the first character of screen line 0
+unsigned int lineStride;    // VRAM bytes per screen line
+int searching;      // Keys go to the search query
+char query[CATALOG_QUERY_LENGTH + 1]; // Search query, the firmware filters the list with it
+int queryLength;
 
 // Declare the functions
-unsigned long read_ulong(const unsigned char *ptr);
-int isEndOfData(const unsigned char *memory);
-void readROMData(ROMRecord *records, unsigned char *recordCount, unsigned long *sizeTotal);
+void readCatalogHeader();
+void readCatalogInfo();
+void readCatalogEntry(int index, CatalogEntry *entry);
+void printCatalogLines();
+void printCatalogPage(int page);
+void searchCatalog(unsigned char key);
+int searchKey(char key);
+void printFooter();
+void findTextStart();
 int putchar (int character);
 void invert_chars(unsigned char startChar, unsigned char endChar);
 void print_str_normal(const char *str);
@@ -46,6 +82,7 @@ char* mapper_description(int number);
 void charMap(); //debug
 void displayMenu();
 void navigateMenu();
+int readPerfCounters(unsigned char command, PerfCounters *counters);
 void configMenu();
 void helpMenu();
 void loadGame(int index);
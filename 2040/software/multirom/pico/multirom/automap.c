@@ -0,0 +1,286 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// automap.c - Runtime mapper detection for ROMs the multirom tool could not classify
+//
+// Store layout (one flash sector): entry 0 is a header holding AUTOMAP_MAGIC in its offset field, the other entries are
+// appended in the erased space. Appending only programs the page of the new entry (about 1ms with the MSX held by
+// WAIT). The sector is formatted before the ROM starts, and only erased again while a ROM runs when it is full.
+//
+// This file is shared as-is by the RP2040 and RP2350 firmwares.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+#if !PICO_RP2040
+#include "hardware/structs/qmi.h"
+#endif
+#include "multirom.h"
+#include "mapper.h"
+#include "automap.h"
+
+#define AUTOMAP_MAGIC       0x50414D41u // "AMAP"
+
+// Store entry, 16 bytes
+typedef struct {
+    uint32_t offset;                    // ROM offset in the flash image
+    uint32_t size;                      // ROM size
+    uint32_t hash;                      // FNV-1a hash of the first AUTOMAP_HASH_BYTES of the ROM
+    uint8_t mapper;                     // Detected mapper code
+    uint8_t check;                      // ~mapper, tells a complete entry from an erased or half programmed one
+    uint16_t reserved;                  // 0xFFFF
+} automap_entry_t;
+
+#define AUTOMAP_ENTRIES     (FLASH_SECTOR_SIZE / sizeof(automap_entry_t))
+
+// Candidates, in tie-break order
+static const mapper_desc_t *const candidates[] = { &mapper_ascii8, &mapper_ascii16, &mapper_konami, &mapper_konamiscc };
+static const uint8_t candidate_codes[] = { 5, 6, 7, 3 };
+#define AUTOMAP_CANDIDATES  (sizeof(candidate_codes) / sizeof(candidate_codes[0]))
+
+uint32_t automap_log[AUTOMAP_MAX_WRITES];
+uint32_t automap_log_count = 0;
+
+static const automap_entry_t *store_entries = NULL;    // Memory mapped store sector, NULL when there is no room
+static int scores[AUTOMAP_CANDIDATES];
+
+// automap_hash - FNV-1a hash of the start of a ROM, also part of the key of the SRAM saves (sramsave.c)
+uint32_t __no_inline_not_in_flash_func(automap_hash)(const uint8_t *rom, uint32_t size)
+{
+    uint32_t hash = 2166136261u;
+    uint32_t const length = (size < AUTOMAP_HASH_BYTES) ? size : AUTOMAP_HASH_BYTES;
+    for (uint32_t i = 0; i < length; i++)
+    {
+        hash = (hash ^ rom[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// automap_entry_valid - Check if a store entry is complete
+static inline bool automap_entry_valid(const automap_entry_t *entry)
+{
+    return entry->mapper != 0xFF && entry->check == (uint8_t)~entry->mapper;
+}
+
+// automap_lookup - Mapper detected on a previous run
+// Parameters:
+//   rom - ROM data in the XIP flash
+//   offset - ROM offset in the flash image
+//   size - ROM size
+// Returns:
+//   The mapper code, 0 if the ROM was never detected (or the store sector holds no store)
+uint8_t automap_lookup(const uint8_t *rom, uint32_t offset, uint32_t size)
+{
+    if (store_entries == NULL || store_entries[0].offset != AUTOMAP_MAGIC)
+    {
+        return 0;
+    }
+
+    uint32_t const hash = automap_hash(rom, size);
+    uint8_t mapper = 0;
+    for (uint32_t i = 1; i < AUTOMAP_ENTRIES; i++)
+    {
+        const automap_entry_t *entry = &store_entries[i];
+        if (automap_entry_valid(entry) && entry->offset == offset && entry->size == size && entry->hash == hash)
+        {
+            mapper = entry->mapper; // Keep going, the last entry wins
+        }
+    }
+    return mapper;
+}
+
+// automap_leader - Index of the best scoring candidate, ties go to the first one
+static int __no_inline_not_in_flash_func(automap_leader)(void)
+{
+    int leader = 0;
+    for (int i = 1; i < (int)AUTOMAP_CANDIDATES; i++)
+    {
+        if (scores[i] > scores[leader])
+        {
+            leader = i;
+        }
+    }
+    return leader;
+}
+
+// automap_reset - Forget the writes observed so far
+void automap_reset(void)
+{
+    for (int i = 0; i < (int)AUTOMAP_CANDIDATES; i++)
+    {
+        scores[i] = 0;
+    }
+    automap_log_count = 0;
+}
+
+// automap_observe - Score a write to the cartridge pages (mapper_observer_t)
+// Parameters:
+//   addr - Address of the write
+//   data - Byte written
+// Returns:
+//   true once a mapper can be committed to (automap_result())
+bool __no_inline_not_in_flash_func(automap_observe)(uint16_t addr, uint8_t data)
+{
+    bool hit = false;
+    bool switched[AUTOMAP_CANDIDATES] = { false };
+
+    for (int i = 0; i < (int)AUTOMAP_CANDIDATES; i++)
+    {
+        const mapper_desc_t *m = candidates[i];
+        uint8_t const reg = m->decode[(addr & m->mirror_mask) >> 11];
+        if (!reg)
+        {
+            continue;
+        }
+        // The plain 32KB layout the ROM is running on is the power-on layout of every candidate
+        uint8_t const initial = m->linear_start ? (reg - 1) : 0;
+        hit = true;
+        if (data == initial)
+        {
+            scores[i] += 2;
+        }
+        else
+        {
+            scores[i] += 1;
+            switched[i] = true;
+        }
+    }
+    if (!hit)
+    {
+        return false;   // SCC sound registers, writes to ROM, ...
+    }
+
+    // The plain layout stays right for the leader as long as it only sees power-on values
+    automap_log[automap_log_count++] = ((uint32_t)data << 16) | addr;
+    int const leader = automap_leader();
+    if (switched[leader] || automap_log_count == AUTOMAP_MAX_WRITES)
+    {
+        return true;
+    }
+    for (int i = 0; i < (int)AUTOMAP_CANDIDATES; i++)
+    {
+        if (i != leader && scores[leader] - scores[i] < AUTOMAP_MARGIN)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// automap_result - Mapper code of the best scoring candidate
+uint8_t automap_result(void)
+{
+    return candidate_codes[automap_leader()];
+}
+
+// automap_program - Program one page of the store, erasing the sector first if asked to
+// Runs with the MSX held by WAIT and core 1 stopped, nothing may read the flash meanwhile.
+static void __no_inline_not_in_flash_func(automap_program)(uint32_t page_offset, const uint8_t *page, bool erase)
+{
+    uint32_t const sector = (uintptr_t)store_entries - XIP_BASE;
+#if !PICO_RP2040
+    uint32_t const timing = qmi_hw->m[0].timing;   // Set by main for the MSX bus, the boot XIP setup would undo it
+#endif
+    uint32_t const irq_state = save_and_disable_interrupts();
+    if (erase)
+    {
+        flash_range_erase(sector, FLASH_SECTOR_SIZE);
+    }
+    flash_range_program(sector + page_offset, page, FLASH_PAGE_SIZE);
+    restore_interrupts(irq_state);
+#if !PICO_RP2040
+    qmi_hw->m[0].timing = timing;
+#endif
+}
+
+// automap_page_init - Fill a page buffer with the erased state of a store, header included
+static void __no_inline_not_in_flash_func(automap_page_init)(uint8_t *page)
+{
+    automap_entry_t const header = {
+        .offset = AUTOMAP_MAGIC, .size = 0xFFFFFFFFu, .hash = 0xFFFFFFFFu,
+        .mapper = 0xFF, .check = 0xFF, .reserved = 0xFFFF,
+    };
+    for (uint32_t i = 0; i < FLASH_PAGE_SIZE; i++)
+    {
+        page[i] = 0xFF;
+    }
+    *(automap_entry_t *)page = header;
+}
+
+// automap_init - Set the flash sector holding the store, and format it if it does not hold one yet
+// Called between the menu and the selected ROM, the MSX is held by WAIT while the sector is erased.
+// Parameters:
+//   store - XIP address of the sector, must be sector aligned and past the end of the image
+void automap_init(uintptr_t store)
+{
+    if (store + FLASH_SECTOR_SIZE > XIP_BASE + PICO_FLASH_SIZE_BYTES)
+    {
+        store_entries = NULL;   // The image fills the flash, results are not kept
+        return;
+    }
+    store_entries = (const automap_entry_t *)store;
+
+    if (store_entries[0].offset != AUTOMAP_MAGIC)
+    {
+        static uint8_t __attribute__((aligned(4))) page[FLASH_PAGE_SIZE];
+        automap_page_init(page);
+        gpio_init(PIN_WAIT);
+        gpio_set_dir(PIN_WAIT, GPIO_OUT);
+        gpio_put(PIN_WAIT, 0);
+        automap_program(0, page, true);
+        gpio_put(PIN_WAIT, 1);
+    }
+}
+
+// automap_store - Append a detection result to the store
+// Called with the MSX held by WAIT. Core 1 must be done with the flash (romload_wait()), it is reset before the flash
+// is programmed. The sector is erased (and the older results dropped) when it is full.
+// Parameters:
+//   rom - ROM data in the XIP flash
+//   offset - ROM offset in the flash image
+//   size - ROM size
+//   mapper - Detected mapper code
+void __no_inline_not_in_flash_func(automap_store)(const uint8_t *rom, uint32_t offset, uint32_t size, uint8_t mapper)
+{
+    static uint8_t __attribute__((aligned(4))) page[FLASH_PAGE_SIZE];
+
+    if (store_entries == NULL)
+    {
+        return;
+    }
+
+    automap_entry_t const entry = {
+        .offset = offset, .size = size, .hash = automap_hash(rom, size),
+        .mapper = mapper, .check = (uint8_t)~mapper, .reserved = 0xFFFF,
+    };
+    uint32_t slot = 1;
+    while (slot < AUTOMAP_ENTRIES && store_entries[slot].mapper != 0xFF)
+    {
+        slot++;
+    }
+    bool const erase = (slot == AUTOMAP_ENTRIES);
+    if (erase)
+    {
+        slot = 1;
+        automap_page_init(page);
+    }
+    uint32_t const page_offset = (slot * sizeof(automap_entry_t)) & ~(FLASH_PAGE_SIZE - 1);
+    if (!erase)
+    {
+        // Erased bytes are programmed as 0xFF, which leaves the other entries of the page as they are
+        for (uint32_t i = 0; i < FLASH_PAGE_SIZE; i++)
+        {
+            page[i] = ((const uint8_t *)store_entries)[page_offset + i];
+        }
+    }
+    *(automap_entry_t *)&page[slot * sizeof(automap_entry_t) - page_offset] = entry;
+
+    multicore_reset_core1();
+    automap_program(page_offset, page, erase);
+}
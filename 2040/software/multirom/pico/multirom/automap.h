@@ -0,0 +1,44 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// automap.h - Runtime mapper detection for ROMs the multirom tool could not classify
+//
+// ROMs tagged with the AUTO mapper code are started as a plain 32KB cartridge, which is also the boot layout of the
+// Konami, Konami SCC, ASCII8 and ASCII16 mappers. Every write to the cartridge pages is scored against the bank
+// register decode of those four mappers (mapper.h descriptors), a write of the power-on value of a register scoring
+// higher than a bank switch. The engine switches to the leader as soon as it is clearly ahead, when a write really
+// switches one of its banks, or after AUTOMAP_MAX_WRITES register writes, replaying the writes seen so far.
+//
+// The result is appended to a flash sector placed right after the last ROM of the image, keyed by the ROM offset, size
+// and a hash of its first bytes, so the next boot starts straight on the right engine (and on the PIO/DMA engine when
+// the ROM fits in SRAM).
+//
+// This file is shared as-is by the RP2040 and RP2350 firmwares.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef AUTOMAP_H
+#define AUTOMAP_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define AUTOMAP_CODE        11          // Mapper code written by the multirom tool for ROMs of unknown mapper
+#define AUTOMAP_MAX_WRITES  16          // Register writes observed before committing to the leader
+#define AUTOMAP_MARGIN      6           // Score lead that commits early
+#define AUTOMAP_HASH_BYTES  256         // ROM bytes hashed into the store key
+
+extern uint32_t automap_log[AUTOMAP_MAX_WRITES];   // Register writes seen while observing, (data << 16) | address
+extern uint32_t automap_log_count;
+
+void automap_init(uintptr_t store);
+uint32_t automap_hash(const uint8_t *rom, uint32_t size);
+uint8_t automap_lookup(const uint8_t *rom, uint32_t offset, uint32_t size);
+void automap_reset(void);
+bool automap_observe(uint16_t addr, uint8_t data);
+uint8_t automap_result(void);
+void automap_store(const uint8_t *rom, uint32_t offset, uint32_t size, uint8_t mapper);
+
+#endif
@@ -0,0 +1,507 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// mapper.h - Generic MSX cartridge mapper engine
+//
+// Every mapper is described by a constant mapper_desc_t: the 8KB pages it decodes, the segment size, how the bank
+// registers are selected by the address bus (one entry per 2KB window, after the mirror mask), the register width and
+// the initial bank layout. mapper_run() is forced inline and always called with a constant descriptor, so the compiler
+// folds the descriptor away and emits a dedicated loop per mapper, the same code that used to be written by hand.
+//
+// Adding a mapper is a matter of writing a new descriptor and a loadrom_* wrapper that calls mapper_run() with it.
+//
+// This file is shared as-is by the RP2040 and RP2350 firmwares.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef MAPPER_H
+#define MAPPER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "multirom.h"
+#include "romcache.h"
+#include "romload.h"
+#include "perf.h"
+#include "sramsave.h"
+#if PICOVERSE_SCC
+#include "scc.h"
+#endif
+
+#define MAPPER_PAGE_SHIFT   13              // Pages of the 64KB address space are 8KB
+#define MAPPER_WINDOWS      32              // Bank registers are decoded on 2KB windows (address >> 11)
+#define MAPPER_REG(n)       ((n) + 1)       // Decode entry selecting bank register n (0 = no register)
+
+typedef struct {
+    uint8_t first_page;                     // First 8KB page answered by the cartridge (address >> 13)
+    uint8_t last_page;                      // Last 8KB page answered by the cartridge
+    uint8_t bank_shift;                     // Segment size, 13 = 8KB, 14 = 16KB
+    bool linear_start;                      // Bank n starts on segment n (false = every bank starts on segment 0)
+    bool reg_16bit;                         // Registers are written in two halves, A0 selects the LSB (0) or MSB (1)
+    uint16_t reg_mask;                      // Valid segment bits of a bank register
+    uint16_t mirror_mask;                   // Address bits that take part in the bank register decode
+    bool scc;                               // Konami SCC sound chip behind bank 2 (scc.h, PICOVERSE_SCC builds)
+    uint16_t sram_size;                     // Bytes of each battery backed SRAM bank (sramsave.h), 0 = no SRAM
+    uint8_t sram_banks;                     // Number of SRAM banks
+    uint8_t sram_enable;                    // Register bits mapping the SRAM, 0 = the first bit past the ROM segments
+    uint8_t sram_bank_bit;                  // Register bit selecting the SRAM bank
+    uint32_t sram_windows;                  // 2KB windows (bit n = address >> 11) where writes reach a mapped SRAM
+    uint8_t decode[MAPPER_WINDOWS];         // Bank register selected by each 2KB window, MAPPER_REG(n) or 0
+} mapper_desc_t;
+
+// Plain 16KB/32KB ROM: 4000h-BFFFh, no bank registers
+static const mapper_desc_t mapper_plain32 = {
+    .first_page = 2, .last_page = 5, .bank_shift = 13, .linear_start = true,
+    .reg_mask = 0xFF, .mirror_mask = 0xFFFF,
+};
+
+// Linear0 48KB ROM: 0000h-BFFFh, no bank registers
+static const mapper_desc_t mapper_linear48 = {
+    .first_page = 0, .last_page = 5, .bank_shift = 13, .linear_start = true,
+    .reg_mask = 0xFF, .mirror_mask = 0xFFFF,
+};
+
+// Konami SCC: 8KB banks on 4000h-BFFFh, registers on 5000h-57FFh, 7000h-77FFh, 9000h-97FFh, B000h-B7FFh
+static const mapper_desc_t mapper_konamiscc = {
+    .first_page = 2, .last_page = 5, .bank_shift = 13, .linear_start = true,
+    .reg_mask = 0xFF, .mirror_mask = 0xFFFF, .scc = true,
+    .decode = { [0x5000 >> 11] = MAPPER_REG(0), [0x7000 >> 11] = MAPPER_REG(1),
+                [0x9000 >> 11] = MAPPER_REG(2), [0xB000 >> 11] = MAPPER_REG(3) },
+};
+
+// Konami (without SCC): 8KB banks on 4000h-BFFFh, bank 0 is fixed, registers on 6000h-67FFh, 8000h-87FFh, A000h-A7FFh
+static const mapper_desc_t mapper_konami = {
+    .first_page = 2, .last_page = 5, .bank_shift = 13, .linear_start = true,
+    .reg_mask = 0xFF, .mirror_mask = 0xFFFF,
+    .decode = { [0x6000 >> 11] = MAPPER_REG(1), [0x8000 >> 11] = MAPPER_REG(2), [0xA000 >> 11] = MAPPER_REG(3) },
+};
+
+// ASCII8: 8KB banks on 4000h-BFFFh, registers on 6000h-67FFh, 6800h-6FFFh, 7000h-77FFh, 7800h-7FFFh
+static const mapper_desc_t mapper_ascii8 = {
+    .first_page = 2, .last_page = 5, .bank_shift = 13, .linear_start = true,
+    .reg_mask = 0xFF, .mirror_mask = 0xFFFF,
+    .decode = { [0x6000 >> 11] = MAPPER_REG(0), [0x6800 >> 11] = MAPPER_REG(1),
+                [0x7000 >> 11] = MAPPER_REG(2), [0x7800 >> 11] = MAPPER_REG(3) },
+};
+
+// ASCII16: 16KB banks on 4000h-BFFFh, registers on 6000h-67FFh and 7000h-77FFh
+static const mapper_desc_t mapper_ascii16 = {
+    .first_page = 2, .last_page = 5, .bank_shift = 14, .linear_start = true,
+    .reg_mask = 0xFF, .mirror_mask = 0xFFFF,
+    .decode = { [0x6000 >> 11] = MAPPER_REG(0), [0x7000 >> 11] = MAPPER_REG(1) },
+};
+
+// ASCII8 with 8KB of SRAM: a register value with the bit past the ROM segments maps the SRAM, writable on 8000h-BFFFh
+static const mapper_desc_t mapper_ascii8_sram = {
+    .first_page = 2, .last_page = 5, .bank_shift = 13, .linear_start = true,
+    .reg_mask = 0xFF, .mirror_mask = 0xFFFF,
+    .sram_size = 8192, .sram_banks = 1, .sram_enable = 0, .sram_windows = 0x00FF0000u,
+    .decode = { [0x6000 >> 11] = MAPPER_REG(0), [0x6800 >> 11] = MAPPER_REG(1),
+                [0x7000 >> 11] = MAPPER_REG(2), [0x7800 >> 11] = MAPPER_REG(3) },
+};
+
+// ASCII16 with 2KB of SRAM: register value 10h maps the SRAM (mirrored over the bank), writable on 8000h-BFFFh
+static const mapper_desc_t mapper_ascii16_sram = {
+    .first_page = 2, .last_page = 5, .bank_shift = 14, .linear_start = true,
+    .reg_mask = 0xFF, .mirror_mask = 0xFFFF,
+    .sram_size = 2048, .sram_banks = 1, .sram_enable = 0x10, .sram_windows = 0x00FF0000u,
+    .decode = { [0x6000 >> 11] = MAPPER_REG(0), [0x7000 >> 11] = MAPPER_REG(1) },
+};
+
+// Konami Game Master 2: Konami banks, bit 4 maps one of two 4KB SRAM banks (bit 5), writable on B000h-BFFFh
+static const mapper_desc_t mapper_gm2 = {
+    .first_page = 2, .last_page = 5, .bank_shift = 13, .linear_start = true,
+    .reg_mask = 0x3F, .mirror_mask = 0xFFFF,
+    .sram_size = 4096, .sram_banks = 2, .sram_enable = 0x10, .sram_bank_bit = 0x20, .sram_windows = 0x00C00000u,
+    .decode = { [0x6000 >> 11] = MAPPER_REG(1), [0x8000 >> 11] = MAPPER_REG(2), [0xA000 >> 11] = MAPPER_REG(3) },
+};
+
+// NEO8: 8KB banks on 0000h-BFFFh, 12-bit registers on 5000h, 5800h, 6000h, 6800h, 7000h, 7800h (mirrored every 16KB)
+static const mapper_desc_t mapper_neo8 = {
+    .first_page = 0, .last_page = 5, .bank_shift = 13, .linear_start = false,
+    .reg_16bit = true, .reg_mask = 0x0FFF, .mirror_mask = 0x3FFF,
+    .decode = { [0x1000 >> 11] = MAPPER_REG(0), [0x1800 >> 11] = MAPPER_REG(1), [0x2000 >> 11] = MAPPER_REG(2),
+                [0x2800 >> 11] = MAPPER_REG(3), [0x3000 >> 11] = MAPPER_REG(4), [0x3800 >> 11] = MAPPER_REG(5) },
+};
+
+// NEO16: 16KB banks on 0000h-BFFFh, 12-bit registers on 5000h, 6000h, 7000h (mirrored every 16KB)
+static const mapper_desc_t mapper_neo16 = {
+    .first_page = 0, .last_page = 5, .bank_shift = 14, .linear_start = false,
+    .reg_16bit = true, .reg_mask = 0x0FFF, .mirror_mask = 0x3FFF,
+    .decode = { [0x1000 >> 11] = MAPPER_REG(0), [0x2000 >> 11] = MAPPER_REG(1), [0x3000 >> 11] = MAPPER_REG(2) },
+};
+
+// mapper_from_code - Descriptor of a mapper code from the ROM records
+// Parameters:
+//   code - Mapper code (1-9 and 12-14, see the multirom tool)
+// Returns:
+//   Pointer to the descriptor, NULL for unknown codes and for mappers that are not ROM mappers (Nextor)
+static inline const mapper_desc_t *mapper_from_code(uint8_t code)
+{
+    switch (code)
+    {
+        case 1:
+        case 2: return &mapper_plain32;
+        case 3: return &mapper_konamiscc;
+        case 4: return &mapper_linear48;
+        case 5: return &mapper_ascii8;
+        case 6: return &mapper_ascii16;
+        case 7: return &mapper_konami;
+        case 8: return &mapper_neo8;
+        case 9: return &mapper_neo16;
+        case 12: return &mapper_ascii8_sram;
+        case 13: return &mapper_ascii16_sram;
+        case 14: return &mapper_gm2;
+        default: return NULL;
+    }
+}
+
+// mapper_bank_page - First 8KB page covered by a bank
+static inline __attribute__((always_inline)) uint8_t mapper_bank_page(const mapper_desc_t *m, uint8_t bank)
+{
+    return m->first_page + (bank << (m->bank_shift - MAPPER_PAGE_SHIFT));
+}
+
+// mapper_initial_offset - ROM offset mapped on an 8KB page when the cartridge starts
+static inline __attribute__((always_inline)) uint32_t mapper_initial_offset(const mapper_desc_t *m, uint8_t page)
+{
+    uint32_t const index = page - m->first_page;
+    uint32_t const bank = index >> (m->bank_shift - MAPPER_PAGE_SHIFT);
+    uint32_t const half = index & ((1u << (m->bank_shift - MAPPER_PAGE_SHIFT)) - 1);
+    return ((m->linear_start ? bank : 0) << m->bank_shift) + (half << MAPPER_PAGE_SHIFT);
+}
+
+// mapper_boot_mask - 8KB segments mapped when the cartridge starts, one bit per segment (see romload.c)
+static inline __attribute__((always_inline)) uint32_t mapper_boot_mask(const mapper_desc_t *m)
+{
+    uint32_t mask = 0;
+    for (uint8_t page = m->first_page; page <= m->last_page; page++)
+    {
+        mask |= 1u << (mapper_initial_offset(m, page) >> MAPPER_PAGE_SHIFT);
+    }
+    return mask;
+}
+
+// mapper_rom_mask - Mask of the ROM offsets, segment numbers wrap around the ROM size rounded up to a power of two
+// like the address lines on a real cartridge
+// Parameters:
+//   rom_size - ROM size in bytes (0 if unknown, nothing wraps then)
+static inline __attribute__((always_inline)) uint32_t mapper_rom_mask(uint32_t rom_size)
+{
+    if (rom_size == 0)
+    {
+        return 0xFFFFFFFFu;
+    }
+    uint32_t size = 1u << MAPPER_PAGE_SHIFT;
+    while (size < rom_size)
+    {
+        size <<= 1;
+    }
+    return size - 1;
+}
+
+// mapper_write_reg - Apply a write to a bank register
+// Parameters:
+//   m - Mapper descriptor
+//   regs - Bank register values (only used by 16-bit registers)
+//   reg - Bank register index
+//   addr - Address of the write (A0 selects the half of 16-bit registers)
+//   data - Byte written by the MSX
+// Returns:
+//   The new segment number of the bank
+static inline __attribute__((always_inline)) uint32_t mapper_write_reg(const mapper_desc_t *m, uint16_t *regs, uint8_t reg,
+                                                                        uint16_t addr, uint8_t data)
+{
+    if (m->reg_16bit)
+    {
+        regs[reg] = (addr & 0x01) ? ((regs[reg] & 0x00FF) | (data << 8)) : ((regs[reg] & 0xFF00) | data);
+        regs[reg] &= m->reg_mask;
+        return regs[reg];
+    }
+    return data & m->reg_mask;
+}
+
+// mapper_observer_t - Callback fed with the writes to the cartridge pages that do not hit a bank register
+// Returns true to stop serving (see mapper_serve()).
+typedef bool (*mapper_observer_t)(uint16_t addr, uint8_t data);
+
+// mapper_serve - Serve the MSX bus with the given mapper
+// Reads go through a table of direct pointers, one per 8KB page, that bank register writes keep up to date. Segments
+// inside the SRAM copy are served from SRAM, the rest from the demand-paged cache when romcache_init() was called, or
+// from the XIP flash otherwise. While core 1 is still copying the ROM (romload_start()), segments that are not in SRAM
+// yet are read from flash and the pages are switched to SRAM from the idle part of the loop as segments get ready.
+// On the RP2040 flash reads hold the MSX with WAIT, the pages served from flash are tracked in a bitmap so SRAM reads
+// are not slowed down. I/O cycles on PERF_PORT are answered from the idle branch when PICOVERSE_PERF is set.
+// With PICOVERSE_SCC the Konami SCC engine maps the SCC overlay page (scc.h) on 8000h-9FFFh while bank 2 enables the
+// chip, and posts the writes to its registers to the synthesizer.
+// Mappers with battery backed SRAM map the banks of the SRAM shadow (sramsave.h) instead of a ROM segment when a
+// register value has the SRAM bits set, and writes to the SRAM windows of those pages go to the shadow.
+// The runtime mapper detection (automap.c) uses the last two parameters: the engine it starts on observes the writes
+// and returns, with the MSX held by WAIT, when the observer has seen enough. The winning engine is then started with
+// those writes to replay, and releases WAIT once its pages are mapped.
+// Parameters:
+//   m - Mapper descriptor (must be a compile-time constant)
+//   flash - ROM data in the XIP flash
+//   sram - ROM data copied to SRAM
+//   rom_size - ROM size in bytes, the segments past it wrap (mapper_rom_mask()), so a bank register value past the
+//              end of the ROM never points past the SRAM copy or the PSRAM mirror
+//   cached_length - Number of ROM bytes copied (or being copied by romload) to SRAM (0 to serve everything from the
+//                   page cache or flash)
+//   replay - Writes to apply before serving, (data << 16) | address, NULL when not started by automap
+//   replay_count - Number of writes in replay
+//   observe - Write observer, NULL to serve forever
+static inline __attribute__((always_inline)) void mapper_serve(const mapper_desc_t *m, const uint8_t *flash,
+                                                                const uint8_t *sram, uint32_t rom_size,
+                                                                uint32_t cached_length, const uint32_t *replay, uint32_t replay_count,
+                                                                mapper_observer_t observe)
+{
+    const uint8_t *pages[8];                // Direct pointer to the 8KB block mapped on each page
+    uint8_t decode[MAPPER_WINDOWS];         // RAM copy of the register decode, the descriptor itself lives in flash
+    uint16_t regs[8] = {0};                 // Bank register values, only used by 16-bit registers
+    uint32_t offsets[8] = {0};              // ROM offset mapped on each page, to remap it when its segment is loaded
+    uint32_t const rom_mask = mapper_rom_mask(rom_size);
+    uint32_t const loading = romload_all;   // Segments core 1 is copying to SRAM, 0 if the copy was done upfront
+    uint32_t loaded = romload_ready;        // Segments below cached_length that can be read from SRAM
+    if (loaded == loading)
+    {
+        loaded = 0xFFFFFFFFu;               // Nothing left to wait for
+    }
+#if PICO_RP2040
+    uint8_t flash_pages = 0;                // Pages served from flash
+#endif
+    uint8_t sram_pages = 0;                 // Pages mapped on an SRAM bank
+    uint8_t sram_bank[8] = {0};             // SRAM bank mapped on each of those pages
+    uint32_t const sram_enable = m->sram_enable ? m->sram_enable : sramsave_enable;
+#if PICOVERSE_SCC
+    bool scc_on = false;                    // Bank 2 selects the SCC
+
+    // The SCC overlay replaces the ROM page of bank 2 while the chip is enabled
+#define MAPPER_SCC_MAP(page)                                                                                    \
+    do {                                                                                                        \
+        if (m->scc && (page) == SCC_PAGE && scc_on)                                                             \
+        {                                                                                                       \
+            pages[(page)] = scc_overlay(pages[(page)], offsets[(page)]);                                        \
+        }                                                                                                       \
+    } while (0)
+#define MAPPER_SCC_SELECT(reg, data)                                                                            \
+    do {                                                                                                        \
+        if (m->scc && (reg) == MAPPER_REG(SCC_BANK))                                                            \
+        {                                                                                                       \
+            scc_on = scc_enabled(data);                                                                         \
+        }                                                                                                       \
+    } while (0)
+#else
+#define MAPPER_SCC_MAP(page)            ((void)0)
+#define MAPPER_SCC_SELECT(reg, data)    ((void)0)
+#endif
+
+    // Segments below cached_length are in SRAM (once loaded), the rest comes from the demand-paged cache (romcache.c)
+    // when it is enabled, or straight from flash otherwise.
+#if PICO_RP2040
+#define MAPPER_MAP(page, seg_offset)                                                                            \
+    do {                                                                                                        \
+        uint32_t const _o = (seg_offset) & rom_mask;                                                            \
+        bool const _in_sram = (_o < cached_length) && ((loaded >> (_o >> MAPPER_PAGE_SHIFT)) & 1u);             \
+        bool const _in_cache = !(_o < cached_length) && romcache_enabled;                                       \
+        bool const _from_flash = !_in_sram && !_in_cache;                                                       \
+        offsets[(page)] = _o;                                                                                   \
+        pages[(page)] = _in_sram ? &sram[_o] :                                                                  \
+                        _in_cache ? romcache_map((page), _o >> MAPPER_PAGE_SHIFT) : &flash[_o];                 \
+        flash_pages = _from_flash ? (flash_pages | (1u << (page))) : (flash_pages & ~(1u << (page)));           \
+        if (_in_sram) PERF_COUNT(cache_hits); else if (!_in_cache) PERF_COUNT(cache_misses);                    \
+        sram_pages &= ~(1u << (page));                                                                          \
+        MAPPER_SCC_MAP(page);                                                                                   \
+    } while (0)
+#else
+#define MAPPER_MAP(page, seg_offset)                                                                            \
+    do {                                                                                                        \
+        uint32_t const _o = (seg_offset) & rom_mask;                                                            \
+        bool const _in_sram = (_o < cached_length) && ((loaded >> (_o >> MAPPER_PAGE_SHIFT)) & 1u);             \
+        bool const _in_cache = !(_o < cached_length) && romcache_enabled;                                       \
+        offsets[(page)] = _o;                                                                                   \
+        pages[(page)] = _in_sram ? &sram[_o] :                                                                  \
+                        _in_cache ? romcache_map((page), _o >> MAPPER_PAGE_SHIFT) : &flash[_o];                 \
+        if (_in_sram) PERF_COUNT(cache_hits); else if (!_in_cache) PERF_COUNT(cache_misses);                    \
+        sram_pages &= ~(1u << (page));                                                                          \
+        MAPPER_SCC_MAP(page);                                                                                   \
+    } while (0)
+#endif
+
+    // SRAM bank mapped on a page by a register value with the SRAM bits set
+#if PICO_RP2040
+#define MAPPER_SRAM_MAP(page, value)                                                                            \
+    do {                                                                                                        \
+        sram_bank[(page)] = (m->sram_bank_bit && ((value) & m->sram_bank_bit)) ? 1 : 0;                         \
+        pages[(page)] = sramsave_block(sram_bank[(page)]);                                                      \
+        sram_pages |= 1u << (page);                                                                             \
+        flash_pages &= ~(1u << (page));                                                                         \
+    } while (0)
+#else
+#define MAPPER_SRAM_MAP(page, value)                                                                            \
+    do {                                                                                                        \
+        sram_bank[(page)] = (m->sram_bank_bit && ((value) & m->sram_bank_bit)) ? 1 : 0;                         \
+        pages[(page)] = sramsave_block(sram_bank[(page)]);                                                      \
+        sram_pages |= 1u << (page);                                                                             \
+    } while (0)
+#endif
+
+    // Bank register write, 16KB banks map the second half of the segment on the next page
+#define MAPPER_WRITE(reg, addr, data)                                                                           \
+    do {                                                                                                        \
+        uint32_t const _segment = mapper_write_reg(m, regs, (reg) - 1, (addr), (data));                         \
+        MAPPER_SCC_SELECT(reg, data);                                                                           \
+        uint8_t const _first = mapper_bank_page(m, (reg) - 1);                                                  \
+        if (m->sram_size && (_segment & sram_enable))                                                           \
+        {                                                                                                       \
+            MAPPER_SRAM_MAP(_first, _segment);                                                                  \
+            if (m->bank_shift > MAPPER_PAGE_SHIFT)                                                              \
+            {                                                                                                   \
+                MAPPER_SRAM_MAP(_first + 1, _segment);                                                          \
+            }                                                                                                   \
+        }                                                                                                       \
+        else                                                                                                    \
+        {                                                                                                       \
+            MAPPER_MAP(_first, _segment << m->bank_shift);                                                      \
+            if (m->bank_shift > MAPPER_PAGE_SHIFT)                                                              \
+            {                                                                                                   \
+                MAPPER_MAP(_first + 1, (_segment << m->bank_shift) + (1u << MAPPER_PAGE_SHIFT));                \
+            }                                                                                                   \
+        }                                                                                                       \
+    } while (0)
+
+    memcpy(decode, m->decode, sizeof(decode));
+    for (uint8_t page = m->first_page; page <= m->last_page; page++)
+    {
+        MAPPER_MAP(page, mapper_initial_offset(m, page));
+    }
+    for (uint32_t i = 0; i < replay_count; i++)
+    {
+        uint16_t const addr = replay[i] & 0xFFFF;
+        uint8_t const reg = decode[(addr & m->mirror_mask) >> 11];
+        if (reg)
+        {
+            MAPPER_WRITE(reg, addr, (replay[i] >> 16) & 0xFF);
+        }
+    }
+    if (replay)
+    {
+        gpio_put(PIN_WAIT, 1); // Left asserted by the observing engine
+    }
+
+    gpio_set_dir_in_masked(0xFF << 16); // Set data bus to input mode
+    while (true)
+    {
+        // One snapshot of the bus per iteration: control lines, address and data are sampled together
+        uint32_t const bus = gpio_get_all();
+
+        if (!(bus & (1u << PIN_SLTSL))) // Slot selected (active low)
+        {
+            uint16_t addr = bus & 0x00FFFF; // Address bus
+            // Check if the address is within the ROM range (single unsigned compare)
+            if ((uint16_t)(addr - (m->first_page << MAPPER_PAGE_SHIFT)) < ((m->last_page - m->first_page + 1) << MAPPER_PAGE_SHIFT))
+            {
+                if (!(bus & (1u << PIN_RD))) // Read cycle (active low)
+                {
+                    uint32_t const perf_start = PERF_READ_START();
+                    gpio_set_dir_out_masked(0xFF << 16); // Set data bus to output mode
+                    uint8_t const page = addr >> MAPPER_PAGE_SHIFT;
+#if PICO_RP2040
+                    uint8_t data;
+                    if (flash_pages & (1u << page))
+                    {
+                        gpio_put(PIN_WAIT, 0);
+                        data = pages[page][addr & 0x1FFFu];
+                        gpio_put(PIN_WAIT, 1);
+                    }
+                    else
+                    {
+                        data = pages[page][addr & 0x1FFFu];
+                    }
+#else
+                    uint8_t const data = pages[page][addr & 0x1FFFu];
+#endif
+                    gpio_put_masked(0xFF0000, (uint32_t)data << 16); // Write the data to the data bus
+                    PERF_READ_DONE(perf_start);
+                    while (!(gpio_get(PIN_RD)))  // Wait until the read cycle completes (RD goes high)
+                    {
+                        tight_loop_contents();
+                    }
+                    gpio_set_dir_in_masked(0xFF << 16); // Return data bus to input mode after cycle completes
+                }
+                else if (!(bus & (1u << PIN_WR))) // Write cycle (active low)
+                {
+                    uint8_t const reg = decode[(addr & m->mirror_mask) >> 11];
+                    PERF_COUNT(writes);
+                    if (reg)
+                    {
+                        PERF_COUNT(bank_switches);
+                        MAPPER_WRITE(reg, addr, (bus >> 16) & 0xFF);
+                    }
+                    else if (m->sram_size && ((m->sram_windows >> (addr >> 11)) & 1u) &&
+                             (sram_pages & (1u << (addr >> MAPPER_PAGE_SHIFT))))
+                    {
+                        sramsave_write(m->sram_size, sram_bank[addr >> MAPPER_PAGE_SHIFT], addr, (bus >> 16) & 0xFF);
+                    }
+#if PICOVERSE_SCC
+                    else if (m->scc && scc_on && (addr & 0xF800) == SCC_BASE)
+                    {
+                        scc_bus_write(addr, (bus >> 16) & 0xFF);
+                    }
+#endif
+                    else if (observe && observe(addr, (bus >> 16) & 0xFF))
+                    {
+                        gpio_put(PIN_WAIT, 0); // Hold the next cycle until the next engine is ready
+                        while (!(gpio_get(PIN_WR)))
+                        {
+                            tight_loop_contents();
+                        }
+                        return;
+                    }
+
+                    while (!(gpio_get(PIN_WR)))
+                    {
+                        tight_loop_contents();
+                    }
+                }
+            }
+        }
+        else
+        {
+            PERF_IO(bus);
+            if (loaded != 0xFFFFFFFFu) // Not selected: pick up the segments core 1 finished copying
+            {
+                uint32_t const ready = romload_ready;
+                if (ready != loaded)
+                {
+                    loaded = (ready == loading) ? 0xFFFFFFFFu : ready;
+                    for (uint8_t page = m->first_page; page <= m->last_page; page++)
+                    {
+                        if (offsets[page] < cached_length && !(sram_pages & (1u << page)))
+                        {
+                            MAPPER_MAP(page, offsets[page]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+#undef MAPPER_WRITE
+#undef MAPPER_SRAM_MAP
+#undef MAPPER_MAP
+#undef MAPPER_SCC_SELECT
+#undef MAPPER_SCC_MAP
+}
+
+// mapper_run - Serve the MSX bus with the given mapper (never returns, see mapper_serve())
+static inline __attribute__((always_inline)) void mapper_run(const mapper_desc_t *m, const uint8_t *flash,
+                                                              const uint8_t *sram, uint32_t rom_size,
+                                                              uint32_t cached_length)
+{
+    mapper_serve(m, flash, sram, rom_size, cached_length, NULL, 0, NULL);
+}
+
+#endif
@@ -0,0 +1,64 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// msx_bus.h - CPU-free read engine for the MSX cartridge bus (PIO + chained DMA)
+//
+// Three PIO state machines and four DMA channels answer every slot read without CPU involvement. The address is
+// captured by PIO, the 8KB page entry is fetched from a RAM-resident page table by DMA, the byte address is built by
+// PIO and the byte is fetched by DMA and pushed to the output state machine that drives the data bus. The CPU only
+// has to drain the write FIFO and update the page table when the MSX writes to a mapper bank register.
+//
+// All pages served by the engine must live in SRAM and start on an 8KB boundary. The pages outside the cartridge are
+// left unmapped: the engine does not answer their reads and leaves the data bus alone, like the CPU engines.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef MSX_BUS_H
+#define MSX_BUS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hardware/pio.h"
+
+#define MSX_BUS_PAGE_SHIFT  13                          // 8KB pages
+#define MSX_BUS_PAGE_SIZE   (1u << MSX_BUS_PAGE_SHIFT)
+#define MSX_BUS_PAGES       8                           // 64KB address space / 8KB
+#define MSX_BUS_READ_BATCH  0x0FFFFFFFu                 // Reads per run of the byte address DMA channel (28-bit count)
+
+extern PIO msx_bus_pio;
+extern uint msx_bus_sm_write;
+extern volatile uint32_t msx_bus_page_table[MSX_BUS_PAGES];
+extern uint8_t msx_bus_open_page[MSX_BUS_PAGE_SIZE];
+
+void msx_bus_init(void);
+void msx_bus_start(void);
+uint32_t msx_bus_read_count(void);
+void msx_bus_serve_io(void (*serve)(uint32_t bus), uint32_t bus);
+
+// msx_bus_map_page - Point an 8KB page of the slot at an 8KB aligned SRAM block
+// Parameters:
+//   page - Page number (0-7, address >> 13)
+//   base - 8KB aligned SRAM address that will answer reads in that page
+static inline void msx_bus_map_page(uint8_t page, const uint8_t *base)
+{
+    msx_bus_page_table[page] = (uint32_t)base >> MSX_BUS_PAGE_SHIFT;
+}
+
+// msx_bus_unmap_page - Stop answering the reads of an 8KB page of the slot, the data bus is not driven on that page
+// Map msx_bus_open_page instead for a page of the cartridge that reads as 0xFF.
+static inline void msx_bus_unmap_page(uint8_t page)
+{
+    msx_bus_page_table[page] = 0; // No SRAM block starts at address 0, msx_read_fetch skips the read
+}
+
+// msx_bus_get_write - Wait for the next slot write captured by the engine
+// Returns:
+//   (data << 16) | address
+static inline uint32_t msx_bus_get_write(void)
+{
+    return pio_sm_get_blocking(msx_bus_pio, msx_bus_sm_write);
+}
+
+#endif
@@ -0,0 +1,128 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// msx_trace.c - Bus trace capture (PIO sniffer + DMA ring buffers)
+//
+// Capture path (no CPU involvement):
+//   sm_trace --RX--> ch_bus  (snapshot -> msx_trace_bus ring)  --chain--> ch_time (timer -> msx_trace_time ring)
+//            --chain--> ch_bus
+// Both channels move one word per trigger and their write rings have the same size, so entry i of the two rings
+// always belong together.
+//
+// This file is shared as-is by the RP2040 and RP2350 firmwares.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/pio.h"
+#include "hardware/dma.h"
+#include "hardware/structs/timer.h"
+#include "multirom.h"
+#include "msx_trace.h"
+#include "msx_bus.pio.h"
+
+#if PICOVERSE_TRACE
+
+static uint32_t __uninitialized_ram(msx_trace_magic);
+static uint32_t __uninitialized_ram(msx_trace_bus)[MSX_TRACE_ENTRIES] __attribute__((aligned(1u << MSX_TRACE_RING_BITS)));
+static uint32_t __uninitialized_ram(msx_trace_time)[MSX_TRACE_ENTRIES] __attribute__((aligned(1u << MSX_TRACE_RING_BITS)));
+
+// msx_trace_start - Clear the rings and start capturing
+// The trace of the previous session is lost, call msx_trace_dump first.
+void msx_trace_start(void)
+{
+    PIO const pio = pio1;                   // pio0 belongs to the read engine
+    memset(msx_trace_bus, 0, sizeof(msx_trace_bus));
+    memset(msx_trace_time, 0, sizeof(msx_trace_time)); // A zero time marks a free entry
+    msx_trace_magic = MSX_TRACE_MAGIC;
+
+    uint const sm = pio_claim_unused_sm(pio, true);
+    uint const offset = pio_add_program(pio, &msx_trace_capture_program);
+    pio_sm_config c = msx_trace_capture_program_get_default_config(offset);
+    sm_config_set_in_pins(&c, 0);
+    sm_config_set_out_shift(&c, true, false, 32);
+    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_RX);
+    pio_sm_init(pio, sm, offset, &c);
+
+    int const ch_bus = dma_claim_unused_channel(true);
+    int const ch_time = dma_claim_unused_channel(true);
+
+    // ch_bus: snapshot from sm -> msx_trace_bus, then ch_time
+    dma_channel_config dc = dma_channel_get_default_config(ch_bus);
+    channel_config_set_transfer_data_size(&dc, DMA_SIZE_32);
+    channel_config_set_read_increment(&dc, false);
+    channel_config_set_write_increment(&dc, true);
+    channel_config_set_ring(&dc, true, MSX_TRACE_RING_BITS);
+    channel_config_set_dreq(&dc, pio_get_dreq(pio, sm, false));
+    channel_config_set_chain_to(&dc, ch_time);
+    dma_channel_configure(ch_bus, &dc, msx_trace_bus, &pio->rxf[sm], 1, false);
+
+    // ch_time: timer -> msx_trace_time, then re-arm ch_bus
+    dc = dma_channel_get_default_config(ch_time);
+    channel_config_set_transfer_data_size(&dc, DMA_SIZE_32);
+    channel_config_set_read_increment(&dc, false);
+    channel_config_set_write_increment(&dc, true);
+    channel_config_set_ring(&dc, true, MSX_TRACE_RING_BITS);
+    channel_config_set_chain_to(&dc, ch_bus);
+    dma_channel_configure(ch_time, &dc, msx_trace_time, &timer_hw->timerawl, 1, false);
+
+    dma_channel_start(ch_bus);
+    pio_sm_set_enabled(pio, sm, true);
+}
+
+// msx_trace_dump - Print the trace of the previous session on stdio, oldest entry first
+// One line per cycle: time in us since the first entry, address, data, M(emory)/I(/O) and R(ead)/W(rite). Cycles with
+// neither strobe (interrupt acknowledge) are shown with '-'.
+void msx_trace_dump(void)
+{
+    if (msx_trace_magic != MSX_TRACE_MAGIC)
+    {
+        return;
+    }
+
+    // The DMA registers did not survive the reset, the newest entry is the one with the latest time
+    uint32_t head = 0;
+    for (uint32_t i = 1; i < MSX_TRACE_ENTRIES; i++)
+    {
+        if ((int32_t)(msx_trace_time[i] - msx_trace_time[head]) > 0)
+        {
+            head = i;
+        }
+    }
+
+    uint32_t first = 0;
+    printf("Bus trace of the previous session\n");
+    for (uint32_t n = 1; n <= MSX_TRACE_ENTRIES; n++)
+    {
+        uint32_t const i = (head + n) % MSX_TRACE_ENTRIES;
+        uint32_t const bus = msx_trace_bus[i];
+        if (msx_trace_time[i] == 0)
+        {
+            continue;
+        }
+        if (first == 0)
+        {
+            first = msx_trace_time[i];
+        }
+        printf("%10lu %04lX %02lX %c%c\n", (unsigned long)(msx_trace_time[i] - first), (unsigned long)(bus & 0xFFFF),
+               (unsigned long)((bus >> 16) & 0xFF), (bus & (1u << PIN_IORQ)) ? 'M' : 'I',
+               !(bus & (1u << PIN_RD)) ? 'R' : !(bus & (1u << PIN_WR)) ? 'W' : '-');
+    }
+    msx_trace_magic = 0;
+}
+
+#else
+
+void msx_trace_start(void)
+{
+}
+
+void msx_trace_dump(void)
+{
+}
+
+#endif
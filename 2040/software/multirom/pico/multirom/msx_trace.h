@@ -0,0 +1,37 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// msx_trace.h - Bus trace capture (PIO sniffer + DMA ring buffers)
+//
+// When the firmware is built with PICOVERSE_TRACE a state machine on the second PIO block (msx_trace_capture) snapshots
+// GPIO0-31 for every cycle in which /SLTSL or /IORQ is low, and two chained DMA channels store the snapshot and the
+// 1MHz timer in a pair of ring buffers. Nothing runs on the cores, so the engines are not disturbed. The rings live
+// in uninitialized RAM: after a soft reset of the Pico the trace of the previous session is printed on stdio at boot,
+// oldest entry first, ready for offline analysis of the bank switch patterns. Without PICOVERSE_TRACE the functions
+// do nothing and no RAM is used.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef MSX_TRACE_H
+#define MSX_TRACE_H
+
+#include <stdint.h>
+
+// Size of each ring in bytes, as a power of two. The DMA write ring wraps at 32KB at most.
+#ifndef MSX_TRACE_RING_BITS
+#if PICO_RP2040
+#define MSX_TRACE_RING_BITS 13          // 8KB, 2048 entries (the SRAM is mostly taken by the ROM cache)
+#else
+#define MSX_TRACE_RING_BITS 15          // 32KB, 8192 entries
+#endif
+#endif
+
+#define MSX_TRACE_ENTRIES   ((1u << MSX_TRACE_RING_BITS) / sizeof(uint32_t))
+#define MSX_TRACE_MAGIC     0x43415254u // "TRAC"
+
+void msx_trace_start(void);
+void msx_trace_dump(void);
+
+#endif
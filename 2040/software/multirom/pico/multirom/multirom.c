@@ -17,6 +17,7 @@
 #include "pico/stdlib.h"
 #include "pico/multicore.h"
 #include "hardware/clocks.h"
+#include "hardware/flash.h"
 #include "hardware/structs/watchdog.h"
 #include "hardware/watchdog.h"
 #include "hardware/regs/addressmap.h"
@@ -24,12 +25,21 @@
 
 #include "multirom.h"
 #include "nextor.h"
-
-// config area and buffer for the ROM data
-#define ROM_NAME_MAX    50          // Maximum size of the ROM name
-#define MAX_ROM_RECORDS 128         // Maximum ROM files supported
-#define ROM_RECORD_SIZE (ROM_NAME_MAX + 1 + (sizeof(uint32_t) * 2)) // Name + mapper + size + offset
-#define MONITOR_ADDR    (0x8000 + (ROM_RECORD_SIZE * MAX_ROM_RECORDS) + 1) // Monitor ROM address within image (currently 0x9D81)
+#include "nextor_ram.h"
+#include "msx_bus.h"
+#include "mapper.h"
+#include "romcache.h"
+#include "romload.h"
+#include "romlz.h"
+#include "perf.h"
+#include "romconfig.h"
+#include "catalog.h"
+#include "msx_trace.h"
+#include "automap.h"
+#include "sramsave.h"
+#include "sccplus.h"
+
+// buffer for the ROM data
 #define CACHE_SIZE      196608     // 192KB cache size for ROM data
 
 // This symbol marks the end of the main program in flash.
@@ -37,27 +47,12 @@
 extern unsigned char __flash_binary_end;
 
 // SRAM buffer to cache ROM data
-static uint8_t rom_sram[CACHE_SIZE];
+static uint8_t __attribute__((aligned(MSX_BUS_PAGE_SIZE))) rom_sram[CACHE_SIZE]; // 8KB aligned so the DMA engine can serve it
 static uint32_t active_rom_size = 0;
 
 //pointer to the custom data
 const uint8_t *rom = (const uint8_t *)&__flash_binary_end;
 
-// Structure to represent a ROM record
-// The ROM record will contain the name of the ROM, the mapper code, the size of the ROM and the offset in the flash memory
-// Name: ROM_NAME_MAX bytes
-// Mapper: 1 byte
-// Size: 4 bytes
-// Offset: 4 bytes
-typedef struct {
-    char Name[ROM_NAME_MAX];
-    unsigned char Mapper;
-    unsigned long Size;
-    unsigned long Offset;
-} ROMRecord;
-
-ROMRecord records[MAX_ROM_RECORDS]; // Array to store the ROM records
-
 // Initialize GPIO pins
 static inline void setup_gpio()
 {
@@ -96,35 +91,10 @@ static inline void setup_gpio()
     gpio_init(PIN_SLTSL); gpio_set_dir(PIN_SLTSL, GPIO_IN);
 }
 
-// read_ulong - Read a 4-byte value from the memory area
-// This function will read a 4-byte value from the memory area pointed by ptr and return the value as an unsigned long
-// Parameters:
-//   ptr - Pointer to the memory area to read the value from
-// Returns:
-//   The 4-byte value as an unsigned long 
-unsigned long read_ulong(const unsigned char *ptr) {
-    return (unsigned long)ptr[0] |
-           ((unsigned long)ptr[1] << 8) |
-           ((unsigned long)ptr[2] << 16) |
-           ((unsigned long)ptr[3] << 24);
-}
-
-// isEndOfData - Check if the memory area is the end of the data
-// This function will check if the memory area pointed by memory is the end of the data. The end of the data is defined by all bytes being 0xFF.
-// Parameters:
-//   memory - Pointer to the memory area to check
-// Returns:
-//   1 if the memory area is the end of the data, 0 otherwise
-int isEndOfData(const unsigned char *memory) {
-    for (int i = 0; i < ROM_RECORD_SIZE; i++) {
-        if (memory[i] != 0xFF) {
-            return 0;
-        }
-    }
-    return 1;
-}
-
 //load the MSX Menu ROM into the MSX
+// The records of the ROMs are read in place from the configuration area that follows the menu (romconfig.h).
+// Returns:
+//   Index of the record of the selected ROM
 int __no_inline_not_in_flash_func(loadrom_msx_menu)(uint32_t offset)
 {
 
@@ -134,30 +104,23 @@ int __no_inline_not_in_flash_func(loadrom_msx_menu)(uint32_t offset)
     gpio_put(PIN_WAIT, 0); // Wait until we are ready to read the ROM
     memset(rom_sram, 0, 32768); // Clear the SRAM buffer
     memcpy(rom_sram, rom + offset, 32768); //for 32KB ROMs we start at 0x4000
+    romconfig_open(rom + offset); // Records of the ROMs in the flash, read in place
+    catalog_build(); // Search index of the ROMs, the menu reads its pages through the catalog port
     gpio_put(PIN_WAIT, 1); // Lets go!
 
-    int record_count = 0; // Record count
-    const uint8_t *record_ptr = rom + offset + 0x4000; // Pointer to the ROM records
-    for (int i = 0; i < MAX_ROM_RECORDS; i++)      // Read the ROMs from the configuration area
-    {
-        if (isEndOfData(record_ptr)) {
-            break; // Stop if end of data is reached
-        }
-        memcpy(records[record_count].Name, record_ptr, ROM_NAME_MAX); // Copy the ROM name
-        record_ptr += ROM_NAME_MAX; // Move the pointer to the next field
-        records[record_count].Mapper = *record_ptr++; // Read the mapper code
-        records[record_count].Size = read_ulong(record_ptr); // Read the ROM size
-        record_ptr += sizeof(unsigned long); // Move the pointer to the next field
-        records[record_count].Offset = read_ulong(record_ptr); // Read the ROM offset
-        record_ptr += sizeof(unsigned long); // Move the pointer to the next record
-        record_count++; // Increment the record count
-    }
-
-    uint8_t rom_index = 0;
+    uint16_t rom_index = 0;
+    uint8_t select_high = 0; // High byte of the index, menus of 256 ROMs or less never write it
     gpio_set_dir_in_masked(0xFF << 16); // Set data bus to input mode
     bool rom_selected = false; // ROM selected flag
     while (true)  // Loop until a ROM is selected
     {
+        uint32_t const bus = gpio_get_all();
+        PERF_IO(bus); // Performance counters port, read by the config screen of the menu
+        if (CATALOG_CYCLE(bus)) // Catalog port, the menu reads its pages there
+        {
+            catalog_io(bus);
+        }
+
         // Check control signals
         bool sltsl = !(gpio_get(PIN_SLTSL)); // Slot selected (active low)
         bool rd = !(gpio_get(PIN_RD));       // Read cycle (active low)
@@ -179,14 +142,22 @@ int __no_inline_not_in_flash_func(loadrom_msx_menu)(uint32_t offset)
                     }
                     gpio_set_dir_in_masked(0xFF << 16); // Set data bus to input mode
                 }
-                if (wr && addr == MONITOR_ADDR) // Monitor ROM address from configuration table
+                if (wr && (addr == ROMCONFIG_SELECT || addr == ROMCONFIG_SELECT_HIGH)) // Select register, 16-bit index
                 {   
-                    rom_index = (gpio_get_all() >> 16) & 0xFF;
+                    uint8_t const data = (gpio_get_all() >> 16) & 0xFF;
+                    if (addr == ROMCONFIG_SELECT_HIGH)
+                    {
+                        select_high = data;
+                    }
+                    else
+                    {
+                        rom_index = (select_high << 8) | data;
+                        rom_selected = rom_index < romconfig_count(); // ROM selected
+                    }
                     while (!(gpio_get(PIN_WR))) { // Wait until the write cycle completes (WR goes high){
                         tight_loop_contents();
                     }
                     gpio_set_dir_in_masked(0xFF << 16); // Set data bus to input mode
-                    rom_selected = true;    // ROM selected
                 }
             } 
         }
@@ -197,6 +168,35 @@ int __no_inline_not_in_flash_func(loadrom_msx_menu)(uint32_t offset)
     }
 }
 
+// rom_cache_fill - Prepare the SRAM cache for a ROM
+// ROMs that fit are copied to SRAM by core 1 in the background (romload.c), boot segments first, while core 0 serves
+// the segments that are not copied yet from flash. Bigger ROMs are served through the demand-paged segment cache
+// (romcache.c), which is preloaded with the first segments of the ROM. ROMs stored as segments (romlz.h) are read
+// into SRAM the same way, through romload_read.
+// Parameters:
+//   offset - ROM offset in the flash image
+//   boot_mask - Segments mapped when the cartridge starts, copied first (mapper_boot_mask())
+// Returns:
+//   Number of ROM bytes served from SRAM (0 when the ROM is demand-paged)
+static uint32_t __no_inline_not_in_flash_func(rom_cache_fill)(uint32_t offset, uint32_t boot_mask)
+{
+    if (active_rom_size > sizeof(rom_sram))
+    {
+        romcache_init(rom + offset, active_rom_size, rom_sram, sizeof(rom_sram) / ROMCACHE_SLOT_SIZE);
+        return 0;
+    }
+
+    uint32_t bytes_to_cache = active_rom_size;
+    if (bytes_to_cache == 0)
+    {
+        bytes_to_cache = sizeof(rom_sram);
+    }
+
+    romload_start(rom + offset, rom_sram, bytes_to_cache,
+                  (bytes_to_cache + ROMLOAD_SEGMENT_SIZE - 1) >> ROMLOAD_SEGMENT_SHIFT, boot_mask);
+    return bytes_to_cache;
+}
+
 // loadrom_plain32 - Load a simple 32KB (or less) ROM into the MSX directly from the pico flash
 // 32KB ROMS have two pages of 16Kb each in the following areas:
 // 0x4000-0x7FFF and 0x8000-0xBFFF
@@ -205,36 +205,8 @@ int __no_inline_not_in_flash_func(loadrom_msx_menu)(uint32_t offset)
 // AB is on 0x0000, 0x0001
 void __no_inline_not_in_flash_func(loadrom_plain32)(uint32_t offset, bool cache_enable)
 {
-    const uint8_t *rom_base = rom + offset;
-
-    if (cache_enable)
-    {
-        gpio_init(PIN_WAIT);
-        gpio_set_dir(PIN_WAIT, GPIO_OUT);
-        gpio_put(PIN_WAIT, 0);
-        memset(rom_sram, 0, 32768);
-        memcpy(rom_sram, rom_base, 32768);
-        gpio_put(PIN_WAIT, 1);
-        rom_base = rom_sram;
-    }
-
-    gpio_set_dir_in_masked(0xFF << 16);
-    while (true)
-    {
-        if (!gpio_get(PIN_SLTSL))
-        {
-            uint16_t addr = gpio_get_all() & 0x00FFFF;
-            if ((addr >= 0x4000) && (addr <= 0xBFFF) && !gpio_get(PIN_RD))
-            {
-                uint8_t data = rom_base[addr - 0x4000];
-                gpio_set_dir_out_masked(0xFF << 16);
-                gpio_put_masked(0xFF0000, (uint32_t)data << 16);
-                while (!gpio_get(PIN_RD))
-                    tight_loop_contents();
-                gpio_set_dir_in_masked(0xFF << 16);
-            }
-        }
-    }
+    uint32_t const cached_length = cache_enable ? rom_cache_fill(offset, mapper_boot_mask(&mapper_plain32)) : 0;
+    mapper_run(&mapper_plain32, rom + offset, rom_sram, active_rom_size, cached_length);
 }
 
 // loadrom_linear48 - Load a simple 48KB Linear0 ROM into the MSX directly from the pico flash
@@ -243,36 +215,8 @@ void __no_inline_not_in_flash_func(loadrom_plain32)(uint32_t offset, bool cache_
 // AB is on 0x4000, 0x4001
 void __no_inline_not_in_flash_func(loadrom_linear48)(uint32_t offset, bool cache_enable)
 {
-    const uint8_t *rom_base = rom + offset;
-
-    if (cache_enable)
-    {
-        gpio_init(PIN_WAIT);
-        gpio_set_dir(PIN_WAIT, GPIO_OUT);
-        gpio_put(PIN_WAIT, 0);
-        memset(rom_sram, 0, 49152);
-        memcpy(rom_sram, rom_base, 49152);
-        gpio_put(PIN_WAIT, 1);
-        rom_base = rom_sram;
-    }
-    
-    gpio_set_dir_in_masked(0xFF << 16); // Set data bus to input mode
-    while (true) 
-    {
-        if (!gpio_get(PIN_SLTSL))
-        {
-            uint16_t addr = gpio_get_all() & 0x00FFFF; // Read the address bus
-            if ((addr >= 0x0000) && (addr <= 0xBFFF) && !gpio_get(PIN_RD)) // Check if the address is within the ROM range
-            {
-                uint8_t data = rom_base[addr];
-                gpio_set_dir_out_masked(0xFF << 16);
-                gpio_put_masked(0xFF0000, (uint32_t)data << 16);
-                while (!gpio_get(PIN_RD))
-                    tight_loop_contents();
-                gpio_set_dir_in_masked(0xFF << 16);
-            }
-        }
-    }
+    uint32_t const cached_length = cache_enable ? rom_cache_fill(offset, mapper_boot_mask(&mapper_linear48)) : 0;
+    mapper_run(&mapper_linear48, rom + offset, rom_sram, active_rom_size, cached_length);
 }
 
 // loadrom_konamiscc - Load a any Konami SCC ROM into the MSX directly from the pico flash
@@ -284,85 +228,8 @@ void __no_inline_not_in_flash_func(loadrom_linear48)(uint32_t offset, bool cache
 // AB is on 0x0000, 0x0001
 void __no_inline_not_in_flash_func(loadrom_konamiscc)(uint32_t offset, bool cache_enable)
 {
-    uint8_t bank_registers[4] = {0, 1, 2, 3}; // Initial banks 0-3 mapped
-    uint32_t cached_length = 0;
-
-    if (cache_enable)
-    {
-        gpio_init(PIN_WAIT);
-        gpio_set_dir(PIN_WAIT, GPIO_OUT);
-        gpio_put(PIN_WAIT, 0);
-
-        uint32_t bytes_to_cache = active_rom_size;
-        if (bytes_to_cache == 0 || bytes_to_cache > sizeof(rom_sram))
-        {
-            bytes_to_cache = sizeof(rom_sram);
-        }
-
-        memset(rom_sram, 0, bytes_to_cache);
-        memcpy(rom_sram, rom + offset, bytes_to_cache);
-        gpio_put(PIN_WAIT, 1);
-        cached_length = bytes_to_cache;
-    }
-
-    gpio_set_dir_in_masked(0xFF << 16); // Set data bus to input mode
-    while (true) 
-    {
-        // Check control signals
-        bool sltsl = !(gpio_get(PIN_SLTSL)); // Slot selected (active low)
-        bool rd = !(gpio_get(PIN_RD));       // Read cycle (active low)
-        bool wr = !(gpio_get(PIN_WR));       // Write cycle (active low)
-
-        if (sltsl)
-        {
-            uint16_t addr = gpio_get_all() & 0x00FFFF; // Read the address bus
-            if (addr >= 0x4000 && addr <= 0xBFFF)  // Check if the address is within the ROM range
-            {
-                if (rd) 
-                {
-                    gpio_set_dir_out_masked(0xFF << 16); // Set data bus to output mode
-                    uint32_t const rom_offset = offset + (bank_registers[(addr - 0x4000) >> 13] * 0x2000u) + (addr & 0x1FFFu); // Calculate the ROM offset
-
-                    uint8_t data;
-                    uint32_t const relative_offset = (rom_offset >= offset) ? (rom_offset - offset) : cached_length;
-                    if (cache_enable && relative_offset < cached_length)
-                    {
-                        data = rom_sram[relative_offset];
-                    }
-                    else
-                    {
-                        gpio_put(PIN_WAIT, 0);
-                        data = rom[rom_offset];
-                        gpio_put(PIN_WAIT, 1);
-                    }
-
-                    gpio_put_masked(0xFF0000, (uint32_t)data << 16); // Write the data to the data bus
-                    while (!(gpio_get(PIN_RD)))  // Wait until the read cycle completes (RD goes high)
-                    {
-                        tight_loop_contents();
-                    }
-                    gpio_set_dir_in_masked(0xFF << 16); // Return data bus to input mode after cycle completes
-                } else if (wr) 
-                {
-                    // Handle writes to bank switching addresses
-                    if ((addr >= 0x5000)  && (addr <= 0x57FF)) { 
-                        bank_registers[0] = (gpio_get_all() >> 16) & 0xFF; // Read the data bus and store in bank register
-                    } else if ((addr >= 0x7000) && (addr <= 0x77FF)) {
-                        bank_registers[1] = (gpio_get_all() >> 16) & 0xFF;
-                    } else if ((addr >= 0x9000) && (addr <= 0x97FF)) {
-                        bank_registers[2] = (gpio_get_all() >> 16) & 0xFF;
-                    } else if ((addr >= 0xB000) && (addr <= 0xB7FF)) {
-                        bank_registers[3] = (gpio_get_all() >> 16) & 0xFF;
-                    }
-
-                    while (!(gpio_get(PIN_WR)))
-                    {
-                        tight_loop_contents();
-                    }
-                }
-            }
-        }
-    }
+    uint32_t const cached_length = cache_enable ? rom_cache_fill(offset, mapper_boot_mask(&mapper_konamiscc)) : 0;
+    mapper_run(&mapper_konamiscc, rom + offset, rom_sram, active_rom_size, cached_length);
 }
 
 // loadrom_konami - Load a Konami (without SCC) ROM into the MSX directly from the pico flash
@@ -374,83 +241,8 @@ void __no_inline_not_in_flash_func(loadrom_konamiscc)(uint32_t offset, bool cach
 // AB is on 0x0000, 0x0001
 void __no_inline_not_in_flash_func(loadrom_konami)(uint32_t offset, bool cache_enable)
 {
-    uint8_t bank_registers[4] = {0, 1, 2, 3}; // Initial banks 0-3 mapped
-    uint32_t cached_length = 0;
-
-    if (cache_enable)
-    {
-        gpio_init(PIN_WAIT);
-        gpio_set_dir(PIN_WAIT, GPIO_OUT);
-        gpio_put(PIN_WAIT, 0);
-
-        uint32_t bytes_to_cache = active_rom_size;
-        if (bytes_to_cache == 0 || bytes_to_cache > sizeof(rom_sram))
-        {
-            bytes_to_cache = sizeof(rom_sram);
-        }
-
-        memset(rom_sram, 0, bytes_to_cache);
-        memcpy(rom_sram, rom + offset, bytes_to_cache);
-        gpio_put(PIN_WAIT, 1);
-        cached_length = bytes_to_cache;
-    }
-
-    gpio_set_dir_in_masked(0xFF << 16);
-    while (true) 
-    {
-        // Check control signals
-        bool sltsl = !(gpio_get(PIN_SLTSL)); // Slot selected (active low)
-        bool rd = !(gpio_get(PIN_RD));       // Read cycle (active low)
-        bool wr = !(gpio_get(PIN_WR));       // Write cycle (active low)
-
-        if (sltsl)
-        {
-            uint16_t addr = gpio_get_all() & 0x00FFFF; // Read the address bus
-            if (addr >= 0x4000 && addr <= 0xBFFF) 
-            {
-                if (rd) 
-                {
-                    gpio_set_dir_out_masked(0xFF << 16);
-                    uint32_t const rom_offset = offset + (bank_registers[(addr - 0x4000) >> 13] * 0x2000u) + (addr & 0x1FFFu); // Calculate the ROM offset
-
-                    uint8_t data;
-                    uint32_t const relative_offset = (rom_offset >= offset) ? (rom_offset - offset) : cached_length;
-                    if (cache_enable && relative_offset < cached_length)
-                    {
-                        data = rom_sram[relative_offset];
-                    }
-                    else
-                    {
-                        gpio_put(PIN_WAIT, 0);
-                        data = rom[rom_offset];
-                        gpio_put(PIN_WAIT, 1);
-                    }
-
-                    gpio_put_masked(0xFF0000, (uint32_t)data << 16);
-                    while (!(gpio_get(PIN_RD))) 
-                    {
-                        tight_loop_contents();
-                    }
-                    gpio_set_dir_in_masked(0xFF << 16);
-
-                }else if (wr) {
-                    // Handle writes to bank switching addresses
-                    if ((addr >= 0x6000) && (addr <= 0x67FF)) {
-                        bank_registers[1] = (gpio_get_all() >> 16) & 0xFF;
-                    } else if ((addr >= 0x8000) && (addr <= 0x87FF)) {
-                        bank_registers[2] = (gpio_get_all() >> 16) & 0xFF;
-                    } else if ((addr >= 0xA000) && (addr <= 0xA7FF)) {
-                        bank_registers[3] = (gpio_get_all() >> 16) & 0xFF;
-                    }
-
-                    while (!(gpio_get(PIN_WR))) 
-                    {
-                        tight_loop_contents();
-                    }
-                }
-            }
-        }
-    }
+    uint32_t const cached_length = cache_enable ? rom_cache_fill(offset, mapper_boot_mask(&mapper_konami)) : 0;
+    mapper_run(&mapper_konami, rom + offset, rom_sram, active_rom_size, cached_length);
 }
 
 // loadrom_ascii8 - Load an ASCII8 ROM into the MSX directly from the pico flash
@@ -462,81 +254,8 @@ void __no_inline_not_in_flash_func(loadrom_konami)(uint32_t offset, bool cache_e
 // AB is on 0x0000, 0x0001
 void __no_inline_not_in_flash_func(loadrom_ascii8)(uint32_t offset, bool cache_enable)
 {
-    uint8_t bank_registers[4] = {0, 1, 2, 3}; // Initial banks 0-3 mapped
-    const uint8_t *rom_base = rom + offset;
-    uint32_t cached_length = 0;
-
-    if (cache_enable)
-    {
-        gpio_init(PIN_WAIT);
-        gpio_set_dir(PIN_WAIT, GPIO_OUT);
-        gpio_put(PIN_WAIT, 0);
-
-        uint32_t bytes_to_cache = active_rom_size;
-        if (bytes_to_cache == 0 || bytes_to_cache > sizeof(rom_sram))
-        {
-            bytes_to_cache = sizeof(rom_sram);
-        }
-
-        memset(rom_sram, 0, bytes_to_cache);
-        memcpy(rom_sram, rom_base, bytes_to_cache);
-        gpio_put(PIN_WAIT, 1);
-        cached_length = bytes_to_cache;
-    }
-
-    gpio_set_dir_in_masked(0xFF << 16);
-    while (true) 
-    {
-        bool sltsl = !(gpio_get(PIN_SLTSL)); // Slot selected (active low)
-        bool rd = !(gpio_get(PIN_RD));       // Read cycle (active low)
-        bool wr = !(gpio_get(PIN_WR));       // Write cycle (active low)
-
-        if (sltsl) {
-            uint16_t addr = gpio_get_all() & 0x00FFFF; // Read the address bus
-            if (addr >= 0x4000 && addr <= 0xBFFF) 
-            {
-                if (rd) 
-                {
-                    gpio_set_dir_out_masked(0xFF << 16); // Set data bus to output mode
-                    uint8_t const bank = bank_registers[(addr - 0x4000) >> 13];
-                    uint32_t const rom_offset = offset + (bank * 0x2000u) + (addr & 0x1FFFu); // Calculate the ROM offset
-
-                    uint8_t data;
-                    uint32_t const relative_offset = (rom_offset >= offset) ? (rom_offset - offset) : cached_length;
-                    if (cache_enable && relative_offset < cached_length)
-                    {
-                        data = rom_sram[relative_offset];
-                    }
-                    else
-                    {
-                        gpio_put(PIN_WAIT, 0);
-                        data = rom[rom_offset];
-                        gpio_put(PIN_WAIT, 1);
-                    }
-
-                    gpio_put_masked(0xFF0000, (uint32_t)data << 16); // Write the data to the data bus
-                    while (!(gpio_get(PIN_RD)))  { tight_loop_contents(); } // Wait until the read cycle completes (RD goes high)        }
-                    gpio_set_dir_in_masked(0xFF << 16); // Return data bus to input mode after the read cycle
-                } else if (wr)  // Handle writes to bank switching addresses
-                { 
-                    if ((addr >= 0x6000) && (addr <= 0x67FF)) { 
-                        bank_registers[0] = (gpio_get_all() >> 16) & 0xFF; // Read the data bus and store in bank register
-                    } else if ((addr >= 0x6800) && (addr <= 0x6FFF)) {
-                        bank_registers[1] = (gpio_get_all() >> 16) & 0xFF;
-                    } else if ((addr >= 0x7000) && (addr <= 0x77FF)) {
-                        bank_registers[2] = (gpio_get_all() >> 16) & 0xFF;
-                    } else if ((addr >= 0x7800) && (addr <= 0x7FFF)) {
-                        bank_registers[3] = (gpio_get_all() >> 16) & 0xFF;
-                    }
-
-                    while (!(gpio_get(PIN_WR))) 
-                    {
-                        tight_loop_contents();
-                    }
-                }
-            }
-        }
-    }
+    uint32_t const cached_length = cache_enable ? rom_cache_fill(offset, mapper_boot_mask(&mapper_ascii8)) : 0;
+    mapper_run(&mapper_ascii8, rom + offset, rom_sram, active_rom_size, cached_length);
 }
 
 // loadrom_ascii16 - Load an ASCII16 ROM into the MSX directly from the pico flash
@@ -547,79 +266,8 @@ void __no_inline_not_in_flash_func(loadrom_ascii8)(uint32_t offset, bool cache_e
 // Bank 1: 6000h - 67FFh (6000h used), Bank 2: 7000h - 77FFh (7000h and 77FFh used)
 void __no_inline_not_in_flash_func(loadrom_ascii16)(uint32_t offset, bool cache_enable)
 {
-    uint8_t bank_registers[2] = {0, 1}; // Initial banks 0 and 1 mapped
-    uint32_t cached_length = 0;
-
-    if (cache_enable)
-    {
-        gpio_init(PIN_WAIT);
-        gpio_set_dir(PIN_WAIT, GPIO_OUT);
-        gpio_put(PIN_WAIT, 0);
-
-        uint32_t bytes_to_cache = active_rom_size;
-        if (bytes_to_cache == 0 || bytes_to_cache > sizeof(rom_sram))
-        {
-            bytes_to_cache = sizeof(rom_sram);
-        }
-
-        memset(rom_sram, 0, bytes_to_cache);
-        memcpy(rom_sram, rom + offset, bytes_to_cache);
-        gpio_put(PIN_WAIT, 1);
-        cached_length = bytes_to_cache;
-    }
-
-    gpio_set_dir_in_masked(0xFF << 16);
-    while (true) {
-        // Check control signals
-        bool sltsl = !(gpio_get(PIN_SLTSL)); // Slot selected (active low)
-        bool rd = !(gpio_get(PIN_RD));       // Read cycle (active low)
-        bool wr = !(gpio_get(PIN_WR));       // Write cycle (active low)
-
-        if (sltsl) {
-            uint16_t addr = gpio_get_all() & 0x00FFFF; // Read the address bus
-            if (addr >= 0x4000 && addr <= 0xBFFF)  
-            {
-                if (rd) {
-                    gpio_set_dir_out_masked(0xFF << 16); // Set data bus to output mode
-                    uint8_t const bank = (addr >> 15) & 1;
-                    uint32_t const rom_offset = offset + ((uint32_t)bank_registers[bank] << 14) + (addr & 0x3FFF);
-
-                    uint8_t data;
-                    uint32_t const relative_offset = (rom_offset >= offset) ? (rom_offset - offset) : cached_length;
-                    if (cache_enable && relative_offset < cached_length)
-                    {
-                        data = rom_sram[relative_offset];
-                    }
-                    else
-                    {
-                        gpio_put(PIN_WAIT, 0);
-                        data = rom[rom_offset];
-                        gpio_put(PIN_WAIT, 1);
-                    }
-
-                    gpio_put_masked(0xFF0000, (uint32_t)data << 16); // Write the data to the data bus
-                    while (!(gpio_get(PIN_RD)))  // Wait for the read cycle to complete
-                    {
-                        tight_loop_contents();
-                    }
-                    gpio_set_dir_in_masked(0xFF << 16); // Return data bus to input mode after the read cycle
-                }
-                else if (wr) 
-                {
-                    // Update bank registers based on the specific switching addresses
-                    if ((addr >= 0x6000) && (addr <= 0x67FF)) {
-                        bank_registers[0] = (gpio_get_all() >> 16) & 0xFF;
-                    } else if (addr >= 0x7000 && addr <= 0x77FF) {
-                        bank_registers[1] = (gpio_get_all() >> 16) & 0xFF;
-                    }
-                    while (!(gpio_get(PIN_WR))) {
-                        tight_loop_contents();
-                    }
-                }
-                
-            }
-        }
-    }
+    uint32_t const cached_length = cache_enable ? rom_cache_fill(offset, mapper_boot_mask(&mapper_ascii16)) : 0;
+    mapper_run(&mapper_ascii16, rom + offset, rom_sram, active_rom_size, cached_length);
 }
 
 // loadrom_neo8 - Load an NEO8 ROM into the MSX directly from the pico flash
@@ -636,123 +284,8 @@ void __no_inline_not_in_flash_func(loadrom_ascii16)(uint32_t offset, bool cache_
 // 7800h (mirror at 3800h, B800h and F800h)
 void __no_inline_not_in_flash_func(loadrom_neo8)(uint32_t offset)
 {
-    uint16_t bank_registers[6] = {0}; // 16-bit bank registers initialized to zero (12-bit segment, 4 MSB reserved)
-
-    gpio_set_dir_in_masked(0xFF << 16);    // Configure GPIO pins for input mode
-    while (true)
-    {
-        bool sltsl = !(gpio_get(PIN_SLTSL)); // Slot selected (active low)
-        bool rd = !(gpio_get(PIN_RD));       // Read cycle (active low)
-        bool wr = !(gpio_get(PIN_WR));       // Write cycle (active low)
-
-        if (sltsl)
-        {
-            uint16_t addr = gpio_get_all() & 0x00FFFF; // Read address bus
-
-            if (addr <= 0xBFFF)
-            {
-                if (rd)
-                {
-                    // Handle read access
-                    gpio_set_dir_out_masked(0xFF << 16); // Data bus output mode
-                    uint8_t bank_index = addr >> 13;     // Determine bank index (0-5)
-
-                    if (bank_index < 6)
-                    {
-                        uint32_t segment = bank_registers[bank_index] & 0x0FFF; // 12-bit segment number
-                        uint32_t rom_offset = offset + (segment << 13) + (addr & 0x1FFF); // Calculate ROM offset
-
-                        gpio_put(PIN_WAIT, 0);
-                        uint8_t data = rom[rom_offset];
-                        gpio_put(PIN_WAIT, 1);
-                        
-                        gpio_put_masked(0xFF0000, data << 16); // Place data on data bus
-                    }
-                    else
-                    {
-                        gpio_put_masked(0xFF0000, 0xFF << 16); // Invalid page handling (Page 3)
-                    }
-
-                    while (!(gpio_get(PIN_RD))) // Wait for read cycle to complete
-                    {
-                        tight_loop_contents();
-                    }
-
-                    gpio_set_dir_in_masked(0xFF << 16); // Return data bus to input mode
-                }
-                else if (wr)
-                {
-                    // Handle write access
-                    uint16_t base_addr = addr & 0xF800; // Mask to identify base address
-                    uint8_t bank_index = 6;             // Initialize to invalid bank
-
-                    // Determine bank index based on base address
-                    switch (base_addr)
-                    {
-                        case 0x5000:
-                        case 0x1000:
-                        case 0x9000:
-                        case 0xD000:
-                            bank_index = 0;
-                            break;
-                        case 0x5800:
-                        case 0x1800:
-                        case 0x9800:
-                        case 0xD800:
-                            bank_index = 1;
-                            break;
-                        case 0x6000:
-                        case 0x2000:
-                        case 0xA000:
-                        case 0xE000:
-                            bank_index = 2;
-                            break;
-                        case 0x6800:
-                        case 0x2800:
-                        case 0xA800:
-                        case 0xE800:
-                            bank_index = 3;
-                            break;
-                        case 0x7000:
-                        case 0x3000:
-                        case 0xB000:
-                        case 0xF000:
-                            bank_index = 4;
-                            break;
-                        case 0x7800:
-                        case 0x3800:
-                        case 0xB800:
-                        case 0xF800:
-                            bank_index = 5;
-                            break;
-                    }
-
-                    if (bank_index < 6)
-                    {
-                        uint8_t data = (gpio_get_all() >> 16) & 0xFF;
-                        if (addr & 0x01)
-                        {
-                            // Write to MSB
-                            bank_registers[bank_index] = (bank_registers[bank_index] & 0x00FF) | (data << 8);
-                        }
-                        else
-                        {
-                            // Write to LSB
-                            bank_registers[bank_index] = (bank_registers[bank_index] & 0xFF00) | data;
-                        }
-
-                        // Ensure reserved MSB bits are zero
-                        bank_registers[bank_index] &= 0x0FFF;
-                    }
-
-                    while (!(gpio_get(PIN_WR))) // Wait for write cycle to complete
-                    {
-                        tight_loop_contents();
-                    }
-                }
-            }
-        }
-    }
+    mapper_run(&mapper_neo8, rom + offset, rom_sram, active_rom_size,
+               rom_cache_fill(offset, mapper_boot_mask(&mapper_neo8)));
 }
 
 // loadrom_neo16 - Load an NEO16 ROM into the MSX directly from the pico flash
@@ -766,171 +299,260 @@ void __no_inline_not_in_flash_func(loadrom_neo8)(uint32_t offset)
 // 7000h (mirror at 3000h, B000h and F000h)
 void __no_inline_not_in_flash_func(loadrom_neo16)(uint32_t offset)
 {
-    // 16-bit bank registers initialized to zero (12-bit segment, 4 MSB reserved)
-    uint16_t bank_registers[3] = {0};
+    mapper_run(&mapper_neo16, rom + offset, rom_sram, active_rom_size,
+               rom_cache_fill(offset, mapper_boot_mask(&mapper_neo16)));
+}
 
-    // Configure GPIO pins for input mode
-    gpio_set_dir_in_masked(0xFF << 16);
-    while (true)
+// loadrom_sram - Load a ROM with battery backed SRAM that does not fit in the SRAM cache
+// The segments are served by the CPU engine (demand-paged cache or flash), which also reads the flash, so the SRAM is
+// kept for the session only: it cannot be saved to flash while the ROM runs. ROMs that fit in the cache go to
+// loadrom_dma(), which saves it.
+// Parameters:
+//   offset - ROM offset in the flash image
+//   mapper - Mapper code from the ROM record (12-14)
+void __no_inline_not_in_flash_func(loadrom_sram)(uint32_t offset, uint8_t mapper)
+{
+    uint32_t const cached_length = rom_cache_fill(offset, mapper_boot_mask(mapper_from_code(mapper)));
+    switch (mapper)
     {
-        bool sltsl = !(gpio_get(PIN_SLTSL)); // Slot selected (active low)
-        bool rd = !(gpio_get(PIN_RD));       // Read cycle (active low)
-        bool wr = !(gpio_get(PIN_WR));       // Write cycle (active low)
-
-        if (sltsl)
-        {
-            uint16_t addr = gpio_get_all() & 0x00FFFF; // Read address bus
-            if (addr <= 0xBFFF)
-            {
-                if (rd)
-                {
-                    // Handle read access
-                    gpio_set_dir_out_masked(0xFF << 16); // Data bus output mode
-                    uint8_t bank_index = addr >> 14;     // Determine bank index (0-2)
-
-                    if (bank_index < 3)
-                    {
-                        uint32_t segment = bank_registers[bank_index] & 0x0FFF; // 12-bit segment number
-                        uint32_t rom_offset = offset + (segment << 14) + (addr & 0x3FFF); // Calculate ROM offset
+        case 12:
+            mapper_run(&mapper_ascii8_sram, rom + offset, rom_sram, active_rom_size, cached_length);
+            break;
+        case 13:
+            mapper_run(&mapper_ascii16_sram, rom + offset, rom_sram, active_rom_size, cached_length);
+            break;
+        default:
+            mapper_run(&mapper_gm2, rom + offset, rom_sram, active_rom_size, cached_length);
+            break;
+    }
+}
 
-                        gpio_put(PIN_WAIT, 0);
-                        uint8_t data = rom[rom_offset];
-                        gpio_put(PIN_WAIT, 1);
+// loadrom_dma - Serve a cached ROM through the PIO/DMA read engine (msx_bus.c)
+// The ROM is copied to SRAM by core 1 (romload.c) and every 8KB page of the mapper is pointed at the right SRAM block,
+// the other pages of the slot are left unmapped and not driven.
+// Reads are then answered by PIO + DMA alone, and this loop only decodes the bank register writes of the mapper
+// (mapper.h descriptor) and updates the page table. The MSX is only held with WAIT until the boot segments are copied,
+// or when it switches to a segment core 1 has not reached yet. Used for every ROM mapper whose ROM fits in the SRAM
+// cache.
+// Mappers with battery backed SRAM map the SRAM shadow (sramsave.h) when a register selects it, the writes to it are
+// copied to the shadow, and core 1 goes on saving it to flash after the copy.
+// With PICOVERSE_PERF the loop polls instead of blocking on the write FIFO: it takes the read count from the engine
+// and answers PERF_PORT. The reads are not timed, the session is flagged PERF_FLAG_NO_LATENCY.
+// Parameters:
+//   offset - ROM offset in the flash image
+//   mapper - Mapper code from the ROM record
+void __no_inline_not_in_flash_func(loadrom_dma)(uint32_t offset, uint8_t mapper)
+{
+    mapper_desc_t const desc = *mapper_from_code(mapper); // RAM copy, core 1 may be writing the flash (sramsave.c)
+    const mapper_desc_t *m = &desc;
+    uint16_t regs[8] = {0}; // Bank register values, only used by 16-bit registers
+    uint8_t sram_pages = 0; // Pages mapped on an SRAM bank
+    uint8_t sram_bank[8] = {0}; // SRAM bank mapped on each of those pages
+    uint32_t const sram_enable = m->sram_enable ? m->sram_enable : sramsave_enable;
+    uint32_t size = active_rom_size;
+    if (size == 0 || size > sizeof(rom_sram))
+    {
+        size = sizeof(rom_sram);
+    }
 
-                        gpio_put_masked(0xFF0000, data << 16); // Place data on data bus
-                    }
-                    else
-                    {
-                        gpio_put_masked(0xFF0000, 0xFF << 16); // Invalid page handling
-                    }
+    // Segment numbers wrap around the ROM size rounded up to a power of two, like the address lines on a real cartridge.
+    // Segments past the end of the ROM read as 0xFF, the ones past the SRAM cache are mapped on the open bus page.
+    uint32_t segments = 1;
+    while ((segments << 13) < size) {
+        segments <<= 1;
+    }
+    uint32_t const segment_mask = segments - 1;
+    uint32_t const loaded_segments = (segments < sizeof(rom_sram) >> 13) ? segments : sizeof(rom_sram) >> 13;
 
-                    while (!(gpio_get(PIN_RD))) // Wait for read cycle to complete
-                    {
-                        tight_loop_contents();
-                    }
+    if (m->sram_size) {
+        romload_next = sramsave_task; // Core 1 saves the SRAM once the whole ROM is in SRAM
+    }
 
-                    gpio_set_dir_in_masked(0xFF << 16); // Return data bus to input mode
-                }
-                else if (wr)
-                {
-                    // Handle write access
-                    uint16_t base_addr = addr & 0xF800; // Mask to identify base address
-                    uint8_t bank_index = 3;             // Initialize to invalid bank
+    gpio_init(PIN_WAIT);
+    gpio_set_dir(PIN_WAIT, GPIO_OUT);
+    gpio_put(PIN_WAIT, 0);
+    romload_start(rom + offset, rom_sram, size, loaded_segments, mapper_boot_mask(m));
+    romload_wait(mapper_boot_mask(m));
 
-                    // Determine bank index based on base address
-                    switch (base_addr)
-                    {
-                        case 0x5000:
-                        case 0x1000:
-                        case 0x9000:
-                        case 0xD000:
-                            bank_index = 0;
-                            break;
-                        case 0x6000:
-                        case 0x2000:
-                        case 0xA000:
-                        case 0xE000:
-                            bank_index = 1;
-                            break;
-                        case 0x7000:
-                        case 0x3000:
-                        case 0xB000:
-                        case 0xF000:
-                            bank_index = 2;
-                            break;
-                    }
+    msx_bus_init();
+    for (uint8_t page = m->first_page; page <= m->last_page; page++) {
+        uint32_t const block = (mapper_initial_offset(m, page) >> 13) & segment_mask;
+        msx_bus_map_page(page, (block < loaded_segments) ? rom_sram + (block << 13) : msx_bus_open_page);
+    }
+    msx_bus_start();
+    gpio_put(PIN_WAIT, 1);
+    PERF_FLAGS(PERF_FLAG_NO_LATENCY); // The reads are answered by the engine, only their count is known
+#if PICOVERSE_PERF
+    uint32_t read_count = 0; // Last msx_bus_read_count()
+#endif
 
-                    if (bank_index < 3)
-                    {
-                        uint8_t data = (gpio_get_all() >> 16) & 0xFF; // Read 8-bit data from bus
-                        if (addr & 0x01)
-                        {
-                            // Write to MSB
-                            bank_registers[bank_index] = (bank_registers[bank_index] & 0x00FF) | (data << 8);
-                        }
-                        else
-                        {
-                            // Write to LSB
-                            bank_registers[bank_index] = (bank_registers[bank_index] & 0xFF00) | data;
-                        }
-
-                        // Ensure reserved MSB bits are zero
-                        bank_registers[bank_index] &= 0x0FFF;
-                    }
+    while (true)
+    {
+#if PICOVERSE_PERF
+        // Until the next slot write: count the reads from the DMA transfer counter of the engine, and answer the
+        // performance counters port, an I/O cycle the engine does not see
+        while (pio_sm_is_rx_fifo_empty(msx_bus_pio, msx_bus_sm_write))
+        {
+            uint32_t const count = msx_bus_read_count();
+            perf.reads += (count >= read_count) ? count - read_count : count + MSX_BUS_READ_BATCH - read_count;
+            read_count = count;
+            uint32_t const io = gpio_get_all();
+            if (PERF_CYCLE(io))
+            {
+                msx_bus_serve_io(perf_io, io);
+            }
+        }
+#endif
+        uint32_t const bus = msx_bus_get_write();
+        uint16_t const addr = bus & 0xFFFF;
+        uint8_t const reg = m->decode[(addr & m->mirror_mask) >> 11];
 
-                    while (!(gpio_get(PIN_WR))) // Wait for write cycle to complete
-                    {
-                        tight_loop_contents();
-                    }
+        if ((uint16_t)(addr - (m->first_page << MAPPER_PAGE_SHIFT)) < ((m->last_page - m->first_page + 1) << MAPPER_PAGE_SHIFT))
+        {
+            PERF_COUNT(writes);
+        }
+        if (reg)
+        {
+            PERF_COUNT(bank_switches);
+            // First 8KB block of the new segment, 16KB banks map the following block on the next page
+            uint32_t const value = mapper_write_reg(m, regs, reg - 1, addr, (bus >> 16) & 0xFF);
+            uint32_t const block = value << (m->bank_shift - 13);
+            uint8_t const page = mapper_bank_page(m, reg - 1);
+            uint32_t const blocks = (m->bank_shift > 13) ? 2 : 1;
+
+            if (m->sram_size && (value & sram_enable)) {
+                for (uint32_t i = 0; i < blocks; i++) {
+                    sram_bank[page + i] = (m->sram_bank_bit && (value & m->sram_bank_bit)) ? 1 : 0;
+                    sram_pages |= 1u << (page + i);
+                    msx_bus_map_page(page + i, sramsave_block(sram_bank[page + i]));
+                }
+                continue;
+            }
+            sram_pages &= ~(((1u << blocks) - 1) << page);
+            for (uint32_t i = 0; i < blocks; i++) {
+                uint32_t const segment = (block + i) & segment_mask;
+                if (segment >= loaded_segments) {
+                    msx_bus_map_page(page + i, msx_bus_open_page);
+                    continue;
+                }
+                if (!romload_is_ready(segment)) {
+                    // Core 1 has not copied this segment yet, hold the MSX until it has
+                    PERF_COUNT(cache_misses);
+                    gpio_put(PIN_WAIT, 0);
+                    romload_wait(1u << segment);
+                    gpio_put(PIN_WAIT, 1);
+                } else {
+                    PERF_COUNT(cache_hits);
                 }
+                msx_bus_map_page(page + i, rom_sram + (segment << 13));
             }
         }
+        else if (m->sram_size && ((m->sram_windows >> (addr >> 11)) & 1u) && (sram_pages & (1u << (addr >> 13)))) {
+            sramsave_write(m->sram_size, sram_bank[addr >> 13], addr, (bus >> 16) & 0xFF);
+        }
     }
 }
 
 // loadrom_nextor - Load a Nextor ROM into the MSX directly from the pico flash
+// The slot is expanded (nextor_ram.h): the kernel is served from flash in sub-slot 0, and the whole ROM cache SRAM,
+// unused in Nextor mode, is a 192KB memory mapper in sub-slot 1.
 void __no_inline_not_in_flash_func(loadrom_nextor)(uint32_t offset)
 {
     //runs the IO code in the second core
     multicore_launch_core1(nextor_io);    // Launch core 1
 
-    //Test copying to RAM to check performance gains
     gpio_init(PIN_WAIT); // Init wait signal pin
     gpio_set_dir(PIN_WAIT, GPIO_OUT); // Set the WAIT signal as output
-    // Load the entire ROM into SRAM cache - testing performance
-    //gpio_put(PIN_WAIT, 0); // Wait until we are ready to read the ROM
-    //memset(rom_sram, 0, 131072); // Clear the SRAM buffer
-    //memcpy(rom_sram, rom + offset, 131072); //for 32KB ROMs we start at 0x4000
+    gpio_put(PIN_WAIT, 0); // Wait until the mapper memory is cleared
+    memset(rom_sram, 0, sizeof(rom_sram));
     gpio_put(PIN_WAIT, 1); // Lets go!
 
-    uint8_t bank_registers[2] = {0, 1}; // Initial banks 0 and 1 mapped
+    nextor_ram_run(rom + offset, active_rom_size, true, rom_sram, sizeof(rom_sram)); // The kernel is an ASCII16 ROM
+}
 
-    gpio_set_dir_in_masked(0xFF << 16);
-    while (true) {
-        // Check control signals
-        bool sltsl = !(gpio_get(PIN_SLTSL)); // Slot selected (active low)
-        bool rd = !(gpio_get(PIN_RD));       // Read cycle (active low)
-        bool wr = !(gpio_get(PIN_WR));       // Write cycle (active low)
+// loadrom_sccplus - Load a ROM into the RAM of a Konami Sound Cartridge (sccplus.h) and serve it
+// The 128KB of RAM are the start of the ROM cache SRAM, loaded with the ROM image while the MSX is held with WAIT.
+// Parameters:
+//   offset - ROM offset in the flash image
+void __no_inline_not_in_flash_func(loadrom_sccplus)(uint32_t offset)
+{
+    uint32_t const size = (active_rom_size < SCCPLUS_RAM_SIZE) ? active_rom_size : SCCPLUS_RAM_SIZE;
+
+    gpio_init(PIN_WAIT);
+    gpio_set_dir(PIN_WAIT, GPIO_OUT);
+    gpio_put(PIN_WAIT, 0);
+    if (romload_read) {
+        romload_read(rom_sram, 0, size);
+    } else {
+        memcpy(rom_sram, rom + offset, size);
+    }
+    memset(rom_sram + size, 0xFF, SCCPLUS_RAM_SIZE - size);
+    gpio_put(PIN_WAIT, 1);
 
-        if (sltsl) {
-            uint16_t addr = gpio_get_all() & 0x00FFFF; // Read the address bus
-            if (addr >= 0x4000 && addr <= 0xBFFF) 
-            {
-                if (rd) {
-                    gpio_set_dir_out_masked(0xFF << 16); // Set data bus to output mode
-                    // Loading directly from flash
-                    // Calculate the ROM offset
-                    uint32_t rom_offset = offset + (bank_registers[(addr >> 15) & 1] << 14) + (addr & 0x3FFF);
-                    gpio_put(PIN_WAIT, 0);
-                    uint8_t data = rom[rom_offset];
-                    gpio_put(PIN_WAIT, 1);
-                    gpio_put_masked(0xFF0000, data << 16); // Write the data to the data bus (read from flash)
-                    
-                    // Loading from SRAM cache
-                    //uint32_t rom_offset = (bank_registers[(addr >> 15) & 1] << 14) + (addr & 0x3FFF);
-                    //gpio_put_masked(0xFF0000, rom_sram[rom_offset] << 16); // Write the data to the data bus
+    sccplus_run(rom_sram);
+}
 
-                    while (!(gpio_get(PIN_RD)))  // Wait for the read cycle to complete
-                    {
-                        tight_loop_contents();
-                    }
-                    gpio_set_dir_in_masked(0xFF << 16); // Return data bus to input mode after the read cycle
-                }
-                else if (wr) 
-                {
-                    // Update bank registers based on the specific switching addresses
-                    if ((addr >= 0x6000) && (addr <= 0x67FF)) {
-                        bank_registers[0] = (gpio_get_all() >> 16) & 0xFF;
-                    } else if (addr >= 0x7000 && addr <= 0x77FF) {
-                        bank_registers[1] = (gpio_get_all() >> 16) & 0xFF;
-                    }
-                    while (!(gpio_get(PIN_WR))) {
-                        tight_loop_contents();
-                    }
-                }
-            }
+// loadrom_auto - Load a ROM whose mapper the multirom tool could not detect (automap.c)
+// The ROM starts as a plain 32KB cartridge, which is the power-on layout of the Konami, Konami SCC, ASCII8 and ASCII16
+// mappers, while its writes are scored against their bank registers. Once a mapper is picked the MSX is held with
+// WAIT, the result is stored in flash for the next boot and the ROM goes on with the engine of that mapper, the
+// register writes seen so far replayed.
+// Parameters:
+//   offset - ROM offset in the flash image
+void __no_inline_not_in_flash_func(loadrom_auto)(uint32_t offset)
+{
+    uint32_t const cached_length = rom_cache_fill(offset, mapper_boot_mask(&mapper_plain32));
+    const uint8_t *source = rom + offset;
+
+    gpio_init(PIN_WAIT);
+    gpio_set_dir(PIN_WAIT, GPIO_OUT);
+    if (romload_read) {
+        gpio_put(PIN_WAIT, 0);
+        romload_wait(romload_all); // There is no flash copy to serve the segments not loaded yet from
+    }
+    gpio_put(PIN_WAIT, 1);
+    automap_reset();
+    mapper_serve(&mapper_plain32, source, rom_sram, active_rom_size, cached_length, NULL, 0, automap_observe);
+
+    uint8_t const mapper = automap_result();
+    perf.mapper = mapper;
+    romload_wait(romload_all); // Core 1 must be done with the flash before it is programmed
+    automap_store(rom + offset, offset, active_rom_size, mapper);
+
+    switch (mapper) {
+        case 3:
+            mapper_serve(&mapper_konamiscc, source, rom_sram, active_rom_size, cached_length,
+                         automap_log, automap_log_count, NULL);
+            break;
+        case 5:
+            mapper_serve(&mapper_ascii8, source, rom_sram, active_rom_size, cached_length,
+                         automap_log, automap_log_count, NULL);
+            break;
+        case 6:
+            mapper_serve(&mapper_ascii16, source, rom_sram, active_rom_size, cached_length,
+                         automap_log, automap_log_count, NULL);
+            break;
+        default:
+            mapper_serve(&mapper_konami, source, rom_sram, active_rom_size, cached_length,
+                         automap_log, automap_log_count, NULL);
+            break;
+    }
+}
+
+// rom_image_end - XIP address of the first flash sector past the last ROM of the image
+static uintptr_t rom_image_end(void)
+{
+    uintptr_t end = (uintptr_t)rom;
+    for (uint32_t i = 0; i < romconfig_flash_count(); i++) {
+        const romconfig_record_t *const record = romconfig_record(i);
+        uintptr_t const record_end = (uintptr_t)rom + ((record->flags & ROMCONFIG_FLAG_SEGMENTS) ?
+                                                       romlz_end(rom, record->offset, record->size) :
+                                                       record->offset + record->size);
+        if (record_end > end) {
+            end = record_end;
         }
     }
+    return (end + FLASH_SECTOR_SIZE - 1) & ~(uintptr_t)(FLASH_SECTOR_SIZE - 1);
 }
 
 // Main function running on core 0
@@ -939,47 +561,95 @@ int main(void)
     set_sys_clock_khz(250000, true);     // Set system clock to 250MHz
     stdio_init_all();   // Initialize stdio
     setup_gpio();       // Initialize GPIO
+    perf_init();        // Start the performance counters, keeping the ones of the previous session
+    perf_dump(&perf_last, "Previous session");
+    msx_trace_dump();        // Print the bus trace of the previous session, if any
+    msx_trace_start();       // Start logging the bus cycles
 
     // Multicore setup
     // multicore_launch_core1(wireless_main); // Launch core 1
     // Load the ROM data from flash memory
     int rom_index = loadrom_msx_menu(0x0000); //load the first 32KB ROM into the MSX (The MSX PICOVERSE MENU)
 
-    ROMRecord const *selected = &records[rom_index];
-    active_rom_size = selected->Size;
+    romconfig_record_t const selected = *romconfig_record(rom_index); // Copied, the flash may be programmed later
+    active_rom_size = selected.size;
+    uint8_t mapper = selected.mapper;
+
+    // ROMs stored as segments (shared, compressed) are read a segment at a time (romlz.h) by core 1 or by the
+    // segment cache
+    if (selected.flags & ROMCONFIG_FLAG_SEGMENTS) {
+        if (!romlz_open(rom, selected.offset, active_rom_size)) {
+            mapper = 0;
+        }
+        romload_read = romlz_read;
+    }
+
+    // ROMs of unknown mapper start on the mapper detected on a previous run, if any
+    if (mapper == AUTOMAP_CODE) {
+        automap_init(rom_image_end());
+        uint8_t const detected = automap_lookup(rom + selected.offset, selected.offset, active_rom_size);
+        if (detected != 0) {
+            mapper = detected;
+        }
+    }
+    perf.mapper = mapper;
+
+    // Battery backed SRAM, saved in the sectors past the mapper detection store
+    const mapper_desc_t *const desc = mapper_from_code(mapper);
+    if (desc != NULL && desc->sram_size) {
+        sramsave_init(rom_image_end() + FLASH_SECTOR_SIZE);
+        sramsave_open(rom + selected.offset, selected.offset, active_rom_size, desc->sram_size, desc->sram_banks,
+                      desc->sram_enable);
+    }
+
+    // ROMs that fit in the SRAM cache are served by the PIO/DMA engine, the CPU only tracks bank switches
+    if (desc != NULL && active_rom_size <= CACHE_SIZE) {
+        loadrom_dma(selected.offset, mapper);
+    }
 
     // Load the selected ROM into the MSX according to the mapper
-    switch (selected->Mapper) {
+    switch (mapper) {
         case 1:
         case 2:
-            loadrom_plain32(selected->Offset, true);
+            loadrom_plain32(selected.offset, true);
             break;
         case 3:
-            loadrom_konamiscc(selected->Offset, true);
+            loadrom_konamiscc(selected.offset, true);
             break;
         case 4:
-            loadrom_linear48(selected->Offset, true);
+            loadrom_linear48(selected.offset, true);
             break;
         case 5:
-            loadrom_ascii8(selected->Offset, true); 
+            loadrom_ascii8(selected.offset, true); 
             break;
         case 6:
-            loadrom_ascii16(selected->Offset, true); 
+            loadrom_ascii16(selected.offset, true); 
             break;
         case 7:
-            loadrom_konami(selected->Offset, true); 
+            loadrom_konami(selected.offset, true); 
             break;
         case 8:
-            loadrom_neo8(selected->Offset); 
+            loadrom_neo8(selected.offset); 
             break;
         case 9:
-            loadrom_neo16(selected->Offset); 
+            loadrom_neo16(selected.offset); 
             break;
         case 10:
-            loadrom_nextor(selected->Offset); 
+            loadrom_nextor(selected.offset); 
            break;
+        case 12:
+        case 13:
+        case 14:
+            loadrom_sram(selected.offset, mapper);
+            break;
+        case 15:
+            loadrom_sccplus(selected.offset);
+            break;
+        case AUTOMAP_CODE:
+            loadrom_auto(selected.offset);
+            break;
         default:
-            printf("Debug: Unsupported ROM mapper: %d\n", selected->Mapper);
+            printf("Debug: Unsupported ROM mapper: %d\n", mapper);
             break;
     }
     
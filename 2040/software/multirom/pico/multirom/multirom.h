@@ -28,13 +28,7 @@
 #define PIN_A13    13
 #define PIN_A14    14
 #define PIN_A15    15
-
-// Memory mapper configuration
-#define NEXTOR_MAPPER_SEGMENTS 8
-#define NEXTOR_PRIMARY_SLOT    1
-
-extern volatile uint8_t nextor_secondary_slot_reg;
-extern volatile uint8_t nextor_mapper_segments[4];
+#define ADDR_PINS   0    // Address bus (A0-A15)
 
 // Data lines (D0-D7)
 #define PIN_D0     16
@@ -45,6 +39,7 @@ extern volatile uint8_t nextor_mapper_segments[4];
 #define PIN_D5     21
 #define PIN_D6     22
 #define PIN_D7     23
+#define DATA_PINS   16   // Data bus (D0-D7)
 
 // Control signals
 #define PIN_RD     24   // Read strobe from MSX
@@ -58,8 +53,6 @@ extern volatile uint8_t nextor_mapper_segments[4];
 //29 - UART0 RX
 
 static inline void setup_gpio();
-unsigned long read_ulong(const unsigned char *ptr);
-int isEndOfData(const unsigned char *memory);
 int __no_inline_not_in_flash_func(loadrom_msx_menu)(uint32_t offset);
 void __no_inline_not_in_flash_func(loadrom_plain32)(uint32_t offset, bool cache_enable);
 void __no_inline_not_in_flash_func(loadrom_linear48)(uint32_t offset, bool cache_enable);
@@ -68,4 +61,6 @@ void __no_inline_not_in_flash_func(loadrom_konami)(uint32_t offset, bool cache_e
 void __no_inline_not_in_flash_func(loadrom_ascii8)(uint32_t offset, bool cache_enable);
 void __no_inline_not_in_flash_func(loadrom_ascii16)(uint32_t offset, bool cache_enable);
 void __no_inline_not_in_flash_func(loadrom_neo8)(uint32_t offset);
-void __no_inline_not_in_flash_func(loadrom_neo16)(uint32_t offset);
\ No newline at end of file
+void __no_inline_not_in_flash_func(loadrom_neo16)(uint32_t offset);
+void __no_inline_not_in_flash_func(loadrom_dma)(uint32_t offset, uint8_t mapper);
+void __no_inline_not_in_flash_func(loadrom_auto)(uint32_t offset);
\ No newline at end of file
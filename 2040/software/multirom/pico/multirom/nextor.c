@@ -23,6 +23,7 @@
 
 #include "multirom.h"
 #include "nextor.h"
+#include "perf.h"
 
 static scsi_inquiry_resp_t inquiry_resp; 
 
@@ -712,6 +713,11 @@ void __not_in_flash_func(nextor_io)()
             {
                 if (port == PORT_CONTROL) // Port 0x9E (Control Read): Return last status byte.
                 {
+                    PERF_COUNT(io_polls);
+                    if (control_response == 0x01)
+                    {
+                        PERF_COUNT(io_busy);
+                    }
                     gpio_set_dir_out_masked(0xFF << 16); // Set data bus to output mode
                     gpio_put_masked(0xFF0000, control_response << 16); // Place data on data bus
                     while (!gpio_get(PIN_RD)) tight_loop_contents();
@@ -0,0 +1,42 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// nextor_ram.h - Nextor cartridge with a memory mapper in an expanded slot
+//
+// In Nextor mode the cartridge slot is expanded: the secondary slot register on FFFFh (read back complemented) selects
+// a sub-slot for each 16KB page of the cartridge slot.
+//   sub-slot 0  the Nextor kernel, an ASCII16 ROM on 4000h-BFFFh (registers on 6000h-67FFh and 7000h-77FFh)
+//   sub-slot 1  a memory mapper on the four pages, 16KB segments selected by the I/O ports FCh-FFh (page 0-3)
+// The mapper is as big as the free memory of the board allows: the whole ROM cache SRAM on the RP2040 (the kernel is
+// served from flash there), and the PSRAM on the RP2350 (up to the 4MB the 8-bit segment registers can address), or
+// the SRAM left over by the kernel copy on boards without PSRAM. Segment numbers past the end wrap around, so the
+// DOS2/Nextor mapper size detection counts exactly the segments there are, powers of two or not.
+// The mapper ports are write-only: reads are left to the internal mapper of the MSX, driving them would clash with it.
+//
+// This file is shared as-is by the RP2040 and RP2350 firmwares.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef NEXTOR_RAM_H
+#define NEXTOR_RAM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define NEXTOR_ROM_SUBSLOT          0
+#define NEXTOR_RAM_SUBSLOT          1
+#define NEXTOR_SUBSLOT_REG          0xFFFF      // Secondary slot register
+#define NEXTOR_MAPPER_PORT          0xFC        // Segment register of page 0, FDh-FFh for pages 1-3
+#define NEXTOR_MAPPER_SHIFT         14          // 16KB segments
+#define NEXTOR_MAPPER_SEGMENT_SIZE  (1u << NEXTOR_MAPPER_SHIFT)
+#define NEXTOR_MAPPER_MAX_SEGMENTS  256         // 8-bit segment registers, 4MB
+
+extern volatile uint8_t nextor_secondary_slot_reg;      // Last value written to FFFFh
+extern volatile uint8_t nextor_mapper_segments[4];      // Last value written to FCh-FFh
+extern uint32_t nextor_mapper_size;                     // Number of segments of the mapper
+
+void nextor_ram_run(const uint8_t *rom, uint32_t rom_size, bool rom_in_flash, uint8_t *ram, uint32_t ram_size);
+
+#endif
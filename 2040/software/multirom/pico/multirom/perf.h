@@ -0,0 +1,103 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// perf.h - Bus engine performance counters
+//
+// When the firmware is built with PICOVERSE_PERF the engines count reads, writes, bank switches and cache hits/misses,
+// and time every read from the RD sample to the data on the bus with the SysTick counter (system clock cycles). The
+// counters are readable by the MSX on I/O port PERF_PORT:
+//   OUT (PERF_PORT), PERF_CMD_CURRENT  latch the counters of the running session and rewind
+//   OUT (PERF_PORT), PERF_CMD_LAST     latch the counters of the session before the last Pico reset and rewind
+//   IN  A, (PERF_PORT)                 next byte of the latched perf_counters_t (0xFF past the end)
+// The counters live in uninitialized RAM, so the ones of a game session survive a soft reset of the Pico and are shown
+// by the menu (and printed on stdio at boot when USB stdio is enabled). Without PICOVERSE_PERF every hook compiles to
+// nothing and the port is not answered.
+//
+// This file is shared as-is by the RP2040 and RP2350 firmwares.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef PERF_H
+#define PERF_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pico/stdlib.h"
+#include "hardware/structs/systick.h"
+
+#define PERF_PORT           0x9D        // I/O port, next to the Nextor bridge ports (0x9E/0x9F)
+#define PERF_CMD_CURRENT    0x00
+#define PERF_CMD_LAST       0x01
+#define PERF_MAGIC          0x46524550u // "PERF"
+#define PERF_HIST_BUCKETS   8           // <8, 8-15, 16-31, 32-63, 64-127, 128-255, 256-511, 512+ cycles
+#define PERF_FLAG_NO_LATENCY 0x01       // The engine does not time its reads (PIO/DMA engine), latency fields are unused
+
+// Counter block, also the layout read by the MSX menu (little endian, no padding)
+typedef struct {
+    uint32_t magic;                     // PERF_MAGIC when the block is valid
+    uint8_t mapper;                     // Mapper code being served (0 = menu)
+    uint8_t flags;                      // PERF_FLAG_* of the engine serving the session
+    uint8_t reserved[2];
+    uint32_t reads;                     // Slot read cycles answered by the CPU engines
+    uint32_t writes;                    // Slot write cycles inside the cartridge pages
+    uint32_t bank_switches;             // Writes to a bank register
+    uint32_t cache_hits;                // Segments mapped from SRAM
+    uint32_t cache_misses;              // Segments mapped from flash or copied in by the segment cache
+    uint32_t io_polls;                  // Nextor status port reads
+    uint32_t io_busy;                   // Nextor status port reads answered with a busy status
+    uint32_t latency_max;               // Longest RD sample to data time, in system clock cycles
+    uint32_t latency_hist[PERF_HIST_BUCKETS];
+} perf_counters_t;
+
+extern perf_counters_t perf;
+extern perf_counters_t perf_last;
+
+void perf_init(void);
+void perf_io(uint32_t bus);
+void perf_dump(const perf_counters_t *counters, const char *title);
+
+#if PICOVERSE_PERF
+
+// perf_read_done - Account a read cycle that started when the SysTick counter was at start
+static inline void perf_read_done(uint32_t start)
+{
+    uint32_t const cycles = (start - systick_hw->cvr) & 0x00FFFFFFu; // 24-bit down counter
+    uint32_t bucket = 0;
+    for (uint32_t v = cycles >> 3; v && bucket < PERF_HIST_BUCKETS - 1; v >>= 1)
+    {
+        bucket++;
+    }
+    perf.reads++;
+    perf.latency_hist[bucket]++;
+    if (cycles > perf.latency_max)
+    {
+        perf.latency_max = cycles;
+    }
+}
+
+#define PERF_COUNT(field)               (perf.field++)
+#define PERF_FLAGS(set)                 (perf.flags |= (set))
+#define PERF_READ_START()               (systick_hw->cvr)
+#define PERF_READ_DONE(start)           perf_read_done(start)
+#define PERF_CYCLE(bus)                 (!((bus) & (1u << PIN_IORQ)) && ((bus) & 0xFFu) == PERF_PORT)
+#define PERF_IO(bus)                                                                                \
+    do {                                                                                            \
+        if (PERF_CYCLE(bus))                                                                        \
+        {                                                                                           \
+            perf_io(bus);                                                                           \
+        }                                                                                           \
+    } while (0)
+
+#else
+
+#define PERF_COUNT(field)               ((void)0)
+#define PERF_FLAGS(set)                 ((void)0)
+#define PERF_READ_START()               (0u)
+#define PERF_READ_DONE(start)           ((void)(start))
+#define PERF_IO(bus)                    ((void)(bus))
+
+#endif
+
+#endif
@@ -0,0 +1,66 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// romconfig.h - ROM library written by the multirom tool after the menu (configuration area, format v2)
+//
+// The configuration area starts at ROMCONFIG_OFFSET of the image, in the second half of the menu ROM, and may run past
+// its end: the ROMs are placed after it. It is a header, a table of fixed size records, and a pool with the names of
+// the ROMs, not NUL terminated, where a name found in the pool already is not stored again:
+//   header    romconfig_header_t, ROMCONFIG_MAGIC and ROMCONFIG_VERSION
+//   records   romconfig_record_t[count], at header.records
+//   names     header.names_size bytes, at header.names
+// The offsets of the header are from the start of the image, the name offsets of the records from the pool. Every
+// record is found and read in place in the flash, whatever the size of the library.
+// The menu selects a ROM with the 16-bit index of its record: the high byte is written to ROMCONFIG_SELECT_HIGH, then
+// the low byte to ROMCONFIG_SELECT, which starts the ROM when the MSX resets.
+// The ROMs of the SD card (RP2350, sdrom.h) are records of a table in RAM appended to the ones of the flash.
+//
+// This file is shared as-is by the RP2040 and RP2350 firmwares.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef ROMCONFIG_H
+#define ROMCONFIG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ROMCONFIG_OFFSET        0x4000      // Header offset in the image (8000h in the menu ROM)
+#define ROMCONFIG_MAGIC         0x32435650u // "PVC2"
+#define ROMCONFIG_VERSION       2
+#define ROMCONFIG_MAX_RECORDS   2048        // Flash and SD card records together
+#define ROMCONFIG_NAME_LENGTH   50          // Longest name shown by the menu
+#define ROMCONFIG_SELECT        0x9D81      // Menu address selecting a ROM, low byte of its index
+#define ROMCONFIG_SELECT_HIGH   0x9D82      // High byte of the index, written first
+#define ROMCONFIG_FLAG_SEGMENTS 0x0001      // The offset is a table of segments, shared or compressed (romlz.h)
+
+// Header of the configuration area (little endian, no padding)
+typedef struct {
+    uint32_t magic;                         // ROMCONFIG_MAGIC
+    uint16_t version;                       // ROMCONFIG_VERSION
+    uint16_t count;                         // Number of records
+    uint32_t records;                       // Offset of the record table in the image
+    uint32_t names;                         // Offset of the name pool in the image
+    uint32_t names_size;                    // Size of the name pool
+} romconfig_header_t;
+
+// ROM record (little endian, no padding)
+typedef struct {
+    uint32_t name;                          // Offset of the name in the pool
+    uint8_t name_length;                    // Length of the name, at most ROMCONFIG_NAME_LENGTH
+    uint8_t mapper;                         // Mapper code
+    uint16_t flags;                         // ROMCONFIG_FLAG_*, the other bits are 0
+    uint32_t size;                          // ROM size, decompressed
+    uint32_t offset;                        // ROM offset in the image (SDROM_OFFSET | file index for the SD card)
+} romconfig_record_t;
+
+bool romconfig_open(const uint8_t *image);
+void romconfig_append(const romconfig_record_t *records, const char *names, uint32_t count);
+uint32_t romconfig_count(void);
+uint32_t romconfig_flash_count(void);
+const romconfig_record_t *romconfig_record(uint32_t index);
+const char *romconfig_name(uint32_t index);
+
+#endif
@@ -0,0 +1,118 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// romload.c - Progressive background copy of a ROM to SRAM on core 1
+//
+// Core 1 copies the boot segments first and then every other segment in order, publishing each one in romload_ready
+// once its bytes are in SRAM. Segments past the end of the ROM are filled with 0xFF (open bus).
+//
+// This file is shared as-is by the RP2040 and RP2350 firmwares.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "hardware/sync.h"
+#include "romload.h"
+
+volatile uint32_t romload_ready = 0;
+uint32_t romload_all = 0;
+void (*romload_next)(void) = NULL;
+bool (*romload_read)(uint8_t *buffer, uint32_t offset, uint32_t length) = NULL;
+
+static const uint8_t *load_flash;
+static uint8_t *load_sram;
+static uint32_t load_size;
+static uint32_t load_boot_mask;
+
+// romload_segment - Copy one segment to SRAM and publish it
+static void __no_inline_not_in_flash_func(romload_segment)(uint32_t segment)
+{
+    uint32_t const start = segment << ROMLOAD_SEGMENT_SHIFT;
+    uint32_t length = 0;
+
+    if (start < load_size)
+    {
+        length = load_size - start;
+        if (length > ROMLOAD_SEGMENT_SIZE)
+        {
+            length = ROMLOAD_SEGMENT_SIZE;
+        }
+        if (romload_read == NULL)
+        {
+            memcpy(&load_sram[start], &load_flash[start], length);
+        }
+        else if (!romload_read(&load_sram[start], start, length))
+        {
+            length = 0; // Read error, the segment reads as open bus
+        }
+    }
+    memset(&load_sram[start + length], 0xFF, ROMLOAD_SEGMENT_SIZE - length);
+
+    __dmb(); // The bytes must be visible to core 0 before the ready bit
+    romload_ready |= 1u << segment;
+}
+
+// romload_core1 - Core 1 entry: boot segments first, then the rest of the ROM, then romload_next if set
+static void __no_inline_not_in_flash_func(romload_core1)(void)
+{
+    for (uint32_t segment = 0; segment < ROMLOAD_MAX_SEGMENTS; segment++)
+    {
+        if (load_boot_mask & (1u << segment))
+        {
+            romload_segment(segment);
+        }
+    }
+    for (uint32_t segment = 0; segment < ROMLOAD_MAX_SEGMENTS; segment++)
+    {
+        if ((romload_all & ~load_boot_mask) & (1u << segment))
+        {
+            romload_segment(segment);
+        }
+    }
+
+    if (romload_next)
+    {
+        romload_next();                     // Core 1 has another job for the rest of the session (SCC, SRAM saves)
+    }
+}
+
+// romload_start - Start copying a ROM to SRAM in the background on core 1
+// Parameters:
+//   flash - ROM data in the XIP flash (not used when romload_read is set)
+//   sram - 8KB aligned destination, at least segments * 8KB
+//   size - ROM size in bytes
+//   segments - Number of 8KB segments to provide (at most ROMLOAD_MAX_SEGMENTS), the ones past size are 0xFF
+//   boot_mask - Segments to copy first
+void __no_inline_not_in_flash_func(romload_start)(const uint8_t *flash, uint8_t *sram, uint32_t size, uint32_t segments, uint32_t boot_mask)
+{
+    if (segments > ROMLOAD_MAX_SEGMENTS)
+    {
+        segments = ROMLOAD_MAX_SEGMENTS;
+    }
+
+    load_flash = flash;
+    load_sram = sram;
+    load_size = size;
+    romload_all = (segments == 32) ? 0xFFFFFFFFu : ((1u << segments) - 1);
+    load_boot_mask = boot_mask & romload_all;
+    romload_ready = 0;
+
+    multicore_reset_core1();
+    multicore_launch_core1(romload_core1);
+}
+
+// romload_wait - Wait until the given segments are in SRAM
+// Parameters:
+//   mask - Segment bits to wait for
+void __no_inline_not_in_flash_func(romload_wait)(uint32_t mask)
+{
+    mask &= romload_all;
+    while ((romload_ready & mask) != mask)
+    {
+        tight_loop_contents();
+    }
+}
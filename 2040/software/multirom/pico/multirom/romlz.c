@@ -0,0 +1,217 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// romlz.c - ROMs stored as a table of 8KB segments, compressed and shared between ROMs, read segment by segment
+//
+// The LZ4 block decoder copies the literal runs and the matches that do not overlap with memcpy, which is word wide,
+// and only goes byte by byte for the overlapping matches (runs of a byte or of a short pattern). Every length is
+// checked against the segment and the block, so a damaged stream gives a read error instead of writing past the
+// buffer.
+//
+// This file is shared as-is by the RP2040 and RP2350 firmwares.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "romlz.h"
+
+static const uint8_t *lz_image;                     // Image holding the ROM being read
+static const uint8_t *lz_table;                     // Its segment table
+static uint32_t lz_size = 0;                        // ROM size
+static uint32_t lz_segments = 0;
+
+// romlz_word - Word of a segment table, read a byte at a time (the tables are not word aligned in the flash)
+static inline uint32_t romlz_word(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// romlz_open - Check the segment table of a ROM and make it the one romlz_read() reads
+// Parameters:
+//   image - Start of the image, the offsets of the blocks are from there
+//   offset - Offset of the segment table in the image, from the ROM record
+//   size - ROM size, from its record
+// Returns:
+//   true if every segment has a block of a possible length
+bool romlz_open(const uint8_t *image, uint32_t offset, uint32_t size)
+{
+    uint32_t const segments = (size + ROMLZ_SEGMENT_SIZE - 1) >> ROMLZ_SEGMENT_SHIFT;
+    const uint8_t *const table = image + offset;
+
+    lz_size = 0;
+    lz_segments = 0;
+    for (uint32_t n = 0; n < segments; n++)
+    {
+        uint32_t const length = romlz_word(table + n * ROMLZ_ENTRY_SIZE + 4);
+        if (length == 0 || length > ROMLZ_SEGMENT_SIZE)
+        {
+            printf("Debug: Bad segment table\n");
+            return false;
+        }
+    }
+    lz_image = image;
+    lz_table = table;
+    lz_size = size;
+    lz_segments = segments;
+    return true;
+}
+
+// romlz_end - Offset past the last byte of a ROM in the image, its table or one of its blocks
+// Parameters:
+//   image - Start of the image
+//   offset - Offset of the segment table in the image
+//   size - ROM size
+uint32_t romlz_end(const uint8_t *image, uint32_t offset, uint32_t size)
+{
+    uint32_t const segments = (size + ROMLZ_SEGMENT_SIZE - 1) >> ROMLZ_SEGMENT_SHIFT;
+    uint32_t end = offset + segments * ROMLZ_ENTRY_SIZE;
+    for (uint32_t n = 0; n < segments; n++)
+    {
+        const uint8_t *const entry = image + offset + n * ROMLZ_ENTRY_SIZE;
+        uint32_t const block_end = romlz_word(entry) + romlz_word(entry + 4);
+        end = (block_end > end) ? block_end : end;
+    }
+    return end;
+}
+
+// romlz_block - Decompress an LZ4 block
+// Parameters:
+//   buffer - Destination
+//   length - Number of bytes the block decompresses to
+//   block - LZ4 block
+//   block_length - Size of the block
+// Returns:
+//   true if the block decompressed to exactly length bytes
+bool __no_inline_not_in_flash_func(romlz_block)(uint8_t *buffer, uint32_t length, const uint8_t *block,
+                                                uint32_t block_length)
+{
+    uint8_t *out = buffer;
+    uint8_t *const out_end = buffer + length;
+    const uint8_t *in = block;
+    const uint8_t *const in_end = block + block_length;
+
+    while (in < in_end)
+    {
+        uint32_t const token = *in++;
+
+        // Literal run, 15 in the token means more length bytes follow
+        uint32_t run = token >> 4;
+        if (run == 15)
+        {
+            uint8_t more;
+            do {
+                if (in == in_end)
+                {
+                    return false;
+                }
+                more = *in++;
+                run += more;
+            } while (more == 255);
+        }
+        if (run > (uint32_t)(in_end - in) || run > (uint32_t)(out_end - out))
+        {
+            return false;
+        }
+        memcpy(out, in, run);
+        out += run;
+        in += run;
+        if (in == in_end)
+        {
+            break;                                  // The last sequence has no match
+        }
+
+        // Match, a distance back in the output and a length
+        if (in_end - in < 2)
+        {
+            return false;
+        }
+        uint32_t const distance = in[0] | (in[1] << 8);
+        in += 2;
+        run = (token & 15) + ROMLZ_MIN_MATCH;
+        if ((token & 15) == 15)
+        {
+            uint8_t more;
+            do {
+                if (in == in_end)
+                {
+                    return false;
+                }
+                more = *in++;
+                run += more;
+            } while (more == 255);
+        }
+        if (distance == 0 || distance > (uint32_t)(out - buffer) || run > (uint32_t)(out_end - out))
+        {
+            return false;
+        }
+        const uint8_t *match = out - distance;
+        if (distance >= run)
+        {
+            memcpy(out, match, run);
+            out += run;
+        }
+        else
+        {
+            while (run--)
+            {
+                *out++ = *match++;              // Overlapping, the bytes being written are read again
+            }
+        }
+    }
+    return out == out_end;
+}
+
+// romlz_read - Read segments of the ROM opened with romlz_open(), the romload_read of the ROMs stored as segments
+// Segments past the end of the ROM read as 0xFF (open bus).
+// Parameters:
+//   buffer - Destination
+//   offset - Offset in the ROM, on a segment boundary
+//   length - Number of bytes, whole segments except for the last segment of the ROM
+// Returns:
+//   true if every segment was read
+bool __no_inline_not_in_flash_func(romlz_read)(uint8_t *buffer, uint32_t offset, uint32_t length)
+{
+    if (offset & (ROMLZ_SEGMENT_SIZE - 1))
+    {
+        return false;
+    }
+    while (length)
+    {
+        uint32_t const segment = offset >> ROMLZ_SEGMENT_SHIFT;
+        uint32_t chunk = (length < ROMLZ_SEGMENT_SIZE) ? length : ROMLZ_SEGMENT_SIZE;
+
+        if (segment >= lz_segments)
+        {
+            memset(buffer, 0xFF, chunk);
+        }
+        else
+        {
+            uint32_t const segment_size = (lz_size - offset < ROMLZ_SEGMENT_SIZE) ? lz_size - offset :
+                                          ROMLZ_SEGMENT_SIZE;
+            const uint8_t *const entry = lz_table + segment * ROMLZ_ENTRY_SIZE;
+            const uint8_t *const block = lz_image + romlz_word(entry);
+            uint32_t const block_length = romlz_word(entry + 4);
+            if (chunk < segment_size)
+            {
+                return false;                       // Segments are only decompressed whole
+            }
+            if (block_length == segment_size)
+            {
+                memcpy(buffer, block, segment_size);
+            }
+            else if (!romlz_block(buffer, segment_size, block, block_length))
+            {
+                return false;
+            }
+            memset(buffer + segment_size, 0xFF, chunk - segment_size);
+        }
+        buffer += chunk;
+        offset += chunk;
+        length -= chunk;
+    }
+    return true;
+}
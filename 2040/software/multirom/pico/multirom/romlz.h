@@ -0,0 +1,39 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// romlz.h - ROMs stored as a table of 8KB segments, compressed and shared between ROMs, read segment by segment
+//
+// The multirom tool stores a segment found in the image already only once (the revisions and translations of a game
+// share most of theirs), and with -z compresses the others. The record of such a ROM has ROMCONFIG_FLAG_SEGMENTS set,
+// keeps the size of the ROM and points at the table of its segments:
+//   entries   { uint32_t offset; uint32_t length; }[segments], the block of each segment in the image
+//   blocks    LZ4 blocks (literal runs and matches, no frame), a block as long as its segment is stored as it is
+// The blocks follow the table, or belong to another ROM. Segments are resolved when they are loaded, romload
+// (romload.h), the segment cache (romcache.h) and the PSRAM mirror get them in any order through romload_read, so a
+// bank switch costs nothing more. A compressed segment needs fewer flash bytes than the plain copy, and the decoder is
+// faster than the flash, so the ROM is loaded sooner than with a memcpy from the XIP flash (make bench in the
+// simulator).
+//
+// This file is shared as-is by the RP2040 and RP2350 firmwares.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef ROMLZ_H
+#define ROMLZ_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ROMLZ_SEGMENT_SHIFT     13                          // 8KB segments, like romload and romcache
+#define ROMLZ_SEGMENT_SIZE      (1u << ROMLZ_SEGMENT_SHIFT)
+#define ROMLZ_ENTRY_SIZE        8                           // Offset and length of a block
+#define ROMLZ_MIN_MATCH         4                           // Shortest LZ4 match
+
+bool romlz_open(const uint8_t *image, uint32_t offset, uint32_t size);
+uint32_t romlz_end(const uint8_t *image, uint32_t offset, uint32_t size);
+bool romlz_block(uint8_t *buffer, uint32_t length, const uint8_t *block, uint32_t block_length);
+bool romlz_read(uint8_t *buffer, uint32_t offset, uint32_t length);
+
+#endif
@@ -0,0 +1,41 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// sccplus.h - Konami Sound Cartridge (SCC-I, SCC+) with 128KB of RAM
+//
+// Four 8KB banks on 4000h-BFFFh select segments of the RAM with the Konami SCC registers (5000h, 7000h, 9000h,
+// B000h). The mode register on BFFEh-BFFFh turns banks into RAM and picks the SCC mode:
+//   bit 0  bank 0 is RAM           bit 4  banks 0-3 are RAM (bits 0-2 ignored)
+//   bit 1  bank 1 is RAM           bit 5  enhanced SCC mode (SCC+)
+//   bit 2  bank 2 is RAM, only together with bit 5
+// A bank in RAM mode takes every write, its bank register included. The compatible SCC is on 9800h-9FFFh while
+// bank 2 selects a segment xx111111b, the enhanced one on B800h-BFFFh while bit 7 of the bank 3 register is set
+// (scc.h), and its registers read over the RAM.
+// The RAM starts with the ROM image of the record (the rest is 0xFF), so the cartridge also runs SCC-I ROMs. The
+// SCC is only synthesized by the RP2350 firmware (PICOVERSE_SCC), the RP2040 one has the RAM and the banks.
+//
+// This file is shared as-is by the RP2040 and RP2350 firmwares.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef SCCPLUS_H
+#define SCCPLUS_H
+
+#include <stdint.h>
+
+#define SCCPLUS_RAM_SIZE        (128u * 1024u)  // 16 segments of 8KB
+#define SCCPLUS_SEGMENT_MASK    0x0F
+#define SCCPLUS_MODE_REG        0xBFFE          // Mode register, mirrored on BFFFh
+#define SCCPLUS_MODE_RAM        0x10            // Banks 0-3 in RAM mode
+#define SCCPLUS_MODE_PLUS       0x20            // Enhanced SCC mode
+#define SCCPLUS_WINDOW_SHIFT    11              // The bank table has one entry per 2KB window
+#define SCCPLUS_WINDOW_SIZE     (1u << SCCPLUS_WINDOW_SHIFT)
+#define SCCPLUS_WINDOWS         32              // Of the address space, 4000h-BFFFh are used
+
+extern volatile uint8_t sccplus_mode;           // Last value written to the mode register
+
+void sccplus_run(uint8_t *ram);
+
+#endif
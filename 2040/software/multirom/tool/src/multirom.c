@@ -7,7 +7,20 @@
 // This program creates a UF2 file to program the Raspberry Pi Pico with the MSX PICOVERSE 2040 MultiROM firmware. The UF2 file is
 // created with the combined PICO firmware binary file, the MSX MENU ROM file, the configuration file and the ROM files. The 
 // configuration file contains the information of each ROM file processed by the tool and it is incorporated into the MENU ROM file 
-// so the MSX can read it.
+// after its code: a header, a table of fixed size records and a pool of the ROM names (format v2, romconfig.h in the firmware),
+// which the firmware reads in place. The 8KB segments a ROM shares with the ROMs before it (revisions, translations,
+// patched copies) are stored once, the record then points at a table of its segments (romlz.h in the firmware); with -z
+// the other segments are LZ4 compressed when that makes them smaller.
+// The ROMs are read, identified and compressed by a pool of threads, then laid out in the order of their file names so
+// that the image does not depend on the directory order or on the threads. The mappers detected are kept in a cache
+// file next to the ROMs, a ROM of the same name, size, time and hash is not analysed again by the next build.
+// The dumps of the ROM database compiled into the tool (romdb.h) are identified by their SHA-1 instead: they get the
+// mapper and the title listed for them, the mapper detection is only for the unknown ones. A mapper tag wins over both.
+// With -e the mega ROMs the opcode scan finds or cannot tell apart are also booted on a Z80 interpreter (romrun.h),
+// their mapper is the one that explains the bank switches they make; --bench compares both detections with the mapper
+// tags of a directory of ROMs.
+// The UF2 blocks are written in one pass straight from the firmware, the menu, the configuration area and the ROMs,
+// the image is never assembled in memory.
 // 
 // This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
 // License". https://creativecommons.org/licenses/by-nc-sa/4.0/
@@ -20,34 +33,63 @@
 #include <string.h>
 #include <stdbool.h>
 #include <ctype.h>
+#include <inttypes.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
 #include "uf2format.h"
 #include "multirom.h"
 #include "menu.h"
 #include "nextor.h"
+#include "romdb.h"
+#include "romrun.h"
 
 #ifndef APP_VERSION
 #define APP_VERSION "v1.00"
 #endif
 
 #define UF2FILENAME             "multirom.uf2"  // UF2 produced by this tool
+#define CACHE_FILENAME          "multirom.cache" // Mappers detected by the last build
+#define CACHE_HEADER            "MSX PICOVERSE %s MultiROM cache %s %s %s" // Board, tool version, ROM database, detection
 #define MENU_COPY_SIZE          (16 * 1024)     // Portion of menu ROM copied verbatim before config payload
 #define MAX_FILE_NAME_LENGTH    50              // Maximum length of a ROM name
 #define TARGET_FILE_SIZE        32768           // Size of the combined MSX MENU ROM and the configuration file
 #define FLASH_START             0x10000000      // Start of the flash memory on the Raspberry Pi Pico
-#define MAX_ROM_FILES           128             // Maximum number of ROM files
+#define MAX_ROM_FILES           2048            // Maximum number of ROM records (ROMCONFIG_MAX_RECORDS of the firmware)
 #define MAX_TOTAL_ROM_SIZE      (14U * 1024U * 1024U) // Cap combined ROM payload to 14 MB
 #define MAX_ROM_SIZE            10*1024*1024    // Maximum size of a ROM file
 #define MIN_ROM_SIZE            8192            // Minimum size of a ROM file
 #define MAX_ANALYSIS_SIZE       131072          // 128KB for the mapper analysis
-#define CONFIG_RECORD_SIZE      (MAX_FILE_NAME_LENGTH + 1 + sizeof(uint32_t) + sizeof(uint32_t))
+#define CONFIG_OFFSET           MENU_COPY_SIZE  // Configuration area, in the second half of the menu ROM
+#define CONFIG_MAGIC            0x32435650u     // "PVC2", configuration format v2 (romconfig.h in the firmware)
+#define CONFIG_VERSION          2
+#define CONFIG_HEADER_SIZE      20              // Magic, version, count, record table, name pool and its size
+#define CONFIG_RECORD_SIZE      16              // Name offset and length, mapper, flags, size, offset
+#define CONFIG_FLAG_SEGMENTS    0x0001          // The offset is a segment table (ROMCONFIG_FLAG_SEGMENTS of the firmware)
+#define ROM_ALIGNMENT           4096            // The first ROM starts on a flash sector
 #define MAX_UF2_FILENAME_LENGTH 512
+#define SEGMENT_SIZE            8192            // Shared and compressed on its own, the firmware reads a segment at a time
+#define SEGMENT_ENTRY_SIZE      8               // Segment table entry: offset and length of the block
+#define SEGMENT_INDEX_SLOTS     (1u << 16)      // Segments stored in the image, found by their hash
+#define MAX_THREADS             64
+#define BOARD_NAME              "2040"
+#define LZ_MIN_MATCH            4               // LZ4 block format: shortest match,
+#define LZ_LAST_LITERALS        5               // the last bytes of a block are literals,
+#define LZ_MATCH_LIMIT          12              // and the last match starts that far from its end at the latest
+#define LZ_HASH_BITS            14
+#define LZ_SEARCH_DEPTH         256             // Earlier places tried for each match
 
 static const char *MAPPER_DESCRIPTIONS[] = {
     "PL-16", "PL-32", "KonSCC", "Linear", "ASC-08",
-    "ASC-16", "Konami", "NEO-8", "NEO-16", "SYSTEM"
+    "ASC-16", "Konami", "NEO-8", "NEO-16", "SYSTEM", "AUTO",
+    "ASC8SR", "ASC16S", "GM2",  // Battery backed SRAM, only set by a tag
+    "SCC+"                      // Sound Cartridge (SCC-I) with 128KB of RAM, only set by a tag
 };
 
 #define MAPPER_DESCRIPTION_COUNT (sizeof(MAPPER_DESCRIPTIONS) / sizeof(MAPPER_DESCRIPTIONS[0]))
+#define MAPPER_SYSTEM           10              // Nextor, only added by the tool itself
+#define MAPPER_AUTO             11              // Unknown mapper, detected by the firmware when the ROM runs
 
 static bool equals_ignore_case(const char *a, const char *b) {
     while (*a && *b) {
@@ -73,18 +115,55 @@ static uint8_t mapper_number_from_description(const char *description) {
 #error "TARGET_FILE_SIZE must be larger than MENU_COPY_SIZE"
 #endif
 
-#define CONFIG_AREA_SIZE        (TARGET_FILE_SIZE - MENU_COPY_SIZE) // Size of the configuration area in the MENU ROM
-
-// Tracks the ROMs discovered on disk so they can be appended later in scan order.
+// Tracks the ROMs discovered on disk so they can be appended later in file name order.
 typedef struct {
     char file_name[256];    // File name
+    char rom_name[MAX_FILE_NAME_LENGTH]; // Name without the extension and the mapper tag
     uint32_t file_size;     // File size
+    long long mtime;        // Modification time, with the size and the hash the key of the cache
+    uint64_t hash;          // Hash of the ROM
+    uint8_t mapper;         // Mapper code, 0 when unsupported
+    bool mapper_forced;     // The mapper was set by a tag of the file name
+    bool cached;            // The mapper came from the cache
+    int known;              // Index of the dump in the ROM database, -1 when unknown
+    bool loaded;            // The ROM could be read, it is read again from the file to be written
+    uint64_t *segment_hashes; // Hash of each segment
+    uint32_t *block_sizes;  // Size of the LZ4 block of each segment, 0 when it is not smaller (or without -z)
+    uint8_t *packed;        // Segment table, NULL when stored as it is
+    uint32_t base;          // Offset from the first ROM
+    uint32_t stored_size;   // Bytes in the flash
 } FileInfo;
 
+// Mapper detected for a ROM by an earlier build.
+typedef struct {
+    char file_name[256];
+    uint32_t size;
+    long long mtime;
+    uint64_t hash;
+    uint8_t mapper;
+    int known;
+} CacheEntry;
+
+// Hash chains of the compressor, one set per thread.
+typedef struct {
+    int32_t head[1 << LZ_HASH_BITS];
+    int32_t chain[SEGMENT_SIZE];
+} LzState;
+
+// ROM record of the configuration area, its offset is from the first ROM until the area is laid out.
+typedef struct {
+    char name[MAX_FILE_NAME_LENGTH];    // ROM name, NUL terminated
+    uint8_t mapper;         // Mapper code
+    bool forced;            // The mapper was set by a tag of the file name
+    bool known;             // The mapper and the name come from the ROM database
+    uint16_t flags;         // CONFIG_FLAG_*
+    uint32_t size;          // ROM size
+    uint32_t stored_size;   // Bytes in the flash, less than size when shared or compressed
+    uint32_t offset;        // ROM offset
+} ConfigRecord;
+
 // Forward declarations
-void create_uf2_file(const uint8_t *data, size_t size, const char *uf2_filename);
-uint32_t file_size(const char *filename);
-uint8_t detect_rom_type(const char *filename, uint32_t size);
+uint8_t detect_rom_type(const uint8_t *rom, uint32_t size);
 static void print_usage(const char *prog_name);
 
 // Build modes supported by the tool.
@@ -92,30 +171,590 @@ typedef enum {
     BUILD_MODE_STANDARD = 0,    // Standard MultiROM build scanning for .ROM files
 } BuildMode;
 
-// Return byte length of a file on disk, 0 on failure.
-uint32_t file_size(const char *filename) {
+// Return a textual description of the mapper type given its number.
+const char* mapper_description(int number) {
+    if (number <= 0 || (size_t)number > MAPPER_DESCRIPTION_COUNT) {
+        return "Unknown";
+    }
+    return MAPPER_DESCRIPTIONS[number - 1];
+}
+
+// Store a 16-bit value in little endian order.
+static void put_le16(uint8_t *p, uint16_t value) {
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+}
+
+// Store a 32-bit value in little endian order.
+static void put_le32(uint8_t *p, uint32_t value) {
+    put_le16(p, (uint16_t)value);
+    put_le16(p + 2, (uint16_t)(value >> 16));
+}
+
+// Read a 32-bit value in little endian order.
+static uint32_t get_le32(const uint8_t *p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Append a ROM to the configuration records, false when there is no room left.
+static bool add_record(ConfigRecord *records, int *record_count, const char *name, uint8_t mapper, bool forced,
+                       uint32_t size, uint32_t offset) {
+    if (*record_count >= MAX_ROM_FILES) {
+        return false;
+    }
+    ConfigRecord *record = &records[(*record_count)++];
+    strncpy(record->name, name, sizeof(record->name));
+    record->name[sizeof(record->name) - 1] = '\0';
+    record->mapper = mapper;
+    record->forced = forced;
+    record->known = false;
+    record->flags = 0;
+    record->size = size;
+    record->stored_size = size;
+    record->offset = offset;
+    return true;
+}
+
+// Lay out the configuration area: the header, the table of fixed size records and the pool of names, where a name
+// found in the pool already is not stored again. The ROMs start on the first ROM_ALIGNMENT boundary past the area,
+// and past the menu ROM; the record offsets are moved there. Returns the area, from CONFIG_OFFSET up to the first
+// ROM (*area_size bytes), or NULL when out of memory.
+static uint8_t *build_config(ConfigRecord *records, int record_count, size_t *area_size, uint32_t *rom_start) {
+    char *pool = (char *)malloc((size_t)record_count * MAX_FILE_NAME_LENGTH + 1);
+    uint32_t *name_offsets = (uint32_t *)malloc(sizeof(uint32_t) * ((size_t)record_count + 1));
+    if (!pool || !name_offsets) {
+        free(pool);
+        free(name_offsets);
+        return NULL;
+    }
+
+    size_t pool_size = 0;
+    for (int i = 0; i < record_count; ++i) {
+        size_t length = strlen(records[i].name);
+        size_t at = 0;
+        while (at + length <= pool_size && memcmp(pool + at, records[i].name, length) != 0) {
+            ++at;
+        }
+        if (at + length > pool_size) {
+            at = pool_size;
+            memcpy(pool + pool_size, records[i].name, length);
+            pool_size += length;
+        }
+        name_offsets[i] = (uint32_t)at;
+    }
+
+    const size_t table_offset = CONFIG_HEADER_SIZE;
+    const size_t pool_offset = table_offset + (size_t)record_count * CONFIG_RECORD_SIZE;
+    size_t start = CONFIG_OFFSET + pool_offset + pool_size;
+    if (start < TARGET_FILE_SIZE) {
+        start = TARGET_FILE_SIZE;
+    }
+    start = (start + ROM_ALIGNMENT - 1) & ~(size_t)(ROM_ALIGNMENT - 1);
+
+    *area_size = start - CONFIG_OFFSET;
+    *rom_start = (uint32_t)start;
+    uint8_t *area = (uint8_t *)malloc(*area_size);
+    if (!area) {
+        free(pool);
+        free(name_offsets);
+        return NULL;
+    }
+    memset(area, 0xFF, *area_size);
+
+    put_le32(area, CONFIG_MAGIC);
+    put_le16(area + 4, CONFIG_VERSION);
+    put_le16(area + 6, (uint16_t)record_count);
+    put_le32(area + 8, (uint32_t)(CONFIG_OFFSET + table_offset));
+    put_le32(area + 12, (uint32_t)(CONFIG_OFFSET + pool_offset));
+    put_le32(area + 16, (uint32_t)pool_size);
+    for (int i = 0; i < record_count; ++i) {
+        uint8_t *p = area + table_offset + (size_t)i * CONFIG_RECORD_SIZE;
+        records[i].offset += *rom_start;
+        put_le32(p, name_offsets[i]);
+        p[4] = (uint8_t)strlen(records[i].name);
+        p[5] = records[i].mapper;
+        put_le16(p + 6, records[i].flags);
+        put_le32(p + 8, records[i].size);
+        put_le32(p + 12, records[i].offset);
+    }
+    memcpy(area + pool_offset, pool, pool_size);
+
+    printf("Configuration: %d ROMs, %zu bytes of names, ROMs from offset 0x%08X\n", record_count, pool_size,
+           *rom_start);
+    free(pool);
+    free(name_offsets);
+    return area;
+}
+
+// Read segment n of a ROM from its file into buffer (SEGMENT_SIZE bytes). Returns its length, 0 on failure.
+static size_t read_segment(const FileInfo *file, uint32_t n, uint8_t *buffer) {
+    size_t const start = (size_t)n * SEGMENT_SIZE;
+    size_t const length = (file->file_size - start < SEGMENT_SIZE) ? file->file_size - start : SEGMENT_SIZE;
+    FILE *handle = fopen(file->file_name, "rb");
+    bool const read = handle && fseek(handle, (long)start, SEEK_SET) == 0 && fread(buffer, 1, length, handle) == length;
+    if (handle) {
+        fclose(handle);
+    }
+    return read ? length : 0;
+}
+
+// Read a whole file, NULL on failure.
+static uint8_t *load_file(const char *filename, uint32_t size) {
     FILE *file = fopen(filename, "rb");
+    uint8_t *data = (uint8_t *)malloc(size);
+    if (!file || !data || fread(data, 1, size, file) != size) {
+        free(data);
+        data = NULL;
+    }
+    if (file) {
+        fclose(file);
+    }
+    return data;
+}
+
+// Store an LZ4 length past the 15 of its token.
+static size_t lz_put_length(uint8_t *out, size_t at, size_t length) {
+    while (length >= 255) {
+        out[at++] = 255;
+        length -= 255;
+    }
+    out[at++] = (uint8_t)length;
+    return at;
+}
+
+// Store an LZ4 sequence: a literal run, then a match unless distance is 0 (the last sequence of the block).
+static size_t lz_put_sequence(uint8_t *out, size_t at, const uint8_t *literals, size_t run, size_t distance,
+                              size_t length) {
+    uint8_t *token = &out[at++];
+    size_t const match = distance ? length - LZ_MIN_MATCH : 0;
+    *token = (uint8_t)(((run < 15) ? run : 15) << 4 | ((match < 15) ? match : 15));
+    if (run >= 15) {
+        at = lz_put_length(out, at, run - 15);
+    }
+    memcpy(out + at, literals, run);
+    at += run;
+    if (distance) {
+        put_le16(out + at, (uint16_t)distance);
+        at += 2;
+        if (match >= 15) {
+            at = lz_put_length(out, at, match - 15);
+        }
+    }
+    return at;
+}
+
+// Hash of the 4 bytes a match starts with.
+static uint32_t lz_hash(const uint8_t *p) {
+    uint32_t const v = p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+    return (v * 2654435761u) >> (32 - LZ_HASH_BITS);
+}
+
+// Compress a segment into an LZ4 block, taking the longest match found among the last places with the same hash.
+// out needs room for length + length / 255 + 16 bytes. Returns the size of the block.
+static size_t lz_compress_block(LzState *lz, const uint8_t *data, size_t length, uint8_t *out) {
+    int32_t *const head = lz->head;
+    int32_t *const chain = lz->chain;
+    size_t const limit = (length > LZ_MATCH_LIMIT) ? length - LZ_MATCH_LIMIT : 0;
+    size_t at = 0;
+    size_t anchor = 0;
+    size_t i = 0;
+
+    for (size_t h = 0; h < (1u << LZ_HASH_BITS); ++h) {
+        head[h] = -1;
+    }
+    while (i < limit) {
+        uint32_t const h = lz_hash(data + i);
+        size_t best_length = 0;
+        size_t best_distance = 0;
+        int depth = LZ_SEARCH_DEPTH;
+        for (int32_t candidate = head[h]; candidate >= 0 && depth-- > 0; candidate = chain[candidate]) {
+            size_t n = 0;
+            while (i + n < length - LZ_LAST_LITERALS && data[candidate + n] == data[i + n]) {
+                ++n;
+            }
+            if (n > best_length) {
+                best_length = n;
+                best_distance = i - (size_t)candidate;
+            }
+        }
+        chain[i] = head[h];
+        head[h] = (int32_t)i;
+        if (best_length < LZ_MIN_MATCH) {
+            ++i;
+            continue;
+        }
+
+        at = lz_put_sequence(out, at, data + anchor, i - anchor, best_distance, best_length);
+        for (size_t j = i + 1; j < i + best_length && j < limit; ++j) {
+            uint32_t const hj = lz_hash(data + j);
+            chain[j] = head[hj];
+            head[hj] = (int32_t)j;
+        }
+        i += best_length;
+        anchor = i;
+    }
+    return lz_put_sequence(out, at, data + anchor, length - anchor, 0, 0);
+}
+
+// A segment stored in the image, found by the hash of its bytes so that the ROMs holding it again point at it.
+typedef struct {
+    uint64_t hash;
+    const FileInfo *file;   // The ROM it was found in first, NULL for a free slot
+    uint32_t segment;       // and its number there
+    uint32_t offset;        // Offset of its block, from the first ROM
+    uint32_t length;        // Length of its block, SEGMENT_SIZE when stored as it is
+} SegmentEntry;
+
+static SegmentEntry segment_index[SEGMENT_INDEX_SLOTS];
+static uint32_t segment_index_count = 0;
+
+// Hash of a segment, FNV-1a taken 8 bytes at a time then mixed so that every bit counts in the low ones (the index
+// slot). The segments with the same hash are compared byte for byte.
+static uint64_t data_hash(const uint8_t *data, size_t length) {
+    uint64_t hash = 0xCBF29CE484222325ull;
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        uint64_t word;
+        memcpy(&word, data + i, 8);
+        hash = (hash ^ word) * 0x100000001B3ull;
+    }
+    for (; i < length; ++i) {
+        hash = (hash ^ data[i]) * 0x100000001B3ull;
+    }
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+// Compare two whole segments with the same hash, read again from their files (the ROMs are not kept in memory).
+static bool segments_equal(const FileInfo *a, uint32_t segment_a, const FileInfo *b, uint32_t segment_b) {
+    static uint8_t buffer_a[SEGMENT_SIZE];
+    static uint8_t buffer_b[SEGMENT_SIZE];
+    return read_segment(a, segment_a, buffer_a) == SEGMENT_SIZE && read_segment(b, segment_b, buffer_b) == SEGMENT_SIZE &&
+           memcmp(buffer_a, buffer_b, SEGMENT_SIZE) == 0;
+}
+
+// Find a segment stored already, NULL when it is new.
+static const SegmentEntry *segment_find(const FileInfo *file, uint32_t segment, uint64_t hash) {
+    for (uint32_t slot = (uint32_t)hash & (SEGMENT_INDEX_SLOTS - 1); segment_index[slot].file;
+         slot = (slot + 1) & (SEGMENT_INDEX_SLOTS - 1)) {
+        if (segment_index[slot].hash == hash &&
+            segments_equal(segment_index[slot].file, segment_index[slot].segment, file, segment)) {
+            return &segment_index[slot];
+        }
+    }
+    return NULL;
+}
+
+// Add a stored segment to the index. It stops growing at three quarters full, later copies are then stored again.
+static void segment_add(const FileInfo *file, uint32_t segment, uint64_t hash, uint32_t offset, uint32_t length) {
+    if (segment_index_count >= SEGMENT_INDEX_SLOTS / 4 * 3 || segment_find(file, segment, hash)) {
+        return;
+    }
+    uint32_t slot = (uint32_t)hash & (SEGMENT_INDEX_SLOTS - 1);
+    while (segment_index[slot].file) {
+        slot = (slot + 1) & (SEGMENT_INDEX_SLOTS - 1);
+    }
+    segment_index[slot].hash = hash;
+    segment_index[slot].file = file;
+    segment_index[slot].segment = segment;
+    segment_index[slot].offset = offset;
+    segment_index[slot].length = length;
+    segment_index_count++;
+}
+
+// Lay a ROM out at offset base, from the first ROM, its segments hashed and compressed already (analyze_rom). Its
+// segments found in the image already (in an earlier ROM or earlier in this one) are not stored again, the others are
+// their LZ4 blocks when there is one, in order after the table. Returns the segment table (the offset from the first
+// ROM and the length of the block of each segment), with *stored_size the bytes of the table and the blocks it adds,
+// or NULL when the ROM is stored as it is because that is not larger (or out of memory). *shared counts the segments
+// found already. The new segments go into the index. The blocks are only produced when the image is written.
+static uint8_t *store_rom(const FileInfo *file, uint32_t base, uint32_t *stored_size, uint32_t *shared) {
+    const uint64_t *const hashes = file->segment_hashes;
+    uint32_t const size = file->file_size;
+    uint32_t const segments = (size + SEGMENT_SIZE - 1) / SEGMENT_SIZE;
+    size_t const table_size = (size_t)segments * SEGMENT_ENTRY_SIZE;
+    uint8_t *table = (uint8_t *)malloc(table_size);
+    *stored_size = size;
+    *shared = 0;
+    if (!table) {
+        return NULL;
+    }
+
+    size_t at = table_size;
+    uint32_t found = 0;
+    for (uint32_t n = 0; n < segments; ++n) {
+        size_t const start = (size_t)n * SEGMENT_SIZE;
+        size_t const length = (size - start < SEGMENT_SIZE) ? size - start : SEGMENT_SIZE;
+        uint8_t *entry = table + (size_t)n * SEGMENT_ENTRY_SIZE;
+
+        // Only whole segments are shared, the last one of a ROM may be shorter
+        if (length == SEGMENT_SIZE) {
+            const SegmentEntry *stored = segment_find(file, n, hashes[n]);
+            if (stored) {
+                put_le32(entry, stored->offset);
+                put_le32(entry + 4, stored->length);
+                found++;
+                continue;
+            }
+            uint32_t same = 0;
+            while (same < n && (hashes[same] != hashes[n] || !segments_equal(file, same, file, n))) {
+                ++same;
+            }
+            if (same < n) {
+                memcpy(entry, table + (size_t)same * SEGMENT_ENTRY_SIZE, SEGMENT_ENTRY_SIZE);
+                found++;
+                continue;
+            }
+        }
+
+        uint32_t const block_size = file->block_sizes[n] ? file->block_sizes[n] : (uint32_t)length;
+        put_le32(entry, base + (uint32_t)at);
+        put_le32(entry + 4, block_size);
+        at += block_size;
+    }
+
+    // Index the segments stored by this ROM, where the firmware finds them either way
+    bool const plain = (at >= size);
+    for (uint32_t n = 0; n < segments && (size_t)(n + 1) * SEGMENT_SIZE <= size; ++n) {
+        const uint8_t *entry = table + (size_t)n * SEGMENT_ENTRY_SIZE;
+        if (plain) {
+            segment_add(file, n, hashes[n], base + n * SEGMENT_SIZE, SEGMENT_SIZE);
+        } else if (get_le32(entry) >= base) {
+            segment_add(file, n, hashes[n], get_le32(entry), get_le32(entry + 4));
+        }
+    }
+    if (plain) {
+        free(table);
+        return NULL;
+    }
+    *stored_size = (uint32_t)at;
+    *shared = found;
+    return table;
+}
+
+// Seconds of a monotonic clock, for the build time.
+static double now_seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + now.tv_nsec / 1e9;
+}
+
+// Number of processors, the default number of threads.
+static int processor_count(void) {
+#ifdef _SC_NPROCESSORS_ONLN
+    long const count = sysconf(_SC_NPROCESSORS_ONLN);
+    if (count > 0) {
+        return (int)count;
+    }
+#endif
+    const char *count_env = getenv("NUMBER_OF_PROCESSORS"); // Windows
+    return (count_env && atoi(count_env) > 0) ? atoi(count_env) : 1;
+}
+
+// Jobs run by the thread pool, each thread takes the next one until there is none left.
+typedef struct {
+    void (*run)(void *context, int index, LzState *lz);
+    void *context;
+    int count;
+    int next;
+    pthread_mutex_t lock;
+} JobQueue;
+
+static void *job_worker(void *arg) {
+    JobQueue *queue = (JobQueue *)arg;
+    LzState *lz = (LzState *)malloc(sizeof(LzState)); // Without it the segments of this thread are not compressed
+    for (;;) {
+        pthread_mutex_lock(&queue->lock);
+        int const index = queue->next++;
+        pthread_mutex_unlock(&queue->lock);
+        if (index >= queue->count) {
+            break;
+        }
+        queue->run(queue->context, index, lz);
+    }
+    free(lz);
+    return NULL;
+}
+
+// Run count jobs on up to threads threads, the calling thread being one of them, and wait for all of them. The jobs
+// write to their own entries only, what they produce does not depend on the thread or the order they run in.
+static void run_jobs(int threads, int count, void (*run)(void *, int, LzState *), void *context) {
+    JobQueue queue;
+    pthread_t workers[MAX_THREADS];
+    int started = 0;
+
+    queue.run = run;
+    queue.context = context;
+    queue.count = count;
+    queue.next = 0;
+    pthread_mutex_init(&queue.lock, NULL);
+    for (int t = 1; t < threads && t < count; ++t) {
+        if (pthread_create(&workers[started], NULL, job_worker, &queue) == 0) {
+            started++;
+        }
+    }
+    job_worker(&queue);
+    for (int t = 0; t < started; ++t) {
+        pthread_join(workers[t], NULL);
+    }
+    pthread_mutex_destroy(&queue.lock);
+}
+
+// The ROMs of a build and the cache of the last one, shared by the jobs.
+typedef struct {
+    FileInfo *files;
+    const CacheEntry *cache;
+    int cache_count;
+    bool emulate;               // Detect the mega ROMs on the Z80 interpreter too
+    bool compress;              // Measure the LZ4 block of every segment (-z)
+} BuildContext;
+
+static int compare_cache(const void *a, const void *b) {
+    return strcmp(((const CacheEntry *)a)->file_name, ((const CacheEntry *)b)->file_name);
+}
+
+static int compare_files(const void *a, const void *b) {
+    return strcmp(((const FileInfo *)a)->file_name, ((const FileInfo *)b)->file_name);
+}
+
+// Read the cache of the last build, sorted by file name. NULL when there is none or it is from another tool or another
+// mapper detection.
+static CacheEntry *load_cache(int *count, bool emulate) {
+    char header[128];
+    char line[512];
+    CacheEntry *entries = NULL;
+    int capacity = 0;
+
+    *count = 0;
+    FILE *file = fopen(CACHE_FILENAME, "r");
     if (!file) {
-        return 0;
+        return NULL;
+    }
+    snprintf(header, sizeof(header), CACHE_HEADER "\n", BOARD_NAME, APP_VERSION, ROMDB_ID, emulate ? "run" : "scan");
+    if (!fgets(line, sizeof(line), file) || strcmp(line, header) != 0) {
+        fclose(file);
+        return NULL;
+    }
+    while (fgets(line, sizeof(line), file)) {
+        CacheEntry entry;
+        unsigned mapper;
+        int name_at = 0;
+        line[strcspn(line, "\r\n")] = '\0';
+        if (sscanf(line, "%" SCNu32 " %lld %" SCNx64 " %u %d %n", &entry.size, &entry.mtime, &entry.hash, &mapper,
+                   &entry.known, &name_at) != 5 || name_at == 0 || strlen(line + name_at) >= sizeof(entry.file_name) ||
+            entry.known < -1 || entry.known >= ROMDB_COUNT) {
+            continue;
+        }
+        strcpy(entry.file_name, line + name_at);
+        entry.mapper = (uint8_t)mapper;
+        if (*count == capacity) {
+            capacity = capacity ? capacity * 2 : 256;
+            CacheEntry *grown = (CacheEntry *)realloc(entries, sizeof(CacheEntry) * (size_t)capacity);
+            if (!grown) {
+                break;
+            }
+            entries = grown;
+        }
+        entries[(*count)++] = entry;
     }
-    fseek(file, 0, SEEK_END);
-    uint32_t size = ftell(file);
     fclose(file);
-    return size;
+    if (entries) {
+        qsort(entries, (size_t)*count, sizeof(CacheEntry), compare_cache);
+    }
+    return entries;
 }
 
-// Return a textual description of the mapper type given its number.
-const char* mapper_description(int number) {
-    if (number <= 0 || (size_t)number > MAPPER_DESCRIPTION_COUNT) {
-        return "Unknown";
+// Write the mappers detected by this build for the next one, the ROMs with a mapper tag are not detected.
+static void save_cache(const FileInfo *files, int file_count, bool emulate) {
+    FILE *file = fopen(CACHE_FILENAME, "w");
+    if (!file) {
+        printf("Unable to write %s, the next build detects every mapper again\n", CACHE_FILENAME);
+        return;
     }
-    return MAPPER_DESCRIPTIONS[number - 1];
+    fprintf(file, CACHE_HEADER "\n", BOARD_NAME, APP_VERSION, ROMDB_ID, emulate ? "run" : "scan");
+    for (int i = 0; i < file_count; i++) {
+        if (files[i].loaded && !files[i].mapper_forced) {
+            fprintf(file, "%" PRIu32 " %lld %016" PRIx64 " %u %d %s\n", files[i].file_size, files[i].mtime,
+                    files[i].hash, files[i].mapper, files[i].known, files[i].file_name);
+        }
+    }
+    fclose(file);
+}
+
+// Detect the mapper of a ROM that is not in the ROM database: by the opcode scan, then with emulate by booting the mega
+// ROMs it found or could not tell apart on the Z80 interpreter, the scan stays when the run saw no bank switch.
+static uint8_t detect_mapper(const uint8_t *rom, uint32_t size, bool emulate) {
+    uint8_t const mapper = detect_rom_type(rom, size);
+    if (emulate && (mapper == 3 || mapper == 5 || mapper == 6 || mapper == 7 || mapper == MAPPER_AUTO)) {
+        uint8_t const run = romrun_detect(rom, size);
+        if (run) {
+            return run;
+        }
+    }
+    return mapper;
+}
+
+// Job: read a ROM and hash its segments, the hash of the ROM being the one of theirs, and identify it unless the
+// cache has it for the same file and bytes: by its SHA-1 in the ROM database, or else by detecting its mapper. With
+// -z its segments are compressed to know the size of their blocks. Only the hashes and the sizes are kept, the ROM is
+// read again when the image is written.
+static void analyze_rom(void *context, int index, LzState *lz) {
+    BuildContext *build = (BuildContext *)context;
+    FileInfo *file = &build->files[index];
+    uint32_t const segments = (file->file_size + SEGMENT_SIZE - 1) / SEGMENT_SIZE;
+    uint8_t block[SEGMENT_SIZE + SEGMENT_SIZE / 255 + 16];
+
+    file->known = -1;
+    uint8_t *data = load_file(file->file_name, file->file_size);
+    file->segment_hashes = (uint64_t *)calloc(segments, sizeof(uint64_t));
+    file->block_sizes = (uint32_t *)calloc(segments, sizeof(uint32_t));
+    if (!data || !file->segment_hashes || !file->block_sizes) {
+        free(data);
+        return;
+    }
+    file->loaded = true;
+    for (uint32_t n = 0; n < segments; n++) {
+        size_t const start = (size_t)n * SEGMENT_SIZE;
+        size_t const length = (file->file_size - start < SEGMENT_SIZE) ? file->file_size - start : SEGMENT_SIZE;
+        file->segment_hashes[n] = data_hash(data + start, length);
+    }
+    file->hash = data_hash((const uint8_t *)file->segment_hashes, segments * sizeof(uint64_t));
+    if (!file->mapper_forced) {
+        CacheEntry key;
+        strcpy(key.file_name, file->file_name);
+        const CacheEntry *hit = build->cache ? (const CacheEntry *)bsearch(&key, build->cache,
+                                                                            (size_t)build->cache_count,
+                                                                            sizeof(CacheEntry), compare_cache) : NULL;
+        if (hit && hit->size == file->file_size && hit->mtime == file->mtime && hit->hash == file->hash) {
+            file->mapper = hit->mapper;
+            file->known = hit->known;
+            file->cached = true;
+        } else {
+            file->known = romdb_identify(data, file->file_size);
+            file->mapper = (file->known >= 0) ? romdb_mapper(file->known) :
+                           detect_mapper(data, file->file_size, build->emulate);
+        }
+        if (file->known >= 0) {
+            snprintf(file->rom_name, sizeof(file->rom_name), "%s", romdb_title(file->known));
+        }
+    }
+
+    // The block of a segment is kept when it is smaller
+    for (uint32_t n = 0; build->compress && lz && file->mapper != 0 && n < segments; n++) {
+        size_t const start = (size_t)n * SEGMENT_SIZE;
+        size_t const length = (file->file_size - start < SEGMENT_SIZE) ? file->file_size - start : SEGMENT_SIZE;
+        size_t const block_size = lz_compress_block(lz, data + start, length, block);
+        file->block_sizes[n] = (block_size < length) ? (uint32_t)block_size : 0;
+    }
+    free(data);
 }
 
 // Attempt to guess the mapper type from the ROM contents.
 // Returns the mapper byte expected by the firmware (0 signals unsupported/unknown).
 // Code adapted from openMSX mapper detection routines.
-uint8_t detect_rom_type(const char *filename, uint32_t size) {
+uint8_t detect_rom_type(const uint8_t *rom, uint32_t size) {
     
     // Define the NEO8 signature
     const char neo8_signature[] = "ROM_NEO8";
@@ -140,42 +779,22 @@ uint8_t detect_rom_type(const char *filename, uint32_t size) {
         return 0; // unknown mapper
     }
 
-    FILE *file = fopen(filename, "rb");
-    if (!file) {
-        printf("Failed to open ROM file\n");
-        return 0; // unknown mapper
-    }
-
-    // Determine the size to read (max 128KB or the actual size if smaller)
+    // Determine the size to analyse (max 128KB or the actual size if smaller)
     size_t read_size = (size > MAX_ANALYSIS_SIZE) ? MAX_ANALYSIS_SIZE : size;
-    //size_t read_size = size; 
-    // Dynamically allocate memory for the ROM
-    uint8_t *rom = (uint8_t *)malloc(read_size);
-    if (!rom) {
-        printf("Failed to allocate memory for ROM\n");
-        fclose(file);
-        return 0; // unknown mapper
-    }
-
-    fread(rom, 1, read_size, file);
-    fclose(file);
     
     // Check if the ROM has the signature "AB" at 0x0000 and 0x0001
     // Those are the cases for 16KB and 32KB ROMs
     if (rom[0] == 'A' && rom[1] == 'B' && size == 16384) {
-        free(rom);
         return 1;     // Plain 16KB 
     }
 
     if (rom[0] == 'A' && rom[1] == 'B' && size <= 32768) {
 
         //check if it is a normal 32KB ROM or linear0 32KB ROM
-        if (rom[0x4000] == 'A' && rom[0x4001] == 'B') {
-            free(rom);
+        if (size > 0x4001 && rom[0x4000] == 'A' && rom[0x4001] == 'B') {
             return 4; // Linear0 32KB
         }
         
-        free(rom);
         return 2;     // Plain 32KB 
     }
 
@@ -183,18 +802,15 @@ uint8_t detect_rom_type(const char *filename, uint32_t size) {
     if (rom[0] == 'A' && rom[1] == 'B') {
         // Check for the NEO8 signature at offset 16
         if (memcmp(&rom[16], neo8_signature, sizeof(neo8_signature) - 1) == 0) {
-            free(rom);
             return 8; // NEO8 mapper detected
         } else if (memcmp(&rom[16], neo16_signature, sizeof(neo16_signature) - 1) == 0) {
-            free(rom);
             return 9; // NEO16 mapper detected
         }
     }
 
     // Check if the ROM has the signature "AB" at 0x4000 and 0x4001
     // That is the case for 48KB ROMs with Linear page 0 config
-    if (rom[0x4000] == 'A' && rom[0x4001] == 'B' && size <= 49152) {
-        free(rom);
+    if (size > 0x4001 && rom[0x4000] == 'A' && rom[0x4001] == 'B' && size <= 49152) {
         return 4; // Linear0 48KB
     }
 
@@ -250,123 +866,330 @@ uint8_t detect_rom_type(const char *filename, uint32_t size) {
 
         // Determine the ROM type based on the highest weighted score
         if (konami_scc_score > konami_score && konami_scc_score > ascii8_score && konami_scc_score > ascii16_score) {
-            free(rom);
             return 3; // Konami SCC
         }
         if (konami_score > konami_scc_score && konami_score > ascii8_score && konami_score > ascii16_score) {
-            free(rom);
             return 7; // Konami
         }
         if (ascii8_score > konami_score && ascii8_score > konami_scc_score && ascii8_score > ascii16_score) {
-            free(rom);
             return 5; // ASCII8
         }
         if (ascii16_score > konami_score && ascii16_score > konami_scc_score && ascii16_score > ascii8_score) {
-            free(rom);
             return 6; // ASCII16
         }
 
         if (ascii16_score == konami_scc_score)
         {
-            free(rom);
             return 6; // Konami SCC
         }
 
-        free(rom);
-        return 0; // unknown mapper
+        // No clear winner, let the firmware detect it from the bank switches when the ROM runs
+        return MAPPER_AUTO;
     }
     
-    free(rom);
+    return 0;
+}
+
+// Release the scanned ROM list and what it keeps of the ROMs.
+static void free_files(FileInfo *files, int file_count) {
+    if (files) {
+        for (int i = 0; i < file_count; i++) {
+            free(files[i].segment_hashes);
+            free(files[i].block_sizes);
+            free(files[i].packed);
+        }
+    }
+    free(files);
+}
+
+// Mapper of the tag of a file name ("Knight Mare.PL-32.ROM"), 0 without one.
+static uint8_t file_mapper_tag(const char *file_name) {
+    const char *extension = strstr(file_name, ".ROM");
+    char token[32];
+
+    if (extension == NULL) {
+        extension = strstr(file_name, ".rom");
+    }
+    if (extension == NULL) {
+        return 0;
+    }
+    const char *tag = extension;
+    while (tag > file_name && tag[-1] != '.') {
+        tag--;
+    }
+    size_t const length = (size_t)(extension - tag);
+    if (tag == file_name || length == 0 || length >= sizeof(token)) {
+        return 0;
+    }
+    memcpy(token, tag, length);
+    token[length] = '\0';
+    return mapper_number_from_description(token);
+}
+
+// Benchmark the mapper detection on the ROMs of the current directory whose tag is a mapper it can find (PL-16 to
+// NEO-16): the opcode scan alone, then with the Z80 interpreter, the mappers they get right and the time they take.
+static int run_bench(void) {
+    char (*names)[256] = NULL;
+    int name_count = 0;
+    int capacity = 0;
+    int total = 0;
+    int scan_right = 0;
+    int run_right = 0;
+    double scan_time = 0;
+    double run_time = 0;
+
+    DIR *dir = opendir(".");
+    if (!dir) {
+        printf("Failed to open directory!\n");
+        return 1;
+    }
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        uint8_t const tag = file_mapper_tag(entry->d_name);
+        if (tag == 0 || tag > 9 || strlen(entry->d_name) >= sizeof(names[0])) {
+            continue;
+        }
+        if (name_count == capacity) {
+            capacity = capacity ? capacity * 2 : 256;
+            char (*grown)[256] = realloc(names, sizeof(names[0]) * (size_t)capacity);
+            if (!grown) {
+                break;
+            }
+            names = grown;
+        }
+        strcpy(names[name_count++], entry->d_name);
+    }
+    closedir(dir);
+    if (names) {
+        qsort(names, (size_t)name_count, sizeof(names[0]), (int (*)(const void *, const void *))strcmp);
+    }
+
+    printf("Benchmarking the mapper detection on the ROMs with a mapper tag...\n\n");
+    for (int i = 0; i < name_count; i++) {
+        struct stat file_stat;
+        if (stat(names[i], &file_stat) != 0 || file_stat.st_size > MAX_ROM_SIZE || file_stat.st_size < MIN_ROM_SIZE) {
+            continue;
+        }
+        uint32_t const size = (uint32_t)file_stat.st_size;
+        uint8_t *rom = load_file(names[i], size);
+        if (!rom) {
+            printf("Skipping %s (unable to read it)\n", names[i]);
+            continue;
+        }
+        uint8_t const tag = file_mapper_tag(names[i]);
+        double const scan_start = now_seconds();
+        uint8_t const scanned = detect_mapper(rom, size, false);
+        double const run_start = now_seconds();
+        uint8_t const run = detect_mapper(rom, size, true);
+        double const run_end = now_seconds();
+        free(rom);
+
+        scan_time += run_start - scan_start;
+        run_time += run_end - run_start;
+        scan_right += (scanned == tag) ? 1 : 0;
+        run_right += (run == tag) ? 1 : 0;
+        total++;
+        printf("%-50.50s %-7s scan %-7s %-5s run %-7s %s\n", names[i], mapper_description(tag),
+               mapper_description(scanned), (scanned == tag) ? "" : "wrong", mapper_description(run),
+               (run == tag) ? "" : "wrong");
+    }
+    free(names);
+    if (total == 0) {
+        printf("No ROM files with a mapper tag found in the current directory.\n");
+        return 1;
+    }
+    printf("\nOpcode scan:       %d of %d mappers right in %.3f seconds\n", scan_right, total, scan_time);
+    printf("With -e (Z80 run): %d of %d mappers right in %.3f seconds\n", run_right, total, run_time);
     return 0;
 }
 
 // Print usage information
 static void print_usage(const char *prog_name) {
 
-    printf("Usage: %s [-h|-n|-o <filename>]\n", prog_name);
+    printf("Usage: %s [-h|-n|-z|-e|-b|-j <threads>|-o <filename>]\n", prog_name);
     printf("  without options, the tool scans the current directory for .ROM files to include in the MultiROM image\n");
+    printf("  the 8KB segments found in several ROMs (revisions, translations, patched copies) are stored once\n");
     printf("Options:\n");
     printf("  -h   Show this help message\n");
     printf("  -n, --nextor  Include embedded Nextor ROM in the MultiROM image (experimental, only MSX2)\n");
+    printf("  -z, --compress  Also compress the ROMs, more of them fit in the flash\n");
+    printf("  -e, --emulate   Also detect the mega ROM mappers by running the ROMs on a Z80 interpreter (slower)\n");
+    printf("  -b, --bench     Compare both mapper detections with the mapper tags of the ROMs, build no image\n");
+    printf("  -j <threads>, --jobs <threads>  Threads reading and compressing the ROMs (default: one per processor)\n");
     printf("  -o <filename>, --output <filename>  Set UF2 output filename (default %s)\n", UF2FILENAME);
     printf("\n");
     printf("  append a mapper tag before the extension to force detection (case-insensitive)\n");
-    printf("  e.g., \"Knight Mare.PL-32.ROM\" forces PL-32; \"SYSTEM\" tags are ignored\n\n");
+    printf("  e.g., \"Knight Mare.PL-32.ROM\" forces PL-32; \"SYSTEM\" tags are ignored\n");
+    printf("  AUTO lets the firmware detect the mapper from the bank switches the first time the ROM runs\n");
+    printf("  ASC8SR, ASC16S and GM2 are the ASCII8/ASCII16 SRAM and Game Master 2 mappers, their SRAM is saved to flash\n");
+    printf("  SCC+ loads the ROM into the 128KB of RAM of a Konami Sound Cartridge (SCC-I)\n");
+    if (ROMDB_COUNT > 0) { // Not with an empty romdb/romdb.txt
+        printf("  the %d dumps of the ROM database get their mapper and title without a tag\n", ROMDB_COUNT);
+    }
+    printf("\n");
     printf("  here are the mapper descriptions you can use to force a specific mapper type:\n");
-    for (size_t i = 0; i < MAPPER_DESCRIPTION_COUNT-1; ++i) {
-        printf("  %s", MAPPER_DESCRIPTIONS[i]);
+    for (size_t i = 0; i < MAPPER_DESCRIPTION_COUNT; ++i) {
+        if (i + 1 != MAPPER_SYSTEM) {
+            printf("  %s", MAPPER_DESCRIPTIONS[i]);
+        }
     }
     printf("\n");
     printf("UF2 output file: %s\n", UF2FILENAME);
+    printf("Mapper cache: %s, in the ROM directory\n", CACHE_FILENAME);
 }
 
-// Serialize the fully joined binary image into UF2 blocks so the Pico can be programmed via USB MSC.
-void create_uf2_file(const uint8_t *data, size_t size, const char *uf2_filename) {
-
-    if (!data || size == 0) {
-        printf("No data provided to create UF2 file\n");
-        return;
+// UF2 file written as the image is produced: the bytes go into the payload of the current block, written out once
+// full, so the image is never held in memory as a whole.
+typedef struct {
+    FILE *file;
+    UF2_Block block;        // Block being filled
+    size_t fill;            // Payload bytes of the block
+    size_t offset;          // Image bytes written
+#ifdef DEBUG
+    FILE *payload_dump;     // multirom_payload.bin, the image itself
+    FILE *rom_dump;         // multirom.rom, the TARGET_FILE_SIZE bytes of the image from rom_dump_start
+    size_t rom_dump_start;
+#endif
+} Uf2Writer;
+
+// Start the UF2 file of an image of the given size, filled by uf2_write() and finished by uf2_close().
+// Returns false when the file cannot be created.
+static bool uf2_open(Uf2Writer *uf2, const char *uf2_filename, size_t size) {
+    memset(uf2, 0, sizeof(*uf2));
+    uf2->file = fopen(uf2_filename, "wb");
+    if (!uf2->file) {
+        printf("Failed to create UF2 file\n");
+        return false;
     }
 
+    uf2->block.magicStart0 = UF2_MAGIC_START0; // 0x0A324655 "UF2\n"
+    uf2->block.magicStart1 = UF2_MAGIC_START1; // 0x9E5D5157
+    uf2->block.flags = 0x00002000;            // UF2_FLAG_FAMILYID_PRESENT
+    uf2->block.magicEnd = UF2_MAGIC_END;      // 0x0AB16F30
+    uf2->block.targetAddr = FLASH_START;      // Start of the flash memory on the Raspberry Pi Pico
+    uf2->block.payloadSize = 256;             // Payload size
+    uf2->block.numBlocks = (uint32_t)((size + uf2->block.payloadSize - 1) / uf2->block.payloadSize);
+    uf2->block.fileSize = 0xe48bff56;         // Size of the file
+
 #ifdef DEBUG // Dump the payload to a binary file for debugging
-    const char *dump_filename = "multirom_payload.bin";
-    FILE *dump_file = fopen(dump_filename, "wb");
-    if (!dump_file) {
-        printf("DEBUG: Failed to open %s for payload dump\n", dump_filename);
-    } else {
-        size_t written = fwrite(data, 1, size, dump_file);
-        if (written != size) {
-            printf("DEBUG: Payload dump truncated (%zu of %zu bytes)\n", written, size);
-        } else {
-            printf("DEBUG: Wrote %zu bytes to %s\n", size, dump_filename);
-        }
-        fclose(dump_file);
+    uf2->payload_dump = fopen("multirom_payload.bin", "wb");
+    if (!uf2->payload_dump) {
+        printf("DEBUG: Failed to open multirom_payload.bin for payload dump\n");
     }
 #endif
+    return true;
+}
 
-    // Create and open the UF2 file for writing
-    FILE *uf2_file = fopen(uf2_filename, "wb");
-    if (!uf2_file) {
-        printf("Failed to create UF2 file");
-        return;
-    }
-
-    // Prepare the UF2 block template
-    UF2_Block bl;
-    memset(&bl, 0, sizeof(bl));
-
-    bl.magicStart0 = UF2_MAGIC_START0; // 0x0A324655 "UF2\n"
-    bl.magicStart1 = UF2_MAGIC_START1; // 0x9E5D5157
-    bl.flags = 0x00002000;            // UF2_FLAG_FAMILYID_PRESENT
-    bl.magicEnd = UF2_MAGIC_END;      // 0x0AB16F30
-    bl.targetAddr = FLASH_START;      // Start of the flash memory on the Raspberry Pi Pico
-    bl.payloadSize = 256;             // Payload size
-    bl.numBlocks = (uint32_t)((size + bl.payloadSize - 1) / bl.payloadSize);
-    bl.fileSize = 0xe48bff56;         // Size of the file
+// Write out the block, its payload padded with zeros.
+static void uf2_write_block(Uf2Writer *uf2) {
+    memset(uf2->block.data + uf2->fill, 0, uf2->block.payloadSize - uf2->fill);
+    fwrite(&uf2->block, 1, sizeof(uf2->block), uf2->file);
+    uf2->block.blockNo++;
+    uf2->block.targetAddr += uf2->block.payloadSize;
+    uf2->fill = 0;
+}
 
-    size_t offset = 0;
-    uint32_t block_no = 0;
+// Append bytes to the image.
+static void uf2_write(Uf2Writer *uf2, const void *data, size_t size) {
+    const uint8_t *bytes = (const uint8_t *)data;
 
-    // Write the UF2 blocks
-    while (offset < size) {
-        size_t chunk = size - offset;
-        if (chunk > bl.payloadSize) {
-            chunk = bl.payloadSize;
+#ifdef DEBUG
+    if (uf2->payload_dump) {
+        fwrite(bytes, 1, size, uf2->payload_dump);
+    }
+    if (uf2->rom_dump && uf2->offset + size > uf2->rom_dump_start &&
+        uf2->offset < uf2->rom_dump_start + TARGET_FILE_SIZE) {
+        size_t const from = (uf2->offset < uf2->rom_dump_start) ? uf2->rom_dump_start - uf2->offset : 0;
+        size_t const to = (uf2->offset + size > uf2->rom_dump_start + TARGET_FILE_SIZE) ?
+                          uf2->rom_dump_start + TARGET_FILE_SIZE - uf2->offset : size;
+        fwrite(bytes + from, 1, to - from, uf2->rom_dump);
+    }
+#endif
+    uf2->offset += size;
+    while (size > 0) {
+        size_t chunk = uf2->block.payloadSize - uf2->fill;
+        if (chunk > size) {
+            chunk = size;
         }
-
-        memcpy(bl.data, data + offset, chunk);
-        if (chunk < bl.payloadSize) {
-            memset(bl.data + chunk, 0, bl.payloadSize - chunk);
+        memcpy(uf2->block.data + uf2->fill, bytes, chunk);
+        uf2->fill += chunk;
+        bytes += chunk;
+        size -= chunk;
+        if (uf2->fill == uf2->block.payloadSize) {
+            uf2_write_block(uf2);
         }
+    }
+}
 
-        bl.blockNo = block_no++;
-        fwrite(&bl, 1, sizeof(bl), uf2_file);
-        bl.targetAddr += bl.payloadSize;
-        offset += chunk;
+// Write the last block and close the UF2 file. Returns false when the file could not be written.
+static bool uf2_close(Uf2Writer *uf2, const char *uf2_filename) {
+    if (uf2->fill > 0) {
+        uf2_write_block(uf2);
+    }
+    bool written = !ferror(uf2->file);
+    if (fclose(uf2->file) != 0) {
+        written = false;
+    }
+#ifdef DEBUG
+    if (uf2->payload_dump) {
+        fclose(uf2->payload_dump);
+        printf("DEBUG: Wrote %zu bytes to multirom_payload.bin\n", uf2->offset);
+    }
+    if (uf2->rom_dump) {
+        fclose(uf2->rom_dump);
+        printf("DEBUG: Wrote %d bytes to multirom.rom\n", TARGET_FILE_SIZE);
     }
+#endif
+    if (!written) {
+        printf("\nFailed to write %s\n", uf2_filename);
+        return false;
+    }
+    printf("\nSuccessfully wrote %u blocks to %s.\n", uf2->block.blockNo, uf2_filename);
+    return true;
+}
 
-    fclose(uf2_file);
-    printf("\nSuccessfully wrote %u blocks to %s.\n", block_no, uf2_filename);
+// Write a ROM laid out by store_rom() to the image, read again from its file one segment at a time: as it is, or its
+// segment table (rebased by rom_start, the offset of the first ROM in the image) followed by the segments it stores,
+// compressed again into the blocks measured by analyze_rom(). Returns false when the file cannot be read or changed.
+static bool write_rom(Uf2Writer *uf2, FileInfo *file, uint32_t rom_start, LzState *lz) {
+    static uint8_t segment[SEGMENT_SIZE];
+    static uint8_t block[SEGMENT_SIZE + SEGMENT_SIZE / 255 + 16];
+    uint32_t const segments = (file->file_size + SEGMENT_SIZE - 1) / SEGMENT_SIZE;
+    FILE *handle = fopen(file->file_name, "rb");
+    bool read = handle != NULL;
+
+    // The segments this ROM stores are the ones whose block comes next, the table is first
+    uint32_t at = file->base + segments * SEGMENT_ENTRY_SIZE;
+    if (file->packed) {
+        for (uint32_t n = 0; n < segments; n++) {
+            uint8_t *entry = file->packed + (size_t)n * SEGMENT_ENTRY_SIZE;
+            put_le32(entry, get_le32(entry) + rom_start);
+        }
+        uf2_write(uf2, file->packed, segments * SEGMENT_ENTRY_SIZE);
+    }
+    for (uint32_t n = 0; read && n < segments; n++) {
+        size_t const start = (size_t)n * SEGMENT_SIZE;
+        size_t const length = (file->file_size - start < SEGMENT_SIZE) ? file->file_size - start : SEGMENT_SIZE;
+        const uint8_t *entry = file->packed ? file->packed + (size_t)n * SEGMENT_ENTRY_SIZE : NULL;
+        if (entry && get_le32(entry) != at + rom_start) {
+            continue;                   // Shared, stored by an earlier segment or ROM
+        }
+        read = fseek(handle, (long)start, SEEK_SET) == 0 && fread(segment, 1, length, handle) == length;
+        if (!read) {
+            break;
+        }
+        if (entry && file->block_sizes[n]) {
+            read = lz_compress_block(lz, segment, length, block) == file->block_sizes[n];
+            uf2_write(uf2, block, file->block_sizes[n]);
+        } else {
+            uf2_write(uf2, segment, length);
+        }
+        at += entry ? get_le32(entry + 4) : 0;
+    }
+    if (handle) {
+        fclose(handle);
+    }
+    return read;
 }
 
 // Main function
@@ -378,6 +1201,10 @@ int main(int argc, char *argv[])
     printf("MSX forever!\n\n");
 
     bool include_nextor = false;
+    bool compress = false;
+    bool emulate = false;
+    bool bench = false;
+    int threads = processor_count();
     bool show_help = false;
     const char *bad_option = NULL;
     BuildMode build_mode = BUILD_MODE_STANDARD;
@@ -391,6 +1218,18 @@ int main(int argc, char *argv[])
     for (int i = 1; i < argc; ++i) {
         if ((strcmp(argv[i], "-n") == 0) || (strcmp(argv[i], "--nextor") == 0)) {
             include_nextor = true;
+        } else if ((strcmp(argv[i], "-z") == 0) || (strcmp(argv[i], "--compress") == 0)) {
+            compress = true;
+        } else if ((strcmp(argv[i], "-e") == 0) || (strcmp(argv[i], "--emulate") == 0)) {
+            emulate = true;
+        } else if ((strcmp(argv[i], "-b") == 0) || (strcmp(argv[i], "--bench") == 0)) {
+            bench = true;
+        } else if ((strcmp(argv[i], "-j") == 0) || (strcmp(argv[i], "--jobs") == 0)) {
+            if (i + 1 >= argc || atoi(argv[i + 1]) <= 0) {
+                bad_option = argv[i];
+                break;
+            }
+            threads = atoi(argv[++i]);
         } else if ((strcmp(argv[i], "-h") == 0) || (strcmp(argv[i], "--help") == 0)) {
             show_help = true;
         } else if ((strcmp(argv[i], "-o") == 0) || (strcmp(argv[i], "--output") == 0)) {
@@ -426,88 +1265,104 @@ int main(int argc, char *argv[])
         return 0;
     }
 
+    // Benchmark the mapper detection and exit
+    if (bench) {
+        return run_bench();
+    }
+
     // Standard MultiROM build mode
+    if (threads > MAX_THREADS) {
+        threads = MAX_THREADS;
+    }
+    double const build_start = now_seconds();
     printf("Scanning current directory for .ROM files...\n\n");
     DIR *dir;
     struct dirent *entry;
-    FileInfo files[MAX_ROM_FILES]; // Array to track discovered ROM files
+    int file_capacity = 256;
+    FileInfo *files = (FileInfo *)malloc(sizeof(FileInfo) * (size_t)file_capacity); // Array to track discovered ROM files
+    ConfigRecord *records = (ConfigRecord *)malloc(sizeof(ConfigRecord) * MAX_ROM_FILES); // Configuration records
     int file_count = 0;
-    int file_index = 1;
-    uint32_t base_offset = TARGET_FILE_SIZE; // Start appending ROMs after the MENU + config area
-    size_t total_rom_size = 0;
-    size_t config_offset = 0;
-    uint8_t *config_buffer = (uint8_t *)malloc(CONFIG_AREA_SIZE); // Configuration area buffer
-    if (!config_buffer) {
+    int stored_count = 0; // ROMs laid out, the first ones of files
+    int record_count = 0;
+    uint32_t base_offset = 0; // From the first ROM, the configuration area is laid out once every ROM is known
+    size_t total_rom_size = 0; // Bytes in the flash
+    size_t total_raw_size = 0; // Bytes of the ROMs, as they are
+    uint32_t shared_segments = 0; // Segments found in the image already
+    if (!files || !records) {
         printf("Failed to allocate configuration buffer\n");
+        free(files);
+        free(records);
         return 1;
     }
-    memset(config_buffer, 0xFF, CONFIG_AREA_SIZE); // Initialize config area to 0xFF
 
     // Include embedded Nextor ROM if requested
     if (include_nextor) {
-        char nextor_rom_name[MAX_FILE_NAME_LENGTH] = {0};
-        strncpy(nextor_rom_name, "Nextor USB (IO)", MAX_FILE_NAME_LENGTH);
-        memcpy(config_buffer + config_offset, nextor_rom_name, MAX_FILE_NAME_LENGTH);
-        config_offset += MAX_FILE_NAME_LENGTH;
-        config_buffer[config_offset++] = 10;
         uint32_t nextor_size = sizeof(___nextor_dist_nextor_rom);
-        memcpy(config_buffer + config_offset, &nextor_size, sizeof(nextor_size));
-        config_offset += sizeof(nextor_size);
-        uint32_t nextor_offset = base_offset;
-        memcpy(config_buffer + config_offset, &nextor_offset, sizeof(nextor_offset));
-        config_offset += sizeof(nextor_offset);
-        printf("File %02d: Name = %-50s, Size = %07u bytes, Flash Offset = 0x%08X, Mapper = %s\n",
-               file_index, "Nextor USB (IO)", nextor_size, nextor_offset, mapper_description(10));
+        add_record(records, &record_count, "Nextor USB (IO)", MAPPER_SYSTEM, false, nextor_size, base_offset);
         total_rom_size += nextor_size;
+        total_raw_size += nextor_size;
         if (total_rom_size > MAX_TOTAL_ROM_SIZE) {
             printf("Total ROM data exceeds maximum supported size of %u bytes.\n", (unsigned)MAX_TOTAL_ROM_SIZE);
-            free(config_buffer);
+            free(files);
+            free(records);
             return 1;
         }
 
-        file_index++;
         base_offset += nextor_size;
     }
 
-    // Scan the current directory for .ROM files
+    // List the .ROM files of the current directory
     dir = opendir(".");
     if (!dir) {
         printf("Failed to open directory!\n");
-        free(config_buffer);
+        free_files(files, file_count);
+        free(records);
         return 1;
     }
-
-    // Process each directory entry
     while ((entry = readdir(dir)) != NULL) {
         // Check for .ROM or .rom extension
         if ((strstr(entry->d_name, ".ROM") == NULL) && (strstr(entry->d_name, ".rom") == NULL)) {
             continue;
         }
-
-        // Check maximum number of ROM files
-        if (file_count >= MAX_ROM_FILES) {
-            printf("Maximum number of ROM files (%d) reached\n", MAX_ROM_FILES);
-            break;
+        if (file_count == file_capacity) {
+            FileInfo *grown = (FileInfo *)realloc(files, sizeof(FileInfo) * (size_t)file_capacity * 2);
+            if (!grown) {
+                printf("Too many ROM files to list\n");
+                break;
+            }
+            files = grown;
+            file_capacity *= 2;
         }
+        memset(&files[file_count], 0, sizeof(FileInfo));
+        strncpy(files[file_count].file_name, entry->d_name, sizeof(files[file_count].file_name));
+        files[file_count].file_name[sizeof(files[file_count].file_name) - 1] = '\0';
+        file_count++;
+    }
+    closedir(dir); // Close the directory
+
+    // In file name order, the image and the messages do not depend on the directory order
+    qsort(files, (size_t)file_count, sizeof(FileInfo), compare_files);
+    int kept = 0;
+    for (int i = 0; i < file_count; i++) {
+        FileInfo *file = &files[i];
 
         // Extract ROM name (without extension) and check for forced mapper tags
         char rom_name[MAX_FILE_NAME_LENGTH] = {0};
-        uint32_t rom_size = 0;
-        uint32_t fl_offset = base_offset;
         bool mapper_forced = false;
         uint8_t forced_mapper_byte = 0;
+        struct stat file_stat;
 
-        char *dot_position = strstr(entry->d_name, ".ROM");
+        char *dot_position = strstr(file->file_name, ".ROM");
         if (dot_position == NULL) {
-            dot_position = strstr(entry->d_name, ".rom");
+            dot_position = strstr(file->file_name, ".rom");
         }
 
         size_t name_length;
         if (dot_position != NULL) {
-            name_length = (size_t)(dot_position - entry->d_name);
+            name_length = (size_t)(dot_position - file->file_name);
 
             char *last_period = NULL;
-            for (char *p = entry->d_name; p < dot_position; ++p) {
+            for (char *p = file->file_name; p < dot_position; ++p) {
                 if (*p == '.') {
                     last_period = p;
                 }
@@ -525,104 +1380,164 @@ int main(int argc, char *argv[])
                     mapper_token[token_length] = '\0';
 
                     uint8_t candidate = mapper_number_from_description(mapper_token);
-                    if (candidate == 10) {
-                        printf("Ignoring SYSTEM mapper tag in %s (cannot be forced)\n", entry->d_name);
+                    if (candidate == MAPPER_SYSTEM) {
+                        printf("Ignoring SYSTEM mapper tag in %s (cannot be forced)\n", file->file_name);
                     } else if (candidate != 0) {
                         mapper_forced = true;
                         forced_mapper_byte = candidate;
-                        name_length = (size_t)(last_period - entry->d_name);
+                        name_length = (size_t)(last_period - file->file_name);
                     }
                 }
             }
         } else {
-            name_length = strnlen(entry->d_name, MAX_FILE_NAME_LENGTH);
+            name_length = strnlen(file->file_name, MAX_FILE_NAME_LENGTH);
         }
 
         if (name_length > MAX_FILE_NAME_LENGTH) {
             name_length = MAX_FILE_NAME_LENGTH;
         }
-        strncpy(rom_name, entry->d_name, name_length);
+        strncpy(rom_name, file->file_name, name_length);
         if (name_length < MAX_FILE_NAME_LENGTH) {
             rom_name[name_length] = '\0';
         } else {
             rom_name[MAX_FILE_NAME_LENGTH - 1] = '\0';
         }
 
-        rom_size = file_size(entry->d_name);
-        if (rom_size == 0) {
-            printf("Skipping %s (unable to determine size)\n", entry->d_name);
+        if (stat(file->file_name, &file_stat) != 0 || file_stat.st_size == 0) {
+            printf("Skipping %s (unable to determine size)\n", file->file_name);
             continue;
         }
-
-        // Detect mapper type
-        if (rom_size > MAX_ROM_SIZE || rom_size < MIN_ROM_SIZE) {
-            printf("Skipping %s (invalid ROM size)\n", entry->d_name);
+        if (file_stat.st_size > MAX_ROM_SIZE || file_stat.st_size < MIN_ROM_SIZE) {
+            printf("Skipping %s (invalid ROM size)\n", file->file_name);
             continue;
         }
-
-        uint8_t mapper_byte = mapper_forced ? forced_mapper_byte : detect_rom_type(entry->d_name, rom_size);
-        if (mapper_byte == 0) {
-            printf("Skipping %s (unsupported mapper)\n", entry->d_name);
+        file->file_size = (uint32_t)file_stat.st_size;
+        file->mtime = (long long)file_stat.st_mtime;
+        file->mapper_forced = mapper_forced;
+        file->mapper = forced_mapper_byte;
+        memcpy(file->rom_name, rom_name, sizeof(file->rom_name));
+        files[kept++] = *file;
+    }
+    file_count = kept;
+
+    // Read, hash, identify and with -z compress the ROMs on the thread pool, the cache saves the detection of the
+    // unchanged ones
+    BuildContext build;
+    memset(&build, 0, sizeof(build));
+    build.files = files;
+    build.emulate = emulate;
+    build.compress = compress;
+    CacheEntry *cache = load_cache(&build.cache_count, emulate);
+    build.cache = cache;
+    run_jobs(threads, file_count, analyze_rom, &build);
+    free(cache);
+    save_cache(files, file_count, emulate);
+
+    // Keep the ROMs that can be stored
+    kept = 0;
+    int cached_count = 0;
+    int known_count = 0;
+    for (int i = 0; i < file_count; i++) {
+        FileInfo *file = &files[i];
+        if (!file->loaded) {
+            printf("Skipping %s (unable to read it)\n", file->file_name);
+        } else if (file->mapper == 0) {
+            printf("Skipping %s (unsupported mapper)\n", file->file_name);
+        } else {
+            cached_count += file->cached ? 1 : 0;
+            known_count += (file->known >= 0) ? 1 : 0;
+            files[kept++] = *file;
             continue;
         }
+        free(file->segment_hashes);
+        free(file->block_sizes);
+    }
+    file_count = kept;
 
-        // Check if ROM fits in the remaining space
-        if (config_offset + CONFIG_RECORD_SIZE > CONFIG_AREA_SIZE) {
-            printf("Configuration area capacity exceeded\n");
-            closedir(dir);
-            free(config_buffer);
-            return 1;
-        }
-
-        // Write ROM metadata to configuration buffer
-        memcpy(config_buffer + config_offset, rom_name, MAX_FILE_NAME_LENGTH);
-        config_offset += MAX_FILE_NAME_LENGTH;
-        config_buffer[config_offset++] = mapper_byte;
-        memcpy(config_buffer + config_offset, &rom_size, sizeof(rom_size));
-        config_offset += sizeof(rom_size);
-        memcpy(config_buffer + config_offset, &fl_offset, sizeof(fl_offset));
-        config_offset += sizeof(fl_offset);
+    // Lay the ROMs out in order, a ROM only shares the segments of the ROMs before it
+    for (int i = 0; i < file_count; i++) {
+        FileInfo *file = &files[i];
 
-        // Print ROM information
-         printf("File %02d: Name = %-50s, Size = %07u bytes, Flash Offset = 0x%08X, Mapper = %s%s\n",
-             file_index, rom_name, rom_size, fl_offset, mapper_description(mapper_byte),
-             mapper_forced ? " (forced)" : "");
+        // Check maximum number of ROM files
+        if (record_count >= MAX_ROM_FILES) {
+            printf("Maximum number of ROM files (%d) reached\n", MAX_ROM_FILES);
+            break;
+        }
 
-        strncpy(files[file_count].file_name, entry->d_name, sizeof(files[file_count].file_name));
-        files[file_count].file_name[sizeof(files[file_count].file_name) - 1] = '\0';
-        files[file_count].file_size = rom_size;
-        file_count++;
-        file_index++;
-        base_offset += rom_size;
-        total_rom_size += rom_size;
+        // Store the ROM now, the size it takes in the flash places the next one
+        uint32_t stored_size = file->file_size;
+        uint32_t shared = 0;
+        file->base = base_offset;
+        file->packed = store_rom(file, base_offset, &stored_size, &shared);
+        file->stored_size = stored_size;
+
+        // Keep the ROM metadata for the configuration area
+        add_record(records, &record_count, file->rom_name, file->mapper, file->mapper_forced, file->file_size,
+                   base_offset);
+        records[record_count - 1].known = file->known >= 0;
+        if (file->packed) {
+            records[record_count - 1].flags = CONFIG_FLAG_SEGMENTS;
+            records[record_count - 1].stored_size = stored_size;
+        }
+        stored_count++;
+        base_offset += stored_size;
+        total_rom_size += stored_size;
+        total_raw_size += file->file_size;
+        shared_segments += shared;
 
         if (total_rom_size > MAX_TOTAL_ROM_SIZE) {
             printf("Total ROM data exceeds maximum supported size of %u bytes.\n", (unsigned)MAX_TOTAL_ROM_SIZE);
-            closedir(dir);
-            free(config_buffer);
+            free_files(files, file_count);
+            free(records);
             return 1;
         }
     }
 
-    closedir(dir); // Close the directory
-
     // Handle case of no ROM files found
-    if (file_count == 0) {
+    if (stored_count == 0) {
         if (include_nextor) {
             printf("No external ROM files found; generating image with embedded Nextor only.\n");
         } else {
             printf("No ROM files found in the current directory.\n\n");
             print_usage(argv[0] ? argv[0] : "multirom");
-            free(config_buffer);
+            free_files(files, file_count);
+            free(records);
             return 1;
         }
     }
 
+    // Lay out the configuration area now that every ROM is known, the ROMs go after it
+    size_t config_size = 0;
+    uint32_t rom_start = 0;
+    uint8_t *config_buffer = build_config(records, record_count, &config_size, &rom_start);
+    if (!config_buffer) {
+        printf("Failed to allocate configuration buffer\n");
+        free_files(files, file_count);
+        free(records);
+        return 1;
+    }
+
+    // Print ROM information
+    printf("\n");
+    for (int i = 0; i < record_count; i++) {
+        printf("File %02d: Name = %-50s, Size = %07u bytes, Flash Offset = 0x%08X, Mapper = %s%s",
+               i + 1, records[i].name, records[i].size, records[i].offset, mapper_description(records[i].mapper),
+               records[i].forced ? " (forced)" : records[i].known ? " (database)" : "");
+        if (records[i].flags & CONFIG_FLAG_SEGMENTS) {
+            printf(", Stored = %07u bytes", records[i].stored_size);
+        }
+        printf("\n");
+    }
+    printf("\nStorage: %zu bytes of ROMs stored in %zu bytes, %u shared segments\n", total_raw_size, total_rom_size,
+           shared_segments);
+    free(records);
+
     // Prepare the final combined binary image
     const size_t firmware_size = sizeof(___pico_multirom_build_multirom_bin);
     if (firmware_size == 0) {
         printf("Embedded firmware payload is empty\n");
         free(config_buffer);
+        free_files(files, file_count);
         return 1;
     }
 
@@ -631,6 +1546,7 @@ int main(int argc, char *argv[])
     if (menu_rom_size < MENU_COPY_SIZE) {
         printf("Embedded menu ROM is smaller than the expected %d bytes\n", MENU_COPY_SIZE);
         free(config_buffer);
+        free_files(files, file_count);
         return 1;
     }
 
@@ -639,86 +1555,70 @@ int main(int argc, char *argv[])
     if (include_nextor && nextor_rom_size == 0) {
         printf("Embedded Nextor ROM payload is empty\n");
         free(config_buffer);
+        free_files(files, file_count);
         return 1;
     }
 
-    // Final flash image layout: [firmware][config area][menu slice][Nextor ROM + scanned ROM payloads]
-    const size_t total_size = firmware_size + CONFIG_AREA_SIZE + MENU_COPY_SIZE + total_rom_size;
-    uint8_t *combined_buffer = (uint8_t *)malloc(total_size);
-    if (!combined_buffer) {
-        printf("Failed to allocate combined buffer\n");
+    // Final flash image layout: [firmware][menu slice][config area][Nextor ROM + scanned ROM payloads], written to the
+    // UF2 file in one pass straight from the pieces, the ROMs read again from their files one segment at a time
+    const size_t total_size = firmware_size + MENU_COPY_SIZE + config_size + total_rom_size;
+    LzState *lz = (LzState *)malloc(sizeof(LzState));
+    Uf2Writer uf2;
+    if (!lz || !uf2_open(&uf2, uf2_output_filename, total_size)) {
+        printf("%s", lz ? "" : "Failed to allocate the compressor\n");
+        free(lz);
         free(config_buffer);
+        free_files(files, file_count);
         return 1;
     }
-
-    size_t offset = 0;
-    // Copy the embedded Pico firmware blob.
-    memcpy(combined_buffer + offset, ___pico_multirom_build_multirom_bin, firmware_size);
-    offset += firmware_size;
-
-    // Copy the portion of the MSX menu ROM that precedes the dynamic configuration structure.
-    memcpy(combined_buffer + offset, ___msx_dist_menu_rom, MENU_COPY_SIZE);
-    offset += MENU_COPY_SIZE;
-
-    // Drop in the generated configuration block (ROM metadata + offsets).
-    memcpy(combined_buffer + offset, config_buffer, CONFIG_AREA_SIZE);
-    offset += CONFIG_AREA_SIZE;
-
 #ifdef DEBUG
-    {
-        const char *rom_dump_filename = "multirom.rom";
-        FILE *rom_dump = fopen(rom_dump_filename, "wb");
-        if (!rom_dump) {
-            printf("DEBUG: Failed to open %s for menu dump\n", rom_dump_filename);
-        } else {
-            size_t rom_bytes_written = fwrite(combined_buffer + firmware_size, 1,
-                                             MENU_COPY_SIZE + CONFIG_AREA_SIZE, rom_dump);
-            if (rom_bytes_written != (MENU_COPY_SIZE + CONFIG_AREA_SIZE)) {
-                printf("DEBUG: Menu dump truncated (%zu of %zu bytes)\n",
-                       rom_bytes_written, (size_t)(MENU_COPY_SIZE + CONFIG_AREA_SIZE));
-            } else {
-                printf("DEBUG: Wrote %zu bytes to %s\n",
-                       rom_bytes_written, rom_dump_filename);
-            }
-            fclose(rom_dump);
-        }
+    uf2.rom_dump = fopen("multirom.rom", "wb");
+    uf2.rom_dump_start = firmware_size;
+    if (!uf2.rom_dump) {
+        printf("DEBUG: Failed to open multirom.rom for menu dump\n");
     }
 #endif
 
+    // The embedded Pico firmware blob.
+    uf2_write(&uf2, ___pico_multirom_build_multirom_bin, firmware_size);
+
+    // The portion of the MSX menu ROM that precedes the dynamic configuration structure.
+    uf2_write(&uf2, ___msx_dist_menu_rom, MENU_COPY_SIZE);
+
+    // The generated configuration area (header, ROM records and names), up to the first ROM.
+    uf2_write(&uf2, config_buffer, config_size);
+
     if (include_nextor) {
-        memcpy(combined_buffer + offset, ___nextor_dist_nextor_rom, nextor_rom_size);
-        offset += nextor_rom_size;
+        uf2_write(&uf2, ___nextor_dist_nextor_rom, nextor_rom_size);
     }
 
-    uint8_t io_buffer[4096];
-    // Append every scanned ROM in discovery order right after the Nextor payload.
-    for (int i = 0; i < file_count; i++) {
-        FILE *rom_file = fopen(files[i].file_name, "rb");
-        if (!rom_file) {
-            printf("Failed to open ROM file %s\n", files[i].file_name);
-            free(combined_buffer);
-            free(config_buffer);
-            return 1;
+    // Every scanned ROM in discovery order right after the Nextor payload, the offsets of the segment tables are from
+    // the first ROM until now
+    const char *unreadable = NULL;
+    for (int i = 0; i < stored_count && !unreadable; i++) {
+        if (!write_rom(&uf2, &files[i], rom_start, lz)) {
+            unreadable = files[i].file_name;
         }
-
-        size_t bytes_read;
-        while ((bytes_read = fread(io_buffer, 1, sizeof(io_buffer), rom_file)) > 0) {
-            memcpy(combined_buffer + offset, io_buffer, bytes_read);
-            offset += bytes_read;
-        }
-
-        fclose(rom_file);
     }
+    free(lz);
 
     // Final sanity check
-    if (offset != total_size) {
-        printf("Warning: combined buffer size mismatch (expected %zu, got %zu)\n", total_size, offset);
+    if (!unreadable && uf2.offset != total_size) {
+        printf("Warning: image size mismatch (expected %zu, got %zu)\n", total_size, uf2.offset);
     }
 
-    create_uf2_file(combined_buffer, offset, uf2_output_filename); // Create the UF2 file
+    bool const written = !unreadable && uf2_close(&uf2, uf2_output_filename);
+    if (unreadable) {
+        printf("\n%s changed or cannot be read anymore, %s not written\n", unreadable, uf2_output_filename);
+        fclose(uf2.file);
+        remove(uf2_output_filename);
+    }
+    printf("Built in %.2f seconds with %d thread%s, %d of %d mappers from %s, %d ROMs from the ROM database\n",
+           now_seconds() - build_start, threads, (threads == 1) ? "" : "s", cached_count, file_count, CACHE_FILENAME,
+           known_count);
 
     // Clean up and exit
-    free(combined_buffer);
     free(config_buffer);
-    return 0;
+    free_files(files, file_count);
+    return written ? 0 : 1;
 }
\ No newline at end of file
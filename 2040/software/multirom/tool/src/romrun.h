@@ -0,0 +1,897 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// romrun.h - Mapper detection by booting the ROM on a small Z80 interpreter
+//
+// The opcode scan of detect_rom_type() only sees the "ld (nnnn),a" bank switches of the first 128KB. Here the ROM is
+// started the way the BIOS starts a cartridge (INIT entry of the "AB" header, page 1 and 2 on the cartridge, page 3 on
+// RAM) once for each bank switching mapper of the firmware, with the bank registers of that mapper (the decode of
+// mapper.h in the firmware). Every write to the cartridge pages is counted, whatever the instruction that makes it:
+// a write the mapper decodes as a bank register scores, a bank past the end of the ROM or a write to ROM costs. Booted
+// on the wrong mapper a ROM soon runs garbage and writes to ROM, on the right one it keeps switching banks cleanly, so
+// the best score names the mapper. Ties go to the mapper with fewer bank registers.
+//
+// The BIOS is a stub: the entry points return at once (the keyboard and joystick report nothing pressed), the VDP
+// interrupt runs the H.KEYI and H.TIMI hooks every frame, and a ROM whose INIT returns is resumed through H.STKE with
+// the interrupts on, as the BIOS does. I/O reads return idle values and writes are dropped. The run is bounded in
+// instructions, a ROM costs a few milliseconds.
+//
+// This file is shared as-is by the multirom tools of the RP2040 and RP2350.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef ROMRUN_H
+#define ROMRUN_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ROMRUN_STEPS            1000000     // Instructions run on each candidate mapper
+#define ROMRUN_FRAME            17000       // Instructions between two VDP interrupts, about a frame at 3.58MHz
+#define ROMRUN_MAX_WRITES       64          // Cartridge writes enough to score a candidate
+#define ROMRUN_ROM_WRITE_COST   4           // Score lost by a write to ROM
+#define ROMRUN_MIN_SCORE        3           // Score a mapper needs, a bank switch or two is no evidence
+#define ROMRUN_ISR              0x3F00      // BIOS stub routines, in the page 0 stub
+#define ROMRUN_DCOMPR           0x3F40
+#define ROMRUN_CALLF            0x3F48
+#define ROMRUN_RESUME           0x3F50      // Where a returning INIT goes: H.STKE, then idle with the interrupts on
+
+#define ROMRUN_FLAG_C           0x01
+#define ROMRUN_FLAG_N           0x02
+#define ROMRUN_FLAG_PV          0x04
+#define ROMRUN_FLAG_H           0x10
+#define ROMRUN_FLAG_Z           0x40
+#define ROMRUN_FLAG_S           0x80
+
+// Candidates (mapper codes of the tool), in tie-break order: ASCII16, Konami, ASCII8, Konami SCC
+static const uint8_t romrun_candidates[] = { 6, 7, 5, 3 };
+#define ROMRUN_CANDIDATES       (sizeof(romrun_candidates) / sizeof(romrun_candidates[0]))
+
+typedef struct {
+    const uint8_t *rom;
+    uint32_t size;
+    uint8_t mapper;             // Candidate being run
+    uint32_t segments[4];       // 8KB ROM segment on each page of 4000h-BFFFh
+    uint8_t bank_registers[4];  // Last value written to each bank register
+    uint8_t bios[0x4000];       // Page 0, the BIOS stub
+    uint8_t ram[0x4000];        // Page 3
+    uint8_t reg[8];             // B, C, D, E, H, L, (unused), A
+    uint8_t f;
+    uint16_t af2, bc2, de2, hl2;
+    uint16_t ix, iy, sp, pc;
+    uint16_t *index;            // IX or IY for a DD or FD prefixed instruction, NULL otherwise
+    uint8_t i, r, im;
+    bool iff1, iff2, halted;
+    bool idle;                  // The last instruction jumped to itself, a loop only an interrupt leaves
+    uint8_t vdp_status;
+    uint32_t reg_writes;        // Writes decoded as a bank register
+    uint32_t range_errors;      // Of them, banks past the end of the ROM
+    uint32_t rom_writes;        // Writes to the cartridge pages that are not a bank register
+} RomRun;
+
+// Index of a register in reg, the r table of the opcodes (6 being the (HL) operand)
+enum {
+    ROMRUN_REG_B, ROMRUN_REG_C, ROMRUN_REG_D, ROMRUN_REG_E, ROMRUN_REG_H, ROMRUN_REG_L, ROMRUN_REG_HL, ROMRUN_REG_A
+};
+
+static inline uint8_t romrun_read(const RomRun *z, uint16_t addr) {
+    if (addr < 0x4000) {
+        return z->bios[addr];
+    }
+    if (addr >= 0xC000) {
+        return z->ram[addr - 0xC000];
+    }
+    uint32_t const offset = (z->segments[(addr >> 13) - 2] << 13) | (addr & 0x1FFF);
+    return (offset < z->size) ? z->rom[offset] : 0xFF;
+}
+
+// Write to the memory, the cartridge pages go through the bank registers of the candidate.
+static inline void romrun_write(RomRun *z, uint16_t addr, uint8_t value) {
+    int page = -1;
+    if (addr >= 0xC000) {
+        z->ram[addr - 0xC000] = value;
+        return;
+    }
+    if (addr < 0x4000) {
+        return;
+    }
+    switch (z->mapper) {
+        case 3:     // Konami SCC, registers on 5000h, 7000h, 9000h, B000h (2KB each), the SCC answers on 9800h
+            if ((addr & 0xF800) == 0x9800 && (z->bank_registers[2] & 0x3F) == 0x3F) {
+                return;
+            }
+            page = ((addr & 0x1800) == 0x1000) ? (addr - 0x4000) >> 13 : -1;
+            break;
+        case 7:     // Konami, registers on 6000h, 8000h, A000h
+            page = ((addr & 0x1800) == 0 && addr >= 0x6000) ? (addr - 0x4000) >> 13 : -1;
+            break;
+        case 5:     // ASCII8, registers on 6000h, 6800h, 7000h, 7800h
+            page = (addr >= 0x6000 && addr < 0x8000) ? (addr >> 11) & 3 : -1;
+            break;
+        case 6:     // ASCII16, registers on 6000h and 7000h for the two 16KB banks
+            page = (addr >= 0x6000 && addr < 0x8000 && !(addr & 0x0800)) ? ((addr >> 12) & 1) * 2 : -1;
+            break;
+    }
+    if (page < 0) {
+        z->rom_writes++;
+        return;
+    }
+    z->reg_writes++;
+    z->bank_registers[page] = value;
+    if (z->mapper == 6) {
+        z->range_errors += ((uint32_t)value << 14) >= z->size;
+        z->segments[page] = (uint32_t)value * 2;
+        z->segments[page + 1] = (uint32_t)value * 2 + 1;
+    } else {
+        z->range_errors += ((uint32_t)value << 13) >= z->size;
+        z->segments[page] = value;
+    }
+}
+
+static inline uint8_t romrun_in(RomRun *z, uint8_t port) {
+    switch (port) {
+        case 0x99:
+            z->vdp_status ^= 0x80;          // The frame flag comes and goes, the loops waiting for it end
+            return z->vdp_status;
+        case 0xA8:
+            return 0xD4;                    // Page 0 on slot 0, pages 1 and 2 on the cartridge (1), page 3 on RAM (3)
+        default:
+            return 0xFF;                    // No key, no joystick direction or button
+    }
+}
+
+static inline uint8_t romrun_fetch(RomRun *z) {
+    return romrun_read(z, z->pc++);
+}
+
+static inline uint16_t romrun_fetch16(RomRun *z) {
+    uint16_t const low = romrun_fetch(z);
+    return low | (romrun_fetch(z) << 8);
+}
+
+static inline uint16_t romrun_read16(const RomRun *z, uint16_t addr) {
+    return romrun_read(z, addr) | (romrun_read(z, (uint16_t)(addr + 1)) << 8);
+}
+
+static inline void romrun_write16(RomRun *z, uint16_t addr, uint16_t value) {
+    romrun_write(z, addr, (uint8_t)value);
+    romrun_write(z, (uint16_t)(addr + 1), (uint8_t)(value >> 8));
+}
+
+static inline void romrun_push(RomRun *z, uint16_t value) {
+    z->sp -= 2;
+    romrun_write16(z, z->sp, value);
+}
+
+static inline uint16_t romrun_pop(RomRun *z) {
+    uint16_t const value = romrun_read16(z, z->sp);
+    z->sp += 2;
+    return value;
+}
+
+static inline uint16_t romrun_pair(const RomRun *z, int high) {
+    return (z->reg[high] << 8) | z->reg[high + 1];
+}
+
+static inline void romrun_set_pair(RomRun *z, int high, uint16_t value) {
+    z->reg[high] = (uint8_t)(value >> 8);
+    z->reg[high + 1] = (uint8_t)value;
+}
+
+// HL, or IX/IY under a prefix.
+static inline uint16_t romrun_hl(const RomRun *z) {
+    return z->index ? *z->index : romrun_pair(z, ROMRUN_REG_H);
+}
+
+static inline void romrun_set_hl(RomRun *z, uint16_t value) {
+    if (z->index) {
+        *z->index = value;
+    } else {
+        romrun_set_pair(z, ROMRUN_REG_H, value);
+    }
+}
+
+// Register pair p of the rp table (BC, DE, HL, SP), or of the rp2 table (AF for SP) with af set.
+static inline uint16_t romrun_rp(const RomRun *z, int p, bool af) {
+    switch (p) {
+        case 0: return romrun_pair(z, ROMRUN_REG_B);
+        case 1: return romrun_pair(z, ROMRUN_REG_D);
+        case 2: return romrun_hl(z);
+        default: return af ? (uint16_t)((z->reg[ROMRUN_REG_A] << 8) | z->f) : z->sp;
+    }
+}
+
+static inline void romrun_set_rp(RomRun *z, int p, bool af, uint16_t value) {
+    switch (p) {
+        case 0: romrun_set_pair(z, ROMRUN_REG_B, value); break;
+        case 1: romrun_set_pair(z, ROMRUN_REG_D, value); break;
+        case 2: romrun_set_hl(z, value); break;
+        default:
+            if (af) {
+                z->reg[ROMRUN_REG_A] = (uint8_t)(value >> 8);
+                z->f = (uint8_t)value;
+            } else {
+                z->sp = value;
+            }
+            break;
+    }
+}
+
+// Address of the (HL) operand, (IX+d) or (IY+d) under a prefix.
+static inline uint16_t romrun_operand(RomRun *z) {
+    if (z->index) {
+        return (uint16_t)(*z->index + (int8_t)romrun_fetch(z));
+    }
+    return romrun_pair(z, ROMRUN_REG_H);
+}
+
+// Register n of the r table; H and L are IXH/IXL (IYH/IYL) under a prefix unless the instruction has a memory operand.
+static inline uint8_t romrun_get(const RomRun *z, int n, bool plain) {
+    if (z->index && !plain && (n == ROMRUN_REG_H || n == ROMRUN_REG_L)) {
+        return (n == ROMRUN_REG_H) ? (uint8_t)(*z->index >> 8) : (uint8_t)*z->index;
+    }
+    return z->reg[n];
+}
+
+static inline void romrun_set(RomRun *z, int n, bool plain, uint8_t value) {
+    if (z->index && !plain && (n == ROMRUN_REG_H || n == ROMRUN_REG_L)) {
+        *z->index = (n == ROMRUN_REG_H) ? (uint16_t)((*z->index & 0x00FF) | (value << 8)) :
+                                      (uint16_t)((*z->index & 0xFF00) | value);
+    } else {
+        z->reg[n] = value;
+    }
+}
+
+static inline uint8_t romrun_sz(uint8_t value) {
+    return (value & ROMRUN_FLAG_S) | (value ? 0 : ROMRUN_FLAG_Z);
+}
+
+static inline uint8_t romrun_szp(uint8_t value) {
+    uint8_t parity = value ^ (value >> 4);
+    parity ^= parity >> 2;
+    parity ^= parity >> 1;
+    return romrun_sz(value) | ((parity & 1) ? 0 : ROMRUN_FLAG_PV);
+}
+
+static inline bool romrun_condition(const RomRun *z, int cc) {
+    static const uint8_t flags[4] = { ROMRUN_FLAG_Z, ROMRUN_FLAG_C, ROMRUN_FLAG_PV, ROMRUN_FLAG_S };
+    bool const set = (z->f & flags[cc >> 1]) != 0;
+    return (cc & 1) ? set : !set;
+}
+
+// ADD, ADC, SUB, SBC, AND, XOR, OR, CP
+static inline void romrun_alu(RomRun *z, int op, uint8_t value) {
+    uint8_t const a = z->reg[ROMRUN_REG_A];
+    unsigned result;
+    switch (op) {
+        case 0:
+        case 1:
+            result = a + value + ((op == 1) ? (z->f & ROMRUN_FLAG_C) : 0);
+            z->f = romrun_sz((uint8_t)result) | ((a ^ value ^ result) & ROMRUN_FLAG_H) |
+                   ((~(a ^ value) & (a ^ result) & 0x80) ? ROMRUN_FLAG_PV : 0) | ((result >> 8) & ROMRUN_FLAG_C);
+            z->reg[ROMRUN_REG_A] = (uint8_t)result;
+            break;
+        case 2:
+        case 3:
+        case 7:
+            result = a - value - ((op == 3) ? (z->f & ROMRUN_FLAG_C) : 0);
+            z->f = romrun_sz((uint8_t)result) | ((a ^ value ^ result) & ROMRUN_FLAG_H) | ROMRUN_FLAG_N |
+                   (((a ^ value) & (a ^ result) & 0x80) ? ROMRUN_FLAG_PV : 0) | ((result >> 8) & ROMRUN_FLAG_C);
+            if (op != 7) {
+                z->reg[ROMRUN_REG_A] = (uint8_t)result;
+            }
+            break;
+        case 4:
+            z->reg[ROMRUN_REG_A] = a & value;
+            z->f = romrun_szp(z->reg[ROMRUN_REG_A]) | ROMRUN_FLAG_H;
+            break;
+        case 5:
+            z->reg[ROMRUN_REG_A] = a ^ value;
+            z->f = romrun_szp(z->reg[ROMRUN_REG_A]);
+            break;
+        default:
+            z->reg[ROMRUN_REG_A] = a | value;
+            z->f = romrun_szp(z->reg[ROMRUN_REG_A]);
+            break;
+    }
+}
+
+// RLC, RRC, RL, RR, SLA, SRA, SLL, SRL
+static inline uint8_t romrun_rotate(RomRun *z, int op, uint8_t value) {
+    uint8_t result;
+    uint8_t carry;
+    switch (op) {
+        case 0: carry = value >> 7; result = (uint8_t)((value << 1) | carry); break;
+        case 1: carry = value & 1; result = (uint8_t)((value >> 1) | (carry << 7)); break;
+        case 2: carry = value >> 7; result = (uint8_t)((value << 1) | (z->f & ROMRUN_FLAG_C)); break;
+        case 3: carry = value & 1; result = (uint8_t)((value >> 1) | ((z->f & ROMRUN_FLAG_C) << 7)); break;
+        case 4: carry = value >> 7; result = (uint8_t)(value << 1); break;
+        case 5: carry = value & 1; result = (uint8_t)((value >> 1) | (value & 0x80)); break;
+        case 6: carry = value >> 7; result = (uint8_t)((value << 1) | 1); break;
+        default: carry = value & 1; result = value >> 1; break;
+    }
+    z->f = romrun_szp(result) | carry;
+    return result;
+}
+
+static inline uint8_t romrun_inc(RomRun *z, uint8_t value) {
+    uint8_t const result = value + 1;
+    z->f = (z->f & ROMRUN_FLAG_C) | romrun_sz(result) | (((value & 0x0F) == 0x0F) ? ROMRUN_FLAG_H : 0) |
+           ((value == 0x7F) ? ROMRUN_FLAG_PV : 0);
+    return result;
+}
+
+static inline uint8_t romrun_dec(RomRun *z, uint8_t value) {
+    uint8_t const result = value - 1;
+    z->f = (z->f & ROMRUN_FLAG_C) | ROMRUN_FLAG_N | romrun_sz(result) | (((value & 0x0F) == 0) ? ROMRUN_FLAG_H : 0) |
+           ((value == 0x80) ? ROMRUN_FLAG_PV : 0);
+    return result;
+}
+
+static inline void romrun_daa(RomRun *z) {
+    uint8_t const a = z->reg[ROMRUN_REG_A];
+    uint8_t correction = 0;
+    uint8_t carry = z->f & ROMRUN_FLAG_C;
+    if ((z->f & ROMRUN_FLAG_H) || (a & 0x0F) > 9) {
+        correction = 0x06;
+    }
+    if (carry || a > 0x99) {
+        correction |= 0x60;
+        carry = ROMRUN_FLAG_C;
+    }
+    uint8_t const result = (z->f & ROMRUN_FLAG_N) ? a - correction : a + correction;
+    z->f = romrun_szp(result) | carry | (z->f & ROMRUN_FLAG_N) | ((a ^ result) & ROMRUN_FLAG_H);
+    z->reg[ROMRUN_REG_A] = result;
+}
+
+// ADC HL,rr and SBC HL,rr
+static inline void romrun_adc16(RomRun *z, uint16_t value, bool subtract) {
+    uint16_t const hl = romrun_pair(z, ROMRUN_REG_H);
+    uint32_t const carry = z->f & ROMRUN_FLAG_C;
+    uint32_t const result = subtract ? (uint32_t)hl - value - carry : (uint32_t)hl + value + carry;
+    bool const overflow = subtract ? ((hl ^ value) & (hl ^ result) & 0x8000) != 0 :
+                                     (~(hl ^ value) & (hl ^ result) & 0x8000) != 0;
+    z->f = ((result >> 8) & ROMRUN_FLAG_S) | (((uint16_t)result == 0) ? ROMRUN_FLAG_Z : 0) |
+           (((hl ^ value ^ result) >> 8) & ROMRUN_FLAG_H) | (overflow ? ROMRUN_FLAG_PV : 0) |
+           (subtract ? ROMRUN_FLAG_N : 0) | ((result >> 16) & ROMRUN_FLAG_C);
+    romrun_set_pair(z, ROMRUN_REG_H, (uint16_t)result);
+}
+
+// CB prefixed instruction, at the DDCB/FDCB form the displacement comes before the opcode.
+static inline void romrun_cb(RomRun *z) {
+    uint16_t const addr = romrun_operand(z);
+    uint8_t const op = romrun_fetch(z);
+    int const x = op >> 6;
+    int const y = (op >> 3) & 7;
+    int const n = op & 7;
+    bool const memory = z->index || n == ROMRUN_REG_HL;
+    uint8_t const value = memory ? romrun_read(z, addr) : z->reg[n];
+    uint8_t result;
+
+    switch (x) {
+        case 0:
+            result = romrun_rotate(z, y, value);
+            break;
+        case 1:
+            z->f = (z->f & ROMRUN_FLAG_C) | ROMRUN_FLAG_H | ((value & (1 << y)) ? 0 : ROMRUN_FLAG_Z | ROMRUN_FLAG_PV) |
+                   ((y == 7 && (value & 0x80)) ? ROMRUN_FLAG_S : 0);
+            return;
+        case 2:
+            result = value & (uint8_t)~(1 << y);
+            break;
+        default:
+            result = value | (uint8_t)(1 << y);
+            break;
+    }
+    if (memory) {
+        romrun_write(z, addr, result);
+    }
+    if (n != ROMRUN_REG_HL) {
+        z->reg[n] = result;         // Also the register of an indexed form
+    }
+}
+
+// ED prefixed instruction.
+static inline void romrun_ed(RomRun *z) {
+    uint8_t const op = romrun_fetch(z);
+    int const x = op >> 6;
+    int const y = (op >> 3) & 7;
+    int const n = op & 7;
+    int const p = y >> 1;
+    bool const q = y & 1;
+
+    z->index = NULL;                // ED instructions ignore a DD/FD prefix
+    if (x == 1) {
+        switch (n) {
+            case 0: {
+                uint8_t const value = romrun_in(z, z->reg[ROMRUN_REG_C]);
+                if (y != ROMRUN_REG_HL) {
+                    z->reg[y] = value;
+                }
+                z->f = (z->f & ROMRUN_FLAG_C) | romrun_szp(value);
+                break;
+            }
+            case 1:
+                break;              // OUT (C),r
+            case 2:
+                romrun_adc16(z, romrun_rp(z, p, false), !q);
+                break;
+            case 3: {
+                uint16_t const addr = romrun_fetch16(z);
+                if (q) {
+                    romrun_set_rp(z, p, false, romrun_read16(z, addr));
+                } else {
+                    romrun_write16(z, addr, romrun_rp(z, p, false));
+                }
+                break;
+            }
+            case 4: {
+                uint8_t const a = z->reg[ROMRUN_REG_A];
+                z->reg[ROMRUN_REG_A] = 0;
+                romrun_alu(z, 2, a);
+                break;
+            }
+            case 5:
+                z->iff1 = z->iff2;
+                z->pc = romrun_pop(z);
+                break;
+            case 6:
+                z->im = (y & 3) ? (y & 3) - 1 : 0;
+                break;
+            default:
+                switch (y) {
+                    case 0: z->i = z->reg[ROMRUN_REG_A]; break;
+                    case 1: z->r = z->reg[ROMRUN_REG_A]; break;
+                    case 2:
+                    case 3:
+                        z->reg[ROMRUN_REG_A] = (y == 2) ? z->i : z->r;
+                        z->f = (z->f & ROMRUN_FLAG_C) | romrun_sz(z->reg[ROMRUN_REG_A]) |
+                               (z->iff2 ? ROMRUN_FLAG_PV : 0);
+                        break;
+                    case 4:
+                    case 5: {
+                        uint16_t const addr = romrun_pair(z, ROMRUN_REG_H);
+                        uint8_t const value = romrun_read(z, addr);
+                        uint8_t const a = z->reg[ROMRUN_REG_A];
+                        if (y == 4) {   // RRD
+                            romrun_write(z, addr, (uint8_t)((a << 4) | (value >> 4)));
+                            z->reg[ROMRUN_REG_A] = (a & 0xF0) | (value & 0x0F);
+                        } else {        // RLD
+                            romrun_write(z, addr, (uint8_t)((value << 4) | (a & 0x0F)));
+                            z->reg[ROMRUN_REG_A] = (a & 0xF0) | (value >> 4);
+                        }
+                        z->f = (z->f & ROMRUN_FLAG_C) | romrun_szp(z->reg[ROMRUN_REG_A]);
+                        break;
+                    }
+                    default:
+                        break;
+                }
+                break;
+        }
+    } else if (x == 2 && y >= 4 && n <= 3) {
+        // Block instructions, a repeating one runs again until done (one pass per instruction)
+        int const step = (y & 1) ? -1 : 1;
+        bool const repeat = y >= 6;
+        uint16_t hl = romrun_pair(z, ROMRUN_REG_H);
+        uint16_t bc = romrun_pair(z, ROMRUN_REG_B);
+        bool again = false;
+        switch (n) {
+            case 0: {
+                uint16_t const de = romrun_pair(z, ROMRUN_REG_D);
+                romrun_write(z, de, romrun_read(z, hl));
+                romrun_set_pair(z, ROMRUN_REG_D, (uint16_t)(de + step));
+                bc--;
+                z->f = (z->f & (ROMRUN_FLAG_S | ROMRUN_FLAG_Z | ROMRUN_FLAG_C)) | (bc ? ROMRUN_FLAG_PV : 0);
+                again = bc != 0;
+                break;
+            }
+            case 1: {
+                uint8_t const a = z->reg[ROMRUN_REG_A];
+                uint8_t const value = romrun_read(z, hl);
+                uint8_t const result = a - value;
+                bc--;
+                z->f = (z->f & ROMRUN_FLAG_C) | ROMRUN_FLAG_N | romrun_sz(result) |
+                       ((a ^ value ^ result) & ROMRUN_FLAG_H) | (bc ? ROMRUN_FLAG_PV : 0);
+                again = bc != 0 && result != 0;
+                break;
+            }
+            default:
+                if (n == 2) {
+                    romrun_write(z, hl, romrun_in(z, z->reg[ROMRUN_REG_C]));
+                }
+                bc = (uint16_t)(bc - 0x100);    // B counts the bytes
+                z->f = ROMRUN_FLAG_N | romrun_sz((uint8_t)(bc >> 8));
+                again = (bc >> 8) != 0;
+                break;
+        }
+        romrun_set_pair(z, ROMRUN_REG_H, (uint16_t)(hl + step));
+        romrun_set_pair(z, ROMRUN_REG_B, bc);
+        if (repeat && again) {
+            z->pc -= 2;
+        }
+    }
+}
+
+// Run one instruction.
+static inline void romrun_step(RomRun *z) {
+    uint8_t op = romrun_fetch(z);
+    z->r = (z->r & 0x80) | ((z->r + 1) & 0x7F);
+    z->index = NULL;
+    while (op == 0xDD || op == 0xFD) {
+        z->index = (op == 0xDD) ? &z->ix : &z->iy;
+        op = romrun_fetch(z);
+    }
+
+    int const x = op >> 6;
+    int const y = (op >> 3) & 7;
+    int const n = op & 7;
+    int const p = y >> 1;
+    bool const q = y & 1;
+
+    switch (x) {
+        case 0:
+            switch (n) {
+                case 0:
+                    if (y == 1) {
+                        uint16_t const af = romrun_rp(z, 3, true);
+                        romrun_set_rp(z, 3, true, z->af2);
+                        z->af2 = af;
+                    } else if (y >= 2) {
+                        int8_t const offset = (int8_t)romrun_fetch(z);
+                        bool jump = true;
+                        if (y == 2) {
+                            jump = --z->reg[ROMRUN_REG_B] != 0;
+                        } else if (y >= 4) {
+                            jump = romrun_condition(z, y - 4);
+                        }
+                        if (jump) {
+                            z->pc = (uint16_t)(z->pc + offset);
+                            z->idle = offset == -2;
+                        }
+                    }
+                    break;
+                case 1:
+                    if (q) {
+                        uint16_t const hl = romrun_hl(z);
+                        uint16_t const value = romrun_rp(z, p, false);
+                        uint32_t const result = (uint32_t)hl + value;
+                        z->f = (z->f & (ROMRUN_FLAG_S | ROMRUN_FLAG_Z | ROMRUN_FLAG_PV)) |
+                               (((hl ^ value ^ result) >> 8) & ROMRUN_FLAG_H) | ((result >> 16) & ROMRUN_FLAG_C);
+                        romrun_set_hl(z, (uint16_t)result);
+                    } else {
+                        romrun_set_rp(z, p, false, romrun_fetch16(z));
+                    }
+                    break;
+                case 2: {
+                    uint16_t const addr = (p == 0) ? romrun_pair(z, ROMRUN_REG_B) :
+                                          (p == 1) ? romrun_pair(z, ROMRUN_REG_D) : romrun_fetch16(z);
+                    if (p == 2) {
+                        if (q) {
+                            romrun_set_hl(z, romrun_read16(z, addr));
+                        } else {
+                            romrun_write16(z, addr, romrun_hl(z));
+                        }
+                    } else if (q) {
+                        z->reg[ROMRUN_REG_A] = romrun_read(z, addr);
+                    } else {
+                        romrun_write(z, addr, z->reg[ROMRUN_REG_A]);
+                    }
+                    break;
+                }
+                case 3:
+                    romrun_set_rp(z, p, false, (uint16_t)(romrun_rp(z, p, false) + (q ? -1 : 1)));
+                    break;
+                case 4:
+                case 5:
+                    if (y == ROMRUN_REG_HL) {
+                        uint16_t const addr = romrun_operand(z);
+                        uint8_t const value = romrun_read(z, addr);
+                        romrun_write(z, addr, (n == 4) ? romrun_inc(z, value) : romrun_dec(z, value));
+                    } else {
+                        uint8_t const value = romrun_get(z, y, false);
+                        romrun_set(z, y, false, (n == 4) ? romrun_inc(z, value) : romrun_dec(z, value));
+                    }
+                    break;
+                case 6:
+                    if (y == ROMRUN_REG_HL) {
+                        uint16_t const addr = romrun_operand(z);
+                        romrun_write(z, addr, romrun_fetch(z));
+                    } else {
+                        romrun_set(z, y, false, romrun_fetch(z));
+                    }
+                    break;
+                default: {
+                    uint8_t const a = z->reg[ROMRUN_REG_A];
+                    uint8_t const keep = z->f & (ROMRUN_FLAG_S | ROMRUN_FLAG_Z | ROMRUN_FLAG_PV);
+                    uint8_t const carry = z->f & ROMRUN_FLAG_C;
+                    switch (y) {
+                        case 0:     // RLCA
+                            z->reg[ROMRUN_REG_A] = (uint8_t)((a << 1) | (a >> 7));
+                            z->f = keep | (a >> 7);
+                            break;
+                        case 1:     // RRCA
+                            z->reg[ROMRUN_REG_A] = (uint8_t)((a >> 1) | (a << 7));
+                            z->f = keep | (a & 1);
+                            break;
+                        case 2:     // RLA
+                            z->reg[ROMRUN_REG_A] = (uint8_t)((a << 1) | carry);
+                            z->f = keep | (a >> 7);
+                            break;
+                        case 3:     // RRA
+                            z->reg[ROMRUN_REG_A] = (uint8_t)((a >> 1) | (carry << 7));
+                            z->f = keep | (a & 1);
+                            break;
+                        case 4:
+                            romrun_daa(z);
+                            break;
+                        case 5:     // CPL
+                            z->reg[ROMRUN_REG_A] = ~a;
+                            z->f |= ROMRUN_FLAG_H | ROMRUN_FLAG_N;
+                            break;
+                        case 6:     // SCF
+                            z->f = keep | ROMRUN_FLAG_C;
+                            break;
+                        default:    // CCF
+                            z->f = keep | (carry ? ROMRUN_FLAG_H : ROMRUN_FLAG_C);
+                            break;
+                    }
+                    break;
+                }
+            }
+            break;
+        case 1:
+            if (y == ROMRUN_REG_HL && n == ROMRUN_REG_HL) {
+                z->halted = true;
+                z->pc--;
+            } else if (y == ROMRUN_REG_HL) {
+                romrun_write(z, romrun_operand(z), z->reg[n]);
+            } else if (n == ROMRUN_REG_HL) {
+                z->reg[y] = romrun_read(z, romrun_operand(z));
+            } else {
+                romrun_set(z, y, false, romrun_get(z, n, false));
+            }
+            break;
+        case 2:
+            romrun_alu(z, y, (n == ROMRUN_REG_HL) ? romrun_read(z, romrun_operand(z)) : romrun_get(z, n, false));
+            break;
+        default:
+            switch (n) {
+                case 0:
+                    if (romrun_condition(z, y)) {
+                        z->pc = romrun_pop(z);
+                    }
+                    break;
+                case 1:
+                    if (!q) {
+                        romrun_set_rp(z, p, true, romrun_pop(z));
+                    } else if (p == 0) {
+                        z->pc = romrun_pop(z);
+                    } else if (p == 1) {
+                        uint16_t const bc = romrun_pair(z, ROMRUN_REG_B);
+                        uint16_t const de = romrun_pair(z, ROMRUN_REG_D);
+                        uint16_t const hl = romrun_pair(z, ROMRUN_REG_H);
+                        romrun_set_pair(z, ROMRUN_REG_B, z->bc2);
+                        romrun_set_pair(z, ROMRUN_REG_D, z->de2);
+                        romrun_set_pair(z, ROMRUN_REG_H, z->hl2);
+                        z->bc2 = bc;
+                        z->de2 = de;
+                        z->hl2 = hl;
+                    } else if (p == 2) {
+                        z->pc = romrun_hl(z);
+                    } else {
+                        z->sp = romrun_hl(z);
+                    }
+                    break;
+                case 2: {
+                    uint16_t const addr = romrun_fetch16(z);
+                    if (romrun_condition(z, y)) {
+                        z->pc = addr;
+                    }
+                    break;
+                }
+                case 3:
+                    switch (y) {
+                        case 0: {
+                            uint16_t const start = z->pc - 1;
+                            z->pc = romrun_fetch16(z);
+                            z->idle = z->pc == start;
+                            break;
+                        }
+                        case 1: romrun_cb(z); break;
+                        case 2: romrun_fetch(z); break;     // OUT (n),A
+                        case 3: z->reg[ROMRUN_REG_A] = romrun_in(z, romrun_fetch(z)); break;
+                        case 4: {
+                            uint16_t const value = romrun_read16(z, z->sp);
+                            romrun_write16(z, z->sp, romrun_hl(z));
+                            romrun_set_hl(z, value);
+                            break;
+                        }
+                        case 5: {
+                            uint16_t const de = romrun_pair(z, ROMRUN_REG_D);
+                            romrun_set_pair(z, ROMRUN_REG_D, romrun_pair(z, ROMRUN_REG_H));
+                            romrun_set_pair(z, ROMRUN_REG_H, de);
+                            break;
+                        }
+                        case 6: z->iff1 = z->iff2 = false; break;
+                        default: z->iff1 = z->iff2 = true; break;
+                    }
+                    break;
+                case 4: {
+                    uint16_t const addr = romrun_fetch16(z);
+                    if (romrun_condition(z, y)) {
+                        romrun_push(z, z->pc);
+                        z->pc = addr;
+                    }
+                    break;
+                }
+                case 5:
+                    if (!q) {
+                        romrun_push(z, romrun_rp(z, p, true));
+                    } else if (p == 0) {
+                        uint16_t const addr = romrun_fetch16(z);
+                        romrun_push(z, z->pc);
+                        z->pc = addr;
+                    } else if (p == 2) {
+                        romrun_ed(z);
+                    }
+                    break;
+                case 6:
+                    romrun_alu(z, y, romrun_fetch(z));
+                    break;
+                default:
+                    romrun_push(z, z->pc);
+                    z->pc = (uint16_t)(y * 8);
+                    break;
+            }
+            break;
+    }
+}
+
+// Take the VDP interrupt if it is enabled.
+static inline void romrun_interrupt(RomRun *z) {
+    if (!z->iff1) {
+        return;
+    }
+    if (z->halted) {
+        z->halted = false;
+        z->pc++;
+    }
+    z->iff1 = z->iff2 = false;
+    romrun_push(z, z->pc);
+    z->pc = (z->im == 2) ? romrun_read16(z, (uint16_t)((z->i << 8) | 0xFF)) : 0x0038;
+}
+
+// Copy a BIOS stub routine.
+static inline void romrun_stub(RomRun *z, uint16_t addr, const uint8_t *code, size_t length) {
+    memcpy(&z->bios[addr], code, length);
+}
+
+// Set up the machine for a candidate mapper, at the INIT entry of the ROM. False when the ROM has no INIT entry.
+static inline bool romrun_boot(RomRun *z, const uint8_t *rom, uint32_t size, uint8_t mapper) {
+    static const uint8_t isr[] = {
+        0xF5, 0xC5, 0xD5, 0xE5, 0x08, 0xD9, 0xF5, 0xC5, 0xD5, 0xE5, 0xDD, 0xE5, 0xFD, 0xE5,   // Save every register
+        0xCD, 0x9A, 0xFD,                                                                   // call H.KEYI
+        0xDB, 0x99,                                                                         // in a,(99h)
+        0xCD, 0x9F, 0xFD,                                                                   // call H.TIMI
+        0x2A, 0x9E, 0xFC, 0x23, 0x22, 0x9E, 0xFC,                                           // JIFFY + 1
+        0xFD, 0xE1, 0xDD, 0xE1, 0xE1, 0xD1, 0xC1, 0xF1, 0xD9, 0x08, 0xE1, 0xD1, 0xC1, 0xF1,
+        0xFB, 0xC9,                                                                         // ei, ret
+    };
+    static const uint8_t dcompr[] = { 0x7C, 0x92, 0xC0, 0x7D, 0x93, 0xC9 };     // Compare HL with DE
+    static const uint8_t callf[] = { 0xE3, 0x23, 0x23, 0x23, 0xE3, 0xC9 };      // Skip the slot and address bytes
+    static const uint8_t resume[] = { 0xFB, 0xCD, 0xDA, 0xFE, 0x76, 0x18, 0xFD }; // ei, call H.STKE, halt forever
+    static const uint8_t none[] = { 0xAF, 0xC9 };                               // xor a (0, Z set), ret
+    static const uint8_t all_ones[] = { 0x3E, 0xFF, 0xC9 };                     // ld a,0FFh, ret
+
+    if (size < 4 || rom[0] != 'A' || rom[1] != 'B') {
+        return false;
+    }
+    uint16_t const init = rom[2] | (rom[3] << 8);
+    if (init < 0x4000 || init >= 0xC000) {
+        return false;
+    }
+
+    memset(z, 0, sizeof(*z));
+    z->rom = rom;
+    z->size = size;
+    z->mapper = mapper;
+    for (int page = 0; page < 4; page++) {
+        z->segments[page] = page;       // The power-on layout of every candidate, the first 32KB on 4000h-BFFFh
+        z->bank_registers[page] = (uint8_t)page;
+    }
+
+    memset(z->bios, 0xC9, sizeof(z->bios));     // Every entry point returns
+    z->bios[0x0006] = 0x98;                     // VDP ports
+    z->bios[0x0007] = 0x98;
+    z->bios[0x002B] = 0x91;                     // Japanese character set, 60Hz
+    z->bios[0x002D] = 0x01;                     // MSX2
+    z->bios[0x0020] = 0xC3;                     // DCOMPR
+    z->bios[0x0021] = ROMRUN_DCOMPR & 0xFF;
+    z->bios[0x0022] = ROMRUN_DCOMPR >> 8;
+    z->bios[0x0030] = 0xC3;                     // CALLF
+    z->bios[0x0031] = ROMRUN_CALLF & 0xFF;
+    z->bios[0x0032] = ROMRUN_CALLF >> 8;
+    z->bios[0x0038] = 0xC3;                     // Interrupt
+    z->bios[0x0039] = ROMRUN_ISR & 0xFF;
+    z->bios[0x003A] = ROMRUN_ISR >> 8;
+    romrun_stub(z, 0x0096, all_ones, sizeof(all_ones));     // RDPSG
+    romrun_stub(z, 0x009C, none, sizeof(none));             // CHSNS
+    z->bios[0x009F] = 0x3E;                                 // CHGET answers Return
+    z->bios[0x00A0] = 0x0D;
+    romrun_stub(z, 0x00D5, none, sizeof(none));             // GTSTCK
+    romrun_stub(z, 0x00D8, none, sizeof(none));             // GTTRIG
+    romrun_stub(z, 0x00DB, none, sizeof(none));             // GTPAD
+    romrun_stub(z, 0x00DE, none, sizeof(none));             // GTPDL
+    z->bios[0x0138] = 0x3E;                                 // RSLREG
+    z->bios[0x0139] = 0xD4;
+    z->bios[0x013E] = 0x3E;                                 // RDVDP
+    z->bios[0x013F] = 0x80;
+    romrun_stub(z, 0x0141, all_ones, sizeof(all_ones));     // SNSMAT
+    romrun_stub(z, ROMRUN_ISR, isr, sizeof(isr));
+    romrun_stub(z, ROMRUN_DCOMPR, dcompr, sizeof(dcompr));
+    romrun_stub(z, ROMRUN_CALLF, callf, sizeof(callf));
+    romrun_stub(z, ROMRUN_RESUME, resume, sizeof(resume));
+    memset(&z->ram[0xFD9A - 0xC000], 0xC9, 0xFFCA - 0xFD9A);   // Hooks
+
+    z->sp = 0xF380;
+    romrun_push(z, ROMRUN_RESUME);
+    z->pc = init;
+    z->im = 1;
+    z->f = ROMRUN_FLAG_Z;
+    return true;
+}
+
+// Run the ROM until enough cartridge writes are seen, the instruction budget is spent or the CPU stops for good (a
+// HALT or a jump to itself with the interrupts off).
+static inline void romrun_execute(RomRun *z) {
+    uint32_t next_frame = ROMRUN_FRAME;
+    for (uint32_t steps = 0; steps < ROMRUN_STEPS && z->reg_writes + z->rom_writes < ROMRUN_MAX_WRITES; ) {
+        if (steps >= next_frame) {
+            next_frame += ROMRUN_FRAME;
+            romrun_interrupt(z);
+        }
+        if (z->halted || z->idle) {
+            if (!z->iff1) {
+                break;
+            }
+            z->idle = false;
+            steps = next_frame;         // Sleep until the next interrupt
+            continue;
+        }
+        romrun_step(z);
+        steps++;
+    }
+}
+
+// Detect the mapper of a ROM by running it on each candidate.
+// Returns the mapper code (3 Konami SCC, 5 ASCII8, 6 ASCII16, 7 Konami), 0 when no run switched banks cleanly enough
+// (no INIT entry, too few bank switches, or too many writes to ROM on every candidate).
+static inline uint8_t romrun_detect(const uint8_t *rom, uint32_t size) {
+    RomRun *z = (RomRun *)malloc(sizeof(RomRun));
+    uint8_t best = 0;
+    long best_score = ROMRUN_MIN_SCORE - 1;
+
+    if (!z) {
+        return 0;
+    }
+    for (size_t c = 0; c < ROMRUN_CANDIDATES; c++) {
+        if (!romrun_boot(z, rom, size, romrun_candidates[c])) {
+            break;
+        }
+        romrun_execute(z);
+        long const score = (long)z->reg_writes - (long)z->range_errors -
+                           (long)z->rom_writes * ROMRUN_ROM_WRITE_COST;
+        if (score > best_score) {
+            best = romrun_candidates[c];
+            best_score = score;
+        }
+    }
+    free(z);
+    return best;
+}
+
+#endif
@@ -0,0 +1,162 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// romcorpus.c - Build tool writing the synthetic corpus of the mapper detection benchmark (multirom --bench)
+//
+// Writes mega ROMs whose file names carry their mapper tag, for each bank switching mapper (Konami SCC, Konami, ASCII8,
+// ASCII16), ROM size (128KB to 512KB) and way of switching the banks:
+//   abs   ld (nnnn),a from INIT, the instruction the opcode scan looks for
+//   hl    ld (hl),a from INIT
+//   ix    ld (ix+d),a from INIT
+//   hook  ld (nnnn),a from an H.TIMI hook installed by INIT, which then returns to the BIOS
+// INIT switches the pages 8000h and A000h (8000h-BFFFh for ASCII16) to one bank after another and calls the routine
+// every bank starts with. The rest of the ROM is random bytes, like compressed graphics and music.
+// multirom --bench run in the directory then compares the mappers detected with the tags.
+//
+// Usage: romcorpus <directory>
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+//
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdarg.h>
+
+#define BANK_SWITCHES           24              // Bank switches made by INIT or by each interrupt
+#define HOOK_TIMI               0xFD9F
+
+typedef struct {
+    const char *tag;        // Mapper tag of the tools
+    uint16_t registers[2];  // Bank registers of the pages 8000h and A000h
+    uint32_t bank_size;
+} Mapper;
+
+static const Mapper MAPPERS[] = {
+    { "KonSCC", { 0x9000, 0xB000 }, 8192 },
+    { "Konami", { 0x8000, 0xA000 }, 8192 },
+    { "ASC-08", { 0x7000, 0x7800 }, 8192 },
+    { "ASC-16", { 0x77FF, 0x77FF }, 16384 },
+};
+
+static const char *STYLES[] = { "abs", "hl", "ix", "hook" };
+static const uint32_t SIZES[] = { 128 * 1024, 256 * 1024, 512 * 1024 };
+
+static uint32_t random_state = 0x2350;
+
+static uint8_t random_byte(void) {
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return (uint8_t)random_state;
+}
+
+static size_t emit(uint8_t *rom, size_t at, int count, ...) {
+    va_list args;
+    va_start(args, count);
+    for (int i = 0; i < count; i++) {
+        rom[at++] = (uint8_t)va_arg(args, int);
+    }
+    va_end(args);
+    return at;
+}
+
+// Code switching a page to a bank and calling the routine the bank starts with.
+static size_t emit_switch(uint8_t *rom, size_t at, const char *style, uint16_t reg, uint8_t bank, uint16_t page) {
+    at = emit(rom, at, 2, 0x3E, bank);                                          // ld a,bank
+    if (strcmp(style, "hl") == 0) {
+        at = emit(rom, at, 4, 0x21, reg & 0xFF, reg >> 8, 0x77);                // ld hl,reg / ld (hl),a
+    } else if (strcmp(style, "ix") == 0) {
+        uint16_t const base = reg - 0x10;
+        at = emit(rom, at, 7, 0xDD, 0x21, base & 0xFF, base >> 8, 0xDD, 0x77, 0x10);   // ld ix,reg-10h / ld (ix+10h),a
+    } else {
+        at = emit(rom, at, 3, 0x32, reg & 0xFF, reg >> 8);                      // ld (reg),a
+    }
+    return emit(rom, at, 3, 0xCD, page & 0xFF, page >> 8);                      // call page
+}
+
+// Write one ROM of the corpus.
+static bool write_rom(const char *directory, int number, const Mapper *mapper, const char *style, uint32_t size) {
+    uint8_t *rom = (uint8_t *)malloc(size);
+    uint32_t const banks = size / mapper->bank_size;
+    char path[1024];
+    size_t at = 0x10;
+
+    if (!rom) {
+        return false;
+    }
+    for (uint32_t i = 0; i < size; i++) {
+        rom[i] = random_byte();
+    }
+
+    // Every bank but the first starts with a routine counting its calls: ld a,bank / ld (0C000h),a / ld hl,0C001h /
+    // inc (hl) / ret
+    for (uint32_t bank = 1; bank < banks; bank++) {
+        emit(rom, (size_t)bank * mapper->bank_size, 9, 0x3E, bank, 0x32, 0x00, 0xC0, 0x21, 0x01, 0xC0, 0x34);
+        rom[(size_t)bank * mapper->bank_size + 9] = 0xC9;
+    }
+
+    // Header and INIT, in the first 8KB that stays on 4000h
+    memset(rom, 0, 0x10);
+    rom[0] = 'A';
+    rom[1] = 'B';
+    rom[2] = 0x10;
+    rom[3] = 0x40;
+    bool const hook = strcmp(style, "hook") == 0;
+    if (hook) {
+        // di / ld a,0C3h / ld (H.TIMI),a / ld hl,switches / ld (H.TIMI+1),hl / ei / ret
+        uint16_t const switches = 0x4020;
+        at = emit(rom, at, 15, 0xF3, 0x3E, 0xC3, 0x32, HOOK_TIMI & 0xFF, HOOK_TIMI >> 8, 0x21, switches & 0xFF,
+                  switches >> 8, 0x22, (HOOK_TIMI + 1) & 0xFF, (HOOK_TIMI + 1) >> 8, 0xFB, 0xC9, 0x00);
+        at = 0x20;
+    } else {
+        at = emit(rom, at, 1, 0xF3);                                            // di
+    }
+    for (int i = 0; i < BANK_SWITCHES; i++) {
+        int const page = (mapper->bank_size == 16384) ? 0 : i & 1;
+        uint8_t const bank = (uint8_t)(1 + (random_byte() % (banks - 1)));
+        at = emit_switch(rom, at, hook ? "abs" : style, mapper->registers[page], bank, page ? 0xA000 : 0x8000);
+    }
+    if (hook) {
+        rom[at++] = 0xC9;                                                       // ret, back to the interrupt
+    } else {
+        at = emit(rom, at, 2, 0x18, 0xFE);                                      // jr $, the game loop
+    }
+
+    snprintf(path, sizeof(path), "%s/Synthetic %02d %s %uK.%s.ROM", directory, number, style, size / 1024,
+             mapper->tag);
+    FILE *file = fopen(path, "wb");
+    bool const written = file && fwrite(rom, 1, size, file) == size;
+    if (file) {
+        fclose(file);
+    }
+    free(rom);
+    if (!written) {
+        fprintf(stderr, "Unable to write %s\n", path);
+    }
+    return written;
+}
+
+int main(int argc, char *argv[]) {
+    int number = 0;
+
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s <directory>\n", argv[0]);
+        return 1;
+    }
+    for (size_t m = 0; m < sizeof(MAPPERS) / sizeof(MAPPERS[0]); m++) {
+        for (size_t s = 0; s < sizeof(STYLES) / sizeof(STYLES[0]); s++) {
+            for (size_t z = 0; z < sizeof(SIZES) / sizeof(SIZES[0]); z++) {
+                if (!write_rom(argv[1], ++number, &MAPPERS[m], STYLES[s], SIZES[z])) {
+                    return 1;
+                }
+            }
+        }
+    }
+    printf("Wrote %d ROMs to %s\n", number, argv[1]);
+    return 0;
+}
@@ -0,0 +1,345 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// romdbgen.c - Build tool generating the ROM database of the multirom and loadrom tools (romdb.h)
+//
+// Reads the list of known dumps (romdb/romdb.txt), one per line:
+//   <SHA-1 of the dump, 40 hex digits> <mapper tag> <title>
+// and writes romdb_table.h, the dumps placed with a minimal perfect hash (compress, hash and displace): the keys are
+// spread over buckets of about four, the largest buckets are placed first, each with the first displacement that sends
+// its keys to free slots. Every dump then has its own slot, and a lookup reads one displacement and one key.
+//
+// Usage: romdbgen <romdb.txt> <romdb_table.h>
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+//
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <ctype.h>
+#include <inttypes.h>
+
+#define MAX_TITLE_LENGTH        49              // MAX_FILE_NAME_LENGTH of the multirom tool, without the NUL
+#define MAX_DISPLACEMENT        65535           // Displacements are stored as 16 bits
+#define KEYS_PER_BUCKET         4
+
+// Mapper tags of the tools (their MAPPER_DESCRIPTIONS) and the names openMSX gives the same mappers.
+typedef struct {
+    const char *tag;
+    uint8_t mapper;
+} MapperTag;
+
+static const MapperTag MAPPER_TAGS[] = {
+    { "PL-16", 1 }, { "PL-32", 2 }, { "KonSCC", 3 }, { "Linear", 4 }, { "ASC-08", 5 }, { "ASC-16", 6 },
+    { "Konami", 7 }, { "NEO-8", 8 }, { "NEO-16", 9 }, { "ASC8SR", 12 }, { "ASC16S", 13 }, { "GM2", 14 },
+    { "SCC+", 15 },
+    { "KonamiSCC", 3 }, { "ASCII8", 5 }, { "ASCII16", 6 }, { "ASCII8SRAM2", 12 }, { "ASCII8SRAM8", 12 },
+    { "ASCII16SRAM2", 13 }, { "ASCII16SRAM8", 13 }, { "GameMaster2", 14 },
+};
+
+typedef struct {
+    uint64_t key;           // First 8 bytes of the SHA-1
+    uint8_t mapper;
+    char title[MAX_TITLE_LENGTH + 1];
+    int line;               // Line of the list, for the messages
+} Dump;
+
+// Same function as romdb_slot() in romdb.h.
+static uint32_t slot_of(uint64_t key, uint32_t displacement, uint32_t count) {
+    uint64_t x = key ^ ((uint64_t)displacement * 0x9E3779B97F4A7C15ull);
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ull;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBull;
+    x ^= x >> 31;
+    return (uint32_t)(x % count);
+}
+
+static uint8_t mapper_from_tag(const char *tag) {
+    for (size_t i = 0; i < sizeof(MAPPER_TAGS) / sizeof(MAPPER_TAGS[0]); i++) {
+        const char *a = tag;
+        const char *b = MAPPER_TAGS[i].tag;
+        while (*a && *b && toupper((unsigned char)*a) == toupper((unsigned char)*b)) {
+            a++;
+            b++;
+        }
+        if (*a == '\0' && *b == '\0') {
+            return MAPPER_TAGS[i].mapper;
+        }
+    }
+    return 0;
+}
+
+static int compare_keys(const void *a, const void *b) {
+    uint64_t const x = ((const Dump *)a)->key;
+    uint64_t const y = ((const Dump *)b)->key;
+    return (x > y) - (x < y);
+}
+
+// Read the list, sorted by key, the dumps found twice kept once. Returns the number of dumps, -1 on error.
+static int read_list(const char *filename, Dump **dumps) {
+    char line[1024];
+    int count = 0;
+    int capacity = 0;
+    int number = 0;
+
+    *dumps = NULL;
+    FILE *file = fopen(filename, "r");
+    if (!file) {
+        fprintf(stderr, "romdbgen: unable to open %s\n", filename);
+        return -1;
+    }
+    while (fgets(line, sizeof(line), file)) {
+        char sha1[64];
+        char tag[64];
+        int title_at = 0;
+        Dump dump;
+
+        number++;
+        line[strcspn(line, "\r\n")] = '\0';
+        char *text = line;
+        while (isspace((unsigned char)*text)) {
+            text++;
+        }
+        if (*text == '\0' || *text == '#') {
+            continue;
+        }
+        if (sscanf(text, "%63s %63s %n", sha1, tag, &title_at) != 2 || title_at == 0 || strlen(sha1) != 40 ||
+            strspn(sha1, "0123456789abcdefABCDEF") != 40) {
+            fprintf(stderr, "%s:%d: expected <sha1> <mapper> <title>\n", filename, number);
+            fclose(file);
+            return -1;
+        }
+        dump.mapper = mapper_from_tag(tag);
+        if (dump.mapper == 0) {
+            fprintf(stderr, "%s:%d: unknown mapper %s\n", filename, number, tag);
+            fclose(file);
+            return -1;
+        }
+        sha1[16] = '\0';
+        dump.key = strtoull(sha1, NULL, 16);
+        snprintf(dump.title, sizeof(dump.title), "%s", text + title_at);
+        dump.title[strcspn(dump.title, "\t")] = '\0';
+        for (size_t end = strlen(dump.title); end && isspace((unsigned char)dump.title[end - 1]); end--) {
+            dump.title[end - 1] = '\0';
+        }
+        dump.line = number;
+        if (count == capacity) {
+            capacity = capacity ? capacity * 2 : 1024;
+            Dump *grown = (Dump *)realloc(*dumps, sizeof(Dump) * (size_t)capacity);
+            if (!grown) {
+                fprintf(stderr, "romdbgen: out of memory\n");
+                fclose(file);
+                return -1;
+            }
+            *dumps = grown;
+        }
+        (*dumps)[count++] = dump;
+    }
+    fclose(file);
+
+    if (count) {
+        qsort(*dumps, (size_t)count, sizeof(Dump), compare_keys);
+    }
+    int kept = 0;
+    for (int i = 0; i < count; i++) {
+        if (kept && (*dumps)[kept - 1].key == (*dumps)[i].key) {
+            fprintf(stderr, "%s:%d: warning: same key as line %d, skipped\n", filename, (*dumps)[i].line,
+                    (*dumps)[kept - 1].line);
+            continue;
+        }
+        (*dumps)[kept++] = (*dumps)[i];
+    }
+    return kept;
+}
+
+typedef struct {
+    uint32_t bucket;
+    uint32_t size;
+    uint32_t first;         // First dump of the bucket in members
+} Bucket;
+
+static int compare_buckets(const void *a, const void *b) {
+    const Bucket *x = (const Bucket *)a;
+    const Bucket *y = (const Bucket *)b;
+    if (x->size != y->size) {
+        return (x->size < y->size) ? 1 : -1;
+    }
+    return (x->bucket > y->bucket) - (x->bucket < y->bucket);
+}
+
+// Place the dumps: slots[n] gets the dump of slot n, displacements[b] the displacement of bucket b.
+// Returns false when a bucket finds no displacement, the caller tries again with more buckets.
+static bool place(const Dump *dumps, uint32_t count, uint32_t buckets, uint16_t *displacements, int32_t *slots) {
+    Bucket *list = (Bucket *)calloc(buckets, sizeof(Bucket));
+    uint32_t *members = (uint32_t *)malloc(sizeof(uint32_t) * count);
+    uint32_t *filled = (uint32_t *)calloc(buckets, sizeof(uint32_t));
+    uint32_t *tried = (uint32_t *)malloc(sizeof(uint32_t) * KEYS_PER_BUCKET * 8);
+    bool placed = list && members && filled && tried;
+
+    for (uint32_t b = 0; placed && b < buckets; b++) {
+        list[b].bucket = b;
+        displacements[b] = 0;
+    }
+    for (uint32_t i = 0; placed && i < count; i++) {
+        list[dumps[i].key % buckets].size++;
+        slots[i] = -1;
+    }
+    uint32_t first = 0;
+    for (uint32_t b = 0; placed && b < buckets; b++) {
+        list[b].first = first;
+        first += list[b].size;
+        placed = list[b].size <= KEYS_PER_BUCKET * 8;
+    }
+    for (uint32_t i = 0; placed && i < count; i++) {
+        uint32_t const b = (uint32_t)(dumps[i].key % buckets);
+        members[list[b].first + filled[b]++] = i;
+    }
+    if (placed) {
+        qsort(list, buckets, sizeof(Bucket), compare_buckets);
+    }
+    for (uint32_t b = 0; placed && b < buckets && list[b].size; b++) {
+        const uint32_t *keys = &members[list[b].first];
+        uint32_t d;
+        for (d = 0; d <= MAX_DISPLACEMENT; d++) {
+            uint32_t k;
+            for (k = 0; k < list[b].size; k++) {
+                uint32_t const slot = slot_of(dumps[keys[k]].key, d, count);
+                bool taken = slots[slot] >= 0;
+                for (uint32_t j = 0; j < k && !taken; j++) {
+                    taken = tried[j] == slot;
+                }
+                if (taken) {
+                    break;
+                }
+                tried[k] = slot;
+            }
+            if (k == list[b].size) {
+                break;
+            }
+        }
+        if (d > MAX_DISPLACEMENT) {
+            placed = false;
+            break;
+        }
+        for (uint32_t k = 0; k < list[b].size; k++) {
+            slots[tried[k]] = (int32_t)keys[k];
+        }
+        displacements[list[b].bucket] = (uint16_t)d;
+    }
+    free(list);
+    free(members);
+    free(filled);
+    free(tried);
+    return placed;
+}
+
+// Write a title as a C string.
+static void write_string(FILE *file, const char *text) {
+    fputc('"', file);
+    for (; *text; text++) {
+        unsigned char const c = (unsigned char)*text;
+        if (c == '"' || c == '\\') {
+            fprintf(file, "\\%c", c);
+        } else if (c < ' ' || c >= 0x7F) {
+            fprintf(file, "\\%03o", c);
+        } else {
+            fputc(c, file);
+        }
+    }
+    fputc('"', file);
+}
+
+int main(int argc, char *argv[]) {
+    Dump *dumps;
+
+    if (argc != 3) {
+        fprintf(stderr, "Usage: %s <romdb.txt> <romdb_table.h>\n", argv[0]);
+        return 1;
+    }
+    int const read = read_list(argv[1], &dumps);
+    if (read < 0) {
+        free(dumps);
+        return 1;
+    }
+    uint32_t const count = (uint32_t)read;
+    uint32_t buckets = (count + KEYS_PER_BUCKET - 1) / KEYS_PER_BUCKET;
+    buckets = buckets ? buckets : 1;
+    uint16_t *displacements = NULL;
+    int32_t *slots = (int32_t *)malloc(sizeof(int32_t) * (count + 1));
+    for (;;) {
+        free(displacements);
+        displacements = (uint16_t *)calloc(buckets, sizeof(uint16_t));
+        if (!displacements || !slots) {
+            fprintf(stderr, "romdbgen: out of memory\n");
+            return 1;
+        }
+        if (count == 0 || place(dumps, count, buckets, displacements, slots)) {
+            break;
+        }
+        buckets += buckets / 4 + 1;
+    }
+
+    // Identifies the table, the multirom tool detects the mappers again when it changes
+    uint32_t id = 2166136261u;
+    for (uint32_t n = 0; n < count; n++) {
+        const Dump *dump = &dumps[slots[n]];
+        for (int i = 0; i < 8; i++) {
+            id = (id ^ (uint8_t)(dump->key >> (8 * i))) * 16777619u;
+        }
+        id = (id ^ dump->mapper) * 16777619u;
+        for (const char *c = dump->title; *c; c++) {
+            id = (id ^ (uint8_t)*c) * 16777619u;
+        }
+    }
+
+    FILE *file = fopen(argv[2], "w");
+    if (!file) {
+        fprintf(stderr, "romdbgen: unable to write %s\n", argv[2]);
+        return 1;
+    }
+    fprintf(file, "// Generated by romdbgen from %s, do not edit\n\n", argv[1]);
+    fprintf(file, "#ifndef ROMDB_TABLE_H\n#define ROMDB_TABLE_H\n\n");
+    fprintf(file, "#define ROMDB_COUNT %" PRIu32 "\n", count);
+    fprintf(file, "#define ROMDB_BUCKETS %" PRIu32 "\n", buckets);
+    fprintf(file, "#define ROMDB_ID \"%08" PRIx32 "\"\n\n", id);
+    fprintf(file, "static const uint16_t romdb_displacements[%" PRIu32 "] = {", buckets);
+    for (uint32_t b = 0; b < buckets; b++) {
+        fprintf(file, "%s%u,", (b % 16) ? " " : "\n    ", (unsigned)displacements[b]);
+    }
+    fprintf(file, "\n};\n\nstatic const uint64_t romdb_keys[%" PRIu32 "] = {", count + 1);
+    for (uint32_t n = 0; n < count; n++) {
+        fprintf(file, "%s0x%016" PRIx64 "ull,", (n % 4) ? " " : "\n    ", dumps[slots[n]].key);
+    }
+    fprintf(file, "%s0\n};\n\nstatic const uint8_t romdb_mappers[%" PRIu32 "] = {", count ? " " : "\n    ",
+            count + 1);
+    for (uint32_t n = 0; n < count; n++) {
+        fprintf(file, "%s%u,", (n % 16) ? " " : "\n    ", (unsigned)dumps[slots[n]].mapper);
+    }
+    fprintf(file, "%s0\n};\n\nstatic const uint32_t romdb_titles[%" PRIu32 "] = {", count ? " " : "\n    ",
+            count + 1);
+    uint32_t offset = 0;
+    for (uint32_t n = 0; n < count; n++) {
+        fprintf(file, "%s%" PRIu32 ",", (n % 8) ? " " : "\n    ", offset);
+        offset += (uint32_t)strlen(dumps[slots[n]].title) + 1;
+    }
+    fprintf(file, "%s%" PRIu32 "\n};\n\nstatic const char romdb_names[] =", count ? " " : "\n    ", offset);
+    for (uint32_t n = 0; n < count; n++) {
+        fprintf(file, "\n    ");
+        write_string(file, dumps[slots[n]].title);
+        fprintf(file, " \"\\0\"");
+    }
+    fprintf(file, "\n    \"\";\n\n#endif\n");
+    fclose(file);
+
+    printf("romdbgen: %" PRIu32 " dumps in %" PRIu32 " buckets\n", count, buckets);
+    free(dumps);
+    free(displacements);
+    free(slots);
+    return 0;
+}
@@ -6,8 +6,8 @@
 //
 // This program will display a menu with the games stored on the flash memory. The user can navigate the menu using the arrow keys and select a game to load. 
 // The program will display the game name, size and mapper type. The user can also display a help screen with the available keys and a configuration screen 
-// to change the settings of the program. The program will read the flash memory configuration area to populate the game list. The configuration area will 
-// contain the game name, size, mapper type and offset in the flash memory.
+// to change the settings of the program. The game list is kept by the firmware: the program asks it for the page on screen through the catalog I/O port
+// and copies the lines it gets, already formatted with the game name, size and mapper type, to the screen.
 // 
 // The program needs to be compiled using the Fusion-C library and the MSX BIOS routines. 
 // 
@@ -21,69 +21,128 @@
 #define MULTIROM_VERSION "v1.00"
 #endif
 
-// read_ulong - Read a 4-byte value from the memory area
-// This function will read a 4-byte value from the memory area pointed by ptr and return the value as an unsigned long
+// readCatalogHeader - Read the number of ROMs and pages latched by the firmware
+void readCatalogHeader() {
+    unsigned char low;
+
+    low = InPort(CATALOG_PORT);
+    totalFiles = low | (InPort(CATALOG_PORT) << 8);
+    low = InPort(CATALOG_PORT);
+    totalPages = low | (InPort(CATALOG_PORT) << 8);
+}
+
+// readCatalogInfo - Read the number of ROMs and pages of the catalog
+// This function will ask the firmware for the catalog header through the CATALOG_PORT I/O port. The menu keeps no list of its own,
+// so this costs the same whatever the number of ROMs.
+void readCatalogInfo() {
+    OutPort(CATALOG_PORT, CATALOG_CMD_INFO);
+    readCatalogHeader();
+}
+
+// readCatalogEntry - Read the name and mapper of a ROM from the catalog
 // Parameters:
-//   ptr - Pointer to the memory area to read the value from
-// Returns:
-//   The 4-byte value as an unsigned long 
-unsigned long read_ulong(const unsigned char *ptr) {
-    return (unsigned long)ptr[0] |
-           ((unsigned long)ptr[1] << 8) |
-           ((unsigned long)ptr[2] << 16) |
-           ((unsigned long)ptr[3] << 24);
+//   index - Index of the ROM
+//   entry - Pointer to the entry to fill, the name comes padded with spaces
+void readCatalogEntry(int index, CatalogEntry *entry) {
+    OutPort(CATALOG_PORT, CATALOG_CMD_ENTRY);
+    OutPort(CATALOG_PORT, index & 0xFF);
+    OutPort(CATALOG_PORT, index >> 8);
+    for (int i = 0; i < MAX_FILE_NAME_LENGTH; i++) {
+        entry->Name[i] = InPort(CATALOG_PORT);
+    }
+    entry->Name[MAX_FILE_NAME_LENGTH] = '\0'; // Ensure null termination
+    entry->Mapper = InPort(CATALOG_PORT);
+    entry->Index = InPort(CATALOG_PORT);
+    entry->Index |= InPort(CATALOG_PORT) << 8;
+}
+
+// printCatalogLines - Print the lines of a page latched by the firmware
+// The firmware sends the lines formatted and padded (name, size and mapper), they are copied to the name table as they come.
+void printCatalogLines() {
+    unsigned char line[CATALOG_LINE_LENGTH];
+    unsigned char width = *(unsigned char *)BIOS_LINLEN;
+
+    if (width > CATALOG_LINE_LENGTH) {
+        width = CATALOG_LINE_LENGTH;
+    }
+    for (int row = 0; row < FILES_PER_PAGE; row++) {
+        for (int i = 0; i < CATALOG_LINE_LENGTH; i++) {
+            line[i] = InPort(CATALOG_PORT);
+        }
+        CopyRamToVram(line, lineStart + (2 + row) * lineStride, width); // Screen lines 2 to 20
+    }
 }
 
-// isEndOfData - Check if the memory area is the end of the data
-// This function will check if the memory area pointed by memory is the end of the data. The end of the data is defined by all bytes being 0xFF.
+// printCatalogPage - Print the lines of a page of the catalog
 // Parameters:
-//   memory - Pointer to the memory area to check
+//   page - Page number, from 0
+void printCatalogPage(int page) {
+    OutPort(CATALOG_PORT, CATALOG_CMD_PAGE);
+    OutPort(CATALOG_PORT, page & 0xFF);
+    OutPort(CATALOG_PORT, page >> 8);
+    printCatalogLines();
+}
+
+// searchCatalog - Send a key of the search to the firmware and show the first page of the files that match
+// The firmware filters the list itself and answers with the new counts and the first page in one go, so a key costs the same as
+// turning a page.
+// Parameters:
+//   key - Character typed, CATALOG_KEY_DELETE or CATALOG_KEY_CLEAR
+void searchCatalog(unsigned char key) {
+    OutPort(CATALOG_PORT, CATALOG_CMD_SEARCH);
+    OutPort(CATALOG_PORT, key);
+    readCatalogHeader();
+    printCatalogLines();
+    currentPage = 1;
+    currentIndex = 0;
+    printFooter();
+}
+
+// searchKey - Apply a key typed in search mode
+// Printable keys are added to the query, [BS] removes the last character and [ESC] leaves the search, back to the whole list.
+// Parameters:
+//   key - Key typed
 // Returns:
-//   1 if the memory area is the end of the data, 0 otherwise
-int isEndOfData(const unsigned char *memory) {
-    for (int i = 0; i < ROM_RECORD_SIZE; i++) {
-        if (memory[i] != 0xFF) {
-            return 0;
+//   1 if the key was taken by the search, 0 if it is a navigation key
+int searchKey(char key) {
+    if (key == 27) { // ESC
+        searching = 0;
+        queryLength = 0;
+        query[0] = '\0';
+        searchCatalog(CATALOG_KEY_CLEAR);
+    } else if (key == 8) { // BS
+        if (queryLength > 0) {
+            query[--queryLength] = '\0';
+            searchCatalog(CATALOG_KEY_DELETE);
         }
+    } else if (key >= 32 && key < 127) {
+        if (queryLength < CATALOG_QUERY_LENGTH) {
+            query[queryLength++] = key;
+            query[queryLength] = '\0';
+            searchCatalog(key);
+        }
+    } else {
+        return 0;
     }
     return 1;
 }
 
-// readROMData - Read the ROM records from the memory area
-// This function will read the ROM records from the memory area pointed by memory and store them in the records array. The function will stop reading
-// when it reaches the end of the data or the maximum number of records is reached.
-// Parameters:
-//   records - Pointer to the array of ROM records to store the data
-//   recordCount - Pointer to the variable to store the number of records read
-void readROMData(ROMRecord *records, unsigned char *recordCount, unsigned long *sizeTotal) {
-    unsigned char *memory = (unsigned char *)MEMORY_START;
-    unsigned char count;
-    unsigned long total;
-
-    count = 0;
-    total = 0;
-    while (count < MAX_ROM_RECORDS && !isEndOfData(memory)) {
-        // Copy Name
-        MemCopy(records[count].Name, memory, MAX_FILE_NAME_LENGTH);
-        // pad with spaces in case of short names
-        for (int i = strlen(records[count].Name); i < MAX_FILE_NAME_LENGTH; i++) {
-            records[count].Name[i] = ' ';
+// findTextStart - Find where the text lines start in VRAM
+// The BIOS centers the narrow widths on the screen (WIDTH 37 leaves a border on the left), the first character of the header
+// printed on line 0 tells where the text begins.
+void findTextStart() {
+    unsigned int address = *(unsigned int *)BIOS_TXTNAM;
+
+    lineStride = (*(unsigned char *)BIOS_LINLEN > 40) ? 80 : 40;
+    lineStart = address;
+    for (unsigned char border = 0; border < 8; border++) {
+        if (Vpeek(address + border) == 'M') {
+            lineStart = address + border;
+            break;
         }
-        // Ensure null termination
-        records[count].Name[MAX_FILE_NAME_LENGTH] = '\0'; // Ensure null termination
-        records[count].Mapper = memory[MAX_FILE_NAME_LENGTH]; // Read Mapper code
-        records[count].Size = read_ulong(&memory[MAX_FILE_NAME_LENGTH + 1]); // Read Size (4 bytes)
-        records[count].Offset = read_ulong(&memory[MAX_FILE_NAME_LENGTH + 5]); // Read Offset (4 bytes)
-        memory += ROM_RECORD_SIZE; // Move to the next record
-        total += records[count].Size;
-        count++;
     }
-
-    *recordCount = count;
-    *sizeTotal = total;
 }
 
-
 void wait1s() {
     unsigned int start = *(unsigned int*)JIFFY;
     while ((unsigned int)(*(unsigned int*)JIFFY - start) < 60);
@@ -393,10 +452,20 @@ static int wait_for_key_with_scroll(const char *name, unsigned int row)
 // This function will return the description of the mapper type based on the mapper number.
 char* mapper_description(int number) {
     // Array of strings for the descriptions
-    const char *descriptions[] = {"PL-16", "PL-32", "KonSCC", "Linear", "ASC-08", "ASC-16", "Konami","NEO-8","NEO-16","SYSTEM"};	
+    const char *descriptions[] = {"PL-16", "PL-32", "KonSCC", "Linear", "ASC-08", "ASC-16", "Konami","NEO-8","NEO-16","SYSTEM","AUTO","ASC8SR","ASC16S","GM2","SCC+","DSK"};	
     return descriptions[number - 1];
 }
 
+// printFooter - Print the page number and the help option, or the search query in search mode
+void printFooter() {
+    Locate(0, 22);
+    if (searching) {
+        printf("Find: %-24.24s %02d/%02d", query, currentPage, totalPages);
+    } else {
+        printf("Page: %02d/%02d                [H - Help]",currentPage, totalPages); // Print the page number and the help and config options
+    }
+}
+
 // displayMenu - Display the menu on the screen
 // This function will display the menu on the screen. It will print the header, the files on the current page and the footer with the page number and options.
 void displayMenu() {
@@ -411,46 +480,84 @@ void displayMenu() {
     printf("MSX PICOVERSE 2350   [MultiROM %s]", MULTIROM_VERSION);
     Locate(0, 1);
     printf("-------------------------------------");
-    unsigned int startIndex = (currentPage - 1) * FILES_PER_PAGE;
-    unsigned int endIndex = startIndex + FILES_PER_PAGE;
-
-    if (endIndex > totalFiles) {
-        endIndex = totalFiles;
-    }
-
-    unsigned int line = 0;
-    for (unsigned int idx = startIndex; idx < endIndex; idx++, line++) {
-        Locate(0, 2 + line); // Position on the screen, starting at line 2
-        printf(" %-24.24s %04lu %-7s", records[idx].Name, records[idx].Size/1024, mapper_description(records[idx].Mapper));
-    }
-
-    for (; line < FILES_PER_PAGE; line++) {
-        Locate(0, 2 + line);
-        printf("                                 "); // clear unused lines to avoid stale entries
-    }
+    findTextStart();
+    printCatalogPage(currentPage - 1); // Lines of the page, blank past the last file
     // footer
     Locate(0, 21);
     printf("-------------------------------------");
-    Locate(0, 22);
-    printf("Page: %02d/%02d                [H - Help]",currentPage, totalPages); // Print the page number and the help and config options
+    printFooter();
     if (totalFiles > 0) {
         Locate(0, (currentIndex % FILES_PER_PAGE) + 2); // Position the cursor on the selected file
         printf(">"); // Print the cursor
-        print_str_inverted(records[currentIndex].Name); // Print the selected file name inverted
+        readCatalogEntry(currentIndex, &selected);
+        print_str_inverted(selected.Name); // Print the selected file name inverted
+
+    }
+}
 
+// readPerfCounters - Read a performance counters block from the firmware
+// This function will latch a counters block through the PERF_PORT I/O port and read it back byte by byte.
+// Parameters:
+//   command - PERF_CMD_CURRENT or PERF_CMD_LAST
+//   counters - Pointer to the block to fill
+// Returns:
+//   1 if the block is valid, 0 otherwise (firmware built without the counters, or no previous session)
+int readPerfCounters(unsigned char command, PerfCounters *counters)
+{
+    unsigned char *ptr = (unsigned char *)counters;
+
+    OutPort(PERF_PORT, command);
+    for (int i = 0; i < sizeof(PerfCounters); i++) {
+        ptr[i] = InPort(PERF_PORT);
     }
+    return counters->Magic[0] == 'P' && counters->Magic[1] == 'E' && counters->Magic[2] == 'R' && counters->Magic[3] == 'F';
 }
 
 // configMenu - Display the configuration menu on the screen
-// This function will display the configuration menu on the screen. 
+// This function will display the configuration menu on the screen. It shows the performance counters of the firmware: the ones of
+// the last game session when the Pico kept them across a reset, or the ones of the menu session otherwise.
 void configMenu()
 {
+    static const char *bucketNames[PERF_HIST_BUCKETS] = {"   <8", " 8-15", "16-31", "32-63", "64-127", "128-255", "256-511", "  512+"};
+    PerfCounters counters;
+    int last;
+
     Cls(); // Clear the screen
     Locate(0,0);
     printf("MSX PICOVERSE 2350   [MultiROM %s]", MULTIROM_VERSION);
     Locate(0, 1);
     printf("-------------------------------------");
     Locate(0, 2);
+    last = readPerfCounters(PERF_CMD_LAST, &counters);
+    if (!last && !readPerfCounters(PERF_CMD_CURRENT, &counters)) {
+        printf("Performance counters not available");
+        Locate(0, 3);
+        printf("(firmware built without them)");
+    } else {
+        printf("Counters: %s", last ? "previous session" : "this menu session");
+        Locate(0, 3);
+        printf("Mapper       : %s", counters.Mapper ? mapper_description(counters.Mapper) : "Menu");
+        Locate(0, 4);
+        printf("Reads        : %lu", counters.Reads);
+        Locate(0, 5);
+        printf("Writes       : %lu", counters.Writes);
+        Locate(0, 6);
+        printf("Bank switches: %lu", counters.BankSwitches);
+        Locate(0, 7);
+        printf("Cache hit/mis: %lu/%lu", counters.CacheHits, counters.CacheMisses);
+        Locate(0, 8);
+        printf("Nextor polls : %lu (busy %lu)", counters.IoPolls, counters.IoBusy);
+        Locate(0, 9);
+        if (counters.Flags & PERF_FLAG_NO_LATENCY) {
+            printf("Read latency : n/a (DMA engine)");
+        } else {
+            printf("Read latency : max %lu cycles", counters.LatencyMax);
+            for (int i = 0; i < PERF_HIST_BUCKETS; i++) {
+                Locate(0, 10 + i);
+                printf("  %7s cycles: %lu", bucketNames[i], counters.LatencyHist[i]);
+            }
+        }
+    }
     Locate(0, 21);
     printf("-------------------------------------");
     Locate(0, 22);
@@ -480,6 +587,10 @@ void helpMenu()
     printf("  selected rom file");
     Locate(0, 6);
     printf("Press [H] to display the help screen");
+    Locate(0, 7);
+    printf("Press [/] to search the list, type");
+    Locate(0, 8);
+    printf("  part of a name, [ESC] to clear it");
     Locate(0, 21);
     printf("-------------------------------------");
     Locate(0, 22);
@@ -493,9 +604,10 @@ void helpMenu()
 // This function will load the game from the flash memory based on the index. 
 void loadGame(int index) 
 {
-    if (records[index].Mapper != 0)
+    if (selected.Mapper != 0)
     {
-        Poke(ROM_SELECT_REGISTER, index); // Set the game index
+        Poke(ROM_SELECT_HIGH, selected.Index >> 8); // Set the game index, the list may be filtered
+        Poke(ROM_SELECT_REGISTER, selected.Index & 0xFF); // The low byte starts the selection
         execute_rst00(); // Execute RST 00h to reset the MSX computer and load the game
         execute_rst00();
     }
@@ -514,14 +626,13 @@ void navigateMenu()
         //debug
         Locate(0, 23);
         //printf("Key: %3d", key);
-        //printf("Size: %05lu/15872", totalSize/1024);
         //debug
         //Locate(20, 23);
         //printf("Memory Mapper: Off");
         //printf("CPage: %2d Index: %2d", currentPage, currentIndex);
         unsigned int currentRow = (currentIndex%FILES_PER_PAGE) + 2;
 
-        key = wait_for_key_with_scroll(records[currentIndex].Name, currentRow);
+        key = wait_for_key_with_scroll(selected.Name, currentRow);
         //key = KeyboardRead();
         //key = InputChar();
         char fkey = Fkeys();
@@ -529,7 +640,10 @@ void navigateMenu()
 
         Locate(0, currentRow); // Position the cursor on the previously selected file
         printf(" "); // Clear the cursor
-        printf("%-24.24s", records[currentIndex].Name); // Print only the first 24 characters of the file name
+        printf("%-24.24s", selected.Name); // Print only the first 24 characters of the file name
+        if (searching && searchKey(key)) {
+            key = 0; // Taken by the search query
+        }
         switch (key) 
         {
             case 30: // Up arrow
@@ -571,6 +685,10 @@ void navigateMenu()
                 // load Nextor
                 //loadGame(0); // Load the Nextor ROM
                 break;
+            case 47: // / - Search
+                searching = 1;
+                printFooter();
+                break;
             case 72: // H - Help (uppercase H)
             case 104: // h - Help (lowercase h)
                 // Help
@@ -587,9 +705,15 @@ void navigateMenu()
                 loadGame(currentIndex); // Load the selected game
                 break;
         }
-        Locate(0, (currentIndex%FILES_PER_PAGE) + 2); // Position the cursor on the selected file
-        printf(">"); // Print the cursor
-        print_str_inverted(records[currentIndex].Name); // Print the selected file name
+        if (totalFiles > 0) {
+            Locate(0, (currentIndex%FILES_PER_PAGE) + 2); // Position the cursor on the selected file
+            printf(">"); // Print the cursor
+            readCatalogEntry(currentIndex, &selected);
+            print_str_inverted(selected.Name); // Print the selected file name
+        } else {
+            selected.Name[0] = '\0'; // Nothing matches the search
+            selected.Mapper = 0;
+        }
         Locate(0, (currentIndex%FILES_PER_PAGE) + 2); // Position the cursor on the selected file
     }
 }
@@ -598,9 +722,13 @@ void main() {
     // Initialize the variables
     currentPage = 1; // Start on page 1
     currentIndex = 0; // Start at the first file - index 0
+    searching = 0; // Start on the whole list
+    queryLength = 0;
+    query[0] = '\0';
+    selected.Name[0] = '\0';
+    selected.Mapper = 0;
     
-    readROMData(records, &totalFiles, &totalSize);
-    totalPages = (int)((totalFiles/FILES_PER_PAGE)+1); // Calculate the total pages based on the total files and files per page
+    readCatalogInfo(); // Number of files and pages, the firmware keeps the list
 
     //Screen(0); // Set the screen mode
     //invert_chars(32, 126); // Invert the characters from 32 to 126
@@ -0,0 +1,255 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// catalog.c - ROM catalog served to the menu a page at a time over an I/O port
+//
+// This file is shared as-is by the RP2040 and RP2350 firmwares.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "multirom.h"
+#include "catalog.h"
+
+#define CATALOG_HEADER_SIZE     4
+#define CATALOG_PAGE_SIZE       (CATALOG_PAGE_LINES * CATALOG_LINE_LENGTH)
+
+// Mapper names shown by the menu, by mapper code
+static const char *const catalog_mappers[] = {
+    "PL-16", "PL-32", "KonSCC", "Linear", "ASC-08", "ASC-16", "Konami", "NEO-8", "NEO-16", "SYSTEM", "AUTO",
+    "ASC8SR", "ASC16S", "GM2", "SCC+", "DSK",
+};
+#define CATALOG_MAPPERS         (sizeof(catalog_mappers) / sizeof(catalog_mappers[0]))
+
+static uint32_t catalog_masks[CATALOG_MAX_ENTRIES];  // Characters found in each name
+static uint16_t catalog_view[CATALOG_MAX_ENTRIES];  // Entries matching the query, in library order
+static uint32_t catalog_view_count = 0;
+static char catalog_query[CATALOG_QUERY_LENGTH + 1]; // In upper case
+static uint32_t catalog_query_length = 0;
+static uint32_t catalog_count = 0;
+static uint8_t catalog_command[3];                  // Command byte, then its argument
+static uint32_t catalog_command_length = 0;         // Bytes of the command written so far
+static uint8_t catalog_block[CATALOG_HEADER_SIZE + CATALOG_PAGE_SIZE]; // Block being read through CATALOG_PORT
+static uint32_t catalog_block_length = 0;
+static uint32_t catalog_index = 0;                  // Next byte of the block
+
+// catalog_upper - Upper case of a character, the search ignores the case
+static inline char catalog_upper(char c)
+{
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+}
+
+// catalog_mask - Mask of the characters of a string: a bit per letter, one for the digits, one for the rest
+static uint32_t catalog_mask(const char *text, uint32_t length)
+{
+    uint32_t mask = 0;
+    for (uint32_t i = 0; i < length; i++)
+    {
+        char const c = catalog_upper(text[i]);
+        mask |= (c >= 'A' && c <= 'Z') ? 1u << (c - 'A') : (c >= '0' && c <= '9') ? 1u << 26 : 1u << 27;
+    }
+    return mask;
+}
+
+// catalog_contains - Check if a name holds the query, whatever the case
+static bool catalog_contains(const char *name, uint32_t length)
+{
+    for (uint32_t at = 0; at + catalog_query_length <= length; at++)
+    {
+        uint32_t c = 0;
+        while (c < catalog_query_length && catalog_upper(name[at + c]) == catalog_query[c])
+        {
+            c++;
+        }
+        if (c == catalog_query_length)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// catalog_build - Index the names of the ROM records (romconfig.h) for the search
+void catalog_build(void)
+{
+    catalog_count = romconfig_count();
+    if (catalog_count > CATALOG_MAX_ENTRIES)
+    {
+        catalog_count = CATALOG_MAX_ENTRIES;
+    }
+    for (uint32_t entry = 0; entry < catalog_count; entry++)
+    {
+        catalog_masks[entry] = catalog_mask(romconfig_name(entry), romconfig_record(entry)->name_length);
+        catalog_view[entry] = entry;
+    }
+    catalog_view_count = catalog_count;
+    catalog_query_length = 0;
+    catalog_query[0] = '\0';
+    catalog_command_length = 0;
+    catalog_block_length = 0;
+}
+
+// catalog_line - Format the menu line of a ROM record
+// Parameters:
+//   line - Destination, CATALOG_LINE_LENGTH characters
+//   entry - Record index
+static void catalog_line(uint8_t *line, uint32_t entry)
+{
+    const romconfig_record_t *const record = romconfig_record(entry);
+    uint32_t const length = (record->name_length < CATALOG_NAME_LENGTH) ? record->name_length : CATALOG_NAME_LENGTH;
+    const char *const description = (record->mapper >= 1 && record->mapper <= CATALOG_MAPPERS) ?
+                                    catalog_mappers[record->mapper - 1] : "";
+    char name[CATALOG_NAME_LENGTH + 1];
+    char text[CATALOG_LINE_LENGTH + 8];             // Room for the sizes of 10000KB and more, cut to the line
+
+    memcpy(name, romconfig_name(entry), length);
+    name[length] = '\0';
+    snprintf(text, sizeof(text), " %-24.24s %04lu %-7s", name, (unsigned long)(record->size / 1024), description);
+    memcpy(line, text, CATALOG_LINE_LENGTH);
+}
+
+// catalog_search - Apply a key to the query and filter the entries with it
+// Parameters:
+//   key - Character to add, CATALOG_KEY_DELETE or CATALOG_KEY_CLEAR
+static void __no_inline_not_in_flash_func(catalog_search)(uint8_t key)
+{
+    bool narrow = false;                            // The longer query only drops entries of the current view
+
+    if (key == CATALOG_KEY_CLEAR)
+    {
+        catalog_query_length = 0;
+    }
+    else if (key == CATALOG_KEY_DELETE)
+    {
+        if (catalog_query_length)
+        {
+            catalog_query_length--;
+        }
+    }
+    else if (key >= ' ' && catalog_query_length < CATALOG_QUERY_LENGTH)
+    {
+        catalog_query[catalog_query_length++] = catalog_upper(key);
+        narrow = true;
+    }
+    catalog_query[catalog_query_length] = '\0';
+
+    uint32_t const mask = catalog_mask(catalog_query, catalog_query_length);
+    uint32_t const candidates = narrow ? catalog_view_count : catalog_count;
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < candidates; i++)
+    {
+        uint32_t const entry = narrow ? catalog_view[i] : i;
+        if ((catalog_masks[entry] & mask) == mask &&
+            catalog_contains(romconfig_name(entry), romconfig_record(entry)->name_length))
+        {
+            catalog_view[count++] = entry;
+        }
+    }
+    catalog_view_count = count;
+}
+
+// catalog_header - Write the entry and page counts of the view
+static void catalog_header(uint8_t *block)
+{
+    uint32_t const pages = catalog_view_count ?
+                           (catalog_view_count + CATALOG_PAGE_LINES - 1) / CATALOG_PAGE_LINES : 1;
+    block[0] = catalog_view_count & 0xFF;
+    block[1] = catalog_view_count >> 8;
+    block[2] = pages & 0xFF;
+    block[3] = pages >> 8;
+}
+
+// catalog_page - Write the lines of a page of the view, blank past its last entry
+static void catalog_page(uint8_t *block, uint32_t page)
+{
+    uint32_t const first = page * CATALOG_PAGE_LINES;
+    memset(block, ' ', CATALOG_PAGE_SIZE);
+    for (uint32_t line = 0; line < CATALOG_PAGE_LINES && first + line < catalog_view_count; line++)
+    {
+        catalog_line(&block[line * CATALOG_LINE_LENGTH], catalog_view[first + line]);
+    }
+}
+
+// catalog_latch - Latch the block answered by a command
+// Parameters:
+//   command - CATALOG_CMD_INFO, CATALOG_CMD_PAGE, CATALOG_CMD_ENTRY or CATALOG_CMD_SEARCH
+//   argument - Page or entry number, or key
+static void __no_inline_not_in_flash_func(catalog_latch)(uint8_t command, uint32_t argument)
+{
+    catalog_index = 0;
+    catalog_block_length = 0;                       // Unknown commands and entries read as 0xFF
+    switch (command)
+    {
+        case CATALOG_CMD_INFO:
+            catalog_header(catalog_block);
+            catalog_block_length = CATALOG_HEADER_SIZE;
+            break;
+        case CATALOG_CMD_PAGE:
+            catalog_page(catalog_block, argument);
+            catalog_block_length = CATALOG_PAGE_SIZE;
+            break;
+        case CATALOG_CMD_ENTRY:
+            if (argument < catalog_view_count)
+            {
+                uint32_t const entry = catalog_view[argument];
+                const romconfig_record_t *const record = romconfig_record(entry);
+                uint32_t const length = (record->name_length < CATALOG_NAME_LENGTH) ? record->name_length :
+                                        CATALOG_NAME_LENGTH;
+                memcpy(catalog_block, romconfig_name(entry), length);
+                memset(&catalog_block[length], ' ', CATALOG_NAME_LENGTH - length);
+                catalog_block[CATALOG_NAME_LENGTH] = record->mapper;
+                catalog_block[CATALOG_NAME_LENGTH + 1] = entry & 0xFF;
+                catalog_block[CATALOG_NAME_LENGTH + 2] = entry >> 8;
+                catalog_block_length = CATALOG_NAME_LENGTH + 3;
+            }
+            break;
+        case CATALOG_CMD_SEARCH:
+            catalog_search(argument);
+            catalog_header(catalog_block);
+            catalog_page(&catalog_block[CATALOG_HEADER_SIZE], 0);
+            catalog_block_length = CATALOG_HEADER_SIZE + CATALOG_PAGE_SIZE;
+            break;
+    }
+}
+
+// catalog_io - Serve an I/O cycle on CATALOG_PORT
+// Parameters:
+//   bus - GPIO snapshot of the cycle (IORQ active, port on A0-A7)
+void __no_inline_not_in_flash_func(catalog_io)(uint32_t bus)
+{
+    if (!(bus & (1u << PIN_RD)))
+    {
+        uint8_t const data = (catalog_index < catalog_block_length) ? catalog_block[catalog_index++] : 0xFF;
+        gpio_set_dir_out_masked(0xFF << 16); // Set data bus to output mode
+        gpio_put_masked(0xFF0000, (uint32_t)data << 16);
+        while (!(gpio_get(PIN_RD)))
+        {
+            tight_loop_contents();
+        }
+        gpio_set_dir_in_masked(0xFF << 16); // Return data bus to input mode
+    }
+    else if (!(bus & (1u << PIN_WR)))
+    {
+        catalog_command[catalog_command_length++] = (bus >> 16) & 0xFF;
+        uint8_t const command = catalog_command[0];
+        uint32_t const length = (command == CATALOG_CMD_PAGE || command == CATALOG_CMD_ENTRY) ? 3 :
+                                (command == CATALOG_CMD_SEARCH) ? 2 : 1;
+        if (catalog_command_length == length)
+        {
+            uint32_t const argument = (length == 3) ? catalog_command[1] | ((uint32_t)catalog_command[2] << 8) :
+                                      catalog_command[1];
+            gpio_put(PIN_WAIT, 0); // Hold the MSX until the answer is latched
+            catalog_latch(command, argument);
+            gpio_put(PIN_WAIT, 1);
+            catalog_command_length = 0;
+        }
+        while (!(gpio_get(PIN_WR)))
+        {
+            tight_loop_contents();
+        }
+    }
+}
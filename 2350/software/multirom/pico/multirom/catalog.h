@@ -0,0 +1,58 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// catalog.h - ROM catalog served to the menu a page at a time over an I/O port
+//
+// The menu does not walk the ROM records itself: it asks the firmware for the page it shows, and the firmware answers
+// with the lines of that page formatted and padded the way the menu prints them (name, size in KB, mapper), ready to
+// be copied to the VRAM name table. The lines are formatted from the records (romconfig.h) when their page is asked
+// for, so the menu starts and turns pages in the same time whatever the size of the library.
+// The menu can narrow the list with a search: every key typed is sent to the firmware, which keeps a mask of the
+// characters each name holds, and answers with the new count and the first page. A name is only compared with the
+// query, whatever the case, when its mask has every character of the query, and a key added to the query only filters
+// the entries that matched before. Pages and entries are numbered in the filtered list.
+//   OUT (CATALOG_PORT), CATALOG_CMD_INFO               latch the catalog header: entry count, page count (16-bit LE)
+//   OUT (CATALOG_PORT), CATALOG_CMD_PAGE, low, high    latch page N: CATALOG_PAGE_LINES lines of CATALOG_LINE_LENGTH
+//                                                      characters, blank lines past the last entry
+//   OUT (CATALOG_PORT), CATALOG_CMD_ENTRY, low, high   latch entry N: the name padded with spaces to
+//                                                      CATALOG_NAME_LENGTH characters, the mapper code, then the
+//                                                      index of its ROM record (16-bit LE, for the select register)
+//   OUT (CATALOG_PORT), CATALOG_CMD_SEARCH, key        add a character to the query (CATALOG_KEY_DELETE removes the
+//                                                      last one, CATALOG_KEY_CLEAR empties it), then latch the header
+//                                                      followed by the first page
+//   IN  A, (CATALOG_PORT)                              next byte of the latched block (0xFF past the end)
+// The MSX is held with WAIT while the firmware latches the answer of a command.
+//
+// This file is shared as-is by the RP2040 and RP2350 firmwares.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef CATALOG_H
+#define CATALOG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "romconfig.h"
+
+#define CATALOG_PORT            0x9C        // I/O port, next to the performance counters port (0x9D)
+#define CATALOG_CMD_INFO        0x00
+#define CATALOG_CMD_PAGE        0x01
+#define CATALOG_CMD_ENTRY       0x02
+#define CATALOG_CMD_SEARCH      0x03
+#define CATALOG_KEY_CLEAR       0x00
+#define CATALOG_KEY_DELETE      0x08        // Backspace
+#define CATALOG_MAX_ENTRIES     ROMCONFIG_MAX_RECORDS
+#define CATALOG_PAGE_LINES      19          // Lines of a menu page
+#define CATALOG_LINE_LENGTH     38          // " name(24) size(4) mapper(7)"
+#define CATALOG_NAME_LENGTH     ROMCONFIG_NAME_LENGTH
+#define CATALOG_QUERY_LENGTH    24          // Longest search query
+
+// I/O cycle on CATALOG_PORT, from a GPIO snapshot of the bus
+#define CATALOG_CYCLE(bus)      (!((bus) & (1u << PIN_IORQ)) && ((bus) & 0xFFu) == CATALOG_PORT)
+
+void catalog_build(void);
+void catalog_io(uint32_t bus);
+
+#endif
@@ -0,0 +1,207 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// dsk.c - Disk image (.DSK) on the SD card served as a Nextor block device
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include "pico/stdlib.h"
+#include "ff.h"
+#include "diskio.h"
+#include "dsk.h"
+
+#if !FF_USE_FASTSEEK
+#error "The DSK mode needs the FatFs fast seek (FF_USE_FASTSEEK in ffconf.h)"
+#endif
+#if FF_MAX_SS != DSK_SECTOR_SIZE
+#error "The DSK mode expects 512-byte card sectors"
+#endif
+
+static FATFS dsk_fs;
+static FIL dsk_file;
+static DWORD dsk_link_map[2 + 2 * DSK_MAX_FRAGMENTS];  // Size, then cluster count and first cluster of each fragment
+static bool dsk_mounted = false;
+static uint32_t dsk_sector_count = 0;
+static uint8_t dsk_track[DSK_TRACK_SECTORS * DSK_SECTOR_SIZE];
+static uint32_t dsk_track_first = UINT32_MAX;          // First sector held by the track cache
+static uint32_t dsk_track_count = 0;                    // Sectors held, the last track of odd sized images is short
+
+// dsk_find - Open the first .DSK file of the root directory
+// Returns:
+//   true if an image was opened
+static bool dsk_find(void)
+{
+    DIR dir;
+    FILINFO info;
+    bool found = false;
+
+    if (f_opendir(&dir, "/") != FR_OK)
+    {
+        return false;
+    }
+    while (!found && f_readdir(&dir, &info) == FR_OK && info.fname[0])
+    {
+        size_t const length = strlen(info.fname);
+        if (!(info.fattrib & AM_DIR) && length > 4 && strcasecmp(info.fname + length - 4, ".DSK") == 0)
+        {
+            found = f_open(&dsk_file, info.fname, FA_READ | FA_WRITE) == FR_OK;
+            if (found)
+            {
+                printf("DSK: %s, %lu bytes\n", info.fname, (unsigned long)info.fsize);
+            }
+        }
+    }
+    f_closedir(&dir);
+    return found;
+}
+
+// dsk_mount - Mount the card and open the image, resolving its cluster chain
+// The image stays mounted for the session, the Nextor driver initializes the device more than once.
+// Returns:
+//   true if the image is ready
+bool dsk_mount(void)
+{
+    if (dsk_mounted)
+    {
+        return true;
+    }
+    if (f_mount(&dsk_fs, "", 1) != FR_OK || !dsk_find())
+    {
+        return false;
+    }
+    dsk_link_map[0] = sizeof(dsk_link_map) / sizeof(dsk_link_map[0]);
+    dsk_file.cltbl = dsk_link_map;
+    if (f_lseek(&dsk_file, CREATE_LINKMAP) != FR_OK) // FR_NOT_ENOUGH_CORE: too many fragments
+    {
+        printf("DSK: the image has more than %d fragments\n", DSK_MAX_FRAGMENTS);
+        f_close(&dsk_file);
+        return false;
+    }
+    dsk_sector_count = f_size(&dsk_file) / DSK_SECTOR_SIZE;
+    dsk_track_first = UINT32_MAX;
+    dsk_mounted = true;
+    return true;
+}
+
+// dsk_sectors - Size of the mounted image
+// Returns:
+//   Number of sectors of the image, 0 if none is mounted
+uint32_t dsk_sectors(void)
+{
+    return dsk_mounted ? dsk_sector_count : 0;
+}
+
+// dsk_run - Card block of a sector of the image, from the link map
+// Parameters:
+//   sector - Sector of the image
+//   block - Card block of the sector
+// Returns:
+//   Number of sectors from this one to the end of its fragment, contiguous on the card, 0 past the image
+static uint32_t dsk_run(uint32_t sector, LBA_t *block)
+{
+    uint32_t const cluster_size = dsk_fs.csize;
+    uint32_t cluster = sector / cluster_size;
+    for (const DWORD *fragment = &dsk_link_map[1]; fragment[0]; fragment += 2)
+    {
+        if (cluster < fragment[0])
+        {
+            *block = dsk_fs.database + (LBA_t)(fragment[1] - 2 + cluster) * cluster_size + sector % cluster_size;
+            return (fragment[0] - cluster) * cluster_size - sector % cluster_size;
+        }
+        cluster -= fragment[0];
+    }
+    return 0;
+}
+
+// dsk_transfer - Read or write sectors of the image, one card command per fragment
+// Parameters:
+//   buffer - Data of the sectors
+//   sector - First sector
+//   count - Number of sectors
+//   write - Write the sectors instead of reading them
+// Returns:
+//   true if every sector was transferred
+static bool dsk_transfer(uint8_t *buffer, uint32_t sector, uint32_t count, bool write)
+{
+    while (count)
+    {
+        LBA_t block;
+        uint32_t run = dsk_run(sector, &block);
+        if (run == 0)
+        {
+            return false;
+        }
+        if (run > count)
+        {
+            run = count;
+        }
+        DRESULT const dr = write ? disk_write(dsk_fs.pdrv, buffer, block, run)
+                                 : disk_read(dsk_fs.pdrv, buffer, block, run);
+        if (dr != RES_OK)
+        {
+            return false;
+        }
+        buffer += run * DSK_SECTOR_SIZE;
+        sector += run;
+        count -= run;
+    }
+    return true;
+}
+
+// dsk_read - Read a sector of the image through the track cache
+// Parameters:
+//   buffer - Receives the DSK_SECTOR_SIZE bytes of the sector
+//   sector - Sector of the image
+// Returns:
+//   true if the sector was read
+bool dsk_read(uint8_t *buffer, uint32_t sector)
+{
+    if (!dsk_mounted || sector >= dsk_sector_count)
+    {
+        return false;
+    }
+    if (sector - dsk_track_first >= dsk_track_count) // Miss, read the whole track
+    {
+        uint32_t const first = sector - sector % DSK_TRACK_SECTORS;
+        uint32_t count = dsk_sector_count - first;
+        if (count > DSK_TRACK_SECTORS)
+        {
+            count = DSK_TRACK_SECTORS;
+        }
+        dsk_track_first = UINT32_MAX;
+        dsk_track_count = 0;
+        if (!dsk_transfer(dsk_track, first, count, false))
+        {
+            return false;
+        }
+        dsk_track_first = first;
+        dsk_track_count = count;
+    }
+    memcpy(buffer, &dsk_track[(sector - dsk_track_first) * DSK_SECTOR_SIZE], DSK_SECTOR_SIZE);
+    return true;
+}
+
+// dsk_write - Write a sector of the image to the card
+// The data goes to the blocks of the file directly, its directory entry (size, date) is left as it is.
+// Parameters:
+//   buffer - The DSK_SECTOR_SIZE bytes of the sector
+//   sector - Sector of the image
+// Returns:
+//   true if the sector was written
+bool dsk_write(const uint8_t *buffer, uint32_t sector)
+{
+    if (!dsk_mounted || sector >= dsk_sector_count || !dsk_transfer((uint8_t *)buffer, sector, 1, true))
+    {
+        return false;
+    }
+    if (sector - dsk_track_first < dsk_track_count)
+    {
+        memcpy(&dsk_track[(sector - dsk_track_first) * DSK_SECTOR_SIZE], buffer, DSK_SECTOR_SIZE);
+    }
+    return true;
+}
@@ -0,0 +1,34 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// dsk.h - Disk image (.DSK) on the SD card served as a Nextor block device
+//
+// In DSK mode the Nextor bridge (nextor.c) answers the block reads and writes of the MSX from a floppy image on the SD
+// card instead of the raw card: the first .DSK file of the root directory, 720KB or any other size, which Nextor
+// mounts as a device without a partition table.
+// The cluster chain of the image is resolved once when it is mounted (the FatFs fast seek link map), so a sector is
+// turned into a card block with a walk over the fragments of the file, one for an image written in one go, and no FAT
+// sector is read afterwards. Reads go through a one-track cache: a miss reads the whole track of the sector from the
+// card, so the next sectors the MSX asks for (disks are read track by track) are served from SRAM. Writes go straight
+// to the card and update the cache.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef DSK_H
+#define DSK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define DSK_SECTOR_SIZE     512
+#define DSK_TRACK_SECTORS   9               // Sectors per track of the 360KB and 720KB MSX disks
+#define DSK_MAX_FRAGMENTS   32              // Fragments of the image the link map can hold
+
+bool dsk_mount(void);
+uint32_t dsk_sectors(void);
+bool dsk_read(uint8_t *buffer, uint32_t sector);
+bool dsk_write(const uint8_t *buffer, uint32_t sector);
+
+#endif
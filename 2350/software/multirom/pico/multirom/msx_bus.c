@@ -0,0 +1,178 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// msx_bus.c - CPU-free read engine for the MSX cartridge bus (PIO + chained DMA)
+//
+// Read path (no CPU involvement):
+//   sm_lookup  --RX--> ch_lookup --writes READ_ADDR_TRIG--> ch_page  (page_table[page] -> sm_fetch TX) --chain--> ch_lookup
+//   sm_fetch   --RX--> ch_fetch  --writes READ_ADDR_TRIG--> ch_data  (byte -> sm_output TX)           --chain--> ch_fetch
+//   sm_output drives D0-D7 until /RD goes high.
+// sm_fetch drops the reads of the unmapped pages (entry 0), so only the pages mapped by the loader drive the bus.
+// Write path: sm_write pushes (data << 16) | address for every slot write, the CPU decodes the bank registers.
+// ch_fetch runs MSX_BUS_READ_BATCH transfers before it stops: the chain from ch_data is ignored while it is busy and
+// restarts it once the batch is done, so its transfer counter counts the reads answered by the engine.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/pio.h"
+#include "hardware/dma.h"
+#include "hardware/structs/bus_ctrl.h"
+#include "hardware/structs/io_bank0.h"
+#include "multirom.h"
+#include "msx_bus.h"
+#include "msx_bus.pio.h"
+
+PIO msx_bus_pio = pio0;
+uint msx_bus_sm_write;
+
+// Page table read by DMA: one entry per 8KB page, holding the page base address >> 13.
+// The lookup state machine builds the entry address by OR-ing the page number, so the table must be 32 byte aligned.
+volatile uint32_t __attribute__((aligned(32))) msx_bus_page_table[MSX_BUS_PAGES];
+
+// 8KB of 0xFF answering the reads of cartridge pages that have no ROM behind them
+uint8_t __attribute__((aligned(MSX_BUS_PAGE_SIZE))) msx_bus_open_page[MSX_BUS_PAGE_SIZE];
+
+static uint sm_lookup, sm_fetch, sm_output;
+static int ch_lookup, ch_page, ch_fetch, ch_data;
+
+// msx_bus_init - Claim and configure the state machines and DMA channels of the read engine
+// Every page is left unmapped (not answered). Map the pages of the cartridge, then call msx_bus_start to hand the bus
+// over.
+void msx_bus_init(void)
+{
+    memset(msx_bus_open_page, 0xFF, sizeof(msx_bus_open_page));
+    for (int i = 0; i < MSX_BUS_PAGES; i++) {
+        msx_bus_unmap_page(i);
+    }
+
+    // DMA must win the bus against the CPU, every read has to complete inside the /RD window
+    bus_ctrl_hw->priority = BUSCTRL_BUS_PRIORITY_DMA_W_BITS | BUSCTRL_BUS_PRIORITY_DMA_R_BITS;
+
+    sm_lookup = pio_claim_unused_sm(msx_bus_pio, true);
+    sm_fetch = pio_claim_unused_sm(msx_bus_pio, true);
+    sm_output = pio_claim_unused_sm(msx_bus_pio, true);
+    msx_bus_sm_write = pio_claim_unused_sm(msx_bus_pio, true);
+
+    // Only the data bus is driven by the PIO, the address and control lines are just sampled
+    for (int i = 0; i < 8; i++) {
+        pio_gpio_init(msx_bus_pio, PIN_D0 + i);
+    }
+
+    // Page lookup
+    uint offset = pio_add_program(msx_bus_pio, &msx_read_lookup_program);
+    pio_sm_config c = msx_read_lookup_program_get_default_config(offset);
+    sm_config_set_in_pins(&c, PIN_A0);
+    sm_config_set_in_shift(&c, false, false, 32);
+    sm_config_set_out_shift(&c, true, false, 32);
+    sm_config_set_jmp_pin(&c, PIN_SLTSL);
+    pio_sm_init(msx_bus_pio, sm_lookup, offset, &c);
+    pio_sm_put(msx_bus_pio, sm_lookup, (uint32_t)msx_bus_page_table >> 5);
+
+    // Byte address builder
+    offset = pio_add_program(msx_bus_pio, &msx_read_fetch_program);
+    c = msx_read_fetch_program_get_default_config(offset);
+    sm_config_set_in_pins(&c, PIN_A0);
+    sm_config_set_in_shift(&c, false, false, 32);
+    sm_config_set_out_shift(&c, true, false, 32);
+    pio_sm_init(msx_bus_pio, sm_fetch, offset, &c);
+
+    // Data bus output
+    offset = pio_add_program(msx_bus_pio, &msx_read_output_program);
+    c = msx_read_output_program_get_default_config(offset);
+    sm_config_set_out_pins(&c, PIN_D0, 8);
+    sm_config_set_out_shift(&c, true, false, 32);
+    pio_sm_set_consecutive_pindirs(msx_bus_pio, sm_output, PIN_D0, 8, false);
+    pio_sm_init(msx_bus_pio, sm_output, offset, &c);
+
+    // Write capture
+    offset = pio_add_program(msx_bus_pio, &msx_write_capture_program);
+    c = msx_write_capture_program_get_default_config(offset);
+    sm_config_set_in_pins(&c, PIN_A0);
+    sm_config_set_in_shift(&c, false, false, 32);
+    sm_config_set_jmp_pin(&c, PIN_SLTSL);
+    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_RX);
+    pio_sm_init(msx_bus_pio, msx_bus_sm_write, offset, &c);
+
+    ch_lookup = dma_claim_unused_channel(true);
+    ch_page = dma_claim_unused_channel(true);
+    ch_fetch = dma_claim_unused_channel(true);
+    ch_data = dma_claim_unused_channel(true);
+
+    // ch_lookup: page entry address from sm_lookup -> ch_page read address (and trigger)
+    dma_channel_config dc = dma_channel_get_default_config(ch_lookup);
+    channel_config_set_transfer_data_size(&dc, DMA_SIZE_32);
+    channel_config_set_read_increment(&dc, false);
+    channel_config_set_write_increment(&dc, false);
+    channel_config_set_dreq(&dc, pio_get_dreq(msx_bus_pio, sm_lookup, false));
+    channel_config_set_high_priority(&dc, true);
+    dma_channel_configure(ch_lookup, &dc, &dma_hw->ch[ch_page].al3_read_addr_trig,
+                          &msx_bus_pio->rxf[sm_lookup], 1, false);
+
+    // ch_page: page base >> 13 -> sm_fetch, then re-arm ch_lookup
+    dc = dma_channel_get_default_config(ch_page);
+    channel_config_set_transfer_data_size(&dc, DMA_SIZE_32);
+    channel_config_set_read_increment(&dc, false);
+    channel_config_set_write_increment(&dc, false);
+    channel_config_set_dreq(&dc, pio_get_dreq(msx_bus_pio, sm_fetch, true));
+    channel_config_set_chain_to(&dc, ch_lookup);
+    channel_config_set_high_priority(&dc, true);
+    dma_channel_configure(ch_page, &dc, &msx_bus_pio->txf[sm_fetch], NULL, 1, false);
+
+    // ch_fetch: byte address from sm_fetch -> ch_data read address (and trigger), one per read for a whole batch
+    dc = dma_channel_get_default_config(ch_fetch);
+    channel_config_set_transfer_data_size(&dc, DMA_SIZE_32);
+    channel_config_set_read_increment(&dc, false);
+    channel_config_set_write_increment(&dc, false);
+    channel_config_set_dreq(&dc, pio_get_dreq(msx_bus_pio, sm_fetch, false));
+    channel_config_set_high_priority(&dc, true);
+    dma_channel_configure(ch_fetch, &dc, &dma_hw->ch[ch_data].al3_read_addr_trig,
+                          &msx_bus_pio->rxf[sm_fetch], MSX_BUS_READ_BATCH, false);
+
+    // ch_data: ROM byte -> sm_output, then re-arm ch_fetch when its batch is done
+    dc = dma_channel_get_default_config(ch_data);
+    channel_config_set_transfer_data_size(&dc, DMA_SIZE_8);
+    channel_config_set_read_increment(&dc, false);
+    channel_config_set_write_increment(&dc, false);
+    channel_config_set_dreq(&dc, pio_get_dreq(msx_bus_pio, sm_output, true));
+    channel_config_set_chain_to(&dc, ch_fetch);
+    channel_config_set_high_priority(&dc, true);
+    dma_channel_configure(ch_data, &dc, &msx_bus_pio->txf[sm_output], NULL, 1, false);
+}
+
+// msx_bus_start - Arm the DMA chains and let the state machines take over the bus
+void msx_bus_start(void)
+{
+    gpio_set_dir_in_masked(0xFF << 16); // The CPU must not drive the data bus anymore
+    dma_start_channel_mask((1u << ch_lookup) | (1u << ch_fetch));
+    pio_set_sm_mask_enabled(msx_bus_pio,
+                            (1u << sm_lookup) | (1u << sm_fetch) | (1u << sm_output) | (1u << msx_bus_sm_write),
+                            true);
+}
+
+// msx_bus_read_count - Reads answered by the engine in the current batch of ch_fetch
+// Returns:
+//   0 to MSX_BUS_READ_BATCH, the count starts again from 1 after MSX_BUS_READ_BATCH
+uint32_t __not_in_flash_func(msx_bus_read_count)(void)
+{
+    return MSX_BUS_READ_BATCH - (dma_hw->ch[ch_fetch].transfer_count & MSX_BUS_READ_BATCH);
+}
+
+// msx_bus_serve_io - Serve an I/O cycle with the CPU while the engine owns the data bus
+// The engine only answers slot cycles: the data bus pins are handed to SIO for the cycle and back to the PIO after it.
+// Parameters:
+//   serve - Handler of the cycle (perf_io), it drives the data bus with the SIO
+//   bus - GPIO snapshot of the cycle
+void __not_in_flash_func(msx_bus_serve_io)(void (*serve)(uint32_t bus), uint32_t bus)
+{
+    for (int i = 0; i < 8; i++) {
+        io_bank0_hw->io[PIN_D0 + i].ctrl = GPIO_FUNC_SIO << IO_BANK0_GPIO0_CTRL_FUNCSEL_LSB;
+    }
+    serve(bus);
+    for (int i = 0; i < 8; i++) {
+        io_bank0_hw->io[PIN_D0 + i].ctrl = GPIO_FUNC_PIO0 << IO_BANK0_GPIO0_CTRL_FUNCSEL_LSB; // msx_bus_pio
+    }
+}
@@ -50,8 +50,6 @@
 #define PIN_BUSSDIR 47  // Bus direction line 
 
 static inline void setup_gpio();
-unsigned long __no_inline_not_in_flash_func(read_ulong)(const unsigned char *ptr);
-int isEndOfData(const unsigned char *memory);
 
 int __no_inline_not_in_flash_func(loadrom_msx_menu)(uint32_t offset);
 void __no_inline_not_in_flash_func(loadrom_plain32)(uint32_t offset, bool cache_enable);
@@ -61,4 +59,6 @@ void __no_inline_not_in_flash_func(loadrom_konami)(uint32_t offset, bool cache_e
 void __no_inline_not_in_flash_func(loadrom_ascii8)(uint32_t offset, bool cache_enable);
 void __no_inline_not_in_flash_func(loadrom_ascii16)(uint32_t offset, bool cache_enable);
 void __no_inline_not_in_flash_func(loadrom_neo8)(uint32_t offset);
-void __no_inline_not_in_flash_func(loadrom_neo16)(uint32_t offset);
\ No newline at end of file
+void __no_inline_not_in_flash_func(loadrom_neo16)(uint32_t offset);
+void __no_inline_not_in_flash_func(loadrom_dma)(uint32_t offset, uint8_t mapper);
+void __no_inline_not_in_flash_func(loadrom_auto)(uint32_t offset);
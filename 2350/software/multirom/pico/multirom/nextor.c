@@ -20,6 +20,8 @@
 #include "hw_config.h"
 #include "multirom.h"
 #include "nextor.h"
+#include "dsk.h"
+#include "perf.h"
 
 
 #define NEXTOR_STATUS_READY       0x00
@@ -29,6 +31,8 @@
 
 #define NEXTOR_DATA_BUS_MASK      (0xFFu << DATA_PINS)
 
+static bool nextor_dsk = false; // Blocks come from a .DSK image on the card (dsk.h) instead of the raw card
+
 
 static inline void drive_data_bus(uint8_t value) {
     gpio_set_dir_out_masked(NEXTOR_DATA_BUS_MASK);
@@ -50,9 +54,39 @@ static inline void wait_for_io_cycle_end(uint32_t signal_mask, uint32_t iorq_mas
     }
 }
 
-// Nextor on SD Card I/O handler function
+// Block device of the bridge: the SD card, or the disk image in DSK mode
+static DSTATUS block_initialize(BYTE pdrv) {
+    if (nextor_dsk) {
+        return dsk_mount() ? 0 : STA_NOINIT;
+    }
+    return disk_initialize(pdrv);
+}
+
+static DRESULT block_capacity(BYTE pdrv, DWORD *capacity) {
+    if (nextor_dsk) {
+        *capacity = dsk_sectors();
+        return RES_OK;
+    }
+    return disk_ioctl(pdrv, GET_SECTOR_COUNT, capacity);
+}
+
+static DRESULT block_read(BYTE pdrv, BYTE *buffer, uint32_t block) {
+    if (nextor_dsk) {
+        return dsk_read(buffer, block) ? RES_OK : RES_ERROR;
+    }
+    return disk_read(pdrv, buffer, block, 1);
+}
+
+static DRESULT block_write(BYTE pdrv, const BYTE *buffer, uint32_t block) {
+    if (nextor_dsk) {
+        return dsk_write(buffer, block) ? RES_OK : RES_ERROR;
+    }
+    return disk_write(pdrv, buffer, block, 1);
+}
+
+// Nextor bridge I/O handler function
 // This function runs in core 1 and handles the Nextor SD Card I/O protocol
-void __not_in_flash_func(nextor_sd_io)(){
+static void __not_in_flash_func(nextor_bridge_io)(){
 
     uint8_t  data_response_buffer[512]; // Buffer for data responses
 
@@ -100,7 +134,7 @@ void __not_in_flash_func(nextor_sd_io)(){
                 switch (busdata) { // Command byte for the Nextor driver
                     case 0x01: // Initialize SD card
                         ctr_val = NEXTOR_STATUS_BUSY;
-                        ds = disk_initialize(pdrv);
+                        ds = block_initialize(pdrv);
                         ctr_val = (ds & STA_NOINIT) ? NEXTOR_STATUS_ERROR : NEXTOR_STATUS_READY;
                         break;
                     case 0x03: // Manufacturer ID
@@ -120,7 +154,7 @@ void __not_in_flash_func(nextor_sd_io)(){
                         ctr_val = NEXTOR_STATUS_BUSY;
                         if (!(ds & STA_NOINIT)) {
                             DWORD capacity = 0;
-                            DRESULT dr = disk_ioctl(pdrv, GET_SECTOR_COUNT, &capacity);
+                            DRESULT dr = block_capacity(pdrv, &capacity);
                             if (dr == RES_OK) {
                                 data_to_send = 4;
                                 data_byte_index = 0;
@@ -148,7 +182,7 @@ void __not_in_flash_func(nextor_sd_io)(){
                         } else {
                             block_address = *(uint32_t *)data_response_buffer;
                             ctr_val = NEXTOR_STATUS_BUSY;
-                            DRESULT dr = disk_read(pdrv, (BYTE *)data_response_buffer, block_address, 1);
+                            DRESULT dr = block_read(pdrv, (BYTE *)data_response_buffer, block_address);
                             if (dr == RES_OK) {
                                 data_to_send = 512;
                                 data_byte_index = 0;
@@ -168,7 +202,7 @@ void __not_in_flash_func(nextor_sd_io)(){
                         ctr_val = NEXTOR_STATUS_BUSY;
                         block_address++;
                         {
-                            DRESULT dr = disk_read(pdrv, (BYTE *)data_response_buffer, block_address, 1);
+                            DRESULT dr = block_read(pdrv, (BYTE *)data_response_buffer, block_address);
                             if (dr == RES_OK) {
                                 data_to_send = 512;
                                 data_byte_index = 0;
@@ -220,7 +254,7 @@ void __not_in_flash_func(nextor_sd_io)(){
                 if (!read_address && (data_to_receive == 0) && (data_byte_index >= 512)) { // Full block received for write
                     // Write the block to the SD card
                     ctr_val = NEXTOR_STATUS_BUSY;
-                    DRESULT dr = disk_write(pdrv, (BYTE *)data_response_buffer, block_address, 1);
+                    DRESULT dr = block_write(pdrv, (BYTE *)data_response_buffer, block_address);
                     if (dr == RES_OK) {
                         ctr_val = NEXTOR_STATUS_READY;
                     } else {
@@ -236,6 +270,10 @@ void __not_in_flash_func(nextor_sd_io)(){
 
         if (rd) { // Read transaction: the MSX is reading from the port.
             if (port == 0x9E) { // Port 0x9E (Control Read): Return the control/status register.
+                PERF_COUNT(io_polls);
+                if (ctr_val == NEXTOR_STATUS_BUSY) {
+                    PERF_COUNT(io_busy);
+                }
                 drive_data_bus(ctr_val);
                 wait_for_io_cycle_end(pin_mask_rd, pin_mask_iorq);
                 release_data_bus();
@@ -259,3 +297,15 @@ void __not_in_flash_func(nextor_sd_io)(){
         }
     }
 }
+
+// Nextor on SD Card I/O handler function, the blocks are the ones of the card
+void __not_in_flash_func(nextor_sd_io)(){
+    nextor_dsk = false;
+    nextor_bridge_io();
+}
+
+// Nextor on a disk image I/O handler function, the blocks are the sectors of the first .DSK file of the card
+void __not_in_flash_func(nextor_dsk_io)(){
+    nextor_dsk = true;
+    nextor_bridge_io();
+}
@@ -27,4 +27,5 @@ extern volatile bool usb_device_info_valid;
 extern usb_device_info_t usb_device_info;
 
 void __not_in_flash_func(nextor_sd_io)();
+void __not_in_flash_func(nextor_dsk_io)();
 void __not_in_flash_func(nextor_usb_io)();
\ No newline at end of file
@@ -0,0 +1,191 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// nextor_ram.c - Nextor cartridge with a memory mapper in an expanded slot
+//
+// This file is shared as-is by the RP2040 and RP2350 firmwares.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#include "pico/stdlib.h"
+#include "multirom.h"
+#include "nextor_ram.h"
+#include "perf.h"
+
+volatile uint8_t nextor_secondary_slot_reg = 0;
+volatile uint8_t nextor_mapper_segments[4] = { 3, 2, 1, 0 };   // Layout the MSX2 BIOS leaves behind
+uint32_t nextor_mapper_size = 0;
+
+// nextor_ram_run - Serve the MSX bus as the expanded Nextor slot (never returns)
+// Every 16KB page has a read pointer and a write pointer, NULL when the selected sub-slot has nothing there, that the
+// writes to the sub-slot register, to the segment registers and to the kernel bank registers keep up to date, so a
+// cycle costs one table lookup whatever the sub-slot. On the RP2040 kernel reads from flash hold the MSX with WAIT.
+// Parameters:
+//   rom - Nextor kernel (ASCII16 ROM)
+//   rom_size - Size of the kernel in bytes
+//   rom_in_flash - The kernel is read from the XIP flash
+//   ram - Memory of the mapper
+//   ram_size - Size of that memory in bytes (whole 16KB segments are used)
+void __no_inline_not_in_flash_func(nextor_ram_run)(const uint8_t *rom, uint32_t rom_size, bool rom_in_flash,
+                                                    uint8_t *ram, uint32_t ram_size)
+{
+    const uint8_t *read_ptr[4];             // 16KB block read on each page, NULL if the sub-slot leaves it empty
+    uint8_t *write_ptr[4];                  // 16KB block written on each page, NULL if it is not mapper RAM
+    const uint8_t *rom_bank[2];             // Kernel banks on 4000h and 8000h
+    uint8_t *ram_page[4];                   // Mapper segments selected for each page
+    uint32_t rom_mask = 1;                  // Kernel bank numbers wrap on the ROM size (power of two)
+    uint8_t subslot = 0;
+#if PICO_RP2040
+    uint8_t flash_pages = 0;                // Pages read from flash
+#else
+    (void)rom_in_flash;
+#endif
+
+    while ((rom_mask << NEXTOR_MAPPER_SHIFT) < rom_size)
+    {
+        rom_mask <<= 1;
+    }
+    rom_mask--;
+    nextor_mapper_size = ram_size >> NEXTOR_MAPPER_SHIFT;
+    if (nextor_mapper_size > NEXTOR_MAPPER_MAX_SEGMENTS)
+    {
+        nextor_mapper_size = NEXTOR_MAPPER_MAX_SEGMENTS;
+    }
+    nextor_secondary_slot_reg = 0;
+    rom_bank[0] = rom;
+    rom_bank[1] = rom + NEXTOR_MAPPER_SEGMENT_SIZE;
+    for (uint8_t page = 0; page < 4; page++)
+    {
+        nextor_mapper_segments[page] = 3 - page;
+        ram_page[page] = ram + (((3u - page) % nextor_mapper_size) << NEXTOR_MAPPER_SHIFT);
+    }
+
+    // Recompute the pointers of a page from the sub-slot register
+#if PICO_RP2040
+#define NEXTOR_RAM_SELECT(page)                                                                                 \
+    do {                                                                                                        \
+        uint8_t const _sub = (subslot >> (2 * (page))) & 3;                                                     \
+        bool const _rom = (_sub == NEXTOR_ROM_SUBSLOT) && ((page) == 1 || (page) == 2);                         \
+        write_ptr[(page)] = (_sub == NEXTOR_RAM_SUBSLOT) ? ram_page[(page)] : NULL;                             \
+        read_ptr[(page)] = _rom ? rom_bank[((page) - 1) & 1] : write_ptr[(page)];                               \
+        flash_pages = (flash_pages & ~(1u << (page))) | ((uint8_t)(_rom && rom_in_flash) << (page));            \
+    } while (0)
+#else
+#define NEXTOR_RAM_SELECT(page)                                                                                 \
+    do {                                                                                                        \
+        uint8_t const _sub = (subslot >> (2 * (page))) & 3;                                                     \
+        bool const _rom = (_sub == NEXTOR_ROM_SUBSLOT) && ((page) == 1 || (page) == 2);                         \
+        write_ptr[(page)] = (_sub == NEXTOR_RAM_SUBSLOT) ? ram_page[(page)] : NULL;                             \
+        read_ptr[(page)] = _rom ? rom_bank[((page) - 1) & 1] : write_ptr[(page)];                               \
+    } while (0)
+#endif
+
+    for (uint8_t page = 0; page < 4; page++)
+    {
+        NEXTOR_RAM_SELECT(page);
+    }
+
+    gpio_set_dir_in_masked(0xFF << 16); // Set data bus to input mode
+    while (true)
+    {
+        // One snapshot of the bus per iteration: control lines, address and data are sampled together
+        uint32_t const bus = gpio_get_all();
+
+        if (!(bus & (1u << PIN_SLTSL))) // Slot selected (active low)
+        {
+            uint16_t const addr = bus & 0x00FFFF; // Address bus
+            uint8_t const page = addr >> NEXTOR_MAPPER_SHIFT;
+            if (!(bus & (1u << PIN_RD))) // Read cycle (active low)
+            {
+                const uint8_t *const block = read_ptr[page];
+                if (block || addr == NEXTOR_SUBSLOT_REG)
+                {
+                    uint32_t const perf_start = PERF_READ_START();
+                    gpio_set_dir_out_masked(0xFF << 16); // Set data bus to output mode
+                    uint8_t data;
+                    if (addr == NEXTOR_SUBSLOT_REG)
+                    {
+                        data = ~subslot;
+                    }
+#if PICO_RP2040
+                    else if (flash_pages & (1u << page))
+                    {
+                        gpio_put(PIN_WAIT, 0);
+                        data = block[addr & (NEXTOR_MAPPER_SEGMENT_SIZE - 1)];
+                        gpio_put(PIN_WAIT, 1);
+                    }
+#endif
+                    else
+                    {
+                        data = block[addr & (NEXTOR_MAPPER_SEGMENT_SIZE - 1)];
+                    }
+                    gpio_put_masked(0xFF0000, (uint32_t)data << 16); // Write the data to the data bus
+                    PERF_READ_DONE(perf_start);
+                    while (!(gpio_get(PIN_RD)))  // Wait until the read cycle completes (RD goes high)
+                    {
+                        tight_loop_contents();
+                    }
+                    gpio_set_dir_in_masked(0xFF << 16); // Return data bus to input mode after cycle completes
+                }
+            }
+            else if (!(bus & (1u << PIN_WR))) // Write cycle (active low)
+            {
+                uint8_t const data = (bus >> 16) & 0xFF;
+                PERF_COUNT(writes);
+                if (addr == NEXTOR_SUBSLOT_REG)
+                {
+                    subslot = data;
+                    nextor_secondary_slot_reg = data;
+                    for (uint8_t p = 0; p < 4; p++)
+                    {
+                        NEXTOR_RAM_SELECT(p);
+                    }
+                }
+                else if (write_ptr[page])
+                {
+                    write_ptr[page][addr & (NEXTOR_MAPPER_SEGMENT_SIZE - 1)] = data;
+                }
+                else if (page == 1 && ((subslot >> 2) & 3) == NEXTOR_ROM_SUBSLOT && (addr & 0xE800) == 0x6000)
+                {
+                    // ASCII16 bank register: 6000h-67FFh for 4000h-7FFFh, 7000h-77FFh for 8000h-BFFFh
+                    uint8_t const bank = (addr >> 12) & 1;
+                    PERF_COUNT(bank_switches);
+                    rom_bank[bank] = rom + ((data & rom_mask) << NEXTOR_MAPPER_SHIFT);
+                    NEXTOR_RAM_SELECT(1);
+                    NEXTOR_RAM_SELECT(2);
+                }
+                while (!(gpio_get(PIN_WR)))
+                {
+                    tight_loop_contents();
+                }
+            }
+        }
+        else if (!(bus & (1u << PIN_IORQ)) && !(bus & (1u << PIN_WR)) &&
+                 (bus & 0xFCu) == NEXTOR_MAPPER_PORT) // Segment register write
+        {
+            uint8_t const page = bus & 0x03;
+            uint8_t const data = (bus >> 16) & 0xFF;
+            PERF_COUNT(bank_switches);
+            nextor_mapper_segments[page] = data;
+            ram_page[page] = ram + ((data % nextor_mapper_size) << NEXTOR_MAPPER_SHIFT);
+            switch (page) // Constant page numbers, so the select macro folds
+            {
+                case 0: NEXTOR_RAM_SELECT(0); break;
+                case 1: NEXTOR_RAM_SELECT(1); break;
+                case 2: NEXTOR_RAM_SELECT(2); break;
+                default: NEXTOR_RAM_SELECT(3); break;
+            }
+            while (!(gpio_get(PIN_WR)))
+            {
+                tight_loop_contents();
+            }
+        }
+        else
+        {
+            PERF_IO(bus);
+        }
+    }
+#undef NEXTOR_RAM_SELECT
+}
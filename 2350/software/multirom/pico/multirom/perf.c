@@ -0,0 +1,100 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// perf.c - Bus engine performance counters
+//
+// This file is shared as-is by the RP2040 and RP2350 firmwares.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "multirom.h"
+#include "perf.h"
+
+perf_counters_t __uninitialized_ram(perf);      // Running session, kept across a soft reset
+perf_counters_t perf_last;                      // Session before the last reset (magic is 0 if there was none)
+
+static perf_counters_t perf_latched;            // Block being read through PERF_PORT
+static uint32_t perf_latched_index = sizeof(perf_latched);
+
+// perf_init - Keep the counters of the previous session and start a new one
+// Also starts the SysTick counter on the system clock, it is used to time the reads.
+void perf_init(void)
+{
+#if PICOVERSE_PERF
+    memset(&perf_last, 0, sizeof(perf_last));
+    if (perf.magic == PERF_MAGIC)
+    {
+        perf_last = perf;
+    }
+    memset(&perf, 0, sizeof(perf));
+    perf.magic = PERF_MAGIC;
+
+    systick_hw->rvr = 0x00FFFFFFu;
+    systick_hw->cvr = 0;
+    systick_hw->csr = (1u << 2) | (1u << 0);    // CLKSOURCE = processor clock, ENABLE, no interrupt
+#endif
+}
+
+// perf_io - Serve an I/O cycle on PERF_PORT
+// Parameters:
+//   bus - GPIO snapshot of the cycle (IORQ active, port on A0-A7)
+void __no_inline_not_in_flash_func(perf_io)(uint32_t bus)
+{
+    if (!(bus & (1u << PIN_RD)))
+    {
+        uint8_t const data = (perf_latched_index < sizeof(perf_latched)) ?
+                             ((const uint8_t *)&perf_latched)[perf_latched_index++] : 0xFF;
+        gpio_set_dir_out_masked(0xFF << 16); // Set data bus to output mode
+        gpio_put_masked(0xFF0000, (uint32_t)data << 16);
+        while (!(gpio_get(PIN_RD)))
+        {
+            tight_loop_contents();
+        }
+        gpio_set_dir_in_masked(0xFF << 16); // Return data bus to input mode
+    }
+    else if (!(bus & (1u << PIN_WR)))
+    {
+        perf_latched = (((bus >> 16) & 0xFF) == PERF_CMD_LAST) ? perf_last : perf;
+        perf_latched_index = 0;
+        while (!(gpio_get(PIN_WR)))
+        {
+            tight_loop_contents();
+        }
+    }
+}
+
+// perf_dump - Print a counter block on stdio
+// Parameters:
+//   counters - Counter block
+//   title - Heading printed before the counters
+void perf_dump(const perf_counters_t *counters, const char *title)
+{
+    static const char *const bucket_names[PERF_HIST_BUCKETS] = {
+        "<8", "8-15", "16-31", "32-63", "64-127", "128-255", "256-511", "512+"
+    };
+
+    if (counters->magic != PERF_MAGIC)
+    {
+        return;
+    }
+    printf("%s (mapper %u)\n", title, counters->mapper);
+    printf("  reads %lu, writes %lu, bank switches %lu\n", (unsigned long)counters->reads,
+           (unsigned long)counters->writes, (unsigned long)counters->bank_switches);
+    printf("  cache hits %lu, misses %lu\n", (unsigned long)counters->cache_hits, (unsigned long)counters->cache_misses);
+    printf("  nextor polls %lu, busy %lu\n", (unsigned long)counters->io_polls, (unsigned long)counters->io_busy);
+    if (counters->flags & PERF_FLAG_NO_LATENCY)
+    {
+        printf("  read latency not measured by this engine\n");
+        return;
+    }
+    printf("  read latency max %lu cycles\n", (unsigned long)counters->latency_max);
+    for (int i = 0; i < PERF_HIST_BUCKETS; i++)
+    {
+        printf("  %8s cycles: %lu\n", bucket_names[i], (unsigned long)counters->latency_hist[i]);
+    }
+}
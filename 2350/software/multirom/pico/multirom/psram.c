@@ -0,0 +1,176 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// psram.c - QSPI PSRAM on the second QMI chip select (RP2350)
+//
+// The chip is taken out of QPI mode (it stays in it across a reset of the Pico that does not cycle the power) and reset,
+// probed in QMI direct mode with the SPI Read ID command, switched to QPI mode and then the QMI window 1 is set up for quad reads (0xEB) and quad writes (0x38) with timings computed from the current system clock. The
+// firmware runs from SRAM (PICO_COPY_TO_RAM), so taking the QMI out of XIP mode while probing is safe.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "hardware/sync.h"
+#include "hardware/structs/qmi.h"
+#include "hardware/structs/xip_ctrl.h"
+#include "psram.h"
+
+#define PSRAM_CMD_READ_ID       0x9F
+#define PSRAM_CMD_RESET_EN      0x66
+#define PSRAM_CMD_RESET         0x99
+#define PSRAM_CMD_QPI_ENTER     0x35
+#define PSRAM_CMD_QPI_EXIT      0xF5
+#define PSRAM_CMD_QUAD_READ     0xEB
+#define PSRAM_CMD_QUAD_WRITE    0x38
+#define PSRAM_KGD               0x5D    // Known good die marker returned by Read ID
+
+size_t psram_size = 0;
+
+// psram_direct_xfer - Send one byte in QMI direct mode and return the byte clocked in at the same time
+static uint8_t __no_inline_not_in_flash_func(psram_direct_xfer)(uint8_t data, bool quad)
+{
+    qmi_hw->direct_tx = (quad ? QMI_DIRECT_TX_IWIDTH_VALUE_Q << QMI_DIRECT_TX_IWIDTH_LSB : 0) | data;
+    while (!(qmi_hw->direct_csr & QMI_DIRECT_CSR_TXEMPTY_BITS))
+    {
+        tight_loop_contents();
+    }
+    while (qmi_hw->direct_csr & QMI_DIRECT_CSR_BUSY_BITS)
+    {
+        tight_loop_contents();
+    }
+    return (uint8_t)qmi_hw->direct_rx;
+}
+
+// psram_direct_cmd - Send a one byte command in QMI direct mode, with the chip select pulse around it
+static void __no_inline_not_in_flash_func(psram_direct_cmd)(uint8_t cmd, bool quad)
+{
+    qmi_hw->direct_csr |= QMI_DIRECT_CSR_ASSERT_CS1N_BITS;
+    psram_direct_xfer(cmd, quad);
+    qmi_hw->direct_csr &= ~QMI_DIRECT_CSR_ASSERT_CS1N_BITS;
+    for (volatile int delay = 0; delay < 20; delay++)
+    {
+        tight_loop_contents();
+    }
+}
+
+// psram_detect - Reset the PSRAM, read its ID and return its size
+static size_t __no_inline_not_in_flash_func(psram_detect)(void)
+{
+    uint8_t kgd = 0;
+    uint8_t eid = 0;
+
+    // A chip left in QPI mode by the previous run ignores the SPI commands. In SPI mode the QPI exit is only two clocks
+    // of an unfinished command, which the chip drops when the chip select goes high
+    psram_direct_cmd(PSRAM_CMD_QPI_EXIT, true);
+    psram_direct_cmd(PSRAM_CMD_RESET_EN, false);
+    psram_direct_cmd(PSRAM_CMD_RESET, false);
+
+    qmi_hw->direct_csr |= QMI_DIRECT_CSR_ASSERT_CS1N_BITS;
+    for (int i = 0; i < 7; i++)
+    {
+        // Command, three address bytes, then the MFID, KGD and EID bytes
+        uint8_t const data = psram_direct_xfer((i == 0) ? PSRAM_CMD_READ_ID : 0xFF, false);
+        if (i == 5)
+        {
+            kgd = data;
+        }
+        else if (i == 6)
+        {
+            eid = data;
+        }
+    }
+    qmi_hw->direct_csr &= ~QMI_DIRECT_CSR_ASSERT_CS1N_BITS;
+
+    if (kgd != PSRAM_KGD)
+    {
+        return 0;
+    }
+
+    // The density is in the top three bits of the EID (APS6404L reports 0x26, 8MB)
+    switch (eid >> 5)
+    {
+        case 0: return 2u * 1024u * 1024u;
+        case 1: return 4u * 1024u * 1024u;
+        default: return 8u * 1024u * 1024u;
+    }
+}
+
+// psram_init - Probe the PSRAM on QMI CS1 and map it at PSRAM_BASE
+// Must be called after the system clock has been set, the QMI timings are derived from it.
+// Returns:
+//   PSRAM size in bytes, 0 when no PSRAM answers (the chip select pin is then returned to its default function)
+size_t __no_inline_not_in_flash_func(psram_init)(void)
+{
+    gpio_set_function(PSRAM_CS_PIN, GPIO_FUNC_XIP_CS1);
+
+    uint32_t const irq_state = save_and_disable_interrupts();
+
+    // Direct mode, slow clock for the probe and the mode switch commands
+    qmi_hw->direct_csr = 30 << QMI_DIRECT_CSR_CLKDIV_LSB | QMI_DIRECT_CSR_EN_BITS;
+    while (qmi_hw->direct_csr & QMI_DIRECT_CSR_BUSY_BITS)
+    {
+        tight_loop_contents();
+    }
+
+    size_t const size = psram_detect();
+    if (size)
+    {
+        psram_direct_cmd(PSRAM_CMD_QPI_ENTER, false);
+    }
+    qmi_hw->direct_csr &= ~QMI_DIRECT_CSR_EN_BITS;
+
+    if (size)
+    {
+        // Timings: clock <= PSRAM_MAX_FREQ, CS asserted at most 8us (refresh), deasserted at least 18ns
+        uint32_t const clock_hz = clock_get_hz(clk_sys);
+        uint32_t divisor = (clock_hz + PSRAM_MAX_FREQ - 1) / PSRAM_MAX_FREQ;
+        if (divisor == 1 && clock_hz > 100000000u)
+        {
+            divisor = 2;
+        }
+        uint32_t rxdelay = divisor;
+        if (clock_hz / divisor > 100000000u)
+        {
+            rxdelay++;
+        }
+        uint32_t const period_fs = (uint32_t)(1000000000000000ull / clock_hz);
+        uint32_t const max_select = (125u * 1000000u) / period_fs;     // 8us in units of 64 system clocks
+        uint32_t const min_deselect = (18u * 1000000u + period_fs - 1) / period_fs - (divisor + 1) / 2;
+
+        qmi_hw->m[1].timing = 1u << QMI_M1_TIMING_COOLDOWN_LSB |
+                              QMI_M1_TIMING_PAGEBREAK_VALUE_1024 << QMI_M1_TIMING_PAGEBREAK_LSB |
+                              max_select << QMI_M1_TIMING_MAX_SELECT_LSB |
+                              min_deselect << QMI_M1_TIMING_MIN_DESELECT_LSB |
+                              rxdelay << QMI_M1_TIMING_RXDELAY_LSB |
+                              divisor << QMI_M1_TIMING_CLKDIV_LSB;
+        qmi_hw->m[1].rfmt = QMI_M1_RFMT_PREFIX_WIDTH_VALUE_Q << QMI_M1_RFMT_PREFIX_WIDTH_LSB |
+                            QMI_M1_RFMT_ADDR_WIDTH_VALUE_Q << QMI_M1_RFMT_ADDR_WIDTH_LSB |
+                            QMI_M1_RFMT_SUFFIX_WIDTH_VALUE_Q << QMI_M1_RFMT_SUFFIX_WIDTH_LSB |
+                            QMI_M1_RFMT_DUMMY_WIDTH_VALUE_Q << QMI_M1_RFMT_DUMMY_WIDTH_LSB |
+                            QMI_M1_RFMT_DATA_WIDTH_VALUE_Q << QMI_M1_RFMT_DATA_WIDTH_LSB |
+                            QMI_M1_RFMT_PREFIX_LEN_VALUE_8 << QMI_M1_RFMT_PREFIX_LEN_LSB |
+                            6u << QMI_M1_RFMT_DUMMY_LEN_LSB;
+        qmi_hw->m[1].rcmd = PSRAM_CMD_QUAD_READ;
+        qmi_hw->m[1].wfmt = QMI_M1_WFMT_PREFIX_WIDTH_VALUE_Q << QMI_M1_WFMT_PREFIX_WIDTH_LSB |
+                            QMI_M1_WFMT_ADDR_WIDTH_VALUE_Q << QMI_M1_WFMT_ADDR_WIDTH_LSB |
+                            QMI_M1_WFMT_SUFFIX_WIDTH_VALUE_Q << QMI_M1_WFMT_SUFFIX_WIDTH_LSB |
+                            QMI_M1_WFMT_DUMMY_WIDTH_VALUE_Q << QMI_M1_WFMT_DUMMY_WIDTH_LSB |
+                            QMI_M1_WFMT_DATA_WIDTH_VALUE_Q << QMI_M1_WFMT_DATA_WIDTH_LSB |
+                            QMI_M1_WFMT_PREFIX_LEN_VALUE_8 << QMI_M1_WFMT_PREFIX_LEN_LSB;
+        qmi_hw->m[1].wcmd = PSRAM_CMD_QUAD_WRITE;
+
+        xip_ctrl_hw->ctrl |= XIP_CTRL_WRITABLE_M1_BITS; // Allow writes through the XIP window 1
+    }
+
+    restore_interrupts(irq_state);
+
+    if (!size)
+    {
+        gpio_init(PSRAM_CS_PIN);
+    }
+    psram_size = size;
+    return size;
+}
@@ -0,0 +1,33 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// psram.h - QSPI PSRAM on the second QMI chip select (RP2350)
+//
+// PicoVerse 2350 boards can be modded with a QSPI PSRAM (APS6404L or compatible) wired to the QMI chip select 1. CS1
+// can only be routed to GPIO 0, 8, 19 and 47: the first three are MSX bus lines and GPIO 47 drives BUSSDIR on the
+// stock board (PIN_BUSSDIR), so the mod has to free GPIO 47 from BUSSDIR before the firmware is built with
+// PICOVERSE_PSRAM. Once psram_init() has run, the PSRAM is memory mapped through the XIP cache at PSRAM_BASE, exactly
+// like the flash is at XIP_BASE, so the mapper engines can serve ROM data from it without any change.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef PSRAM_H
+#define PSRAM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef PSRAM_CS_PIN
+#define PSRAM_CS_PIN    47              // QMI CS1 (XIP_CS1 function), BUSSDIR on boards without the PSRAM mod
+#endif
+
+#define PSRAM_BASE      ((uint8_t *)0x11000000u)    // QMI window 1, cached
+#define PSRAM_MAX_FREQ  133000000u                  // APS6404L max clock (linear bursts)
+
+extern size_t psram_size;                           // Detected PSRAM size in bytes, 0 if there is none
+
+size_t psram_init(void);
+
+#endif
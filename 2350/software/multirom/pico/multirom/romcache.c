@@ -0,0 +1,155 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// romcache.c - Demand-paged ROM segment cache
+//
+// The SRAM cache is split in 8KB slots. Each slot holds one 8KB segment of the ROM and every page of the MSX address
+// space pins the slot it is mapped on. A bank switch to a segment that is not resident asserts WAIT, picks a victim
+// with the clock algorithm (skipping pinned slots), copies the segment from flash and releases WAIT. The reference bit
+// of a slot is set every time it is mapped, so the segments the game keeps switching back to stay resident.
+// ROMs that are not plain bytes in the flash (segments, romlz.h) are read through romload_read instead of copied.
+//
+// This file is shared as-is by the RP2040 and RP2350 firmwares.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#include <string.h>
+#include "pico/stdlib.h"
+#include "multirom.h"
+#include "romcache.h"
+#include "romload.h"
+#include "perf.h"
+
+#define ROMCACHE_FREE   0xFF    // Marks a segment that is not resident
+
+bool romcache_enabled = false;
+
+static const uint8_t *cache_flash;                      // ROM data in flash
+static uint8_t *cache_slots;                            // SRAM slots (slot_count * 8KB)
+static uint32_t cache_slot_count;
+static uint32_t cache_segment_mask;                     // ROM size rounded up to a power of two, in segments, minus one
+static uint8_t slot_of[ROMCACHE_MAX_SEGMENTS];          // Slot holding each segment, ROMCACHE_FREE if not resident
+static uint16_t segment_of[ROMCACHE_MAX_SLOTS];         // Segment held by each slot
+static uint8_t slot_pins[ROMCACHE_MAX_SLOTS];           // Number of pages mapped on each slot
+static bool slot_ref[ROMCACHE_MAX_SLOTS];               // Clock reference bit
+static uint8_t page_slot[ROMCACHE_PAGES];               // Slot mapped on each page, ROMCACHE_FREE if none
+static uint32_t clock_hand;
+
+// romcache_fill - Copy a segment of the ROM into a slot
+static void __no_inline_not_in_flash_func(romcache_fill)(uint32_t slot, uint32_t segment)
+{
+    uint8_t *const data = &cache_slots[slot << ROMCACHE_SLOT_SHIFT];
+    if (romload_read == NULL)
+    {
+        memcpy(data, &cache_flash[segment << ROMCACHE_SLOT_SHIFT], ROMCACHE_SLOT_SIZE);
+    }
+    else if (!romload_read(data, segment << ROMCACHE_SLOT_SHIFT, ROMCACHE_SLOT_SIZE))
+    {
+        memset(data, 0xFF, ROMCACHE_SLOT_SIZE); // Read error, the segment reads as open bus
+    }
+}
+
+// romcache_init - Split the SRAM cache in slots and preload it with the first segments of the ROM
+// The MSX is held with WAIT while the slots are filled.
+// Parameters:
+//   flash - ROM data in the XIP flash (not used when romload_read is set)
+//   rom_size - ROM size in bytes
+//   slots - 8KB aligned SRAM buffer of slot_count * 8KB
+//   slot_count - Number of slots (at most ROMCACHE_MAX_SLOTS)
+void __no_inline_not_in_flash_func(romcache_init)(const uint8_t *flash, uint32_t rom_size, uint8_t *slots, uint32_t slot_count)
+{
+    uint32_t segments = 1;
+    while ((segments << ROMCACHE_SLOT_SHIFT) < rom_size && segments < ROMCACHE_MAX_SEGMENTS) {
+        segments <<= 1;
+    }
+
+    cache_flash = flash;
+    cache_slots = slots;
+    cache_slot_count = (slot_count > ROMCACHE_MAX_SLOTS) ? ROMCACHE_MAX_SLOTS : slot_count;
+    cache_segment_mask = segments - 1;
+    clock_hand = 0;
+    memset(slot_of, ROMCACHE_FREE, sizeof(slot_of));
+    memset(page_slot, ROMCACHE_FREE, sizeof(page_slot));
+    memset(slot_pins, 0, sizeof(slot_pins));
+    memset(slot_ref, 0, sizeof(slot_ref));
+
+    gpio_init(PIN_WAIT);
+    gpio_set_dir(PIN_WAIT, GPIO_OUT);
+    gpio_put(PIN_WAIT, 0);
+    for (uint32_t slot = 0; slot < cache_slot_count; slot++)
+    {
+        segment_of[slot] = slot & cache_segment_mask;
+        if (slot_of[segment_of[slot]] == ROMCACHE_FREE)
+        {
+            slot_of[segment_of[slot]] = slot;
+        }
+        romcache_fill(slot, segment_of[slot]);
+    }
+    gpio_put(PIN_WAIT, 1);
+    romcache_enabled = true;
+}
+
+// romcache_victim - Pick the slot to evict with the clock algorithm, never a slot mapped on a page
+static uint32_t __no_inline_not_in_flash_func(romcache_victim)(void)
+{
+    while (true)
+    {
+        uint32_t const slot = clock_hand;
+        clock_hand = (clock_hand + 1 == cache_slot_count) ? 0 : clock_hand + 1;
+        if (slot_pins[slot])
+        {
+            continue;
+        }
+        if (slot_ref[slot])
+        {
+            slot_ref[slot] = false; // Second chance
+            continue;
+        }
+        return slot;
+    }
+}
+
+// romcache_map - Map an 8KB ROM segment on a page of the MSX address space
+// On a miss the MSX is held with WAIT while the segment is copied from flash, so this is meant to be called from the
+// bank register write cycle.
+// Parameters:
+//   page - Page number (address >> 13)
+//   segment - 8KB segment number inside the ROM (wraps around the ROM size)
+// Returns:
+//   SRAM address of the segment
+const uint8_t *__no_inline_not_in_flash_func(romcache_map)(uint8_t page, uint32_t segment)
+{
+    segment &= cache_segment_mask;
+    uint32_t slot = slot_of[segment];
+
+    if (page_slot[page] != ROMCACHE_FREE)
+    {
+        slot_pins[page_slot[page]]--;
+    }
+
+    if (slot == ROMCACHE_FREE)
+    {
+        PERF_COUNT(cache_misses);
+        gpio_put(PIN_WAIT, 0);
+        slot = romcache_victim();
+        if (slot_of[segment_of[slot]] == slot)
+        {
+            slot_of[segment_of[slot]] = ROMCACHE_FREE;
+        }
+        romcache_fill(slot, segment);
+        segment_of[slot] = segment;
+        slot_of[segment] = slot;
+        gpio_put(PIN_WAIT, 1);
+    }
+    else
+    {
+        PERF_COUNT(cache_hits);
+    }
+
+    slot_ref[slot] = true;
+    slot_pins[slot]++;
+    page_slot[page] = slot;
+    return &cache_slots[slot << ROMCACHE_SLOT_SHIFT];
+}
@@ -0,0 +1,34 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// romcache.h - Demand-paged ROM segment cache
+//
+// ROMs bigger than the SRAM cache are served from a set of 8KB SRAM slots instead of falling back to XIP flash reads.
+// When the MSX maps a segment that is not resident, the MSX is held with WAIT while the segment is copied from flash
+// into a free slot (clock replacement, slots mapped on a page are never evicted), so every byte read by the Z80 comes
+// from SRAM no matter how big the ROM is.
+//
+// This file is shared as-is by the RP2040 and RP2350 firmwares.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef ROMCACHE_H
+#define ROMCACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ROMCACHE_SLOT_SHIFT     13                              // 8KB slots, the MSX mapper granularity
+#define ROMCACHE_SLOT_SIZE      (1u << ROMCACHE_SLOT_SHIFT)
+#define ROMCACHE_MAX_SLOTS      64                              // Up to 512KB of SRAM slots
+#define ROMCACHE_MAX_SEGMENTS   2048                            // Up to 16MB ROMs (the whole flash)
+#define ROMCACHE_PAGES          8                               // 64KB address space / 8KB
+
+extern bool romcache_enabled;
+
+void romcache_init(const uint8_t *flash, uint32_t rom_size, uint8_t *slots, uint32_t slot_count);
+const uint8_t *romcache_map(uint8_t page, uint32_t segment);
+
+#endif
@@ -0,0 +1,89 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// romconfig.c - ROM library written by the multirom tool after the menu (configuration area, format v2)
+//
+// This file is shared as-is by the RP2040 and RP2350 firmwares.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "romconfig.h"
+
+static const romconfig_record_t *config_records;   // Record table in the flash
+static const char *config_names;                    // Name pool in the flash
+static uint32_t config_count = 0;                   // Records of the flash
+static const romconfig_record_t *extra_records;     // Records appended in RAM
+static const char *extra_names;
+static uint32_t extra_count = 0;
+
+// romconfig_open - Check the header of the configuration area and locate its record table and name pool
+// Parameters:
+//   image - Start of the image (the menu ROM)
+// Returns:
+//   true if the area is a configuration of this format, otherwise the library is empty
+bool romconfig_open(const uint8_t *image)
+{
+    romconfig_header_t header;
+
+    memcpy(&header, image + ROMCONFIG_OFFSET, sizeof(header));
+    config_count = 0;
+    extra_count = 0;
+    if (header.magic != ROMCONFIG_MAGIC || header.version != ROMCONFIG_VERSION ||
+        header.count > ROMCONFIG_MAX_RECORDS || header.records < ROMCONFIG_OFFSET + sizeof(header) ||
+        (header.records & 3) != 0)
+    {
+        printf("Debug: No ROM configuration of version %d\n", ROMCONFIG_VERSION);
+        return false;
+    }
+    config_records = (const romconfig_record_t *)(image + header.records);
+    config_names = (const char *)(image + header.names);
+    config_count = header.count;
+    return true;
+}
+
+// romconfig_append - Append a table of records in RAM to the ones of the flash
+// Parameters:
+//   records - Records, their name offsets are in names
+//   names - Name pool of those records
+//   count - Number of records, cut to ROMCONFIG_MAX_RECORDS in all
+void romconfig_append(const romconfig_record_t *records, const char *names, uint32_t count)
+{
+    extra_records = records;
+    extra_names = names;
+    extra_count = (count < ROMCONFIG_MAX_RECORDS - config_count) ? count : ROMCONFIG_MAX_RECORDS - config_count;
+}
+
+// romconfig_count - Number of records, flash and RAM
+uint32_t __no_inline_not_in_flash_func(romconfig_count)(void)
+{
+    return config_count + extra_count;
+}
+
+// romconfig_flash_count - Number of records of the flash, the RAM ones follow
+uint32_t romconfig_flash_count(void)
+{
+    return config_count;
+}
+
+// romconfig_record - Record of a ROM
+// Parameters:
+//   index - Record index, below romconfig_count()
+// Returns:
+//   The record, in place
+const romconfig_record_t *__no_inline_not_in_flash_func(romconfig_record)(uint32_t index)
+{
+    return (index < config_count) ? &config_records[index] : &extra_records[index - config_count];
+}
+
+// romconfig_name - Name of a ROM, romconfig_record(index)->name_length characters not NUL terminated
+// Parameters:
+//   index - Record index, below romconfig_count()
+const char *__no_inline_not_in_flash_func(romconfig_name)(uint32_t index)
+{
+    return ((index < config_count) ? config_names : extra_names) + romconfig_record(index)->name;
+}
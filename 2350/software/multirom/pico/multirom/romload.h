@@ -0,0 +1,45 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// romload.h - Progressive background copy of a ROM to SRAM on core 1
+//
+// Instead of holding the MSX with WAIT while the whole ROM is copied, core 1 copies it 8KB segment by segment, the
+// boot segments (the ones mapped when the cartridge starts, with the AB header) first. Core 0 keeps serving segments
+// that are not copied yet from flash and switches each page to SRAM as soon as its segment is ready.
+// ROMs that are not in flash (the SD card of the RP2350, sdrom.h) or not as plain bytes (shared or compressed
+// segments, romlz.h) are read through romload_read instead, the MSX held with WAIT when it needs a segment that is not
+// in yet. The segment cache (romcache.h) reads them through it as well.
+//
+// This file is shared as-is by the RP2040 and RP2350 firmwares.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef ROMLOAD_H
+#define ROMLOAD_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ROMLOAD_SEGMENT_SHIFT   13                          // 8KB segments
+#define ROMLOAD_SEGMENT_SIZE    (1u << ROMLOAD_SEGMENT_SHIFT)
+#define ROMLOAD_MAX_SEGMENTS    32                          // One bit per segment (256KB)
+
+extern volatile uint32_t romload_ready;                     // Bit n is set once segment n is in SRAM
+extern uint32_t romload_all;                                // Bits of every segment being copied (0 when idle)
+extern void (*romload_next)(void);                          // Run by core 1 once the copy is done (NULL to stop)
+extern bool (*romload_read)(uint8_t *buffer, uint32_t offset, uint32_t length); // Reads the ROM (NULL: the flash)
+
+void romload_start(const uint8_t *flash, uint8_t *sram, uint32_t size, uint32_t segments, uint32_t boot_mask);
+void romload_wait(uint32_t mask);
+
+// romload_is_ready - Check if a segment can be read from SRAM
+// Parameters:
+//   segment - 8KB segment number
+static inline bool romload_is_ready(uint32_t segment)
+{
+    return (segment < ROMLOAD_MAX_SEGMENTS) && ((romload_ready >> segment) & 1u);
+}
+
+#endif
@@ -0,0 +1,223 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// scc.c - Konami SCC sound chip emulation (RP2350)
+//
+// Bus side (overlay page and register write queue) and the wavetable synthesizer. Each channel is a 32-bit phase
+// accumulator whose top 5 bits index its waveform, the five channels are multiplied by their volume and summed with
+// the dual 16-bit multiply-accumulate and the saturation of the Cortex-M33 DSP extension (plain C on the host).
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#include <string.h>
+#include "pico/stdlib.h"
+#include "multirom.h"
+#include "scc.h"
+#if defined(__ARM_FEATURE_DSP)
+#include <arm_acle.h>
+#endif
+
+uint8_t __attribute__((aligned(8192))) scc_page[8192]; // 8KB aligned so the DMA engine can serve it
+uint8_t scc_plus_regs[2048];
+uint32_t scc_queue[SCC_QUEUE_SIZE];
+volatile uint32_t scc_queue_head = 0;
+volatile uint32_t scc_queue_tail = 0;
+uint32_t scc_queue_dropped = 0;
+
+static uint32_t scc_page_key = 0xFFFFFFFFu;     // ROM offset of the segment copied into scc_page
+
+// scc_bus_reset - Clear the waveform registers of the overlay page and of the enhanced mode, and empty the queue
+// Called on the bus core before the cartridge starts.
+void scc_bus_reset(void)
+{
+    for (uint32_t mirror = 0; mirror < sizeof(scc_plus_regs); mirror += 0x100)
+    {
+        memset(&scc_page[SCC_REG_OFFSET + mirror], 0x00, SCC_WAVES * SCC_WAVE_LENGTH);
+        memset(&scc_page[SCC_REG_OFFSET + mirror + SCC_WAVES * SCC_WAVE_LENGTH], 0xFF,
+               0x100 - SCC_WAVES * SCC_WAVE_LENGTH); // Write-only
+        memset(&scc_plus_regs[mirror], 0x00, SCC_CHANNELS * SCC_WAVE_LENGTH);
+        memset(&scc_plus_regs[mirror + SCC_CHANNELS * SCC_WAVE_LENGTH], 0xFF, 0x100 - SCC_CHANNELS * SCC_WAVE_LENGTH);
+    }
+    scc_page_key = 0xFFFFFFFFu;
+    scc_queue_tail = 0;
+    scc_queue_head = 0;
+    scc_queue_dropped = 0;
+}
+
+// scc_overlay - Page to map on 8000h-9FFFh when the chip gets enabled
+// The ROM part of the page (8000h-97FFh) is copied from the segment selected by the bank register, only when it is
+// not the one already there, holding the MSX with WAIT while copying. In practice the copy is done once per game.
+// Parameters:
+//   segment - 8KB block the bank register selects
+//   key - ROM offset of that block
+// Returns:
+//   scc_page
+const uint8_t *__no_inline_not_in_flash_func(scc_overlay)(const uint8_t *segment, uint32_t key)
+{
+    if (key != scc_page_key)
+    {
+        gpio_put(PIN_WAIT, 0);
+        memcpy(scc_page, segment, SCC_REG_OFFSET);
+        gpio_put(PIN_WAIT, 1);
+        scc_page_key = key;
+    }
+    return scc_page;
+}
+
+// scc_update_step - Phase increment of a channel from its period
+static void scc_update_step(scc_t *scc, int channel)
+{
+    uint32_t const period = scc->period[channel];
+    scc->step[channel] = (period < SCC_MIN_PERIOD) ? 0 :
+                         (uint32_t)(((uint64_t)SCC_CLOCK << 27) / ((uint64_t)(period + 1) * scc->rate));
+}
+
+// scc_reset - Power-on state: silent, every register cleared
+// Parameters:
+//   scc - Synthesizer state
+//   rate - Output sample rate
+void scc_reset(scc_t *scc, uint32_t rate)
+{
+    memset(scc, 0, sizeof(*scc));
+    scc->rate = rate;
+}
+
+// scc_write - Apply a register write
+// Parameters:
+//   scc - Synthesizer state
+//   reg - Register (address & FFh), with SCC_PLUS for the enhanced mode layout
+//   data - Byte written by the MSX
+void __no_inline_not_in_flash_func(scc_write)(scc_t *scc, uint16_t reg, uint8_t data)
+{
+    if (reg & SCC_PLUS)
+    {
+        reg &= 0xFF;
+        if (reg < SCC_CHANNELS * SCC_WAVE_LENGTH)
+        {
+            scc->wave[reg / SCC_WAVE_LENGTH][reg % SCC_WAVE_LENGTH] = (int8_t)data;
+            return;
+        }
+        if (reg >= 0xC0)
+        {
+            return;                     // Deformation register and unused space
+        }
+    }
+    else
+    {
+        if (reg < SCC_WAVES * SCC_WAVE_LENGTH)
+        {
+            scc->wave[reg / SCC_WAVE_LENGTH][reg % SCC_WAVE_LENGTH] = (int8_t)data;
+            if (reg >= (SCC_WAVES - 1) * SCC_WAVE_LENGTH)
+            {
+                scc->wave[SCC_CHANNELS - 1][reg % SCC_WAVE_LENGTH] = (int8_t)data; // Channel 5 follows channel 4
+            }
+            return;
+        }
+        if (reg >= 0xA0)
+        {
+            return;                     // Deformation register and unused space
+        }
+    }
+
+    reg &= 0x0F;                        // Mirrors of 9880h-988Fh (B8A0h-B8AFh)
+    if (reg < 2 * SCC_CHANNELS)
+    {
+        int const channel = reg >> 1;
+        scc->period[channel] = (reg & 1) ? ((scc->period[channel] & 0x0FF) | ((data & 0x0F) << 8)) :
+                                           ((scc->period[channel] & 0xF00) | data);
+        scc_update_step(scc, channel);
+    }
+    else if (reg < 3 * SCC_CHANNELS)
+    {
+        scc->volume[reg - 2 * SCC_CHANNELS] = data & 0x0F;
+    }
+    else
+    {
+        scc->enable = data & 0x1F;
+    }
+}
+
+// scc_drain - Apply the register writes posted by the bus core
+void __no_inline_not_in_flash_func(scc_drain)(scc_t *scc)
+{
+    uint32_t tail = scc_queue_tail;
+    uint32_t const head = scc_queue_head;
+    __dmb(); // Read the entries after the head that published them
+
+    while (tail != head)
+    {
+        uint32_t const entry = scc_queue[tail & (SCC_QUEUE_SIZE - 1)];
+        scc_write(scc, entry & 0xFFFF, entry >> 16);
+        tail++;
+    }
+    scc_queue_tail = tail;
+}
+
+// scc_mac2 - acc + lo(a) * lo(b) + hi(a) * hi(b), signed 16-bit halves
+static inline int32_t scc_mac2(uint32_t a, uint32_t b, int32_t acc)
+{
+#if defined(__ARM_FEATURE_DSP)
+    return __smlad(a, b, acc);
+#else
+    return acc + (int16_t)a * (int16_t)b + (int16_t)(a >> 16) * (int16_t)(b >> 16);
+#endif
+}
+
+// scc_sat16 - Clamp to a signed 16-bit sample
+static inline int32_t scc_sat16(int32_t value)
+{
+#if defined(__ARM_FEATURE_SAT)
+    return __ssat(value, 16);
+#else
+    return (value > 32767) ? 32767 : (value < -32768) ? -32768 : value;
+#endif
+}
+
+// scc_render - Mix the five channels into stereo frames
+// Both 16-bit halves of a frame carry the same sample, so a frame is both the word the I2S state machine shifts out
+// and a little-endian 16-bit stereo WAV frame.
+// Parameters:
+//   scc - Synthesizer state
+//   frames - Output buffer
+//   count - Number of frames to render
+void __no_inline_not_in_flash_func(scc_render)(scc_t *scc, uint32_t *frames, uint32_t count)
+{
+    // Silent and disabled channels get a zero volume, so the mix loop has no branch
+    uint32_t step[SCC_CHANNELS];
+    uint32_t phase[SCC_CHANNELS];
+    int32_t volume[SCC_CHANNELS];
+    for (int ch = 0; ch < SCC_CHANNELS; ch++)
+    {
+        step[ch] = scc->step[ch];
+        phase[ch] = scc->phase[ch];
+        volume[ch] = (step[ch] && (scc->enable & (1u << ch))) ? scc->volume[ch] : 0;
+    }
+    uint32_t const volumes01 = (uint16_t)volume[0] | ((uint32_t)volume[1] << 16);
+    uint32_t const volumes23 = (uint16_t)volume[2] | ((uint32_t)volume[3] << 16);
+    const int8_t *const wave4 = scc->wave[SCC_CHANNELS - 1];
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint32_t const samples01 = (uint16_t)scc->wave[0][phase[0] >> 27] | ((uint32_t)scc->wave[1][phase[1] >> 27] << 16);
+        uint32_t const samples23 = (uint16_t)scc->wave[2][phase[2] >> 27] | ((uint32_t)scc->wave[3][phase[3] >> 27] << 16);
+        int32_t mix = wave4[phase[4] >> 27] * volume[4];
+        mix = scc_mac2(samples01, volumes01, mix);
+        mix = scc_mac2(samples23, volumes23, mix);
+
+        // Five channels at full scale are +-9600, x4 uses most of the 16-bit range
+        uint32_t const sample = (uint16_t)scc_sat16(mix * 4);
+        frames[i] = (sample << 16) | sample;
+
+        for (int ch = 0; ch < SCC_CHANNELS; ch++)
+        {
+            phase[ch] += step[ch];
+        }
+    }
+
+    for (int ch = 0; ch < SCC_CHANNELS; ch++)
+    {
+        scc->phase[ch] = phase[ch];
+    }
+}
@@ -0,0 +1,120 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// scc.h - Konami SCC sound chip emulation (RP2350)
+//
+// The Konami SCC mapper shows the SCC registers on 9800h-9FFFh (mirrored every 256 bytes) while bank 2 selects a
+// segment whose low six bits are all set (3Fh, 7Fh, ...):
+//   9800h-987Fh  waveforms of channels 1-4, 32 signed samples each (channel 5 plays the waveform of channel 4)
+//   9880h-9889h  12-bit period of channels 1-5, low byte first, frequency = SCC_CLOCK / (32 * (period + 1))
+//   988Ah-988Eh  4-bit volume of channels 1-5
+//   988Fh        channel enable bits
+//   9890h-989Fh  mirror of 9880h-988Fh
+// The SCC-I of the Sound Cartridge (SCC+, sccplus.h) has the same chip in compatible mode, and an enhanced mode on
+// B800h-BFFFh where channel 5 has a waveform of its own:
+//   B800h-B89Fh  waveforms of channels 1-5
+//   B8A0h-B8AFh  periods, volumes and enable, like 9880h-988Fh, mirrored on B8B0h-B8BFh
+// In compatible mode the writes to the waveform of channel 4 also set the one of channel 5.
+// The bus core (the mapper engines) keeps an 8KB page with the 6KB of ROM of that segment followed by the waveform
+// registers, so reads of the SCC are served like any other page, and posts every register write to a lock-free queue.
+// Core 1 drains the queue, mixes the five channels in fixed point and streams the samples to the I2S expansion
+// header (scc_audio.c). The synthesizer itself has no hardware dependency, the host simulator renders bus traces to
+// WAV files with it.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef SCC_H
+#define SCC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hardware/sync.h"
+
+#define SCC_CLOCK           3579545u    // MSX CPU clock, the SCC counters run on it
+#define SCC_SAMPLE_RATE     44100u      // I2S output rate
+#define SCC_CHANNELS        5
+#define SCC_WAVES           4           // Waveforms of the compatible mode, channel 5 shares the one of channel 4
+#define SCC_WAVE_LENGTH     32
+#define SCC_MIN_PERIOD      8           // Shorter periods are above 13kHz, the Konami drivers use them as "off"
+#define SCC_BANK            2           // Bank register that enables the chip
+#define SCC_PAGE            4           // 8KB page of the bank (8000h-9FFFh)
+#define SCC_BASE            0x9800      // First address of the registers
+#define SCC_REG_OFFSET      0x1800      // Offset of the registers inside the page
+#define SCC_PLUS_BASE       0xB800      // First address of the registers in enhanced mode (SCC+)
+#define SCC_PLUS            0x100       // Register number flag: enhanced mode layout (scc_write())
+#define SCC_QUEUE_SIZE      1024        // Register writes in flight between the cores (power of two)
+
+// scc_enabled - Check if a write to the bank register enables the chip
+static inline bool scc_enabled(uint8_t data)
+{
+    return (data & 0x3F) == 0x3F;
+}
+
+// Synthesizer state
+typedef struct {
+    int8_t wave[SCC_CHANNELS][SCC_WAVE_LENGTH];
+    uint16_t period[SCC_CHANNELS];
+    uint8_t volume[SCC_CHANNELS];
+    uint8_t enable;                     // Bit n enables channel n
+    uint32_t phase[SCC_CHANNELS];       // Wave position, the top 5 bits index the waveform
+    uint32_t step[SCC_CHANNELS];        // Phase increment per output sample, 0 when the channel is silent
+    uint32_t rate;                      // Output sample rate
+} scc_t;
+
+extern uint8_t scc_page[8192];                  // Page mapped on 8000h-9FFFh while the chip is enabled
+extern uint8_t scc_plus_regs[2048];             // Registers read on B800h-BFFFh in enhanced mode (SCC+)
+extern uint32_t scc_queue[SCC_QUEUE_SIZE];      // (data << 16) | register, SCC_PLUS set in enhanced mode
+extern volatile uint32_t scc_queue_head;        // Written by the bus core only
+extern volatile uint32_t scc_queue_tail;        // Written by the synthesizer only
+extern uint32_t scc_queue_dropped;              // Writes lost because the queue was full
+
+void scc_bus_reset(void);
+const uint8_t *scc_overlay(const uint8_t *segment, uint32_t key);
+void scc_reset(scc_t *scc, uint32_t rate);
+void scc_write(scc_t *scc, uint16_t reg, uint8_t data);
+void scc_drain(scc_t *scc);
+void scc_render(scc_t *scc, uint32_t *frames, uint32_t count);
+
+// scc_bus_write - Take a write to the SCC registers on the bus core
+// The waveform registers are copied to every mirror of the overlay page and of the enhanced mode registers, so they
+// read back in both modes, and the write is posted to the synthesizer. Nothing waits: when the queue is full the write
+// is dropped and counted.
+// Parameters:
+//   addr - Address of the write (9800h-9FFFh, B800h-BFFFh in enhanced mode)
+//   data - Byte written by the MSX
+static inline void scc_bus_write(uint16_t addr, uint8_t data)
+{
+    uint32_t const reg = (addr & 0xFF) | ((addr >> 5) & SCC_PLUS); // A13 tells B800h from 9800h
+    uint32_t const wave = reg & 0xFF;
+    if ((reg & SCC_PLUS) ? (wave < SCC_CHANNELS * SCC_WAVE_LENGTH) : (wave < SCC_WAVES * SCC_WAVE_LENGTH))
+    {
+        for (uint32_t mirror = 0; mirror < sizeof(scc_plus_regs); mirror += 0x100)
+        {
+            if (wave < SCC_WAVES * SCC_WAVE_LENGTH)
+            {
+                scc_page[SCC_REG_OFFSET + mirror + wave] = data;
+            }
+            scc_plus_regs[mirror + wave] = data;
+            if (!(reg & SCC_PLUS) && wave >= (SCC_WAVES - 1) * SCC_WAVE_LENGTH)
+            {
+                scc_plus_regs[mirror + wave + SCC_WAVE_LENGTH] = data; // Channel 5 follows channel 4
+            }
+        }
+    }
+
+    uint32_t const head = scc_queue_head;
+    if (head - scc_queue_tail < SCC_QUEUE_SIZE)
+    {
+        scc_queue[head & (SCC_QUEUE_SIZE - 1)] = ((uint32_t)data << 16) | reg;
+        __dmb(); // The entry must be visible to core 1 before the new head
+        scc_queue_head = head + 1;
+    }
+    else
+    {
+        scc_queue_dropped++;
+    }
+}
+
+#endif
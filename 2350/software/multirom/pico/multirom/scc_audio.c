@@ -0,0 +1,125 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// scc_audio.c - SCC synthesizer on core 1 with I2S output (RP2350)
+//
+// Playback path (no CPU involvement):
+//   scc_buffer[0] --ch_a--> sm_i2s TX FIFO  --chain--> ch_b: scc_buffer[1] --> sm_i2s TX FIFO  --chain--> ch_a ...
+// Core 1 polls the raw completion flags of the two channels. When one is set, its buffer is no longer read, so core 1
+// applies the register writes queued by the bus core, renders the buffer again and rewinds the channel before the
+// other one ends. Register writes therefore take effect with at most two buffers of latency.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/pio.h"
+#include "multirom.h"
+#include "romload.h"
+#include "scc.h"
+#include "scc_audio.h"
+#include "scc_audio.pio.h"
+
+static scc_t scc;
+static uint32_t scc_buffer[2][SCC_AUDIO_FRAMES];
+
+// scc_i2s_init - Start the I2S state machine and the two DMA channels on silent buffers
+// Parameters:
+//   channels - Receives the DMA channel of each buffer
+static void scc_i2s_init(int channels[2])
+{
+    PIO const pio = pio2;                   // pio0 belongs to the read engine, pio1 to the bus trace
+    uint const sm = pio_claim_unused_sm(pio, true);
+    uint const offset = pio_add_program(pio, &scc_i2s_program);
+
+    pio_gpio_init(pio, SCC_I2S_DATA_PIN);
+    pio_gpio_init(pio, SCC_I2S_CLOCK_PIN);
+    pio_gpio_init(pio, SCC_I2S_CLOCK_PIN + 1);
+    pio_sm_set_consecutive_pindirs(pio, sm, SCC_I2S_DATA_PIN, 1, true);
+    pio_sm_set_consecutive_pindirs(pio, sm, SCC_I2S_CLOCK_PIN, 2, true);
+
+    pio_sm_config c = scc_i2s_program_get_default_config(offset);
+    sm_config_set_out_pins(&c, SCC_I2S_DATA_PIN, 1);
+    sm_config_set_sideset_pins(&c, SCC_I2S_CLOCK_PIN);
+    sm_config_set_out_shift(&c, false, true, 32);
+    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_TX);
+
+    // Two instructions per bit, 32 bits per frame: 64 PIO cycles per sample, 8.8 fixed point divider
+    uint32_t const divider = (uint32_t)(((uint64_t)clock_get_hz(clk_sys) * 256u) / (SCC_SAMPLE_RATE * 64u));
+    sm_config_set_clkdiv_int_frac(&c, divider >> 8, divider & 0xFF);
+    pio_sm_init(pio, sm, offset + scc_i2s_offset_entry_point, &c);
+
+    channels[0] = dma_claim_unused_channel(true);
+    channels[1] = dma_claim_unused_channel(true);
+    for (int i = 0; i < 2; i++)
+    {
+        dma_channel_config dc = dma_channel_get_default_config(channels[i]);
+        channel_config_set_transfer_data_size(&dc, DMA_SIZE_32);
+        channel_config_set_read_increment(&dc, true);
+        channel_config_set_write_increment(&dc, false);
+        channel_config_set_dreq(&dc, pio_get_dreq(pio, sm, true));
+        channel_config_set_chain_to(&dc, channels[i ^ 1]);
+        dma_channel_configure(channels[i], &dc, &pio->txf[sm], scc_buffer[i], SCC_AUDIO_FRAMES, false);
+    }
+
+    memset(scc_buffer, 0, sizeof(scc_buffer));
+    dma_channel_start(channels[0]);
+    pio_sm_set_enabled(pio, sm, true);
+}
+
+// scc_audio_core1 - Core 1 entry: render the SCC into whichever buffer the DMA is done with, forever
+static void __no_inline_not_in_flash_func(scc_audio_core1)(void)
+{
+    int channels[2];
+
+    scc_reset(&scc, SCC_SAMPLE_RATE);
+    scc_i2s_init(channels);
+    while (true)
+    {
+        for (int i = 0; i < 2; i++)
+        {
+            uint32_t const done = 1u << channels[i];
+            while (!(dma_hw->intr & done))
+            {
+                scc_drain(&scc);            // Keep the queue short while the buffer plays
+            }
+            dma_hw->intr = done;
+            scc_drain(&scc);
+            scc_render(&scc, scc_buffer[i], SCC_AUDIO_FRAMES);
+            dma_channel_set_read_addr(channels[i], scc_buffer[i], false);
+        }
+    }
+}
+
+// scc_audio_init - Prepare the SCC emulation before the ROM starts
+// Must be called before the ROM copy is started (rom_cache_fill(), romload_start()), so core 1 moves on to the
+// synthesizer once it is done copying. WAIT is left to the loader, which may be holding the MSX with it.
+void scc_audio_init(void)
+{
+    scc_bus_reset();
+    romload_next = scc_audio_core1;
+}
+
+// scc_audio_launch - Restart core 1 on the synthesizer
+// For when core 1 is not copying a ROM chained to it (see scc_audio_start()), or was reset after the copy.
+void scc_audio_launch(void)
+{
+    multicore_reset_core1();
+    multicore_launch_core1(scc_audio_core1);
+}
+
+// scc_audio_start - Make sure core 1 runs the synthesizer
+// When romload was started after scc_audio_init(), core 1 gets to the synthesizer by itself once the copy is done.
+// Otherwise (ROM in PSRAM or demand-paged) core 1 is launched on it.
+void scc_audio_start(void)
+{
+    if (romload_all == 0)
+    {
+        scc_audio_launch();
+    }
+}
@@ -0,0 +1,30 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// scc_audio.h - SCC synthesizer on core 1 with I2S output (RP2350)
+//
+// Core 1 runs the synthesizer (scc.c) and feeds an I2S DAC on the expansion header through a PIO state machine on
+// pio2 and two DMA channels chained to each other, each one playing a buffer while core 1 refills the other. When the
+// ROM is copied to SRAM by romload, core 1 starts the synthesizer once the copy is done.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef SCC_AUDIO_H
+#define SCC_AUDIO_H
+
+#ifndef SCC_I2S_DATA_PIN
+#define SCC_I2S_DATA_PIN    37          // I2S expansion header: SDATA
+#endif
+#ifndef SCC_I2S_CLOCK_PIN
+#define SCC_I2S_CLOCK_PIN   38          // BCLK, LRCLK is the next pin
+#endif
+
+#define SCC_AUDIO_FRAMES    128         // Frames per DMA buffer (2.9ms at 44.1kHz)
+
+void scc_audio_init(void);
+void scc_audio_start(void);
+void scc_audio_launch(void);
+
+#endif
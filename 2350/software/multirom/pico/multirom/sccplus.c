@@ -0,0 +1,156 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// sccplus.c - Konami Sound Cartridge (SCC-I, SCC+) with 128KB of RAM
+//
+// This file is shared as-is by the RP2040 and RP2350 firmwares.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#include "pico/stdlib.h"
+#include "multirom.h"
+#include "sccplus.h"
+#include "perf.h"
+#if PICOVERSE_SCC
+#include "scc.h"
+#endif
+
+volatile uint8_t sccplus_mode = 0;
+
+// sccplus_run - Serve the MSX bus as the Sound Cartridge (never returns)
+// The bank table has a read pointer and a write pointer for every 2KB window, the write pointer NULL when the bank
+// is not in RAM mode, and the SCC registers replace the window they are on while the chip is enabled. Bank and mode
+// register writes update the table, so a RAM write costs one table lookup, like a read. With PICOVERSE_SCC the SCC
+// registers must have been cleared by scc_bus_reset().
+// Parameters:
+//   ram - The 128KB of RAM, loaded with the ROM image
+void __no_inline_not_in_flash_func(sccplus_run)(uint8_t *ram)
+{
+    const uint8_t *read_ptr[SCCPLUS_WINDOWS];   // 2KB block read on each window
+    uint8_t *write_ptr[SCCPLUS_WINDOWS];        // Same block while its bank is in RAM mode, NULL otherwise
+    uint8_t bank[4] = { 0, 1, 2, 3 };           // Bank register values
+    uint8_t writable = 0;                       // Bit n: bank n is in RAM mode
+    uint8_t mode = 0;
+#if PICOVERSE_SCC
+    uint16_t scc_window = 0;                    // SCC_BASE or SCC_PLUS_BASE while the chip is enabled, 0 otherwise
+#endif
+    sccplus_mode = 0;
+
+    // Last window of banks 2 and 3, the SCC registers are there in compatible and enhanced mode
+#if PICOVERSE_SCC
+#define SCCPLUS_SCC_SELECT()                                                                                    \
+    do {                                                                                                        \
+        scc_window = (mode & SCCPLUS_MODE_PLUS) ? ((bank[3] & 0x80) ? SCC_PLUS_BASE : 0) :                      \
+                                                  (scc_enabled(bank[2]) ? SCC_BASE : 0);                        \
+        read_ptr[SCC_BASE >> SCCPLUS_WINDOW_SHIFT] = (scc_window == SCC_BASE) ? &scc_page[SCC_REG_OFFSET] :     \
+            ram + ((bank[2] & SCCPLUS_SEGMENT_MASK) << 13) + 3 * SCCPLUS_WINDOW_SIZE;                           \
+        read_ptr[SCC_PLUS_BASE >> SCCPLUS_WINDOW_SHIFT] = (scc_window == SCC_PLUS_BASE) ? scc_plus_regs :      \
+            ram + ((bank[3] & SCCPLUS_SEGMENT_MASK) << 13) + 3 * SCCPLUS_WINDOW_SIZE;                           \
+    } while (0)
+#else
+#define SCCPLUS_SCC_SELECT()    ((void)0)
+#endif
+
+    // Recompute the four windows of a bank from its register and the mode register
+#define SCCPLUS_SELECT(b)                                                                                       \
+    do {                                                                                                        \
+        uint8_t *const _block = ram + ((bank[(b)] & SCCPLUS_SEGMENT_MASK) << 13);                               \
+        bool const _ram = (writable >> (b)) & 1;                                                                \
+        for (uint32_t _w = 0; _w < 4; _w++)                                                                     \
+        {                                                                                                       \
+            uint32_t const _window = ((0x4000 >> SCCPLUS_WINDOW_SHIFT) + 4 * (b)) + _w;                         \
+            read_ptr[_window] = _block + _w * SCCPLUS_WINDOW_SIZE;                                              \
+            write_ptr[_window] = _ram ? _block + _w * SCCPLUS_WINDOW_SIZE : NULL;                               \
+        }                                                                                                       \
+    } while (0)
+
+    for (uint32_t window = 0; window < SCCPLUS_WINDOWS; window++)
+    {
+        read_ptr[window] = NULL;
+        write_ptr[window] = NULL;
+    }
+    SCCPLUS_SELECT(0);
+    SCCPLUS_SELECT(1);
+    SCCPLUS_SELECT(2);
+    SCCPLUS_SELECT(3);
+    SCCPLUS_SCC_SELECT();
+
+    gpio_set_dir_in_masked(0xFF << 16); // Set data bus to input mode
+    while (true)
+    {
+        // One snapshot of the bus per iteration: control lines, address and data are sampled together
+        uint32_t const bus = gpio_get_all();
+
+        if (!(bus & (1u << PIN_SLTSL))) // Slot selected (active low)
+        {
+            uint16_t const addr = bus & 0x00FFFF; // Address bus
+            if ((uint16_t)(addr - 0x4000) < 0x8000) // 4000h-BFFFh (single unsigned compare)
+            {
+                uint8_t const window = addr >> SCCPLUS_WINDOW_SHIFT;
+                if (!(bus & (1u << PIN_RD))) // Read cycle (active low)
+                {
+                    uint32_t const perf_start = PERF_READ_START();
+                    gpio_set_dir_out_masked(0xFF << 16); // Set data bus to output mode
+                    uint8_t const data = read_ptr[window][addr & (SCCPLUS_WINDOW_SIZE - 1)];
+                    gpio_put_masked(0xFF0000, (uint32_t)data << 16); // Write the data to the data bus
+                    PERF_READ_DONE(perf_start);
+                    while (!(gpio_get(PIN_RD)))  // Wait until the read cycle completes (RD goes high)
+                    {
+                        tight_loop_contents();
+                    }
+                    gpio_set_dir_in_masked(0xFF << 16); // Return data bus to input mode after cycle completes
+                }
+                else if (!(bus & (1u << PIN_WR))) // Write cycle (active low)
+                {
+                    uint8_t const data = (bus >> 16) & 0xFF;
+                    PERF_COUNT(writes);
+                    if ((addr | 1) == (SCCPLUS_MODE_REG | 1))
+                    {
+                        mode = data;
+                        sccplus_mode = data;
+                        writable = (mode & SCCPLUS_MODE_RAM) ? 0x0F :
+                                   (mode & 0x03) | (((mode & 0x24) == 0x24) ? 0x04 : 0x00);
+                        SCCPLUS_SELECT(0);
+                        SCCPLUS_SELECT(1);
+                        SCCPLUS_SELECT(2);
+                        SCCPLUS_SELECT(3);
+                        SCCPLUS_SCC_SELECT();
+                    }
+                    else if (write_ptr[window])
+                    {
+                        write_ptr[window][addr & (SCCPLUS_WINDOW_SIZE - 1)] = data;
+                    }
+                    else if ((addr & 0x1800) == 0x1000) // Bank registers on 5000h, 7000h, 9000h and B000h
+                    {
+                        PERF_COUNT(bank_switches);
+                        switch ((addr >> 13) - 2) // Constant bank numbers, so the select macro folds
+                        {
+                            case 0: bank[0] = data; SCCPLUS_SELECT(0); break;
+                            case 1: bank[1] = data; SCCPLUS_SELECT(1); break;
+                            case 2: bank[2] = data; SCCPLUS_SELECT(2); SCCPLUS_SCC_SELECT(); break;
+                            default: bank[3] = data; SCCPLUS_SELECT(3); SCCPLUS_SCC_SELECT(); break;
+                        }
+                    }
+#if PICOVERSE_SCC
+                    else if ((addr & 0xF800) == scc_window)
+                    {
+                        scc_bus_write(addr, data);
+                    }
+#endif
+                    while (!(gpio_get(PIN_WR)))
+                    {
+                        tight_loop_contents();
+                    }
+                }
+            }
+        }
+        else
+        {
+            PERF_IO(bus);
+        }
+    }
+#undef SCCPLUS_SELECT
+#undef SCCPLUS_SCC_SELECT
+}
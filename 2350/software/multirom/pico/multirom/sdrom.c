@@ -0,0 +1,276 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// sdrom.c - ROM files of the SD card listed in the menu next to the flash library
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "hardware/sync.h"
+#include "ff.h"
+#include "automap.h"
+#include "sdrom.h"
+
+#define SDROM_SCANNING  0
+#define SDROM_DONE      1
+#define SDROM_CANCELLED 2
+
+// Detection result cached on the card, keyed by a hash of the file name and size
+typedef struct {
+    uint32_t key;
+    uint8_t mapper;
+    uint8_t reserved[3];
+} sdrom_map_entry_t;
+
+// Mapper tags of the file names, by mapper code (the multirom tool names, SYSTEM cannot be forced)
+static const char *const sdrom_tags[] = {
+    "PL-16", "PL-32", "KonSCC", "Linear", "ASC-08", "ASC-16", "Konami", "NEO-8", "NEO-16", NULL, "AUTO",
+    "ASC8SR", "ASC16S", "GM2", "SCC+",
+};
+
+static FATFS sdrom_fs;
+static FIL sdrom_file;
+static char sdrom_names[SDROM_MAX_FILES][13];                   // Short names, to open the files
+static uint32_t sdrom_keys[SDROM_MAX_FILES];
+static uint32_t sdrom_count = 0;
+static romconfig_record_t sdrom_records[SDROM_MAX_FILES];     // Built by core 1, appended to the flash records when done
+static char sdrom_record_names[SDROM_MAX_FILES * SDROM_NAME_LENGTH]; // Name pool of those records
+static sdrom_map_entry_t sdrom_map[SDROM_MAP_ENTRIES];
+static uint32_t sdrom_map_count = 0;
+static uint32_t scan_max_files;
+static uint32_t scan_max_size;
+static volatile uint32_t scan_state = SDROM_CANCELLED;
+static spin_lock_t *scan_lock;
+static uint32_t sdrom_selected_key = 0;
+
+// sdrom_key - Key of a file in the mapper cache
+static uint32_t sdrom_key(const char *name, uint32_t size)
+{
+    uint32_t hash = 2166136261u; // FNV-1a
+    for (; *name; name++)
+    {
+        hash = (hash ^ (uint8_t)*name) * 16777619u;
+    }
+    for (int i = 0; i < 4; i++)
+    {
+        hash = (hash ^ ((size >> (8 * i)) & 0xFF)) * 16777619u;
+    }
+    return hash;
+}
+
+// sdrom_map_load - Read the detection results cached on the card
+static void sdrom_map_load(void)
+{
+    FIL file;
+    UINT bytes_read = 0;
+
+    sdrom_map_count = 0;
+    if (f_open(&file, SDROM_MAP_FILE, FA_READ) == FR_OK)
+    {
+        if (f_read(&file, sdrom_map, sizeof(sdrom_map), &bytes_read) == FR_OK)
+        {
+            sdrom_map_count = bytes_read / sizeof(sdrom_map_entry_t);
+        }
+        f_close(&file);
+    }
+}
+
+// sdrom_mapper - Mapper of a ROM file: its tag, the cached detection result, or the size
+// Parameters:
+//   name - File name, the tag and the extension are cut from it
+//   size - File size
+//   key - Key of the file in the mapper cache
+// Returns:
+//   Mapper code
+static uint8_t sdrom_mapper(char *name, uint32_t size, uint32_t key)
+{
+    char *const tag = strrchr(name, '.');
+    if (tag != NULL)
+    {
+        for (uint32_t i = 0; i < sizeof(sdrom_tags) / sizeof(sdrom_tags[0]); i++)
+        {
+            if (sdrom_tags[i] != NULL && strcasecmp(tag + 1, sdrom_tags[i]) == 0)
+            {
+                *tag = '\0';
+                return i + 1;
+            }
+        }
+    }
+    for (uint32_t i = sdrom_map_count; i > 0; i--) // The latest result wins
+    {
+        if (sdrom_map[i - 1].key == key)
+        {
+            return sdrom_map[i - 1].mapper;
+        }
+    }
+    return (size <= SDROM_PLAIN_SIZE) ? 2 : AUTOMAP_CODE;
+}
+
+// sdrom_add - Make a ROM record of a directory entry
+// Parameters:
+//   info - Directory entry
+//   index - File index
+// Returns:
+//   true if the entry is a ROM that fits the board
+static bool sdrom_add(const FILINFO *info, uint32_t index)
+{
+    char name[sizeof(info->fname)];
+    size_t const length = strlen(info->fname);
+    uint32_t const size = (uint32_t)info->fsize;
+
+    if ((info->fattrib & AM_DIR) || length <= 4 || strcasecmp(info->fname + length - 4, ".ROM") != 0 ||
+        size < SDROM_MIN_SIZE || size > scan_max_size)
+    {
+        return false;
+    }
+#if FF_USE_LFN
+    strcpy(sdrom_names[index], (length <= 12) ? info->fname : info->altname); // Long names are opened by their SFN
+#else
+    strcpy(sdrom_names[index], info->fname);
+#endif
+    sdrom_keys[index] = sdrom_key(info->fname, size);
+    memcpy(name, info->fname, length - 4);
+    name[length - 4] = '\0';
+
+    romconfig_record_t *const record = &sdrom_records[index];
+    record->mapper = sdrom_mapper(name, size, sdrom_keys[index]);
+    record->name = index * SDROM_NAME_LENGTH;
+    record->name_length = strnlen(name, SDROM_NAME_LENGTH);
+    record->flags = 0;
+    record->size = size;
+    record->offset = SDROM_OFFSET | index;
+    memcpy(&sdrom_record_names[record->name], name, record->name_length);
+    return true;
+}
+
+// sdrom_scan_core1 - Core 1 entry: list the ROM files and hand the records to the menu
+static void sdrom_scan_core1(void)
+{
+    DIR dir;
+    FILINFO info;
+    uint32_t count = 0;
+
+    if (f_mount(&sdrom_fs, "", 1) == FR_OK)
+    {
+        sdrom_map_load();
+        if (f_opendir(&dir, "/") == FR_OK)
+        {
+            while (count < scan_max_files && f_readdir(&dir, &info) == FR_OK && info.fname[0])
+            {
+                if (sdrom_add(&info, count))
+                {
+                    count++;
+                }
+            }
+            f_closedir(&dir);
+        }
+    }
+
+    uint32_t const save = spin_lock_blocking(scan_lock);
+    if (scan_state == SDROM_SCANNING) // Core 0 did not give up waiting
+    {
+        sdrom_count = count;
+        scan_state = SDROM_DONE;
+    }
+    spin_unlock(scan_lock, save);
+}
+
+// sdrom_scan_start - List the ROM files of the card on core 1
+// Parameters:
+//   max_files - Number of files the menu can still list (at most SDROM_MAX_FILES are listed)
+//   max_size - Biggest ROM the board can hold
+void sdrom_scan_start(uint32_t max_files, uint32_t max_size)
+{
+    scan_max_files = (max_files < SDROM_MAX_FILES) ? max_files : SDROM_MAX_FILES;
+    scan_max_size = max_size;
+    if (scan_lock == NULL)
+    {
+        scan_lock = spin_lock_instance(spin_lock_claim_unused(true));
+    }
+    scan_state = SDROM_SCANNING;
+
+    multicore_reset_core1();
+    multicore_launch_core1(sdrom_scan_core1);
+}
+
+// sdrom_scan_wait - Wait until the ROM files are listed, at most SDROM_SCAN_TIMEOUT_MS, and append their records
+// Returns:
+//   true if the records of the card are in the menu, false if it was given up (no card, card too slow)
+bool sdrom_scan_wait(void)
+{
+    absolute_time_t const deadline = make_timeout_time_ms(SDROM_SCAN_TIMEOUT_MS);
+    while (scan_state == SDROM_SCANNING && !time_reached(deadline))
+    {
+        tight_loop_contents();
+    }
+
+    uint32_t const save = spin_lock_blocking(scan_lock);
+    if (scan_state == SDROM_SCANNING)
+    {
+        scan_state = SDROM_CANCELLED; // Core 1 will leave the menu alone
+    }
+    spin_unlock(scan_lock, save);
+    if (scan_state != SDROM_DONE)
+    {
+        return false;
+    }
+    romconfig_append(sdrom_records, sdrom_record_names, sdrom_count);
+    return true;
+}
+
+// sdrom_open - Open the file of an SD card record
+// Parameters:
+//   offset - Offset of the record (SDROM_OFFSET | file index)
+// Returns:
+//   true if the file is open for sdrom_read()
+bool sdrom_open(uint32_t offset)
+{
+    uint32_t const index = offset & ~SDROM_OFFSET;
+    if (scan_state != SDROM_DONE || index >= sdrom_count)
+    {
+        return false;
+    }
+    sdrom_selected_key = sdrom_keys[index];
+    return f_open(&sdrom_file, sdrom_names[index], FA_READ) == FR_OK;
+}
+
+// sdrom_read - Read bytes of the open ROM file (romload_read)
+// Whole sectors are read by FatFs straight into the buffer, with one multi-block command per run of clusters.
+// Parameters:
+//   buffer - Destination
+//   offset - Offset in the ROM
+//   length - Number of bytes
+// Returns:
+//   true if every byte was read
+bool sdrom_read(uint8_t *buffer, uint32_t offset, uint32_t length)
+{
+    UINT bytes_read = 0;
+    if (f_tell(&sdrom_file) != offset && f_lseek(&sdrom_file, offset) != FR_OK)
+    {
+        return false;
+    }
+    return f_read(&sdrom_file, buffer, length, &bytes_read) == FR_OK && bytes_read == length;
+}
+
+// sdrom_store_mapper - Append the mapper detected for the open ROM file to the cache on the card
+// Called with the MSX held by WAIT, core 1 must be done reading the file.
+// Parameters:
+//   mapper - Detected mapper code
+void sdrom_store_mapper(uint8_t mapper)
+{
+    FIL file;
+    UINT bytes_written = 0;
+    sdrom_map_entry_t const entry = { .key = sdrom_selected_key, .mapper = mapper, .reserved = { 0xFF, 0xFF, 0xFF } };
+
+    if (f_open(&file, SDROM_MAP_FILE, FA_WRITE | FA_OPEN_APPEND) == FR_OK)
+    {
+        f_write(&file, &entry, sizeof(entry), &bytes_written);
+        f_close(&file);
+    }
+}
@@ -0,0 +1,43 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// sdrom.h - ROM files of the SD card listed in the menu next to the flash library
+//
+// At boot core 1 mounts the card and lists the .ROM files of its root directory while core 0 serves the menu. Every
+// file that fits the board (the SRAM cache, or the PSRAM) becomes a ROM record of a table in RAM, appended to the
+// records of the flash image (romconfig.h), so the menu lists it like the others. The offset of those records has
+// SDROM_OFFSET set, the low bits are the index of the file. The MSX is only held with WAIT when the menu asks for the
+// list before it is done, at most SDROM_SCAN_TIMEOUT_MS, after which the card is left out for the session.
+// The mapper comes from a tag in the file name, as with the multirom tool ("Knight Mare.PL-32.ROM"), or from the
+// detection results cached on the card (SDROM_MAP_FILE). ROMs of 32KB or less are plain ROMs, the others are AUTO:
+// the firmware detects the mapper when the ROM runs (automap.h) and appends the result to the cache.
+// A selected ROM is read into the SRAM cache by core 1 with multi-block reads, segment by segment (romload.h), the
+// MSX held only until the boot segments are in. Bigger ROMs are read into the PSRAM upfront.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef SDROM_H
+#define SDROM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "romconfig.h"
+
+#define SDROM_OFFSET            0x80000000u     // Offset flag of the SD card records, the low bits are the file index
+#define SDROM_MAX_FILES         128
+#define SDROM_MIN_SIZE          8192            // Smallest ROM listed, like the multirom tool
+#define SDROM_PLAIN_SIZE        32768           // ROMs up to this size are plain ROMs
+#define SDROM_NAME_LENGTH       ROMCONFIG_NAME_LENGTH
+#define SDROM_SCAN_TIMEOUT_MS   1500            // Longest the menu is held waiting for the list
+#define SDROM_MAP_FILE          "PVMAPPER.DAT"  // Mapper detection results, appended by the firmware
+#define SDROM_MAP_ENTRIES       256             // Results loaded from that file
+
+void sdrom_scan_start(uint32_t max_files, uint32_t max_size);
+bool sdrom_scan_wait(void);
+bool sdrom_open(uint32_t offset);
+bool sdrom_read(uint8_t *buffer, uint32_t offset, uint32_t length);
+void sdrom_store_mapper(uint8_t mapper);
+
+#endif
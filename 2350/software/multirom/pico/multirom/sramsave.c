@@ -0,0 +1,443 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// sramsave.c - Battery backed cartridge SRAM kept in a flash log
+//
+// Bank layout: page 0 is the bank header (SRAMSAVE_MAGIC, generation), records follow from page 1 on, each one starting
+// on a page boundary: a sramsave_record_t, then the 256-byte pages of the SRAM image it holds, in order. The SRAM image
+// of a game is its banks one after the other (bank_size bytes each), keyed like the mapper detection results (ROM
+// offset, size and hash). A record whose check does not match was cut by a power loss and is skipped.
+//
+// This file is shared as-is by the RP2040 and RP2350 firmwares.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+#if !PICO_RP2040
+#include "hardware/structs/qmi.h"
+#endif
+#include "multirom.h"
+#include "automap.h"
+#include "sramsave.h"
+
+#define SRAMSAVE_MAGIC      0x4D415253u // "SRAM", bank header
+#define SRAMSAVE_RECORD     0x56415353u // "SSAV", record
+#define SRAMSAVE_BANK_SIZE  (SRAMSAVE_BANK_SECTORS * FLASH_SECTOR_SIZE)
+
+// Record header, also the bank header (pages = generation, check = ~generation), 32 bytes
+typedef struct {
+    uint32_t magic;                     // SRAMSAVE_RECORD (SRAMSAVE_MAGIC for the bank header)
+    uint32_t offset;                    // ROM offset in the flash image
+    uint32_t size;                      // ROM size
+    uint32_t hash;                      // automap_hash() of the ROM
+    uint32_t pages;                     // Bit n set: page n of the SRAM image follows
+    uint32_t check;                     // FNV-1a of the pages that follow, xor pages
+    uint32_t reserved[2];
+} sramsave_record_t;
+
+uint8_t __attribute__((aligned(SRAMSAVE_BLOCK_SIZE))) sramsave_shadow[SRAMSAVE_BLOCKS * SRAMSAVE_BLOCK_SIZE];
+volatile uint8_t sramsave_dirty[SRAMSAVE_PAGES];
+volatile uint32_t sramsave_writes = 0;
+uint32_t sramsave_enable = 0;
+
+static uintptr_t save_area = 0;         // XIP address of the two banks, 0 when the flash has no room for them
+static uintptr_t log_bank = 0;          // Active bank, 0 until one is formatted
+static uint32_t log_generation = 0;
+static uint32_t log_head = 0;           // Offset of the first free page of the active bank
+static sramsave_record_t key;           // Game being played, pages and check unused
+static uint32_t image_bank_size = 0;    // SRAM bank size of the game
+static uint32_t image_pages = 0;        // Pages of its SRAM image, 0 when it has no SRAM
+static uint8_t __attribute__((aligned(4))) image[SRAMSAVE_MAX_SIZE];     // Staging copy of an SRAM image
+static uint8_t __attribute__((aligned(4))) page_buffer[FLASH_PAGE_SIZE];
+static uint32_t page_fill = 0;
+static uint32_t page_target = 0;        // Flash offset of the page being filled
+
+// sramsave_fnv - FNV-1a hash of a buffer, chained from hash
+static uint32_t sramsave_fnv(uint32_t hash, const uint8_t *data, uint32_t length)
+{
+    for (uint32_t i = 0; i < length; i++)
+    {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static uint32_t sramsave_count(uint32_t pages)
+{
+    uint32_t count = 0;
+    for (; pages; pages &= pages - 1)
+    {
+        count++;
+    }
+    return count;
+}
+
+// sramsave_length - Bytes taken by a record in the bank, whole pages
+static inline uint32_t sramsave_length(const sramsave_record_t *record)
+{
+    return (sramsave_count(record->pages) + 1) * FLASH_PAGE_SIZE;
+}
+
+// sramsave_valid - Check a record against the pages that follow it
+static bool sramsave_valid(const sramsave_record_t *record)
+{
+    uint32_t const count = sramsave_count(record->pages);
+    return record->magic == SRAMSAVE_RECORD &&
+           (sramsave_fnv(2166136261u, (const uint8_t *)(record + 1), count << SRAMSAVE_PAGE_SHIFT) ^ record->pages) ==
+               record->check;
+}
+
+static inline bool sramsave_same_key(const sramsave_record_t *a, const sramsave_record_t *b)
+{
+    return a->offset == b->offset && a->size == b->size && a->hash == b->hash;
+}
+
+// sramsave_header_valid - Generation of a bank, false if the bank was never completed
+static bool sramsave_header_valid(uintptr_t bank, uint32_t *generation)
+{
+    const sramsave_record_t *header = (const sramsave_record_t *)bank;
+    *generation = header->pages;
+    return header->magic == SRAMSAVE_MAGIC && header->check == ~header->pages;
+}
+
+// sramsave_end - Offset of the first free page of a bank (the bank size when it is full or damaged)
+static uint32_t sramsave_end(uintptr_t bank)
+{
+    uint32_t position = FLASH_PAGE_SIZE;
+    while (position < SRAMSAVE_BANK_SIZE)
+    {
+        const sramsave_record_t *record = (const sramsave_record_t *)(bank + position);
+        if (record->magic == 0xFFFFFFFFu)
+        {
+            break;
+        }
+        if (record->magic != SRAMSAVE_RECORD)
+        {
+            return SRAMSAVE_BANK_SIZE;
+        }
+        position += sramsave_length(record);
+    }
+    return (position < SRAMSAVE_BANK_SIZE) ? position : SRAMSAVE_BANK_SIZE;
+}
+
+// sramsave_replay - Apply the records of a game found in a bank to an SRAM image, in log order
+// Returns:
+//   The pages of the image found in the bank
+static uint32_t sramsave_replay(uintptr_t bank, uint32_t end, const sramsave_record_t *game, uint8_t *data)
+{
+    uint32_t known = 0;
+    for (uint32_t position = FLASH_PAGE_SIZE; position < end;)
+    {
+        const sramsave_record_t *record = (const sramsave_record_t *)(bank + position);
+        if (sramsave_same_key(record, game) && sramsave_valid(record))
+        {
+            const uint8_t *source = (const uint8_t *)(record + 1);
+            for (uint32_t page = 0; page < SRAMSAVE_PAGES; page++)
+            {
+                if (record->pages & (1u << page))
+                {
+                    memcpy(&data[page << SRAMSAVE_PAGE_SHIFT], source, 1u << SRAMSAVE_PAGE_SHIFT);
+                    source += 1u << SRAMSAVE_PAGE_SHIFT;
+                }
+            }
+            known |= record->pages;
+        }
+        position += sramsave_length(record);
+    }
+    return known;
+}
+
+// sramsave_erase - Erase a bank, and sramsave_program - Program one page
+// Core 0 only runs from SRAM while this happens, so neither needs to stop it. The RP2350 QMI timing set by main for
+// the MSX bus is put back, the boot XIP setup of the flash routines would undo it.
+static void __no_inline_not_in_flash_func(sramsave_erase)(uintptr_t bank)
+{
+#if !PICO_RP2040
+    uint32_t const timing = qmi_hw->m[0].timing;
+#endif
+    uint32_t const irq_state = save_and_disable_interrupts();
+    flash_range_erase(bank - XIP_BASE, SRAMSAVE_BANK_SIZE);
+    restore_interrupts(irq_state);
+#if !PICO_RP2040
+    qmi_hw->m[0].timing = timing;
+#endif
+}
+
+static void __no_inline_not_in_flash_func(sramsave_program)(uint32_t target, const uint8_t *page)
+{
+#if !PICO_RP2040
+    uint32_t const timing = qmi_hw->m[0].timing;
+#endif
+    uint32_t const irq_state = save_and_disable_interrupts();
+    flash_range_program(target, page, FLASH_PAGE_SIZE);
+    restore_interrupts(irq_state);
+#if !PICO_RP2040
+    qmi_hw->m[0].timing = timing;
+#endif
+}
+
+// sramsave_emit - Stream bytes to the flash, one page at a time
+static void sramsave_emit(const void *data, uint32_t length)
+{
+    const uint8_t *bytes = data;
+    while (length)
+    {
+        uint32_t const chunk = (length < FLASH_PAGE_SIZE - page_fill) ? length : FLASH_PAGE_SIZE - page_fill;
+        memcpy(&page_buffer[page_fill], bytes, chunk);
+        page_fill += chunk;
+        bytes += chunk;
+        length -= chunk;
+        if (page_fill == FLASH_PAGE_SIZE)
+        {
+            sramsave_program(page_target, page_buffer);
+            page_target += FLASH_PAGE_SIZE;
+            page_fill = 0;
+        }
+    }
+}
+
+// sramsave_append - Append a record holding some pages of an SRAM image to the active bank
+// Returns:
+//   false if the bank has no room left for it
+static bool sramsave_append(const sramsave_record_t *game, uint32_t pages, const uint8_t *data)
+{
+    sramsave_record_t record = *game;
+    record.magic = SRAMSAVE_RECORD;
+    record.pages = pages;
+    record.check = 2166136261u;
+    for (uint32_t page = 0; page < SRAMSAVE_PAGES; page++)
+    {
+        if (pages & (1u << page))
+        {
+            record.check = sramsave_fnv(record.check, &data[page << SRAMSAVE_PAGE_SHIFT], 1u << SRAMSAVE_PAGE_SHIFT);
+        }
+    }
+    record.check ^= pages;
+    memset(record.reserved, 0xFF, sizeof(record.reserved));
+
+    uint32_t const length = sramsave_length(&record);
+    if (log_head + length > SRAMSAVE_BANK_SIZE)
+    {
+        return false;
+    }
+    page_target = log_bank - XIP_BASE + log_head;
+    page_fill = 0;
+    sramsave_emit(&record, sizeof(record));
+    for (uint32_t page = 0; page < SRAMSAVE_PAGES; page++)
+    {
+        if (pages & (1u << page))
+        {
+            sramsave_emit(&data[page << SRAMSAVE_PAGE_SHIFT], 1u << SRAMSAVE_PAGE_SHIFT);
+        }
+    }
+    if (page_fill)
+    {
+        memset(&page_buffer[page_fill], 0xFF, FLASH_PAGE_SIZE - page_fill);
+        sramsave_program(page_target, page_buffer);
+    }
+    log_head += length;
+    return true;
+}
+
+// sramsave_stage - Copy pages of the shadow into the staging image
+// The dirty flags are cleared before the copy, a write landing meanwhile marks its page again for the next save.
+static uint32_t sramsave_stage(bool all)
+{
+    uint32_t pages = 0;
+    for (uint32_t page = 0; page < image_pages; page++)
+    {
+        if (all || sramsave_dirty[page])
+        {
+            sramsave_dirty[page] = 0;
+            pages |= 1u << page;
+        }
+    }
+    __dmb(); // Clear the flags before reading the data they cover
+    for (uint32_t page = 0; page < image_pages; page++)
+    {
+        if (pages & (1u << page))
+        {
+            uint32_t const offset = page << SRAMSAVE_PAGE_SHIFT;
+            memcpy(&image[offset], &sramsave_block(offset / image_bank_size)[offset % image_bank_size],
+                   1u << SRAMSAVE_PAGE_SHIFT);
+        }
+    }
+    return pages;
+}
+
+// sramsave_compact - Start the other bank with the whole SRAM of the game being played, then the latest SRAM image of
+// every other game of the full bank, as long as they fit
+static void sramsave_compact(void)
+{
+    uintptr_t const old_bank = log_bank;
+    uint32_t const old_end = log_head;
+
+    log_bank = (log_bank == save_area) ? save_area + SRAMSAVE_BANK_SIZE : save_area;
+    log_head = FLASH_PAGE_SIZE;
+    sramsave_erase(log_bank);
+    sramsave_append(&key, sramsave_stage(true), image);
+
+    for (uint32_t position = FLASH_PAGE_SIZE; old_bank && position < old_end;)
+    {
+        const sramsave_record_t *record = (const sramsave_record_t *)(old_bank + position);
+        bool first = sramsave_valid(record) && !sramsave_same_key(record, &key);
+        for (uint32_t before = FLASH_PAGE_SIZE; first && before < position;)
+        {
+            const sramsave_record_t *other = (const sramsave_record_t *)(old_bank + before);
+            first = !sramsave_same_key(other, record) || !sramsave_valid(other);
+            before += sramsave_length(other);
+        }
+        if (first)
+        {
+            memset(image, 0xFF, sizeof(image));
+            uint32_t const known = sramsave_replay(old_bank, old_end, record, image);
+            sramsave_append(record, known, image); // Dropped when the bank is full
+        }
+        position += sramsave_length(record);
+    }
+
+    // The header goes last: until then the old bank is still the active one
+    sramsave_record_t header;
+    memset(&header, 0xFF, sizeof(header));
+    header.magic = SRAMSAVE_MAGIC;
+    header.pages = ++log_generation;
+    header.check = ~log_generation;
+    memset(page_buffer, 0xFF, sizeof(page_buffer));
+    memcpy(page_buffer, &header, sizeof(header));
+    sramsave_program(log_bank - XIP_BASE, page_buffer);
+}
+
+// sramsave_init - Set the flash area holding the log and find its active bank
+// Parameters:
+//   area - XIP address of the area, must be sector aligned and past the end of the image
+void sramsave_init(uintptr_t area)
+{
+    uint32_t generations[2];
+    bool valid[2];
+
+    log_bank = 0;
+    log_generation = 0;
+    if (area + SRAMSAVE_AREA_SECTORS * FLASH_SECTOR_SIZE > XIP_BASE + PICO_FLASH_SIZE_BYTES)
+    {
+        save_area = 0;  // The image fills the flash, the SRAM only lasts for the session
+        return;
+    }
+    save_area = area;
+    for (int bank = 0; bank < 2; bank++)
+    {
+        valid[bank] = sramsave_header_valid(area + bank * SRAMSAVE_BANK_SIZE, &generations[bank]);
+    }
+    if (valid[0] || valid[1])
+    {
+        int const bank = (valid[0] && valid[1]) ? ((int32_t)(generations[1] - generations[0]) > 0) : valid[1];
+        log_bank = area + bank * SRAMSAVE_BANK_SIZE;
+        log_generation = generations[bank];
+        log_head = sramsave_end(log_bank);
+    }
+}
+
+// sramsave_open - Load the SRAM of a game into the shadow, erased (0xFF) when it was never saved
+// Parameters:
+//   rom - ROM data in the XIP flash
+//   offset - ROM offset in the flash image
+//   size - ROM size
+//   bank_size - Bytes of each SRAM bank
+//   banks - Number of SRAM banks
+//   enable - Register bits that map the SRAM, 0 for the first bit past the ROM segments (ASCII8)
+void sramsave_open(const uint8_t *rom, uint32_t offset, uint32_t size, uint32_t bank_size, uint32_t banks,
+                   uint32_t enable)
+{
+    memset(&key, 0xFF, sizeof(key));
+    key.offset = offset;
+    key.size = size;
+    key.hash = automap_hash(rom, size);
+    image_bank_size = bank_size;
+    image_pages = (bank_size * banks) >> SRAMSAVE_PAGE_SHIFT;
+
+    sramsave_enable = enable;
+    if (!sramsave_enable)
+    {
+        for (sramsave_enable = 1; (sramsave_enable << 13) < size; sramsave_enable <<= 1)
+        {
+        }
+    }
+
+    memset(image, 0xFF, sizeof(image));
+    if (log_bank)
+    {
+        sramsave_replay(log_bank, log_head, &key, image);
+    }
+    for (uint32_t bank = 0; bank < banks; bank++)
+    {
+        for (uint32_t mirror = 0; mirror < SRAMSAVE_BLOCK_SIZE; mirror += bank_size)
+        {
+            memcpy(&sramsave_block(bank)[mirror], &image[bank * bank_size], bank_size);
+        }
+    }
+    memset((void *)sramsave_dirty, 0, sizeof(sramsave_dirty));
+    sramsave_writes = 0;
+}
+
+// sramsave_flush - Save the dirty pages of the shadow
+// Returns:
+//   true if something was written to the flash
+bool sramsave_flush(void)
+{
+    if (!save_area || !image_pages)
+    {
+        return false;
+    }
+    bool dirty = false;
+    for (uint32_t page = 0; page < image_pages; page++)
+    {
+        dirty |= sramsave_dirty[page];
+    }
+    if (!dirty)
+    {
+        return false;
+    }
+    if (!log_bank)
+    {
+        sramsave_compact(); // First save ever: format a bank with the whole SRAM
+        return true;
+    }
+
+    uint32_t const pages = sramsave_stage(false);
+    if (!sramsave_append(&key, pages, image))
+    {
+        for (uint32_t page = 0; page < image_pages; page++)
+        {
+            sramsave_dirty[page] |= (pages >> page) & 1; // Taken again by the full copy
+        }
+        sramsave_compact();
+    }
+    return true;
+}
+
+// sramsave_task - Core 1 loop: save the SRAM once the MSX has stopped writing it for SRAMSAVE_IDLE_MS
+// Chained after the ROM copy (romload_next), core 0 serves everything from SRAM by then.
+void __no_inline_not_in_flash_func(sramsave_task)(void)
+{
+    uint32_t seen = sramsave_writes;
+    uint32_t idle = 0;
+    while (true)
+    {
+        sleep_ms(SRAMSAVE_POLL_MS);
+        uint32_t const writes = sramsave_writes;
+        if (writes != seen)
+        {
+            seen = writes;
+            idle = 0;
+        }
+        else if ((idle += SRAMSAVE_POLL_MS) >= SRAMSAVE_IDLE_MS)
+        {
+            sramsave_flush();
+            idle = 0;
+        }
+    }
+}
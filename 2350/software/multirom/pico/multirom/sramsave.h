@@ -0,0 +1,76 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// sramsave.h - Battery backed cartridge SRAM kept in a flash log
+//
+// The SRAM of the ASCII8-SRAM, ASCII16-SRAM and Game Master 2 mappers (mapper.h) lives in a RAM shadow made of one
+// 8KB block per SRAM bank, the bank mirrored over the whole block so the engines map it like any other 8KB page. The
+// bus core marks every 256-byte page it writes as dirty and counts the writes, nothing else.
+// Core 1 watches the write counter and, once the MSX has not written the SRAM for SRAMSAVE_IDLE_MS, appends the dirty
+// pages to a log in flash. Core 0 keeps serving the bus from SRAM meanwhile, so this is only done when the whole ROM
+// is in SRAM (the PIO/DMA engine); bigger ROMs keep their SRAM for the session only.
+//
+// The log has two banks of SRAMSAVE_BANK_SECTORS sectors past the mapper detection store. Records are appended to the
+// active bank, so the sectors wear evenly, and when it is full the latest image of every game is copied to the other
+// bank, which becomes the active one once its header is programmed last. A power loss at any point leaves one
+// complete bank.
+//
+// This file is shared as-is by the RP2040 and RP2350 firmwares.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef SRAMSAVE_H
+#define SRAMSAVE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SRAMSAVE_BLOCK_SHIFT    13                                  // One 8KB shadow block per SRAM bank
+#define SRAMSAVE_BLOCK_SIZE     (1u << SRAMSAVE_BLOCK_SHIFT)
+#define SRAMSAVE_BLOCKS         2                                   // Up to two banks (Game Master 2)
+#define SRAMSAVE_MAX_SIZE       8192                                // SRAM bytes of a cartridge, all banks
+#define SRAMSAVE_PAGE_SHIFT     8                                   // Dirty tracking granularity, one flash page
+#define SRAMSAVE_PAGES          (SRAMSAVE_MAX_SIZE >> SRAMSAVE_PAGE_SHIFT)
+#define SRAMSAVE_BANK_SECTORS   16                                  // Flash sectors of each log bank (64KB)
+#define SRAMSAVE_AREA_SECTORS   (2 * SRAMSAVE_BANK_SECTORS)
+#define SRAMSAVE_IDLE_MS        2000                                // SRAM write pause before saving
+#define SRAMSAVE_POLL_MS        100
+
+extern uint8_t sramsave_shadow[SRAMSAVE_BLOCKS * SRAMSAVE_BLOCK_SIZE];
+extern volatile uint8_t sramsave_dirty[SRAMSAVE_PAGES];        // Set by the bus core, cleared by the saver
+extern volatile uint32_t sramsave_writes;                       // SRAM writes since the ROM started
+extern uint32_t sramsave_enable;                                // Register bits that map the SRAM (sramsave_open())
+
+void sramsave_init(uintptr_t area);
+void sramsave_open(const uint8_t *rom, uint32_t offset, uint32_t size, uint32_t bank_size, uint32_t banks,
+                   uint32_t enable);
+bool sramsave_flush(void);
+void sramsave_task(void);
+
+// sramsave_block - Shadow block of an SRAM bank
+static inline uint8_t *sramsave_block(uint32_t bank)
+{
+    return &sramsave_shadow[(bank & (SRAMSAVE_BLOCKS - 1)) << SRAMSAVE_BLOCK_SHIFT];
+}
+
+// sramsave_write - Take a write to a mapped SRAM bank on the bus core
+// Parameters:
+//   bank_size - Size of an SRAM bank (a constant of the mapper descriptor), mirrored over the 8KB block
+//   bank - SRAM bank mapped on the page
+//   addr - Address of the write
+//   data - Byte written by the MSX
+static inline void sramsave_write(uint32_t bank_size, uint32_t bank, uint16_t addr, uint8_t data)
+{
+    uint32_t const offset = addr & (bank_size - 1);
+    uint8_t *const block = sramsave_block(bank);
+    for (uint32_t mirror = offset; mirror < SRAMSAVE_BLOCK_SIZE; mirror += bank_size)
+    {
+        block[mirror] = data;
+    }
+    sramsave_dirty[(bank * bank_size + offset) >> SRAMSAVE_PAGE_SHIFT] = 1;
+    sramsave_writes++;
+}
+
+#endif
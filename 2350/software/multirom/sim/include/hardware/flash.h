@@ -0,0 +1,40 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// hardware/flash.h - Host shim of the Pico SDK flash calls used by automap.c and sramsave.c
+//
+// The flash behind XIP_BASE is a RAM buffer (sim_xip), erased to 0xFF, and programming can only clear bits, like on
+// the real chip.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef SIM_HARDWARE_FLASH_H
+#define SIM_HARDWARE_FLASH_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define FLASH_SECTOR_SIZE       4096u
+#define FLASH_PAGE_SIZE         256u
+#define PICO_FLASH_SIZE_BYTES   (64u * FLASH_SECTOR_SIZE)
+
+extern uint8_t sim_xip[PICO_FLASH_SIZE_BYTES];
+#define XIP_BASE                ((uintptr_t)sim_xip)
+
+static inline void flash_range_erase(uint32_t offset, size_t count)
+{
+    memset(&sim_xip[offset], 0xFF, count);
+}
+
+static inline void flash_range_program(uint32_t offset, const uint8_t *data, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        sim_xip[offset + i] &= data[i];
+    }
+}
+
+#endif
@@ -0,0 +1,30 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// hardware/structs/qmi.h - Host shim of the QMI registers touched around flash programming (automap.c)
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef SIM_HARDWARE_STRUCTS_QMI_H
+#define SIM_HARDWARE_STRUCTS_QMI_H
+
+#include <stdint.h>
+
+typedef struct {
+    volatile uint32_t timing;
+    volatile uint32_t rfmt;
+    volatile uint32_t rcmd;
+    volatile uint32_t wfmt;
+    volatile uint32_t wcmd;
+} qmi_mem_hw_t;
+
+typedef struct {
+    qmi_mem_hw_t m[2];
+} qmi_hw_t;
+
+extern qmi_hw_t sim_qmi;
+#define qmi_hw  (&sim_qmi)
+
+#endif
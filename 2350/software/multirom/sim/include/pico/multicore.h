@@ -0,0 +1,16 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// pico/multicore.h - Host shim: the core 1 entry point runs to completion when it is launched
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef SIM_PICO_MULTICORE_H
+#define SIM_PICO_MULTICORE_H
+
+static inline void multicore_reset_core1(void) { }
+static inline void multicore_launch_core1(void (*entry)(void)) { entry(); }
+
+#endif
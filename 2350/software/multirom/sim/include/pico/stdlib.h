@@ -0,0 +1,67 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// pico/stdlib.h - Host shim of the Pico SDK GPIO/SIO calls used by the mapper engines
+//
+// gpio_get_all() returns the next scripted bus cycle (see bus.h), gpio_put_masked() on the data bus checks the byte
+// driven by the firmware against the expected one, and the RD/WR release loops complete immediately. Everything is
+// inline, like the SIO accesses on the real chip, so the host timings reflect the code of the loops themselves.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef SIM_PICO_STDLIB_H
+#define SIM_PICO_STDLIB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef unsigned int uint;
+
+#define __no_inline_not_in_flash_func(f)    __attribute__((noinline)) f
+#define __not_in_flash_func(f)              f
+#define __uninitialized_ram(v)              v
+
+#define GPIO_IN     0
+#define GPIO_OUT    1
+
+#include "multirom.h"   // Pin assignment of the firmware being simulated
+#include "bus.h"
+
+static inline uint32_t gpio_get_all(void)
+{
+    return bus_next();
+}
+
+static inline bool gpio_get(uint pin)
+{
+    // The MSX ends the cycle as soon as the firmware waits for RD/WR to go high
+    return (pin == PIN_RD || pin == PIN_WR || pin >= 32) ? true : ((bus_script[bus_pos] >> pin) & 1u);
+}
+
+static inline void gpio_put_masked(uint32_t mask, uint32_t value)
+{
+    if (mask == 0xFF0000u)
+    {
+        bus_drive((uint8_t)(value >> 16));
+    }
+}
+
+static inline void gpio_put(uint pin, bool value)
+{
+    if (pin == PIN_WAIT && !value)
+    {
+        bus_stats.wait_asserts++;
+    }
+}
+
+static inline void gpio_init(uint pin) { (void)pin; }
+static inline void gpio_set_dir(uint pin, bool out) { (void)pin; (void)out; }
+static inline void gpio_set_dir_in_masked(uint32_t mask) { (void)mask; }
+static inline void gpio_set_dir_out_masked(uint32_t mask) { (void)mask; }
+static inline void tight_loop_contents(void) { }
+static inline void sleep_ms(uint32_t ms) { (void)ms; }
+
+#endif
@@ -0,0 +1,41 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// bus.c - Scripted MSX bus for the host simulator
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#include <string.h>
+#include "pico/stdlib.h"
+#include "bus.h"
+#include "hardware/structs/systick.h"
+#include "hardware/structs/qmi.h"
+#include "hardware/flash.h"
+
+const uint32_t *bus_script;
+const int16_t *bus_expect;
+size_t bus_len;
+size_t bus_pos;
+bool bus_driven;
+jmp_buf bus_done;
+bus_stats_t bus_stats;
+systick_hw_t sim_systick;
+qmi_hw_t sim_qmi;
+uint8_t sim_xip[PICO_FLASH_SIZE_BYTES];
+
+// bus_begin - Load a script, the first entry is never executed (it is the cycle before the engine starts)
+// Parameters:
+//   script - GPIO snapshot of each cycle
+//   expect - Byte expected on each cycle, BUS_NO_DATA when the cartridge must not drive the bus
+//   len - Number of cycles
+void bus_begin(const uint32_t *script, const int16_t *expect, size_t len)
+{
+    bus_script = script;
+    bus_expect = expect;
+    bus_len = len;
+    bus_pos = 0;
+    bus_driven = false;
+    memset(&bus_stats, 0, sizeof(bus_stats));
+}
@@ -0,0 +1,97 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// bus.h - Scripted MSX bus for the host simulator
+//
+// A script is an array of GPIO snapshots, one per Z80 bus cycle (SLTSL/RD/WR/IORQ, address and data exactly where the
+// firmware reads them), with the byte the cartridge is expected to drive on each cycle, or BUS_NO_DATA when it must
+// leave the data bus alone. Every gpio_get_all() call of the firmware consumes one cycle. When the script runs out
+// bus_next() jumps back to the caller of the engine through bus_done.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef SIM_BUS_H
+#define SIM_BUS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <setjmp.h>
+
+#define BUS_NO_DATA     (-1)
+#define BUS_ANY_DATA    (-2)            // The cartridge must drive the bus, the value is not checked
+
+// Control lines are active low, a snapshot with all of them high is an idle bus
+#define BUS_IDLE        ((1u << PIN_RD) | (1u << PIN_WR) | (1u << PIN_SLTSL) | (1u << PIN_IORQ))
+#define BUS_MEM_READ(addr)          ((BUS_IDLE & ~((1u << PIN_RD) | (1u << PIN_SLTSL))) | (uint16_t)(addr))
+#define BUS_MEM_WRITE(addr, data)   ((BUS_IDLE & ~((1u << PIN_WR) | (1u << PIN_SLTSL))) | (uint16_t)(addr) | ((uint32_t)(uint8_t)(data) << 16))
+#define BUS_OTHER_SLOT(addr)        ((BUS_IDLE & ~(1u << PIN_RD)) | (uint16_t)(addr))
+#define BUS_IO_READ(addr)           ((BUS_IDLE & ~((1u << PIN_RD) | (1u << PIN_IORQ))) | (uint8_t)(addr))
+#define BUS_IO_WRITE(addr, data)    ((BUS_IDLE & ~((1u << PIN_WR) | (1u << PIN_IORQ))) | (uint8_t)(addr) | ((uint32_t)(uint8_t)(data) << 16))
+
+typedef struct {
+    uint64_t checked;                   // Cycles where the cartridge had to drive the bus
+    uint64_t mismatches;                // Wrong byte driven
+    uint64_t missing;                   // Nothing driven when a byte was expected
+    uint64_t spurious;                  // Byte driven when the cartridge had to stay off the bus
+    uint64_t wait_asserts;              // WAIT assertions
+    size_t first_error;                 // Script index of the first error (0 if none)
+} bus_stats_t;
+
+extern const uint32_t *bus_script;
+extern const int16_t *bus_expect;
+extern size_t bus_len;
+extern size_t bus_pos;
+extern bool bus_driven;
+extern jmp_buf bus_done;
+extern bus_stats_t bus_stats;
+
+void bus_begin(const uint32_t *script, const int16_t *expect, size_t len);
+
+static inline void bus_error(uint64_t *counter)
+{
+    (*counter)++;
+    if (!bus_stats.first_error)
+    {
+        bus_stats.first_error = bus_pos;
+    }
+}
+
+// bus_next - Finish the current cycle and return the snapshot of the next one
+static inline uint32_t bus_next(void)
+{
+    if (bus_expect[bus_pos] != BUS_NO_DATA && !bus_driven)
+    {
+        bus_error(&bus_stats.missing);
+    }
+    if (++bus_pos >= bus_len)
+    {
+        longjmp(bus_done, 1);
+    }
+    bus_driven = false;
+    return bus_script[bus_pos];
+}
+
+// bus_drive - Check the byte the firmware drives on the data bus
+static inline void bus_drive(uint8_t data)
+{
+    int16_t const expected = bus_expect[bus_pos];
+
+    bus_driven = true;
+    if (expected == BUS_NO_DATA)
+    {
+        bus_error(&bus_stats.spurious);
+    }
+    else
+    {
+        bus_stats.checked++;
+        if (expected != BUS_ANY_DATA && data != (uint8_t)expected)
+        {
+            bus_error(&bus_stats.mismatches);
+        }
+    }
+}
+
+#endif
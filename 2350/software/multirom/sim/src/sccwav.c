@@ -0,0 +1,259 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// sccwav.c - Render the SCC synthesizer of the firmware to a WAV file, and time it
+//
+// The input is a bus trace dump of the firmware (msx_trace.c, one "time address data M/I R/W" line per cycle): the
+// SCC enable writes to 9000h-97FFh and the register writes to 9800h-9FFFh are replayed at their time through the same
+// queue the bus core posts them to. Without a trace a short built-in tune is rendered, playing the five channels on
+// four different waveforms.
+//
+// The benchmark renders a few seconds with every channel playing and reports the host time per output sample. The
+// Cortex-M33 mixes two channels per instruction with SMLAD, the host builds the plain C fallback of the same loop.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "pico/stdlib.h"
+#include "scc.h"
+
+#define SCCWAV_CHUNK        64          // Frames rendered between two looks at the queue
+#define SCCWAV_BENCH_FRAMES (SCC_SAMPLE_RATE * 10)
+
+typedef struct {
+    uint32_t time;                      // Microseconds since the start
+    uint16_t addr;
+    uint8_t data;
+} sccwav_event_t;
+
+static sccwav_event_t *events;
+static size_t event_count;
+static size_t event_max;
+
+static void add_event(uint32_t time, uint16_t addr, uint8_t data)
+{
+    if (event_count == event_max)
+    {
+        event_max = event_max ? event_max * 2 : 4096;
+        events = realloc(events, event_max * sizeof(*events));
+        if (!events)
+        {
+            printf("Out of memory\n");
+            exit(1);
+        }
+    }
+    events[event_count].time = time;
+    events[event_count].addr = addr;
+    events[event_count].data = data;
+    event_count++;
+}
+
+// load_trace - Keep the memory writes of a bus trace dump, the other lines are skipped
+static bool load_trace(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    if (!f)
+    {
+        printf("Cannot open %s\n", path);
+        return false;
+    }
+    char line[128];
+    while (fgets(line, sizeof(line), f))
+    {
+        unsigned long time;
+        unsigned int addr;
+        unsigned int data;
+        char space;
+        char strobe;
+        if (sscanf(line, "%lu %x %x %c%c", &time, &addr, &data, &space, &strobe) == 5 && space == 'M' && strobe == 'W')
+        {
+            add_event((uint32_t)time, (uint16_t)addr, (uint8_t)data);
+        }
+    }
+    fclose(f);
+    return true;
+}
+
+// demo_tune - Built-in tune: a chord over a bass line, sine, square, saw and triangle waves
+static void demo_tune(void)
+{
+    static const uint16_t notes[] = { 427, 339, 285, 214, 170, 143 }; // A3 C#4 E4 A4 C#5 E5 (periods)
+    uint32_t t = 0;
+
+    add_event(t, 0x9000, 0x3F);
+    for (int i = 0; i < SCC_WAVE_LENGTH; i++)
+    {
+        double const x = i / (double)SCC_WAVE_LENGTH;
+        add_event(t, 0x9800 + i, (uint8_t)(int8_t)lrint(127 * sin(2 * M_PI * x)));
+        add_event(t, 0x9820 + i, (i < SCC_WAVE_LENGTH / 2) ? 0x60 : 0xA0);
+        add_event(t, 0x9840 + i, (uint8_t)(int8_t)(i * 8 - 128));
+        add_event(t, 0x9860 + i, (uint8_t)(int8_t)((i < 16) ? i * 16 - 128 : 383 - i * 16));
+    }
+    for (int ch = 0; ch < SCC_CHANNELS; ch++)
+    {
+        add_event(t, 0x988A + ch, 0x0C);
+    }
+    add_event(t, 0x988F, 0x1F);
+
+    for (int bar = 0; bar < 8; bar++)
+    {
+        for (int step = 0; step < 6; step++, t += 125000)
+        {
+            uint16_t const lead = notes[(bar + step) % 6];
+            uint16_t const bass = notes[(bar & 1) ? 2 : 0] * 2;
+            uint16_t const periods[SCC_CHANNELS] = { lead, notes[(step + 2) % 6], notes[(step + 4) % 6], bass, lead + 1 };
+            for (int ch = 0; ch < SCC_CHANNELS; ch++)
+            {
+                add_event(t, 0x9880 + 2 * ch, periods[ch] & 0xFF);
+                add_event(t, 0x9881 + 2 * ch, periods[ch] >> 8);
+            }
+        }
+    }
+    add_event(t, 0x988F, 0x00);
+    add_event(t + 250000, 0x9000, 0x00);
+}
+
+static void put_le(FILE *f, uint32_t value, int bytes)
+{
+    for (int i = 0; i < bytes; i++)
+    {
+        fputc((value >> (8 * i)) & 0xFF, f);
+    }
+}
+
+// render - Replay the events through the bus side queue and render them
+static bool render(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f)
+    {
+        printf("Cannot create %s\n", path);
+        return false;
+    }
+    uint32_t const end = event_count ? events[event_count - 1].time : 0;
+    uint32_t const frames = (uint32_t)(((uint64_t)end * SCC_SAMPLE_RATE) / 1000000u) + SCCWAV_CHUNK;
+    uint32_t const bytes = frames * 4;
+    fwrite("RIFF", 1, 4, f);
+    put_le(f, 36 + bytes, 4);
+    fwrite("WAVEfmt ", 1, 8, f);
+    put_le(f, 16, 4);
+    put_le(f, 1, 2);                    // PCM
+    put_le(f, 2, 2);                    // Stereo
+    put_le(f, SCC_SAMPLE_RATE, 4);
+    put_le(f, SCC_SAMPLE_RATE * 4, 4);
+    put_le(f, 4, 2);
+    put_le(f, 16, 2);
+    fwrite("data", 1, 4, f);
+    put_le(f, bytes, 4);
+
+    scc_t scc;
+    uint32_t buffer[SCCWAV_CHUNK];
+    bool enabled = false;
+    size_t next = 0;
+    scc_reset(&scc, SCC_SAMPLE_RATE);
+    scc_bus_reset();
+    for (uint32_t frame = 0; frame < frames; frame += SCCWAV_CHUNK)
+    {
+        // Post the writes that happened before this chunk, like the bus core does
+        uint32_t const now = (uint32_t)(((uint64_t)frame * 1000000u) / SCC_SAMPLE_RATE);
+        for (; next < event_count && events[next].time <= now; next++)
+        {
+            uint16_t const addr = events[next].addr;
+            if ((addr & 0xF800) == 0x9000)
+            {
+                enabled = scc_enabled(events[next].data);
+            }
+            else if (enabled && (addr & 0xF800) == SCC_BASE)
+            {
+                scc_bus_write(addr, events[next].data);
+            }
+        }
+        scc_drain(&scc);
+        scc_render(&scc, buffer, SCCWAV_CHUNK);
+        fwrite(buffer, sizeof(buffer[0]), SCCWAV_CHUNK, f); // Little-endian host: the frames are WAV frames already
+    }
+    fclose(f);
+    printf("%s: %zu writes, %.2f s, %lu writes dropped\n", path, event_count, frames / (double)SCC_SAMPLE_RATE,
+           (unsigned long)scc_queue_dropped);
+    return true;
+}
+
+// bench - Host time per sample with the five channels playing
+static void bench(void)
+{
+    static uint32_t buffer[SCCWAV_CHUNK];
+    scc_t scc;
+    scc_reset(&scc, SCC_SAMPLE_RATE);
+    for (int i = 0; i < SCC_WAVES * SCC_WAVE_LENGTH; i++)
+    {
+        scc_write(&scc, i, (uint8_t)(i * 37));
+    }
+    for (int ch = 0; ch < SCC_CHANNELS; ch++)
+    {
+        scc_write(&scc, 0x80 + 2 * ch, 0x40 + ch * 29);
+        scc_write(&scc, 0x8A + ch, 0x0F);
+    }
+    scc_write(&scc, 0x8F, 0x1F);
+
+    struct timespec t0;
+    struct timespec t1;
+    uint32_t check = 0;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (uint32_t frame = 0; frame < SCCWAV_BENCH_FRAMES; frame += SCCWAV_CHUNK)
+    {
+        scc_render(&scc, buffer, SCCWAV_CHUNK);
+        check += buffer[frame % SCCWAV_CHUNK];
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double const ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / SCCWAV_BENCH_FRAMES;
+    printf("render: %.2f ns per sample on this host, %.4f%% of real time at %u Hz (checksum %08x)\n", ns,
+           ns * SCC_SAMPLE_RATE / 1e7, SCC_SAMPLE_RATE, check);
+}
+
+static void print_usage(const char *prog)
+{
+    printf("Usage: %s [options] [trace]\n", prog);
+    printf("  trace                       Bus trace dump to render (default: built-in tune)\n");
+    printf("  -o <file>                   Output WAV file (default scc.wav)\n");
+    printf("  -h, --help                  Show this help\n");
+}
+
+int main(int argc, char *argv[])
+{
+    const char *out = "scc.wav";
+    const char *trace = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-o") && i + 1 < argc)
+        {
+            out = argv[++i];
+        }
+        else if (argv[i][0] != '-' && !trace)
+        {
+            trace = argv[i];
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return (!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help")) ? 0 : 1;
+        }
+    }
+
+    if (trace ? !load_trace(trace) : (demo_tune(), false))
+    {
+        return 1;
+    }
+    if (!render(out))
+    {
+        return 1;
+    }
+    bench();
+    return 0;
+}
@@ -0,0 +1,1806 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// sim.c - Host simulator and benchmark for the MultiROM mapper engines
+//
+// Builds the mapper engine of the firmware (mapper.h, romcache.c, romload.c) natively against the GPIO shim in
+// include/ and drives it with scripted Z80 bus cycles. Every mapper is run in the three ways the firmware serves ROMs:
+//   sram  - ROM copied to SRAM by romload (fits in the cache)
+//   flash - ROM read straight from flash (cache disabled)
+//   paged - ROM bigger than the cache, served by the demand-paged segment cache
+// A reference model written from the mapper specifications (not from the descriptors) predicts the byte of every
+// read, so any wrong byte, missing byte or byte driven when the cartridge is not addressed is reported.
+//
+// The benchmark runs a read-only script and a script that alternates bank switches and reads, and reports host
+// cycles (and instructions when the perf counters are available) per read and per bank switch. --save/--baseline
+// keep a reference report so a slowdown of the bus loops fails the build like a wrong byte does.
+//
+// The runtime mapper detection (automap.c) is checked on its own: a ROM of each of the four mappers it knows starts
+// on the plain engine, writes the power-on values of its registers and switches a bank, then the random script goes
+// on. Every byte must be right, and the mapper must be found in the simulated flash store afterwards. Each mapper is
+// then started again like a ROM of the SD card, read through romload_read and served from SRAM only, with bank values
+// far past the end of the ROM that must wrap around its size.
+//
+// The expanded slot of the Nextor mode (nextor_ram.c) is checked the same way, against a model of the sub-slot
+// register, the kernel banks and the memory mapper.
+//
+// The battery backed SRAM mappers (sramsave.c) are checked against a model of their ROM banks and SRAM, then the SRAM
+// is saved to the simulated flash log, reloaded, and saved again until the log has been compacted a few times: the
+// last SRAM of every game must come back byte for byte.
+//
+// ROMs stored as segments (romlz.c) are checked end to end: a MegaROM-like image (code, repeated tiles, padding, some
+// segments repeated) is compressed segment by segment, the repeated segments pointing at the block of the first copy,
+// then served from SRAM and demand-paged with romload_read reading it, against the model of the plain image. The benchmark times the decoder against a copy and, with a model of the XIP flash of the board,
+// checks that decompressing a segment is faster than copying it from flash.
+//
+// The Sound Cartridge (sccplus.c) is checked against a model of its mode register, RAM banks and, on the RP2350, of
+// the SCC registers it shows in compatible and enhanced mode.
+//
+// RP2350 builds have the SCC emulation (PICOVERSE_SCC): the reference model answers the SCC waveform registers while
+// bank 2 enables the chip, and a dedicated run checks the overlay page and the writes posted to the synthesizer.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <sys/ioctl.h>
+#include <linux/perf_event.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "pico/stdlib.h"
+#include "bus.h"
+#include "mapper.h"
+#include "romcache.h"
+#include "romload.h"
+#include "romlz.h"
+#include "perf.h"
+#include "automap.h"
+#include "nextor_ram.h"
+#include "sramsave.h"
+#include "sccplus.h"
+#include "romconfig.h"
+#include "catalog.h"
+#include "hardware/flash.h"
+#if PICOVERSE_SCC
+#include "scc.h"
+#endif
+
+#if PICO_RP2040
+#define SIM_SRAM_SIZE   (192u * 1024u)  // CACHE_SIZE of the RP2040 firmware
+#define SIM_NEXTOR_FLASH true           // The Nextor kernel is read from flash
+#else
+#define SIM_SRAM_SIZE   (256u * 1024u)  // CACHE_SIZE of the RP2350 firmware
+#define SIM_NEXTOR_FLASH false          // The Nextor kernel is copied to SRAM
+#endif
+#define SIM_FLASH_SIZE  (4u * 1024u * 1024u)
+#define SIM_ROM_OFFSET  0x8000u         // ROMs start after the menu and config, like in the real image
+#define SIM_PAGED_SIZE  (1024u * 1024u) // ROM size used for the demand-paged runs
+#define SIM_BANKED_SIZE (128u * 1024u)  // ROM size used for the other runs of the bank switching mappers
+#define SIM_MAX_REGS    8
+#ifndef PICOVERSE_SCC
+#define PICOVERSE_SCC   0               // Only the RP2350 firmware emulates the SCC
+#endif
+
+typedef enum { MODE_SRAM, MODE_FLASH, MODE_PAGED, MODE_COUNT } sim_mode_t;
+static const char *const mode_names[MODE_COUNT] = { "sram", "flash", "paged" };
+
+typedef void (*sim_engine_t)(const uint8_t *flash, uint32_t rom_size, uint32_t cached_length);
+
+// Reference description of a mapper, from the mapper specifications
+typedef struct {
+    const char *name;
+    const mapper_desc_t *desc;          // Descriptor handed to the engine (only used to start it)
+    sim_engine_t engine;
+    uint16_t base;                      // First address answered by the cartridge
+    uint8_t banks;                      // Number of banks
+    uint32_t bank_size;                 // Bank size in bytes
+    uint32_t rom_size;                  // ROM size used for the sram and flash runs
+    bool neo;                           // 12-bit registers written in two halves, mirrored every 16KB
+    uint8_t initial[SIM_MAX_REGS];      // Segment of each bank when the cartridge starts
+    uint16_t reg_addr[SIM_MAX_REGS];    // Base address of the 2KB window of each bank register, 0 if none
+    bool scc;                           // SCC registers on 9800h-9FFFh while bank 2 selects segment xx111111b
+} sim_mapper_t;
+
+static uint8_t flash_image[SIM_FLASH_SIZE];
+static uint8_t __attribute__((aligned(8192))) sram[SIM_SRAM_SIZE];
+
+// One noinline wrapper per mapper, with a constant descriptor, exactly like the loadrom_* functions of the firmware
+#define SIM_ENGINE(name)                                                                                    \
+    static void __attribute__((noinline)) engine_##name(const uint8_t *flash, uint32_t rom_size,            \
+                                                        uint32_t cached_length)                             \
+    {                                                                                                       \
+        mapper_run(&mapper_##name, flash, sram, rom_size, cached_length);                                   \
+    }
+SIM_ENGINE(plain32)
+SIM_ENGINE(linear48)
+SIM_ENGINE(konami)
+SIM_ENGINE(ascii8)
+SIM_ENGINE(ascii16)
+SIM_ENGINE(neo8)
+SIM_ENGINE(neo16)
+SIM_ENGINE(ascii8_sram)
+SIM_ENGINE(ascii16_sram)
+SIM_ENGINE(gm2)
+
+// Same as loadrom_konamiscc() in the firmware, the SCC registers start cleared
+static void __attribute__((noinline)) engine_konamiscc(const uint8_t *flash, uint32_t rom_size, uint32_t cached_length)
+{
+#if PICOVERSE_SCC
+    scc_bus_reset();
+#endif
+    mapper_run(&mapper_konamiscc, flash, sram, rom_size, cached_length);
+}
+
+// Same sequence as loadrom_auto() in the firmware
+static void __attribute__((noinline)) engine_auto(const uint8_t *flash, uint32_t rom_size, uint32_t cached_length)
+{
+    automap_reset();
+    mapper_serve(&mapper_plain32, flash, sram, rom_size, cached_length, NULL, 0, automap_observe);
+    uint8_t const mapper = automap_result();
+    romload_wait(romload_all);
+    automap_store(flash, SIM_ROM_OFFSET, rom_size, mapper);
+    switch (mapper)
+    {
+        case 3:
+#if PICOVERSE_SCC
+            scc_bus_reset();
+#endif
+            mapper_serve(&mapper_konamiscc, flash, sram, rom_size, cached_length, automap_log, automap_log_count,
+                         NULL);
+            break;
+        case 5:
+            mapper_serve(&mapper_ascii8, flash, sram, rom_size, cached_length, automap_log, automap_log_count,
+                         NULL);
+            break;
+        case 6:
+            mapper_serve(&mapper_ascii16, flash, sram, rom_size, cached_length, automap_log, automap_log_count,
+                         NULL);
+            break;
+        default:
+            mapper_serve(&mapper_konami, flash, sram, rom_size, cached_length, automap_log, automap_log_count,
+                         NULL);
+            break;
+    }
+}
+
+static const sim_mapper_t mappers[] = {
+    { "plain32", &mapper_plain32, engine_plain32, 0x4000, 2, 0x4000, 32u * 1024u, false,
+      { 0, 1 }, { 0 } },
+    { "linear48", &mapper_linear48, engine_linear48, 0x0000, 3, 0x4000, 48u * 1024u, false,
+      { 0, 1, 2 }, { 0 } },
+    { "konamiscc", &mapper_konamiscc, engine_konamiscc, 0x4000, 4, 0x2000, SIM_BANKED_SIZE, false,
+      { 0, 1, 2, 3 }, { 0x5000, 0x7000, 0x9000, 0xB000 }, PICOVERSE_SCC },
+    { "konami", &mapper_konami, engine_konami, 0x4000, 4, 0x2000, SIM_BANKED_SIZE, false,
+      { 0, 1, 2, 3 }, { 0, 0x6000, 0x8000, 0xA000 } },
+    { "ascii8", &mapper_ascii8, engine_ascii8, 0x4000, 4, 0x2000, SIM_BANKED_SIZE, false,
+      { 0, 1, 2, 3 }, { 0x6000, 0x6800, 0x7000, 0x7800 } },
+    { "ascii16", &mapper_ascii16, engine_ascii16, 0x4000, 2, 0x4000, SIM_BANKED_SIZE, false,
+      { 0, 1 }, { 0x6000, 0x7000 } },
+    { "neo8", &mapper_neo8, engine_neo8, 0x0000, 6, 0x2000, SIM_BANKED_SIZE, true,
+      { 0 }, { 0x1000, 0x1800, 0x2000, 0x2800, 0x3000, 0x3800 } },
+    { "neo16", &mapper_neo16, engine_neo16, 0x0000, 3, 0x4000, SIM_BANKED_SIZE, true,
+      { 0 }, { 0x1000, 0x2000, 0x3000 } },
+};
+#define SIM_MAPPERS (sizeof(mappers) / sizeof(mappers[0]))
+
+// Reference model state
+static uint16_t ref_bank[SIM_MAX_REGS];
+static uint8_t ref_scc_wave[128];       // SCC waveform registers (9800h-987Fh)
+static uint32_t ref_rom_mask = 0xFFFFFFFFu; // ROM offsets wrap around the ROM size (runs with segments past the end)
+
+static bool has_regs(const sim_mapper_t *sm)
+{
+    for (int i = 0; i < sm->banks; i++)
+    {
+        if (sm->reg_addr[i])
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void ref_reset(const sim_mapper_t *sm)
+{
+    for (int i = 0; i < SIM_MAX_REGS; i++)
+    {
+        ref_bank[i] = sm->initial[i];
+    }
+    memset(ref_scc_wave, 0, sizeof(ref_scc_wave));
+}
+
+// ref_scc - Check if an address hits the SCC registers
+static bool ref_scc(const sim_mapper_t *sm, uint16_t addr)
+{
+    return sm->scc && (ref_bank[2] & 0x3F) == 0x3F && addr >= 0x9800 && addr <= 0x9FFF;
+}
+
+static bool ref_in_range(const sim_mapper_t *sm, uint16_t addr)
+{
+    return addr >= sm->base && (uint32_t)addr < sm->base + sm->banks * sm->bank_size;
+}
+
+static void ref_write(const sim_mapper_t *sm, uint16_t addr, uint8_t data)
+{
+    if (!ref_in_range(sm, addr))
+    {
+        return;                         // The engine only decodes writes to the cartridge pages
+    }
+    if (ref_scc(sm, addr))
+    {
+        if ((addr & 0xFF) < sizeof(ref_scc_wave))
+        {
+            ref_scc_wave[addr & 0xFF] = data;
+        }
+        return;
+    }
+    uint16_t const match = sm->neo ? (addr & 0x3FFF) : addr;
+    for (int i = 0; i < sm->banks; i++)
+    {
+        if (sm->reg_addr[i] && (match & 0xF800) == sm->reg_addr[i])
+        {
+            if (!sm->neo)
+            {
+                ref_bank[i] = data;
+            }
+            else if (addr & 1)
+            {
+                ref_bank[i] = ((ref_bank[i] & 0x00FF) | (data << 8)) & 0x0FFF;
+            }
+            else
+            {
+                ref_bank[i] = ((ref_bank[i] & 0xFF00) | data) & 0x0FFF;
+            }
+        }
+    }
+}
+
+static int16_t ref_read(const sim_mapper_t *sm, const uint8_t *rom, uint16_t addr)
+{
+    if (!ref_in_range(sm, addr))
+    {
+        return BUS_NO_DATA;
+    }
+    if (ref_scc(sm, addr))
+    {
+        return ((addr & 0xFF) < sizeof(ref_scc_wave)) ? ref_scc_wave[addr & 0xFF] : 0xFF; // 9880h-98FFh are write-only
+    }
+    uint32_t const bank = (addr - sm->base) / sm->bank_size;
+    return rom[(ref_bank[bank] * sm->bank_size + (addr - sm->base) % sm->bank_size) & ref_rom_mask];
+}
+
+// xorshift32, so scripts are the same on every host
+static uint32_t rng_state;
+
+static uint32_t rng(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// random_bank_write - Bank register write with a segment inside the ROM
+static uint32_t random_bank_write(const sim_mapper_t *sm, uint32_t rom_size, uint16_t addr)
+{
+    uint32_t const segments = rom_size / sm->bank_size;
+    uint8_t data = rng() % segments;
+    if (sm->neo && (addr & 1))
+    {
+        data = 0;                       // Upper half of the 12-bit register, ROMs here have less than 256 segments
+    }
+    return BUS_MEM_WRITE(addr, data);
+}
+
+// register_address - Random address inside the window of a bank register (or anywhere if the mapper has none)
+static uint16_t register_address(const sim_mapper_t *sm)
+{
+    if (!has_regs(sm))
+    {
+        return rng();
+    }
+    uint16_t window;
+    do
+    {
+        window = sm->reg_addr[rng() % sm->banks];
+    } while (!window);
+    uint16_t addr = window | (rng() & 0x07FF);
+    if (sm->neo)
+    {
+        addr |= (rng() % 3) << 14;      // Mirrors at 0000h, 4000h and 8000h (C000h is not decoded by the engine)
+    }
+    return addr;
+}
+
+static uint16_t range_address(const sim_mapper_t *sm)
+{
+    return sm->base + rng() % (sm->banks * sm->bank_size);
+}
+
+// build_check_script - Random mix of every kind of cycle, with the expected bytes from the reference model
+// The script is filled from index start on, the reference model must be set up for the cycles before it.
+static void build_check_script(const sim_mapper_t *sm, const uint8_t *rom, uint32_t rom_size,
+                               uint32_t *script, int16_t *expect, size_t start, size_t len)
+{
+    for (size_t i = start; i < len; i++)
+    {
+        uint32_t const kind = rng() % 100;
+        uint16_t addr;
+
+        expect[i] = BUS_NO_DATA;
+        if (kind < 10)
+        {
+            script[i] = BUS_OTHER_SLOT(rng());
+        }
+        else if (kind < 14)
+        {
+            uint8_t port = rng();
+#if PICOVERSE_PERF
+            if (port == PERF_PORT)
+            {
+                port++;                 // Answered by the firmware, covered by check_perf_port()
+            }
+#endif
+            script[i] = BUS_IO_READ(port);
+        }
+        else if (kind < 18)
+        {
+            script[i] = BUS_IDLE;
+        }
+        else if (kind < 32)
+        {
+            addr = (kind < 28) ? register_address(sm) : (uint16_t)rng();
+            script[i] = random_bank_write(sm, rom_size, addr);
+            ref_write(sm, addr, (script[i] >> 16) & 0xFF);
+        }
+        else
+        {
+            addr = (kind < 85) ? range_address(sm) : (uint16_t)rng();
+            script[i] = BUS_MEM_READ(addr);
+            expect[i] = ref_read(sm, rom, addr);
+        }
+    }
+}
+
+// build_read_script - Reads only, inside the cartridge range
+static void build_read_script(const sim_mapper_t *sm, const uint8_t *rom, uint32_t *script, int16_t *expect, size_t len)
+{
+    ref_reset(sm);
+    script[0] = BUS_IDLE;
+    expect[0] = BUS_NO_DATA;
+    for (size_t i = 1; i < len; i++)
+    {
+        uint16_t const addr = range_address(sm);
+        script[i] = BUS_MEM_READ(addr);
+        expect[i] = ref_read(sm, rom, addr);
+    }
+}
+
+// build_switch_script - Bank register writes, each one followed by a read
+static void build_switch_script(const sim_mapper_t *sm, const uint8_t *rom, uint32_t rom_size,
+                                uint32_t *script, int16_t *expect, size_t len)
+{
+    ref_reset(sm);
+    script[0] = BUS_IDLE;
+    expect[0] = BUS_NO_DATA;
+    for (size_t i = 1; i + 1 < len; i += 2)
+    {
+        uint16_t addr = register_address(sm) & ~1u;
+        script[i] = random_bank_write(sm, rom_size, addr);
+        expect[i] = BUS_NO_DATA;
+        ref_write(sm, addr, (script[i] >> 16) & 0xFF);
+        addr = range_address(sm);
+        script[i + 1] = BUS_MEM_READ(addr);
+        expect[i + 1] = ref_read(sm, rom, addr);
+    }
+    if (!(len & 1))
+    {
+        script[len - 1] = BUS_IDLE;
+        expect[len - 1] = BUS_NO_DATA;
+    }
+}
+
+// mode_rom_size - ROM size used for a mapper in a mode, 0 if the combination does not exist
+static uint32_t mode_rom_size(const sim_mapper_t *sm, sim_mode_t mode)
+{
+    if (mode == MODE_PAGED)
+    {
+        return has_regs(sm) ? SIM_PAGED_SIZE : 0;
+    }
+    return sm->rom_size;
+}
+
+// mode_prepare - Set the SRAM cache up like rom_cache_fill() does in the firmware
+// Returns:
+//   cached_length for mapper_run()
+static uint32_t mode_prepare(const sim_mapper_t *sm, sim_mode_t mode, const uint8_t *rom, uint32_t rom_size)
+{
+    romcache_enabled = false;
+    romload_all = 0;
+    romload_ready = 0;
+    switch (mode)
+    {
+        case MODE_SRAM:
+            romload_start(rom, sram, rom_size, rom_size >> ROMLOAD_SEGMENT_SHIFT, mapper_boot_mask(sm->desc));
+            return rom_size;
+        case MODE_PAGED:
+            romcache_init(rom, rom_size, sram, SIM_SRAM_SIZE / ROMCACHE_SLOT_SIZE);
+            return 0;
+        default:
+            return 0;
+    }
+}
+
+// Host counters
+static int perf_fd = -1;
+
+static void counters_open(void)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    perf_fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+static uint64_t cycles_now(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+#endif
+}
+
+static uint64_t instructions_now(void)
+{
+    uint64_t count = 0;
+    if (perf_fd < 0 || read(perf_fd, &count, sizeof(count)) != sizeof(count))
+    {
+        return 0;
+    }
+    return count;
+}
+
+typedef struct {
+    double cycles;
+    double instructions;
+} sim_cost_t;
+
+// run_script - Run an engine over a script, best of several runs
+static sim_cost_t run_script(const sim_mapper_t *sm, sim_mode_t mode, const uint8_t *rom, uint32_t rom_size,
+                             const uint32_t *script, const int16_t *expect, size_t len, int repeat)
+{
+    sim_cost_t best = { 1e30, 1e30 };
+    for (int r = 0; r < repeat; r++)
+    {
+        uint32_t const cached_length = mode_prepare(sm, mode, rom, rom_size);
+        const uint8_t *const flash = rom;
+
+        bus_begin(script, expect, len);
+        if (perf_fd >= 0)
+        {
+            ioctl(perf_fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(perf_fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+        uint64_t const i0 = instructions_now();
+        uint64_t const c0 = cycles_now();
+        if (!setjmp(bus_done))
+        {
+            sm->engine(flash, rom_size, cached_length);
+        }
+        uint64_t const c1 = cycles_now();
+        uint64_t const i1 = instructions_now();
+        if (perf_fd >= 0)
+        {
+            ioctl(perf_fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+
+        double const cycles = (double)(c1 - c0) / (len - 1);
+        double const instructions = (double)(i1 - i0) / (len - 1);
+        best.cycles = (cycles < best.cycles) ? cycles : best.cycles;
+        best.instructions = (instructions < best.instructions) ? instructions : best.instructions;
+    }
+    return best;
+}
+
+static bool report_errors(const char *what)
+{
+    if (bus_stats.mismatches || bus_stats.missing || bus_stats.spurious)
+    {
+        printf("FAIL %s: %llu wrong, %llu missing, %llu spurious bytes (first at cycle %zu, bus %08x)\n", what,
+               (unsigned long long)bus_stats.mismatches, (unsigned long long)bus_stats.missing,
+               (unsigned long long)bus_stats.spurious, bus_stats.first_error, bus_script[bus_stats.first_error]);
+        return false;
+    }
+    return true;
+}
+
+#if PICOVERSE_PERF
+// check_perf_port - Latch the counters through PERF_PORT and read the block back while an engine runs
+static bool check_perf_port(uint32_t *script, int16_t *expect)
+{
+    size_t len = 0;
+    uint8_t const mapper = 42;
+
+    perf_init();
+    perf.mapper = mapper;
+    script[len] = BUS_IDLE;
+    expect[len++] = BUS_NO_DATA;
+    script[len] = BUS_IO_WRITE(PERF_PORT, PERF_CMD_CURRENT);
+    expect[len++] = BUS_NO_DATA;
+    for (size_t i = 0; i < sizeof(perf_counters_t); i++)
+    {
+        uint8_t const known = (i < 4) ? (PERF_MAGIC >> (8 * i)) & 0xFF : mapper;
+        script[len] = BUS_IO_READ(PERF_PORT);
+        expect[len++] = (i < 5) ? known : BUS_ANY_DATA;
+    }
+    script[len] = BUS_IO_READ(PERF_PORT);
+    expect[len++] = 0xFF;               // Past the end of the block
+
+    romcache_enabled = false;
+    romload_all = 0;
+    romload_ready = 0;
+    bus_begin(script, expect, len);
+    if (!setjmp(bus_done))
+    {
+        mappers[0].engine(flash_image + SIM_ROM_OFFSET, mappers[0].rom_size, 0);
+    }
+    printf("%-16s %llu bytes checked\n", "perf port", (unsigned long long)bus_stats.checked);
+    return report_errors("perf port");
+}
+#endif
+
+#define SIM_LZ_HASH_BITS       12
+#define SIM_XIP_CYCLES_PER_BYTE 4.0             // QSPI flash at 125MHz (clkdiv 2 at 250MHz), 4 bits per clock
+
+static uint8_t lz_rom[SIM_PAGED_SIZE];
+static uint8_t lz_stream[SIM_PAGED_SIZE + ROMLZ_ENTRY_SIZE * (SIM_PAGED_SIZE / ROMLZ_SEGMENT_SIZE)];
+
+// lz_put_length - Store an LZ4 length past the 15 of its token
+static size_t lz_put_length(uint8_t *out, size_t at, size_t length)
+{
+    for (; length >= 255; length -= 255)
+    {
+        out[at++] = 255;
+    }
+    out[at++] = length;
+    return at;
+}
+
+// lz_compress - Greedy LZ4 block encoder, written from the block format (the multirom tool searches harder)
+static size_t lz_compress(const uint8_t *data, size_t length, uint8_t *out)
+{
+    int32_t last[1u << SIM_LZ_HASH_BITS];
+    size_t const limit = (length > 12) ? length - 12 : 0;  // The last match starts 12 bytes before the end at the latest
+    size_t at = 0, anchor = 0, i = 0;
+
+    memset(last, 0xFF, sizeof(last));
+    while (true)
+    {
+        size_t run = i - anchor, match = 0, distance = 0;
+        if (i < limit)
+        {
+            uint32_t word;
+            memcpy(&word, &data[i], 4);
+            uint32_t const h = (word * 2654435761u) >> (32 - SIM_LZ_HASH_BITS);
+            int32_t const candidate = last[h];
+            last[h] = i;
+            if (candidate < 0 || memcmp(&data[candidate], &data[i], 4))
+            {
+                i++;
+                continue;
+            }
+            while (i + match < length - 5 && data[candidate + match] == data[i + match])
+            {
+                match++;
+            }
+            distance = i - candidate;
+        }
+        else
+        {
+            run = length - anchor;                          // Last sequence, literals only
+        }
+        uint8_t *const token = &out[at++];
+        *token = ((run < 15) ? run : 15) << 4;
+        if (run >= 15)
+        {
+            at = lz_put_length(out, at, run - 15);
+        }
+        memcpy(&out[at], &data[anchor], run);
+        at += run;
+        if (!distance)
+        {
+            break;
+        }
+        out[at++] = distance & 0xFF;
+        out[at++] = distance >> 8;
+        *token |= (match - ROMLZ_MIN_MATCH < 15) ? match - ROMLZ_MIN_MATCH : 15;
+        if (match - ROMLZ_MIN_MATCH >= 15)
+        {
+            at = lz_put_length(out, at, match - ROMLZ_MIN_MATCH - 15);
+        }
+        i += match;
+        anchor = i;
+    }
+    return at;
+}
+
+// lz_build - Fill lz_rom with a MegaROM-like image and store it into lz_stream (romlz.h layout, the stream is the
+// image), every fifth segment a copy of an earlier one
+// Returns:
+//   Size of the stream
+static uint32_t lz_build(void)
+{
+    uint32_t const segments = SIM_PAGED_SIZE / ROMLZ_SEGMENT_SIZE;
+    uint32_t at = ROMLZ_ENTRY_SIZE * segments;
+    static uint8_t block[ROMLZ_SEGMENT_SIZE + ROMLZ_SEGMENT_SIZE / 255 + 16];
+
+    for (uint32_t segment = 0; segment < segments; segment++)
+    {
+        uint8_t *const data = &lz_rom[segment * ROMLZ_SEGMENT_SIZE];
+        uint8_t *const entry = &lz_stream[ROMLZ_ENTRY_SIZE * segment];
+        if (segment % 5 == 4)
+        {
+            uint32_t const shared = rng() % segment;
+            memcpy(data, &lz_rom[shared * ROMLZ_SEGMENT_SIZE], ROMLZ_SEGMENT_SIZE);
+            memcpy(entry, &lz_stream[ROMLZ_ENTRY_SIZE * shared], ROMLZ_ENTRY_SIZE);
+            continue;
+        }
+        uint32_t const code = 1024 + rng() % 3072;          // Code, then tiles, then padding
+        uint32_t const tiles = code + rng() % (ROMLZ_SEGMENT_SIZE - code);
+        uint8_t tile[8];
+        for (uint32_t i = 0; i < sizeof(tile); i++)
+        {
+            tile[i] = rng();
+        }
+        for (uint32_t i = 0; i < ROMLZ_SEGMENT_SIZE; i++)
+        {
+            data[i] = (i < code) ? rng() : (i < tiles) ? tile[i & 7] ^ ((i % 96) ? 0 : i) : 0xFF;
+        }
+
+        size_t const length = lz_compress(data, ROMLZ_SEGMENT_SIZE, block);
+        uint32_t const stored = (length < ROMLZ_SEGMENT_SIZE) ? length : ROMLZ_SEGMENT_SIZE;
+        memcpy(entry, &at, 4);
+        memcpy(entry + 4, &stored, 4);
+        memcpy(&lz_stream[at], (length < ROMLZ_SEGMENT_SIZE) ? block : data, stored);  // Or stored as it is
+        at += stored;
+    }
+    return at;
+}
+
+// check_romlz - Serve a ROM stored as segments from SRAM and demand-paged, and time the decoder
+static bool check_romlz(uint32_t *script, int16_t *expect, size_t len, bool bench)
+{
+    const sim_mapper_t *const sm = &mappers[4];         // ASCII8, 8KB banks on every register
+    uint32_t const stored = lz_build();
+    bool ok = true;
+
+    // A damaged segment table is refused
+    lz_stream[ROMLZ_ENTRY_SIZE + 5] ^= 0x40;             // Block longer than its segment
+    if (romlz_open(lz_stream, 0, SIM_PAGED_SIZE))
+    {
+        printf("FAIL romlz: damaged stream accepted\n");
+        ok = false;
+    }
+    lz_stream[ROMLZ_ENTRY_SIZE + 5] ^= 0x40;
+    if (!romlz_open(lz_stream, 0, SIM_PAGED_SIZE) || romlz_end(lz_stream, 0, SIM_PAGED_SIZE) != stored)
+    {
+        printf("FAIL romlz: stream refused\n");
+        return false;
+    }
+
+    romload_read = romlz_read;
+    static const sim_mode_t modes[] = { MODE_SRAM, MODE_PAGED };
+    for (size_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+    {
+        sim_mode_t const mode = modes[m];
+        uint32_t const rom_size = mode_rom_size(sm, mode);
+        char what[32];
+        snprintf(what, sizeof(what), "romlz/%s", mode_names[mode]);
+        ref_reset(sm);
+        script[0] = BUS_IDLE;
+        expect[0] = BUS_NO_DATA;
+        build_check_script(sm, lz_rom, rom_size, script, expect, 1, len);
+        run_script(sm, mode, lz_stream, rom_size, script, expect, len, 1);  // Any byte read from the stream is wrong
+        ok &= report_errors(what);
+        printf("%-16s %llu reads checked, %u bytes stored for %u\n", what, (unsigned long long)bus_stats.checked,
+               stored, SIM_PAGED_SIZE);
+    }
+
+    if (bench)
+    {
+        // Best of several loads of the SRAM cache, decompressed and copied
+        double decode = 1e30, copy = 1e30, instructions = 1e30;
+        for (int r = 0; r < 5; r++)
+        {
+            if (perf_fd >= 0)
+            {
+                ioctl(perf_fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(perf_fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+            uint64_t const i0 = instructions_now();
+            uint64_t const c0 = cycles_now();
+            ok &= romlz_read(sram, 0, SIM_SRAM_SIZE);
+            uint64_t const c1 = cycles_now();
+            uint64_t const i1 = instructions_now();
+            if (perf_fd >= 0)
+            {
+                ioctl(perf_fd, PERF_EVENT_IOC_DISABLE, 0);
+            }
+            uint64_t const c2 = cycles_now();
+            memcpy(sram, lz_rom, SIM_SRAM_SIZE);
+            uint64_t const c3 = cycles_now();
+            decode = ((double)(c1 - c0) < decode) ? (double)(c1 - c0) : decode;
+            copy = ((double)(c3 - c2) < copy) ? (double)(c3 - c2) : copy;
+            instructions = ((double)(i1 - i0) < instructions) ? (double)(i1 - i0) : instructions;
+        }
+        ok &= !memcmp(sram, lz_rom, SIM_SRAM_SIZE);
+
+        // On the board the copy is bound by the flash, the decoder reads fewer flash bytes and runs about one
+        // instruction per cycle (the host cycles stand in for the instructions without the perf counters)
+        double const flash_bytes = (double)romlz_end(lz_stream, 0, SIM_PAGED_SIZE) / SIM_PAGED_SIZE;
+        double const work = (perf_fd >= 0) ? instructions / SIM_SRAM_SIZE : decode / SIM_SRAM_SIZE;
+        double const model_copy = SIM_XIP_CYCLES_PER_BYTE;
+        double const model_decode = flash_bytes * SIM_XIP_CYCLES_PER_BYTE + work;
+        printf("romlz      ratio %.2f, decode %.2f %s/byte, host %.2f cyc/byte (copy %.2f cyc/byte)\n",
+               1.0 / flash_bytes, work, (perf_fd >= 0) ? "ins" : "cyc", decode / SIM_SRAM_SIZE, copy / SIM_SRAM_SIZE);
+        printf("romlz      XIP model: copy %.2f cyc/byte, decode %.2f cyc/byte\n", model_copy, model_decode);
+        if (model_decode >= model_copy)
+        {
+            printf("FAIL romlz: decompressing is slower than copying from flash\n");
+            ok = false;
+        }
+    }
+    romload_read = NULL;
+    return ok;
+}
+
+#define SIM_CATALOG_ROMS   300             // Records in the flash, past 256 the index needs its high byte
+#define SIM_CATALOG_SD     5               // Records appended in RAM, like the ones of the SD card
+#define SIM_CATALOG_ALL    (SIM_CATALOG_ROMS + SIM_CATALOG_SD)
+
+static uint8_t catalog_image[ROMCONFIG_OFFSET + sizeof(romconfig_header_t) +
+                             SIM_CATALOG_ROMS * (sizeof(romconfig_record_t) + CATALOG_NAME_LENGTH)];
+static romconfig_record_t catalog_sd_records[SIM_CATALOG_SD];
+static char catalog_sd_names[SIM_CATALOG_SD * CATALOG_NAME_LENGTH];
+static char catalog_names[SIM_CATALOG_ALL][CATALOG_NAME_LENGTH + 1];   // Expected name, mapper and size of each entry
+static uint8_t catalog_mappers[SIM_CATALOG_ALL];
+static uint32_t catalog_sizes[SIM_CATALOG_ALL];
+static uint16_t catalog_ref_view[SIM_CATALOG_ALL];    // Entries the query should leave
+static uint32_t catalog_ref_count;
+
+// catalog_push - Append a cycle to a catalog script, if it fits
+static void catalog_push(uint32_t *script, int16_t *expect, size_t *n, size_t len, uint32_t cycle, int16_t data)
+{
+    if (*n < len)
+    {
+        script[*n] = cycle;
+        expect[(*n)++] = data;
+    }
+}
+
+// catalog_ref_filter - Entries whose name holds the query, whatever the case
+static void catalog_ref_filter(const char *query)
+{
+    size_t const length = strlen(query);
+    catalog_ref_count = 0;
+    for (uint32_t entry = 0; entry < SIM_CATALOG_ALL; entry++)
+    {
+        const char *const name = catalog_names[entry];
+        bool found = false;
+        for (size_t at = 0; !found && at + length <= strlen(name); at++)
+        {
+            found = !strncasecmp(&name[at], query, length);
+        }
+        if (found)
+        {
+            catalog_ref_view[catalog_ref_count++] = entry;
+        }
+    }
+}
+
+// catalog_push_page - Expect a page of the filtered list
+static void catalog_push_page(uint32_t *script, int16_t *expect, size_t *n, size_t len, uint32_t page)
+{
+    static const char *const names[] = { "PL-16", "PL-32", "KonSCC", "Linear", "ASC-08", "ASC-16", "Konami", "NEO-8",
+                                         "NEO-16", "SYSTEM", "AUTO", "ASC8SR", "ASC16S", "GM2", "SCC+", "DSK" };
+    for (uint32_t line = 0; line < CATALOG_PAGE_LINES; line++)
+    {
+        uint32_t const shown = page * CATALOG_PAGE_LINES + line;
+        char text[CATALOG_LINE_LENGTH + 8];
+        memset(text, ' ', sizeof(text));
+        if (shown < catalog_ref_count)
+        {
+            uint32_t const entry = catalog_ref_view[shown];
+            snprintf(text, sizeof(text), " %-24.24s %04u %-7s", catalog_names[entry], catalog_sizes[entry] / 1024,
+                     names[catalog_mappers[entry] - 1]);
+        }
+        for (uint32_t c = 0; c < CATALOG_LINE_LENGTH; c++)
+        {
+            catalog_push(script, expect, n, len, BUS_IO_READ(CATALOG_PORT), (uint8_t)text[c]);
+        }
+    }
+}
+
+// catalog_push_header - Expect the entry and page counts of the filtered list
+static void catalog_push_header(uint32_t *script, int16_t *expect, size_t *n, size_t len)
+{
+    uint32_t const pages = catalog_ref_count ? (catalog_ref_count + CATALOG_PAGE_LINES - 1) / CATALOG_PAGE_LINES : 1;
+    catalog_push(script, expect, n, len, BUS_IO_READ(CATALOG_PORT), catalog_ref_count & 0xFF);
+    catalog_push(script, expect, n, len, BUS_IO_READ(CATALOG_PORT), catalog_ref_count >> 8);
+    catalog_push(script, expect, n, len, BUS_IO_READ(CATALOG_PORT), pages & 0xFF);
+    catalog_push(script, expect, n, len, BUS_IO_READ(CATALOG_PORT), pages >> 8);
+}
+
+// catalog_push_entry - Expect an entry of the filtered list, 0xFF past its end
+static void catalog_push_entry(uint32_t *script, int16_t *expect, size_t *n, size_t len, uint32_t shown)
+{
+    bool const known = shown < catalog_ref_count;
+    uint32_t const entry = known ? catalog_ref_view[shown] : 0;
+    size_t const length = strlen(catalog_names[entry]);
+
+    catalog_push(script, expect, n, len, BUS_IO_WRITE(CATALOG_PORT, CATALOG_CMD_ENTRY), BUS_NO_DATA);
+    catalog_push(script, expect, n, len, BUS_IO_WRITE(CATALOG_PORT, shown & 0xFF), BUS_NO_DATA);
+    catalog_push(script, expect, n, len, BUS_IO_WRITE(CATALOG_PORT, shown >> 8), BUS_NO_DATA);
+    for (uint32_t c = 0; c < CATALOG_NAME_LENGTH; c++)
+    {
+        uint8_t const data = (c < length) ? catalog_names[entry][c] : ' ';
+        catalog_push(script, expect, n, len, BUS_IO_READ(CATALOG_PORT), known ? data : 0xFF);
+    }
+    catalog_push(script, expect, n, len, BUS_IO_READ(CATALOG_PORT), known ? catalog_mappers[entry] : 0xFF);
+    catalog_push(script, expect, n, len, BUS_IO_READ(CATALOG_PORT), known ? entry & 0xFF : 0xFF);
+    catalog_push(script, expect, n, len, BUS_IO_READ(CATALOG_PORT), known ? entry >> 8 : 0xFF);
+    catalog_push(script, expect, n, len, BUS_IO_READ(CATALOG_PORT), 0xFF);
+}
+
+// check_catalog - Ask the firmware for the header, pages and entries of a catalog through CATALOG_PORT, then search it
+static bool check_catalog(uint32_t *script, int16_t *expect, size_t len)
+{
+    static const uint8_t keys[] = { 'c', 'D', CATALOG_KEY_DELETE, 'd', 'e', 'z', CATALOG_KEY_DELETE,
+                                    CATALOG_KEY_DELETE, CATALOG_KEY_DELETE, 'q', CATALOG_KEY_CLEAR };
+    char query[CATALOG_QUERY_LENGTH + 1] = "";
+    size_t query_length = 0;
+    size_t n = 0;
+
+    // Names of every length in mixed case, some of them twice, in a configuration area (romconfig.h) where the
+    // repeated names share the pool, then records in RAM appended to it
+    romconfig_header_t header = { .magic = ROMCONFIG_MAGIC, .version = ROMCONFIG_VERSION, .count = SIM_CATALOG_ROMS };
+    romconfig_record_t *const records = (romconfig_record_t *)&catalog_image[ROMCONFIG_OFFSET + sizeof(header)];
+    char *const pool = (char *)&records[SIM_CATALOG_ROMS];
+    header.records = ROMCONFIG_OFFSET + sizeof(header);
+    header.names = header.records + SIM_CATALOG_ROMS * sizeof(romconfig_record_t);
+    memset(catalog_names, 0, sizeof(catalog_names));
+    for (uint32_t i = 0; i < SIM_CATALOG_ALL; i++)
+    {
+        uint32_t const length = (i * 7) % CATALOG_NAME_LENGTH + 1;
+        for (uint32_t c = 0; c < length; c++)
+        {
+            catalog_names[i][c] = ((c & 1) ? 'a' : 'A') + (i * 3 + c * c) % 26;
+        }
+        if (i % 10 == 9)
+        {
+            strcpy(catalog_names[i], catalog_names[i - 1]);
+        }
+        catalog_mappers[i] = i % 16 + 1;
+        catalog_sizes[i] = (i % 64 + 1) * 8192;
+
+        bool const sd = i >= SIM_CATALOG_ROMS;
+        romconfig_record_t *const record = sd ? &catalog_sd_records[i - SIM_CATALOG_ROMS] : &records[i];
+        record->name_length = strlen(catalog_names[i]);
+        record->mapper = catalog_mappers[i];
+        record->flags = 0;
+        record->size = catalog_sizes[i];
+        record->offset = sd ? 0x80000000u | (i - SIM_CATALOG_ROMS) : SIM_ROM_OFFSET;
+        if (sd)
+        {
+            record->name = (i - SIM_CATALOG_ROMS) * CATALOG_NAME_LENGTH;
+            memcpy(&catalog_sd_names[record->name], catalog_names[i], record->name_length);
+        }
+        else if (i % 10 == 9)
+        {
+            record->name = records[i - 1].name;
+        }
+        else
+        {
+            record->name = header.names_size;
+            memcpy(&pool[header.names_size], catalog_names[i], record->name_length);
+            header.names_size += record->name_length;
+        }
+    }
+    memcpy(&catalog_image[ROMCONFIG_OFFSET], &header, sizeof(header));
+    if (!romconfig_open(catalog_image) || romconfig_count() != SIM_CATALOG_ROMS)
+    {
+        printf("catalog: configuration area not opened\n");
+        return false;
+    }
+    romconfig_append(catalog_sd_records, catalog_sd_names, SIM_CATALOG_SD);
+    catalog_build();
+    catalog_ref_filter("");
+
+    catalog_push(script, expect, &n, len, BUS_IDLE, BUS_NO_DATA);
+    catalog_push(script, expect, &n, len, BUS_IO_WRITE(CATALOG_PORT, CATALOG_CMD_INFO), BUS_NO_DATA);
+    catalog_push_header(script, expect, &n, len);
+    catalog_push(script, expect, &n, len, BUS_IO_READ(CATALOG_PORT), 0xFF);
+    for (uint32_t page = 0; page <= SIM_CATALOG_ALL / CATALOG_PAGE_LINES + 1; page++) // One past the last reads blank
+    {
+        catalog_push(script, expect, &n, len, BUS_IO_WRITE(CATALOG_PORT, CATALOG_CMD_PAGE), BUS_NO_DATA);
+        catalog_push(script, expect, &n, len, BUS_MEM_READ(0x4000), BUS_NO_DATA); // Not on the port, left alone
+        catalog_push(script, expect, &n, len, BUS_IO_WRITE(CATALOG_PORT, page), BUS_NO_DATA);
+        catalog_push(script, expect, &n, len, BUS_IO_WRITE(CATALOG_PORT, 0), BUS_NO_DATA);
+        catalog_push_page(script, expect, &n, len, page);
+        catalog_push(script, expect, &n, len, BUS_IO_READ(CATALOG_PORT), 0xFF);
+    }
+    catalog_push_entry(script, expect, &n, len, 0);
+    catalog_push_entry(script, expect, &n, len, 19);
+    catalog_push_entry(script, expect, &n, len, 257);
+    catalog_push_entry(script, expect, &n, len, SIM_CATALOG_ROMS);                  // First record in RAM
+    catalog_push_entry(script, expect, &n, len, SIM_CATALOG_ALL - 1);
+    catalog_push_entry(script, expect, &n, len, SIM_CATALOG_ALL);
+
+    // Each key answers the new counts and the first page, the pages and entries then follow the filtered list
+    for (size_t k = 0; k < sizeof(keys); k++)
+    {
+        if (keys[k] == CATALOG_KEY_CLEAR)
+        {
+            query_length = 0;
+        }
+        else if (keys[k] == CATALOG_KEY_DELETE)
+        {
+            query_length -= query_length ? 1 : 0;
+        }
+        else
+        {
+            query[query_length++] = keys[k];
+        }
+        query[query_length] = '\0';
+        catalog_ref_filter(query);
+        catalog_push(script, expect, &n, len, BUS_IO_WRITE(CATALOG_PORT, CATALOG_CMD_SEARCH), BUS_NO_DATA);
+        catalog_push(script, expect, &n, len, BUS_IO_WRITE(CATALOG_PORT, keys[k]), BUS_NO_DATA);
+        catalog_push_header(script, expect, &n, len);
+        catalog_push_page(script, expect, &n, len, 0);
+        catalog_push(script, expect, &n, len, BUS_IO_READ(CATALOG_PORT), 0xFF);
+        catalog_push(script, expect, &n, len, BUS_IO_WRITE(CATALOG_PORT, CATALOG_CMD_PAGE), BUS_NO_DATA);
+        catalog_push(script, expect, &n, len, BUS_IO_WRITE(CATALOG_PORT, 1), BUS_NO_DATA);
+        catalog_push(script, expect, &n, len, BUS_IO_WRITE(CATALOG_PORT, 0), BUS_NO_DATA);
+        catalog_push_page(script, expect, &n, len, 1);
+        catalog_push_entry(script, expect, &n, len, 0);
+        catalog_push_entry(script, expect, &n, len, catalog_ref_count - 1);
+    }
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        uint32_t const cycle = BUS_IO_READ(CATALOG_PORT + 1 + i % 2);
+        catalog_push(script, expect, &n, len, cycle, BUS_NO_DATA); // Other ports are left alone
+    }
+
+    bus_begin(script, expect, n);
+    if (!setjmp(bus_done))
+    {
+        for (;;)                                            // The catalog part of the menu loop
+        {
+            uint32_t const bus = gpio_get_all();
+            if (CATALOG_CYCLE(bus))
+            {
+                catalog_io(bus);
+            }
+        }
+    }
+    printf("%-16s %llu bytes checked, %llu waits\n", "catalog", (unsigned long long)bus_stats.checked,
+           (unsigned long long)bus_stats.wait_asserts);
+    return report_errors("catalog");
+}
+
+// sim_sd_read - romload_read of the SD card runs, the file is the ROM of the flash image
+static bool sim_sd_read(uint8_t *buffer, uint32_t offset, uint32_t length)
+{
+    memcpy(buffer, flash_image + SIM_ROM_OFFSET + offset, length);
+    return true;
+}
+
+// check_automap - Start each mapper known to automap on the plain engine and check it is detected and served right
+// The second pass serves the ROMs like loadrom_auto() serves a ROM of the SD card: there is no flash copy, the engine
+// reads the SRAM loaded through romload_read, and the bank registers are written with any value, so the segments past
+// the end of the ROM must wrap around it instead of reading past the SRAM.
+static bool check_automap(const uint8_t *rom, uint32_t *script, int16_t *expect, size_t len, uint32_t seed)
+{
+    static const char *const names[] = { "konamiscc", "konami", "ascii8", "ascii16" };
+    static const uint8_t codes[] = { 3, 7, 5, 6 };
+    bool ok = true;
+
+    memset(sim_xip, 0xFF, sizeof(sim_xip));
+    automap_init(XIP_BASE + FLASH_SECTOR_SIZE);
+    for (int sd = 0; sd < 2; sd++)
+    {
+        for (size_t n = 0; n < sizeof(codes); n++)
+        {
+            const sim_mapper_t *sm = NULL;
+            for (size_t m = 0; m < SIM_MAPPERS; m++)
+            {
+                sm = strcmp(mappers[m].name, names[n]) ? sm : &mappers[m];
+            }
+
+            // Power-on values of every register, a few reads, then a real bank switch
+            size_t i = 0;
+            ref_reset(sm);
+            ref_rom_mask = sd ? SIM_BANKED_SIZE - 1 : 0xFFFFFFFFu;
+            script[i] = BUS_IDLE;
+            expect[i++] = BUS_NO_DATA;
+            for (int bank = 0; bank < sm->banks; bank++)
+            {
+                if (sm->reg_addr[bank])
+                {
+                    script[i] = BUS_MEM_WRITE(sm->reg_addr[bank], sm->initial[bank]);
+                    expect[i++] = BUS_NO_DATA;
+                    uint16_t const addr = range_address(sm);
+                    script[i] = BUS_MEM_READ(addr);
+                    expect[i++] = ref_read(sm, rom, addr);
+                }
+            }
+            uint16_t const reg = sm->reg_addr[sm->banks - 1];
+            script[i] = BUS_MEM_WRITE(reg, 5);
+            expect[i++] = BUS_NO_DATA;
+            ref_write(sm, reg, 5);
+
+            // Every 8-bit bank value on the SD card runs, 128KB ROMs have 8 or 16 segments
+            rng_state = seed;
+            build_check_script(sm, rom, sd ? 256 * sm->bank_size : SIM_BANKED_SIZE, script, expect, i, len);
+            romcache_enabled = false;
+            romload_all = 0;
+            romload_ready = 0;
+            romload_read = sd ? sim_sd_read : NULL;
+            romload_start(rom, sram, SIM_BANKED_SIZE, SIM_BANKED_SIZE >> ROMLOAD_SEGMENT_SHIFT,
+                          mapper_boot_mask(&mapper_plain32));
+            if (sd)
+            {
+                romload_wait(romload_all);
+            }
+            bus_begin(script, expect, len);
+            if (!setjmp(bus_done))
+            {
+                engine_auto(sd ? sram : rom, SIM_BANKED_SIZE, SIM_BANKED_SIZE);
+            }
+            romload_read = NULL;
+            ref_rom_mask = 0xFFFFFFFFu;
+
+            char what[32];
+            snprintf(what, sizeof(what), "auto%s/%s", sd ? "sd" : "", sm->name);
+            ok &= report_errors(what);
+            uint8_t const stored = automap_lookup(rom, SIM_ROM_OFFSET, SIM_BANKED_SIZE);
+            printf("%-16s %llu reads checked, detected %u, stored %u\n", what, (unsigned long long)bus_stats.checked,
+                   automap_result(), stored);
+            if (automap_result() != codes[n] || stored != codes[n])
+            {
+                printf("FAIL %s: expected mapper %u\n", what, codes[n]);
+                ok = false;
+            }
+        }
+    }
+    return ok;
+}
+
+#if PICOVERSE_SCC
+// check_scc - Enable the SCC, write and read back its registers, then check what reached the synthesizer
+static bool check_scc(const uint8_t *rom, uint32_t *script, int16_t *expect, size_t len)
+{
+    const sim_mapper_t *sm = NULL;
+    for (size_t m = 0; m < SIM_MAPPERS; m++)
+    {
+        sm = strcmp(mappers[m].name, "konamiscc") ? sm : &mappers[m];
+    }
+
+    // Register writes of the script, in order, as the synthesizer must receive them
+    static uint32_t posted[SCC_QUEUE_SIZE];
+    size_t count = 0;
+    size_t i = 0;
+    ref_reset(sm);
+    ref_rom_mask = SIM_BANKED_SIZE - 1;     // The values enabling the SCC select segments past the end of the ROM
+    script[i] = BUS_IDLE;
+    expect[i++] = BUS_NO_DATA;
+    while (i + 4 < len && count < sizeof(posted) / sizeof(posted[0]))
+    {
+        uint32_t const kind = rng() % 100;
+        uint16_t addr;
+        uint8_t data = rng();
+        if (kind < 3)
+        {
+            addr = 0x9000 | (rng() & 0x07FF); // Enable (mostly) or disable the SCC
+            data = (rng() % 4) ? (data | 0x3F) : (data & 0x0F);
+        }
+        else if (kind < 50)
+        {
+            addr = 0x9800 | (rng() & 0x07FF);
+            if (ref_scc(sm, addr))
+            {
+                posted[count++] = ((uint32_t)data << 16) | (addr & 0xFF);
+            }
+        }
+        else
+        {
+            addr = 0x8000 + rng() % 0x2000;
+            script[i] = BUS_MEM_READ(addr);
+            expect[i++] = ref_read(sm, rom, addr);
+            continue;
+        }
+        script[i] = BUS_MEM_WRITE(addr, data);
+        expect[i++] = BUS_NO_DATA;
+        ref_write(sm, addr, data);
+    }
+    ref_rom_mask = 0xFFFFFFFFu;
+
+    romcache_enabled = false;
+    romload_all = 0;
+    romload_ready = 0;
+    romload_start(rom, sram, SIM_BANKED_SIZE, SIM_BANKED_SIZE >> ROMLOAD_SEGMENT_SHIFT,
+                  mapper_boot_mask(&mapper_konamiscc));
+    bus_begin(script, expect, i);
+    if (!setjmp(bus_done))
+    {
+        engine_konamiscc(rom, SIM_BANKED_SIZE, SIM_BANKED_SIZE);
+    }
+    bool ok = report_errors("scc");
+
+    // The queue holds the writes in order, the synthesizer decodes them into the same waveforms
+    bool same = (scc_queue_head - scc_queue_tail == count) && !scc_queue_dropped;
+    for (size_t n = 0; same && n < count; n++)
+    {
+        same = scc_queue[(scc_queue_tail + n) & (SCC_QUEUE_SIZE - 1)] == posted[n];
+    }
+    scc_t scc;
+    scc_reset(&scc, SCC_SAMPLE_RATE);
+    scc_drain(&scc);
+    same &= !memcmp(scc.wave, ref_scc_wave, sizeof(ref_scc_wave));
+    printf("%-16s %llu reads checked, %zu register writes posted\n", "scc", (unsigned long long)bus_stats.checked, count);
+    if (!same)
+    {
+        printf("FAIL scc: register writes lost or out of order on the way to the synthesizer\n");
+    }
+    return ok && same;
+}
+#endif
+
+// check_nextor_ram - Random cycles on the expanded Nextor slot: sub-slot register, kernel banks and memory mapper
+static bool check_nextor_ram(const uint8_t *rom, uint32_t *script, int16_t *expect, size_t len)
+{
+    static uint8_t ref_ram[SIM_SRAM_SIZE];
+    uint32_t const rom_size = SIM_BANKED_SIZE;
+    uint32_t const segments = SIM_SRAM_SIZE / NEXTOR_MAPPER_SEGMENT_SIZE;
+    uint8_t subslot = 0;
+    uint8_t seg[4] = { 3, 2, 1, 0 };
+    uint8_t bank[2] = { 0, 1 };
+
+    memset(ref_ram, 0, sizeof(ref_ram));
+    memset(sram, 0, sizeof(sram));
+    script[0] = BUS_IDLE;
+    expect[0] = BUS_NO_DATA;
+    for (size_t i = 1; i < len; i++)
+    {
+        uint32_t const kind = rng() % 100;
+        uint16_t addr = rng();
+        uint8_t data = rng();
+        expect[i] = BUS_NO_DATA;
+        if (kind < 4)
+        {
+            script[i] = BUS_MEM_WRITE(NEXTOR_SUBSLOT_REG, data);
+            subslot = data;
+            continue;
+        }
+        if (kind < 8)
+        {
+            script[i] = BUS_IO_WRITE(NEXTOR_MAPPER_PORT | (addr & 3), data);
+            seg[addr & 3] = data;
+            continue;
+        }
+        if (kind < 10)
+        {
+            script[i] = BUS_IO_READ(NEXTOR_MAPPER_PORT | (addr & 3)); // Left to the internal mapper
+            continue;
+        }
+        if (kind < 12)
+        {
+            script[i] = BUS_MEM_READ(NEXTOR_SUBSLOT_REG);
+            expect[i] = (uint8_t)~subslot;
+            continue;
+        }
+        if (kind < 16)
+        {
+            addr = 0x6000 | (addr & 0x17FF); // Kernel bank registers
+        }
+        else if (addr == NEXTOR_SUBSLOT_REG)
+        {
+            addr--;
+        }
+
+        uint8_t const page = addr >> 14;
+        uint8_t const sub = (subslot >> (2 * page)) & 3;
+        uint32_t const ram_offset = ((seg[page] % segments) << 14) + (addr & 0x3FFF);
+        if (kind < 50)
+        {
+            script[i] = BUS_MEM_WRITE(addr, data);
+            if (sub == NEXTOR_RAM_SUBSLOT)
+            {
+                ref_ram[ram_offset] = data;
+            }
+            else if (sub == NEXTOR_ROM_SUBSLOT && page == 1 && (addr & 0xE800) == 0x6000)
+            {
+                bank[(addr >> 12) & 1] = data;
+            }
+        }
+        else
+        {
+            script[i] = BUS_MEM_READ(addr);
+            if (sub == NEXTOR_RAM_SUBSLOT)
+            {
+                expect[i] = ref_ram[ram_offset];
+            }
+            else if (sub == NEXTOR_ROM_SUBSLOT && (page == 1 || page == 2))
+            {
+                expect[i] = rom[((bank[page - 1] % (rom_size >> 14)) << 14) + (addr & 0x3FFF)];
+            }
+        }
+    }
+
+    bus_begin(script, expect, len);
+    if (!setjmp(bus_done))
+    {
+        nextor_ram_run(rom, rom_size, SIM_NEXTOR_FLASH, sram, sizeof(sram));
+    }
+    bool ok = report_errors("nextor");
+    printf("%-16s %llu reads checked, %lu mapper segments\n", "nextor", (unsigned long long)bus_stats.checked,
+           (unsigned long)nextor_mapper_size);
+    if (memcmp(sram, ref_ram, segments * NEXTOR_MAPPER_SEGMENT_SIZE))
+    {
+        printf("FAIL nextor: mapper memory differs from the reference\n");
+        ok = false;
+    }
+    return ok;
+}
+
+// Battery backed SRAM mapper, from the mapper specifications
+typedef struct {
+    sim_mapper_t rom;                   // ROM banks
+    uint32_t sram_size;                 // Bytes of each SRAM bank
+    uint8_t sram_banks;
+    uint8_t enable;                     // Register bit that maps the SRAM
+    uint8_t bank_bit;                   // Register bit that selects the SRAM bank, 0 if one bank
+    uint16_t window;                    // Writable SRAM addresses (while the bank there maps it)
+    uint16_t window_end;
+} sim_sram_mapper_t;
+
+static const sim_sram_mapper_t sram_mappers[] = {
+    { { "ascii8sram", &mapper_ascii8_sram, engine_ascii8_sram, 0x4000, 4, 0x2000, SIM_BANKED_SIZE, false,
+        { 0, 1, 2, 3 }, { 0x6000, 0x6800, 0x7000, 0x7800 } },
+      8192, 1, SIM_BANKED_SIZE >> 13, 0, 0x8000, 0xBFFF },
+    { { "ascii16sram", &mapper_ascii16_sram, engine_ascii16_sram, 0x4000, 2, 0x4000, SIM_BANKED_SIZE, false,
+        { 0, 1 }, { 0x6000, 0x7000 } },
+      2048, 1, 0x10, 0, 0x8000, 0xBFFF },
+    { { "gm2", &mapper_gm2, engine_gm2, 0x4000, 4, 0x2000, SIM_BANKED_SIZE, false,
+        { 0, 1, 2, 3 }, { 0, 0x6000, 0x8000, 0xA000 } },
+      4096, 2, 0x10, 0x20, 0xB000, 0xBFFF },
+};
+#define SIM_SRAM_MAPPERS (sizeof(sram_mappers) / sizeof(sram_mappers[0]))
+
+static uint8_t ref_sram[SIM_SRAM_MAPPERS][SRAMSAVE_MAX_SIZE];
+
+// ref_sram_offset - Offset in the SRAM image read or written at an address, -1 if a ROM segment is mapped there
+static int32_t ref_sram_offset(const sim_sram_mapper_t *ss, uint16_t addr)
+{
+    uint32_t const bank = (addr - ss->rom.base) / ss->rom.bank_size;
+    uint16_t const value = ref_bank[bank];
+    if (!(value & ss->enable))
+    {
+        return -1;
+    }
+    uint32_t const sram_bank = (ss->bank_bit && (value & ss->bank_bit)) ? 1 : 0;
+    return sram_bank * ss->sram_size + ((addr - ss->rom.base) % ss->rom.bank_size) % ss->sram_size;
+}
+
+// sram_open - Load the SRAM of a game like main() does, each mapper is a game of its own (ROM offset)
+static void sram_open(const sim_sram_mapper_t *ss, const uint8_t *rom)
+{
+    uint32_t const n = ss - sram_mappers;
+    sramsave_open(rom, SIM_ROM_OFFSET + n * SIM_BANKED_SIZE, SIM_BANKED_SIZE, ss->sram_size, ss->sram_banks,
+                  ss->rom.desc->sram_enable);
+}
+
+// sram_compare - Check the shadow against the reference SRAM of a game, every mirror of every bank
+static bool sram_compare(const sim_sram_mapper_t *ss, const char *what)
+{
+    uint32_t const n = ss - sram_mappers;
+    for (uint32_t bank = 0; bank < ss->sram_banks; bank++)
+    {
+        for (uint32_t i = 0; i < SRAMSAVE_BLOCK_SIZE; i++)
+        {
+            if (sramsave_block(bank)[i] != ref_sram[n][bank * ss->sram_size + i % ss->sram_size])
+            {
+                printf("FAIL %s %s: SRAM bank %lu differs at %04lx\n", ss->rom.name, what, (unsigned long)bank,
+                       (unsigned long)i);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// sram_generations - Generation words of the two log bank headers, summed: any change is a compaction
+static uint32_t sram_generations(uintptr_t area)
+{
+    uint32_t sum = 0;
+    for (int bank = 0; bank < 2; bank++)
+    {
+        uint32_t generation;
+        memcpy(&generation, (const uint8_t *)area + bank * SRAMSAVE_BANK_SECTORS * FLASH_SECTOR_SIZE + 16, 4);
+        sum += generation;
+    }
+    return sum;
+}
+
+// check_sram - Random cycles on the SRAM mappers, then the SRAM saved to the flash log and loaded back
+static bool check_sram(const uint8_t *rom, uint32_t *script, int16_t *expect, size_t len)
+{
+    static const sim_mode_t modes[] = { MODE_SRAM, MODE_FLASH };
+    uintptr_t const area = XIP_BASE + 2 * FLASH_SECTOR_SIZE;   // Past the mapper detection store
+    uint32_t const segments = SIM_BANKED_SIZE >> 13;
+    bool ok = true;
+
+    memset(ref_sram, 0xFF, sizeof(ref_sram));
+    memset(sim_xip, 0xFF, sizeof(sim_xip));
+    for (size_t n = 0; n < SIM_SRAM_MAPPERS; n++)
+    {
+        const sim_sram_mapper_t *ss = &sram_mappers[n];
+        uint32_t const rom_segments = SIM_BANKED_SIZE / ss->rom.bank_size;
+        for (size_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+        {
+            char what[40];
+            snprintf(what, sizeof(what), "%s %s", ss->rom.name, mode_names[modes[m]]);
+
+            // Each run starts from the SRAM saved by the previous one
+            sramsave_init(area);
+            sram_open(ss, rom);
+            ok &= sram_compare(ss, "load");
+
+            ref_reset(&ss->rom);
+            script[0] = BUS_IDLE;
+            expect[0] = BUS_NO_DATA;
+            for (size_t i = 1; i < len; i++)
+            {
+                uint32_t const kind = rng() % 100;
+                uint16_t addr;
+                uint8_t data = rng();
+                expect[i] = BUS_NO_DATA;
+                if (kind < 16)
+                {
+                    // Bank switch, to a ROM segment or to the SRAM
+                    addr = register_address(&ss->rom);
+                    data = (kind < 8) ? rng() % rom_segments :
+                           ss->enable | (rng() % rom_segments) | ((rng() & 1) ? ss->bank_bit : 0);
+                    script[i] = BUS_MEM_WRITE(addr, data);
+                    ref_write(&ss->rom, addr, data);
+                }
+                else if (kind < 45)
+                {
+                    addr = ss->window + rng() % (ss->window_end - ss->window + 1u);
+                    script[i] = BUS_MEM_WRITE(addr, data);
+                    int32_t const offset = ref_sram_offset(ss, addr);
+                    if (offset >= 0)
+                    {
+                        ref_sram[n][offset] = data;
+                    }
+                }
+                else
+                {
+                    addr = range_address(&ss->rom);
+                    script[i] = BUS_MEM_READ(addr);
+                    int32_t const offset = ref_sram_offset(ss, addr);
+                    expect[i] = (offset >= 0) ? ref_sram[n][offset] :
+                                rom[(ref_bank[(addr - 0x4000) / ss->rom.bank_size] % segments) * ss->rom.bank_size +
+                                    (addr - 0x4000) % ss->rom.bank_size];
+                }
+            }
+
+            run_script(&ss->rom, modes[m], rom, SIM_BANKED_SIZE, script, expect, len, 1);
+            ok &= report_errors(what);
+            ok &= sram_compare(ss, "run");
+            printf("%-16s %llu reads checked, %lu SRAM writes\n", what, (unsigned long long)bus_stats.checked,
+                   (unsigned long)sramsave_writes);
+            if (sramsave_writes && !sramsave_flush())
+            {
+                printf("FAIL %s: nothing saved\n", what);
+                ok = false;
+            }
+        }
+    }
+
+    // Keep saving one game until the log has been compacted a few times, the other games must survive
+    const sim_sram_mapper_t *const ss = &sram_mappers[0];
+    uint32_t saves = 0;
+    sramsave_init(area);
+    sram_open(ss, rom);
+    for (int compactions = 0; compactions < 3; saves++)
+    {
+        uint32_t const generations = sram_generations(area);
+        for (int i = 0; i < 8; i++)
+        {
+            uint16_t const addr = rng() % ss->sram_size;
+            uint8_t const data = rng();
+            sramsave_write(ss->sram_size, 0, addr, data);
+            ref_sram[0][addr] = data;
+        }
+        sramsave_flush();
+        compactions += sram_generations(area) != generations;
+    }
+    for (size_t n = 0; n < SIM_SRAM_MAPPERS; n++)
+    {
+        memset(sramsave_shadow, 0, sizeof(sramsave_shadow));
+        sramsave_init(area);
+        sram_open(&sram_mappers[n], rom);
+        ok &= sram_compare(&sram_mappers[n], "reload");
+    }
+    printf("%-16s %lu saves, 3 compactions\n", "sram log", (unsigned long)saves);
+    return ok;
+}
+
+// check_sccplus - Random cycles on the Sound Cartridge: mode register, RAM banks, bank registers and SCC registers
+static bool check_sccplus(const uint8_t *rom, uint32_t *script, int16_t *expect, size_t len)
+{
+    static uint8_t ref_ram[SCCPLUS_RAM_SIZE];
+    uint8_t ref_wave[5 * 32];               // Waveforms of the five channels
+    uint8_t bank[4] = { 0, 1, 2, 3 };
+    uint8_t mode = 0;
+
+    memset(ref_wave, 0, sizeof(ref_wave));
+    memset(ref_ram, 0xFF, sizeof(ref_ram));
+    memcpy(ref_ram, rom, SIM_BANKED_SIZE);
+    memcpy(sram, ref_ram, SCCPLUS_RAM_SIZE);
+    script[0] = BUS_IDLE;
+    expect[0] = BUS_NO_DATA;
+    for (size_t i = 1; i < len; i++)
+    {
+        uint32_t const kind = rng() % 100;
+        uint16_t addr = 0x4000 + rng() % 0x8000;
+        uint8_t data = rng();
+        if (rng() % 3 == 0)
+        {
+            addr = ((rng() & 1) ? 0x9800 : 0xB800) | (rng() & 0x07FF); // Where the SCC registers show
+        }
+        if (kind < 2)
+        {
+            addr = SCCPLUS_MODE_REG | (rng() & 1);
+        }
+        else if (kind < 10)
+        {
+            uint8_t const b = rng() % 4;
+            addr = 0x5000 + 0x2000 * b + (rng() & 0x07FF);
+            if (rng() & 1)
+            {
+                data |= (b == 2) ? 0x3F : 0x80; // Enable the SCC (mostly)
+            }
+        }
+
+        // Model of the cartridge
+        uint8_t const b = (addr - 0x4000) >> 13;
+        bool const ram_bank = (mode & SCCPLUS_MODE_RAM) || (b == 0 && (mode & 0x01)) || (b == 1 && (mode & 0x02)) ||
+                              (b == 2 && (mode & 0x24) == 0x24);
+        uint32_t const ram_offset = ((bank[b] & SCCPLUS_SEGMENT_MASK) << 13) + (addr & 0x1FFF);
+        bool const plus = mode & SCCPLUS_MODE_PLUS;
+        bool const scc = PICOVERSE_SCC && ((plus && (bank[3] & 0x80) && (addr & 0xF800) == 0xB800) ||
+                                           (!plus && (bank[2] & 0x3F) == 0x3F && (addr & 0xF800) == 0x9800));
+        uint8_t const reg = addr & 0xFF;
+        if (kind < 40)
+        {
+            script[i] = BUS_MEM_WRITE(addr, data);
+            expect[i] = BUS_NO_DATA;
+            if ((addr | 1) == (SCCPLUS_MODE_REG | 1))
+            {
+                mode = data;
+            }
+            else if (ram_bank)
+            {
+                ref_ram[ram_offset] = data;
+            }
+            else if ((addr & 0x1800) == 0x1000)
+            {
+                bank[b] = data;
+            }
+            else if (scc && reg < (plus ? 0xA0 : 0x80))
+            {
+                ref_wave[reg] = data;
+                if (!plus && reg >= 0x60)
+                {
+                    ref_wave[reg + 0x20] = data; // Channel 5 follows channel 4 in compatible mode
+                }
+            }
+        }
+        else
+        {
+            script[i] = BUS_MEM_READ(addr);
+            expect[i] = !scc ? ref_ram[ram_offset] : (reg < (plus ? 0xA0 : 0x80)) ? ref_wave[reg] : 0xFF;
+        }
+    }
+
+#if PICOVERSE_SCC
+    scc_bus_reset();
+#endif
+    bus_begin(script, expect, len);
+    if (!setjmp(bus_done))
+    {
+        sccplus_run(sram);
+    }
+    bool ok = report_errors("sccplus");
+    printf("%-16s %llu reads checked, mode %02x\n", "sccplus", (unsigned long long)bus_stats.checked, sccplus_mode);
+    if (memcmp(sram, ref_ram, SCCPLUS_RAM_SIZE))
+    {
+        printf("FAIL sccplus: RAM differs from the reference\n");
+        ok = false;
+    }
+    return ok;
+}
+
+// Baseline file: one "mapper mode cycles_per_read cycles_per_switch" line per run
+typedef struct {
+    char name[16];
+    char mode[8];
+    double read;
+    double sw;
+} sim_baseline_t;
+
+static sim_baseline_t baseline[SIM_MAPPERS * MODE_COUNT];
+static int baseline_count = 0;
+
+static bool baseline_load(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    if (!f)
+    {
+        printf("Cannot open baseline %s\n", path);
+        return false;
+    }
+    while (baseline_count < (int)(sizeof(baseline) / sizeof(baseline[0])) &&
+           fscanf(f, "%15s %7s %lf %lf", baseline[baseline_count].name, baseline[baseline_count].mode,
+                  &baseline[baseline_count].read, &baseline[baseline_count].sw) == 4)
+    {
+        baseline_count++;
+    }
+    fclose(f);
+    return true;
+}
+
+static const sim_baseline_t *baseline_find(const char *name, const char *mode)
+{
+    for (int i = 0; i < baseline_count; i++)
+    {
+        if (!strcmp(baseline[i].name, name) && !strcmp(baseline[i].mode, mode))
+        {
+            return &baseline[i];
+        }
+    }
+    return NULL;
+}
+
+static void print_usage(const char *prog)
+{
+    printf("Usage: %s [options]\n", prog);
+    printf("  -m <name>, --mapper <name>  Only run one mapper (plain32, linear48, konamiscc, konami, ascii8, ascii16, neo8, neo16)\n");
+    printf("  -c <n>, --cycles <n>        Bus cycles per script (default 200000)\n");
+    printf("  -s <n>, --seed <n>          Script seed (default 1)\n");
+    printf("  -b, --bench                 Also measure the cost per read and per bank switch\n");
+    printf("  --save <file>               Write the benchmark results as a baseline\n");
+    printf("  --baseline <file>           Fail if a run is slower than the baseline by more than the tolerance\n");
+    printf("  --tolerance <pct>           Allowed slowdown against the baseline (default 15)\n");
+    printf("  -h, --help                  Show this help\n");
+}
+
+int main(int argc, char *argv[])
+{
+    const char *only = NULL;
+    const char *save_path = NULL;
+    const char *baseline_path = NULL;
+    size_t len = 200000;
+    uint32_t seed = 1;
+    bool bench = false;
+    double tolerance = 15.0;
+    bool ok = true;
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool const has_value = i + 1 < argc;
+        if ((!strcmp(argv[i], "-m") || !strcmp(argv[i], "--mapper")) && has_value)
+        {
+            only = argv[++i];
+        }
+        else if ((!strcmp(argv[i], "-c") || !strcmp(argv[i], "--cycles")) && has_value)
+        {
+            len = strtoul(argv[++i], NULL, 0);
+        }
+        else if ((!strcmp(argv[i], "-s") || !strcmp(argv[i], "--seed")) && has_value)
+        {
+            seed = strtoul(argv[++i], NULL, 0);
+        }
+        else if (!strcmp(argv[i], "-b") || !strcmp(argv[i], "--bench"))
+        {
+            bench = true;
+        }
+        else if (!strcmp(argv[i], "--save") && has_value)
+        {
+            save_path = argv[++i];
+            bench = true;
+        }
+        else if (!strcmp(argv[i], "--baseline") && has_value)
+        {
+            baseline_path = argv[++i];
+            bench = true;
+        }
+        else if (!strcmp(argv[i], "--tolerance") && has_value)
+        {
+            tolerance = strtod(argv[++i], NULL);
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return (!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help")) ? 0 : 1;
+        }
+    }
+    if (len < 16 || !seed)
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+    if (baseline_path && !baseline_load(baseline_path))
+    {
+        return 1;
+    }
+
+    uint32_t *script = malloc(len * sizeof(*script));
+    int16_t *expect = malloc(len * sizeof(*expect));
+    FILE *save = save_path ? fopen(save_path, "w") : NULL;
+    if (!script || !expect || (save_path && !save))
+    {
+        printf("Cannot allocate the scripts or create %s\n", save_path ? save_path : "");
+        return 1;
+    }
+
+    // Every byte of the flash is different from its neighbours and from the same offset of the other segments
+    for (uint32_t i = 0; i < SIM_FLASH_SIZE; i++)
+    {
+        flash_image[i] = (uint8_t)(i ^ (i >> 8) ^ (i >> 13) * 37);
+    }
+    const uint8_t *const rom = flash_image + SIM_ROM_OFFSET;
+
+    if (bench)
+    {
+        counters_open();
+        printf("%-10s %-6s %12s %12s %10s %10s\n", "mapper", "mode",
+#if defined(__x86_64__) || defined(__i386__)
+               "cyc/read", "cyc/switch",
+#else
+               "ns/read", "ns/switch",
+#endif
+               "ins/read", "ins/switch");
+    }
+
+    for (size_t m = 0; m < SIM_MAPPERS; m++)
+    {
+        const sim_mapper_t *sm = &mappers[m];
+        if (only && strcmp(only, sm->name))
+        {
+            continue;
+        }
+        for (int mode = 0; mode < MODE_COUNT; mode++)
+        {
+            uint32_t const rom_size = mode_rom_size(sm, mode);
+            char what[32];
+            if (!rom_size)
+            {
+                continue;
+            }
+            snprintf(what, sizeof(what), "%s/%s", sm->name, mode_names[mode]);
+
+            rng_state = seed;
+            ref_reset(sm);
+            script[0] = BUS_IDLE;
+            expect[0] = BUS_NO_DATA;
+            build_check_script(sm, rom, rom_size, script, expect, 1, len);
+            run_script(sm, mode, rom, rom_size, script, expect, len, 1);
+            ok &= report_errors(what);
+            if (!bench)
+            {
+                printf("%-16s %llu reads checked, %llu WAIT\n", what, (unsigned long long)bus_stats.checked,
+                       (unsigned long long)bus_stats.wait_asserts);
+                continue;
+            }
+
+            build_read_script(sm, rom, script, expect, len);
+            sim_cost_t const read = run_script(sm, mode, rom, rom_size, script, expect, len, 5);
+            ok &= report_errors(what);
+
+            sim_cost_t sw = { 0, 0 };
+            if (has_regs(sm))
+            {
+                build_switch_script(sm, rom, rom_size, script, expect, len);
+                sw = run_script(sm, mode, rom, rom_size, script, expect, len, 5);
+                ok &= report_errors(what);
+                // Each switch comes with one read, the script alternates them
+                sw.cycles = 2 * sw.cycles - read.cycles;
+                sw.instructions = 2 * sw.instructions - read.instructions;
+            }
+
+            printf("%-10s %-6s %12.2f %12.2f", sm->name, mode_names[mode], read.cycles, sw.cycles);
+            if (perf_fd >= 0)
+            {
+                printf(" %10.2f %10.2f\n", read.instructions, sw.instructions);
+            }
+            else
+            {
+                printf(" %10s %10s\n", "n/a", "n/a");
+            }
+            if (save)
+            {
+                fprintf(save, "%s %s %.2f %.2f\n", sm->name, mode_names[mode], read.cycles, sw.cycles);
+            }
+
+            const sim_baseline_t *base = baseline_path ? baseline_find(sm->name, mode_names[mode]) : NULL;
+            if (base)
+            {
+                double const limit = 1.0 + tolerance / 100.0;
+                if (read.cycles > base->read * limit || (base->sw > 0 && sw.cycles > base->sw * limit))
+                {
+                    printf("FAIL %s: slower than the baseline (%.2f/%.2f, baseline %.2f/%.2f)\n", what,
+                           read.cycles, sw.cycles, base->read, base->sw);
+                    ok = false;
+                }
+            }
+        }
+    }
+
+    if (!only)
+    {
+        rng_state = seed;
+        ok &= check_romlz(script, expect, len, bench);
+    }
+    if (!only && !bench)
+    {
+        ok &= check_automap(rom, script, expect, len, seed);
+        rng_state = seed;
+        ok &= check_nextor_ram(rom, script, expect, len);
+        rng_state = seed;
+        ok &= check_sram(rom, script, expect, len);
+        rng_state = seed;
+        ok &= check_sccplus(rom, script, expect, len);
+        ok &= check_catalog(script, expect, len);
+    }
+#if PICOVERSE_SCC
+    if ((!only || !strcmp(only, "konamiscc")) && !bench)
+    {
+        rng_state = seed;
+        ok &= check_scc(rom, script, expect, len);
+    }
+#endif
+#if PICOVERSE_PERF
+    if (!only)
+    {
+        ok &= check_perf_port(script, expect);
+    }
+#endif
+
+    if (save)
+    {
+        fclose(save);
+    }
+    free(script);
+    free(expect);
+    printf("%s\n", ok ? "All mapper runs passed" : "Some mapper runs FAILED");
+    return ok ? 0 : 1;
+}
@@ -1,4074 +0,0 @@
-unsigned char ___pico_multirom_build_multirom_bin[] = {
-  0x00, 0x20, 0x08, 0x20, 0x5d, 0x01, 0x00, 0x10, 0x1b, 0x01, 0x00, 0x10,
-  0x19, 0x78, 0x00, 0x20, 0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10,
-  0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10, 0x19, 0x01, 0x00, 0x10,
-  0x19, 0x01, 0x00, 0x10, 0x19, 0x01, 0x00, 0x10, 0x1f, 0x01, 0x00, 0x10,
-  0x9d, 0x77, 0x00, 0x20, 0x19, 0x01, 0x00, 0x10, 0x21, 0x01, 0x00, 0x10,
-  0x23, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10,
-  0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10,
-  0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10,
-  0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10,
-  0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10,
-  0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10,
-  0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10,
-  0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10,
-  0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10,
-  0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10,
-  0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10,
-  0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10,
-  0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10,
-  0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10,
-  0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10,
-  0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10,
-  0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10,
-  0x11, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0x10, 0xef, 0xf3, 0x05, 0x80,
-  0x10, 0x38, 0x00, 0xbe, 0x00, 0xbe, 0x00, 0xbe, 0x00, 0xbe, 0x00, 0xbe,
-  0x00, 0xbe, 0x00, 0xbe, 0xf2, 0xeb, 0x88, 0x71, 0xf8, 0x01, 0x00, 0x10,
-  0x18, 0x02, 0x00, 0x10, 0xa0, 0x01, 0x00, 0x10, 0x90, 0xa3, 0x1a, 0xe7,
-  0xd3, 0xde, 0xff, 0xff, 0x42, 0x01, 0x21, 0x10, 0xff, 0x01, 0x00, 0x00,
-  0x84, 0xbd, 0x00, 0x00, 0x79, 0x35, 0x12, 0xab, 0x4f, 0xf0, 0x00, 0x00,
-  0x21, 0x49, 0x08, 0x60, 0x06, 0xc8, 0x81, 0xf3, 0x08, 0x88, 0x10, 0x47,
-  0x4f, 0xf0, 0x50, 0x40, 0x00, 0x68, 0x10, 0xb1, 0x4f, 0xf0, 0x00, 0x00,
-  0xf2, 0xe7, 0x0d, 0xa4, 0x0e, 0xcc, 0x00, 0x29, 0x02, 0xd0, 0x00, 0xf0,
-  0x12, 0xf8, 0xf9, 0xe7, 0x18, 0x49, 0x19, 0x4a, 0x00, 0x20, 0x00, 0xe0,
-  0x01, 0xc1, 0x91, 0x42, 0xfc, 0xd1, 0x17, 0x49, 0x88, 0x47, 0x17, 0x49,
-  0x88, 0x47, 0x17, 0x49, 0x88, 0x47, 0x00, 0xbe, 0xfd, 0xe7, 0x01, 0xc9,
-  0x01, 0xc2, 0x9a, 0x42, 0xfb, 0xd3, 0x70, 0x47, 0x18, 0x02, 0x00, 0x10,
-  0x88, 0x01, 0x00, 0x20, 0x2c, 0x86, 0x00, 0x20, 0xbc, 0x86, 0x00, 0x10,
-  0x30, 0x86, 0x00, 0x20, 0x30, 0xbe, 0x00, 0x20, 0xbc, 0xbe, 0x00, 0x10,
-  0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20, 0xbc, 0xbe, 0x00, 0x10,
-  0x00, 0x10, 0x08, 0x20, 0x00, 0x10, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00,
-  0x70, 0x47, 0x00, 0x00, 0x08, 0xed, 0x00, 0xe0, 0x30, 0xbe, 0x00, 0x20,
-  0x68, 0xde, 0x04, 0x20, 0x25, 0x32, 0x00, 0x20, 0x75, 0x93, 0x00, 0x20,
-  0x1d, 0x32, 0x00, 0x20, 0x04, 0x7f, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00,
-  0x4c, 0xa3, 0x00, 0x20, 0x58, 0xa3, 0x00, 0x20, 0x64, 0xa3, 0x00, 0x20,
-  0x70, 0xa3, 0x00, 0x20, 0x7c, 0xa3, 0x00, 0x20, 0x88, 0xa3, 0x00, 0x20,
-  0x94, 0xa3, 0x00, 0x20, 0xa0, 0xa3, 0x00, 0x20, 0xf8, 0xb5, 0x00, 0xbf,
-  0x06, 0x4b, 0x07, 0x49, 0xc9, 0x1a, 0x89, 0x10, 0x48, 0xbf, 0x01, 0x31,
-  0x49, 0x10, 0x03, 0xd0, 0x04, 0x4b, 0x0b, 0xb1, 0x01, 0x48, 0x18, 0x47,
-  0x70, 0x47, 0x00, 0xbf, 0x30, 0xbe, 0x00, 0x20, 0x30, 0xbe, 0x00, 0x20,
-  0x00, 0x00, 0x00, 0x00, 0x08, 0xb5, 0x05, 0x4b, 0x1b, 0xb1, 0x05, 0x49,
-  0x05, 0x48, 0xaf, 0xf3, 0x00, 0x80, 0xbd, 0xe8, 0x08, 0x40, 0xff, 0xf7,
-  0xe1, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x28, 0xc0, 0x00, 0x20,
-  0x2c, 0x86, 0x00, 0x20, 0x01, 0x20, 0x70, 0x47, 0x08, 0xb9, 0x02, 0x48,
-  0x70, 0x47, 0x00, 0x20, 0x70, 0x47, 0x00, 0xbf, 0xb8, 0xb9, 0x00, 0x20,
-  0x10, 0xb4, 0x4f, 0xf4, 0x80, 0x74, 0x0c, 0x4b, 0x53, 0xf8, 0x20, 0x20,
-  0x03, 0xeb, 0x80, 0x03, 0xc0, 0x00, 0x82, 0xf0, 0x40, 0x02, 0x00, 0xf1,
-  0x80, 0x40, 0x03, 0xf5, 0x80, 0x5c, 0x02, 0xf0, 0xc0, 0x02, 0x00, 0xf5,
-  0x20, 0x30, 0x03, 0xf5, 0x40, 0x53, 0xcc, 0xf8, 0x00, 0x20, 0x41, 0x60,
-  0x1c, 0x60, 0x5d, 0xf8, 0x04, 0x4b, 0x70, 0x47, 0x04, 0x80, 0x03, 0x40,
-  0x10, 0xb4, 0x08, 0x4c, 0xc9, 0x00, 0x41, 0xea, 0x82, 0x01, 0x54, 0xf8,
-  0x20, 0x20, 0x04, 0xeb, 0x80, 0x03, 0x51, 0x40, 0x03, 0xf5, 0x80, 0x53,
-  0x01, 0xf0, 0x0c, 0x01, 0x5d, 0xf8, 0x04, 0x4b, 0x19, 0x60, 0x70, 0x47,
-  0x04, 0x80, 0x03, 0x40, 0x06, 0x4b, 0x02, 0x22, 0x03, 0xeb, 0x80, 0x03,
-  0x19, 0xb1, 0x03, 0xf5, 0x00, 0x53, 0x1a, 0x60, 0x70, 0x47, 0x03, 0xf5,
-  0x40, 0x53, 0x1a, 0x60, 0x70, 0x47, 0x00, 0xbf, 0x04, 0x80, 0x03, 0x40,
-  0x05, 0x4b, 0x53, 0xf8, 0x20, 0x20, 0x03, 0xeb, 0x80, 0x03, 0x51, 0x40,
-  0x01, 0xf0, 0x01, 0x01, 0x03, 0xf5, 0x80, 0x53, 0x19, 0x60, 0x70, 0x47,
-  0x04, 0x80, 0x03, 0x40, 0x06, 0x4b, 0x53, 0xf8, 0x20, 0x20, 0x03, 0xeb,
-  0x80, 0x03, 0x82, 0xea, 0x01, 0x12, 0x02, 0xf0, 0x30, 0x02, 0x03, 0xf5,
-  0x80, 0x53, 0x1a, 0x60, 0x70, 0x47, 0x00, 0xbf, 0x04, 0x80, 0x03, 0x40,
-  0x30, 0xb4, 0x4f, 0xf0, 0x00, 0x03, 0x43, 0xec, 0x44, 0x00, 0x43, 0xec,
-  0x40, 0x00, 0x05, 0x25, 0x4f, 0xf4, 0x80, 0x74, 0x0b, 0x4b, 0xc2, 0x00,
-  0x53, 0xf8, 0x20, 0x10, 0x03, 0xeb, 0x80, 0x00, 0x81, 0xf0, 0x40, 0x01,
-  0x02, 0xf1, 0x80, 0x43, 0x03, 0xf5, 0x20, 0x33, 0x01, 0xf0, 0xc0, 0x02,
-  0x00, 0xf5, 0x80, 0x51, 0x00, 0xf5, 0x40, 0x50, 0x0a, 0x60, 0x5d, 0x60,
-  0x04, 0x60, 0x30, 0xbc, 0x70, 0x47, 0x00, 0xbf, 0x04, 0x80, 0x03, 0x40,
-  0x10, 0xb4, 0x4f, 0xf4, 0x80, 0x71, 0x1f, 0x24, 0x0c, 0x4b, 0x53, 0xf8,
-  0x20, 0x20, 0x03, 0xeb, 0x80, 0x03, 0xc0, 0x00, 0x82, 0xf0, 0x40, 0x02,
-  0x00, 0xf1, 0x80, 0x40, 0x03, 0xf5, 0x80, 0x5c, 0x02, 0xf0, 0xc0, 0x02,
-  0x00, 0xf5, 0x20, 0x30, 0x03, 0xf5, 0x40, 0x53, 0xcc, 0xf8, 0x00, 0x20,
-  0x44, 0x60, 0x5d, 0xf8, 0x04, 0x4b, 0x19, 0x60, 0x70, 0x47, 0x00, 0xbf,
-  0x04, 0x80, 0x03, 0x40, 0x0f, 0xb4, 0x00, 0xb5, 0x83, 0xb0, 0x04, 0x9c,
-  0x07, 0x48, 0x03, 0xf0, 0xc9, 0xf8, 0x3c, 0xb1, 0x05, 0xa9, 0x20, 0x46,
-  0x01, 0x91, 0x02, 0xf0, 0x4d, 0xff, 0x04, 0x48, 0x03, 0xf0, 0xc0, 0xf8,
-  0x01, 0x20, 0x02, 0xf0, 0x5f, 0xff, 0x00, 0xbf, 0x9c, 0x9c, 0x00, 0x20,
-  0xbc, 0xa0, 0x00, 0x20, 0xef, 0xf3, 0x10, 0x80, 0x72, 0xb6, 0x06, 0x4b,
-  0xd3, 0xe8, 0xcf, 0x1f, 0x01, 0x22, 0x00, 0x29, 0xfa, 0xd1, 0xc3, 0xe8,
-  0x41, 0x2f, 0x00, 0x29, 0xf6, 0xd1, 0xbf, 0xf3, 0x5f, 0x8f, 0x70, 0x47,
-  0xc7, 0xbf, 0x00, 0x20, 0x00, 0x23, 0x03, 0x4a, 0xc2, 0xe8, 0x8f, 0x3f,
-  0x80, 0xf3, 0x10, 0x88, 0x70, 0x47, 0x00, 0xbf, 0xc7, 0xbf, 0x00, 0x20,
-  0x70, 0xb5, 0x86, 0x46, 0xef, 0xf3, 0x10, 0x85, 0x72, 0xb6, 0x12, 0x4c,
-  0xd4, 0xe8, 0xcf, 0x6f, 0x01, 0x20, 0x00, 0x2e, 0xfa, 0xd1, 0xc4, 0xe8,
-  0x46, 0x0f, 0x00, 0x2e, 0xf6, 0xd1, 0xbf, 0xf3, 0x5f, 0x8f, 0x4f, 0xf0,
-  0x01, 0x0c, 0xc8, 0x08, 0x01, 0xf0, 0x07, 0x03, 0x0c, 0xfa, 0x03, 0xf3,
-  0x1e, 0xf8, 0x00, 0xc0, 0x1c, 0xea, 0x03, 0x06, 0x08, 0xd1, 0x4c, 0xea,
-  0x03, 0x0c, 0x0e, 0xf8, 0x00, 0xc0, 0xc4, 0xe8, 0x8f, 0x6f, 0x85, 0xf3,
-  0x10, 0x88, 0x70, 0xbd, 0x10, 0x46, 0xff, 0xf7, 0xa3, 0xff, 0x00, 0xbf,
-  0xc7, 0xbf, 0x00, 0x20, 0xf8, 0xb5, 0xef, 0xf3, 0x10, 0x87, 0x72, 0xb6,
-  0x1c, 0x4e, 0xd6, 0xe8, 0xcf, 0x5f, 0x01, 0x24, 0x00, 0x2d, 0xfa, 0xd1,
-  0xc6, 0xe8, 0x45, 0x4f, 0x00, 0x2d, 0xf6, 0xd1, 0xbf, 0xf3, 0x5f, 0x8f,
-  0x9a, 0x42, 0x1b, 0xd8, 0x01, 0x25, 0x02, 0xe0, 0x01, 0x32, 0x93, 0x42,
-  0x22, 0xd3, 0xd4, 0x08, 0x10, 0xf8, 0x04, 0xe0, 0x02, 0xf0, 0x07, 0x0c,
-  0x05, 0xfa, 0x0c, 0xfc, 0x1e, 0xea, 0x0c, 0x0f, 0xf2, 0xd1, 0x4e, 0xea,
-  0x0c, 0x0e, 0x00, 0xf8, 0x04, 0xe0, 0x10, 0x46, 0x00, 0x23, 0xc6, 0xe8,
-  0x8f, 0x3f, 0x87, 0xf3, 0x10, 0x88, 0x98, 0x42, 0x07, 0xdb, 0xf8, 0xbd,
-  0x00, 0x23, 0xc6, 0xe8, 0x8f, 0x3f, 0x87, 0xf3, 0x10, 0x88, 0x4f, 0xf0,
-  0xff, 0x30, 0x00, 0x29, 0xf5, 0xd0, 0x06, 0x98, 0xff, 0xf7, 0x66, 0xff,
-  0x4f, 0xf0, 0xff, 0x30, 0xe8, 0xe7, 0x00, 0xbf, 0xc7, 0xbf, 0x00, 0x20,
-  0x04, 0x4a, 0x10, 0x78, 0x43, 0x1c, 0xdb, 0xb2, 0x18, 0x2b, 0x28, 0xbf,
-  0x10, 0x23, 0x13, 0x70, 0x70, 0x47, 0x00, 0xbf, 0xe8, 0xbc, 0x00, 0x20,
-  0x4f, 0xf0, 0xe0, 0x22, 0x93, 0x68, 0x43, 0xf0, 0x00, 0x53, 0x93, 0x60,
-  0x70, 0x47, 0x00, 0xbf, 0x00, 0x21, 0x04, 0x4b, 0x03, 0xf1, 0x20, 0x02,
-  0xc3, 0xe8, 0x8f, 0x1f, 0x01, 0x33, 0x93, 0x42, 0xfa, 0xd1, 0x70, 0x47,
-  0xbc, 0xbf, 0x00, 0x20, 0x4f, 0xf0, 0xe0, 0x23, 0x4f, 0xf0, 0x80, 0x32,
-  0xc3, 0xf8, 0x00, 0x24, 0xc3, 0xf8, 0x04, 0x24, 0xc3, 0xf8, 0x08, 0x24,
-  0xc3, 0xf8, 0x0c, 0x24, 0xc3, 0xf8, 0x10, 0x24, 0xc3, 0xf8, 0x14, 0x24,
-  0xc3, 0xf8, 0x18, 0x24, 0xc3, 0xf8, 0x1c, 0x24, 0xc3, 0xf8, 0x20, 0x24,
-  0xc3, 0xf8, 0x24, 0x24, 0xc3, 0xf8, 0x28, 0x24, 0xc3, 0xf8, 0x2c, 0x24,
-  0xc3, 0xf8, 0x30, 0x24, 0x62, 0xb6, 0x70, 0x47, 0x01, 0x23, 0x00, 0xf0,
-  0x1f, 0x02, 0x93, 0x40, 0x40, 0x09, 0x41, 0xb1, 0x80, 0x00, 0x00, 0xf1,
-  0x60, 0x40, 0x00, 0xf5, 0x61, 0x40, 0xc0, 0xf8, 0x80, 0x31, 0x03, 0x60,
-  0x70, 0x47, 0x02, 0x4a, 0x20, 0x30, 0x42, 0xf8, 0x20, 0x30, 0x70, 0x47,
-  0x00, 0xe1, 0x00, 0xe0, 0x01, 0x23, 0x06, 0x4a, 0x41, 0x09, 0x52, 0xf8,
-  0x21, 0x20, 0x00, 0xf0, 0x1f, 0x00, 0x03, 0xfa, 0x00, 0xf0, 0x10, 0x40,
-  0x00, 0x38, 0x18, 0xbf, 0x01, 0x20, 0x70, 0x47, 0x00, 0xe1, 0x00, 0xe0,
-  0xf8, 0xb5, 0x0d, 0x46, 0xef, 0xf3, 0x10, 0x87, 0x72, 0xb6, 0x12, 0x4e,
-  0xd6, 0xe8, 0xcf, 0x2f, 0x01, 0x23, 0x00, 0x2a, 0xfa, 0xd1, 0xc6, 0xe8,
-  0x42, 0x3f, 0x00, 0x2a, 0xf6, 0xd1, 0xbf, 0xf3, 0x5f, 0x8f, 0x0d, 0x4b,
-  0x00, 0xf1, 0x10, 0x04, 0x9b, 0x68, 0x0c, 0x4a, 0x53, 0xf8, 0x24, 0x30,
-  0x93, 0x42, 0x03, 0xd0, 0x99, 0x42, 0x01, 0xd0, 0x01, 0xf0, 0x0e, 0xf8,
-  0x06, 0x4b, 0x9b, 0x68, 0x43, 0xf8, 0x24, 0x50, 0xbf, 0xf3, 0x5f, 0x8f,
-  0x00, 0x23, 0xc6, 0xe8, 0x8f, 0x3f, 0x87, 0xf3, 0x10, 0x88, 0xf8, 0xbd,
-  0xc5, 0xbf, 0x00, 0x20, 0x00, 0xed, 0x00, 0xe0, 0x11, 0x01, 0x00, 0x10,
-  0x2d, 0xe9, 0xf0, 0x4f, 0x81, 0x46, 0x8b, 0x46, 0x16, 0x46, 0x83, 0xb0,
-  0xef, 0xf3, 0x10, 0x83, 0x72, 0xb6, 0xdf, 0xf8, 0xd0, 0xa1, 0x00, 0x93,
-  0xda, 0xe8, 0xcf, 0x1f, 0x01, 0x23, 0x00, 0x29, 0xfa, 0xd1, 0xca, 0xe8,
-  0x41, 0x3f, 0x00, 0x29, 0xf6, 0xd1, 0xbf, 0xf3, 0x5f, 0x8f, 0x66, 0x4b,
-  0x93, 0xf9, 0x00, 0x40, 0x00, 0x2c, 0xc0, 0xf2, 0xa0, 0x80, 0x64, 0x4d,
-  0x04, 0xeb, 0x44, 0x07, 0x05, 0xeb, 0x87, 0x08, 0x98, 0xf8, 0x06, 0x10,
-  0x09, 0xf1, 0x10, 0x09, 0x19, 0x70, 0x60, 0x4b, 0xbf, 0x00, 0x9b, 0x68,
-  0x53, 0xf8, 0x29, 0x00, 0x63, 0x00, 0x41, 0x1b, 0x5f, 0x29, 0x2f, 0xd9,
-  0x5c, 0x49, 0x88, 0x42, 0x40, 0xf0, 0xa4, 0x80, 0x1c, 0x44, 0x5b, 0x4b,
-  0x02, 0x37, 0x2f, 0x44, 0x04, 0x3b, 0xdb, 0x1b, 0xc3, 0xf3, 0x4a, 0x03,
-  0x6f, 0xea, 0xc3, 0x43, 0x4f, 0xf4, 0x21, 0x41, 0x6f, 0xea, 0xd3, 0x43,
-  0x25, 0xf8, 0x24, 0x10, 0x05, 0xeb, 0x84, 0x04, 0x63, 0x80, 0x4b, 0xf6,
-  0x01, 0x53, 0xa3, 0x80, 0xff, 0x23, 0x48, 0xf0, 0x01, 0x00, 0xe6, 0x71,
-  0xc4, 0xf8, 0x08, 0xb0, 0xa3, 0x71, 0x4b, 0x4b, 0x9b, 0x68, 0x43, 0xf8,
-  0x29, 0x00, 0xbf, 0xf3, 0x5f, 0x8f, 0x00, 0x23, 0xca, 0xe8, 0x8f, 0x3f,
-  0x00, 0x9b, 0x83, 0xf3, 0x10, 0x88, 0x03, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f,
-  0x20, 0xf0, 0x01, 0x0e, 0x9e, 0xf8, 0x07, 0x10, 0xb1, 0x42, 0x2e, 0xd8,
-  0x4f, 0xf4, 0x21, 0x43, 0xeb, 0x53, 0x41, 0x4b, 0xb9, 0x1c, 0x29, 0x44,
-  0x04, 0x3b, 0x04, 0x37, 0x5b, 0x1a, 0x2f, 0x44, 0xae, 0xf1, 0x04, 0x01,
-  0xc9, 0x1b, 0xc1, 0xf3, 0x4a, 0x04, 0x3c, 0x49, 0xc3, 0xf3, 0x4a, 0x03,
-  0x0b, 0x43, 0x21, 0x43, 0xa8, 0xf8, 0x04, 0x10, 0x39, 0x49, 0xa8, 0xf8,
-  0x02, 0x30, 0x4a, 0xf6, 0xaa, 0x20, 0x73, 0x46, 0x5b, 0x1b, 0x5b, 0x41,
-  0x58, 0x43, 0x00, 0x0d, 0x88, 0xf8, 0x07, 0x60, 0x88, 0xf8, 0x06, 0x00,
-  0xc8, 0xf8, 0x08, 0xb0, 0x48, 0xf0, 0x01, 0x00, 0xce, 0xf8, 0x00, 0x10,
-  0xbf, 0xe7, 0xd1, 0x79, 0xb1, 0x42, 0x2e, 0xd9, 0x96, 0x46, 0x9e, 0xf9,
-  0x06, 0xc0, 0x0c, 0xeb, 0x4c, 0x02, 0xbc, 0xf1, 0x00, 0x0f, 0x05, 0xeb,
-  0x82, 0x02, 0xf2, 0xda, 0x4b, 0xf6, 0x01, 0x51, 0x0e, 0xf1, 0x04, 0x02,
-  0xa8, 0xf1, 0x04, 0x07, 0xbf, 0x1a, 0xc7, 0xf3, 0x4a, 0x07, 0x6f, 0xea,
-  0xc7, 0x47, 0x6f, 0xea, 0xd7, 0x47, 0x8e, 0xf8, 0x06, 0x40, 0x03, 0xeb,
-  0x04, 0x08, 0x20, 0x4c, 0x05, 0xeb, 0x88, 0x03, 0xae, 0xf8, 0x04, 0x70,
-  0x45, 0xf8, 0x28, 0x40, 0x99, 0x80, 0x83, 0xf8, 0x06, 0xc0, 0xde, 0x71,
-  0xc3, 0xf8, 0x08, 0xb0, 0x93, 0xe7, 0x00, 0xf0, 0x3d, 0xff, 0x12, 0x4b,
-  0x93, 0xf9, 0x00, 0x40, 0x59, 0xe7, 0x72, 0x46, 0x32, 0xf8, 0x04, 0x1f,
-  0x49, 0x05, 0x14, 0xd4, 0x49, 0x15, 0x02, 0x31, 0x02, 0xeb, 0x41, 0x01,
-  0x01, 0x91, 0x6f, 0xf0, 0x07, 0x01, 0xc9, 0x1b, 0x01, 0x9f, 0x49, 0x1b,
-  0x39, 0x44, 0xc1, 0xf3, 0x4a, 0x01, 0x41, 0xf4, 0x60, 0x41, 0xc9, 0xe7,
-  0x01, 0x93, 0x00, 0xf0, 0x21, 0xff, 0x01, 0x9b, 0x56, 0xe7, 0x01, 0xf5,
-  0xff, 0x11, 0x01, 0xf5, 0xff, 0x51, 0x1f, 0x31, 0xe4, 0xe7, 0x00, 0xbf,
-  0x67, 0xde, 0x04, 0x20, 0xec, 0xbc, 0x00, 0x20, 0x00, 0xed, 0x00, 0xe0,
-  0x11, 0x01, 0x00, 0x10, 0x4c, 0xbd, 0x00, 0x20, 0x00, 0xe0, 0xff, 0xff,
-  0x01, 0x48, 0x80, 0x47, 0xc5, 0xbf, 0x00, 0x20, 0xf0, 0xb5, 0xef, 0xf3,
-  0x05, 0x85, 0xed, 0xb2, 0xef, 0xf3, 0x10, 0x8c, 0x72, 0xb6, 0x32, 0x49,
-  0xd1, 0xe8, 0xcf, 0x2f, 0x01, 0x23, 0x00, 0x2a, 0xfa, 0xd1, 0xc1, 0xe8,
-  0x42, 0x3f, 0x00, 0x2a, 0xf6, 0xd1, 0xbf, 0xf3, 0x5f, 0x8f, 0x2d, 0x4e,
-  0x40, 0xf0, 0x01, 0x0e, 0xb4, 0x68, 0x4a, 0xf6, 0xaa, 0x23, 0x54, 0xf8,
-  0x25, 0x70, 0x2a, 0x4a, 0x04, 0x46, 0xa4, 0x1a, 0x64, 0x41, 0x63, 0x43,
-  0x1b, 0x0d, 0x77, 0x45, 0x5b, 0xb2, 0x2b, 0xd0, 0x92, 0xf9, 0x06, 0x40,
-  0x9c, 0x42, 0x2c, 0xd0, 0x92, 0xf9, 0x12, 0x40, 0x9c, 0x42, 0x35, 0xd0,
-  0x92, 0xf9, 0x1e, 0x40, 0x9c, 0x42, 0x33, 0xd0, 0x92, 0xf9, 0x2a, 0x40,
-  0x9c, 0x42, 0x31, 0xd0, 0x92, 0xf9, 0x36, 0x40, 0x9c, 0x42, 0x2f, 0xd0,
-  0x92, 0xf9, 0x42, 0x40, 0x9c, 0x42, 0x23, 0xd0, 0x92, 0xf9, 0x4e, 0x40,
-  0x9c, 0x42, 0x29, 0xd0, 0x92, 0xf9, 0x5a, 0x40, 0x9c, 0x42, 0x08, 0xbf,
-  0x07, 0x24, 0x0f, 0xd0, 0x15, 0x4a, 0x00, 0x24, 0x15, 0x78, 0x13, 0x70,
-  0x85, 0x71, 0xc1, 0xe8, 0x8f, 0x4f, 0x8c, 0xf3, 0x10, 0x88, 0xf0, 0xbd,
-  0xb2, 0x68, 0x11, 0x4c, 0x42, 0xf8, 0x25, 0x40, 0xf0, 0xe7, 0x00, 0x24,
-  0x04, 0xeb, 0x44, 0x04, 0x02, 0xeb, 0x84, 0x02, 0xff, 0x24, 0x94, 0x71,
-  0x4b, 0xf6, 0x01, 0x54, 0x94, 0x80, 0xe5, 0xe7, 0x05, 0x24, 0xf3, 0xe7,
-  0x01, 0x24, 0xf1, 0xe7, 0x02, 0x24, 0xef, 0xe7, 0x03, 0x24, 0xed, 0xe7,
-  0x04, 0x24, 0xeb, 0xe7, 0x06, 0x24, 0xe9, 0xe7, 0xc5, 0xbf, 0x00, 0x20,
-  0x00, 0xed, 0x00, 0xe0, 0xec, 0xbc, 0x00, 0x20, 0x67, 0xde, 0x04, 0x20,
-  0x11, 0x01, 0x00, 0x10, 0x01, 0x4b, 0x0b, 0x44, 0x03, 0x60, 0x70, 0x47,
-  0xbc, 0xbf, 0x00, 0x20, 0x70, 0xb5, 0x10, 0x4c, 0x10, 0x4d, 0xac, 0x42,
-  0x0e, 0xd2, 0xff, 0x26, 0x23, 0x68, 0x63, 0xb1, 0xff, 0xf7, 0xf0, 0xfd,
-  0x01, 0x46, 0x20, 0x46, 0xff, 0xf7, 0xec, 0xff, 0xa6, 0x80, 0xbf, 0xf3,
-  0x5f, 0x8f, 0x08, 0x34, 0xac, 0x42, 0xf1, 0xd3, 0x70, 0xbd, 0xff, 0xf7,
-  0xe3, 0xfd, 0x01, 0x46, 0x20, 0x46, 0xff, 0xf7, 0xdf, 0xff, 0x26, 0x71,
-  0xbf, 0xf3, 0x5f, 0x8f, 0x08, 0x34, 0xac, 0x42, 0xe4, 0xd3, 0x70, 0xbd,
-  0xc8, 0xbd, 0x00, 0x20, 0xe8, 0xbd, 0x00, 0x20, 0x10, 0xb5, 0x04, 0x46,
-  0xff, 0xf7, 0xd0, 0xfd, 0x01, 0x46, 0x20, 0x46, 0xff, 0xf7, 0xcc, 0xff,
-  0xff, 0x23, 0x23, 0x71, 0xbf, 0xf3, 0x5f, 0x8f, 0x10, 0xbd, 0x00, 0xbf,
-  0x0d, 0x4b, 0x1a, 0x68, 0xef, 0xf3, 0x10, 0x81, 0x72, 0xb6, 0xd2, 0xe8,
-  0xcf, 0xcf, 0x01, 0x20, 0xbc, 0xf1, 0x00, 0x0f, 0xf9, 0xd1, 0xc2, 0xe8,
-  0x4c, 0x0f, 0xbc, 0xf1, 0x00, 0x0f, 0xf4, 0xd1, 0xbf, 0xf3, 0x5f, 0x8f,
-  0x00, 0x22, 0x1b, 0x68, 0xc3, 0xe8, 0x8f, 0x2f, 0x81, 0xf3, 0x10, 0x88,
-  0x40, 0xbf, 0x00, 0x20, 0x00, 0x21, 0x70, 0x47, 0x60, 0xde, 0x04, 0x20,
-  0x00, 0x00, 0x00, 0x00, 0x2d, 0xe9, 0xf0, 0x4f, 0x2d, 0xed, 0x02, 0x8b,
-  0x85, 0xb0, 0xef, 0xf3, 0x05, 0x83, 0xdb, 0xb2, 0x10, 0x3b, 0x9a, 0x08,
-  0x18, 0xbf, 0x01, 0x22, 0x4f, 0xf0, 0x01, 0x01, 0x03, 0xf0, 0x03, 0x0b,
-  0x18, 0xbf, 0xaf, 0x4d, 0xaf, 0x4b, 0x08, 0xbf, 0xaf, 0x4d, 0x0b, 0xeb,
-  0x82, 0x02, 0x53, 0xf8, 0x22, 0x60, 0x01, 0xfa, 0x0b, 0xf2, 0x05, 0xf5,
-  0x41, 0x53, 0x9f, 0xed, 0xa7, 0x8b, 0x01, 0x92, 0x5a, 0x60, 0x2f, 0xe0,
-  0xb3, 0x88, 0x1c, 0x04, 0x40, 0xf1, 0x93, 0x80, 0xb3, 0x79, 0x00, 0x2b,
-  0x40, 0xf0, 0xdd, 0x80, 0xb6, 0xf9, 0x08, 0x20, 0x00, 0x2a, 0xc0, 0xf2,
-  0x1e, 0x81, 0x73, 0x69, 0x02, 0xeb, 0x42, 0x02, 0x03, 0xeb, 0xc2, 0x03,
-  0xd3, 0xe9, 0x02, 0x47, 0xb7, 0xf1, 0xff, 0x3f, 0x08, 0xbf, 0xb4, 0xf1,
-  0xff, 0x3f, 0x0e, 0xd0, 0x05, 0xeb, 0x8b, 0x01, 0xab, 0x6a, 0x0a, 0x69,
-  0xd2, 0x1a, 0xe3, 0x1a, 0x93, 0x42, 0x05, 0xd3, 0x01, 0x23, 0x2a, 0x6a,
-  0x03, 0xfa, 0x0b, 0xf3, 0x13, 0x42, 0x00, 0xd1, 0x0c, 0x61, 0x28, 0x46,
-  0x00, 0xf0, 0x38, 0xfb, 0xa0, 0x42, 0xb9, 0x41, 0xc0, 0xf2, 0xfb, 0x80,
-  0xb6, 0xf9, 0x08, 0x30, 0x01, 0x9a, 0x00, 0x2b, 0x00, 0x93, 0xea, 0x63,
-  0xc8, 0xdb, 0xd6, 0xf8, 0x14, 0x80, 0x03, 0xeb, 0x43, 0x09, 0x28, 0x46,
-  0x08, 0xeb, 0xc9, 0x07, 0xd7, 0xe9, 0x02, 0x4a, 0x00, 0xf0, 0x22, 0xfb,
-  0xa0, 0x42, 0x71, 0xeb, 0x0a, 0x01, 0xb9, 0xdb, 0xba, 0xf1, 0x00, 0x0f,
-  0xc0, 0xf2, 0xc3, 0x80, 0xd7, 0xe9, 0x04, 0x31, 0x83, 0x4a, 0x93, 0x42,
-  0x00, 0xf0, 0xed, 0x80, 0x7a, 0x88, 0xb6, 0xf9, 0x08, 0x00, 0x92, 0xb2,
-  0x42, 0xea, 0x00, 0x40, 0x98, 0x47, 0x02, 0x46, 0x0b, 0x46, 0x52, 0xea,
-  0x03, 0x01, 0x00, 0xf0, 0xb0, 0x80, 0x00, 0x2b, 0x80, 0xf2, 0xd1, 0x80,
-  0xb4, 0xeb, 0x02, 0x0e, 0x6a, 0xeb, 0x03, 0x0a, 0x38, 0xf9, 0x39, 0x30,
-  0xc7, 0xe9, 0x02, 0xea, 0x00, 0x2b, 0x95, 0xdb, 0x71, 0x69, 0x03, 0xeb,
-  0x43, 0x02, 0x01, 0xeb, 0xc2, 0x02, 0xd2, 0xe9, 0x02, 0x70, 0xbe, 0x45,
-  0x7a, 0xeb, 0x00, 0x0c, 0x4f, 0xea, 0x43, 0x02, 0x88, 0xdb, 0xb4, 0x46,
-  0x2c, 0xf8, 0x08, 0x3f, 0x06, 0xe0, 0x03, 0xeb, 0x43, 0x00, 0x01, 0xeb,
-  0xc0, 0x00, 0x5a, 0x00, 0xd0, 0xe9, 0x02, 0x70, 0xbe, 0x45, 0x1a, 0x44,
-  0x7a, 0xeb, 0x00, 0x00, 0x01, 0xeb, 0xc2, 0x04, 0x04, 0xdb, 0x31, 0xf9,
-  0x32, 0x30, 0xa4, 0x46, 0x00, 0x2b, 0xec, 0xda, 0x28, 0xf8, 0x39, 0x30,
-  0x00, 0x9b, 0xac, 0xf8, 0x00, 0x30, 0xb3, 0x88, 0x1c, 0x04, 0x3f, 0xf5,
-  0x6d, 0xaf, 0x33, 0x69, 0xef, 0xf3, 0x10, 0x82, 0x72, 0xb6, 0xd3, 0xe8,
-  0xcf, 0x0f, 0x01, 0x21, 0x00, 0x28, 0xfa, 0xd1, 0xc3, 0xe8, 0x40, 0x1f,
-  0x00, 0x28, 0xf6, 0xd1, 0xbf, 0xf3, 0x5f, 0x8f, 0x4f, 0xf6, 0xff, 0x74,
-  0xb0, 0x88, 0x00, 0x23, 0x31, 0x69, 0x00, 0xb2, 0xb4, 0x80, 0xc1, 0xe8,
-  0x8f, 0x3f, 0x82, 0xf3, 0x10, 0x88, 0x98, 0x42, 0xff, 0xf6, 0x50, 0xaf,
-  0x07, 0x46, 0xa9, 0x46, 0x74, 0x69, 0x06, 0xf1, 0x08, 0x08, 0x07, 0xeb,
-  0x47, 0x0e, 0x04, 0xeb, 0xce, 0x03, 0xd3, 0xe9, 0x02, 0x50, 0xb6, 0xf9,
-  0x08, 0x30, 0xc4, 0x46, 0x00, 0x2b, 0x13, 0xdb, 0xb2, 0x46, 0x00, 0x97,
-  0x04, 0xe0, 0x34, 0xf9, 0x36, 0x30, 0x94, 0x46, 0x00, 0x2b, 0x09, 0xdb,
-  0x03, 0xeb, 0x43, 0x06, 0x04, 0xeb, 0xc6, 0x02, 0xd2, 0xe9, 0x02, 0x71,
-  0xbd, 0x42, 0x70, 0xeb, 0x01, 0x01, 0xf0, 0xda, 0x56, 0x46, 0x00, 0x9f,
-  0xac, 0xf8, 0x00, 0x70, 0x34, 0xf9, 0x3e, 0x70, 0x24, 0xf8, 0x3e, 0x30,
-  0x00, 0x2f, 0xd8, 0xda, 0xb3, 0x79, 0x4d, 0x46, 0x00, 0x2b, 0x3f, 0xf4,
-  0x23, 0xaf, 0x00, 0x23, 0xb3, 0x71, 0xb6, 0xf9, 0x08, 0x30, 0x06, 0xf1,
-  0x08, 0x08, 0x58, 0x1c, 0x3d, 0xd0, 0x1a, 0x46, 0x77, 0x69, 0x03, 0xe0,
-  0x80, 0x46, 0x59, 0x1c, 0x3f, 0xf4, 0x16, 0xaf, 0x03, 0xeb, 0x43, 0x01,
-  0x07, 0xeb, 0xc1, 0x00, 0xb0, 0xf8, 0x02, 0xc0, 0x1c, 0x46, 0x1c, 0xf4,
-  0x00, 0x4f, 0x9e, 0x46, 0x37, 0xf9, 0x31, 0x30, 0xee, 0xd0, 0x94, 0x42,
-  0x80, 0xed, 0x02, 0x8b, 0x05, 0xd0, 0xa8, 0xf8, 0x00, 0x30, 0x32, 0x89,
-  0x27, 0xf8, 0x31, 0x20, 0x34, 0x81, 0x72, 0x46, 0xe3, 0xe7, 0x38, 0xf8,
-  0x39, 0x30, 0x33, 0x81, 0x33, 0x69, 0xef, 0xf3, 0x10, 0x82, 0x72, 0xb6,
-  0xd3, 0xe8, 0xcf, 0x0f, 0x01, 0x21, 0x00, 0x28, 0xfa, 0xd1, 0xc3, 0xe8,
-  0x40, 0x1f, 0x00, 0x28, 0xf6, 0xd1, 0xbf, 0xf3, 0x5f, 0x8f, 0x73, 0x88,
-  0x31, 0x69, 0x28, 0xf8, 0x39, 0x30, 0x00, 0x9b, 0x73, 0x80, 0x00, 0x23,
-  0xc1, 0xe8, 0x8f, 0x3f, 0x82, 0xf3, 0x10, 0x88, 0xd4, 0xe6, 0x40, 0xbf,
-  0x05, 0xb0, 0xbd, 0xec, 0x02, 0x8b, 0xbd, 0xe8, 0xf0, 0x8f, 0x28, 0x46,
-  0xcd, 0xe9, 0x02, 0x23, 0x00, 0xf0, 0x2e, 0xfa, 0x02, 0x9a, 0x03, 0x9b,
-  0x10, 0xeb, 0x02, 0x0e, 0x43, 0xeb, 0x01, 0x0a, 0x26, 0xe7, 0x08, 0x46,
-  0x0b, 0x69, 0x02, 0x91, 0x98, 0x47, 0x00, 0x28, 0xc9, 0xd0, 0x02, 0x99,
-  0xd1, 0xe9, 0x00, 0x23, 0x11, 0xe7, 0x00, 0xbf, 0xaf, 0xf3, 0x00, 0x80,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x80, 0x0b, 0x40,
-  0x40, 0xc0, 0x00, 0x20, 0x00, 0x00, 0x0b, 0x40, 0x29, 0x09, 0x00, 0x20,
-  0x2d, 0xe9, 0xf8, 0x4f, 0x36, 0x4c, 0x25, 0x69, 0x2d, 0xb1, 0xbd, 0xe8,
-  0xf8, 0x4f, 0x0a, 0x21, 0x34, 0x48, 0xff, 0xf7, 0x23, 0xbe, 0xdf, 0xf8,
-  0xe4, 0x80, 0x03, 0x21, 0x40, 0x46, 0x00, 0xf0, 0xeb, 0xf9, 0x03, 0x26,
-  0xc4, 0xf8, 0x0c, 0x80, 0xff, 0xf7, 0x18, 0xfc, 0x4f, 0xf0, 0x50, 0x4c,
-  0x2d, 0x4b, 0x26, 0x70, 0x03, 0x44, 0x23, 0x61, 0xdc, 0xf8, 0x00, 0x30,
-  0x0f, 0x21, 0x63, 0x70, 0x63, 0x69, 0x61, 0x80, 0x1d, 0x83, 0x4f, 0xf0,
-  0x04, 0x05, 0xa3, 0xf8, 0x78, 0x50, 0x4f, 0xf0, 0x05, 0x05, 0xa3, 0xf8,
-  0x90, 0x50, 0x4f, 0xf0, 0x06, 0x05, 0xa3, 0xf8, 0xa8, 0x50, 0x4f, 0xf0,
-  0x07, 0x05, 0x0e, 0x21, 0x4f, 0xf6, 0xff, 0x72, 0x08, 0x27, 0x4f, 0xf0,
-  0x0a, 0x0e, 0xa3, 0xf8, 0xc0, 0x50, 0x4f, 0xf0, 0x01, 0x09, 0x4f, 0xf0,
-  0x0c, 0x0c, 0x4f, 0xf0, 0x02, 0x0b, 0x4f, 0xf0, 0x09, 0x0a, 0x0d, 0x20,
-  0x4f, 0xf0, 0x0b, 0x05, 0xa3, 0xf8, 0x68, 0x11, 0x17, 0x49, 0xa2, 0x80,
-  0xa3, 0xf8, 0x08, 0xe1, 0xa1, 0x60, 0xa3, 0xf8, 0x48, 0xb0, 0xa3, 0xf8,
-  0xf0, 0xa0, 0xa3, 0xf8, 0x20, 0x51, 0xa3, 0xf8, 0x38, 0xc1, 0xa3, 0xf8,
-  0x50, 0x01, 0xa3, 0xf8, 0x30, 0x90, 0xa3, 0xf8, 0x60, 0x60, 0xa3, 0xf8,
-  0xd8, 0x70, 0x1a, 0x80, 0x0d, 0x4b, 0x30, 0x46, 0xc8, 0xf8, 0x20, 0x70,
-  0x0c, 0x49, 0xdc, 0x60, 0xff, 0xf7, 0x30, 0xfc, 0x49, 0x46, 0x30, 0x46,
-  0xff, 0xf7, 0x06, 0xfc, 0x09, 0x4b, 0x0a, 0x21, 0x1f, 0x64, 0x03, 0x48,
-  0xbd, 0xe8, 0xf8, 0x4f, 0xff, 0xf7, 0xbe, 0xbd, 0x64, 0xbd, 0x00, 0x20,
-  0x60, 0xde, 0x04, 0x20, 0xbc, 0xbf, 0x00, 0x20, 0xff, 0xff, 0x10, 0x00,
-  0x40, 0xc0, 0x00, 0x20, 0x29, 0x09, 0x00, 0x20, 0x00, 0x20, 0x0b, 0x40,
-  0x00, 0x00, 0x0b, 0x40, 0x01, 0x46, 0xf0, 0xb5, 0x00, 0x69, 0xef, 0xf3,
-  0x10, 0x87, 0x72, 0xb6, 0xd0, 0xe8, 0xcf, 0x5f, 0x01, 0x24, 0x00, 0x2d,
-  0xfa, 0xd1, 0xc0, 0xe8, 0x45, 0x4f, 0x00, 0x2d, 0xf6, 0xd1, 0xbf, 0xf3,
-  0x5f, 0x8f, 0xb1, 0xf9, 0x02, 0xe0, 0x4c, 0x69, 0x0e, 0xeb, 0x4e, 0x0c,
-  0xbe, 0xf1, 0x00, 0x0f, 0x4f, 0xea, 0xcc, 0x05, 0x08, 0x69, 0x04, 0xeb,
-  0xcc, 0x0c, 0x3c, 0xdb, 0x66, 0x5b, 0x4e, 0x80, 0x00, 0x26, 0xc0, 0xe8,
-  0x8f, 0x6f, 0x87, 0xf3, 0x10, 0x88, 0xbc, 0xf8, 0x02, 0x00, 0xcc, 0xe9,
-  0x02, 0x23, 0x01, 0x30, 0xc0, 0xf3, 0x0e, 0x00, 0x01, 0x28, 0x38, 0xbf,
-  0x01, 0x20, 0x05, 0x9b, 0xac, 0xf8, 0x02, 0x00, 0xcc, 0xf8, 0x10, 0x30,
-  0x06, 0x9b, 0x40, 0xea, 0x0e, 0x40, 0xcc, 0xf8, 0x14, 0x30, 0x0b, 0x69,
-  0xef, 0xf3, 0x10, 0x82, 0x72, 0xb6, 0xd3, 0xe8, 0xcf, 0xcf, 0x01, 0x27,
-  0xbc, 0xf1, 0x00, 0x0f, 0xf9, 0xd1, 0xc3, 0xe8, 0x4c, 0x7f, 0xbc, 0xf1,
-  0x00, 0x0f, 0xf4, 0xd1, 0xbf, 0xf3, 0x5f, 0x8f, 0x8b, 0x88, 0x63, 0x53,
-  0xa1, 0xf8, 0x04, 0xe0, 0x0b, 0x69, 0xc3, 0xe8, 0x8f, 0x6f, 0x82, 0xf3,
-  0x10, 0x88, 0x01, 0x22, 0xcb, 0x68, 0x09, 0x78, 0x03, 0xf5, 0x01, 0x53,
-  0x8a, 0x40, 0x5a, 0x60, 0xf0, 0xbd, 0x00, 0x23, 0xc0, 0xe8, 0x8f, 0x3f,
-  0x87, 0xf3, 0x10, 0x88, 0x4f, 0xf0, 0xff, 0x30, 0xf0, 0xbd, 0x00, 0xbf,
-  0x03, 0x46, 0x40, 0x89, 0xb0, 0xeb, 0x21, 0x4f, 0x37, 0xdd, 0x58, 0x69,
-  0x0a, 0x14, 0x02, 0xeb, 0x42, 0x02, 0x10, 0xb5, 0x00, 0xeb, 0xc2, 0x00,
-  0x1c, 0x69, 0xef, 0xf3, 0x10, 0x8c, 0x72, 0xb6, 0xd4, 0xe8, 0xcf, 0xef,
-  0x01, 0x22, 0xbe, 0xf1, 0x00, 0x0f, 0xf9, 0xd1, 0xc4, 0xe8, 0x4e, 0x2f,
-  0xbe, 0xf1, 0x00, 0x0f, 0xf4, 0xd1, 0xbf, 0xf3, 0x5f, 0x8f, 0x42, 0x88,
-  0x89, 0xb2, 0x92, 0xb2, 0x8a, 0x42, 0x07, 0xd0, 0x00, 0x22, 0x1b, 0x69,
-  0xc3, 0xe8, 0x8f, 0x2f, 0x8c, 0xf3, 0x10, 0x88, 0x00, 0x20, 0x10, 0xbd,
-  0x42, 0xf4, 0x00, 0x42, 0x42, 0x80, 0x01, 0x21, 0x00, 0x22, 0x18, 0x69,
-  0x99, 0x71, 0xc0, 0xe8, 0x8f, 0x2f, 0x8c, 0xf3, 0x10, 0x88, 0x1c, 0x78,
-  0xda, 0x68, 0x08, 0x46, 0x02, 0xf5, 0x01, 0x53, 0xa1, 0x40, 0x59, 0x60,
-  0x10, 0xbd, 0x00, 0x20, 0x70, 0x47, 0x00, 0xbf, 0x2d, 0xe9, 0xf0, 0x41,
-  0x82, 0xb0, 0x06, 0x46, 0x00, 0xf0, 0xec, 0xf8, 0x4f, 0xf4, 0x7a, 0x73,
-  0x04, 0x46, 0x4f, 0xf0, 0xff, 0x30, 0x6f, 0xf0, 0x00, 0x42, 0xe6, 0xfb,
-  0x03, 0x41, 0xa0, 0x42, 0x72, 0xeb, 0x01, 0x03, 0x3a, 0xbf, 0x04, 0x46,
-  0x15, 0x46, 0x0d, 0x46, 0xa6, 0x1f, 0x45, 0xf1, 0xff, 0x37, 0xb4, 0x42,
-  0x75, 0xeb, 0x07, 0x03, 0x3c, 0xbf, 0x00, 0x26, 0x37, 0x46, 0x00, 0xf0,
-  0xd1, 0xf8, 0x30, 0x1a, 0x67, 0xeb, 0x01, 0x01, 0x01, 0x28, 0x71, 0xf1,
-  0x00, 0x01, 0x06, 0xda, 0x20, 0x46, 0x29, 0x46, 0x02, 0xb0, 0xbd, 0xe8,
-  0xf0, 0x41, 0x00, 0xf0, 0xcd, 0xb8, 0x00, 0xf0, 0xc1, 0xf8, 0x86, 0x42,
-  0x67, 0xeb, 0x01, 0x01, 0x00, 0x29, 0x0a, 0xdb, 0x00, 0x21, 0x17, 0x4b,
-  0x32, 0x46, 0x00, 0x93, 0x16, 0x48, 0x3b, 0x46, 0x01, 0x91, 0xff, 0xf7,
-  0x1d, 0xff, 0x01, 0x30, 0xe6, 0xd0, 0x4f, 0xf0, 0x00, 0x0c, 0x13, 0x4a,
-  0x13, 0x49, 0x53, 0x6a, 0x9f, 0x42, 0x04, 0xd8, 0x90, 0x6a, 0xb0, 0x42,
-  0xdc, 0xd2, 0x9f, 0x42, 0xda, 0xd1, 0x0b, 0x68, 0xef, 0xf3, 0x10, 0x80,
-  0x72, 0xb6, 0xd3, 0xe8, 0xcf, 0x8f, 0x5f, 0xf0, 0x01, 0x0e, 0xb8, 0xf1,
-  0x00, 0x0f, 0xf8, 0xd1, 0xc3, 0xe8, 0x48, 0xef, 0xb8, 0xf1, 0x00, 0x0f,
-  0xf3, 0xd1, 0xbf, 0xf3, 0x5f, 0x8f, 0x0b, 0x68, 0xc3, 0xe8, 0x8f, 0xcf,
-  0x80, 0xf3, 0x10, 0x88, 0x20, 0xbf, 0xde, 0xe7, 0xe9, 0x08, 0x00, 0x20,
-  0x64, 0xbd, 0x00, 0x20, 0x00, 0x00, 0x0b, 0x40, 0x60, 0xde, 0x04, 0x20,
-  0x2d, 0xe9, 0xf0, 0x43, 0x06, 0x46, 0x0d, 0x46, 0x83, 0xb0, 0xef, 0xf3,
-  0x05, 0x84, 0xe4, 0xb2, 0x3c, 0xb1, 0x2d, 0x4b, 0x5a, 0x6a, 0xaa, 0x42,
-  0x1c, 0xd2, 0x00, 0x20, 0x03, 0xb0, 0xbd, 0xe8, 0xf0, 0x83, 0x2a, 0x4f,
-  0xd7, 0xf8, 0x0c, 0x90, 0x97, 0xf8, 0x00, 0x80, 0x48, 0x46, 0x00, 0xf0,
-  0x63, 0xf8, 0x08, 0xf1, 0x04, 0x08, 0x59, 0xf8, 0x28, 0x30, 0x1b, 0x1a,
-  0x30, 0x1a, 0x65, 0xeb, 0x01, 0x01, 0x98, 0x42, 0x71, 0xf1, 0x00, 0x01,
-  0x10, 0xdb, 0x20, 0xbf, 0x1e, 0x4b, 0x5a, 0x6a, 0xaa, 0x42, 0xe2, 0xd3,
-  0x14, 0xbf, 0x01, 0x24, 0x00, 0x24, 0x9b, 0x6a, 0xb3, 0x42, 0x34, 0xbf,
-  0x20, 0x46, 0x44, 0xf0, 0x01, 0x00, 0x03, 0xb0, 0xbd, 0xe8, 0xf0, 0x83,
-  0x00, 0xf0, 0x4c, 0xf8, 0x86, 0x42, 0x65, 0xeb, 0x01, 0x01, 0x00, 0x29,
-  0x14, 0xdb, 0x15, 0x4b, 0x38, 0x46, 0xcd, 0xe9, 0x00, 0x34, 0x32, 0x46,
-  0x2b, 0x46, 0xff, 0xf7, 0xa9, 0xfe, 0x01, 0x1e, 0x0a, 0xdd, 0x0e, 0x4b,
-  0x5a, 0x6a, 0xaa, 0x42, 0x16, 0xd3, 0x9b, 0x6a, 0xb3, 0x42, 0x11, 0xd3,
-  0x0b, 0x48, 0xff, 0xf7, 0x01, 0xff, 0xb6, 0xe7, 0x08, 0x4b, 0x5c, 0x6a,
-  0xac, 0x42, 0xb6, 0xd3, 0x64, 0x1b, 0x18, 0xbf, 0x01, 0x24, 0x9b, 0x6a,
-  0xb3, 0x42, 0x34, 0xbf, 0x20, 0x46, 0x44, 0xf0, 0x01, 0x00, 0xad, 0xe7,
-  0xaa, 0x42, 0xeb, 0xd1, 0x20, 0xbf, 0xe9, 0xe7, 0x00, 0x00, 0x0b, 0x40,
-  0x64, 0xbd, 0x00, 0x20, 0xe9, 0x08, 0x00, 0x20, 0x10, 0xb4, 0x05, 0x4b,
-  0x05, 0x4c, 0x06, 0x4a, 0xa0, 0x42, 0x14, 0xbf, 0x18, 0x46, 0x58, 0x1c,
-  0x5d, 0xf8, 0x04, 0x4b, 0xff, 0xf7, 0xba, 0xb9, 0xe8, 0xbf, 0x00, 0x20,
-  0x00, 0x80, 0x0b, 0x40, 0xac, 0x9c, 0x00, 0x20, 0x03, 0x46, 0x41, 0x6a,
-  0x0a, 0x46, 0x98, 0x6a, 0x59, 0x6a, 0x8a, 0x42, 0xfa, 0xd1, 0x70, 0x47,
-  0x03, 0x4b, 0x59, 0x6a, 0x0a, 0x46, 0x98, 0x6a, 0x59, 0x6a, 0x91, 0x42,
-  0xfa, 0xd1, 0x70, 0x47, 0x00, 0x00, 0x0b, 0x40, 0x07, 0x4a, 0x53, 0x6a,
-  0x99, 0x42, 0xfc, 0xd8, 0x99, 0x42, 0x07, 0xd1, 0x04, 0x4b, 0x02, 0xe0,
-  0x5a, 0x6a, 0x91, 0x42, 0x02, 0xd1, 0x9a, 0x6a, 0x90, 0x42, 0xf9, 0xd8,
-  0x70, 0x47, 0x00, 0xbf, 0x00, 0x00, 0x0b, 0x40, 0x00, 0xeb, 0x40, 0x0c,
-  0x4f, 0xea, 0x8c, 0x0c, 0x0c, 0xf1, 0x80, 0x4c, 0x0c, 0xf5, 0x80, 0x3c,
-  0xf0, 0xb5, 0x16, 0x46, 0xdc, 0xf8, 0x04, 0x20, 0x05, 0x1f, 0xb2, 0xf5,
-  0x80, 0x3f, 0x38, 0xbf, 0x4f, 0xf4, 0x80, 0x32, 0xed, 0xb2, 0x38, 0xbf,
-  0xcc, 0xf8, 0x04, 0x20, 0x01, 0x2d, 0x2a, 0xd9, 0x4f, 0xf4, 0x00, 0x67,
-  0x25, 0x4c, 0x0c, 0xf5, 0x40, 0x52, 0x17, 0x60, 0x54, 0xf8, 0x20, 0x20,
-  0xb2, 0xb9, 0xdc, 0xf8, 0x00, 0x20, 0x01, 0x2d, 0x82, 0xea, 0x46, 0x12,
-  0x02, 0xf0, 0xe0, 0x02, 0x0c, 0xf5, 0x80, 0x56, 0x32, 0x60, 0x2a, 0xd9,
-  0x4f, 0xf4, 0x00, 0x61, 0x44, 0xf8, 0x20, 0x30, 0x4f, 0xf4, 0x80, 0x33,
-  0x0c, 0xf5, 0x00, 0x52, 0x11, 0x60, 0xcc, 0xf8, 0x04, 0x30, 0xf0, 0xbd,
-  0x67, 0x69, 0xb7, 0xfb, 0xf2, 0xfe, 0x0e, 0xf1, 0x01, 0x0e, 0x0e, 0xeb,
-  0x4e, 0x0e, 0xbe, 0xf1, 0x03, 0x0e, 0xfc, 0xd2, 0xdd, 0xe7, 0x01, 0x29,
-  0xd2, 0xd1, 0x03, 0x24, 0x0c, 0xf5, 0x40, 0x52, 0x14, 0x60, 0xdc, 0xf8,
-  0x08, 0x20, 0xd2, 0x07, 0xfb, 0xd5, 0xdc, 0xf8, 0x00, 0x20, 0x0b, 0x4c,
-  0x82, 0xea, 0x46, 0x12, 0x02, 0xf0, 0xe0, 0x02, 0x0c, 0xf5, 0x80, 0x56,
-  0x32, 0x60, 0x01, 0x22, 0xdc, 0xf8, 0x00, 0x50, 0x4d, 0x40, 0x05, 0xf0,
-  0x03, 0x05, 0x35, 0x60, 0x02, 0xfa, 0x01, 0xf1, 0xdc, 0xf8, 0x08, 0x20,
-  0x0a, 0x42, 0xfb, 0xd0, 0xc6, 0xe7, 0x00, 0xbf, 0xf0, 0xbf, 0x00, 0x20,
-  0x01, 0x4b, 0x53, 0xf8, 0x20, 0x00, 0x70, 0x47, 0xf0, 0xbf, 0x00, 0x20,
-  0x58, 0x4b, 0x2d, 0xe9, 0xf0, 0x43, 0x1c, 0x6c, 0x17, 0x46, 0xb4, 0xf5,
-  0x80, 0x3f, 0x38, 0xbf, 0x4f, 0xf4, 0x80, 0x32, 0x83, 0xb0, 0x38, 0xbf,
-  0x1a, 0x64, 0x03, 0x22, 0x80, 0x46, 0x0e, 0x46, 0x51, 0x4b, 0x50, 0x4d,
-  0xda, 0x63, 0x6c, 0x6c, 0xe3, 0x07, 0xfc, 0xd5, 0xeb, 0x6b, 0x4f, 0x4a,
-  0x83, 0xf0, 0x20, 0x03, 0x03, 0xf0, 0xe0, 0x03, 0xd3, 0x63, 0xeb, 0x6b,
-  0x49, 0x4d, 0x83, 0xf0, 0x01, 0x03, 0x03, 0xf0, 0x03, 0x03, 0xd3, 0x63,
-  0x6c, 0x6c, 0xa4, 0x07, 0xfc, 0xd5, 0x4f, 0xf4, 0x00, 0x62, 0x4f, 0xf4,
-  0x80, 0x39, 0x46, 0x4b, 0x46, 0x4c, 0xda, 0x63, 0x46, 0x4b, 0x42, 0x46,
-  0x63, 0x61, 0x01, 0x21, 0x33, 0x46, 0xc5, 0xf8, 0x40, 0x90, 0x44, 0x48,
-  0x00, 0x97, 0x00, 0xf0, 0x57, 0xf9, 0x4f, 0xf4, 0x00, 0x61, 0x6b, 0x6b,
-  0x07, 0xfb, 0x06, 0xf6, 0x4b, 0x45, 0x38, 0xbf, 0xc5, 0xf8, 0x34, 0x90,
-  0x38, 0x4b, 0x22, 0x69, 0xb8, 0xfb, 0xf6, 0xf6, 0x19, 0x63, 0x3a, 0xb1,
-  0x63, 0x69, 0xb3, 0xfb, 0xf2, 0xf3, 0x01, 0x33, 0x03, 0xeb, 0x43, 0x03,
-  0x03, 0x3b, 0xfd, 0xd2, 0x30, 0x49, 0x32, 0x4a, 0x0b, 0x6b, 0x03, 0xf0,
-  0xe0, 0x03, 0x13, 0x63, 0x0b, 0x6b, 0x83, 0xf0, 0x02, 0x03, 0x03, 0xf0,
-  0x03, 0x03, 0x13, 0x63, 0x8b, 0x6b, 0x58, 0x07, 0xfc, 0xd5, 0x4f, 0xf4,
-  0x00, 0x65, 0x4f, 0xf4, 0x80, 0x33, 0x2a, 0x4a, 0x15, 0x63, 0x2d, 0x4a,
-  0x4b, 0x63, 0x22, 0x61, 0x0a, 0x6c, 0x9a, 0x42, 0x4f, 0xf0, 0x03, 0x02,
-  0x38, 0xbf, 0x0b, 0x64, 0x22, 0x4b, 0x21, 0x49, 0xda, 0x63, 0x4b, 0x6c,
-  0xda, 0x07, 0xfc, 0xd5, 0xcb, 0x6b, 0x20, 0x4a, 0x03, 0xf0, 0xe0, 0x03,
-  0xd3, 0x63, 0xcb, 0x6b, 0x1b, 0x49, 0x83, 0xf0, 0x01, 0x03, 0x03, 0xf0,
-  0x03, 0x03, 0xd3, 0x63, 0x4b, 0x6c, 0x9b, 0x07, 0xfc, 0xd5, 0x4f, 0xf4,
-  0x80, 0x33, 0x4f, 0xf4, 0x00, 0x65, 0x18, 0x4a, 0x66, 0x61, 0xd5, 0x63,
-  0x0b, 0x64, 0xca, 0x6c, 0x9a, 0x42, 0x38, 0xbf, 0xcb, 0x64, 0x4f, 0xf4,
-  0x00, 0x61, 0x11, 0x4b, 0xa2, 0x69, 0x99, 0x64, 0x3a, 0xb1, 0x63, 0x69,
-  0xb3, 0xfb, 0xf2, 0xf3, 0x01, 0x33, 0x03, 0xeb, 0x43, 0x03, 0x03, 0x3b,
-  0xfd, 0xd2, 0x4f, 0xf4, 0x00, 0x60, 0x4f, 0xf4, 0x80, 0x31, 0x08, 0x4a,
-  0x09, 0x4d, 0x93, 0x6c, 0x83, 0xf0, 0x40, 0x03, 0x03, 0xf0, 0xe0, 0x03,
-  0xab, 0x64, 0x07, 0x4b, 0x08, 0x4d, 0xa5, 0x61, 0x98, 0x64, 0xd1, 0x64,
-  0x03, 0xb0, 0xbd, 0xe8, 0xf0, 0x83, 0x00, 0xbf, 0x00, 0x00, 0x01, 0x40,
-  0x00, 0x30, 0x01, 0x40, 0x00, 0x10, 0x01, 0x40, 0x00, 0x20, 0x01, 0x40,
-  0xf0, 0xbf, 0x00, 0x20, 0x00, 0x6c, 0xdc, 0x02, 0x00, 0x00, 0x05, 0x40,
-  0x00, 0x1b, 0xb7, 0x00, 0x2d, 0xe9, 0xf0, 0x4f, 0x4f, 0xf4, 0xa0, 0x78,
-  0x99, 0x46, 0x85, 0xb0, 0xcd, 0xe9, 0x02, 0x12, 0x5f, 0x4c, 0xdf, 0xf8,
-  0x84, 0xa1, 0x54, 0x45, 0x0a, 0xd9, 0x08, 0xf1, 0xff, 0x38, 0xa4, 0xf5,
-  0x3b, 0x54, 0xb8, 0xf1, 0x0f, 0x0f, 0xa4, 0xf1, 0x20, 0x04, 0xf4, 0xd1,
-  0x00, 0x20, 0x69, 0xe0, 0x07, 0x23, 0x04, 0xf5, 0x37, 0x22, 0x01, 0x94,
-  0x03, 0xfb, 0x03, 0xf4, 0x02, 0xf5, 0xd8, 0x72, 0xb2, 0xfb, 0xf4, 0xfe,
-  0x70, 0x45, 0x4f, 0xf0, 0x01, 0x0c, 0x4f, 0xf0, 0x02, 0x07, 0x4f, 0xf0,
-  0x03, 0x06, 0x4f, 0xf0, 0x04, 0x05, 0x4f, 0xf0, 0x05, 0x01, 0x3f, 0xd0,
-  0xb3, 0xf1, 0x01, 0x0e, 0x00, 0xf0, 0x94, 0x80, 0x0e, 0xfb, 0x03, 0xf4,
-  0xb2, 0xfb, 0xf4, 0xfb, 0x58, 0x45, 0x4c, 0xd0, 0x19, 0xb3, 0x01, 0xfb,
-  0x03, 0xf4, 0xb2, 0xfb, 0xf4, 0xfb, 0x58, 0x45, 0x4f, 0xd0, 0xe5, 0xb1,
-  0x05, 0xfb, 0x03, 0xf4, 0xb2, 0xfb, 0xf4, 0xfb, 0x58, 0x45, 0x53, 0xd0,
-  0xae, 0xb1, 0x06, 0xfb, 0x03, 0xf4, 0xb2, 0xfb, 0xf4, 0xfb, 0x58, 0x45,
-  0x57, 0xd0, 0x77, 0xb1, 0x07, 0xfb, 0x03, 0xf4, 0xb2, 0xfb, 0xf4, 0xfb,
-  0x58, 0x45, 0x5b, 0xd0, 0xbc, 0xf1, 0x00, 0x0f, 0x05, 0xd0, 0x0c, 0xfb,
-  0x03, 0xf4, 0xb2, 0xfb, 0xf4, 0xfb, 0x83, 0x45, 0x5d, 0xd0, 0x73, 0x46,
-  0x03, 0xfb, 0x03, 0xf4, 0xb2, 0xfb, 0xf4, 0xfe, 0x70, 0x45, 0x01, 0xf1,
-  0xff, 0x31, 0x05, 0xf1, 0xff, 0x35, 0x06, 0xf1, 0xff, 0x36, 0x07, 0xf1,
-  0xff, 0x37, 0x0c, 0xf1, 0xff, 0x3c, 0xbf, 0xd1, 0x04, 0xfb, 0x10, 0x24,
-  0x00, 0x2c, 0xbb, 0xd1, 0x9e, 0x46, 0x4a, 0x46, 0xdd, 0xf8, 0x08, 0xb0,
-  0xdd, 0xf8, 0x0c, 0x90, 0x01, 0x20, 0x28, 0x49, 0x01, 0xfb, 0x08, 0xf1,
-  0xcb, 0xf8, 0x00, 0x10, 0xc9, 0xf8, 0x00, 0x30, 0xc2, 0xf8, 0x00, 0xe0,
-  0x05, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x04, 0xfb, 0x10, 0x24, 0x00, 0x2c,
-  0xae, 0xd1, 0x4a, 0x46, 0xdd, 0xf8, 0x08, 0xb0, 0xdd, 0xf8, 0x0c, 0x90,
-  0xe8, 0xe7, 0x04, 0xfb, 0x10, 0x24, 0x00, 0x2c, 0xab, 0xd1, 0x4a, 0x46,
-  0x8e, 0x46, 0xdd, 0xf8, 0x08, 0xb0, 0xdd, 0xf8, 0x0c, 0x90, 0xdd, 0xe7,
-  0x04, 0xfb, 0x10, 0x24, 0x00, 0x2c, 0xa7, 0xd1, 0x4a, 0x46, 0xae, 0x46,
-  0xdd, 0xf8, 0x08, 0xb0, 0xdd, 0xf8, 0x0c, 0x90, 0xd2, 0xe7, 0x04, 0xfb,
-  0x10, 0x24, 0x00, 0x2c, 0xa3, 0xd1, 0x4a, 0x46, 0xb6, 0x46, 0xdd, 0xf8,
-  0x08, 0xb0, 0xdd, 0xf8, 0x0c, 0x90, 0xc7, 0xe7, 0x04, 0xfb, 0x10, 0x24,
-  0x00, 0x2c, 0x9f, 0xd1, 0x4a, 0x46, 0xbe, 0x46, 0xdd, 0xf8, 0x08, 0xb0,
-  0xdd, 0xf8, 0x0c, 0x90, 0xbc, 0xe7, 0x04, 0xfb, 0x10, 0x24, 0x00, 0x2c,
-  0x9d, 0xd1, 0x4a, 0x46, 0xe6, 0x46, 0xdd, 0xf8, 0x08, 0xb0, 0xdd, 0xf8,
-  0x0c, 0x90, 0xb1, 0xe7, 0x01, 0x9c, 0x44, 0xe7, 0x50, 0x26, 0x2f, 0x00,
-  0x00, 0x1b, 0xb7, 0x00, 0x50, 0xf8, 0x0c, 0x00, 0x70, 0xb4, 0x03, 0x9d,
-  0x04, 0x68, 0x2d, 0x03, 0x45, 0xea, 0x03, 0x45, 0x1b, 0x4b, 0x00, 0x2c,
-  0xb3, 0xfb, 0xf1, 0xf3, 0xb2, 0xfb, 0xf3, 0xf6, 0x1f, 0xdb, 0x19, 0x4a,
-  0x19, 0x4b, 0x90, 0x42, 0x14, 0xbf, 0x4f, 0xf4, 0x80, 0x42, 0x4f, 0xf4,
-  0x00, 0x42, 0x17, 0x4c, 0x1a, 0x60, 0x03, 0xf5, 0x80, 0x53, 0x1a, 0x60,
-  0xa3, 0x68, 0x32, 0xea, 0x03, 0x03, 0xfb, 0xd1, 0x21, 0x22, 0x00, 0xf5,
-  0x40, 0x53, 0x04, 0x33, 0x01, 0x60, 0x86, 0x60, 0x1a, 0x60, 0x02, 0x68,
-  0x00, 0x2a, 0xfc, 0xda, 0x08, 0x22, 0xc5, 0x60, 0x1a, 0x60, 0x70, 0xbc,
-  0x70, 0x47, 0x03, 0x68, 0x03, 0xf0, 0x3f, 0x03, 0x8b, 0x42, 0xda, 0xd1,
-  0x83, 0x68, 0xc3, 0xf3, 0x0b, 0x03, 0xb3, 0x42, 0xd5, 0xd1, 0xc3, 0x68,
-  0x03, 0xf4, 0xee, 0x23, 0xab, 0x42, 0xd0, 0xd1, 0xed, 0xe7, 0x00, 0xbf,
-  0x00, 0x1b, 0xb7, 0x00, 0x00, 0x80, 0x05, 0x40, 0x00, 0x20, 0x02, 0x40,
-  0x00, 0x00, 0x02, 0x40, 0x01, 0x23, 0x00, 0xeb, 0x40, 0x00, 0x80, 0x00,
-  0x00, 0xf1, 0x80, 0x40, 0x00, 0xf5, 0x84, 0x10, 0x41, 0x60, 0x03, 0x60,
-  0x70, 0x47, 0x00, 0xbf, 0x00, 0x23, 0xdb, 0x8a, 0x00, 0x22, 0x42, 0xe8,
-  0x00, 0xf2, 0x52, 0x02, 0x01, 0xd4, 0x10, 0x21, 0x18, 0x47, 0x04, 0x21,
-  0x18, 0x47, 0x00, 0xbf, 0x03, 0x4a, 0xd2, 0xf8, 0x28, 0x38, 0x00, 0x2b,
-  0xfb, 0xd0, 0xbf, 0xf3, 0x5f, 0x8f, 0x70, 0x47, 0x00, 0x00, 0x0e, 0x40,
-  0x00, 0x21, 0x04, 0x4b, 0x04, 0x4a, 0xbf, 0xf3, 0x5f, 0x8f, 0x43, 0xf8,
-  0x04, 0x1b, 0x93, 0x42, 0xf9, 0xd1, 0x70, 0x47, 0x0c, 0x08, 0x0e, 0x40,
-  0x2c, 0x08, 0x0e, 0x40, 0x10, 0xb4, 0x4f, 0xf4, 0x8d, 0x70, 0x4f, 0xf4,
-  0x2a, 0x64, 0x06, 0x4a, 0x06, 0x4b, 0x07, 0x49, 0x14, 0x60, 0xd0, 0x60,
-  0x19, 0x60, 0x53, 0x68, 0x00, 0x2b, 0xfc, 0xda, 0x5d, 0xf8, 0x04, 0x4b,
-  0x70, 0x47, 0x00, 0xbf, 0x00, 0x80, 0x04, 0x40, 0x00, 0xa0, 0x04, 0x40,
-  0x00, 0xb0, 0xfa, 0x00, 0x70, 0x47, 0x00, 0xbf, 0x08, 0xb5, 0x01, 0x48,
-  0xfe, 0xf7, 0xca, 0xfe, 0xd0, 0x9c, 0x00, 0x20, 0x38, 0xb5, 0x05, 0x4c,
-  0x05, 0x4d, 0xac, 0x42, 0x04, 0xd2, 0x54, 0xf8, 0x04, 0x3b, 0x98, 0x47,
-  0xac, 0x42, 0xfa, 0xd3, 0x38, 0xbd, 0x00, 0xbf, 0xe8, 0xbd, 0x00, 0x20,
-  0x28, 0xbe, 0x00, 0x20, 0x38, 0xb5, 0x05, 0x4c, 0x05, 0x4d, 0xac, 0x42,
-  0x04, 0xd2, 0x54, 0xf8, 0x04, 0x3b, 0x98, 0x47, 0xac, 0x42, 0xfa, 0xd3,
-  0x38, 0xbd, 0x00, 0xbf, 0x14, 0xbe, 0x00, 0x20, 0x28, 0xbe, 0x00, 0x20,
-  0x10, 0xb4, 0x07, 0x48, 0x07, 0x4c, 0x08, 0x4b, 0x08, 0x4a, 0x09, 0x49,
-  0x04, 0x60, 0x1a, 0x60, 0x8b, 0x68, 0x32, 0xea, 0x03, 0x03, 0xfb, 0xd1,
-  0x5d, 0xf8, 0x04, 0x4b, 0x70, 0x47, 0x00, 0xbf, 0x00, 0x20, 0x02, 0x40,
-  0x7f, 0x3b, 0xef, 0xef, 0x00, 0x30, 0x02, 0x40, 0xf6, 0xff, 0xf3, 0x03,
-  0x00, 0x00, 0x02, 0x40, 0x04, 0x4b, 0xdb, 0x6c, 0xb3, 0xf5, 0x00, 0x4f,
-  0x03, 0xd1, 0x4f, 0xf4, 0x80, 0x22, 0x02, 0x4b, 0xda, 0x64, 0x70, 0x47,
-  0x00, 0x00, 0x11, 0x50, 0x00, 0x20, 0x11, 0x50, 0x4f, 0xf0, 0xe0, 0x22,
-  0x04, 0x4b, 0xd2, 0xf8, 0x88, 0x1d, 0x0b, 0x43, 0xc2, 0xf8, 0x88, 0x3d,
-  0x10, 0xee, 0x30, 0x04, 0x70, 0x47, 0x00, 0xbf, 0x03, 0x03, 0x30, 0x00,
-  0x6f, 0xf0, 0x60, 0x41, 0x04, 0x4b, 0x05, 0x4a, 0x19, 0x60, 0x93, 0x68,
-  0xdb, 0x43, 0x33, 0xf0, 0x60, 0x43, 0xfa, 0xd1, 0x70, 0x47, 0x00, 0xbf,
-  0x00, 0x30, 0x02, 0x40, 0x00, 0x00, 0x02, 0x40, 0x10, 0xb5, 0x45, 0xf2,
-  0x53, 0x20, 0xff, 0xf7, 0x51, 0xff, 0xbd, 0xe8, 0x10, 0x40, 0x03, 0x46,
-  0x04, 0x20, 0x18, 0x47, 0x10, 0xb5, 0x45, 0xf2, 0x53, 0x20, 0xff, 0xf7,
-  0x47, 0xff, 0xbd, 0xe8, 0x10, 0x40, 0x03, 0x46, 0x01, 0x20, 0x18, 0x47,
-  0xfe, 0xf7, 0x00, 0xbf, 0x14, 0x49, 0x15, 0x4b, 0x70, 0xb5, 0x5c, 0x1a,
-  0xa6, 0x10, 0x44, 0x2e, 0x32, 0x46, 0x28, 0xbf, 0x44, 0x22, 0x12, 0x4d,
-  0x92, 0x00, 0x28, 0x46, 0x06, 0xf0, 0x14, 0xff, 0xb4, 0xf5, 0x86, 0x7f,
-  0x13, 0xd8, 0x0f, 0x4a, 0xc6, 0xf1, 0x44, 0x00, 0x12, 0xd0, 0x2b, 0x19,
-  0x41, 0x08, 0x03, 0xeb, 0xc1, 0x01, 0xc3, 0xe9, 0x00, 0x22, 0x08, 0x33,
-  0x8b, 0x42, 0xfa, 0xd1, 0xc3, 0x07, 0x04, 0xd5, 0x20, 0xf0, 0x01, 0x00,
-  0x30, 0x44, 0x45, 0xf8, 0x20, 0x20, 0x06, 0x4b, 0x9d, 0x60, 0x70, 0xbd,
-  0x43, 0x20, 0xf8, 0xe7, 0x00, 0x00, 0x00, 0x10, 0x10, 0x01, 0x00, 0x10,
-  0x00, 0x00, 0x00, 0x20, 0x11, 0x01, 0x00, 0x10, 0x00, 0xed, 0x00, 0xe0,
-  0x00, 0x23, 0x70, 0xb5, 0x2b, 0x4c, 0x82, 0xb0, 0xc4, 0xf8, 0x84, 0x30,
-  0xff, 0xf7, 0x28, 0xff, 0x01, 0x22, 0x29, 0x4b, 0xda, 0x63, 0x63, 0x6c,
-  0x01, 0x2b, 0xfc, 0xd1, 0x03, 0x21, 0x26, 0x4a, 0x24, 0x4b, 0x11, 0x63,
-  0x9c, 0x6b, 0x01, 0x2c, 0xfc, 0xd1, 0x02, 0x26, 0x05, 0x25, 0x21, 0x46,
-  0x05, 0x23, 0x22, 0x4a, 0x22, 0x48, 0x00, 0x96, 0xff, 0xf7, 0x9c, 0xfe,
-  0x21, 0x46, 0x2b, 0x46, 0x20, 0x4a, 0x21, 0x48, 0x00, 0x95, 0xff, 0xf7,
-  0x95, 0xfe, 0x00, 0x22, 0x04, 0x20, 0x31, 0x46, 0x1e, 0x4b, 0xff, 0xf7,
-  0x91, 0xfc, 0x21, 0x46, 0x28, 0x46, 0x00, 0x22, 0x1c, 0x4b, 0xff, 0xf7,
-  0x8b, 0xfc, 0x00, 0x22, 0x08, 0x20, 0x11, 0x46, 0x1a, 0x4b, 0xff, 0xf7,
-  0x85, 0xfc, 0x00, 0x22, 0x09, 0x20, 0x11, 0x46, 0x17, 0x4b, 0xff, 0xf7,
-  0x7f, 0xfc, 0x00, 0x22, 0x06, 0x20, 0x11, 0x46, 0x13, 0x4b, 0xff, 0xf7,
-  0x79, 0xfc, 0x00, 0x22, 0x11, 0x4b, 0x07, 0x20, 0x11, 0x46, 0xff, 0xf7,
-  0x73, 0xfc, 0x04, 0x20, 0xff, 0xf7, 0xd8, 0xfc, 0x00, 0x24, 0x0f, 0x4b,
-  0xa3, 0xfb, 0x00, 0x35, 0xad, 0x0c, 0xe0, 0xb2, 0x29, 0x46, 0x01, 0x34,
-  0xff, 0xf7, 0xaa, 0xfe, 0x06, 0x2c, 0xf8, 0xd1, 0x02, 0xb0, 0x70, 0xbd,
-  0x00, 0x00, 0x01, 0x40, 0x00, 0x30, 0x01, 0x40, 0x00, 0x2f, 0x68, 0x59,
-  0x00, 0x00, 0x05, 0x40, 0x00, 0x8c, 0x86, 0x47, 0x00, 0x80, 0x05, 0x40,
-  0x00, 0x1b, 0xb7, 0x00, 0x80, 0xd1, 0xf0, 0x08, 0x00, 0x6c, 0xdc, 0x02,
-  0x83, 0xde, 0x1b, 0x43, 0x86, 0xb0, 0x03, 0xb4, 0x51, 0xfc, 0x08, 0x04,
-  0xcd, 0xe9, 0x02, 0x01, 0x51, 0xfc, 0x09, 0x04, 0xcd, 0xe9, 0x04, 0x01,
-  0x51, 0xec, 0x0a, 0x04, 0xcd, 0xe9, 0x06, 0x01, 0x03, 0xbc, 0xf0, 0x47,
-  0xbd, 0xe8, 0x00, 0x50, 0x4e, 0xec, 0x00, 0xc4, 0xbd, 0xe8, 0x00, 0x50,
-  0x4e, 0xec, 0x01, 0xc4, 0xbd, 0xe8, 0x00, 0x50, 0x4e, 0xec, 0x02, 0xc4,
-  0x00, 0xbd, 0x00, 0x00, 0x00, 0xb5, 0xff, 0xf7, 0xdf, 0xff, 0x02, 0xe0,
-  0x10, 0xfe, 0x30, 0xf4, 0xf8, 0xd4, 0x41, 0xec, 0x10, 0x04, 0x43, 0xec,
-  0x11, 0x24, 0x00, 0xee, 0x01, 0x04, 0x10, 0xee, 0x01, 0x04, 0x80, 0xee,
-  0x20, 0x04, 0x51, 0xec, 0x10, 0x04, 0x70, 0x47, 0x00, 0xb5, 0xff, 0xf7,
-  0xcb, 0xff, 0x02, 0xe0, 0x10, 0xfe, 0x30, 0xf4, 0xf8, 0xd4, 0x41, 0xec,
-  0x10, 0x04, 0x43, 0xec, 0x11, 0x24, 0x00, 0xee, 0x01, 0x04, 0x10, 0xee,
-  0x21, 0x04, 0x80, 0xee, 0x20, 0x04, 0x51, 0xec, 0x30, 0x04, 0x70, 0x47,
-  0x00, 0xb5, 0xff, 0xf7, 0xb7, 0xff, 0x02, 0xe0, 0x10, 0xfe, 0x30, 0xf4,
-  0xf8, 0xd4, 0x10, 0xb5, 0x41, 0xec, 0x10, 0x04, 0x43, 0xec, 0x11, 0x24,
-  0x51, 0xec, 0x04, 0x04, 0x53, 0xec, 0x05, 0x24, 0xa0, 0xfb, 0x02, 0x4c,
-  0x5f, 0xf0, 0x00, 0x0e, 0xe0, 0xfb, 0x03, 0xce, 0xe1, 0xfb, 0x02, 0xce,
-  0x4c, 0xec, 0x20, 0x44, 0x00, 0x24, 0xe1, 0xfb, 0x03, 0xe4, 0x44, 0xec,
-  0x30, 0xe4, 0x80, 0xee, 0x20, 0x04, 0x51, 0xec, 0x50, 0x04, 0xbd, 0xe8,
-  0x10, 0x40, 0x70, 0x47, 0x00, 0xb5, 0xff, 0xf7, 0x91, 0xff, 0x02, 0xe0,
-  0x10, 0xfe, 0x30, 0xf4, 0xf8, 0xd4, 0x41, 0xec, 0x10, 0x04, 0x43, 0xec,
-  0x11, 0x24, 0x51, 0xec, 0x21, 0x04, 0xa0, 0xfb, 0x01, 0x12, 0x6f, 0xea,
-  0x82, 0x02, 0x52, 0xfb, 0x10, 0x00, 0x52, 0xfb, 0x12, 0xf2, 0x52, 0xfb,
-  0x10, 0x00, 0xa0, 0xeb, 0xd0, 0x7c, 0x53, 0xec, 0x04, 0x24, 0x5c, 0xfb,
-  0x13, 0xf1, 0x53, 0xec, 0x15, 0x24, 0xa1, 0xfb, 0x02, 0x20, 0x01, 0xfb,
-  0x03, 0x00, 0x53, 0xec, 0x44, 0x24, 0xa2, 0xeb, 0x00, 0x00, 0x50, 0xfb,
-  0x1c, 0xf2, 0x4f, 0xea, 0x11, 0x13, 0x12, 0xeb, 0x01, 0x70, 0x43, 0xeb,
-  0xe2, 0x71, 0x40, 0xea, 0x51, 0x50, 0x20, 0xea, 0x91, 0x50, 0x20, 0xf0,
-  0x07, 0x00, 0x53, 0xec, 0x75, 0x24, 0xa0, 0xfb, 0x02, 0x3c, 0x53, 0xec,
-  0x75, 0x24, 0x00, 0xfb, 0x03, 0xcc, 0x01, 0xfb, 0x02, 0xcc, 0x53, 0xec,
-  0x04, 0x24, 0xac, 0xeb, 0x82, 0x4c, 0x40, 0xea, 0x5c, 0x70, 0xa0, 0xf1,
-  0x01, 0x00, 0x41, 0xec, 0x40, 0x04, 0x80, 0xee, 0x20, 0x04, 0x51, 0xec,
-  0x70, 0x04, 0x70, 0x47, 0x00, 0xb5, 0xff, 0xf7, 0x43, 0xff, 0x02, 0xe0,
-  0x10, 0xfe, 0x30, 0xf4, 0xf8, 0xd4, 0x41, 0xec, 0x10, 0x04, 0x80, 0xee,
-  0x22, 0x04, 0x10, 0xee, 0xb2, 0x04, 0x70, 0x47, 0x00, 0xb5, 0xff, 0xf7,
-  0x35, 0xff, 0x02, 0xe0, 0x10, 0xfe, 0x30, 0xf4, 0xf8, 0xd4, 0x40, 0xec,
-  0x70, 0x04, 0x00, 0xee, 0x01, 0x04, 0x10, 0xee, 0x21, 0x04, 0x80, 0xee,
-  0x20, 0x04, 0x51, 0xec, 0x30, 0x04, 0x70, 0x47, 0x00, 0xb5, 0xff, 0xf7,
-  0x23, 0xff, 0x02, 0xe0, 0x10, 0xfe, 0x30, 0xf4, 0xf8, 0xd4, 0x40, 0xec,
-  0x60, 0x04, 0x00, 0xee, 0x01, 0x04, 0x10, 0xee, 0x21, 0x04, 0x80, 0xee,
-  0x20, 0x04, 0x51, 0xec, 0x30, 0x04, 0x70, 0x47, 0x00, 0xb5, 0xff, 0xf7,
-  0x11, 0xff, 0x02, 0xe0, 0x10, 0xfe, 0x30, 0xf4, 0xf8, 0xd4, 0x41, 0xec,
-  0x80, 0x04, 0x00, 0xee, 0x01, 0x04, 0x10, 0xee, 0x01, 0x04, 0x80, 0xee,
-  0x40, 0x04, 0x10, 0xee, 0x13, 0x04, 0x70, 0x47, 0x00, 0xb5, 0xff, 0xf7,
-  0xff, 0xfe, 0x02, 0xe0, 0x10, 0xfe, 0x30, 0xf4, 0xf8, 0xd4, 0x41, 0xec,
-  0x80, 0x04, 0x00, 0xee, 0x01, 0x04, 0x10, 0xee, 0x01, 0x04, 0x80, 0xee,
-  0x40, 0x04, 0x10, 0xee, 0x33, 0x04, 0x70, 0x47, 0x00, 0xb5, 0xff, 0xf7,
-  0xed, 0xfe, 0x02, 0xe0, 0x10, 0xfe, 0x30, 0xf4, 0xf8, 0xd4, 0x41, 0xec,
-  0x10, 0x04, 0x43, 0xec, 0x11, 0x24, 0x00, 0xee, 0x01, 0x04, 0x10, 0xee,
-  0x30, 0x04, 0xc0, 0xf3, 0x00, 0x70, 0x70, 0x47, 0x00, 0xb5, 0xff, 0xf7,
-  0xdb, 0xfe, 0x02, 0xe0, 0x10, 0xfe, 0x30, 0xf4, 0xf8, 0xd4, 0x43, 0xec,
-  0x10, 0x24, 0x41, 0xec, 0x11, 0x04, 0x00, 0xee, 0x01, 0x04, 0x10, 0xee,
-  0x30, 0xf4, 0x8c, 0xbf, 0x01, 0x20, 0x00, 0x20, 0x70, 0x47, 0x00, 0xbf,
-  0x00, 0xb5, 0xff, 0xf7, 0xc7, 0xfe, 0x02, 0xe0, 0x10, 0xfe, 0x30, 0xf4,
-  0xf8, 0xd4, 0x43, 0xec, 0x10, 0x24, 0x41, 0xec, 0x11, 0x04, 0x00, 0xee,
-  0x01, 0x04, 0x10, 0xee, 0x30, 0xf4, 0x2c, 0xbf, 0x01, 0x20, 0x00, 0x20,
-  0x70, 0x47, 0x00, 0xbf, 0x00, 0xb5, 0xff, 0xf7, 0xb3, 0xfe, 0x02, 0xe0,
-  0x10, 0xfe, 0x30, 0xf4, 0xf8, 0xd4, 0x41, 0xec, 0x10, 0x04, 0x43, 0xec,
-  0x11, 0x24, 0x00, 0xee, 0x01, 0x04, 0x10, 0xee, 0x30, 0xf4, 0x2c, 0xbf,
-  0x01, 0x20, 0x00, 0x20, 0x70, 0x47, 0x00, 0xbf, 0x00, 0xb5, 0xff, 0xf7,
-  0x9f, 0xfe, 0x02, 0xe0, 0x10, 0xfe, 0x30, 0xf4, 0xf8, 0xd4, 0x41, 0xec,
-  0x10, 0x04, 0x43, 0xec, 0x11, 0x24, 0x00, 0xee, 0x01, 0x04, 0x10, 0xee,
-  0x30, 0xf4, 0x8c, 0xbf, 0x01, 0x20, 0x00, 0x20, 0x70, 0x47, 0x00, 0xbf,
-  0x9a, 0x42, 0x38, 0xbf, 0x88, 0x54, 0x70, 0x47, 0x70, 0x47, 0x00, 0xbf,
-  0x2d, 0xe9, 0xf0, 0x4f, 0x83, 0xb0, 0x99, 0x46, 0xdd, 0xe9, 0x0d, 0xab,
-  0x0f, 0x9b, 0x88, 0x46, 0x11, 0x46, 0x9a, 0x07, 0x07, 0x46, 0x16, 0xd1,
-  0xda, 0x45, 0x3a, 0xd2, 0x0c, 0x46, 0x0d, 0x46, 0xab, 0xeb, 0x0a, 0x06,
-  0x0e, 0x44, 0x22, 0x46, 0x4b, 0x46, 0x41, 0x46, 0x20, 0x20, 0x01, 0x34,
-  0xb8, 0x47, 0xb4, 0x42, 0xf7, 0xd1, 0x29, 0x46, 0xba, 0xf1, 0x00, 0x0f,
-  0x08, 0xd1, 0x20, 0x46, 0x03, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x0c, 0x46,
-  0xba, 0xf1, 0x00, 0x0f, 0x10, 0xd0, 0x0e, 0x46, 0x55, 0x46, 0x0c, 0x9b,
-  0x2e, 0x44, 0x9a, 0x44, 0x01, 0x91, 0x72, 0x1b, 0x4b, 0x46, 0x01, 0x3d,
-  0x41, 0x46, 0x1a, 0xf8, 0x01, 0x0d, 0x34, 0x46, 0xb8, 0x47, 0x00, 0x2d,
-  0xf5, 0xd1, 0x01, 0x99, 0x0f, 0x9b, 0x9b, 0x07, 0xe3, 0xd5, 0x65, 0x1a,
-  0xab, 0x45, 0xe0, 0xd9, 0x22, 0x46, 0x4b, 0x46, 0x41, 0x46, 0x20, 0x20,
-  0x01, 0x35, 0xb8, 0x47, 0x5d, 0x45, 0x04, 0xf1, 0x01, 0x04, 0xf5, 0xd3,
-  0xd5, 0xe7, 0x0c, 0x46, 0xba, 0xf1, 0x00, 0x0f, 0xd9, 0xd1, 0xd0, 0xe7,
-  0x2d, 0xe9, 0xf0, 0x4f, 0x0f, 0x9f, 0xdd, 0xf8, 0x24, 0x80, 0x17, 0xf0,
-  0x02, 0x0f, 0x0a, 0x9c, 0x9d, 0xf8, 0x2c, 0xa0, 0x0e, 0x9d, 0xdd, 0xe9,
-  0x0c, 0x96, 0x44, 0xd1, 0xf5, 0xbb, 0xb4, 0x42, 0x41, 0xd2, 0x07, 0xf0,
-  0x01, 0x0b, 0x04, 0xf1, 0xff, 0x3c, 0x4f, 0xf0, 0x30, 0x0e, 0xc4, 0x44,
-  0x04, 0xe0, 0x01, 0x34, 0xa6, 0x42, 0x0c, 0xf8, 0x01, 0xef, 0x01, 0xd9,
-  0x20, 0x2c, 0xf8, 0xd1, 0xbb, 0xf1, 0x00, 0x0f, 0x00, 0xf0, 0x88, 0x80,
-  0xa5, 0x42, 0x2c, 0xd9, 0x04, 0xf1, 0xff, 0x3c, 0x4f, 0xf0, 0x30, 0x0e,
-  0xc4, 0x44, 0x04, 0xe0, 0x01, 0x34, 0xac, 0x42, 0x0c, 0xf8, 0x01, 0xef,
-  0x21, 0xd0, 0x20, 0x2c, 0xf8, 0xd1, 0x17, 0xf0, 0x10, 0x0f, 0x0e, 0xd0,
-  0x17, 0xf4, 0x80, 0x6f, 0x54, 0xd1, 0xa6, 0x42, 0x63, 0xd0, 0xa5, 0x42,
-  0x61, 0xd0, 0xb9, 0xf1, 0x10, 0x0f, 0x50, 0xd0, 0xb9, 0xf1, 0x02, 0x0f,
-  0x56, 0xd0, 0x20, 0x2c, 0x29, 0xd1, 0x20, 0x24, 0xcd, 0xe9, 0x0b, 0x57,
-  0xcd, 0xe9, 0x09, 0x84, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0x64, 0xbf,
-  0x17, 0xf0, 0x01, 0x0b, 0x34, 0xd1, 0xb4, 0x42, 0xbf, 0xd3, 0x17, 0xf0,
-  0x10, 0x0f, 0x1e, 0xd0, 0x17, 0xf4, 0x80, 0x6f, 0xe3, 0xd1, 0x00, 0x2c,
-  0xdd, 0xd1, 0xb9, 0xf1, 0x10, 0x0f, 0x63, 0xd0, 0xb9, 0xf1, 0x02, 0x0f,
-  0x77, 0xd0, 0x30, 0x24, 0x88, 0xf8, 0x00, 0x40, 0x01, 0x24, 0xba, 0xf1,
-  0x00, 0x0f, 0x11, 0xd1, 0x7e, 0x07, 0x48, 0xd5, 0x2b, 0x26, 0x08, 0xf8,
-  0x04, 0x60, 0x01, 0x34, 0xd6, 0xe7, 0x26, 0x46, 0x01, 0x34, 0x4f, 0xf0,
-  0x30, 0x0c, 0x08, 0xf8, 0x06, 0xc0, 0x20, 0x2c, 0xcd, 0xd0, 0xba, 0xf1,
-  0x00, 0x0f, 0xed, 0xd0, 0x2d, 0x26, 0x08, 0xf8, 0x04, 0x60, 0x01, 0x34,
-  0xcd, 0xe9, 0x0b, 0x57, 0xcd, 0xe9, 0x09, 0x84, 0xbd, 0xe8, 0xf0, 0x4f,
-  0xff, 0xf7, 0x2c, 0xbf, 0xba, 0xf1, 0x00, 0x0f, 0x30, 0xd0, 0xb4, 0x42,
-  0x05, 0xf1, 0xff, 0x35, 0x85, 0xd3, 0x95, 0xe7, 0xb9, 0xf1, 0x10, 0x0f,
-  0xb3, 0xd1, 0xbe, 0x06, 0x3b, 0xd5, 0x20, 0x2c, 0xaf, 0xd0, 0x58, 0x26,
-  0x08, 0xf8, 0x04, 0x60, 0x01, 0x34, 0xa8, 0xe7, 0x20, 0x2c, 0xa8, 0xd0,
-  0x26, 0x46, 0x01, 0x34, 0x07, 0xe0, 0x66, 0x1e, 0xb9, 0xd0, 0xb9, 0xf1,
-  0x10, 0x0f, 0x36, 0xd0, 0xb9, 0xf1, 0x02, 0x0f, 0xc9, 0xd1, 0x4f, 0xf0,
-  0x62, 0x0c, 0x08, 0xf8, 0x06, 0xc0, 0x96, 0xe7, 0x17, 0xf0, 0x10, 0x0f,
-  0xc5, 0xd0, 0x17, 0xf4, 0x80, 0x6f, 0x86, 0xd0, 0x89, 0xe7, 0x3e, 0x07,
-  0x90, 0xd5, 0x20, 0x26, 0x08, 0xf8, 0x04, 0x60, 0x01, 0x34, 0x8b, 0xe7,
-  0x17, 0xf0, 0x0c, 0x0f, 0x00, 0xd0, 0x01, 0x3d, 0xb4, 0x42, 0xff, 0xf4,
-  0x52, 0xaf, 0x61, 0xe7, 0xbc, 0x06, 0x12, 0xd4, 0x78, 0x24, 0x88, 0xf8,
-  0x00, 0x40, 0x30, 0x24, 0x88, 0xf8, 0x01, 0x40, 0x02, 0x24, 0xba, 0xf1,
-  0x00, 0x0f, 0x99, 0xd0, 0xaa, 0xe7, 0x20, 0x2c, 0x3f, 0xf4, 0x73, 0xaf,
-  0x78, 0x26, 0x08, 0xf8, 0x04, 0x60, 0x01, 0x34, 0x6b, 0xe7, 0x58, 0x24,
-  0xeb, 0xe7, 0x62, 0x24, 0xe9, 0xe7, 0x17, 0xf0, 0x20, 0x0f, 0xa4, 0xf1,
-  0x02, 0x0c, 0x04, 0xd0, 0x4f, 0xf0, 0x58, 0x0e, 0x08, 0xf8, 0x0c, 0xe0,
-  0x8b, 0xe7, 0x4f, 0xf0, 0x78, 0x0e, 0x08, 0xf8, 0x0c, 0xe0, 0x86, 0xe7,
-  0x00, 0xb9, 0x70, 0x47, 0x01, 0xf0, 0x84, 0xbb, 0x10, 0xb1, 0xd1, 0xe9,
-  0x00, 0x31, 0x18, 0x47, 0x70, 0x47, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00,
-  0x2d, 0xe9, 0xf0, 0x4f, 0x97, 0xb0, 0x9d, 0xed, 0x20, 0x7b, 0xdd, 0xe9,
-  0x22, 0x5b, 0x07, 0x46, 0x88, 0x46, 0x51, 0xec, 0x17, 0x0b, 0x24, 0x9c,
-  0x99, 0x46, 0x0c, 0x92, 0x0b, 0x46, 0x02, 0x46, 0x8d, 0xed, 0x04, 0x7b,
-  0x07, 0x94, 0xff, 0xf7, 0x43, 0xfe, 0x00, 0x28, 0x40, 0xf0, 0xf4, 0x81,
-  0xdd, 0xe9, 0x04, 0x01, 0x4f, 0xf0, 0xff, 0x32, 0x6f, 0xf4, 0x80, 0x13,
-  0xff, 0xf7, 0x4a, 0xfe, 0x00, 0x28, 0x40, 0xf0, 0x1b, 0x81, 0xdd, 0xe9,
-  0x04, 0x01, 0x4f, 0xf0, 0xff, 0x32, 0xac, 0x4b, 0xff, 0xf7, 0x7c, 0xfe,
-  0x00, 0x28, 0x40, 0xf0, 0xee, 0x80, 0xdd, 0xe9, 0x04, 0x01, 0xa4, 0xa3,
-  0xd3, 0xe9, 0x00, 0x23, 0xff, 0xf7, 0x72, 0xfe, 0x00, 0x28, 0x40, 0xf0,
-  0xd3, 0x80, 0xdd, 0xe9, 0x04, 0x01, 0xa1, 0xa3, 0xd3, 0xe9, 0x00, 0x23,
-  0xff, 0xf7, 0x2c, 0xfe, 0x00, 0x28, 0x40, 0xf0, 0xc9, 0x80, 0xdd, 0xe9,
-  0x04, 0x01, 0x00, 0x22, 0x00, 0x23, 0xff, 0xf7, 0x23, 0xfe, 0x00, 0x28,
-  0x40, 0xf0, 0xe8, 0x80, 0x23, 0x46, 0x0d, 0x90, 0x13, 0xf4, 0x80, 0x6f,
-  0x08, 0xbf, 0x06, 0x25, 0x30, 0x21, 0x2b, 0x46, 0x0e, 0xaa, 0xa5, 0xf1,
-  0x20, 0x06, 0x05, 0xe0, 0x01, 0x3b, 0xb3, 0x42, 0x02, 0xf8, 0x01, 0x1b,
-  0x00, 0xf0, 0x93, 0x81, 0x09, 0x2b, 0xf7, 0xd8, 0x1e, 0x46, 0xed, 0x1a,
-  0xdd, 0xe9, 0x04, 0x01, 0xff, 0xf7, 0xd0, 0xfd, 0x8e, 0x4b, 0x04, 0x46,
-  0x03, 0xeb, 0xc6, 0x03, 0x93, 0xed, 0x00, 0x7b, 0x8d, 0xed, 0x08, 0x7b,
-  0xff, 0xf7, 0xa2, 0xfd, 0x02, 0x46, 0x0b, 0x46, 0xdd, 0xe9, 0x04, 0x01,
-  0xff, 0xf7, 0x06, 0xfd, 0xdd, 0xe9, 0x08, 0x23, 0xff, 0xf7, 0x16, 0xfd,
-  0x02, 0x46, 0x0b, 0x46, 0xcd, 0xe9, 0x0a, 0x23, 0xff, 0xf7, 0xc8, 0xfd,
-  0x82, 0x46, 0xff, 0xf7, 0xa1, 0xfd, 0x02, 0x46, 0x0b, 0x46, 0xdd, 0xe9,
-  0x0a, 0x01, 0xff, 0xf7, 0xf3, 0xfc, 0x02, 0x46, 0x0b, 0x46, 0xcd, 0xe9,
-  0x0a, 0x23, 0x00, 0x22, 0x7b, 0x4b, 0xff, 0xf7, 0x17, 0xfe, 0x00, 0x28,
-  0x00, 0xf0, 0xfe, 0x80, 0x0a, 0xf1, 0x01, 0x0a, 0x50, 0x46, 0xff, 0xf7,
-  0x8b, 0xfd, 0x02, 0x46, 0x0b, 0x46, 0xdd, 0xe9, 0x08, 0x01, 0xff, 0xf7,
-  0xe1, 0xfd, 0x10, 0xb1, 0x4f, 0xf0, 0x00, 0x0a, 0x01, 0x34, 0x00, 0x2e,
-  0x00, 0xf0, 0xfd, 0x80, 0x68, 0x1e, 0x0e, 0xab, 0xdf, 0xf8, 0xcc, 0xc1,
-  0x18, 0x44, 0x0f, 0xe0, 0xac, 0xfb, 0x0a, 0x21, 0xc9, 0x08, 0x01, 0xeb,
-  0x81, 0x02, 0xaa, 0xeb, 0x42, 0x02, 0x30, 0x32, 0xba, 0xf1, 0x09, 0x0f,
-  0x00, 0xf8, 0x01, 0x2f, 0x40, 0xf2, 0x1c, 0x81, 0x8a, 0x46, 0x1d, 0x46,
-  0x20, 0x2d, 0x05, 0xf1, 0x01, 0x03, 0x06, 0xf1, 0xff, 0x36, 0xe9, 0xd1,
-  0x20, 0x25, 0x69, 0x1e, 0x0e, 0xab, 0x61, 0x48, 0x19, 0x44, 0x10, 0xe0,
-  0x80, 0xfb, 0x04, 0x62, 0xc3, 0xeb, 0xa2, 0x03, 0x03, 0xeb, 0x83, 0x02,
-  0xa4, 0xeb, 0x42, 0x04, 0x04, 0xf1, 0x30, 0x02, 0x01, 0x35, 0x1c, 0x46,
-  0x01, 0xf8, 0x01, 0x2f, 0x00, 0x2b, 0x00, 0xf0, 0xeb, 0x80, 0x20, 0x2d,
-  0x4f, 0xea, 0xe4, 0x73, 0xea, 0xd1, 0x07, 0x9b, 0x03, 0xf0, 0x03, 0x03,
-  0x01, 0x2b, 0x18, 0xd1, 0xbb, 0xf1, 0x00, 0x0f, 0x15, 0xd0, 0x0d, 0x9b,
-  0x00, 0x2b, 0x00, 0xf0, 0x0a, 0x81, 0x0b, 0xf1, 0xff, 0x3b, 0xbb, 0xf1,
-  0x20, 0x0f, 0x0c, 0xd9, 0x6b, 0x1e, 0x0e, 0xa9, 0x30, 0x22, 0x0b, 0x44,
-  0x05, 0xe0, 0x01, 0x35, 0x5d, 0x45, 0x03, 0xf8, 0x01, 0x2f, 0x80, 0xf0,
-  0xd1, 0x80, 0x20, 0x2d, 0xf7, 0xd1, 0x07, 0x9b, 0x0e, 0xac, 0xcd, 0xe9,
-  0x02, 0xb3, 0x41, 0x46, 0x4b, 0x46, 0x38, 0x46, 0x0c, 0x9a, 0x01, 0x95,
-  0x00, 0x94, 0xff, 0xf7, 0xb7, 0xfd, 0x82, 0x46, 0x50, 0x46, 0x17, 0xb0,
-  0xbd, 0xe8, 0xf0, 0x8f, 0x07, 0x9b, 0x9d, 0xed, 0x04, 0x7b, 0xcd, 0xe9,
-  0x23, 0xb3, 0x41, 0x46, 0x4b, 0x46, 0x38, 0x46, 0x0c, 0x9a, 0x8d, 0xed,
-  0x20, 0x7b, 0x22, 0x95, 0x17, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0x00, 0xf0,
-  0x45, 0xb9, 0x61, 0x07, 0x23, 0x46, 0x4c, 0xbf, 0x04, 0x23, 0x03, 0x23,
-  0x41, 0x46, 0x21, 0x93, 0x38, 0x46, 0x4b, 0x46, 0x07, 0x9a, 0x48, 0xbf,
-  0x30, 0x4c, 0xcd, 0xe9, 0x22, 0xb2, 0x58, 0xbf, 0x2f, 0x4c, 0x0c, 0x9a,
-  0x20, 0x94, 0x17, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0x8a, 0xbd,
-  0xdd, 0xe9, 0x04, 0x23, 0x00, 0x20, 0x00, 0x21, 0xff, 0xf7, 0x42, 0xfc,
-  0x01, 0x23, 0xcd, 0xe9, 0x04, 0x01, 0x0d, 0x93, 0x23, 0x46, 0x0d, 0xe7,
-  0x23, 0x46, 0x9c, 0x07, 0x40, 0xf0, 0xaa, 0x80, 0xbb, 0xf1, 0x04, 0x0f,
-  0x40, 0xf2, 0xa6, 0x80, 0x0c, 0x9b, 0x1d, 0x46, 0x1c, 0x1f, 0x04, 0xeb,
-  0x0b, 0x0a, 0x2a, 0x46, 0x4b, 0x46, 0x41, 0x46, 0x20, 0x20, 0x01, 0x35,
-  0xb8, 0x47, 0xaa, 0x45, 0xf7, 0xd1, 0x55, 0x46, 0x1b, 0x4c, 0x26, 0x1f,
-  0x14, 0xf8, 0x01, 0x0d, 0x2a, 0x46, 0x4b, 0x46, 0x41, 0x46, 0xb8, 0x47,
-  0xb4, 0x42, 0x05, 0xf1, 0x01, 0x05, 0xf5, 0xd1, 0x07, 0x9b, 0x0a, 0xf1,
-  0x04, 0x0a, 0x98, 0x07, 0xa0, 0xd5, 0x0c, 0x9c, 0xaa, 0xeb, 0x04, 0x03,
-  0x9b, 0x45, 0x9b, 0xd9, 0x52, 0x46, 0x4b, 0x46, 0x41, 0x46, 0x20, 0x20,
-  0x0a, 0xf1, 0x01, 0x0a, 0xb8, 0x47, 0xaa, 0xeb, 0x04, 0x03, 0x5b, 0x45,
-  0xf4, 0xd3, 0x8f, 0xe7, 0xaf, 0xf3, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
-  0x65, 0xcd, 0xcd, 0x41, 0x00, 0x00, 0x00, 0x00, 0x65, 0xcd, 0xcd, 0xc1,
-  0xff, 0xff, 0xef, 0x7f, 0xb0, 0xa3, 0x00, 0x20, 0x00, 0x00, 0xe0, 0x3f,
-  0x67, 0x66, 0x66, 0x66, 0x20, 0x9d, 0x00, 0x20, 0x28, 0x9d, 0x00, 0x20,
-  0x34, 0x9d, 0x00, 0x20, 0xcd, 0xcc, 0xcc, 0xcc, 0x00, 0x22, 0xdd, 0xe9,
-  0x0a, 0x01, 0x63, 0x4b, 0xff, 0xf7, 0xd4, 0xfc, 0x00, 0x28, 0x7f, 0xf4,
-  0x08, 0xaf, 0xba, 0xf1, 0x00, 0x0f, 0x6a, 0xd1, 0x0a, 0xf1, 0x01, 0x0a,
-  0x00, 0x2e, 0x7f, 0xf4, 0x03, 0xaf, 0x20, 0x46, 0xff, 0xf7, 0x6c, 0xfc,
-  0x02, 0x46, 0x0b, 0x46, 0xdd, 0xe9, 0x04, 0x01, 0xff, 0xf7, 0xd0, 0xfb,
-  0x02, 0x46, 0x0b, 0x46, 0xcd, 0xe9, 0x04, 0x23, 0x00, 0x22, 0x55, 0x4b,
-  0xff, 0xf7, 0xb8, 0xfc, 0x00, 0x28, 0x7f, 0xf4, 0x0c, 0xaf, 0xdd, 0xe9,
-  0x04, 0x01, 0x00, 0x22, 0x50, 0x4b, 0xff, 0xf7, 0xeb, 0xfc, 0x00, 0x28,
-  0x7f, 0xf4, 0x03, 0xaf, 0x01, 0x34, 0x24, 0xf0, 0x01, 0x04, 0xfe, 0xe6,
-  0x07, 0x9b, 0x03, 0xf0, 0x03, 0x03, 0x01, 0x2b, 0x00, 0xf0, 0x82, 0x80,
-  0x20, 0x2d, 0x3f, 0xf4, 0x2e, 0xaf, 0x0d, 0x9b, 0x7b, 0xb3, 0x2d, 0x22,
-  0x0d, 0xeb, 0x05, 0x03, 0x83, 0xf8, 0x38, 0x20, 0x01, 0x35, 0x24, 0xe7,
-  0x20, 0x2b, 0x3f, 0xf4, 0xe9, 0xae, 0x0e, 0xaa, 0x15, 0x44, 0x1e, 0x44,
-  0x30, 0x22, 0x04, 0xe0, 0x20, 0x2b, 0x05, 0xf8, 0x01, 0x2f, 0x3f, 0xf4,
-  0xdf, 0xae, 0x9e, 0x42, 0x03, 0xf1, 0x01, 0x03, 0xf6, 0xd1, 0x2e, 0x22,
-  0x0d, 0xeb, 0x06, 0x03, 0x83, 0xf8, 0x38, 0x20, 0x75, 0x1c, 0xd4, 0xe6,
-  0xdd, 0xf8, 0x30, 0xa0, 0x63, 0xe7, 0x20, 0x25, 0x6e, 0xe6, 0x07, 0x9b,
-  0x13, 0xf0, 0x0c, 0x0f, 0x50, 0xd0, 0x0b, 0xf1, 0xff, 0x3b, 0xab, 0x45,
-  0x3f, 0xf6, 0xf2, 0xae, 0x20, 0x2d, 0x3f, 0xf4, 0xfc, 0xae, 0x07, 0x9b,
-  0x5a, 0x07, 0x01, 0xd5, 0x2b, 0x22, 0xcb, 0xe7, 0x1b, 0x07, 0x7f, 0xf5,
-  0xf4, 0xae, 0x20, 0x22, 0xc6, 0xe7, 0x1a, 0xf0, 0x01, 0x0f, 0x3f, 0xf4,
-  0x96, 0xae, 0x8f, 0xe7, 0xa6, 0x07, 0x34, 0xd1, 0xbb, 0xf1, 0x03, 0x0f,
-  0x31, 0xd9, 0x0c, 0x9b, 0x1d, 0x46, 0xdc, 0x1e, 0x04, 0xeb, 0x0b, 0x0a,
-  0x2a, 0x46, 0x4b, 0x46, 0x41, 0x46, 0x20, 0x20, 0x01, 0x35, 0xb8, 0x47,
-  0x55, 0x45, 0xf7, 0xd1, 0x55, 0x46, 0x1e, 0x4c, 0xe6, 0x1e, 0x14, 0xf8,
-  0x01, 0x0d, 0x2a, 0x46, 0x4b, 0x46, 0x41, 0x46, 0xb8, 0x47, 0xa6, 0x42,
-  0x05, 0xf1, 0x01, 0x05, 0xf5, 0xd1, 0x07, 0x9b, 0x0a, 0xf1, 0x03, 0x0a,
-  0x9d, 0x07, 0x7f, 0xf5, 0xd5, 0xae, 0x0c, 0x9c, 0xaa, 0xeb, 0x04, 0x03,
-  0x9b, 0x45, 0x7f, 0xf6, 0xcf, 0xae, 0x52, 0x46, 0x4b, 0x46, 0x41, 0x46,
-  0x20, 0x20, 0x0a, 0xf1, 0x01, 0x0a, 0xb8, 0x47, 0xaa, 0xeb, 0x04, 0x03,
-  0x9b, 0x45, 0xf4, 0xd8, 0xc2, 0xe6, 0xdd, 0xf8, 0x30, 0xa0, 0xd7, 0xe7,
-  0xab, 0x45, 0x3f, 0xf6, 0xa3, 0xae, 0xae, 0xe6, 0xbb, 0xf1, 0x00, 0x0f,
-  0x3f, 0xf4, 0x7a, 0xaf, 0x0d, 0x9b, 0x00, 0x2b, 0x9f, 0xd0, 0x0b, 0xf1,
-  0xff, 0x3b, 0x5d, 0x45, 0xff, 0xf4, 0x96, 0xae, 0x20, 0x2d, 0x7f, 0xf4,
-  0x74, 0xaf, 0x9e, 0xe6, 0x00, 0x00, 0xe0, 0x3f, 0x2f, 0x9d, 0x00, 0x20,
-  0x00, 0x00, 0x00, 0x00, 0x2d, 0xe9, 0xf0, 0x4f, 0x9f, 0xb0, 0x2a, 0x9e,
-  0xdd, 0xe9, 0x28, 0x45, 0x07, 0x46, 0x93, 0x46, 0x08, 0x91, 0x09, 0x93,
-  0x22, 0x46, 0x2b, 0x46, 0x20, 0x46, 0x29, 0x46, 0x0e, 0x96, 0xdd, 0xe9,
-  0x2b, 0xa6, 0xff, 0xf7, 0xe5, 0xfb, 0x00, 0x28, 0x40, 0xf0, 0xbe, 0x80,
-  0x20, 0x46, 0x29, 0x46, 0x4f, 0xf0, 0xff, 0x32, 0x78, 0x4b, 0xff, 0xf7,
-  0x29, 0xfc, 0x00, 0x28, 0x40, 0xf0, 0xb4, 0x80, 0x20, 0x46, 0x29, 0x46,
-  0x4f, 0xf0, 0xff, 0x32, 0x6f, 0xf4, 0x80, 0x13, 0xff, 0xf7, 0xe2, 0xfb,
-  0x00, 0x28, 0x40, 0xf0, 0xa9, 0x80, 0x20, 0x46, 0x29, 0x46, 0x00, 0x22,
-  0x00, 0x23, 0xff, 0xf7, 0xd9, 0xfb, 0x00, 0x28, 0x40, 0xf0, 0xd5, 0x81,
-  0xcd, 0xe9, 0x0a, 0x45, 0xdd, 0xe9, 0x0a, 0x23, 0x90, 0x46, 0x99, 0x46,
-  0x06, 0xf4, 0x00, 0x62, 0x16, 0xf4, 0x80, 0x63, 0x0f, 0x92, 0x13, 0x93,
-  0x40, 0xf0, 0xa1, 0x80, 0x58, 0xea, 0x09, 0x03, 0x40, 0xf0, 0xca, 0x80,
-  0x00, 0x2a, 0x40, 0xf0, 0xe3, 0x81, 0x06, 0x23, 0x0e, 0x93, 0x16, 0xf0,
-  0x02, 0x02, 0x10, 0x92, 0x40, 0xf0, 0xd4, 0x81, 0x53, 0x46, 0x04, 0x2b,
-  0x38, 0xbf, 0x04, 0x23, 0x0c, 0x92, 0x04, 0x22, 0x04, 0x3b, 0x12, 0x92,
-  0x0f, 0x93, 0x20, 0x46, 0x29, 0x46, 0x00, 0x22, 0x00, 0x23, 0xff, 0xf7,
-  0xab, 0xfb, 0x00, 0x28, 0x40, 0xf0, 0xf3, 0x81, 0x9d, 0xed, 0x0a, 0x7b,
-  0x0f, 0x9b, 0x5a, 0x46, 0x03, 0x93, 0x0e, 0x9b, 0x8d, 0xed, 0x00, 0x7b,
-  0x02, 0x93, 0x26, 0xf4, 0x00, 0x63, 0x04, 0x93, 0x38, 0x46, 0x09, 0x9b,
-  0x08, 0x99, 0xff, 0xf7, 0x2d, 0xfd, 0x02, 0x46, 0x16, 0xf0, 0x20, 0x0f,
-  0x09, 0x9b, 0x08, 0x99, 0x0c, 0xbf, 0x65, 0x20, 0x45, 0x20, 0x02, 0xf1,
-  0x01, 0x08, 0xb8, 0x47, 0x0c, 0x9a, 0x12, 0x9b, 0x16, 0xac, 0x5d, 0x1e,
-  0x82, 0xea, 0xe2, 0x73, 0xa3, 0xeb, 0xe2, 0x73, 0xd1, 0x0f, 0x00, 0x26,
-  0x22, 0x46, 0x99, 0x46, 0xdf, 0xf8, 0x04, 0xc1, 0x01, 0xe0, 0x20, 0x2e,
-  0x10, 0xd0, 0xce, 0x46, 0xac, 0xfb, 0x09, 0x30, 0xc0, 0x08, 0x00, 0xeb,
-  0x80, 0x03, 0xa9, 0xeb, 0x43, 0x03, 0x30, 0x33, 0xbe, 0xf1, 0x09, 0x0f,
-  0x81, 0x46, 0x06, 0xf1, 0x01, 0x06, 0x02, 0xf8, 0x01, 0x3b, 0xec, 0xd8,
-  0x05, 0x23, 0x00, 0x20, 0x06, 0x93, 0x0a, 0x23, 0x05, 0x95, 0x00, 0x94,
-  0x09, 0x9d, 0x08, 0x9c, 0x42, 0x46, 0xcd, 0xe9, 0x03, 0x30, 0xcd, 0xe9,
-  0x01, 0x61, 0x2b, 0x46, 0x21, 0x46, 0x38, 0x46, 0xff, 0xf7, 0xf8, 0xfb,
-  0x10, 0x9a, 0x80, 0x46, 0xd2, 0xb1, 0xa0, 0xeb, 0x0b, 0x06, 0xb2, 0x45,
-  0x16, 0xd9, 0x0b, 0xeb, 0x06, 0x02, 0x2b, 0x46, 0x21, 0x46, 0x20, 0x20,
-  0x01, 0x36, 0xb8, 0x47, 0xb2, 0x45, 0xf6, 0xd8, 0x0b, 0xf1, 0xff, 0x33,
-  0x53, 0x44, 0xcb, 0xf1, 0x01, 0x02, 0xa3, 0xeb, 0x08, 0x03, 0x42, 0x44,
-  0x92, 0x45, 0x38, 0xbf, 0x00, 0x23, 0x08, 0xf1, 0x01, 0x08, 0x98, 0x44,
-  0x40, 0x46, 0x1f, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x5a, 0x46, 0x38, 0x46,
-  0xcd, 0xe9, 0x28, 0x45, 0xcd, 0xe9, 0x2b, 0xa6, 0x0e, 0x9c, 0x09, 0x9b,
-  0x08, 0x99, 0x2a, 0x94, 0x1f, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7,
-  0xbd, 0xbc, 0x58, 0xea, 0x09, 0x03, 0x2b, 0xd1, 0x00, 0x2a, 0x3f, 0xf4,
-  0x62, 0xaf, 0x00, 0x23, 0x0c, 0x93, 0x0e, 0x9b, 0x0c, 0x9a, 0x93, 0x42,
-  0x00, 0xf3, 0xb9, 0x81, 0x4f, 0xf0, 0x00, 0x08, 0x20, 0x46, 0x29, 0x46,
-  0x00, 0x22, 0x00, 0x23, 0xff, 0xf7, 0x12, 0xfb, 0x00, 0x28, 0x40, 0xf0,
-  0x13, 0x81, 0x9d, 0xed, 0x0a, 0x7b, 0x26, 0xf4, 0x00, 0x66, 0x46, 0xf4,
-  0x80, 0x66, 0x8d, 0xed, 0x28, 0x7b, 0x5a, 0x46, 0x38, 0x46, 0xcd, 0xe9,
-  0x2a, 0x8a, 0x09, 0x9b, 0x08, 0x99, 0x2c, 0x96, 0xd2, 0xe7, 0x00, 0xbf,
-  0xff, 0xff, 0xef, 0x7f, 0xcd, 0xcc, 0xcc, 0xcc, 0x06, 0x23, 0x0e, 0x93,
-  0xc9, 0xf3, 0x0a, 0x50, 0xa0, 0xf2, 0xff, 0x30, 0xff, 0xf7, 0x98, 0xfa,
-  0xc1, 0xa3, 0xd3, 0xe9, 0x00, 0x23, 0xff, 0xf7, 0x11, 0xfa, 0xc1, 0xa3,
-  0xd3, 0xe9, 0x00, 0x23, 0xff, 0xf7, 0xe4, 0xf9, 0xc9, 0xf3, 0x13, 0x09,
-  0xcd, 0xe9, 0x0c, 0x01, 0x49, 0xf0, 0x7f, 0x51, 0x40, 0x46, 0x00, 0x22,
-  0xb2, 0x4b, 0x41, 0xf4, 0x40, 0x11, 0xff, 0xf7, 0xeb, 0xf9, 0xa4, 0xa3,
-  0xd3, 0xe9, 0x00, 0x23, 0xff, 0xf7, 0xfa, 0xf9, 0x02, 0x46, 0x0b, 0x46,
-  0xdd, 0xe9, 0x0c, 0x01, 0xff, 0xf7, 0xcc, 0xf9, 0xff, 0xf7, 0x98, 0xfa,
-  0x0c, 0x90, 0xff, 0xf7, 0x71, 0xfa, 0x9e, 0xa3, 0xd3, 0xe9, 0x00, 0x23,
-  0x80, 0x46, 0x89, 0x46, 0xff, 0xf7, 0xe8, 0xf9, 0x00, 0x22, 0xa5, 0x4b,
-  0xff, 0xf7, 0xbc, 0xf9, 0xff, 0xf7, 0x88, 0xfa, 0x03, 0x46, 0x49, 0x46,
-  0x40, 0x46, 0x12, 0x93, 0x97, 0xa3, 0xd3, 0xe9, 0x00, 0x23, 0xff, 0xf7,
-  0xd9, 0xf9, 0x80, 0x46, 0x12, 0x98, 0x89, 0x46, 0xff, 0xf7, 0x56, 0xfa,
-  0x94, 0xa3, 0xd3, 0xe9, 0x00, 0x23, 0xff, 0xf7, 0xcf, 0xf9, 0x02, 0x46,
-  0x0b, 0x46, 0x40, 0x46, 0x49, 0x46, 0xff, 0xf7, 0xb5, 0xf9, 0x02, 0x46,
-  0x0b, 0x46, 0x80, 0x46, 0x89, 0x46, 0xff, 0xf7, 0xc3, 0xf9, 0x42, 0x46,
-  0x4b, 0x46, 0xcd, 0xe9, 0x10, 0x01, 0x40, 0x46, 0x49, 0x46, 0xff, 0xf7,
-  0x93, 0xf9, 0x00, 0x22, 0xcd, 0xe9, 0x14, 0x01, 0xdd, 0xe9, 0x10, 0x01,
-  0x8d, 0x4b, 0xff, 0xf7, 0xd9, 0xf9, 0x00, 0x22, 0x8c, 0x4b, 0xff, 0xf7,
-  0x87, 0xf9, 0x02, 0x46, 0x0b, 0x46, 0xdd, 0xe9, 0x10, 0x01, 0xff, 0xf7,
-  0xcf, 0xf9, 0x00, 0x22, 0x88, 0x4b, 0xff, 0xf7, 0x7d, 0xf9, 0x02, 0x46,
-  0x0b, 0x46, 0xdd, 0xe9, 0x10, 0x01, 0xff, 0xf7, 0xc5, 0xf9, 0x42, 0x46,
-  0x4b, 0x46, 0x80, 0x46, 0x89, 0x46, 0x00, 0x20, 0x4f, 0xf0, 0x80, 0x41,
-  0xff, 0xf7, 0x82, 0xf9, 0x02, 0x46, 0x0b, 0x46, 0x40, 0x46, 0x49, 0x46,
-  0xff, 0xf7, 0x68, 0xf9, 0x02, 0x46, 0x0b, 0x46, 0xdd, 0xe9, 0x14, 0x01,
-  0xff, 0xf7, 0xb0, 0xf9, 0x00, 0x22, 0x7a, 0x4b, 0xff, 0xf7, 0x5e, 0xf9,
-  0x12, 0x9b, 0x00, 0x22, 0x03, 0xf2, 0xff, 0x3c, 0x4f, 0xea, 0x0c, 0x53,
-  0xff, 0xf7, 0x7e, 0xf9, 0x80, 0x46, 0x89, 0x46, 0xdd, 0xe9, 0x0a, 0x01,
-  0x42, 0x46, 0x4b, 0x46, 0xff, 0xf7, 0x52, 0xfa, 0x50, 0xb1, 0x0c, 0x9b,
-  0x40, 0x46, 0x01, 0x3b, 0x49, 0x46, 0x0c, 0x93, 0x00, 0x22, 0x6b, 0x4b,
-  0xff, 0xf7, 0x92, 0xf9, 0x80, 0x46, 0x89, 0x46, 0x0c, 0x9a, 0x43, 0x46,
-  0x63, 0x32, 0xc6, 0x2a, 0x06, 0xf0, 0x02, 0x02, 0x10, 0x92, 0x49, 0x46,
-  0x0f, 0x9a, 0x2c, 0xd8, 0x00, 0x2a, 0x5e, 0xd0, 0x04, 0x22, 0x12, 0x92,
-  0x0b, 0x43, 0x3f, 0xf4, 0x16, 0xaf, 0xdd, 0xe9, 0x0a, 0x01, 0x58, 0xa3,
-  0xd3, 0xe9, 0x00, 0x23, 0xff, 0xf7, 0x56, 0xfa, 0x48, 0xb1, 0xdd, 0xe9,
-  0x0a, 0x01, 0x56, 0xa3, 0xd3, 0xe9, 0x00, 0x23, 0xff, 0xf7, 0x26, 0xfa,
-  0x00, 0x28, 0x7f, 0xf4, 0x04, 0xaf, 0x0e, 0x9b, 0x00, 0x2b, 0x50, 0xd0,
-  0x13, 0x9a, 0x00, 0x2a, 0x7d, 0xd0, 0x01, 0x3b, 0x0e, 0x93, 0x12, 0x9b,
-  0x9a, 0x45, 0x05, 0xd9, 0x10, 0x9b, 0x00, 0x2b, 0x00, 0xf0, 0xae, 0x80,
-  0x02, 0x23, 0x10, 0x93, 0x00, 0x23, 0x0f, 0x93, 0x44, 0xe0, 0x22, 0xbb,
-  0xba, 0xf1, 0x05, 0x0f, 0x4f, 0xd9, 0x06, 0xf0, 0x02, 0x03, 0x00, 0x2b,
-  0x49, 0xd1, 0x05, 0x23, 0x12, 0x93, 0xaa, 0xf1, 0x05, 0x03, 0x0f, 0x93,
-  0x3a, 0xe0, 0x05, 0xf1, 0x00, 0x43, 0x0a, 0x94, 0x0b, 0x93, 0x27, 0xe6,
-  0x26, 0xf4, 0x00, 0x66, 0x46, 0xf4, 0x80, 0x66, 0x38, 0x46, 0x2c, 0x96,
-  0xdd, 0xe9, 0x0a, 0x67, 0x34, 0x46, 0x07, 0xf1, 0x00, 0x45, 0x5a, 0x46,
-  0xcd, 0xe9, 0x2a, 0x8a, 0xcd, 0xe9, 0x28, 0x45, 0x09, 0x9b, 0x08, 0x99,
-  0xbc, 0xe6, 0x05, 0x22, 0x12, 0x92, 0xad, 0xe7, 0x00, 0x23, 0x02, 0x22,
-  0xcd, 0xe9, 0x0f, 0x32, 0x04, 0x22, 0x0c, 0x93, 0x12, 0x92, 0x2c, 0xe6,
-  0x4f, 0xf0, 0x05, 0x08, 0xc2, 0xe6, 0xba, 0xf1, 0x04, 0x0f, 0x1f, 0xd9,
-  0x10, 0x9b, 0x00, 0x2b, 0x78, 0xd1, 0x04, 0x23, 0x12, 0x93, 0xaa, 0xf1,
-  0x04, 0x03, 0x0f, 0x93, 0x04, 0xe0, 0x12, 0x9b, 0x9a, 0x45, 0x31, 0xd8,
-  0x0e, 0x9b, 0x0f, 0x93, 0x0c, 0x9b, 0x00, 0x2b, 0x3f, 0xf4, 0x15, 0xae,
-  0xdd, 0xe9, 0x0a, 0x01, 0x42, 0x46, 0x4b, 0x46, 0xff, 0xf7, 0x0a, 0xf9,
-  0xcd, 0xe9, 0x0a, 0x01, 0x0b, 0xe6, 0x02, 0x23, 0x10, 0x93, 0x05, 0x23,
-  0x12, 0x93, 0xf1, 0xe7, 0x04, 0x23, 0x12, 0x93, 0xea, 0xe7, 0xdd, 0xe9,
-  0x0a, 0x45, 0xa0, 0x46, 0x0f, 0x9b, 0x05, 0xf1, 0x00, 0x49, 0x03, 0x93,
-  0x0e, 0x9b, 0x5a, 0x46, 0x02, 0x93, 0x26, 0xf4, 0x00, 0x63, 0x04, 0x93,
-  0x38, 0x46, 0xcd, 0xe9, 0x00, 0x89, 0x09, 0x9b, 0x08, 0x99, 0xff, 0xf7,
-  0x37, 0xfb, 0x02, 0x46, 0x08, 0xe6, 0x12, 0x9b, 0x9a, 0x45, 0x44, 0xd8,
-  0x0f, 0x92, 0xcf, 0xe7, 0x10, 0x9b, 0x8b, 0xb3, 0x0e, 0x9b, 0x0f, 0x93,
-  0x02, 0x23, 0x10, 0x93, 0xc8, 0xe7, 0x00, 0xbf, 0x61, 0x43, 0x6f, 0x63,
-  0xa7, 0x87, 0xd2, 0x3f, 0x71, 0xa3, 0x79, 0x09, 0x4f, 0x93, 0x0a, 0x40,
-  0x16, 0x55, 0xb5, 0xbb, 0xb1, 0x6b, 0x02, 0x40, 0xef, 0x39, 0xfa, 0xfe,
-  0x42, 0x2e, 0xe6, 0x3f, 0x2d, 0x43, 0x1c, 0xeb, 0xe2, 0x36, 0x1a, 0x3f,
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x84, 0x2e, 0x41, 0x00, 0x00, 0xf8, 0x3f,
-  0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x24, 0x40,
-  0x00, 0x00, 0x18, 0x40, 0x00, 0x00, 0xf0, 0x3f, 0xfb, 0x79, 0x9f, 0x50,
-  0x13, 0x44, 0xd3, 0x3f, 0xb3, 0xc8, 0x60, 0x8b, 0x28, 0x8a, 0xc6, 0x3f,
-  0x12, 0x9b, 0xaa, 0xeb, 0x03, 0x03, 0x0f, 0x93, 0x96, 0xe7, 0xa3, 0xeb,
-  0x02, 0x08, 0x08, 0xf1, 0xff, 0x38, 0x43, 0xe6, 0x04, 0x23, 0x12, 0x93,
-  0x02, 0x23, 0x10, 0x93, 0x8c, 0xe7, 0x10, 0x9b, 0x00, 0x2b, 0xed, 0xd0,
-  0x02, 0x23, 0x0f, 0x92, 0x10, 0x93, 0x85, 0xe7, 0x2d, 0xe9, 0xf0, 0x4f,
-  0x9b, 0xb0, 0x24, 0x9c, 0x95, 0x4d, 0x0a, 0x94, 0x95, 0x4c, 0xb1, 0xf1,
-  0x00, 0x0a, 0x18, 0xbf, 0x83, 0x46, 0x25, 0x60, 0x18, 0x78, 0x93, 0x4c,
-  0x91, 0x46, 0x08, 0xbf, 0xa3, 0x46, 0x09, 0x93, 0x00, 0x28, 0x00, 0xf0,
-  0x93, 0x82, 0x4f, 0xf0, 0x00, 0x08, 0x0a, 0xe0, 0x42, 0x46, 0x4b, 0x46,
-  0x51, 0x46, 0x08, 0xf1, 0x01, 0x08, 0xd8, 0x47, 0x09, 0x9b, 0x18, 0x78,
-  0x00, 0x28, 0x00, 0xf0, 0xce, 0x80, 0x09, 0x9b, 0x25, 0x28, 0x03, 0xf1,
-  0x01, 0x03, 0x09, 0x93, 0xee, 0xd1, 0x1c, 0x46, 0x00, 0x23, 0x22, 0x46,
-  0x12, 0xf8, 0x01, 0x0b, 0xa0, 0xf1, 0x20, 0x01, 0x10, 0x29, 0x0a, 0xd8,
-  0xdf, 0xe8, 0x01, 0xf0, 0x40, 0x09, 0x09, 0x3c, 0x09, 0x09, 0x09, 0x09,
-  0x09, 0x09, 0x09, 0x38, 0x09, 0x34, 0x09, 0x09, 0x30, 0x00, 0xa0, 0xf1,
-  0x30, 0x01, 0x09, 0x29, 0x09, 0x94, 0x40, 0xf2, 0x8a, 0x80, 0x2a, 0x28,
-  0x00, 0xf0, 0xf0, 0x80, 0x00, 0x25, 0x2e, 0x28, 0x00, 0xf0, 0x96, 0x80,
-  0x00, 0x26, 0xa0, 0xf1, 0x68, 0x01, 0x12, 0x29, 0x2d, 0xd8, 0xdf, 0xe8,
-  0x11, 0xf0, 0x49, 0x01, 0x2c, 0x00, 0x43, 0x01, 0x2c, 0x00, 0x38, 0x01,
-  0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x00,
-  0x2c, 0x00, 0x27, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x00,
-  0x2c, 0x00, 0x27, 0x00, 0x14, 0x46, 0x43, 0xf0, 0x01, 0x03, 0xc2, 0xe7,
-  0x14, 0x46, 0x43, 0xf0, 0x02, 0x03, 0xbe, 0xe7, 0x14, 0x46, 0x43, 0xf0,
-  0x04, 0x03, 0xba, 0xe7, 0x14, 0x46, 0x43, 0xf0, 0x10, 0x03, 0xb6, 0xe7,
-  0x14, 0x46, 0x43, 0xf0, 0x08, 0x03, 0xb2, 0xe7, 0x09, 0x99, 0x48, 0x78,
-  0x43, 0xf4, 0x80, 0x73, 0x01, 0x32, 0x67, 0x28, 0x09, 0x92, 0x7e, 0xd8,
-  0x24, 0x28, 0x40, 0xf2, 0xc1, 0x80, 0xa0, 0xf1, 0x25, 0x02, 0x42, 0x2a,
-  0x00, 0xf2, 0xbc, 0x80, 0xdf, 0xe8, 0x12, 0xf0, 0x50, 0x01, 0xba, 0x00,
-  0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00,
-  0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00,
-  0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00,
-  0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00,
-  0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00,
-  0x19, 0x01, 0x37, 0x01, 0x19, 0x01, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00,
-  0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00,
-  0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00,
-  0xba, 0x00, 0xbc, 0x01, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00,
-  0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xba, 0x00, 0xbc, 0x01,
-  0x58, 0x01, 0xbc, 0x01, 0x19, 0x01, 0x37, 0x01, 0x19, 0x01, 0x00, 0x25,
-  0x00, 0xe0, 0x01, 0x32, 0x05, 0xeb, 0x85, 0x05, 0x00, 0xeb, 0x45, 0x05,
-  0x10, 0x78, 0x30, 0x3d, 0xa0, 0xf1, 0x30, 0x01, 0x09, 0x29, 0xf4, 0xd9,
-  0x2e, 0x28, 0x09, 0x92, 0x02, 0xf1, 0x01, 0x02, 0x7f, 0xf4, 0x6a, 0xaf,
-  0x09, 0x99, 0x43, 0xf4, 0x80, 0x63, 0x48, 0x78, 0x11, 0x46, 0xa0, 0xf1,
-  0x30, 0x06, 0x09, 0x2e, 0x40, 0xf2, 0x21, 0x81, 0x2a, 0x28, 0x00, 0xf0,
-  0x2f, 0x81, 0x09, 0x92, 0x00, 0x26, 0x01, 0x32, 0x59, 0xe7, 0x44, 0x46,
-  0xc1, 0x45, 0x01, 0xd8, 0x09, 0xf1, 0xff, 0x38, 0x4b, 0x46, 0x42, 0x46,
-  0x51, 0x46, 0x00, 0x20, 0xd8, 0x47, 0x20, 0x46, 0x1b, 0xb0, 0xbd, 0xe8,
-  0xf0, 0x8f, 0xa0, 0xf1, 0x69, 0x02, 0xd2, 0xb2, 0x0f, 0x2a, 0x3f, 0xd8,
-  0x01, 0x21, 0x49, 0xf2, 0x41, 0x07, 0x91, 0x40, 0x39, 0x40, 0x40, 0xf0,
-  0xf3, 0x80, 0x0a, 0x2a, 0x3d, 0xd0, 0x07, 0x2a, 0x34, 0xd1, 0x0a, 0x9d,
-  0x55, 0xf8, 0x04, 0x2b, 0x00, 0x2a, 0x00, 0xf0, 0x13, 0x81, 0x43, 0xf0,
-  0x21, 0x00, 0x12, 0xab, 0x1f, 0x46, 0x0b, 0x93, 0x03, 0xe0, 0x20, 0x29,
-  0x00, 0xf0, 0x14, 0x81, 0x1a, 0x46, 0x02, 0xf0, 0x0f, 0x04, 0x23, 0x46,
-  0x09, 0x2c, 0x94, 0xbf, 0x30, 0x33, 0x37, 0x33, 0x0f, 0x2a, 0x07, 0xf8,
-  0x01, 0x3b, 0x01, 0xf1, 0x01, 0x01, 0x4f, 0xea, 0x12, 0x13, 0xec, 0xd8,
-  0x02, 0xe1, 0x00, 0xbf, 0x8d, 0x27, 0x00, 0x20, 0x24, 0xc0, 0x00, 0x20,
-  0xcd, 0x1a, 0x00, 0x20, 0x0a, 0x99, 0x09, 0x98, 0x51, 0xf8, 0x04, 0x5b,
-  0x40, 0x78, 0x00, 0x2d, 0xcd, 0xe9, 0x09, 0x21, 0xbc, 0xbf, 0x43, 0xf0,
-  0x02, 0x03, 0x6d, 0x42, 0x01, 0x32, 0x02, 0xe7, 0x42, 0x46, 0x4b, 0x46,
-  0x51, 0x46, 0x08, 0xf1, 0x01, 0x08, 0xd8, 0x47, 0xd2, 0xe6, 0x0a, 0x99,
-  0x00, 0x2e, 0x51, 0xf8, 0x04, 0x7b, 0x18, 0xbf, 0x32, 0x46, 0x38, 0x78,
-  0x08, 0xbf, 0x4f, 0xf0, 0xff, 0x32, 0x00, 0x28, 0x00, 0xf0, 0x7b, 0x83,
-  0xbc, 0x18, 0xa4, 0x46, 0x3a, 0x46, 0x04, 0xe0, 0x12, 0xf8, 0x01, 0x4f,
-  0x00, 0x2c, 0x00, 0xf0, 0x3f, 0x81, 0x94, 0x45, 0xf8, 0xd1, 0x64, 0x46,
-  0xe4, 0x1b, 0x5a, 0x05, 0x40, 0xf1, 0x22, 0x81, 0xb4, 0x42, 0x28, 0xbf,
-  0x34, 0x46, 0x13, 0xf0, 0x02, 0x03, 0x00, 0xf0, 0x88, 0x82, 0x02, 0x23,
-  0xcd, 0xe9, 0x0a, 0x51, 0x42, 0x46, 0x1d, 0x46, 0x46, 0x44, 0x08, 0xe0,
-  0x4b, 0x46, 0x51, 0x46, 0xd8, 0x47, 0x17, 0xf8, 0x01, 0x0f, 0x08, 0xf1,
-  0x01, 0x08, 0x10, 0xb1, 0x42, 0x46, 0x46, 0x45, 0xf4, 0xd1, 0x2b, 0x46,
-  0x0b, 0x99, 0x0a, 0x9d, 0x00, 0x2b, 0x40, 0xf0, 0x41, 0x81, 0x0a, 0x91,
-  0x94, 0xe6, 0x09, 0x99, 0x48, 0x78, 0x6c, 0x28, 0x7f, 0xf4, 0xec, 0xae,
-  0x0a, 0x46, 0x88, 0x78, 0x43, 0xf4, 0x40, 0x73, 0x03, 0x32, 0xe8, 0xe6,
-  0x09, 0x99, 0x43, 0xf4, 0x00, 0x73, 0x48, 0x78, 0x01, 0x32, 0xe2, 0xe6,
-  0x09, 0x99, 0x48, 0x78, 0x68, 0x28, 0x00, 0xf0, 0x03, 0x81, 0x43, 0xf0,
-  0x80, 0x03, 0x01, 0x32, 0xd9, 0xe6, 0x67, 0x28, 0x00, 0xf0, 0xd9, 0x80,
-  0x47, 0x28, 0x00, 0xf0, 0xdc, 0x80, 0x45, 0x28, 0x00, 0xf0, 0xdb, 0x80,
-  0xcd, 0xe9, 0x03, 0x53, 0x0a, 0x9b, 0x02, 0x96, 0x07, 0x33, 0x23, 0xf0,
-  0x07, 0x03, 0x1c, 0x46, 0x42, 0x46, 0xf4, 0xe8, 0x02, 0x67, 0x4b, 0x46,
-  0x51, 0x46, 0x58, 0x46, 0xcd, 0xe9, 0x00, 0x67, 0x0a, 0x94, 0xff, 0xf7,
-  0x87, 0xfb, 0x80, 0x46, 0x5c, 0xe6, 0x46, 0x28, 0x08, 0xbf, 0x43, 0xf0,
-  0x20, 0x03, 0xcd, 0xe9, 0x03, 0x53, 0x0a, 0x9b, 0x02, 0x96, 0x07, 0x33,
-  0x23, 0xf0, 0x07, 0x03, 0x1c, 0x46, 0x42, 0x46, 0xf4, 0xe8, 0x02, 0x67,
-  0x4b, 0x46, 0x51, 0x46, 0x58, 0x46, 0xcd, 0xe9, 0x00, 0x67, 0x0a, 0x94,
-  0xff, 0xf7, 0x0e, 0xf9, 0x80, 0x46, 0x43, 0xe6, 0x42, 0x46, 0x4b, 0x46,
-  0x51, 0x46, 0x25, 0x20, 0x08, 0xf1, 0x01, 0x08, 0xd8, 0x47, 0x3b, 0xe6,
-  0x0a, 0x9a, 0x99, 0x07, 0x02, 0xf1, 0x04, 0x04, 0x08, 0xf1, 0x01, 0x06,
-  0x40, 0xf1, 0xc6, 0x80, 0x10, 0x78, 0x4b, 0x46, 0x42, 0x46, 0x51, 0x46,
-  0xd8, 0x47, 0x01, 0x2d, 0x88, 0xbf, 0xa8, 0x44, 0x40, 0xf2, 0xbd, 0x81,
-  0x32, 0x46, 0x4b, 0x46, 0x51, 0x46, 0x20, 0x20, 0x01, 0x36, 0xd8, 0x47,
-  0x46, 0x45, 0xf7, 0xd1, 0x0a, 0x94, 0x1f, 0xe6, 0x6f, 0x28, 0x00, 0xf0,
-  0x81, 0x80, 0x40, 0xf2, 0x48, 0x82, 0x78, 0x28, 0x00, 0xf0, 0x90, 0x81,
-  0x0a, 0x27, 0x23, 0xf0, 0x10, 0x03, 0xbc, 0x46, 0x41, 0xe0, 0x00, 0x26,
-  0x06, 0xeb, 0x86, 0x06, 0x00, 0xeb, 0x46, 0x00, 0xa0, 0xf1, 0x30, 0x06,
-  0x11, 0xf8, 0x01, 0x0f, 0xa0, 0xf1, 0x30, 0x02, 0x09, 0x2a, 0xf3, 0xd9,
-  0x0a, 0x46, 0x09, 0x91, 0x01, 0x32, 0x2e, 0xe6, 0xdd, 0xe9, 0x09, 0x21,
-  0x51, 0xf8, 0x04, 0x6b, 0x90, 0x78, 0x02, 0x32, 0x09, 0x92, 0x0a, 0x91,
-  0x01, 0x32, 0x26, 0xea, 0xe6, 0x76, 0x22, 0xe6, 0x23, 0xf0, 0x10, 0x00,
-  0x13, 0xf4, 0x80, 0x62, 0x40, 0xf0, 0x21, 0x00, 0x3f, 0xf4, 0xe7, 0xae,
-  0x12, 0xab, 0x0b, 0x93, 0x0b, 0x9b, 0x06, 0x90, 0x00, 0x93, 0x08, 0x23,
-  0x10, 0x20, 0x05, 0x93, 0x00, 0x23, 0x42, 0x46, 0xcd, 0xe9, 0x02, 0x30,
-  0x01, 0x91, 0x4b, 0x46, 0x51, 0x46, 0x58, 0x46, 0x04, 0x96, 0xfe, 0xf7,
-  0xad, 0xff, 0x0a, 0x95, 0x80, 0x46, 0xd7, 0xe5, 0x58, 0x28, 0x62, 0xd0,
-  0x62, 0x28, 0x40, 0xf0, 0x8f, 0x80, 0x02, 0x27, 0xbc, 0x46, 0x13, 0xf4,
-  0x80, 0x60, 0x00, 0xf0, 0xdd, 0x80, 0x23, 0xf0, 0x0d, 0x03, 0x13, 0xf4,
-  0x00, 0x72, 0x40, 0xf0, 0x81, 0x81, 0x0a, 0x99, 0x0f, 0x1d, 0x13, 0xf4,
-  0x80, 0x71, 0x40, 0xf0, 0x37, 0x82, 0x5c, 0x06, 0x0a, 0x9a, 0x40, 0xf1,
-  0x3b, 0x81, 0x12, 0x78, 0x00, 0x2a, 0x40, 0xf0, 0x4e, 0x81, 0x23, 0xf0,
-  0x10, 0x03, 0x00, 0x28, 0x00, 0xf0, 0x49, 0x81, 0x11, 0x46, 0x12, 0xaa,
-  0x0b, 0x92, 0xcd, 0xe9, 0x05, 0x53, 0xcd, 0xe9, 0x03, 0xc6, 0x01, 0x91,
-  0x0b, 0x9b, 0x42, 0x46, 0x00, 0x93, 0x00, 0x23, 0x51, 0x46, 0x02, 0x93,
-  0x58, 0x46, 0x4b, 0x46, 0xfe, 0xf7, 0x74, 0xff, 0x0a, 0x97, 0x80, 0x46,
-  0x9e, 0xe5, 0x43, 0xf4, 0x00, 0x63, 0x29, 0xe7, 0x08, 0x27, 0xbc, 0x46,
-  0xc7, 0xe7, 0x43, 0xf4, 0x00, 0x63, 0x43, 0xf0, 0x20, 0x03, 0x21, 0xe7,
-  0x13, 0xf0, 0x02, 0x03, 0x00, 0xf0, 0x8e, 0x81, 0x02, 0x23, 0x0a, 0x95,
-  0x1e, 0x46, 0x0d, 0x46, 0x42, 0x46, 0x4b, 0x46, 0x51, 0x46, 0xd8, 0x47,
-  0x17, 0xf8, 0x01, 0x0f, 0x08, 0xf1, 0x01, 0x08, 0x00, 0x28, 0xf5, 0xd1,
-  0x29, 0x46, 0x33, 0x46, 0x0a, 0x9d, 0xe3, 0xe6, 0xd4, 0x1b, 0xc2, 0xe6,
-  0x0a, 0x46, 0x88, 0x78, 0x43, 0xf0, 0xc0, 0x03, 0x03, 0x32, 0xd4, 0xe5,
-  0x04, 0x46, 0x80, 0x46, 0x46, 0xe6, 0x10, 0x27, 0x43, 0xf0, 0x20, 0x03,
-  0xbc, 0x46, 0x9c, 0xe7, 0x01, 0x2d, 0x40, 0xf2, 0xf8, 0x80, 0x46, 0x46,
-  0x08, 0xf1, 0xff, 0x37, 0x2f, 0x44, 0x32, 0x46, 0x4b, 0x46, 0x51, 0x46,
-  0x20, 0x20, 0x01, 0x36, 0xd8, 0x47, 0xbe, 0x42, 0xf7, 0xd1, 0x0a, 0x9b,
-  0x32, 0x46, 0x18, 0x78, 0x51, 0x46, 0x4b, 0x46, 0xd8, 0x47, 0xa8, 0x44,
-  0x0a, 0x94, 0x55, 0xe5, 0x46, 0x46, 0xa5, 0x42, 0x7f, 0xf6, 0xbb, 0xae,
-  0xa8, 0x44, 0xa8, 0xeb, 0x04, 0x08, 0x0c, 0x46, 0x32, 0x46, 0x4b, 0x46,
-  0x51, 0x46, 0x20, 0x20, 0x01, 0x36, 0xd8, 0x47, 0x46, 0x45, 0xf7, 0xd1,
-  0x21, 0x46, 0xac, 0xe6, 0x13, 0xf4, 0x80, 0x62, 0x00, 0xf0, 0xbb, 0x80,
-  0x4f, 0xf4, 0x80, 0x62, 0x23, 0xf0, 0x11, 0x0c, 0x1c, 0xf4, 0x00, 0x77,
-  0x0a, 0x9b, 0x4a, 0xd1, 0x1c, 0xf4, 0x80, 0x70, 0x03, 0xf1, 0x04, 0x04,
-  0x40, 0xf0, 0x34, 0x81, 0x1c, 0xf0, 0x40, 0x0f, 0x40, 0xf0, 0xa3, 0x80,
-  0x1c, 0xf0, 0x80, 0x0f, 0x00, 0xf0, 0xd3, 0x81, 0xb3, 0xf9, 0x00, 0x10,
-  0x81, 0xea, 0xe1, 0x77, 0xa7, 0xeb, 0xe1, 0x77, 0xbf, 0xb2, 0xcb, 0x0f,
-  0x00, 0x29, 0x00, 0xf0, 0x56, 0x81, 0x3a, 0x46, 0x12, 0xa9, 0x0f, 0x46,
-  0xdf, 0xf8, 0xd8, 0xe3, 0x0b, 0x91, 0x0a, 0x93, 0x0c, 0x95, 0x01, 0xe0,
-  0x20, 0x28, 0x0f, 0xd0, 0x15, 0x46, 0xae, 0xfb, 0x02, 0x13, 0xdb, 0x08,
-  0x03, 0xeb, 0x83, 0x01, 0xa2, 0xeb, 0x41, 0x01, 0x30, 0x31, 0x09, 0x2d,
-  0x1a, 0x46, 0x00, 0xf1, 0x01, 0x00, 0x07, 0xf8, 0x01, 0x1b, 0xed, 0xd8,
-  0x0a, 0x9b, 0x0c, 0x9d, 0xcd, 0xe9, 0x05, 0x5c, 0xcd, 0xe9, 0x01, 0x03,
-  0x04, 0x96, 0x0b, 0x9b, 0x42, 0x46, 0x00, 0x93, 0x0a, 0x23, 0x51, 0x46,
-  0x03, 0x93, 0x58, 0x46, 0x4b, 0x46, 0xfe, 0xf7, 0xc5, 0xfe, 0x0a, 0x94,
-  0x80, 0x46, 0xef, 0xe4, 0x23, 0xf0, 0x0c, 0x03, 0x21, 0xe7, 0x07, 0x33,
-  0x23, 0xf0, 0x07, 0x03, 0x19, 0x46, 0x08, 0x46, 0x5b, 0x68, 0x50, 0xf8,
-  0x08, 0x1b, 0xdf, 0x0f, 0x0a, 0x90, 0x51, 0xea, 0x03, 0x00, 0x62, 0xd1,
-  0x00, 0x2a, 0x40, 0xf0, 0x9f, 0x81, 0x13, 0x46, 0x11, 0x46, 0x12, 0xaa,
-  0xcd, 0xe9, 0x0c, 0x75, 0x00, 0x20, 0x15, 0x46, 0xcd, 0xe9, 0x0e, 0x68,
-  0xdf, 0xf8, 0x48, 0xe3, 0x0b, 0x92, 0x01, 0xe0, 0x20, 0x28, 0x2d, 0xd0,
-  0x5a, 0x18, 0x42, 0xf1, 0x00, 0x02, 0xae, 0xfb, 0x02, 0x78, 0x28, 0xf0,
-  0x03, 0x07, 0x07, 0xeb, 0x98, 0x07, 0xd2, 0x1b, 0x1e, 0x46, 0x9b, 0x1a,
-  0x61, 0xf1, 0x00, 0x07, 0x0c, 0x46, 0x4f, 0xf0, 0xcc, 0x31, 0x01, 0xfb,
-  0x03, 0xf1, 0x0e, 0xfb, 0x07, 0x11, 0xa3, 0xfb, 0x0e, 0x73, 0x19, 0x44,
-  0x05, 0x23, 0x07, 0xf0, 0x01, 0x08, 0xa8, 0xfb, 0x03, 0x38, 0x9b, 0x18,
-  0x0a, 0x2e, 0x03, 0xf1, 0x30, 0x03, 0x4f, 0xea, 0x57, 0x07, 0x74, 0xf1,
-  0x00, 0x04, 0x05, 0xf8, 0x01, 0x3b, 0x00, 0xf1, 0x01, 0x00, 0x47, 0xea,
-  0xc1, 0x73, 0x4f, 0xea, 0x51, 0x01, 0xcf, 0xd2, 0xdd, 0xe9, 0x0c, 0x75,
-  0xdd, 0xe9, 0x0e, 0x68, 0x0b, 0x9b, 0x42, 0x46, 0x00, 0x93, 0x0a, 0x23,
-  0xcd, 0xe9, 0x05, 0x5c, 0xcd, 0xe9, 0x01, 0x07, 0x04, 0x96, 0x03, 0x93,
-  0x4b, 0x46, 0x51, 0x46, 0x58, 0x46, 0xfe, 0xf7, 0x5f, 0xfe, 0x80, 0x46,
-  0x8a, 0xe4, 0x19, 0x78, 0x0f, 0x46, 0x64, 0xe7, 0x10, 0x27, 0xbc, 0x46,
-  0xb3, 0xe6, 0x23, 0xf0, 0x10, 0x0c, 0x45, 0xe7, 0x1c, 0x06, 0x4c, 0xbf,
-  0x12, 0x88, 0x12, 0x68, 0xc0, 0xe6, 0x0a, 0x46, 0x19, 0x1e, 0x01, 0xdb,
-  0x13, 0x46, 0x9c, 0xe7, 0x52, 0x42, 0x13, 0x46, 0x61, 0xeb, 0x41, 0x01,
-  0x97, 0xe7, 0x13, 0x46, 0x51, 0x46, 0x18, 0x78, 0x42, 0x46, 0x4b, 0x46,
-  0xd8, 0x47, 0xb0, 0x46, 0x48, 0xe6, 0x13, 0xf0, 0x20, 0x0f, 0x14, 0xbf,
-  0x41, 0x20, 0x61, 0x20, 0x12, 0xac, 0xa6, 0x46, 0x0b, 0x94, 0x0a, 0x93,
-  0xa0, 0xf1, 0x0a, 0x04, 0x0c, 0x95, 0x02, 0xe0, 0x20, 0x29, 0x12, 0xd0,
-  0x2a, 0x46, 0xb2, 0xfb, 0xfc, 0xf5, 0x0c, 0xfb, 0x15, 0x20, 0xc3, 0xb2,
-  0x09, 0x28, 0x03, 0xf1, 0x30, 0x00, 0x8a, 0xbf, 0x1b, 0x19, 0xc3, 0xb2,
-  0xdb, 0xb2, 0x62, 0x45, 0x0e, 0xf8, 0x01, 0x3b, 0x01, 0xf1, 0x01, 0x01,
-  0xea, 0xd2, 0x0a, 0x9b, 0x0c, 0x9d, 0x94, 0xe6, 0x0a, 0x9a, 0x07, 0x32,
-  0x22, 0xf0, 0x07, 0x02, 0x51, 0x68, 0x52, 0xf8, 0x08, 0x4b, 0x8e, 0x46,
-  0x0a, 0x92, 0x54, 0xea, 0x01, 0x02, 0x76, 0xd1, 0x23, 0xf0, 0x10, 0x03,
-  0x00, 0x28, 0x72, 0xd0, 0x00, 0x22, 0x11, 0x46, 0x12, 0xaa, 0x0b, 0x92,
-  0xcd, 0xe9, 0x05, 0x53, 0x0b, 0x9b, 0x42, 0x46, 0x00, 0x93, 0x00, 0x23,
-  0xcd, 0xe9, 0x03, 0xc6, 0x01, 0x91, 0x02, 0x93, 0x94, 0xe7, 0xa5, 0x42,
-  0x98, 0xbf, 0x01, 0x34, 0x7f, 0xf6, 0x74, 0xad, 0x4f, 0xf4, 0x80, 0x63,
-  0xcd, 0xe9, 0x0a, 0x75, 0x05, 0xeb, 0x08, 0x02, 0x1f, 0x46, 0x0d, 0x46,
-  0x14, 0x1b, 0x42, 0x46, 0x4b, 0x46, 0x51, 0x46, 0x20, 0x20, 0x08, 0xf1,
-  0x01, 0x08, 0xd8, 0x47, 0xa0, 0x45, 0xf6, 0xd1, 0x3b, 0x46, 0x0a, 0x9f,
-  0x29, 0x46, 0x38, 0x78, 0x0b, 0x9d, 0x6c, 0x1c, 0x00, 0x28, 0x3f, 0xf4,
-  0x70, 0xad, 0x00, 0x2b, 0x3f, 0xf4, 0x75, 0xae, 0x00, 0x23, 0x53, 0xe5,
-  0xa5, 0x42, 0xdf, 0xd8, 0x01, 0x34, 0x6e, 0xe6, 0x19, 0x68, 0xcb, 0x0f,
-  0x00, 0x29, 0x00, 0xf0, 0xa8, 0x80, 0x81, 0xea, 0xe1, 0x72, 0xa2, 0xeb,
-  0xe1, 0x72, 0x12, 0xa9, 0x08, 0x46, 0xdf, 0xf8, 0x88, 0xe1, 0x0b, 0x91,
-  0x0a, 0x93, 0x0c, 0x95, 0x01, 0xe0, 0x20, 0x2f, 0x0f, 0xd0, 0x15, 0x46,
-  0xae, 0xfb, 0x02, 0x13, 0xdb, 0x08, 0x03, 0xeb, 0x83, 0x01, 0xa2, 0xeb,
-  0x41, 0x01, 0x30, 0x31, 0x09, 0x2d, 0x1a, 0x46, 0x07, 0xf1, 0x01, 0x07,
-  0x00, 0xf8, 0x01, 0x1b, 0xed, 0xd8, 0x0a, 0x9b, 0x0c, 0x9d, 0xcd, 0xe9,
-  0x05, 0x5c, 0xcd, 0xe9, 0x01, 0x73, 0x04, 0x96, 0xd5, 0xe6, 0x69, 0x28,
-  0x23, 0xf0, 0x10, 0x0c, 0x40, 0xf0, 0x8c, 0x80, 0x13, 0xf4, 0x80, 0x62,
-  0x3f, 0xf4, 0x8e, 0xae, 0x88, 0xe6, 0x00, 0x2a, 0x3f, 0xf4, 0xa8, 0xae,
-  0x12, 0xaa, 0x0b, 0x92, 0xc0, 0xe6, 0x13, 0xf0, 0x20, 0x0f, 0x14, 0xbf,
-  0x41, 0x22, 0x61, 0x22, 0x00, 0x20, 0x12, 0xa9, 0x0a, 0x3a, 0xcd, 0xe9,
-  0x0e, 0x68, 0xcd, 0xe9, 0x0c, 0x35, 0xcd, 0xf8, 0x44, 0xb0, 0x06, 0x46,
-  0x88, 0x46, 0x75, 0x46, 0x93, 0x46, 0x0b, 0x91, 0xcd, 0xf8, 0x40, 0xc0,
-  0x03, 0xe0, 0x20, 0x2e, 0x17, 0xd0, 0x04, 0x46, 0x0d, 0x46, 0x29, 0x46,
-  0x3a, 0x46, 0x00, 0x23, 0x20, 0x46, 0x05, 0xf0, 0x21, 0xf8, 0xd2, 0xb2,
-  0x09, 0x2a, 0x02, 0xf1, 0x30, 0x03, 0x88, 0xbf, 0x02, 0xeb, 0x0b, 0x03,
-  0xbc, 0x42, 0xdb, 0xb2, 0x75, 0xf1, 0x00, 0x05, 0x08, 0xf8, 0x01, 0x3b,
-  0x06, 0xf1, 0x01, 0x06, 0xe5, 0xd2, 0x31, 0x46, 0xdd, 0xe9, 0x0c, 0x35,
-  0xdd, 0xe9, 0x10, 0xcb, 0xdd, 0xf8, 0x3c, 0x80, 0x0e, 0x9e, 0x57, 0xe7,
-  0x0a, 0x99, 0x09, 0x68, 0x51, 0xb9, 0x23, 0xf0, 0x10, 0x03, 0x38, 0xb1,
-  0x12, 0xa9, 0x0b, 0x91, 0xcd, 0xe9, 0x05, 0x53, 0xcd, 0xe9, 0x03, 0xc6,
-  0x01, 0x92, 0xcf, 0xe5, 0x13, 0xf0, 0x20, 0x0f, 0x14, 0xbf, 0x41, 0x20,
-  0x61, 0x20, 0x12, 0xac, 0xa6, 0x46, 0x0b, 0x94, 0x0a, 0x93, 0xa0, 0xf1,
-  0x0a, 0x04, 0x0c, 0x95, 0x02, 0xe0, 0x20, 0x2a, 0x12, 0xd0, 0x29, 0x46,
-  0xb1, 0xfb, 0xfc, 0xf5, 0x0c, 0xfb, 0x15, 0x10, 0xc3, 0xb2, 0x09, 0x28,
-  0x03, 0xf1, 0x30, 0x00, 0x8a, 0xbf, 0x1b, 0x19, 0xc3, 0xb2, 0xdb, 0xb2,
-  0x61, 0x45, 0x0e, 0xf8, 0x01, 0x3b, 0x02, 0xf1, 0x01, 0x02, 0xea, 0xd2,
-  0x0a, 0x9b, 0x0c, 0x9d, 0xd4, 0xe7, 0x19, 0x68, 0x81, 0xea, 0xe1, 0x77,
-  0xa7, 0xeb, 0xe1, 0x77, 0x2d, 0xe6, 0x00, 0x2a, 0x3f, 0xf4, 0x59, 0xaf,
-  0x12, 0xaa, 0x0b, 0x92, 0x71, 0xe7, 0x13, 0xf4, 0x80, 0x64, 0x0d, 0xd0,
-  0x13, 0xf0, 0x02, 0x04, 0x12, 0xd0, 0x04, 0x46, 0x46, 0x46, 0xec, 0xe5,
-  0x0a, 0x27, 0x63, 0x46, 0xbc, 0x46, 0x6c, 0xe5, 0x12, 0xab, 0x00, 0x20,
-  0x0b, 0x93, 0x9d, 0xe6, 0x13, 0xf0, 0x02, 0x03, 0x7f, 0xf4, 0xe0, 0xad,
-  0x00, 0x2d, 0x7f, 0xf4, 0x13, 0xaf, 0x9a, 0xe4, 0x00, 0x2d, 0x7f, 0xf4,
-  0x0d, 0xaf, 0x96, 0xe4, 0xcd, 0xcc, 0xcc, 0xcc, 0x84, 0x46, 0x0c, 0xb4,
-  0x10, 0xb5, 0x84, 0xb0, 0x06, 0xac, 0x54, 0xf8, 0x04, 0x3b, 0x0a, 0x46,
-  0x00, 0x94, 0x61, 0x46, 0x04, 0x48, 0x03, 0x94, 0xff, 0xf7, 0x00, 0xfb,
-  0x04, 0xb0, 0xbd, 0xe8, 0x10, 0x40, 0x02, 0xb0, 0x70, 0x47, 0x00, 0xbf,
-  0xc5, 0x1a, 0x00, 0x20, 0x30, 0xb5, 0x94, 0x46, 0x8e, 0x46, 0x05, 0x46,
-  0x1c, 0x46, 0x83, 0xb0, 0x29, 0x46, 0x72, 0x46, 0x63, 0x46, 0x00, 0x94,
-  0x02, 0x48, 0xff, 0xf7, 0xeb, 0xfa, 0x03, 0xb0, 0x30, 0xbd, 0x00, 0xbf,
-  0xc5, 0x1a, 0x00, 0x20, 0x70, 0xb5, 0x94, 0x46, 0x1e, 0x46, 0x05, 0x46,
-  0x0c, 0x46, 0x84, 0xb0, 0x4f, 0xf0, 0xff, 0x32, 0x63, 0x46, 0x02, 0xa9,
-  0x00, 0x96, 0x03, 0x48, 0xcd, 0xe9, 0x02, 0x54, 0xff, 0xf7, 0xd6, 0xfa,
-  0x04, 0xb0, 0x70, 0xbd, 0x49, 0x1d, 0x00, 0x20, 0x10, 0xb5, 0x09, 0x4b,
-  0x84, 0xb0, 0x1c, 0x68, 0x4c, 0xb1, 0x03, 0x46, 0x00, 0x91, 0x4f, 0xf0,
-  0xff, 0x32, 0x03, 0xa9, 0x05, 0x48, 0xa0, 0x47, 0x01, 0x20, 0x04, 0xb0,
-  0x10, 0xbd, 0x00, 0xf0, 0x65, 0xf9, 0x20, 0x46, 0x04, 0xb0, 0x10, 0xbd,
-  0x24, 0xc0, 0x00, 0x20, 0x41, 0x1d, 0x00, 0x20, 0x00, 0xbe, 0xfd, 0xe7,
-  0x08, 0xb5, 0xff, 0xf7, 0xfb, 0xff, 0x00, 0xbf, 0x38, 0xb5, 0x06, 0x4c,
-  0x06, 0x4d, 0xfe, 0xf7, 0xbb, 0xf9, 0xac, 0x42, 0x04, 0xd2, 0x54, 0xf8,
-  0x04, 0x3b, 0x98, 0x47, 0xac, 0x42, 0xfa, 0xd3, 0x38, 0xbd, 0x00, 0xbf,
-  0x28, 0xbe, 0x00, 0x20, 0x30, 0xbe, 0x00, 0x20, 0x03, 0x68, 0x08, 0x46,
-  0x11, 0x46, 0x18, 0x47, 0x2d, 0xe9, 0xf0, 0x41, 0x15, 0x46, 0x42, 0x7d,
-  0x07, 0x46, 0x88, 0x46, 0x00, 0x2a, 0x46, 0xd0, 0x00, 0x2d, 0x1d, 0xdd,
-  0x0b, 0x78, 0x0a, 0x2b, 0x23, 0xd0, 0x01, 0x2d, 0x4f, 0xf0, 0x00, 0x0c,
-  0x18, 0xd0, 0x46, 0x46, 0x01, 0x24, 0x16, 0xf8, 0x01, 0x2f, 0x21, 0x46,
-  0x0a, 0x2a, 0x04, 0xf1, 0x01, 0x04, 0x22, 0xd0, 0xa5, 0x42, 0xf6, 0xd1,
-  0x65, 0x45, 0x0b, 0xdc, 0x08, 0xeb, 0x05, 0x03, 0x13, 0xf8, 0x01, 0x3c,
-  0xa3, 0xf1, 0x0d, 0x03, 0xb3, 0xfa, 0x83, 0xf3, 0x5b, 0x09, 0x3b, 0x75,
-  0xbd, 0xe8, 0xf0, 0x81, 0x3b, 0x68, 0xa5, 0xeb, 0x0c, 0x01, 0x08, 0xeb,
-  0x0c, 0x00, 0x98, 0x47, 0xec, 0xe7, 0x03, 0x7d, 0x00, 0x2b, 0xd8, 0xd1,
-  0x03, 0x68, 0x02, 0x21, 0x0f, 0x48, 0x98, 0x47, 0x01, 0x2d, 0xe3, 0xd0,
-  0x4f, 0xf0, 0x01, 0x0c, 0xd3, 0xe7, 0x16, 0xf8, 0x01, 0x3c, 0x0d, 0x2b,
-  0xd8, 0xd0, 0x8c, 0x45, 0x08, 0xeb, 0x0c, 0x00, 0xa1, 0xeb, 0x0c, 0x01,
-  0x01, 0xda, 0x3b, 0x68, 0x98, 0x47, 0x02, 0x21, 0x05, 0x48, 0x3b, 0x68,
-  0x98, 0x47, 0xa4, 0x46, 0xca, 0xe7, 0x29, 0x46, 0x40, 0x46, 0x3b, 0x68,
-  0xbd, 0xe8, 0xf0, 0x41, 0x18, 0x47, 0x00, 0xbf, 0x00, 0xa4, 0x00, 0x20,
-  0x0b, 0x68, 0x2d, 0xe9, 0xf0, 0x41, 0x80, 0x2b, 0x0d, 0x46, 0x06, 0x46,
-  0x05, 0xd0, 0x5a, 0x1c, 0x2b, 0x44, 0x2a, 0x60, 0x1e, 0x71, 0xbd, 0xe8,
-  0xf0, 0x81, 0x0f, 0x4b, 0x1c, 0x68, 0xa4, 0xb1, 0x0e, 0x4f, 0x01, 0xf1,
-  0x04, 0x08, 0x01, 0xe0, 0x24, 0x69, 0x74, 0xb1, 0x23, 0x68, 0x00, 0x2b,
-  0xfa, 0xd0, 0x3b, 0x68, 0x0b, 0xb1, 0xa3, 0x42, 0xf6, 0xd1, 0x20, 0x46,
-  0x41, 0x46, 0x2a, 0x68, 0xff, 0xf7, 0x86, 0xff, 0x24, 0x69, 0x00, 0x2c,
-  0xf0, 0xd1, 0x00, 0x23, 0x01, 0x22, 0x2b, 0x44, 0x2a, 0x60, 0x1e, 0x71,
-  0xbd, 0xe8, 0xf0, 0x81, 0x18, 0xc0, 0x00, 0x20, 0x1c, 0xc0, 0x00, 0x20,
-  0x2d, 0xe9, 0xf0, 0x47, 0x82, 0xb0, 0x0d, 0x46, 0x91, 0x46, 0x1c, 0x46,
-  0x06, 0x46, 0xfd, 0xf7, 0x69, 0xfe, 0x4f, 0xf0, 0xff, 0x3c, 0x6f, 0xf0,
-  0x00, 0x47, 0x2e, 0x4a, 0x82, 0x18, 0x41, 0xf1, 0x00, 0x03, 0x94, 0x45,
-  0x77, 0xeb, 0x03, 0x01, 0x3c, 0xbf, 0x62, 0x46, 0x3b, 0x46, 0x2a, 0x48,
-  0x06, 0xf0, 0x36, 0xf9, 0x6b, 0x1c, 0x80, 0x46, 0x40, 0xd0, 0x0c, 0xb3,
-  0x27, 0x4f, 0x28, 0x4b, 0x1c, 0x68, 0xb4, 0xb1, 0xb9, 0xf1, 0x00, 0x0f,
-  0x1c, 0xd1, 0xdf, 0xf8, 0x9c, 0x90, 0x01, 0xe0, 0x24, 0x69, 0x74, 0xb1,
-  0x23, 0x68, 0x00, 0x2b, 0xfa, 0xd0, 0xd9, 0xf8, 0x00, 0x30, 0x0b, 0xb1,
-  0x9c, 0x42, 0xf5, 0xd1, 0x20, 0x46, 0x2a, 0x46, 0x31, 0x46, 0xb8, 0x47,
-  0x24, 0x69, 0x00, 0x2c, 0xf0, 0xd1, 0xb8, 0xf1, 0x00, 0x0f, 0x26, 0xd1,
-  0x28, 0x46, 0x02, 0xb0, 0xbd, 0xe8, 0xf0, 0x87, 0x18, 0x4f, 0xdc, 0xe7,
-  0x4f, 0xf0, 0x0a, 0x0a, 0xdf, 0xf8, 0x5c, 0x90, 0x02, 0xe0, 0x24, 0x69,
-  0x00, 0x2c, 0xee, 0xd0, 0x23, 0x68, 0x00, 0x2b, 0xf9, 0xd0, 0xd9, 0xf8,
-  0x00, 0x30, 0x0b, 0xb1, 0xa3, 0x42, 0xf4, 0xd1, 0x2a, 0x46, 0x31, 0x46,
-  0x20, 0x46, 0xb8, 0x47, 0x01, 0x22, 0x20, 0x46, 0x0d, 0xf1, 0x07, 0x01,
-  0x8d, 0xf8, 0x07, 0xa0, 0xb8, 0x47, 0xe8, 0xe7, 0x30, 0x46, 0x05, 0xf0,
-  0xd5, 0xf8, 0x05, 0x46, 0xb9, 0xe7, 0x04, 0x48, 0x06, 0xf0, 0x1e, 0xf9,
-  0x28, 0x46, 0x02, 0xb0, 0xbd, 0xe8, 0xf0, 0x87, 0x40, 0x42, 0x0f, 0x00,
-  0xd0, 0xbd, 0x00, 0x20, 0x51, 0x32, 0x00, 0x20, 0x18, 0xc0, 0x00, 0x20,
-  0x49, 0x32, 0x00, 0x20, 0x1c, 0xc0, 0x00, 0x20, 0x00, 0x20, 0x70, 0x47,
-  0xf0, 0xb5, 0x83, 0xb0, 0x06, 0x46, 0x8d, 0xf8, 0x07, 0x00, 0xfd, 0xf7,
-  0xf3, 0xfd, 0x4f, 0xf0, 0xff, 0x35, 0x6f, 0xf0, 0x00, 0x44, 0x17, 0x4a,
-  0x82, 0x18, 0x41, 0xf1, 0x00, 0x03, 0x95, 0x42, 0x74, 0xeb, 0x03, 0x01,
-  0x3c, 0xbf, 0x23, 0x46, 0x2a, 0x46, 0x13, 0x48, 0x06, 0xf0, 0xc0, 0xf8,
-  0x12, 0x4b, 0x07, 0x46, 0x1c, 0x68, 0x9c, 0xb1, 0x11, 0x4d, 0x01, 0xe0,
-  0x24, 0x69, 0x7c, 0xb1, 0x23, 0x68, 0x00, 0x2b, 0xfa, 0xd0, 0x2b, 0x68,
-  0x0b, 0xb1, 0x9c, 0x42, 0xf6, 0xd1, 0x20, 0x46, 0x01, 0x22, 0x0d, 0xf1,
-  0x07, 0x01, 0xff, 0xf7, 0xd3, 0xfe, 0x24, 0x69, 0x00, 0x2c, 0xef, 0xd1,
-  0x17, 0xb9, 0x30, 0x46, 0x03, 0xb0, 0xf0, 0xbd, 0x03, 0x48, 0x06, 0xf0,
-  0xd5, 0xf8, 0x30, 0x46, 0x03, 0xb0, 0xf0, 0xbd, 0x40, 0x42, 0x0f, 0x00,
-  0xd0, 0xbd, 0x00, 0x20, 0x18, 0xc0, 0x00, 0x20, 0x1c, 0xc0, 0x00, 0x20,
-  0x38, 0xb5, 0x04, 0x46, 0x05, 0xf0, 0x78, 0xf8, 0x01, 0x23, 0x05, 0x46,
-  0x1a, 0x46, 0x20, 0x46, 0x29, 0x46, 0xff, 0xf7, 0x3b, 0xff, 0x08, 0x4b,
-  0x1c, 0x68, 0x2c, 0xb1, 0x63, 0x68, 0x2b, 0xb1, 0x98, 0x47, 0x24, 0x69,
-  0x00, 0x2c, 0xf9, 0xd1, 0x28, 0x46, 0x38, 0xbd, 0x24, 0x69, 0x00, 0x2c,
-  0xf4, 0xd1, 0x28, 0x46, 0x38, 0xbd, 0x00, 0xbf, 0x18, 0xc0, 0x00, 0x20,
-  0x2d, 0xe9, 0xf0, 0x41, 0xa2, 0xb0, 0x04, 0x46, 0x0d, 0x46, 0xfd, 0xf7,
-  0x93, 0xfd, 0x4f, 0xf0, 0xff, 0x37, 0x6f, 0xf0, 0x00, 0x46, 0x26, 0x4a,
-  0xdf, 0xf8, 0xa4, 0x80, 0x82, 0x18, 0x41, 0xf1, 0x00, 0x03, 0x97, 0x42,
-  0x76, 0xeb, 0x03, 0x01, 0x3c, 0xbf, 0x3a, 0x46, 0x33, 0x46, 0x21, 0x48,
-  0x06, 0xf0, 0x5e, 0xf8, 0x00, 0x27, 0x2b, 0x46, 0x22, 0x46, 0x06, 0x46,
-  0x01, 0xa9, 0x1e, 0x48, 0x01, 0x97, 0xff, 0xf7, 0x35, 0xfe, 0x01, 0x9b,
-  0x05, 0x46, 0xd8, 0xf8, 0x00, 0x40, 0xc3, 0xb1, 0x00, 0x2c, 0x2b, 0xd0,
-  0x19, 0x4f, 0x01, 0xe0, 0x24, 0x69, 0x74, 0xb1, 0x23, 0x68, 0x00, 0x2b,
-  0xfa, 0xd0, 0x3b, 0x68, 0x0b, 0xb1, 0xa3, 0x42, 0xf6, 0xd1, 0x20, 0x46,
-  0x01, 0x9a, 0x02, 0xa9, 0xff, 0xf7, 0x66, 0xfe, 0x24, 0x69, 0x00, 0x2c,
-  0xf0, 0xd1, 0x00, 0x23, 0xd8, 0xf8, 0x00, 0x40, 0x01, 0x93, 0x2c, 0xb1,
-  0x63, 0x68, 0x43, 0xb1, 0x98, 0x47, 0x24, 0x69, 0x00, 0x2c, 0xf9, 0xd1,
-  0x2e, 0xb9, 0x28, 0x46, 0x22, 0xb0, 0xbd, 0xe8, 0xf0, 0x81, 0x24, 0x69,
-  0xf1, 0xe7, 0x05, 0x48, 0x06, 0xf0, 0x5a, 0xf8, 0x28, 0x46, 0x22, 0xb0,
-  0xbd, 0xe8, 0xf0, 0x81, 0x01, 0x94, 0xef, 0xe7, 0x40, 0x42, 0x0f, 0x00,
-  0xd0, 0xbd, 0x00, 0x20, 0x01, 0x33, 0x00, 0x20, 0x1c, 0xc0, 0x00, 0x20,
-  0x18, 0xc0, 0x00, 0x20, 0x0f, 0xb4, 0x00, 0xb5, 0x83, 0xb0, 0x04, 0xa9,
-  0x51, 0xf8, 0x04, 0x0b, 0x01, 0x91, 0xff, 0xf7, 0x95, 0xff, 0x03, 0xb0,
-  0x5d, 0xf8, 0x04, 0xeb, 0x04, 0xb0, 0x70, 0x47, 0x38, 0xb5, 0x1f, 0x4d,
-  0x04, 0x46, 0x2a, 0x68, 0x90, 0x42, 0x2b, 0xd0, 0xab, 0x68, 0x98, 0x42,
-  0x08, 0xbf, 0x01, 0x23, 0x27, 0xd0, 0x0a, 0x2c, 0x20, 0xd0, 0x0b, 0x2c,
-  0x13, 0xd0, 0x19, 0x4b, 0x1b, 0x68, 0xa9, 0xb1, 0x19, 0x46, 0x20, 0x46,
-  0xfc, 0xf7, 0x92, 0xff, 0x01, 0x21, 0x20, 0x46, 0xfc, 0xf7, 0x68, 0xff,
-  0x2b, 0x68, 0x9c, 0x42, 0x1b, 0xd0, 0xab, 0x68, 0x9c, 0x42, 0x08, 0xbf,
-  0x01, 0x23, 0x17, 0xd0, 0x38, 0xbd, 0x10, 0x4b, 0x0e, 0x4a, 0x13, 0x60,
-  0x00, 0x29, 0xe9, 0xd1, 0x80, 0x22, 0x19, 0x46, 0x20, 0x46, 0xfc, 0xf7,
-  0xab, 0xff, 0xe7, 0xe7, 0x0b, 0x4b, 0x09, 0x4a, 0x13, 0x60, 0xde, 0xe7,
-  0x00, 0x23, 0x05, 0xeb, 0xc3, 0x03, 0x1b, 0x79, 0x00, 0x2b, 0xd2, 0xd0,
-  0x38, 0xbd, 0x00, 0x23, 0x01, 0x22, 0x05, 0xeb, 0xc3, 0x03, 0x1a, 0x71,
-  0x38, 0xbd, 0x00, 0xbf, 0x7c, 0xbd, 0x00, 0x20, 0x20, 0xc0, 0x00, 0x20,
-  0xf1, 0x96, 0x00, 0x20, 0xa5, 0x96, 0x00, 0x20, 0x40, 0x30, 0x05, 0xf0,
-  0x47, 0xbf, 0x00, 0xbf, 0x40, 0x30, 0x05, 0xf0, 0xed, 0xbf, 0x00, 0xbf,
-  0x38, 0xb5, 0x02, 0x7a, 0x03, 0x46, 0x01, 0x7e, 0x62, 0xb1, 0x4f, 0xf0,
-  0x50, 0x44, 0x01, 0x22, 0xdd, 0x68, 0x64, 0x68, 0xaa, 0x40, 0x22, 0x40,
-  0x00, 0x3a, 0x18, 0xbf, 0x01, 0x22, 0x00, 0x69, 0x82, 0x42, 0x04, 0xd1,
-  0x21, 0xf0, 0x02, 0x01, 0x19, 0x76, 0x01, 0x20, 0x38, 0xbd, 0x00, 0x24,
-  0x41, 0xf0, 0x03, 0x0c, 0x04, 0x4a, 0x5d, 0x21, 0x83, 0xf8, 0x18, 0xc0,
-  0x5c, 0x76, 0x03, 0x48, 0x04, 0xf0, 0x28, 0xfa, 0x20, 0x46, 0x38, 0xbd,
-  0x38, 0x9d, 0x00, 0x20, 0x04, 0xa4, 0x00, 0x20, 0x10, 0xb1, 0x00, 0xf2,
-  0xb1, 0x20, 0x70, 0x47, 0x00, 0x48, 0x70, 0x47, 0x5c, 0xa0, 0x00, 0x20,
-  0x2d, 0xe9, 0xf8, 0x43, 0xdf, 0xf8, 0xcc, 0x90, 0x30, 0x48, 0x05, 0xf0,
-  0x0b, 0xff, 0x99, 0xf8, 0x00, 0x70, 0x00, 0x2f, 0x3d, 0xd1, 0x3d, 0x46,
-  0xfc, 0xf7, 0x66, 0xfd, 0x01, 0x27, 0xa8, 0x42, 0xb8, 0x46, 0x33, 0xd9,
-  0x28, 0x46, 0xfc, 0xf7, 0x61, 0xfd, 0x04, 0x46, 0x48, 0xb3, 0x03, 0x6c,
-  0x00, 0xf1, 0x40, 0x06, 0x00, 0x2b, 0x3e, 0xd0, 0x30, 0x46, 0x05, 0xf0,
-  0xf3, 0xfe, 0x2b, 0x46, 0x04, 0x21, 0x23, 0x4a, 0x84, 0xf8, 0x18, 0x80,
-  0x04, 0xf2, 0xb1, 0x20, 0xff, 0xf7, 0x18, 0xfd, 0x23, 0x7a, 0x5b, 0xb1,
-  0x23, 0x7d, 0x33, 0xb1, 0x61, 0x7d, 0xe0, 0x68, 0x79, 0xb3, 0x00, 0x22,
-  0x01, 0x21, 0xfc, 0xf7, 0x69, 0xfd, 0xe0, 0x68, 0xfc, 0xf7, 0xa8, 0xfd,
-  0x23, 0x78, 0x01, 0x2b, 0x15, 0xd0, 0x02, 0x2b, 0x02, 0xd1, 0x20, 0x46,
-  0x01, 0xf0, 0xac, 0xfe, 0x30, 0x46, 0x05, 0xf0, 0x7b, 0xff, 0xfc, 0xf7,
-  0x31, 0xfd, 0x01, 0x35, 0xa8, 0x42, 0xcb, 0xd8, 0x01, 0x23, 0x89, 0xf8,
-  0x00, 0x30, 0x0e, 0x48, 0x05, 0xf0, 0x70, 0xff, 0x38, 0x46, 0xbd, 0xe8,
-  0xf8, 0x83, 0x20, 0x46, 0x03, 0xf0, 0x2c, 0xff, 0x63, 0x68, 0x18, 0x68,
-  0x01, 0xf0, 0x32, 0xff, 0x07, 0x40, 0x20, 0x46, 0x03, 0xf0, 0xde, 0xfe,
-  0xe2, 0xe7, 0x30, 0x46, 0xfd, 0xf7, 0x90, 0xf8, 0xbc, 0xe7, 0x01, 0x22,
-  0xfc, 0xf7, 0x3a, 0xfd, 0xe0, 0x68, 0xfc, 0xf7, 0x79, 0xfd, 0xcf, 0xe7,
-  0xd8, 0xbd, 0x00, 0x20, 0x50, 0x9d, 0x00, 0x20, 0x66, 0xde, 0x04, 0x20,
-  0x2d, 0xe9, 0xf8, 0x4f, 0x04, 0x46, 0x43, 0x68, 0x4f, 0xf0, 0x80, 0x08,
-  0xd3, 0xf8, 0x6c, 0x22, 0xd3, 0xf8, 0x50, 0x12, 0x98, 0x69, 0x03, 0xf5,
-  0x1c, 0x73, 0x04, 0xf0, 0xcd, 0xfa, 0x4f, 0xf0, 0xff, 0x3c, 0x63, 0x68,
-  0x45, 0x4a, 0x99, 0x69, 0xd3, 0xf8, 0x44, 0x42, 0x01, 0xf1, 0x2f, 0x40,
-  0x00, 0xf5, 0x60, 0x00, 0x05, 0x0d, 0xd3, 0xf8, 0x50, 0x02, 0x02, 0xea,
-  0x44, 0x32, 0x00, 0xeb, 0xc5, 0x05, 0xd3, 0xf8, 0x48, 0x62, 0x42, 0xea,
-  0x45, 0x42, 0x22, 0xf4, 0xf0, 0x32, 0x4f, 0xea, 0x84, 0x1b, 0xd3, 0xe9,
-  0xa2, 0x57, 0x0b, 0xf1, 0xa0, 0x4b, 0x05, 0xeb, 0x47, 0x2a, 0x42, 0xea,
-  0x46, 0x32, 0xd3, 0xe9, 0xa8, 0xe9, 0x42, 0xf0, 0x80, 0x75, 0xcb, 0xf8,
-  0x00, 0xa0, 0x00, 0xf1, 0x04, 0x0a, 0x45, 0xf0, 0x19, 0x05, 0x01, 0xeb,
-  0x8a, 0x0a, 0xcb, 0xf8, 0x04, 0xa0, 0xcb, 0xf8, 0x08, 0x80, 0xcb, 0xf8,
-  0x10, 0x50, 0xb5, 0x01, 0xc3, 0xf8, 0xb0, 0xc2, 0xc3, 0xe9, 0xaa, 0x9e,
-  0xd3, 0xf8, 0x1c, 0xc0, 0x05, 0xf1, 0xa0, 0x45, 0x03, 0xf5, 0x2a, 0x73,
-  0x2b, 0x60, 0x03, 0x23, 0x22, 0xf0, 0x80, 0x72, 0x42, 0xf0, 0x19, 0x02,
-  0xbc, 0xf1, 0x0a, 0x0f, 0xc5, 0xf8, 0x04, 0xa0, 0xab, 0x60, 0x2a, 0x61,
-  0x37, 0xd0, 0xbc, 0xf1, 0x0b, 0x0f, 0x2a, 0xd0, 0x4f, 0xf4, 0x83, 0x66,
-  0x46, 0xf2, 0x20, 0x03, 0x00, 0xeb, 0x40, 0x02, 0x01, 0xeb, 0xc2, 0x02,
-  0x01, 0xeb, 0x80, 0x05, 0x2e, 0x61, 0xc2, 0xf8, 0xd8, 0x30, 0x01, 0x23,
-  0x1f, 0x26, 0x03, 0xfa, 0x04, 0xf4, 0x83, 0x40, 0x46, 0xf2, 0x40, 0x00,
-  0x2e, 0x61, 0xc2, 0xf8, 0xd8, 0x00, 0x4e, 0xf2, 0x0f, 0x00, 0xc2, 0xf8,
-  0xd8, 0x00, 0x4e, 0xf2, 0x8f, 0x00, 0xc2, 0xf8, 0xd8, 0x00, 0x4f, 0xf0,
-  0xa0, 0x42, 0x6f, 0xf0, 0x0f, 0x00, 0x28, 0x61, 0xc2, 0xf8, 0x50, 0x44,
-  0x0a, 0x68, 0x13, 0x43, 0x0b, 0x60, 0xbd, 0xe8, 0xf8, 0x8f, 0x01, 0x23,
-  0x4f, 0xf0, 0xa0, 0x45, 0x09, 0x4a, 0xb3, 0x40, 0xc5, 0xf8, 0x1c, 0x34,
-  0xc2, 0xf8, 0x14, 0x34, 0xca, 0xe7, 0x01, 0x23, 0x4f, 0xf0, 0xa0, 0x45,
-  0x04, 0x4a, 0xb3, 0x40, 0xc5, 0xf8, 0x0c, 0x34, 0xc2, 0xf8, 0x04, 0x34,
-  0xc0, 0xe7, 0x00, 0xbf, 0xfd, 0xff, 0x01, 0xfc, 0x00, 0x20, 0x00, 0x50,
-  0x01, 0x23, 0xf0, 0xb5, 0x4f, 0xf0, 0xa0, 0x46, 0x04, 0x46, 0x45, 0x68,
-  0x83, 0xb0, 0xd5, 0xf8, 0x44, 0x22, 0x93, 0x40, 0x92, 0x01, 0xc6, 0xf8,
-  0x64, 0x34, 0x32, 0x44, 0xd3, 0x68, 0x59, 0x01, 0xfc, 0xd4, 0x01, 0x21,
-  0xd5, 0xf8, 0x48, 0x32, 0x9a, 0x01, 0x99, 0x40, 0x02, 0xf1, 0xa0, 0x42,
-  0xc6, 0xf8, 0x64, 0x14, 0xd3, 0x68, 0x5b, 0x01, 0xfc, 0xd4, 0xeb, 0x69,
-  0x0a, 0x2b, 0x19, 0xd0, 0x0b, 0x2b, 0x13, 0xd0, 0xd5, 0xf8, 0x50, 0x12,
-  0xa8, 0x69, 0xaa, 0x68, 0x01, 0x25, 0x00, 0x27, 0x06, 0x68, 0x8d, 0x40,
-  0x26, 0xea, 0x05, 0x06, 0x06, 0x60, 0x04, 0x23, 0x00, 0x97, 0x04, 0xf0,
-  0xc3, 0xf9, 0x63, 0x68, 0x83, 0xf8, 0x80, 0x72, 0x03, 0xb0, 0xf0, 0xbd,
-  0x03, 0x4b, 0xc3, 0xf8, 0x14, 0x14, 0xe7, 0xe7, 0x01, 0x4b, 0xc3, 0xf8,
-  0x04, 0x14, 0xe3, 0xe7, 0x00, 0x30, 0x00, 0x50, 0x09, 0x04, 0x41, 0xea,
-  0x12, 0x41, 0x12, 0x04, 0x70, 0xb4, 0x42, 0xf4, 0x80, 0x72, 0x41, 0xf0,
-  0x3d, 0x54, 0x0b, 0xb1, 0x01, 0x3b, 0x1a, 0x43, 0x4f, 0xf0, 0x00, 0x46,
-  0x13, 0x4b, 0xc4, 0xf3, 0x07, 0x45, 0x5d, 0x5d, 0xc4, 0xf3, 0x07, 0x2c,
-  0x85, 0xea, 0x0c, 0x05, 0x5d, 0x5d, 0xc9, 0xb2, 0x69, 0x40, 0x59, 0x5c,
-  0xd0, 0xf8, 0x4c, 0x52, 0x81, 0xea, 0x12, 0x61, 0x13, 0xf8, 0x01, 0xc0,
-  0x81, 0x69, 0xc2, 0xf3, 0x07, 0x40, 0x80, 0xea, 0x0c, 0x00, 0x1b, 0x5c,
-  0x42, 0xea, 0x03, 0x22, 0x05, 0xeb, 0x45, 0x03, 0x01, 0xeb, 0xc3, 0x03,
-  0x03, 0xf5, 0x86, 0x53, 0x01, 0xeb, 0x85, 0x01, 0x1e, 0x61, 0x1e, 0x61,
-  0x0c, 0x61, 0x0a, 0x61, 0x70, 0xbc, 0x70, 0x47, 0x78, 0xa4, 0x00, 0x20,
-  0x8b, 0x00, 0x00, 0xeb, 0x81, 0x01, 0x88, 0x42, 0x48, 0xd2, 0x02, 0x46,
-  0x00, 0x20, 0x01, 0x46, 0x10, 0xb5, 0x03, 0xf1, 0xff, 0x3c, 0x2c, 0xf0,
-  0x0f, 0x0c, 0x02, 0xf1, 0x20, 0x03, 0x9c, 0x44, 0x10, 0x32, 0x52, 0xe9,
-  0x04, 0x43, 0x94, 0xfa, 0x84, 0xfe, 0x8e, 0xea, 0x1e, 0x4e, 0x8e, 0xea,
-  0x01, 0x0e, 0x8e, 0xea, 0x11, 0x4e, 0x80, 0xea, 0x1e, 0x30, 0x1b, 0xba,
-  0x80, 0xea, 0x0e, 0x40, 0x83, 0xea, 0x13, 0x43, 0x52, 0xf8, 0x08, 0x1c,
-  0x43, 0x40, 0x83, 0xea, 0x10, 0x43, 0x8e, 0xea, 0x0e, 0x5e, 0x8e, 0xea,
-  0x13, 0x3e, 0x09, 0xba, 0x8e, 0xea, 0x03, 0x4e, 0x81, 0xea, 0x11, 0x41,
-  0x52, 0xf8, 0x04, 0x0c, 0x81, 0xea, 0x0e, 0x01, 0x81, 0xea, 0x1e, 0x41,
-  0x83, 0xea, 0x03, 0x53, 0x83, 0xea, 0x11, 0x33, 0x00, 0xba, 0x83, 0xea,
-  0x01, 0x43, 0x80, 0xea, 0x10, 0x40, 0x58, 0x40, 0x80, 0xea, 0x13, 0x43,
-  0x81, 0xea, 0x01, 0x51, 0x10, 0x32, 0x81, 0xea, 0x13, 0x31, 0x94, 0x45,
-  0x83, 0xea, 0x03, 0x50, 0x81, 0xea, 0x03, 0x41, 0xc3, 0xd1, 0x10, 0xbd,
-  0x00, 0x20, 0x01, 0x46, 0x70, 0x47, 0x00, 0xbf, 0x2d, 0xe9, 0xf0, 0x43,
-  0xb3, 0xf1, 0x00, 0x08, 0x04, 0x46, 0x14, 0xbf, 0x30, 0x23, 0x00, 0x23,
-  0x40, 0x68, 0x83, 0xb0, 0x89, 0x46, 0xff, 0xf7, 0x69, 0xff, 0xfd, 0xf7,
-  0xc3, 0xfa, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x04, 0xf0, 0xfe, 0xfa,
-  0xb8, 0xf1, 0x00, 0x0f, 0x05, 0x46, 0x0c, 0xbf, 0x01, 0x26, 0x02, 0x26,
-  0x3f, 0x4f, 0x0a, 0xe0, 0xfd, 0xf7, 0xb4, 0xfa, 0x00, 0x23, 0x4f, 0xf4,
-  0x7a, 0x72, 0x04, 0xf0, 0xef, 0xfa, 0xfb, 0x69, 0x40, 0x1b, 0x98, 0x42,
-  0x35, 0xd8, 0x63, 0x68, 0x98, 0x69, 0xd3, 0xf8, 0x4c, 0x12, 0xc2, 0x68,
-  0xcb, 0x00, 0x04, 0x33, 0xda, 0x40, 0x02, 0xf0, 0x0f, 0x02, 0x96, 0x42,
-  0xe8, 0xd8, 0xb8, 0xf1, 0x00, 0x0f, 0x4a, 0xd0, 0x00, 0xeb, 0x81, 0x01,
-  0x0a, 0x6a, 0x31, 0x4b, 0x15, 0x0e, 0x5c, 0x5d, 0xc2, 0xf3, 0x07, 0x40,
-  0x60, 0x40, 0x1c, 0x5c, 0xc2, 0xf3, 0x07, 0x20, 0x60, 0x40, 0x18, 0x5c,
-  0xd4, 0xb2, 0x09, 0x6a, 0x60, 0x40, 0x18, 0x5c, 0xc1, 0xf3, 0x07, 0x24,
-  0x60, 0x40, 0x1e, 0x5c, 0x01, 0xf0, 0xfe, 0x00, 0x86, 0x42, 0x34, 0xd1,
-  0xa9, 0x45, 0x02, 0xd0, 0xb9, 0xf1, 0x29, 0x0f, 0x39, 0xd1, 0x44, 0xea,
-  0x02, 0x24, 0xc8, 0xf8, 0x00, 0x40, 0x00, 0x20, 0x03, 0xb0, 0xbd, 0xe8,
-  0xf0, 0x83, 0xb9, 0xf1, 0x08, 0x0f, 0x07, 0xd0, 0x1e, 0x4b, 0xba, 0x21,
-  0x18, 0x46, 0x1e, 0x4a, 0xcd, 0xf8, 0x00, 0x90, 0x03, 0xf0, 0xda, 0xff,
-  0x64, 0x68, 0x4f, 0xf0, 0x00, 0x45, 0xd4, 0xf8, 0x4c, 0x22, 0xa1, 0x69,
-  0x02, 0xeb, 0x42, 0x02, 0x01, 0xeb, 0xc2, 0x03, 0x19, 0x46, 0x02, 0x20,
-  0x03, 0xf5, 0x86, 0x53, 0x1d, 0x61, 0x1d, 0x61, 0xd4, 0xf8, 0x54, 0x32,
-  0x03, 0xf0, 0x1f, 0x03, 0xc1, 0xf8, 0xd8, 0x30, 0x03, 0xb0, 0xbd, 0xe8,
-  0xf0, 0x83, 0x08, 0x31, 0x50, 0xf8, 0x21, 0x30, 0xd3, 0xe7, 0x01, 0x90,
-  0x4b, 0x46, 0xd7, 0x21, 0x0c, 0x4a, 0x0a, 0x48, 0x00, 0x96, 0x03, 0xf0,
-  0xb5, 0xff, 0x03, 0x20, 0xca, 0xe7, 0xdf, 0x23, 0xcd, 0xe9, 0x00, 0x95,
-  0x19, 0x46, 0x08, 0x4a, 0x04, 0x48, 0x03, 0xf0, 0xab, 0xff, 0x04, 0x20,
-  0xc0, 0xe7, 0x00, 0xbf, 0x8c, 0xbd, 0x00, 0x20, 0x78, 0xa4, 0x00, 0x20,
-  0x44, 0xa4, 0x00, 0x20, 0xe0, 0x9d, 0x00, 0x20, 0x24, 0x9e, 0x00, 0x20,
-  0x70, 0x9e, 0x00, 0x20, 0x2d, 0xe9, 0xf0, 0x4f, 0x4f, 0xf0, 0x00, 0x4a,
-  0x04, 0x46, 0x40, 0x68, 0x87, 0xb0, 0xd0, 0xf8, 0x4c, 0x62, 0x87, 0x69,
-  0x06, 0xeb, 0x46, 0x0e, 0x07, 0xeb, 0xce, 0x0e, 0x0e, 0xf5, 0x86, 0x5e,
-  0xd0, 0xf8, 0x44, 0xc2, 0xce, 0xf8, 0x10, 0xa0, 0xce, 0xf8, 0x10, 0xa0,
-  0x06, 0xf1, 0x04, 0x0e, 0x08, 0x36, 0x07, 0xf1, 0x2f, 0x48, 0x07, 0xeb,
-  0x86, 0x07, 0x05, 0x26, 0x73, 0x4d, 0x08, 0xf5, 0x60, 0x08, 0x4f, 0xea,
-  0x18, 0x58, 0x0e, 0xeb, 0xc8, 0x0e, 0x05, 0xea, 0x4c, 0x35, 0x45, 0xea,
-  0x4e, 0x45, 0x4f, 0xea, 0x8c, 0x1c, 0x0c, 0xf1, 0xa0, 0x4c, 0x0d, 0xf1,
-  0x04, 0x0b, 0x45, 0xf0, 0x49, 0x05, 0xcc, 0xf8, 0x00, 0x70, 0x99, 0x46,
-  0xcc, 0xf8, 0x04, 0xb0, 0x88, 0x23, 0xcc, 0xf8, 0x08, 0x60, 0xcc, 0xf8,
-  0x0c, 0x50, 0xff, 0xf7, 0x93, 0xfe, 0xfd, 0xf7, 0xed, 0xf9, 0x4f, 0xf4,
-  0x7a, 0x72, 0x00, 0x23, 0x04, 0xf0, 0x28, 0xfa, 0x4f, 0xf0, 0xa0, 0x47,
-  0x05, 0x46, 0x60, 0x4e, 0x0b, 0xe0, 0xfd, 0xf7, 0xe1, 0xf9, 0x00, 0x23,
-  0x4f, 0xf4, 0x7a, 0x72, 0x04, 0xf0, 0x1c, 0xfa, 0x33, 0x6a, 0x40, 0x1b,
-  0x98, 0x42, 0x00, 0xf2, 0x88, 0x80, 0x63, 0x68, 0xd3, 0xf8, 0x44, 0x22,
-  0x93, 0x01, 0x03, 0xf1, 0xa0, 0x43, 0x19, 0x69, 0x49, 0x01, 0xea, 0xd4,
-  0x01, 0x21, 0x01, 0xfa, 0x02, 0xf2, 0xc7, 0xf8, 0x64, 0x24, 0xda, 0x68,
-  0x12, 0xf0, 0x80, 0x62, 0xfb, 0xd1, 0x14, 0x46, 0x01, 0x99, 0x50, 0x4b,
-  0x4f, 0xea, 0x11, 0x4c, 0x5f, 0xfa, 0x8c, 0xf0, 0x18, 0x5c, 0xc1, 0xf3,
-  0x07, 0x27, 0x78, 0x40, 0x18, 0x5c, 0xce, 0xb2, 0x70, 0x40, 0x1d, 0x5c,
-  0x6c, 0xf3, 0x07, 0x04, 0x02, 0x98, 0x67, 0xf3, 0x0f, 0x24, 0x66, 0xf3,
-  0x17, 0x44, 0x06, 0x0e, 0x75, 0x40, 0x66, 0xf3, 0x1f, 0x64, 0x16, 0x46,
-  0xc9, 0xf8, 0x00, 0x40, 0x5c, 0x5d, 0x15, 0x46, 0xc0, 0xf3, 0x07, 0x47,
-  0x7c, 0x40, 0x1c, 0x5d, 0x67, 0xf3, 0x07, 0x02, 0xc0, 0xf3, 0x07, 0x27,
-  0x7c, 0x40, 0x1c, 0x5d, 0xc0, 0xb2, 0x44, 0x40, 0x67, 0xf3, 0x0f, 0x22,
-  0x1f, 0x5d, 0x60, 0xf3, 0x17, 0x42, 0xdd, 0xe9, 0x03, 0x40, 0x4f, 0xea,
-  0x14, 0x6c, 0x8c, 0xea, 0x07, 0x07, 0x6c, 0xf3, 0x1f, 0x62, 0xc9, 0xf8,
-  0x04, 0x20, 0xda, 0x5d, 0xc4, 0xf3, 0x07, 0x47, 0x7a, 0x40, 0x9a, 0x5c,
-  0x67, 0xf3, 0x07, 0x06, 0xc4, 0xf3, 0x07, 0x27, 0x7a, 0x40, 0x9a, 0x5c,
-  0xe4, 0xb2, 0x62, 0x40, 0x9a, 0x5c, 0x67, 0xf3, 0x0f, 0x26, 0x64, 0xf3,
-  0x17, 0x46, 0x04, 0x0e, 0x62, 0x40, 0x9a, 0x5c, 0x64, 0xf3, 0x1f, 0x66,
-  0xc0, 0xf3, 0x07, 0x44, 0x62, 0x40, 0x9a, 0x5c, 0x64, 0xf3, 0x07, 0x05,
-  0xc0, 0xf3, 0x07, 0x24, 0x62, 0x40, 0x9a, 0x5c, 0xc0, 0xb2, 0x42, 0x40,
-  0x9a, 0x5c, 0x64, 0xf3, 0x0f, 0x25, 0x9d, 0xf8, 0x14, 0x30, 0x60, 0xf3,
-  0x17, 0x45, 0x63, 0xf3, 0x1f, 0x65, 0x03, 0xf0, 0xfe, 0x03, 0x9a, 0x42,
-  0xc9, 0xf8, 0x08, 0x60, 0xc9, 0xf8, 0x0c, 0x50, 0x2c, 0xd1, 0x08, 0x0e,
-  0x3f, 0x38, 0x18, 0xbf, 0x01, 0x20, 0x80, 0x00, 0x07, 0xb0, 0xbd, 0xe8,
-  0xf0, 0x8f, 0x01, 0x23, 0x64, 0x68, 0xd4, 0xf8, 0x44, 0x12, 0x8a, 0x01,
-  0x8b, 0x40, 0x02, 0xf1, 0xa0, 0x42, 0xc7, 0xf8, 0x64, 0x34, 0xd3, 0x68,
-  0x58, 0x01, 0xfc, 0xd4, 0xd4, 0xf8, 0x4c, 0x22, 0x4f, 0xf0, 0x00, 0x45,
-  0xa1, 0x69, 0x02, 0xeb, 0x42, 0x02, 0x01, 0xeb, 0xc2, 0x03, 0x19, 0x46,
-  0x02, 0x20, 0x03, 0xf5, 0x86, 0x53, 0x1d, 0x61, 0x1d, 0x61, 0xd4, 0xf8,
-  0x54, 0x32, 0x03, 0xf0, 0x1f, 0x03, 0xc1, 0xf8, 0xd8, 0x30, 0x07, 0xb0,
-  0xbd, 0xe8, 0xf0, 0x8f, 0x03, 0x20, 0x07, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f,
-  0xfd, 0xff, 0x01, 0xfc, 0x8c, 0xbd, 0x00, 0x20, 0x78, 0xa4, 0x00, 0x20,
-  0xf8, 0xb5, 0x1f, 0x46, 0x04, 0x46, 0x30, 0x23, 0x40, 0x68, 0xff, 0xf7,
-  0xbd, 0xfd, 0xfd, 0xf7, 0x17, 0xf9, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23,
-  0x04, 0xf0, 0x52, 0xf9, 0x1e, 0x4e, 0x05, 0x46, 0x0a, 0xe0, 0xfd, 0xf7,
-  0x0d, 0xf9, 0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72, 0x04, 0xf0, 0x48, 0xf9,
-  0x73, 0x6a, 0x40, 0x1b, 0x98, 0x42, 0x16, 0xd8, 0x63, 0x68, 0x98, 0x69,
-  0xd3, 0xf8, 0x4c, 0x32, 0xc2, 0x68, 0xd9, 0x00, 0x04, 0x31, 0xca, 0x40,
-  0x12, 0xf0, 0x0e, 0x0f, 0xe9, 0xd0, 0x00, 0x24, 0x00, 0xeb, 0x83, 0x03,
-  0x1a, 0x6a, 0x1b, 0x6a, 0x20, 0x46, 0xc3, 0xf3, 0x07, 0x23, 0x43, 0xea,
-  0x02, 0x23, 0x3b, 0x60, 0xf8, 0xbd, 0x60, 0x68, 0x4f, 0xf0, 0x00, 0x45,
-  0xd0, 0xf8, 0x4c, 0x22, 0x81, 0x69, 0x02, 0xeb, 0x42, 0x02, 0x01, 0xeb,
-  0xc2, 0x03, 0x19, 0x46, 0x02, 0x24, 0x03, 0xf5, 0x86, 0x53, 0x1d, 0x61,
-  0x1d, 0x61, 0xd0, 0xf8, 0x54, 0x32, 0x20, 0x46, 0x03, 0xf0, 0x1f, 0x03,
-  0xc1, 0xf8, 0xd8, 0x30, 0xf8, 0xbd, 0x00, 0xbf, 0x8c, 0xbd, 0x00, 0x20,
-  0x4f, 0xf0, 0x01, 0x0c, 0x2d, 0xe9, 0xf0, 0x4f, 0x45, 0x68, 0x83, 0xb0,
-  0x07, 0x46, 0x0e, 0x46, 0x90, 0x46, 0x1c, 0x46, 0x85, 0xf8, 0x80, 0xc2,
-  0xfd, 0xf7, 0xc4, 0xf8, 0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72, 0x04, 0xf0,
-  0xff, 0xf8, 0x00, 0x23, 0xc5, 0xf8, 0x84, 0x02, 0x7d, 0x68, 0xc5, 0xe9,
-  0xa3, 0x38, 0xc5, 0xe9, 0xa5, 0x33, 0xc5, 0xf8, 0x88, 0x62, 0xb8, 0xf1,
-  0x00, 0x0f, 0x17, 0xd0, 0x41, 0xf2, 0xc4, 0x20, 0x4f, 0xf0, 0x02, 0x0c,
-  0x2b, 0x46, 0x00, 0xeb, 0xc8, 0x02, 0x31, 0x46, 0x28, 0x44, 0x24, 0xfa,
-  0x0c, 0xf6, 0x2a, 0x44, 0xc3, 0xf8, 0xcc, 0x02, 0x08, 0x30, 0x82, 0x42,
-  0xc3, 0xe9, 0xb1, 0x16, 0xc3, 0xf8, 0xd0, 0xc2, 0x21, 0x44, 0x03, 0xf1,
-  0x10, 0x03, 0xf3, 0xd1, 0x00, 0x26, 0x05, 0xeb, 0x08, 0x12, 0xc2, 0xe9,
-  0xb1, 0x66, 0xa8, 0x69, 0xd5, 0xf8, 0x50, 0x12, 0x00, 0xf1, 0x2f, 0x42,
-  0xd5, 0xf8, 0x44, 0xe2, 0xdf, 0xf8, 0xec, 0xb0, 0x02, 0xf5, 0x60, 0x02,
-  0x01, 0xf1, 0x04, 0x0c, 0x12, 0x0d, 0x0c, 0xeb, 0xc2, 0x0c, 0x0b, 0xea,
-  0x4e, 0x3b, 0x4b, 0xea, 0x4c, 0x4b, 0xd5, 0xf8, 0x48, 0xc2, 0x4f, 0xea,
-  0x8e, 0x1e, 0x2b, 0xf4, 0xf0, 0x3b, 0xd5, 0xf8, 0x58, 0x22, 0x05, 0xf5,
-  0x31, 0x7a, 0x05, 0xf5, 0x17, 0x73, 0x4b, 0xea, 0x4c, 0x35, 0x0e, 0xf1,
-  0xa0, 0x4b, 0xde, 0x46, 0xdf, 0xf8, 0xb4, 0x90, 0xdf, 0xf8, 0xb4, 0x80,
-  0x09, 0xea, 0x4c, 0x39, 0x49, 0xea, 0x08, 0x08, 0x45, 0xf0, 0x80, 0x75,
-  0x01, 0xf1, 0x08, 0x09, 0x00, 0xeb, 0x89, 0x09, 0x45, 0xf0, 0x49, 0x05,
-  0xcb, 0xf8, 0x00, 0x90, 0xce, 0xf8, 0x04, 0x60, 0xce, 0xf8, 0x08, 0x60,
-  0xce, 0xf8, 0x10, 0x50, 0x02, 0x25, 0x4f, 0xea, 0x8c, 0x1c, 0x0c, 0xf1,
-  0xa0, 0x4c, 0x0b, 0xf1, 0x18, 0x0b, 0xcc, 0xf8, 0x00, 0xa0, 0xcc, 0xf8,
-  0x04, 0xb0, 0xcc, 0xf8, 0x08, 0x50, 0xcc, 0xf8, 0x10, 0x80, 0x03, 0xf0,
-  0xe5, 0xfe, 0x78, 0x68, 0x04, 0x23, 0x82, 0x68, 0xd0, 0xf8, 0x50, 0x12,
-  0x80, 0x69, 0x00, 0x96, 0x03, 0xf0, 0x96, 0xfe, 0x01, 0x23, 0x46, 0xf2,
-  0x40, 0x0e, 0x4f, 0xf0, 0xa0, 0x4c, 0x79, 0x68, 0x9c, 0x40, 0xd1, 0xf8,
-  0x50, 0x22, 0x88, 0x69, 0xd1, 0xf8, 0x48, 0x52, 0x02, 0xeb, 0x42, 0x01,
-  0x00, 0xeb, 0xc1, 0x01, 0x03, 0xfa, 0x05, 0xf5, 0x0f, 0x34, 0x93, 0x40,
-  0x04, 0x32, 0x40, 0xf8, 0x22, 0x40, 0xc1, 0xf8, 0xd8, 0xe0, 0xd1, 0xf8,
-  0xd0, 0x20, 0x42, 0xf0, 0x00, 0x42, 0xc1, 0xf8, 0xd0, 0x20, 0xcc, 0xf8,
-  0x50, 0x54, 0x02, 0x68, 0x13, 0x43, 0x03, 0x60, 0x30, 0x46, 0x03, 0xb0,
-  0xbd, 0xe8, 0xf0, 0x8f, 0xfd, 0xff, 0x01, 0xfc, 0xfd, 0xff, 0x7f, 0xfc,
-  0x59, 0x13, 0x7e, 0x00, 0x2d, 0xe9, 0xf0, 0x43, 0x44, 0x68, 0x80, 0x46,
-  0xd4, 0xe9, 0xa3, 0x97, 0xb9, 0x45, 0x0e, 0x46, 0x85, 0xb0, 0x3e, 0xd3,
-  0x00, 0x23, 0x84, 0xf8, 0x80, 0x32, 0xd4, 0xf8, 0x94, 0x52, 0x4d, 0x45,
-  0x38, 0xbf, 0x07, 0xf1, 0xff, 0x37, 0x31, 0xd3, 0xd4, 0xf8, 0x98, 0x32,
-  0x00, 0x2b, 0x14, 0xbf, 0x06, 0x20, 0x00, 0x20, 0x05, 0xb0, 0xbd, 0xe8,
-  0xf0, 0x83, 0x05, 0xfb, 0x06, 0xf0, 0xd4, 0xf8, 0x88, 0x32, 0x6a, 0x1c,
-  0xc4, 0xf8, 0x94, 0x22, 0x03, 0xeb, 0x80, 0x00, 0x31, 0x46, 0xff, 0xf7,
-  0xc3, 0xfc, 0x04, 0xeb, 0xc5, 0x03, 0x03, 0xf5, 0x80, 0x53, 0xd3, 0xe9,
-  0xb1, 0x23, 0x12, 0xba, 0x93, 0xfa, 0x83, 0xfc, 0x91, 0x42, 0x08, 0xbf,
-  0x60, 0x45, 0x06, 0xd0, 0xd4, 0xf8, 0x98, 0x32, 0x01, 0x33, 0x01, 0x2b,
-  0xc4, 0xf8, 0x98, 0x32, 0x65, 0xd0, 0xd8, 0xf8, 0x04, 0x40, 0x01, 0x3f,
-  0xd4, 0xf8, 0x94, 0x52, 0xd4, 0xf8, 0x8c, 0x32, 0x9d, 0x42, 0xcd, 0xd2,
-  0x7b, 0x1c, 0xd4, 0xd1, 0xca, 0xe7, 0xd4, 0xf8, 0x94, 0x52, 0xa9, 0x45,
-  0x88, 0xbf, 0x04, 0x27, 0x25, 0xd9, 0x05, 0xfb, 0x06, 0xf0, 0xd4, 0xf8,
-  0x88, 0x32, 0x6a, 0x1c, 0xc4, 0xf8, 0x94, 0x22, 0x03, 0xeb, 0x80, 0x00,
-  0x31, 0x46, 0xff, 0xf7, 0x91, 0xfc, 0x04, 0xeb, 0xc5, 0x03, 0x03, 0xf5,
-  0x80, 0x53, 0xd3, 0xe9, 0xb1, 0x23, 0x12, 0xba, 0x93, 0xfa, 0x83, 0xfc,
-  0x91, 0x42, 0x08, 0xbf, 0x60, 0x45, 0x06, 0xd0, 0xd4, 0xf8, 0x98, 0x32,
-  0x01, 0x33, 0x01, 0x2b, 0xc4, 0xf8, 0x98, 0x32, 0x45, 0xd0, 0xd4, 0xf8,
-  0x94, 0x52, 0x4d, 0x45, 0x01, 0xd2, 0x01, 0x3f, 0xd9, 0xd1, 0xd4, 0xf8,
-  0x48, 0x32, 0x04, 0xf5, 0x31, 0x72, 0x9b, 0x01, 0x03, 0xf1, 0xa0, 0x43,
-  0x1b, 0x68, 0xa3, 0xeb, 0x02, 0x09, 0x4f, 0xea, 0xd9, 0x09, 0x09, 0xf1,
-  0xff, 0x39, 0x94, 0xf8, 0x80, 0x32, 0x4f, 0xea, 0x59, 0x09, 0xc4, 0xf8,
-  0x8c, 0x92, 0x00, 0x2b, 0x3f, 0xd0, 0xfc, 0xf7, 0x83, 0xff, 0x4f, 0xf4,
-  0x7a, 0x72, 0x00, 0x23, 0x03, 0xf0, 0xbe, 0xff, 0xd8, 0xf8, 0x04, 0x20,
-  0x1c, 0x4b, 0xd2, 0xf8, 0x84, 0x22, 0x9b, 0x6a, 0x80, 0x1a, 0x98, 0x42,
-  0x38, 0xbf, 0x01, 0x20, 0xff, 0xf4, 0x7c, 0xaf, 0x40, 0x46, 0xff, 0xf7,
-  0xd3, 0xfb, 0x05, 0x20, 0x76, 0xe7, 0xcd, 0xe9, 0x02, 0xc2, 0x00, 0x90,
-  0x01, 0x91, 0x2b, 0x46, 0x40, 0xf2, 0xb1, 0x11, 0x12, 0x4a, 0x13, 0x48,
-  0x03, 0xf0, 0xd2, 0xfc, 0x00, 0x2e, 0x8c, 0xd0, 0x00, 0x23, 0x10, 0x33,
-  0x9e, 0x42, 0xfc, 0xd8, 0x87, 0xe7, 0xcd, 0xe9, 0x02, 0xc2, 0x00, 0x90,
-  0x01, 0x91, 0x2b, 0x46, 0x40, 0xf2, 0xb1, 0x11, 0x09, 0x4a, 0x0a, 0x48,
-  0x03, 0xf0, 0xc0, 0xfc, 0xd8, 0xf8, 0x04, 0x40, 0xd4, 0xf8, 0x8c, 0x92,
-  0x00, 0x2e, 0xa8, 0xd0, 0x00, 0x23, 0x10, 0x33, 0x9e, 0x42, 0xfc, 0xd8,
-  0xa3, 0xe7, 0xd4, 0xf8, 0x90, 0x72, 0x3e, 0xe7, 0x8c, 0xbd, 0x00, 0x20,
-  0xa8, 0x9e, 0x00, 0x20, 0x28, 0xa4, 0x00, 0x20, 0xf8, 0xb5, 0x02, 0x23,
-  0x45, 0x68, 0x04, 0x46, 0x0e, 0x46, 0x17, 0x46, 0x85, 0xf8, 0x80, 0x32,
-  0xfc, 0xf7, 0x32, 0xff, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x03, 0xf0,
-  0x6d, 0xff, 0x00, 0x23, 0x01, 0x22, 0xc5, 0xf8, 0x84, 0x02, 0x65, 0x68,
-  0x30, 0x46, 0xc5, 0xf8, 0x94, 0x22, 0xc5, 0xf8, 0x8c, 0x32, 0xc5, 0xf8,
-  0x98, 0x32, 0x80, 0x21, 0xc5, 0xf8, 0x90, 0x72, 0xc5, 0xf8, 0x88, 0x62,
-  0xff, 0xf7, 0xf6, 0xfb, 0xc5, 0xe9, 0xa8, 0x01, 0x20, 0x46, 0xff, 0xf7,
-  0xd7, 0xfa, 0x64, 0x68, 0xd4, 0xe9, 0xa4, 0x23, 0x93, 0x42, 0x01, 0xd3,
-  0x00, 0x20, 0xf8, 0xbd, 0xd4, 0xf8, 0x88, 0x02, 0x5a, 0x1c, 0xc4, 0xf8,
-  0x94, 0x22, 0x00, 0xeb, 0x43, 0x20, 0x80, 0x21, 0xff, 0xf7, 0xe0, 0xfb,
-  0xc4, 0xe9, 0xa8, 0x01, 0x00, 0x20, 0xf8, 0xbd, 0x38, 0xb5, 0x1b, 0x4b,
-  0x04, 0x46, 0x5b, 0x68, 0x0d, 0x46, 0xc3, 0xf3, 0x08, 0x03, 0x0b, 0xbb,
-  0x62, 0x68, 0x1d, 0xb1, 0xd2, 0xf8, 0x8c, 0x32, 0x5b, 0x02, 0x2b, 0x60,
-  0x92, 0xf8, 0x80, 0x32, 0x8b, 0xb1, 0xfc, 0xf7, 0xed, 0xfe, 0x4f, 0xf4,
-  0x7a, 0x72, 0x00, 0x23, 0x03, 0xf0, 0x28, 0xff, 0x62, 0x68, 0x10, 0x4b,
-  0xd2, 0xf8, 0x84, 0x22, 0xdb, 0x6a, 0x80, 0x1a, 0x98, 0x42, 0x38, 0xbf,
-  0x01, 0x20, 0x0a, 0xd2, 0x38, 0xbd, 0x20, 0x46, 0xff, 0xf7, 0x3e, 0xfb,
-  0x63, 0x68, 0x93, 0xf8, 0xb4, 0x02, 0x38, 0xbd, 0x05, 0xf0, 0x50, 0xfa,
-  0xda, 0xe7, 0x4f, 0xf4, 0x32, 0x71, 0x06, 0x4a, 0x06, 0x48, 0x03, 0xf0,
-  0x3d, 0xfc, 0x20, 0x46, 0xff, 0xf7, 0x2e, 0xfb, 0x05, 0x20, 0x38, 0xbd,
-  0x00, 0xed, 0x00, 0xe0, 0x8c, 0xbd, 0x00, 0x20, 0xf8, 0x9e, 0x00, 0x20,
-  0x14, 0xa4, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xe9, 0xf0, 0x4f,
-  0x2d, 0xed, 0x02, 0x8b, 0x45, 0x68, 0x04, 0x46, 0x95, 0xf8, 0x30, 0x30,
-  0x08, 0xee, 0x10, 0x1a, 0x91, 0xb0, 0x5b, 0xbb, 0xa8, 0x69, 0x00, 0x28,
-  0x00, 0xf0, 0xcb, 0x81, 0xeb, 0x69, 0x00, 0x2b, 0x00, 0xf0, 0x9b, 0x81,
-  0x01, 0x21, 0x03, 0xf0, 0x4f, 0xfc, 0x66, 0x68, 0x01, 0x21, 0xc5, 0xf8,
-  0x4c, 0x02, 0xb0, 0x69, 0x03, 0xf0, 0x48, 0xfc, 0x03, 0x46, 0x65, 0x68,
-  0x01, 0x20, 0xc6, 0xf8, 0x50, 0x32, 0x03, 0xf0, 0x31, 0xfc, 0x03, 0x46,
-  0x01, 0x20, 0xc5, 0xf8, 0x44, 0x32, 0x65, 0x68, 0x03, 0xf0, 0x2a, 0xfc,
-  0x63, 0x68, 0xc5, 0xf8, 0x48, 0x02, 0x93, 0xf8, 0x20, 0x10, 0xd8, 0x69,
-  0xff, 0xf7, 0x60, 0xf9, 0x01, 0x23, 0x65, 0x68, 0x85, 0xf8, 0x30, 0x30,
-  0x01, 0x23, 0x4f, 0xf0, 0xa0, 0x41, 0xd5, 0xf8, 0x44, 0x02, 0x82, 0x01,
-  0x83, 0x40, 0x0a, 0x44, 0xc1, 0xf8, 0x64, 0x34, 0xd3, 0x68, 0x58, 0x01,
-  0xfc, 0xd4, 0x01, 0x23, 0xd5, 0xf8, 0x48, 0x02, 0x82, 0x01, 0x83, 0x40,
-  0x02, 0xf1, 0xa0, 0x42, 0xc1, 0xf8, 0x64, 0x34, 0xd3, 0x68, 0x5b, 0x01,
-  0xfc, 0xd4, 0x01, 0x23, 0xa8, 0x69, 0xd5, 0xe9, 0x93, 0x15, 0x02, 0x68,
-  0x03, 0xfa, 0x01, 0xf1, 0x22, 0xea, 0x01, 0x02, 0x02, 0x60, 0x02, 0x68,
-  0xab, 0x40, 0x22, 0xea, 0x03, 0x03, 0x03, 0x60, 0x03, 0xf0, 0x9a, 0xfc,
-  0x63, 0x68, 0xc2, 0x49, 0x98, 0x69, 0x03, 0xf0, 0x1b, 0xfc, 0xdf, 0xed,
-  0xc1, 0x7a, 0x78, 0xee, 0x27, 0x7a, 0x02, 0x46, 0xbc, 0xee, 0xe7, 0x7a,
-  0x65, 0x68, 0x4f, 0xf4, 0x40, 0x36, 0xd5, 0xe9, 0x00, 0x31, 0xc8, 0x03,
-  0x9b, 0x02, 0x00, 0xf4, 0x78, 0x20, 0x03, 0xf4, 0xf8, 0x43, 0x03, 0x43,
-  0x01, 0xf0, 0x1f, 0x00, 0x03, 0x43, 0x48, 0x01, 0x00, 0xf4, 0x78, 0x70,
-  0x03, 0x43, 0x43, 0xf0, 0x10, 0x53, 0x43, 0xf4, 0x80, 0x13, 0x07, 0x93,
-  0x02, 0xf1, 0x11, 0x00, 0xd3, 0x01, 0x09, 0x06, 0x43, 0xea, 0x00, 0x33,
-  0x01, 0xf0, 0xf8, 0x51, 0x23, 0xf0, 0xfe, 0x43, 0x0b, 0x43, 0x17, 0xee,
-  0x10, 0x1a, 0x89, 0xb2, 0x06, 0x96, 0xc5, 0xf8, 0x54, 0x22, 0x00, 0x29,
-  0x00, 0xf0, 0x13, 0x81, 0x07, 0xee, 0x10, 0x1a, 0xb8, 0xee, 0x47, 0x7a,
-  0xdf, 0xed, 0xa6, 0x6a, 0x77, 0xee, 0xc7, 0x7a, 0x67, 0xee, 0xa6, 0x7a,
-  0xfc, 0xee, 0xe7, 0x7a, 0xcd, 0xed, 0x02, 0x7a, 0x9d, 0xf8, 0x08, 0x00,
-  0x00, 0x02, 0x01, 0x27, 0x9f, 0xed, 0x9b, 0x8b, 0x40, 0xea, 0x01, 0x41,
-  0x43, 0xf0, 0x02, 0x03, 0xcd, 0xe9, 0x04, 0x13, 0xa8, 0x69, 0x02, 0x91,
-  0x04, 0xab, 0xd5, 0xf8, 0x4c, 0x12, 0x03, 0xf0, 0xa1, 0xfc, 0x63, 0x68,
-  0x4f, 0xf0, 0x00, 0x09, 0x1a, 0x68, 0xd3, 0xf8, 0x4c, 0x12, 0x98, 0x69,
-  0x3b, 0x46, 0x00, 0x97, 0x03, 0xf0, 0x50, 0xfc, 0x63, 0x68, 0x4f, 0xf4,
-  0x40, 0x28, 0x98, 0x69, 0xd3, 0xf8, 0x4c, 0x32, 0x02, 0x68, 0x07, 0xfa,
-  0x03, 0xf3, 0x13, 0x43, 0x8e, 0x49, 0x03, 0x60, 0x03, 0xf0, 0xae, 0xfb,
-  0x8d, 0xed, 0x0c, 0x8b, 0xd4, 0xf8, 0x04, 0xc0, 0xcd, 0xe9, 0x0e, 0x89,
-  0x0c, 0xad, 0x08, 0xae, 0xcc, 0xf8, 0x58, 0x02, 0x03, 0x1d, 0xc0, 0x01,
-  0x40, 0xea, 0x03, 0x3e, 0x95, 0xe8, 0x0f, 0x00, 0x86, 0xe8, 0x0f, 0x00,
-  0x0c, 0xf5, 0x17, 0x7a, 0xcd, 0xf8, 0x24, 0xe0, 0x96, 0xe8, 0x0f, 0x00,
-  0xdc, 0xf8, 0x08, 0xb0, 0x8a, 0xe8, 0x0f, 0x00, 0x85, 0xe8, 0x0f, 0x00,
-  0xdc, 0xf8, 0x64, 0x32, 0x7d, 0x49, 0x6f, 0xf3, 0x1d, 0x43, 0x43, 0xf4,
-  0x40, 0x32, 0xdc, 0xf8, 0x68, 0x32, 0xcc, 0xf8, 0x64, 0x22, 0x6b, 0xf3,
-  0xd3, 0x33, 0xcc, 0xf8, 0x68, 0x32, 0x02, 0x9b, 0xcc, 0xf8, 0x5c, 0x32,
-  0xdc, 0xf8, 0x18, 0x00, 0x03, 0xf0, 0x7a, 0xfb, 0x8d, 0xed, 0x0c, 0x8b,
-  0xd4, 0xf8, 0x04, 0xc0, 0xcd, 0xe9, 0x0e, 0x89, 0xdc, 0xf8, 0x08, 0x90,
-  0x00, 0xf1, 0x08, 0x08, 0xcc, 0xf8, 0x6c, 0x02, 0x07, 0xfa, 0x09, 0xf2,
-  0x05, 0x30, 0x4f, 0xea, 0x08, 0x38, 0x03, 0x92, 0x48, 0xea, 0xc0, 0x18,
-  0x95, 0xe8, 0x0f, 0x00, 0x86, 0xe8, 0x0f, 0x00, 0x0c, 0xf5, 0x1c, 0x7a,
-  0xcd, 0xf8, 0x24, 0x80, 0x96, 0xe8, 0x0f, 0x00, 0x8a, 0xe8, 0x0f, 0x00,
-  0x85, 0xe8, 0x0f, 0x00, 0xdc, 0xf8, 0x7c, 0x32, 0xdf, 0xf8, 0x90, 0xe1,
-  0x69, 0xf3, 0xd3, 0x33, 0x69, 0xf3, 0x49, 0x13, 0x03, 0xea, 0x0e, 0x0e,
-  0x09, 0xf0, 0x1f, 0x0b, 0x4e, 0xea, 0x0b, 0x0e, 0x4e, 0xf0, 0x82, 0x53,
-  0xcc, 0xf8, 0x7c, 0x32, 0x02, 0x9b, 0xcc, 0xf8, 0x70, 0x32, 0xdc, 0xf8,
-  0x18, 0x20, 0x58, 0x4b, 0xdc, 0xf8, 0x0c, 0x10, 0x9a, 0x42, 0x14, 0xbf,
-  0x06, 0x25, 0x07, 0x25, 0xdc, 0xe9, 0x00, 0x30, 0x07, 0xfa, 0x00, 0xf6,
-  0x07, 0xfa, 0x03, 0xf3, 0x33, 0x43, 0x03, 0x9e, 0x07, 0xfa, 0x01, 0xf1,
-  0x33, 0x43, 0x0b, 0x43, 0xdc, 0xf8, 0x10, 0x10, 0x07, 0xfa, 0x01, 0xf1,
-  0x0b, 0x43, 0xdc, 0xf8, 0x14, 0x10, 0x07, 0xfa, 0x01, 0xf1, 0x0b, 0x43,
-  0xdc, 0xf8, 0x78, 0x12, 0x6f, 0xf3, 0x1d, 0x41, 0x41, 0xf4, 0x00, 0x31,
-  0xcc, 0xf8, 0x78, 0x12, 0x91, 0x6b, 0x0b, 0x43, 0x93, 0x63, 0x29, 0x46,
-  0xfb, 0xf7, 0x26, 0xfe, 0x63, 0x68, 0x29, 0x46, 0x18, 0x68, 0xfb, 0xf7,
-  0x21, 0xfe, 0x63, 0x68, 0x29, 0x46, 0x98, 0x68, 0xfb, 0xf7, 0x1c, 0xfe,
-  0x63, 0x68, 0x29, 0x46, 0xd8, 0x68, 0xfb, 0xf7, 0x17, 0xfe, 0x63, 0x68,
-  0x29, 0x46, 0x18, 0x69, 0xfb, 0xf7, 0x12, 0xfe, 0x63, 0x68, 0x29, 0x46,
-  0x58, 0x69, 0xfb, 0xf7, 0x0d, 0xfe, 0x63, 0x68, 0x39, 0x46, 0x58, 0x68,
-  0xfb, 0xf7, 0x4a, 0xfe, 0x63, 0x68, 0x39, 0x46, 0x18, 0x68, 0xfb, 0xf7,
-  0x45, 0xfe, 0x63, 0x68, 0x39, 0x46, 0x98, 0x68, 0xfb, 0xf7, 0x40, 0xfe,
-  0x63, 0x68, 0x39, 0x46, 0xd8, 0x68, 0xfb, 0xf7, 0x3b, 0xfe, 0x63, 0x68,
-  0x39, 0x46, 0x18, 0x69, 0xfb, 0xf7, 0x36, 0xfe, 0x63, 0x68, 0x39, 0x46,
-  0x58, 0x69, 0xfb, 0xf7, 0x31, 0xfe, 0x63, 0x68, 0x93, 0xf8, 0x28, 0x20,
-  0x52, 0xb9, 0x01, 0x20, 0x11, 0xb0, 0xbd, 0xec, 0x02, 0x8b, 0xbd, 0xe8,
-  0xf0, 0x8f, 0x08, 0x46, 0xfb, 0xe6, 0x0a, 0x23, 0xeb, 0x61, 0x61, 0xe6,
-  0x93, 0xf8, 0x2a, 0x10, 0x58, 0x68, 0xfb, 0xf7, 0x2b, 0xfe, 0x63, 0x68,
-  0x93, 0xf8, 0x29, 0x10, 0x18, 0x68, 0xfb, 0xf7, 0x25, 0xfe, 0x63, 0x68,
-  0x93, 0xf8, 0x2b, 0x10, 0x98, 0x68, 0xfb, 0xf7, 0x1f, 0xfe, 0x63, 0x68,
-  0x93, 0xf8, 0x2c, 0x10, 0xd8, 0x68, 0xfb, 0xf7, 0x19, 0xfe, 0x63, 0x68,
-  0x93, 0xf8, 0x2d, 0x10, 0x18, 0x69, 0xfb, 0xf7, 0x13, 0xfe, 0x63, 0x68,
-  0x58, 0x69, 0x93, 0xf8, 0x2e, 0x10, 0xfb, 0xf7, 0x0d, 0xfe, 0x01, 0x20,
-  0x11, 0xb0, 0xbd, 0xec, 0x02, 0x8b, 0xbd, 0xe8, 0xf0, 0x8f, 0x0c, 0x4b,
-  0x18, 0x46, 0xab, 0x61, 0xeb, 0x69, 0x00, 0x2b, 0x7f, 0xf4, 0x32, 0xae,
-  0xcb, 0xe7, 0x00, 0xbf, 0x00, 0x00, 0x01, 0x00, 0x00, 0xf0, 0x01, 0x00,
-  0xa8, 0xa5, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x80, 0x43,
-  0x94, 0xa5, 0x00, 0x20, 0x78, 0xa5, 0x00, 0x20, 0x00, 0x00, 0x30, 0x50,
-  0x00, 0x00, 0x20, 0x50, 0xe0, 0xff, 0x0f, 0xe0, 0xf8, 0xb5, 0x05, 0x46,
-  0x00, 0x24, 0xfe, 0xf7, 0xdf, 0xff, 0x2b, 0x7e, 0x6a, 0x68, 0x43, 0xf0,
-  0x01, 0x03, 0x2b, 0x76, 0x6c, 0x76, 0x17, 0x68, 0x44, 0xec, 0x40, 0x70,
-  0x44, 0xec, 0x44, 0x70, 0x22, 0x46, 0x21, 0x46, 0x38, 0x46, 0xfb, 0xf7,
-  0xa3, 0xfd, 0x38, 0x46, 0x1f, 0x21, 0xfb, 0xf7, 0x81, 0xfd, 0x6b, 0x68,
-  0x5f, 0x68, 0x44, 0xec, 0x40, 0x70, 0x44, 0xec, 0x44, 0x70, 0x22, 0x46,
-  0x21, 0x46, 0x38, 0x46, 0xfb, 0xf7, 0x94, 0xfd, 0x38, 0x46, 0x1f, 0x21,
-  0xfb, 0xf7, 0x72, 0xfd, 0x6b, 0x68, 0x9f, 0x68, 0x44, 0xec, 0x40, 0x70,
-  0x44, 0xec, 0x44, 0x70, 0x22, 0x46, 0x21, 0x46, 0x38, 0x46, 0xfb, 0xf7,
-  0x85, 0xfd, 0x38, 0x46, 0x1f, 0x21, 0xfb, 0xf7, 0x63, 0xfd, 0x6b, 0x68,
-  0xdf, 0x68, 0x44, 0xec, 0x40, 0x70, 0x44, 0xec, 0x44, 0x70, 0x22, 0x46,
-  0x21, 0x46, 0x38, 0x46, 0xfb, 0xf7, 0x76, 0xfd, 0x38, 0x46, 0x1f, 0x21,
-  0xfb, 0xf7, 0x54, 0xfd, 0x6b, 0x68, 0x1f, 0x69, 0x44, 0xec, 0x40, 0x70,
-  0x44, 0xec, 0x44, 0x70, 0x22, 0x46, 0x21, 0x46, 0x38, 0x46, 0xfb, 0xf7,
-  0x67, 0xfd, 0x38, 0x46, 0x1f, 0x21, 0xfb, 0xf7, 0x45, 0xfd, 0x6b, 0x68,
-  0x5f, 0x69, 0x44, 0xec, 0x40, 0x70, 0x44, 0xec, 0x44, 0x70, 0x22, 0x46,
-  0x21, 0x46, 0x38, 0x46, 0xfb, 0xf7, 0x58, 0xfd, 0x38, 0x46, 0x1f, 0x21,
-  0xfb, 0xf7, 0x36, 0xfd, 0x28, 0x46, 0xbd, 0xe8, 0xf8, 0x40, 0xfe, 0xf7,
-  0x7f, 0xbf, 0x00, 0xbf, 0x30, 0xb5, 0x03, 0x7e, 0x04, 0x46, 0x13, 0xf0,
-  0x01, 0x03, 0x83, 0xb0, 0x11, 0xd1, 0x42, 0x68, 0x01, 0x93, 0x0d, 0x21,
-  0x92, 0x6b, 0x01, 0xab, 0xff, 0xf7, 0x7c, 0xf9, 0x00, 0x28, 0x0c, 0xbf,
-  0x01, 0x20, 0x00, 0x20, 0x03, 0xd0, 0x23, 0x7e, 0x43, 0xf0, 0x01, 0x03,
-  0x23, 0x76, 0x03, 0xb0, 0x30, 0xbd, 0x05, 0x20, 0xfc, 0xf7, 0xc4, 0xfc,
-  0x07, 0xee, 0x90, 0x0a, 0x9f, 0xed, 0x12, 0x7a, 0xf8, 0xee, 0x67, 0x7a,
-  0xc7, 0xee, 0x87, 0x7a, 0x20, 0x46, 0x17, 0xee, 0x90, 0x1a, 0xff, 0xf7,
-  0x75, 0xfd, 0x00, 0x28, 0xeb, 0xd0, 0x00, 0x23, 0x00, 0x25, 0x1a, 0x46,
-  0x19, 0x46, 0x20, 0x46, 0xff, 0xf7, 0x58, 0xf9, 0x01, 0xab, 0x4f, 0xf4,
-  0xd5, 0x72, 0x08, 0x21, 0x20, 0x46, 0x01, 0x95, 0xff, 0xf7, 0x50, 0xf9,
-  0x01, 0x9b, 0xb3, 0xf5, 0xd5, 0x7f, 0x08, 0xbf, 0xa8, 0x42, 0x0c, 0xbf,
-  0x01, 0x20, 0x00, 0x20, 0x03, 0xb0, 0x30, 0xbd, 0x00, 0x50, 0xc3, 0x49,
-  0x30, 0xb5, 0x0c, 0x46, 0x90, 0xf8, 0x40, 0x50, 0x83, 0xb0, 0x08, 0x2d,
-  0x98, 0xbf, 0x08, 0x4b, 0xc1, 0x63, 0x98, 0xbf, 0x53, 0xf8, 0x25, 0x30,
-  0x4f, 0xf0, 0x49, 0x01, 0x88, 0xbf, 0x05, 0x4b, 0x05, 0x4a, 0x01, 0x95,
-  0x00, 0x94, 0x05, 0x48, 0x03, 0xf0, 0x70, 0xf9, 0x03, 0xb0, 0x30, 0xbd,
-  0xd4, 0xa5, 0x00, 0x20, 0x18, 0x9f, 0x00, 0x20, 0x28, 0x9f, 0x00, 0x20,
-  0x68, 0xa6, 0x00, 0x20, 0x83, 0x7e, 0x9b, 0x09, 0x18, 0xd0, 0x01, 0x2b,
-  0x01, 0xd0, 0x00, 0x20, 0x70, 0x47, 0x00, 0x21, 0x0a, 0x46, 0x1a, 0x30,
-  0xa0, 0xeb, 0xd2, 0x03, 0x5b, 0x7a, 0x02, 0xf0, 0x07, 0x0c, 0x43, 0xfa,
-  0x0c, 0xf3, 0x03, 0xf0, 0x01, 0x03, 0x93, 0x40, 0x01, 0x32, 0x16, 0x2a,
-  0x41, 0xea, 0x03, 0x01, 0xf0, 0xd1, 0x01, 0x31, 0x88, 0x02, 0x70, 0x47,
-  0x00, 0xb5, 0x90, 0xf8, 0x21, 0x10, 0x90, 0xf8, 0x22, 0xc0, 0x90, 0xf8,
-  0x20, 0x30, 0x01, 0xf0, 0x01, 0x0e, 0xcc, 0xf3, 0x80, 0x12, 0x42, 0xea,
-  0x8e, 0x02, 0x03, 0xf0, 0x01, 0x0e, 0x4f, 0xea, 0xec, 0x1c, 0x42, 0xea,
-  0x8e, 0x22, 0x42, 0xea, 0x4c, 0x02, 0x4f, 0xea, 0x81, 0x0c, 0x0c, 0xf0,
-  0x08, 0x0c, 0x42, 0xea, 0x0c, 0x02, 0x4f, 0xea, 0x81, 0x0c, 0x0c, 0xf0,
-  0x10, 0x0c, 0x42, 0xea, 0x0c, 0x02, 0x4f, 0xea, 0x81, 0x0c, 0x0c, 0xf0,
-  0x20, 0x0c, 0x42, 0xea, 0x0c, 0x02, 0x4f, 0xea, 0x81, 0x0c, 0x0c, 0xf0,
-  0x40, 0x0c, 0x42, 0xea, 0x0c, 0x02, 0x4f, 0xea, 0x81, 0x0c, 0x0c, 0xf0,
-  0x80, 0x0c, 0x42, 0xea, 0x0c, 0x02, 0x4f, 0xea, 0x81, 0x0c, 0x0c, 0xf4,
-  0x80, 0x7c, 0x90, 0xf8, 0x24, 0xe0, 0x42, 0xea, 0x0c, 0x02, 0xc9, 0x11,
-  0x90, 0xf8, 0x23, 0xc0, 0x98, 0x02, 0x00, 0xf4, 0x00, 0x60, 0x42, 0xea,
-  0x41, 0x23, 0x18, 0x43, 0x0c, 0xf0, 0x01, 0x03, 0x4f, 0xea, 0x4c, 0x02,
-  0x5b, 0x00, 0x43, 0xea, 0xde, 0x13, 0x02, 0xf0, 0x04, 0x02, 0x13, 0x43,
-  0x02, 0x33, 0x01, 0x30, 0x98, 0x40, 0x5d, 0xf8, 0x04, 0xfb, 0x00, 0xbf,
-  0x2d, 0xe9, 0xf0, 0x41, 0x04, 0x46, 0x86, 0xb0, 0x05, 0x20, 0xfc, 0xf7,
-  0x03, 0xfc, 0x07, 0xee, 0x90, 0x0a, 0x9f, 0xed, 0xa6, 0x7a, 0xf8, 0xee,
-  0x67, 0x7a, 0xc7, 0xee, 0x87, 0x7a, 0x20, 0x46, 0x17, 0xee, 0x90, 0x1a,
-  0xff, 0xf7, 0xb4, 0xfc, 0x38, 0xb3, 0x05, 0x25, 0x00, 0x26, 0x01, 0x20,
-  0xfc, 0xf7, 0x7a, 0xfa, 0x00, 0x23, 0x20, 0x46, 0x1a, 0x46, 0x19, 0x46,
-  0x05, 0x96, 0xff, 0xf7, 0x93, 0xf8, 0x4f, 0xf4, 0xd5, 0x72, 0x08, 0x21,
-  0x20, 0x46, 0x05, 0xab, 0xff, 0xf7, 0x8c, 0xf8, 0x18, 0xb9, 0x05, 0x9b,
-  0xb3, 0xf5, 0xd5, 0x7f, 0x13, 0xd0, 0x01, 0x3d, 0xe7, 0xd1, 0x05, 0x9d,
-  0xb5, 0xf5, 0xd5, 0x7f, 0x00, 0xd1, 0x60, 0xb1, 0x77, 0x21, 0x91, 0x4b,
-  0xcd, 0xe9, 0x01, 0x05, 0x90, 0x4a, 0x18, 0x46, 0x00, 0x91, 0x03, 0xf0,
-  0xb9, 0xf8, 0x00, 0x20, 0x06, 0xb0, 0xbd, 0xe8, 0xf0, 0x81, 0xfc, 0xf7,
-  0x43, 0xfb, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x03, 0xf0, 0x7e, 0xfb,
-  0x89, 0x4f, 0x06, 0x46, 0xd4, 0xf8, 0x04, 0x80, 0x1e, 0xe0, 0xd4, 0xf8,
-  0x04, 0x80, 0x29, 0x21, 0x20, 0x46, 0x86, 0x4a, 0x08, 0xf1, 0x34, 0x03,
-  0xff, 0xf7, 0x10, 0xfa, 0x05, 0x46, 0x88, 0xf8, 0x40, 0x00, 0x00, 0x28,
-  0x2e, 0xd1, 0xfc, 0xf7, 0x29, 0xfb, 0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72,
-  0x03, 0xf0, 0x64, 0xfb, 0x3b, 0x6b, 0x80, 0x1b, 0x98, 0x42, 0x30, 0xd8,
-  0xd4, 0xf8, 0x04, 0x80, 0xd8, 0xf8, 0x34, 0x30, 0x00, 0x2b, 0x30, 0xdb,
-  0x00, 0x22, 0x37, 0x21, 0x20, 0x46, 0x05, 0xab, 0xff, 0xf7, 0x42, 0xf8,
-  0x88, 0xf8, 0x40, 0x00, 0x00, 0x28, 0xd6, 0xd0, 0x7f, 0x22, 0x63, 0x68,
-  0x7f, 0x24, 0x93, 0xf8, 0x40, 0x00, 0xda, 0x63, 0x08, 0x28, 0x96, 0xbf,
-  0x70, 0x4b, 0x71, 0x4b, 0x53, 0xf8, 0x20, 0x30, 0x01, 0x90, 0x49, 0x21,
-  0x6f, 0x4a, 0x00, 0x94, 0x6f, 0x48, 0x03, 0xf0, 0x6d, 0xf8, 0xb2, 0xe7,
-  0x80, 0x22, 0x63, 0x68, 0x80, 0x24, 0x93, 0xf8, 0x40, 0x00, 0xda, 0x63,
-  0x08, 0x28, 0x96, 0xbf, 0x66, 0x4b, 0x67, 0x4b, 0x53, 0xf8, 0x20, 0x30,
-  0xea, 0xe7, 0x88, 0x21, 0x67, 0x4a, 0x5f, 0x48, 0x03, 0xf0, 0x5a, 0xf8,
-  0x9f, 0xe7, 0x2a, 0x46, 0x02, 0x21, 0x20, 0x46, 0x04, 0xf1, 0x2a, 0x03,
-  0xff, 0xf7, 0xb6, 0xf8, 0x02, 0x46, 0x88, 0xf8, 0x40, 0x00, 0x00, 0x28,
-  0x40, 0xf0, 0x84, 0x80, 0x65, 0x68, 0x03, 0x21, 0x20, 0x46, 0x05, 0xf1,
-  0x38, 0x03, 0xff, 0xf7, 0x03, 0xf8, 0x85, 0xf8, 0x40, 0x00, 0x00, 0x28,
-  0x40, 0xf0, 0x85, 0x80, 0x66, 0x68, 0x04, 0xf1, 0x1a, 0x05, 0x2b, 0x46,
-  0x09, 0x21, 0x20, 0x46, 0xb2, 0x6b, 0xff, 0xf7, 0x9b, 0xf8, 0x86, 0xf8,
-  0x40, 0x00, 0x00, 0x28, 0x40, 0xf0, 0x84, 0x80, 0xa3, 0x7e, 0x9b, 0x09,
-  0x00, 0xf0, 0xa2, 0x80, 0x01, 0x2b, 0x00, 0xf0, 0xfc, 0x80, 0x65, 0x68,
-  0xe0, 0x63, 0x07, 0x21, 0x20, 0x46, 0xaa, 0x6b, 0x05, 0xab, 0xfe, 0xf7,
-  0xe1, 0xff, 0x85, 0xf8, 0x40, 0x00, 0x00, 0x28, 0x40, 0xf0, 0xd5, 0x80,
-  0x65, 0x68, 0x37, 0x21, 0xaa, 0x6b, 0x20, 0x46, 0x05, 0xab, 0xfe, 0xf7,
-  0xd5, 0xff, 0x02, 0x46, 0x85, 0xf8, 0x40, 0x00, 0x00, 0x28, 0x40, 0xf0,
-  0xd5, 0x80, 0x2a, 0x21, 0x20, 0x46, 0x05, 0xab, 0x65, 0x68, 0xfe, 0xf7,
-  0xc9, 0xff, 0x85, 0xf8, 0x40, 0x00, 0x00, 0x28, 0x40, 0xf0, 0xe9, 0x80,
-  0x65, 0x68, 0x37, 0x21, 0x20, 0x46, 0xaa, 0x6b, 0x05, 0xab, 0xfe, 0xf7,
-  0xbd, 0xff, 0x85, 0xf8, 0x40, 0x00, 0x00, 0x28, 0x40, 0xf0, 0xea, 0x80,
-  0x02, 0x22, 0x06, 0x21, 0x20, 0x46, 0x05, 0xab, 0x65, 0x68, 0xfe, 0xf7,
-  0xb1, 0xff, 0x85, 0xf8, 0x40, 0x00, 0x00, 0x28, 0x40, 0xf0, 0xeb, 0x80,
-  0x4f, 0xf4, 0x00, 0x72, 0x10, 0x21, 0x20, 0x46, 0x05, 0xab, 0x65, 0x68,
-  0xfe, 0xf7, 0xa4, 0xff, 0x85, 0xf8, 0x40, 0x00, 0x00, 0x28, 0x40, 0xf0,
-  0xec, 0x80, 0x63, 0x68, 0x5d, 0x6a, 0x00, 0x2d, 0x00, 0xf0, 0xde, 0x80,
-  0x05, 0x20, 0xfc, 0xf7, 0xed, 0xfa, 0xad, 0x00, 0x07, 0xee, 0x10, 0x0a,
-  0x07, 0xee, 0x90, 0x5a, 0xb8, 0xee, 0x47, 0x7a, 0xf8, 0xee, 0x67, 0x7a,
-  0xc7, 0xee, 0x27, 0x7a, 0x20, 0x46, 0x17, 0xee, 0x90, 0x1a, 0xff, 0xf7,
-  0x9b, 0xfb, 0x0f, 0xe7, 0x91, 0x22, 0x63, 0x68, 0x91, 0x24, 0x93, 0xf8,
-  0x40, 0x00, 0xda, 0x63, 0x08, 0x28, 0x96, 0xbf, 0x14, 0x4b, 0x15, 0x4b,
-  0x53, 0xf8, 0x20, 0x30, 0x46, 0xe7, 0x9a, 0x22, 0x63, 0x68, 0x9a, 0x24,
-  0x93, 0xf8, 0x40, 0x00, 0xda, 0x63, 0x08, 0x28, 0x96, 0xbf, 0x0e, 0x4b,
-  0x0e, 0x4b, 0x53, 0xf8, 0x20, 0x30, 0x39, 0xe7, 0xa2, 0x22, 0x63, 0x68,
-  0xa2, 0x24, 0x93, 0xf8, 0x40, 0x00, 0xda, 0x63, 0x08, 0x28, 0x96, 0xbf,
-  0x07, 0x4b, 0x08, 0x4b, 0x53, 0xf8, 0x20, 0x30, 0x2c, 0xe7, 0x00, 0xbf,
-  0x00, 0x50, 0xc3, 0x49, 0x74, 0xa6, 0x00, 0x20, 0x48, 0x9f, 0x00, 0x20,
-  0x8c, 0xbd, 0x00, 0x20, 0x00, 0x00, 0x04, 0xd0, 0xd4, 0xa5, 0x00, 0x20,
-  0x18, 0x9f, 0x00, 0x20, 0x28, 0x9f, 0x00, 0x20, 0x68, 0xa6, 0x00, 0x20,
-  0x94, 0x9f, 0x00, 0x20, 0x94, 0xf8, 0x21, 0x20, 0x94, 0xf8, 0x22, 0x00,
-  0x94, 0xf8, 0x20, 0x10, 0x02, 0xf0, 0x01, 0x05, 0xc0, 0xf3, 0x80, 0x13,
-  0x43, 0xea, 0x85, 0x03, 0x01, 0xf0, 0x01, 0x05, 0xc0, 0x11, 0x43, 0xea,
-  0x85, 0x23, 0x43, 0xea, 0x40, 0x03, 0x88, 0x02, 0x91, 0x00, 0x01, 0xf0,
-  0x08, 0x01, 0x0b, 0x43, 0x91, 0x00, 0x01, 0xf0, 0x10, 0x01, 0x0b, 0x43,
-  0x91, 0x00, 0x01, 0xf0, 0x20, 0x01, 0x0b, 0x43, 0x91, 0x00, 0x01, 0xf0,
-  0x40, 0x01, 0x95, 0x00, 0x0b, 0x43, 0x05, 0xf0, 0x80, 0x05, 0x2b, 0x43,
-  0x95, 0x00, 0x05, 0xf4, 0x80, 0x75, 0x94, 0xf8, 0x23, 0x10, 0xd2, 0x11,
-  0x2b, 0x43, 0x43, 0xea, 0x42, 0x23, 0x00, 0xf4, 0x00, 0x60, 0x18, 0x43,
-  0x4a, 0x00, 0x01, 0xf0, 0x01, 0x03, 0x94, 0xf8, 0x24, 0x10, 0x5b, 0x00,
-  0x02, 0xf0, 0x04, 0x02, 0x43, 0xea, 0xd1, 0x13, 0x13, 0x43, 0x01, 0x30,
-  0x02, 0x33, 0x98, 0x40, 0x1d, 0xe7, 0xac, 0x22, 0x63, 0x68, 0xac, 0x24,
-  0x93, 0xf8, 0x40, 0x00, 0xda, 0x63, 0x08, 0x28, 0x96, 0xbf, 0x2c, 0x4b,
-  0x2c, 0x4b, 0x53, 0xf8, 0x20, 0x30, 0xc7, 0xe6, 0xbb, 0x22, 0x63, 0x68,
-  0xbb, 0x24, 0x93, 0xf8, 0x40, 0x00, 0xda, 0x63, 0x08, 0x28, 0x96, 0xbf,
-  0x25, 0x4b, 0x26, 0x4b, 0x53, 0xf8, 0x20, 0x30, 0xba, 0xe6, 0x03, 0x46,
-  0xa5, 0xeb, 0xd3, 0x02, 0x52, 0x7a, 0x03, 0xf0, 0x07, 0x01, 0x0a, 0x41,
-  0x02, 0xf0, 0x01, 0x02, 0x9a, 0x40, 0x01, 0x33, 0x16, 0x2b, 0x40, 0xea,
-  0x02, 0x00, 0xf1, 0xd1, 0x01, 0x30, 0x80, 0x02, 0xf1, 0xe6, 0xbc, 0x22,
-  0x63, 0x68, 0xbc, 0x24, 0x93, 0xf8, 0x40, 0x00, 0xda, 0x63, 0x08, 0x28,
-  0x96, 0xbf, 0x16, 0x4b, 0x16, 0x4b, 0x53, 0xf8, 0x20, 0x30, 0x9b, 0xe6,
-  0xc4, 0x22, 0x63, 0x68, 0xc4, 0x24, 0x93, 0xf8, 0x40, 0x00, 0xda, 0x63,
-  0x08, 0x28, 0x96, 0xbf, 0x0f, 0x4b, 0x10, 0x4b, 0x53, 0xf8, 0x20, 0x30,
-  0x8e, 0xe6, 0xc5, 0x21, 0x60, 0x68, 0xff, 0xf7, 0x79, 0xfd, 0x44, 0xe6,
-  0x05, 0x20, 0xfc, 0xf7, 0x0f, 0xfa, 0x0c, 0x22, 0xb0, 0xfb, 0xf2, 0xf5,
-  0x63, 0x68, 0x5d, 0x62, 0x18, 0xe7, 0x60, 0x68, 0xca, 0x21, 0xff, 0xf7,
-  0x6b, 0xfd, 0xcc, 0x21, 0x05, 0x4b, 0x06, 0x4a, 0x18, 0x46, 0x00, 0x91,
-  0x02, 0xf0, 0xea, 0xfe, 0x2f, 0xe6, 0x00, 0xbf, 0xd4, 0xa5, 0x00, 0x20,
-  0x18, 0x9f, 0x00, 0x20, 0x74, 0xa6, 0x00, 0x20, 0xb8, 0x9f, 0x00, 0x20,
-  0x2d, 0xe9, 0xf0, 0x41, 0x04, 0x46, 0xfe, 0xf7, 0x89, 0xfc, 0x20, 0x46,
-  0xfe, 0xf7, 0x8e, 0xfc, 0x23, 0x7e, 0x13, 0xf0, 0x02, 0x05, 0x66, 0xd1,
-  0xdb, 0x07, 0x64, 0xd5, 0x63, 0x68, 0x65, 0x76, 0x4f, 0xf0, 0x01, 0x06,
-  0x1f, 0x68, 0x46, 0xec, 0x40, 0x70, 0x46, 0xec, 0x44, 0x70, 0x01, 0x21,
-  0x2a, 0x46, 0x38, 0x46, 0xfb, 0xf7, 0x46, 0xfa, 0x38, 0x46, 0x07, 0x21,
-  0xfb, 0xf7, 0x24, 0xfa, 0x63, 0x68, 0x5f, 0x68, 0x46, 0xec, 0x40, 0x70,
-  0x46, 0xec, 0x44, 0x70, 0x01, 0x21, 0x2a, 0x46, 0x38, 0x46, 0xfb, 0xf7,
-  0x37, 0xfa, 0x38, 0x46, 0x07, 0x21, 0xfb, 0xf7, 0x15, 0xfa, 0x63, 0x68,
-  0x9f, 0x68, 0x46, 0xec, 0x40, 0x70, 0x45, 0xec, 0x44, 0x70, 0x01, 0x21,
-  0x2a, 0x46, 0x38, 0x46, 0xfb, 0xf7, 0x28, 0xfa, 0x38, 0x46, 0x07, 0x21,
-  0xfb, 0xf7, 0x06, 0xfa, 0x63, 0x68, 0xdf, 0x68, 0x46, 0xec, 0x40, 0x70,
-  0x45, 0xec, 0x44, 0x70, 0x01, 0x21, 0x2a, 0x46, 0x38, 0x46, 0xfb, 0xf7,
-  0x19, 0xfa, 0x38, 0x46, 0x07, 0x21, 0xfb, 0xf7, 0xf7, 0xf9, 0x63, 0x68,
-  0x1f, 0x69, 0x46, 0xec, 0x40, 0x70, 0x45, 0xec, 0x44, 0x70, 0x01, 0x21,
-  0x2a, 0x46, 0x38, 0x46, 0xfb, 0xf7, 0x0a, 0xfa, 0x38, 0x46, 0x07, 0x21,
-  0xfb, 0xf7, 0xe8, 0xf9, 0x63, 0x68, 0x5f, 0x69, 0x46, 0xec, 0x40, 0x70,
-  0x45, 0xec, 0x44, 0x70, 0x01, 0x21, 0x2a, 0x46, 0x38, 0x46, 0xfb, 0xf7,
-  0xfb, 0xf9, 0x38, 0x46, 0x07, 0x21, 0xfb, 0xf7, 0xd9, 0xf9, 0x20, 0x46,
-  0xff, 0xf7, 0x7c, 0xfd, 0x18, 0xb1, 0x23, 0x7e, 0x23, 0xf0, 0x01, 0x03,
-  0x23, 0x76, 0x20, 0x46, 0xfe, 0xf7, 0x1c, 0xfc, 0x20, 0x7e, 0xbd, 0xe8,
-  0xf0, 0x81, 0x00, 0xbf, 0x00, 0x22, 0x2d, 0xe9, 0xf0, 0x41, 0x46, 0x68,
-  0x84, 0xb0, 0x0c, 0x46, 0x03, 0xab, 0x0c, 0x21, 0x86, 0xf8, 0xbc, 0x22,
-  0x05, 0x46, 0xfe, 0xf7, 0x17, 0xfe, 0x86, 0xf8, 0x40, 0x00, 0x70, 0xbb,
-  0x1c, 0xb9, 0x01, 0x20, 0x04, 0xb0, 0xbd, 0xe8, 0xf0, 0x81, 0xfc, 0xf7,
-  0xdf, 0xf8, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x03, 0xf0, 0x1a, 0xf9,
-  0x01, 0x27, 0x4f, 0xf0, 0x50, 0x48, 0x06, 0x46, 0x03, 0xe0, 0xd8, 0xf8,
-  0x04, 0x30, 0x23, 0x42, 0x0d, 0xd1, 0xfc, 0xf7, 0xcf, 0xf8, 0x4f, 0xf4,
-  0x7a, 0x72, 0x00, 0x23, 0x03, 0xf0, 0x0a, 0xf9, 0x6c, 0x68, 0x80, 0x1b,
-  0xa4, 0x68, 0xc7, 0x28, 0x07, 0xfa, 0x04, 0xf4, 0xed, 0xd9, 0x4f, 0xf0,
-  0x50, 0x43, 0x5b, 0x68, 0x23, 0x42, 0xd8, 0xd1, 0x4f, 0xf4, 0x89, 0x71,
-  0x0f, 0x4a, 0x10, 0x48, 0x02, 0xf0, 0x28, 0xfe, 0x15, 0xe0, 0x40, 0xf2,
-  0x03, 0x12, 0x40, 0xf2, 0x03, 0x14, 0x6b, 0x68, 0x49, 0x21, 0x93, 0xf8,
-  0x40, 0x00, 0xda, 0x63, 0x08, 0x28, 0x98, 0xbf, 0x09, 0x4b, 0x01, 0x90,
-  0x94, 0xbf, 0x53, 0xf8, 0x20, 0x30, 0x08, 0x4b, 0x08, 0x4a, 0x09, 0x48,
-  0x00, 0x94, 0x02, 0xf0, 0x11, 0xfe, 0x00, 0x20, 0x04, 0xb0, 0xbd, 0xe8,
-  0xf0, 0x81, 0x00, 0xbf, 0xdc, 0x9f, 0x00, 0x20, 0x4c, 0xa6, 0x00, 0x20,
-  0xd4, 0xa5, 0x00, 0x20, 0x18, 0x9f, 0x00, 0x20, 0x28, 0x9f, 0x00, 0x20,
-  0x68, 0xa6, 0x00, 0x20, 0x38, 0xb5, 0x05, 0x46, 0xfe, 0xf7, 0xaa, 0xfb,
-  0x6b, 0x68, 0x93, 0xf8, 0xbc, 0x42, 0x24, 0xb9, 0x28, 0x46, 0xfe, 0xf7,
-  0xa7, 0xfb, 0x20, 0x46, 0x38, 0xbd, 0x01, 0x21, 0x28, 0x46, 0xff, 0xf7,
-  0x89, 0xff, 0x80, 0xf0, 0x01, 0x03, 0xdb, 0xb2, 0x28, 0x46, 0xdc, 0x01,
-  0xfe, 0xf7, 0x9a, 0xfb, 0x20, 0x46, 0x38, 0xbd, 0xf0, 0xb5, 0x47, 0x68,
-  0x04, 0x46, 0x97, 0xf8, 0xbc, 0x32, 0x0e, 0x46, 0x15, 0x46, 0x85, 0xb0,
-  0x00, 0x2b, 0x39, 0xd1, 0xab, 0x07, 0x3e, 0xd1, 0x32, 0x46, 0x18, 0x21,
-  0x20, 0x46, 0x02, 0xab, 0xfe, 0xf7, 0x92, 0xfd, 0x87, 0xf8, 0x40, 0x00,
-  0x00, 0x28, 0x3f, 0xd1, 0x29, 0x46, 0x01, 0x22, 0x20, 0x46, 0x65, 0x68,
-  0xff, 0xf7, 0x1e, 0xf9, 0x85, 0xf8, 0x40, 0x00, 0x65, 0x68, 0x00, 0x28,
-  0x4c, 0xd1, 0x20, 0x46, 0x03, 0xa9, 0xff, 0xf7, 0x51, 0xf9, 0x85, 0xf8,
-  0x40, 0x00, 0x65, 0x68, 0x95, 0xf8, 0x40, 0x00, 0x01, 0x28, 0xf4, 0xd0,
-  0x88, 0xb1, 0x08, 0x28, 0x96, 0xbf, 0x27, 0x4b, 0x27, 0x4d, 0x53, 0xf8,
-  0x20, 0x50, 0x4f, 0xf4, 0xa1, 0x71, 0x33, 0x46, 0xcd, 0xe9, 0x00, 0x50,
-  0x24, 0x4a, 0x25, 0x48, 0x02, 0xf0, 0xaa, 0xfd, 0x63, 0x68, 0x93, 0xf8,
-  0x40, 0x00, 0xb0, 0xfa, 0x80, 0xf0, 0x40, 0x09, 0x05, 0xb0, 0xf0, 0xbd,
-  0x01, 0x21, 0xff, 0xf7, 0x39, 0xff, 0x10, 0xb3, 0xab, 0x07, 0x67, 0x68,
-  0xc0, 0xd0, 0x29, 0x46, 0x07, 0xf1, 0x44, 0x00, 0x4f, 0xf4, 0x00, 0x72,
-  0x03, 0xf0, 0x72, 0xfa, 0x67, 0x68, 0x07, 0xf1, 0x44, 0x05, 0xb5, 0xe7,
-  0x40, 0xf2, 0x35, 0x12, 0x63, 0x68, 0x40, 0xf2, 0x35, 0x14, 0x93, 0xf8,
-  0x40, 0x00, 0xda, 0x63, 0x08, 0x28, 0x96, 0xbf, 0x0e, 0x4b, 0x0f, 0x4b,
-  0x53, 0xf8, 0x20, 0x30, 0x01, 0x90, 0x49, 0x21, 0x0f, 0x4a, 0x10, 0x48,
-  0x00, 0x94, 0x02, 0xf0, 0x7b, 0xfd, 0x00, 0x20, 0x05, 0xb0, 0xf0, 0xbd,
-  0x4f, 0xf4, 0x9b, 0x73, 0x95, 0xf8, 0x40, 0x00, 0xeb, 0x63, 0x08, 0x28,
-  0x98, 0xbf, 0x04, 0x4b, 0x4f, 0xf4, 0x9b, 0x74, 0x94, 0xbf, 0x53, 0xf8,
-  0x20, 0x30, 0x02, 0x4b, 0xe6, 0xe7, 0x00, 0xbf, 0xd4, 0xa5, 0x00, 0x20,
-  0x18, 0x9f, 0x00, 0x20, 0x00, 0xa0, 0x00, 0x20, 0x38, 0xa6, 0x00, 0x20,
-  0x28, 0x9f, 0x00, 0x20, 0x68, 0xa6, 0x00, 0x20, 0x2d, 0xe9, 0xf0, 0x43,
-  0x1f, 0x46, 0x93, 0x07, 0x06, 0x46, 0x0c, 0x46, 0x87, 0xb0, 0x14, 0xd0,
-  0x00, 0x2f, 0x61, 0xd0, 0x15, 0x46, 0x0f, 0x44, 0x01, 0xe0, 0xbc, 0x42,
-  0x5c, 0xd0, 0x2a, 0x46, 0x21, 0x46, 0x30, 0x46, 0xff, 0xf7, 0x62, 0xff,
-  0x01, 0x34, 0x05, 0xf5, 0x00, 0x75, 0x00, 0x28, 0xf3, 0xd1, 0x00, 0x20,
-  0x07, 0xb0, 0xbd, 0xe8, 0xf0, 0x83, 0x45, 0x68, 0x90, 0x46, 0x95, 0xf8,
-  0xbc, 0x32, 0x00, 0x2b, 0x37, 0xd1, 0x0d, 0xf1, 0x14, 0x09, 0x4b, 0x46,
-  0x22, 0x46, 0x19, 0x21, 0x30, 0x46, 0xfe, 0xf7, 0xef, 0xfc, 0x85, 0xf8,
-  0x40, 0x00, 0x00, 0x28, 0x4a, 0xd1, 0x41, 0x46, 0x3a, 0x46, 0x30, 0x46,
-  0x75, 0x68, 0xff, 0xf7, 0x7b, 0xf8, 0x85, 0xf8, 0x40, 0x00, 0x00, 0x28,
-  0x56, 0xd1, 0x75, 0x68, 0x49, 0x46, 0x30, 0x46, 0xff, 0xf7, 0xae, 0xf8,
-  0x85, 0xf8, 0x40, 0x00, 0x75, 0x68, 0x95, 0xf8, 0x40, 0x10, 0x01, 0x29,
-  0xf4, 0xd0, 0xf9, 0xb1, 0x08, 0x29, 0x96, 0xbf, 0x32, 0x4b, 0x33, 0x48,
-  0x53, 0xf8, 0x21, 0x00, 0x02, 0x91, 0xcd, 0xe9, 0x00, 0x70, 0x23, 0x46,
-  0x4f, 0xf4, 0xb5, 0x71, 0x2f, 0x4a, 0x30, 0x48, 0x02, 0xf0, 0x06, 0xfd,
-  0x01, 0x21, 0x30, 0x46, 0xff, 0xf7, 0x9c, 0xfe, 0xbd, 0xe7, 0xd5, 0xf8,
-  0xc0, 0x32, 0x8b, 0x42, 0x10, 0xd0, 0x01, 0x21, 0xff, 0xf7, 0x94, 0xfe,
-  0x00, 0x28, 0xb4, 0xd0, 0x75, 0x68, 0xbc, 0xe7, 0x01, 0x23, 0x3c, 0x44,
-  0xc5, 0xf8, 0xc0, 0x42, 0x85, 0xf8, 0xbc, 0x32, 0x01, 0x20, 0x07, 0xb0,
-  0xbd, 0xe8, 0xf0, 0x83, 0x11, 0x46, 0x3a, 0x46, 0xff, 0xf7, 0x3c, 0xf8,
-  0x85, 0xf8, 0x40, 0x00, 0x38, 0xbb, 0x0d, 0xf1, 0x14, 0x09, 0xbe, 0xe7,
-  0x40, 0xf2, 0x5d, 0x12, 0x40, 0xf2, 0x5d, 0x14, 0x73, 0x68, 0x93, 0xf8,
-  0x40, 0x00, 0xda, 0x63, 0x08, 0x28, 0x96, 0xbf, 0x14, 0x4b, 0x15, 0x4b,
-  0x53, 0xf8, 0x20, 0x30, 0x01, 0x90, 0x49, 0x21, 0x15, 0x4a, 0x00, 0x94,
-  0x15, 0x48, 0x02, 0xf0, 0xcd, 0xfc, 0x88, 0xe7, 0x4f, 0xf4, 0xaf, 0x72,
-  0x73, 0x68, 0x4f, 0xf4, 0xaf, 0x74, 0x93, 0xf8, 0x40, 0x00, 0xda, 0x63,
-  0x08, 0x28, 0x96, 0xbf, 0x09, 0x4b, 0x0a, 0x4b, 0x53, 0xf8, 0x20, 0x30,
-  0xe8, 0xe7, 0x40, 0xf2, 0x55, 0x12, 0x73, 0x68, 0x40, 0xf2, 0x55, 0x14,
-  0x93, 0xf8, 0x40, 0x00, 0xda, 0x63, 0x08, 0x28, 0x96, 0xbf, 0x02, 0x4b,
-  0x02, 0x4b, 0x53, 0xf8, 0x20, 0x30, 0xd9, 0xe7, 0xd4, 0xa5, 0x00, 0x20,
-  0x18, 0x9f, 0x00, 0x20, 0x2c, 0xa0, 0x00, 0x20, 0x20, 0xa6, 0x00, 0x20,
-  0x28, 0x9f, 0x00, 0x20, 0x68, 0xa6, 0x00, 0x20, 0xf8, 0xb5, 0x1c, 0x46,
-  0x05, 0x46, 0x0f, 0x46, 0x16, 0x46, 0xfe, 0xf7, 0x49, 0xfa, 0x01, 0x2c,
-  0x0f, 0xd0, 0x23, 0x46, 0x3a, 0x46, 0x31, 0x46, 0x28, 0x46, 0xff, 0xf7,
-  0x37, 0xff, 0x04, 0x46, 0x28, 0x46, 0xfe, 0xf7, 0x41, 0xfa, 0x84, 0xf0,
-  0x01, 0x00, 0x80, 0x02, 0x00, 0xf4, 0x7c, 0x40, 0xf8, 0xbd, 0x3a, 0x46,
-  0x31, 0x46, 0x28, 0x46, 0xff, 0xf7, 0x9e, 0xfe, 0x04, 0x46, 0xef, 0xe7,
-  0x2d, 0xe9, 0xf0, 0x41, 0x45, 0x68, 0x04, 0x46, 0x95, 0xf8, 0xbc, 0x32,
-  0x0f, 0x46, 0x16, 0x46, 0x84, 0xb0, 0x00, 0x2b, 0x49, 0xd1, 0xb3, 0x07,
-  0x0c, 0xbf, 0xb0, 0x46, 0x05, 0xf1, 0x44, 0x08, 0x4f, 0xf4, 0x00, 0x73,
-  0x01, 0x22, 0x41, 0x46, 0x20, 0x46, 0xfe, 0xf7, 0x29, 0xfe, 0x85, 0xf8,
-  0x40, 0x00, 0x00, 0x28, 0x3f, 0xd1, 0x3a, 0x46, 0x11, 0x21, 0x20, 0x46,
-  0x03, 0xab, 0x65, 0x68, 0xfe, 0xf7, 0x1e, 0xfc, 0x85, 0xf8, 0x40, 0x00,
-  0x65, 0x68, 0x00, 0x28, 0x4c, 0xd1, 0x80, 0x21, 0x20, 0x46, 0xfe, 0xf7,
-  0xd7, 0xfe, 0x85, 0xf8, 0x40, 0x00, 0x65, 0x68, 0x95, 0xf8, 0x40, 0x00,
-  0x01, 0x28, 0xf4, 0xd0, 0x78, 0xb1, 0x08, 0x28, 0x96, 0xbf, 0x27, 0x4b,
-  0x27, 0x4a, 0x53, 0xf8, 0x20, 0x20, 0x01, 0x90, 0x00, 0x92, 0x3b, 0x46,
-  0x40, 0xf2, 0x97, 0x11, 0x24, 0x4a, 0x25, 0x48, 0x02, 0xf0, 0x40, 0xfc,
-  0x65, 0x68, 0xb0, 0x45, 0x07, 0xd0, 0x05, 0xf1, 0x44, 0x01, 0x4f, 0xf4,
-  0x00, 0x72, 0x30, 0x46, 0x03, 0xf0, 0x14, 0xf9, 0x65, 0x68, 0x95, 0xf8,
-  0x40, 0x00, 0xb0, 0xfa, 0x80, 0xf0, 0x40, 0x09, 0x04, 0xb0, 0xbd, 0xe8,
-  0xf0, 0x81, 0x01, 0x21, 0xff, 0xf7, 0xc4, 0xfd, 0xb0, 0xb1, 0x65, 0x68,
-  0xaf, 0xe7, 0x40, 0xf2, 0x8b, 0x12, 0x63, 0x68, 0x40, 0xf2, 0x8b, 0x14,
-  0x93, 0xf8, 0x40, 0x00, 0xda, 0x63, 0x08, 0x28, 0x96, 0xbf, 0x0f, 0x4b,
-  0x0f, 0x4b, 0x53, 0xf8, 0x20, 0x30, 0x01, 0x90, 0x49, 0x21, 0x10, 0x4a,
-  0x10, 0x48, 0x00, 0x94, 0x02, 0xf0, 0x12, 0xfc, 0x00, 0x20, 0x04, 0xb0,
-  0xbd, 0xe8, 0xf0, 0x81, 0x4f, 0xf4, 0xc6, 0x73, 0x95, 0xf8, 0x40, 0x00,
-  0xeb, 0x63, 0x08, 0x28, 0x98, 0xbf, 0x04, 0x4b, 0x4f, 0xf4, 0xc6, 0x74,
-  0x94, 0xbf, 0x53, 0xf8, 0x20, 0x30, 0x02, 0x4b, 0xe5, 0xe7, 0x00, 0xbf,
-  0xd4, 0xa5, 0x00, 0x20, 0x18, 0x9f, 0x00, 0x20, 0x60, 0xa0, 0x00, 0x20,
-  0x0c, 0xa6, 0x00, 0x20, 0x28, 0x9f, 0x00, 0x20, 0x68, 0xa6, 0x00, 0x20,
-  0x2d, 0xe9, 0xf0, 0x41, 0x1f, 0x46, 0x43, 0x68, 0x06, 0x46, 0x93, 0xf8,
-  0xbc, 0x32, 0x0c, 0x46, 0x90, 0x46, 0x86, 0xb0, 0x00, 0x2b, 0x59, 0xd1,
-  0x18, 0xf0, 0x03, 0x0f, 0x45, 0x46, 0x13, 0xd0, 0x00, 0x2f, 0x4f, 0xd0,
-  0x27, 0x44, 0x01, 0xe0, 0xbc, 0x42, 0x4b, 0xd0, 0x2a, 0x46, 0x21, 0x46,
-  0x30, 0x46, 0xff, 0xf7, 0x55, 0xff, 0x01, 0x34, 0x05, 0xf5, 0x00, 0x75,
-  0x00, 0x28, 0xf3, 0xd1, 0x00, 0x20, 0x06, 0xb0, 0xbd, 0xe8, 0xf0, 0x81,
-  0xf3, 0x6b, 0xe2, 0x19, 0x9a, 0x42, 0xe7, 0xd2, 0x41, 0x46, 0x4f, 0xf4,
-  0x00, 0x73, 0x3a, 0x46, 0x30, 0x46, 0x75, 0x68, 0xfe, 0xf7, 0x80, 0xfd,
-  0x85, 0xf8, 0x40, 0x00, 0x00, 0x28, 0x37, 0xd1, 0x22, 0x46, 0x12, 0x21,
-  0x30, 0x46, 0x05, 0xab, 0x75, 0x68, 0xfe, 0xf7, 0x75, 0xfb, 0x85, 0xf8,
-  0x40, 0x00, 0x75, 0x68, 0x00, 0x28, 0x46, 0xd1, 0x80, 0x21, 0x30, 0x46,
-  0xfe, 0xf7, 0x2e, 0xfe, 0x85, 0xf8, 0x40, 0x00, 0x75, 0x68, 0x95, 0xf8,
-  0x40, 0x20, 0x01, 0x2a, 0xf4, 0xd0, 0x00, 0x2a, 0x34, 0xd0, 0x08, 0x2a,
-  0x96, 0xbf, 0x23, 0x4b, 0x23, 0x48, 0x53, 0xf8, 0x22, 0x00, 0x02, 0x92,
-  0xcd, 0xe9, 0x00, 0x70, 0x23, 0x46, 0x4f, 0xf4, 0xe2, 0x71, 0x20, 0x4a,
-  0x20, 0x48, 0x02, 0xf0, 0x95, 0xfb, 0x01, 0x21, 0x30, 0x46, 0xff, 0xf7,
-  0x2b, 0xfd, 0xbd, 0xe7, 0x01, 0x20, 0x06, 0xb0, 0xbd, 0xe8, 0xf0, 0x81,
-  0x01, 0x21, 0xff, 0xf7, 0x23, 0xfd, 0x00, 0x28, 0xa0, 0xd1, 0xb3, 0xe7,
-  0x4f, 0xf4, 0xdc, 0x72, 0x4f, 0xf4, 0xdc, 0x74, 0x73, 0x68, 0x93, 0xf8,
-  0x40, 0x00, 0xda, 0x63, 0x08, 0x28, 0x96, 0xbf, 0x0f, 0x4b, 0x10, 0x4b,
-  0x53, 0xf8, 0x20, 0x30, 0x01, 0x90, 0x49, 0x21, 0x10, 0x4a, 0x00, 0x94,
-  0x10, 0x48, 0x02, 0xf0, 0x71, 0xfb, 0x9d, 0xe7, 0x01, 0x21, 0x30, 0x46,
-  0xff, 0xf7, 0x06, 0xfd, 0x99, 0xe7, 0x40, 0xf2, 0xb9, 0x13, 0x95, 0xf8,
-  0x40, 0x00, 0xeb, 0x63, 0x08, 0x28, 0x98, 0xbf, 0x03, 0x4b, 0x40, 0xf2,
-  0xb9, 0x14, 0x94, 0xbf, 0x53, 0xf8, 0x20, 0x30, 0x01, 0x4b, 0xe3, 0xe7,
-  0xd4, 0xa5, 0x00, 0x20, 0x18, 0x9f, 0x00, 0x20, 0x8c, 0xa0, 0x00, 0x20,
-  0xf8, 0xa5, 0x00, 0x20, 0x28, 0x9f, 0x00, 0x20, 0x68, 0xa6, 0x00, 0x20,
-  0xf8, 0xb5, 0x1c, 0x46, 0x05, 0x46, 0x0f, 0x46, 0x16, 0x46, 0xfe, 0xf7,
-  0xf7, 0xf8, 0x01, 0x2c, 0x0e, 0xd0, 0x23, 0x46, 0x3a, 0x46, 0x31, 0x46,
-  0x28, 0x46, 0xff, 0xf7, 0x4f, 0xff, 0x04, 0x46, 0x28, 0x46, 0xfe, 0xf7,
-  0xef, 0xf8, 0x84, 0xf0, 0x01, 0x00, 0xc0, 0xb2, 0xc0, 0x01, 0xf8, 0xbd,
-  0x3a, 0x46, 0x31, 0x46, 0x28, 0x46, 0xff, 0xf7, 0xb1, 0xfe, 0x04, 0x46,
-  0xf0, 0xe7, 0x00, 0xbf, 0x2d, 0xe9, 0xf0, 0x43, 0x4f, 0xf0, 0x01, 0x09,
-  0x42, 0x68, 0xdf, 0xf8, 0x54, 0x80, 0x93, 0x68, 0xdf, 0xf8, 0x50, 0xe0,
-  0x03, 0xf1, 0x1e, 0x01, 0x01, 0xf0, 0x1f, 0x01, 0x11, 0x60, 0xdf, 0xf8,
-  0x48, 0xc0, 0x03, 0xeb, 0x09, 0x01, 0x0a, 0x4f, 0x0a, 0x4e, 0x0b, 0x4d,
-  0x0b, 0x4c, 0xd1, 0x60, 0x99, 0x1c, 0x03, 0x33, 0x11, 0x61, 0x53, 0x61,
-  0xc0, 0xe9, 0xae, 0x8e, 0xc0, 0xe9, 0xb0, 0xc7, 0xc0, 0xe9, 0xb2, 0x65,
-  0x80, 0xf8, 0x18, 0x90, 0xc0, 0xf8, 0xd0, 0x42, 0xbd, 0xe8, 0xf0, 0x83,
-  0x85, 0x54, 0x00, 0x20, 0x25, 0x4f, 0x00, 0x20, 0x59, 0x48, 0x00, 0x20,
-  0x8d, 0x47, 0x00, 0x20, 0x65, 0x4d, 0x00, 0x20, 0xb9, 0x46, 0x00, 0x20,
-  0xe1, 0x51, 0x00, 0x20, 0x2d, 0xe9, 0xf0, 0x41, 0x87, 0x6a, 0x27, 0xf0,
-  0x30, 0x07, 0x51, 0xb3, 0xc6, 0x6a, 0x47, 0xf0, 0x10, 0x07, 0x87, 0x62,
-  0x26, 0xf0, 0xc0, 0x06, 0x52, 0xb3, 0x46, 0xf0, 0x40, 0x06, 0x4f, 0xf0,
-  0xa0, 0x4c, 0xd0, 0xe9, 0x08, 0x54, 0x4f, 0xf0, 0x01, 0x08, 0xc6, 0x62,
-  0x00, 0x68, 0x00, 0xf1, 0x08, 0x0e, 0xa8, 0x01, 0x60, 0x44, 0x01, 0x60,
-  0x08, 0xfa, 0x05, 0xf5, 0xa1, 0x01, 0x08, 0xfa, 0x04, 0xf8, 0x61, 0x44,
-  0x45, 0xea, 0x08, 0x05, 0xc0, 0xf8, 0x04, 0xe0, 0x83, 0x60, 0x07, 0x61,
-  0xc1, 0xf8, 0x00, 0xe0, 0x4a, 0x60, 0x8b, 0x60, 0x0e, 0x61, 0xcc, 0xf8,
-  0x50, 0x54, 0xbd, 0xe8, 0xf0, 0x81, 0xc6, 0x6a, 0x03, 0x49, 0x87, 0x62,
-  0x26, 0xf0, 0xc0, 0x06, 0x00, 0x2a, 0xd4, 0xd1, 0x01, 0x4a, 0xd4, 0xe7,
-  0x98, 0x9a, 0x00, 0x20, 0xc4, 0xbd, 0x00, 0x20, 0x70, 0xb5, 0x00, 0x68,
-  0x0c, 0x46, 0x02, 0xf0, 0xff, 0xfc, 0x06, 0x46, 0xe0, 0x00, 0xfc, 0xf7,
-  0xef, 0xf9, 0x04, 0x46, 0x30, 0x46, 0x0d, 0x46, 0xfc, 0xf7, 0xea, 0xf9,
-  0x02, 0x46, 0x0b, 0x46, 0x20, 0x46, 0x29, 0x46, 0xfc, 0xf7, 0x76, 0xf9,
-  0xfc, 0xf7, 0xc2, 0xf9, 0x9f, 0xed, 0x08, 0x6a, 0x07, 0xee, 0x10, 0x0a,
-  0xf7, 0xee, 0x08, 0x6a, 0x27, 0xee, 0x06, 0x7a, 0xf1, 0xee, 0x00, 0x7a,
-  0xe7, 0xee, 0x26, 0x7a, 0xfc, 0xee, 0xe7, 0x7a, 0x17, 0xee, 0x90, 0x0a,
-  0x70, 0xbd, 0x00, 0xbf, 0x00, 0x00, 0x7a, 0x44, 0xf8, 0xb5, 0x04, 0x46,
-  0x74, 0x48, 0x03, 0xf0, 0x85, 0xff, 0x94, 0xf8, 0x38, 0x30, 0x00, 0x2b,
-  0x72, 0xd1, 0x23, 0x6b, 0x04, 0xf1, 0x30, 0x05, 0x00, 0x2b, 0x00, 0xf0,
-  0xc1, 0x80, 0x28, 0x46, 0x03, 0xf0, 0x78, 0xff, 0x20, 0x68, 0x00, 0x28,
-  0x76, 0xd0, 0x23, 0x69, 0x00, 0x2b, 0x68, 0xd0, 0x6a, 0x49, 0x02, 0xf0,
-  0xf9, 0xfb, 0x63, 0x69, 0x22, 0x68, 0x03, 0x2b, 0x73, 0xd8, 0xdf, 0xe8,
-  0x03, 0xf0, 0x72, 0x9b, 0x02, 0x86, 0x13, 0x46, 0x02, 0x27, 0x53, 0xf8,
-  0x04, 0x1f, 0x02, 0xf5, 0x80, 0x50, 0x03, 0xf5, 0x40, 0x56, 0x37, 0x60,
-  0x12, 0x68, 0x39, 0x40, 0x82, 0xf0, 0x47, 0x02, 0x03, 0xf5, 0x00, 0x53,
-  0x02, 0xf0, 0xcf, 0x02, 0x02, 0x60, 0x19, 0x60, 0x01, 0x21, 0x60, 0x68,
-  0xfa, 0xf7, 0xbc, 0xfd, 0x01, 0x21, 0xa0, 0x68, 0xfa, 0xf7, 0xb8, 0xfd,
-  0x01, 0x21, 0xe0, 0x68, 0xfa, 0xf7, 0xb4, 0xfd, 0x01, 0x21, 0xe0, 0x68,
-  0xfa, 0xf7, 0xf2, 0xfd, 0x63, 0x7e, 0x00, 0x2b, 0x40, 0xf0, 0x99, 0x80,
-  0x22, 0x7e, 0x00, 0x2a, 0x00, 0xf0, 0x90, 0x80, 0x23, 0x7f, 0x00, 0x2b,
-  0x00, 0xf0, 0x82, 0x80, 0x20, 0x6a, 0x02, 0xf0, 0x5b, 0xfa, 0x60, 0x6a,
-  0x02, 0xf0, 0x58, 0xfa, 0x60, 0x6a, 0x23, 0x6a, 0x4a, 0x49, 0x5a, 0x03,
-  0x43, 0x03, 0x20, 0x68, 0x88, 0x42, 0x4f, 0xf0, 0x01, 0x01, 0x07, 0xbf,
-  0x4f, 0xf4, 0x50, 0x1e, 0x4f, 0xf4, 0x58, 0x1c, 0x4f, 0xf4, 0x40, 0x1e,
-  0x4f, 0xf4, 0x48, 0x1c, 0x84, 0xf8, 0x38, 0x10, 0x42, 0x49, 0x28, 0x46,
-  0x0a, 0x40, 0x0b, 0x40, 0x42, 0xea, 0x0e, 0x02, 0x43, 0xea, 0x0c, 0x03,
-  0x42, 0xf0, 0x11, 0x02, 0x43, 0xf0, 0x01, 0x03, 0xc4, 0xe9, 0x0a, 0x23,
-  0x03, 0xf0, 0xb8, 0xff, 0x37, 0x48, 0x03, 0xf0, 0xb5, 0xff, 0x01, 0x20,
-  0xf8, 0xbd, 0x05, 0x20, 0xfb, 0xf7, 0x22, 0xfd, 0x03, 0x46, 0x37, 0x4a,
-  0x20, 0x68, 0xa2, 0xfb, 0x03, 0x23, 0xdb, 0x08, 0x23, 0x61, 0x8b, 0xe7,
-  0x34, 0x4b, 0x18, 0x46, 0x23, 0x60, 0x23, 0x69, 0x00, 0x2b, 0x85, 0xd1,
-  0xed, 0xe7, 0x13, 0x46, 0x02, 0x27, 0x53, 0xf8, 0x04, 0x1f, 0x02, 0xf5,
-  0x80, 0x50, 0x03, 0xf5, 0x40, 0x56, 0x37, 0x60, 0x12, 0x68, 0x39, 0x40,
-  0x82, 0xf0, 0x07, 0x02, 0x03, 0xf5, 0x00, 0x53, 0x02, 0xf0, 0xcf, 0x02,
-  0x02, 0x60, 0x19, 0x60, 0x8e, 0xe7, 0x13, 0x46, 0x02, 0x26, 0x53, 0xf8,
-  0x04, 0x1f, 0x02, 0xf5, 0x80, 0x50, 0x03, 0xf5, 0x40, 0x5c, 0xcc, 0xf8,
-  0x00, 0x60, 0x12, 0x68, 0x31, 0x40, 0x82, 0xf0, 0xc7, 0x02, 0x03, 0xf5,
-  0x00, 0x53, 0x02, 0xf0, 0xcf, 0x02, 0x02, 0x60, 0x19, 0x60, 0x79, 0xe7,
-  0x13, 0x46, 0x02, 0x27, 0x53, 0xf8, 0x04, 0x1f, 0x02, 0xf5, 0x80, 0x50,
-  0x03, 0xf5, 0x40, 0x56, 0x37, 0x60, 0x12, 0x68, 0x39, 0x40, 0x82, 0xf0,
-  0x87, 0x02, 0x03, 0xf5, 0x00, 0x53, 0x02, 0xf0, 0xcf, 0x02, 0x02, 0x60,
-  0x19, 0x60, 0x65, 0xe7, 0x28, 0x46, 0xfb, 0xf7, 0x93, 0xf8, 0x3a, 0xe7,
-  0x01, 0x20, 0x02, 0xf0, 0xe3, 0xf9, 0x03, 0x46, 0x01, 0x20, 0x23, 0x62,
-  0x02, 0xf0, 0xde, 0xf9, 0x60, 0x62, 0x7a, 0xe7, 0x01, 0x21, 0x60, 0x68,
-  0xfa, 0xf7, 0x32, 0xfd, 0x6a, 0xe7, 0xa1, 0x7e, 0xa0, 0x68, 0xfa, 0xf7,
-  0x5f, 0xfd, 0xe1, 0x7e, 0xe0, 0x68, 0xfa, 0xf7, 0x5b, 0xfd, 0x5d, 0xe7,
-  0xe0, 0xbd, 0x00, 0x20, 0xa0, 0x86, 0x01, 0x00, 0x00, 0x80, 0x08, 0x40,
-  0xfd, 0xff, 0x01, 0xfc, 0xab, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x08, 0x40,
-  0x00, 0x22, 0x38, 0xb5, 0x03, 0x7e, 0x41, 0x68, 0x43, 0xf0, 0x01, 0x03,
-  0x03, 0x76, 0x42, 0x76, 0x04, 0x46, 0x48, 0x68, 0x43, 0x1c, 0x00, 0xd1,
-  0x38, 0xbd, 0x15, 0x46, 0xfa, 0xf7, 0x72, 0xfd, 0x63, 0x68, 0x5b, 0x68,
-  0x45, 0xec, 0x44, 0x30, 0x38, 0xbd, 0x00, 0xbf, 0x0a, 0x4b, 0x02, 0x78,
-  0x41, 0x78, 0x13, 0xf8, 0x02, 0xc0, 0x82, 0x78, 0x81, 0xea, 0x4c, 0x01,
-  0x59, 0x5c, 0x82, 0xea, 0x41, 0x02, 0x13, 0xf8, 0x02, 0xc0, 0xc1, 0x78,
-  0x02, 0x79, 0x81, 0xea, 0x4c, 0x01, 0x59, 0x5c, 0x82, 0xea, 0x41, 0x02,
-  0x98, 0x5c, 0x70, 0x47, 0xb4, 0xb8, 0x00, 0x20, 0x2d, 0xe9, 0xf0, 0x41,
-  0x05, 0x46, 0x82, 0xb0, 0x88, 0x46, 0xfb, 0xf7, 0xf5, 0xfb, 0x4f, 0xf4,
-  0x7a, 0x72, 0x00, 0x23, 0x02, 0xf0, 0x30, 0xfc, 0x07, 0x46, 0x20, 0x4e,
-  0xff, 0x23, 0x8d, 0xf8, 0x06, 0x30, 0x8d, 0xf8, 0x07, 0x30, 0xfb, 0xf7,
-  0xe7, 0xfb, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x02, 0xf0, 0x22, 0xfc,
-  0x04, 0x46, 0x0a, 0xe0, 0xfb, 0xf7, 0xde, 0xfb, 0x00, 0x23, 0x4f, 0xf4,
-  0x7a, 0x72, 0x02, 0xf0, 0x19, 0xfc, 0x73, 0x69, 0x00, 0x1b, 0x98, 0x42,
-  0x1e, 0xd2, 0x6b, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68, 0x9b, 0x07,
-  0xee, 0xd5, 0x01, 0x23, 0x0d, 0xf1, 0x07, 0x02, 0x0d, 0xf1, 0x06, 0x01,
-  0x04, 0xf0, 0xf4, 0xf8, 0x9d, 0xf8, 0x07, 0x30, 0xff, 0x2b, 0x11, 0xd0,
-  0xfb, 0xf7, 0xc2, 0xfb, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x02, 0xf0,
-  0xfd, 0xfb, 0xc0, 0x1b, 0x40, 0x45, 0xcb, 0xd3, 0x00, 0x20, 0x02, 0xb0,
-  0xbd, 0xe8, 0xf0, 0x81, 0x6b, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xe2, 0xe7,
-  0x01, 0x20, 0x02, 0xb0, 0xbd, 0xe8, 0xf0, 0x81, 0x8c, 0xbd, 0x00, 0x20,
-  0x2d, 0xe9, 0xf0, 0x47, 0x05, 0x46, 0x82, 0xb0, 0x89, 0x46, 0x92, 0x46,
-  0xfb, 0xf7, 0xa4, 0xfb, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x02, 0xf0,
-  0xdf, 0xfb, 0x4f, 0xf0, 0xff, 0x08, 0x07, 0x46, 0x51, 0x4e, 0x8d, 0xf8,
-  0x07, 0x80, 0xfb, 0xf7, 0x97, 0xfb, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23,
-  0x02, 0xf0, 0xd2, 0xfb, 0x04, 0x46, 0x0a, 0xe0, 0xfb, 0xf7, 0x8e, 0xfb,
-  0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72, 0x02, 0xf0, 0xc9, 0xfb, 0xf3, 0x68,
-  0x00, 0x1b, 0x98, 0x42, 0x1e, 0xd2, 0x6b, 0x68, 0x1b, 0x68, 0x18, 0x68,
-  0xc3, 0x68, 0x99, 0x07, 0xee, 0xd5, 0x01, 0x23, 0xff, 0x21, 0x0d, 0xf1,
-  0x07, 0x02, 0x04, 0xf0, 0x35, 0xf9, 0x9d, 0xf8, 0x07, 0x30, 0xfe, 0x2b,
-  0x12, 0xd0, 0xfb, 0xf7, 0x73, 0xfb, 0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72,
-  0x02, 0xf0, 0xae, 0xfb, 0x33, 0x68, 0xc0, 0x1b, 0x98, 0x42, 0xce, 0xd3,
-  0x80, 0x20, 0x02, 0xb0, 0xbd, 0xe8, 0xf0, 0x87, 0x6b, 0x68, 0x1b, 0x68,
-  0x18, 0x68, 0xe2, 0xe7, 0x6b, 0x68, 0x4a, 0x46, 0x18, 0x68, 0x00, 0x21,
-  0x53, 0x46, 0x04, 0xf0, 0x15, 0xf8, 0x00, 0x28, 0xee, 0xd0, 0xff, 0x23,
-  0x8d, 0xf8, 0x07, 0x30, 0xfb, 0xf7, 0x54, 0xfb, 0x4f, 0xf4, 0x7a, 0x72,
-  0x00, 0x23, 0x02, 0xf0, 0x8f, 0xfb, 0x2b, 0x4e, 0x04, 0x46, 0x0a, 0xe0,
-  0xfb, 0xf7, 0x4a, 0xfb, 0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72, 0x02, 0xf0,
-  0x85, 0xfb, 0xf3, 0x68, 0x00, 0x1b, 0x98, 0x42, 0x40, 0xd2, 0x6b, 0x68,
-  0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68, 0x9a, 0x07, 0xee, 0xd5, 0x01, 0x23,
-  0xff, 0x21, 0x0d, 0xf1, 0x07, 0x02, 0x04, 0xf0, 0xf1, 0xf8, 0xff, 0x23,
-  0x9d, 0xf8, 0x07, 0x70, 0x8d, 0xf8, 0x07, 0x30, 0x3f, 0x02, 0xfb, 0xf7,
-  0x2d, 0xfb, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x02, 0xf0, 0x68, 0xfb,
-  0x17, 0x4e, 0x04, 0x46, 0x0a, 0xe0, 0xfb, 0xf7, 0x23, 0xfb, 0x00, 0x23,
-  0x4f, 0xf4, 0x7a, 0x72, 0x02, 0xf0, 0x5e, 0xfb, 0xf3, 0x68, 0x00, 0x1b,
-  0x98, 0x42, 0x1d, 0xd2, 0x6b, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68,
-  0x9b, 0x07, 0xee, 0xd5, 0x01, 0x23, 0x0d, 0xf1, 0x07, 0x02, 0xff, 0x21,
-  0x04, 0xf0, 0xca, 0xf8, 0x51, 0x46, 0x48, 0x46, 0x9d, 0xf8, 0x07, 0x40,
-  0x01, 0xf0, 0xce, 0xff, 0x3c, 0x43, 0x20, 0x1a, 0x18, 0xbf, 0x01, 0x20,
-  0x00, 0x02, 0x02, 0xb0, 0xbd, 0xe8, 0xf0, 0x87, 0x6b, 0x68, 0x1b, 0x68,
-  0x18, 0x68, 0xc0, 0xe7, 0x6b, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xe3, 0xe7,
-  0x8c, 0xbd, 0x00, 0x20, 0x00, 0x23, 0x2d, 0xe9, 0xf0, 0x43, 0x89, 0x46,
-  0x41, 0xf0, 0x40, 0x01, 0x61, 0xf3, 0x07, 0x03, 0x11, 0x0e, 0x85, 0xb0,
-  0x61, 0xf3, 0x0f, 0x23, 0x11, 0x0c, 0x8d, 0xf8, 0x0c, 0x20, 0x61, 0xf3,
-  0x17, 0x43, 0x12, 0x0a, 0x62, 0xf3, 0x1f, 0x63, 0x04, 0x46, 0x02, 0xa8,
-  0x02, 0x93, 0xff, 0xf7, 0xc9, 0xfe, 0x43, 0x00, 0x43, 0xf0, 0x01, 0x03,
-  0x4a, 0x4e, 0x02, 0xaf, 0x8d, 0xf8, 0x0d, 0x30, 0x0d, 0xf1, 0x0e, 0x08,
-  0x17, 0xf8, 0x01, 0x3b, 0x8d, 0xf8, 0x07, 0x30, 0xfb, 0xf7, 0xce, 0xfa,
-  0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x02, 0xf0, 0x09, 0xfb, 0x05, 0x46,
-  0x0a, 0xe0, 0xfb, 0xf7, 0xc5, 0xfa, 0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72,
-  0x02, 0xf0, 0x00, 0xfb, 0x33, 0x69, 0x40, 0x1b, 0x98, 0x42, 0x44, 0xd2,
-  0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68, 0x99, 0x07, 0xee, 0xd5,
-  0x01, 0x22, 0x0d, 0xf1, 0x07, 0x01, 0x04, 0xf0, 0x25, 0xf8, 0xb8, 0x45,
-  0xda, 0xd1, 0xb9, 0xf1, 0x0c, 0x0f, 0x3f, 0xd0, 0x10, 0x27, 0x4f, 0xf0,
-  0xff, 0x08, 0x32, 0x4e, 0x8d, 0xf8, 0x07, 0x80, 0xfb, 0xf7, 0xa4, 0xfa,
-  0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x02, 0xf0, 0xdf, 0xfa, 0x05, 0x46,
-  0x0a, 0xe0, 0xfb, 0xf7, 0x9b, 0xfa, 0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72,
-  0x02, 0xf0, 0xd6, 0xfa, 0xf3, 0x68, 0x40, 0x1b, 0x98, 0x42, 0x16, 0xd2,
-  0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68, 0x9b, 0x07, 0xee, 0xd5,
-  0x01, 0x23, 0xff, 0x21, 0x0d, 0xf1, 0x07, 0x02, 0x04, 0xf0, 0x42, 0xf8,
-  0x9d, 0xf9, 0x07, 0x30, 0x9d, 0xf8, 0x07, 0x00, 0x00, 0x2b, 0x01, 0xda,
-  0x01, 0x3f, 0xd5, 0xd1, 0x05, 0xb0, 0xbd, 0xe8, 0xf0, 0x83, 0x63, 0x68,
-  0x1b, 0x68, 0x18, 0x68, 0xea, 0xe7, 0x63, 0x68, 0x01, 0x22, 0x1b, 0x68,
-  0x0d, 0xf1, 0x07, 0x01, 0x18, 0x68, 0x03, 0xf0, 0xe3, 0xff, 0xb8, 0x45,
-  0x98, 0xd1, 0xbc, 0xe7, 0xff, 0x23, 0x8d, 0xf8, 0x07, 0x30, 0xfb, 0xf7,
-  0x67, 0xfa, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x02, 0xf0, 0xa2, 0xfa,
-  0x0e, 0x4e, 0x05, 0x46, 0x0a, 0xe0, 0xfb, 0xf7, 0x5d, 0xfa, 0x00, 0x23,
-  0x4f, 0xf4, 0x7a, 0x72, 0x02, 0xf0, 0x98, 0xfa, 0x33, 0x69, 0x40, 0x1b,
-  0x98, 0x42, 0x0b, 0xd2, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68,
-  0x9a, 0x07, 0xee, 0xd5, 0x01, 0x22, 0x0d, 0xf1, 0x07, 0x01, 0x03, 0xf0,
-  0xbd, 0xff, 0x9b, 0xe7, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xf5, 0xe7,
-  0x8c, 0xbd, 0x00, 0x20, 0xf0, 0xb5, 0x03, 0x6c, 0x04, 0x46, 0x83, 0xb0,
-  0x00, 0x2b, 0x00, 0xf0, 0xb1, 0x80, 0x20, 0x46, 0xfd, 0xf7, 0x56, 0xfd,
-  0x63, 0x68, 0x18, 0x68, 0x30, 0x30, 0x03, 0xf0, 0x9b, 0xfc, 0x63, 0x68,
-  0x5b, 0x68, 0x5a, 0x1c, 0x26, 0xd0, 0x4f, 0xf0, 0x00, 0x02, 0x42, 0xec,
-  0x40, 0x30, 0xff, 0x23, 0x8d, 0xf8, 0x07, 0x30, 0xfb, 0xf7, 0x26, 0xfa,
-  0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x02, 0xf0, 0x61, 0xfa, 0x4d, 0x4e,
-  0x05, 0x46, 0x0a, 0xe0, 0xfb, 0xf7, 0x1c, 0xfa, 0x00, 0x23, 0x4f, 0xf4,
-  0x7a, 0x72, 0x02, 0xf0, 0x57, 0xfa, 0x33, 0x69, 0x40, 0x1b, 0x98, 0x42,
-  0x7e, 0xd2, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68, 0x9f, 0x07,
-  0xee, 0xd5, 0x01, 0x22, 0x0d, 0xf1, 0x07, 0x01, 0x03, 0xf0, 0x7c, 0xff,
-  0x21, 0x7e, 0x11, 0xf0, 0x01, 0x05, 0x3c, 0xd1, 0x29, 0x46, 0x20, 0x46,
-  0xff, 0xf7, 0x04, 0xfe, 0x00, 0x28, 0x54, 0xd1, 0x01, 0x27, 0x63, 0x68,
-  0x5a, 0x68, 0x51, 0x1c, 0x27, 0xd0, 0x4f, 0xf0, 0x01, 0x03, 0x43, 0xec,
-  0x40, 0x20, 0xff, 0x23, 0x8d, 0xf8, 0x07, 0x30, 0xfb, 0xf7, 0xf0, 0xf9,
-  0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x02, 0xf0, 0x2b, 0xfa, 0x32, 0x4e,
-  0x05, 0x46, 0x0a, 0xe0, 0xfb, 0xf7, 0xe6, 0xf9, 0x00, 0x23, 0x4f, 0xf4,
-  0x7a, 0x72, 0x02, 0xf0, 0x21, 0xfa, 0x33, 0x69, 0x40, 0x1b, 0x98, 0x42,
-  0x44, 0xd2, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68, 0x9b, 0x07,
-  0xee, 0xd5, 0x01, 0x22, 0x0d, 0xf1, 0x07, 0x01, 0x03, 0xf0, 0x46, 0xff,
-  0x63, 0x68, 0x18, 0x68, 0x30, 0x30, 0x03, 0xf0, 0xdf, 0xfc, 0x20, 0x46,
-  0xfd, 0xf7, 0xec, 0xfc, 0x38, 0x46, 0x03, 0xb0, 0xf0, 0xbd, 0x00, 0x25,
-  0x20, 0x46, 0x65, 0x76, 0x01, 0xf0, 0xd6, 0xfc, 0x20, 0x46, 0x01, 0xf0,
-  0xdb, 0xfc, 0x29, 0x46, 0x20, 0x46, 0xff, 0xf7, 0xbf, 0xfd, 0x68, 0xb3,
-  0x19, 0x4e, 0x73, 0x68, 0x1b, 0xb9, 0x29, 0xe0, 0x73, 0x68, 0xab, 0x42,
-  0x26, 0xd9, 0x00, 0x22, 0x20, 0x46, 0x11, 0x46, 0xff, 0xf7, 0xb8, 0xfe,
-  0xff, 0x28, 0x05, 0xf1, 0x01, 0x05, 0xf3, 0xd0, 0xaa, 0xe7, 0x11, 0x4e,
-  0x73, 0x68, 0x1b, 0xb9, 0x14, 0xe0, 0x73, 0x68, 0xab, 0x42, 0x11, 0xd9,
-  0x00, 0x22, 0x0d, 0x21, 0x20, 0x46, 0xff, 0xf7, 0xa7, 0xfe, 0xff, 0x28,
-  0x05, 0xf1, 0x01, 0x05, 0xf3, 0xd0, 0x99, 0xe7, 0x63, 0x68, 0x1b, 0x68,
-  0x18, 0x68, 0xbc, 0xe7, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0x82, 0xe7,
-  0x23, 0x7e, 0x43, 0xf0, 0x01, 0x03, 0x23, 0x76, 0x00, 0x27, 0x8c, 0xe7,
-  0x40, 0x30, 0xfa, 0xf7, 0xcb, 0xfd, 0x4a, 0xe7, 0x8c, 0xbd, 0x00, 0x20,
-  0x2d, 0xe9, 0xf0, 0x43, 0x85, 0xb0, 0x04, 0x46, 0x0a, 0x26, 0x01, 0xf0,
-  0x91, 0xfc, 0x4f, 0xf0, 0x01, 0x08, 0x4f, 0xf0, 0x00, 0x07, 0x4b, 0x4d,
-  0x63, 0x68, 0x5b, 0x68, 0x58, 0x1c, 0x23, 0xd0, 0x48, 0xec, 0x40, 0x30,
-  0xff, 0x23, 0x8d, 0xf8, 0x04, 0x30, 0xfb, 0xf7, 0x6d, 0xf9, 0x4f, 0xf4,
-  0x7a, 0x72, 0x00, 0x23, 0x02, 0xf0, 0xa8, 0xf9, 0x81, 0x46, 0x0b, 0xe0,
-  0xfb, 0xf7, 0x64, 0xf9, 0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72, 0x02, 0xf0,
-  0x9f, 0xf9, 0x2b, 0x69, 0xa0, 0xeb, 0x09, 0x00, 0x98, 0x42, 0x63, 0xd2,
-  0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68, 0x99, 0x07, 0xed, 0xd5,
-  0x01, 0x22, 0x01, 0xa9, 0x03, 0xf0, 0xc4, 0xfe, 0x4f, 0xf0, 0xff, 0x33,
-  0xcd, 0xe9, 0x01, 0x33, 0xad, 0xf8, 0x0c, 0x30, 0xfb, 0xf7, 0x48, 0xf9,
-  0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x02, 0xf0, 0x83, 0xf9, 0x81, 0x46,
-  0x60, 0x68, 0x0a, 0x23, 0x00, 0x22, 0x01, 0xa9, 0x00, 0x68, 0x03, 0xf0,
-  0xf5, 0xfd, 0xfb, 0xf7, 0x39, 0xf9, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23,
-  0x02, 0xf0, 0x74, 0xf9, 0x81, 0x45, 0xef, 0xd0, 0x63, 0x68, 0x5b, 0x68,
-  0x5a, 0x1c, 0x24, 0xd0, 0x47, 0xec, 0x40, 0x30, 0xff, 0x23, 0x8d, 0xf8,
-  0x03, 0x30, 0xfb, 0xf7, 0x27, 0xf9, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23,
-  0x02, 0xf0, 0x62, 0xf9, 0x81, 0x46, 0x0b, 0xe0, 0xfb, 0xf7, 0x1e, 0xf9,
-  0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72, 0x02, 0xf0, 0x59, 0xf9, 0x2b, 0x69,
-  0xa0, 0xeb, 0x09, 0x00, 0x98, 0x42, 0x21, 0xd2, 0x63, 0x68, 0x1b, 0x68,
-  0x18, 0x68, 0xc3, 0x68, 0x9b, 0x07, 0xed, 0xd5, 0x01, 0x22, 0x0d, 0xf1,
-  0x03, 0x01, 0x03, 0xf0, 0x7d, 0xfe, 0x68, 0x68, 0x58, 0xb1, 0x4f, 0xf0,
-  0x00, 0x09, 0x00, 0x22, 0x20, 0x46, 0x11, 0x46, 0xff, 0xf7, 0x0a, 0xfe,
-  0xff, 0x28, 0x0f, 0xd0, 0x10, 0xf0, 0x7e, 0x0f, 0x12, 0xd0, 0x01, 0x3e,
-  0x80, 0xd1, 0x05, 0xb0, 0xbd, 0xe8, 0xf0, 0x83, 0x63, 0x68, 0x1b, 0x68,
-  0x18, 0x68, 0x9d, 0xe7, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xdf, 0xe7,
-  0x6b, 0x68, 0x09, 0xf1, 0x01, 0x09, 0x99, 0x45, 0xe3, 0xd3, 0xec, 0xe7,
-  0x01, 0x28, 0xea, 0xd1, 0x05, 0xb0, 0xbd, 0xe8, 0xf0, 0x83, 0x00, 0xbf,
-  0x8c, 0xbd, 0x00, 0x20, 0xff, 0x23, 0xf0, 0xb5, 0x87, 0xb0, 0x04, 0x46,
-  0x0f, 0x46, 0x8d, 0xf8, 0x16, 0x20, 0x8d, 0xf8, 0x17, 0x30, 0xfb, 0xf7,
-  0xd5, 0xf8, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x02, 0xf0, 0x10, 0xf9,
-  0x6d, 0x4e, 0x05, 0x46, 0x0b, 0xe0, 0xfb, 0xf7, 0xcb, 0xf8, 0x00, 0x23,
-  0x4f, 0xf4, 0x7a, 0x72, 0x02, 0xf0, 0x06, 0xf9, 0x73, 0x69, 0x40, 0x1b,
-  0x98, 0x42, 0x80, 0xf0, 0xbb, 0x80, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68,
-  0xc3, 0x68, 0x9b, 0x07, 0xed, 0xd5, 0x01, 0x23, 0x0d, 0xf1, 0x17, 0x02,
-  0x0d, 0xf1, 0x16, 0x01, 0x03, 0xf0, 0xe0, 0xfd, 0x9d, 0xf8, 0x17, 0x30,
-  0x00, 0x2b, 0x00, 0xf0, 0xa4, 0x80, 0x62, 0x68, 0x4f, 0xf4, 0x00, 0x73,
-  0x39, 0x46, 0x10, 0x68, 0x00, 0x22, 0xff, 0xf7, 0x1d, 0xfb, 0x4f, 0xf4,
-  0x00, 0x71, 0x38, 0x46, 0x01, 0xf0, 0x68, 0xfd, 0x63, 0x68, 0x4f, 0xf4,
-  0x00, 0x71, 0x07, 0x46, 0x18, 0x68, 0xff, 0xf7, 0x4f, 0xfb, 0x63, 0x68,
-  0x01, 0x46, 0x18, 0x68, 0x03, 0xf0, 0xcc, 0xfc, 0x00, 0x28, 0x00, 0xf0,
-  0x88, 0x80, 0x3b, 0x0a, 0x8d, 0xf8, 0x17, 0x30, 0xfb, 0xf7, 0x8e, 0xf8,
-  0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x02, 0xf0, 0xc9, 0xf8, 0x4a, 0x4d,
-  0x06, 0x46, 0x0a, 0xe0, 0xfb, 0xf7, 0x84, 0xf8, 0x4f, 0xf4, 0x7a, 0x72,
-  0x00, 0x23, 0x02, 0xf0, 0xbf, 0xf8, 0x2a, 0x69, 0x83, 0x1b, 0x93, 0x42,
-  0x7a, 0xd2, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68, 0x99, 0x07,
-  0xee, 0xd5, 0x01, 0x22, 0x0d, 0xf1, 0x17, 0x01, 0x03, 0xf0, 0xe4, 0xfd,
-  0x8d, 0xf8, 0x17, 0x70, 0xfb, 0xf7, 0x6c, 0xf8, 0x4f, 0xf4, 0x7a, 0x72,
-  0x00, 0x23, 0x02, 0xf0, 0xa7, 0xf8, 0x06, 0x46, 0x0a, 0xe0, 0xfb, 0xf7,
-  0x63, 0xf8, 0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72, 0x02, 0xf0, 0x9e, 0xf8,
-  0x2b, 0x69, 0x80, 0x1b, 0x98, 0x42, 0x61, 0xd2, 0x63, 0x68, 0x1b, 0x68,
-  0x18, 0x68, 0xc3, 0x68, 0x9a, 0x07, 0xee, 0xd5, 0x01, 0x22, 0x0d, 0xf1,
-  0x17, 0x01, 0x03, 0xf0, 0xc3, 0xfd, 0xff, 0x23, 0x8d, 0xf8, 0x17, 0x30,
-  0xfb, 0xf7, 0x4a, 0xf8, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x02, 0xf0,
-  0x85, 0xf8, 0x06, 0x46, 0x0a, 0xe0, 0xfb, 0xf7, 0x41, 0xf8, 0x00, 0x23,
-  0x4f, 0xf4, 0x7a, 0x72, 0x02, 0xf0, 0x7c, 0xf8, 0xeb, 0x68, 0x80, 0x1b,
-  0x98, 0x42, 0x3b, 0xd2, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68,
-  0x9b, 0x07, 0xee, 0xd5, 0x01, 0x23, 0xff, 0x21, 0x0d, 0xf1, 0x17, 0x02,
-  0x03, 0xf0, 0xe8, 0xfd, 0x9d, 0xf8, 0x17, 0x60, 0x06, 0xf0, 0x1f, 0x03,
-  0x05, 0x2b, 0x23, 0xd0, 0x20, 0x46, 0xfd, 0xf7, 0x71, 0xfb, 0xc6, 0xf3,
-  0x40, 0x07, 0x03, 0x97, 0x00, 0x96, 0xc6, 0xf3, 0x80, 0x07, 0xc6, 0xf3,
-  0xc0, 0x06, 0x03, 0x46, 0x01, 0x96, 0x40, 0xf2, 0xf3, 0x31, 0x12, 0x4a,
-  0x12, 0x48, 0x02, 0x97, 0x01, 0xf0, 0x82, 0xfd, 0x4f, 0xf4, 0x80, 0x66,
-  0x20, 0x46, 0x29, 0x68, 0xff, 0xf7, 0x10, 0xfc, 0x08, 0xb9, 0x4f, 0xf4,
-  0x80, 0x66, 0x30, 0x46, 0x07, 0xb0, 0xf0, 0xbd, 0x63, 0x68, 0x1b, 0x68,
-  0x18, 0x68, 0x46, 0xe7, 0x00, 0x26, 0xef, 0xe7, 0x63, 0x68, 0x1b, 0x68,
-  0x18, 0x68, 0x86, 0xe7, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc5, 0xe7,
-  0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0x9f, 0xe7, 0x8c, 0xbd, 0x00, 0x20,
-  0xf8, 0xa1, 0x00, 0x20, 0x84, 0xa6, 0x00, 0x20, 0x70, 0xb5, 0x3e, 0x4d,
-  0x04, 0x46, 0x29, 0x68, 0xff, 0xf7, 0xec, 0xfb, 0x60, 0xb1, 0x6b, 0x68,
-  0x00, 0x26, 0x5b, 0xb1, 0x00, 0x22, 0x09, 0x21, 0x20, 0x46, 0xff, 0xf7,
-  0xe9, 0xfc, 0xff, 0x28, 0x24, 0xd0, 0x10, 0xf0, 0x7e, 0x0f, 0x01, 0xd0,
-  0x00, 0x20, 0x70, 0xbd, 0x04, 0xf1, 0x1a, 0x05, 0x10, 0x22, 0x29, 0x46,
-  0x20, 0x46, 0xff, 0xf7, 0x25, 0xfc, 0x00, 0x28, 0xf4, 0xd1, 0xa3, 0x7e,
-  0x9b, 0x09, 0x18, 0xd0, 0x01, 0x2b, 0xef, 0xd1, 0x02, 0x46, 0xa5, 0xeb,
-  0xd2, 0x03, 0x5b, 0x7a, 0x02, 0xf0, 0x07, 0x01, 0x0b, 0x41, 0x03, 0xf0,
-  0x01, 0x03, 0x93, 0x40, 0x01, 0x32, 0x16, 0x2a, 0x40, 0xea, 0x03, 0x00,
-  0xf1, 0xd1, 0x01, 0x30, 0x80, 0x02, 0x70, 0xbd, 0x6b, 0x68, 0x01, 0x36,
-  0x9e, 0x42, 0xcf, 0xd3, 0xd8, 0xe7, 0x94, 0xf8, 0x21, 0x10, 0x94, 0xf8,
-  0x22, 0x00, 0x94, 0xf8, 0x20, 0x30, 0x01, 0xf0, 0x01, 0x05, 0xc0, 0xf3,
-  0x80, 0x12, 0x42, 0xea, 0x85, 0x02, 0x03, 0xf0, 0x01, 0x05, 0xc0, 0x11,
-  0x42, 0xea, 0x85, 0x22, 0x42, 0xea, 0x40, 0x02, 0x88, 0x00, 0x00, 0xf0,
-  0x08, 0x00, 0x02, 0x43, 0x88, 0x00, 0x00, 0xf0, 0x10, 0x00, 0x02, 0x43,
-  0x88, 0x00, 0x00, 0xf0, 0x20, 0x00, 0x02, 0x43, 0x88, 0x00, 0x00, 0xf0,
-  0x40, 0x00, 0x02, 0x43, 0x88, 0x00, 0x00, 0xf0, 0x80, 0x00, 0x02, 0x43,
-  0x88, 0x00, 0x00, 0xf4, 0x80, 0x70, 0x94, 0xf8, 0x23, 0x50, 0x02, 0x43,
-  0xc9, 0x11, 0x98, 0x02, 0x00, 0xf4, 0x00, 0x60, 0x42, 0xea, 0x41, 0x23,
-  0x94, 0xf8, 0x24, 0x40, 0x18, 0x43, 0x6b, 0x00, 0x05, 0xf0, 0x01, 0x05,
-  0x6d, 0x00, 0x45, 0xea, 0xd4, 0x15, 0x03, 0xf0, 0x04, 0x03, 0x2b, 0x43,
-  0x02, 0x33, 0x01, 0x30, 0x98, 0x40, 0x70, 0xbd, 0x8c, 0xbd, 0x00, 0x20,
-  0xf0, 0xb5, 0x04, 0x46, 0x83, 0xb0, 0xfd, 0xf7, 0x87, 0xfa, 0x63, 0x68,
-  0x18, 0x68, 0x30, 0x30, 0x03, 0xf0, 0xcc, 0xf9, 0x63, 0x68, 0x5b, 0x68,
-  0x5a, 0x1c, 0x26, 0xd0, 0x4f, 0xf0, 0x00, 0x02, 0x42, 0xec, 0x40, 0x30,
-  0xff, 0x23, 0x8d, 0xf8, 0x07, 0x30, 0xfa, 0xf7, 0x57, 0xff, 0x4f, 0xf4,
-  0x7a, 0x72, 0x00, 0x23, 0x01, 0xf0, 0x92, 0xff, 0x2d, 0x4e, 0x05, 0x46,
-  0x0a, 0xe0, 0xfa, 0xf7, 0x4d, 0xff, 0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72,
-  0x01, 0xf0, 0x88, 0xff, 0x33, 0x69, 0x40, 0x1b, 0x98, 0x42, 0x44, 0xd2,
-  0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68, 0x9f, 0x07, 0xee, 0xd5,
-  0x01, 0x22, 0x0d, 0xf1, 0x07, 0x01, 0x03, 0xf0, 0xad, 0xfc, 0x20, 0x46,
-  0xff, 0xf7, 0x48, 0xff, 0x63, 0x68, 0x07, 0x46, 0x5a, 0x68, 0x51, 0x1c,
-  0x27, 0xd0, 0x4f, 0xf0, 0x01, 0x03, 0x43, 0xec, 0x40, 0x20, 0xff, 0x23,
-  0x8d, 0xf8, 0x07, 0x30, 0xfa, 0xf7, 0x28, 0xff, 0x4f, 0xf4, 0x7a, 0x72,
-  0x00, 0x23, 0x01, 0xf0, 0x63, 0xff, 0x16, 0x4e, 0x05, 0x46, 0x0a, 0xe0,
-  0xfa, 0xf7, 0x1e, 0xff, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x01, 0xf0,
-  0x59, 0xff, 0x32, 0x69, 0x43, 0x1b, 0x93, 0x42, 0x19, 0xd2, 0x63, 0x68,
-  0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68, 0x9b, 0x07, 0xee, 0xd5, 0x01, 0x22,
-  0x0d, 0xf1, 0x07, 0x01, 0x03, 0xf0, 0x7e, 0xfc, 0x63, 0x68, 0x18, 0x68,
-  0x30, 0x30, 0x03, 0xf0, 0x17, 0xfa, 0x20, 0x46, 0xfd, 0xf7, 0x24, 0xfa,
-  0x38, 0x46, 0x03, 0xb0, 0xf0, 0xbd, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68,
-  0xbc, 0xe7, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xe7, 0xe7, 0x00, 0xbf,
-  0x8c, 0xbd, 0x00, 0x20, 0x2d, 0xe9, 0xf0, 0x47, 0x0c, 0x29, 0x0f, 0x46,
-  0x04, 0x46, 0x15, 0x46, 0x98, 0x46, 0x96, 0x4e, 0x84, 0xb0, 0x02, 0xd0,
-  0x00, 0x29, 0x40, 0xf0, 0xe8, 0x80, 0x73, 0x68, 0x4f, 0xf0, 0x00, 0x09,
-  0x00, 0x2b, 0x00, 0xf0, 0x85, 0x81, 0x2a, 0x46, 0x39, 0x46, 0x20, 0x46,
-  0xff, 0xf7, 0xe6, 0xfb, 0xff, 0x28, 0x03, 0x46, 0x00, 0xf0, 0xec, 0x80,
-  0xb8, 0xf1, 0x00, 0x0f, 0x01, 0xd0, 0xc8, 0xf8, 0x00, 0x00, 0x05, 0x07,
-  0x04, 0xd5, 0x4f, 0xf4, 0x80, 0x70, 0x04, 0xb0, 0xbd, 0xe8, 0xf0, 0x87,
-  0x41, 0x07, 0x00, 0xf1, 0xe9, 0x80, 0x10, 0xf0, 0x12, 0x0f, 0x40, 0xf0,
-  0xd0, 0x80, 0x00, 0xf0, 0x60, 0x05, 0x00, 0x3d, 0x18, 0xbf, 0x01, 0x25,
-  0x26, 0x2f, 0x4f, 0xea, 0x85, 0x05, 0x00, 0xf3, 0xcb, 0x80, 0x07, 0x2f,
-  0x40, 0xf3, 0xb0, 0x80, 0x08, 0x3f, 0x05, 0x2f, 0x00, 0xf2, 0xac, 0x80,
-  0xdf, 0xe8, 0x17, 0xf0, 0x06, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00,
-  0xdc, 0x00, 0xe3, 0x00, 0x02, 0x23, 0x63, 0x76, 0xff, 0x23, 0x8d, 0xf8,
-  0x0f, 0x30, 0xfa, 0xf7, 0xa5, 0xfe, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23,
-  0x01, 0xf0, 0xe0, 0xfe, 0x07, 0x46, 0x0b, 0xe0, 0xfa, 0xf7, 0x9c, 0xfe,
-  0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72, 0x01, 0xf0, 0xd7, 0xfe, 0xf3, 0x68,
-  0xc0, 0x1b, 0x98, 0x42, 0x80, 0xf0, 0x26, 0x81, 0x63, 0x68, 0x1b, 0x68,
-  0x18, 0x68, 0xc3, 0x68, 0x9a, 0x07, 0xed, 0xd5, 0x01, 0x23, 0xff, 0x21,
-  0x0d, 0xf1, 0x0f, 0x02, 0x03, 0xf0, 0x42, 0xfc, 0xff, 0x23, 0x9d, 0xf8,
-  0x0f, 0x90, 0x8d, 0xf8, 0x0f, 0x30, 0x4f, 0xea, 0x09, 0x69, 0xfa, 0xf7,
-  0x7d, 0xfe, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x01, 0xf0, 0xb8, 0xfe,
-  0x07, 0x46, 0x0b, 0xe0, 0xfa, 0xf7, 0x74, 0xfe, 0x00, 0x23, 0x4f, 0xf4,
-  0x7a, 0x72, 0x01, 0xf0, 0xaf, 0xfe, 0xf3, 0x68, 0xc0, 0x1b, 0x98, 0x42,
-  0x80, 0xf0, 0x02, 0x81, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68,
-  0x9b, 0x07, 0xed, 0xd5, 0x0d, 0xf1, 0x0f, 0x02, 0x01, 0x23, 0xff, 0x21,
-  0x03, 0xf0, 0x1a, 0xfc, 0xff, 0x22, 0x9d, 0xf8, 0x0f, 0x30, 0x8d, 0xf8,
-  0x0f, 0x20, 0x49, 0xea, 0x03, 0x49, 0xfa, 0xf7, 0x55, 0xfe, 0x4f, 0xf4,
-  0x7a, 0x72, 0x00, 0x23, 0x01, 0xf0, 0x90, 0xfe, 0x07, 0x46, 0x0b, 0xe0,
-  0xfa, 0xf7, 0x4c, 0xfe, 0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72, 0x01, 0xf0,
-  0x87, 0xfe, 0xf3, 0x68, 0xc0, 0x1b, 0x98, 0x42, 0x80, 0xf0, 0xde, 0x80,
-  0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68, 0x99, 0x07, 0xed, 0xd5,
-  0x0d, 0xf1, 0x0f, 0x02, 0x01, 0x23, 0xff, 0x21, 0x03, 0xf0, 0xf2, 0xfb,
-  0xff, 0x22, 0x9d, 0xf8, 0x0f, 0x30, 0x8d, 0xf8, 0x0f, 0x20, 0x4f, 0xea,
-  0x03, 0x2a, 0xfa, 0xf7, 0x2d, 0xfe, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23,
-  0x01, 0xf0, 0x68, 0xfe, 0x07, 0x46, 0x0b, 0xe0, 0xfa, 0xf7, 0x24, 0xfe,
-  0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72, 0x01, 0xf0, 0x5f, 0xfe, 0xf3, 0x68,
-  0xc0, 0x1b, 0x98, 0x42, 0x80, 0xf0, 0xba, 0x80, 0x63, 0x68, 0x1b, 0x68,
-  0x18, 0x68, 0xc3, 0x68, 0x9a, 0x07, 0xed, 0xd5, 0x01, 0x23, 0xff, 0x21,
-  0x0d, 0xf1, 0x0f, 0x02, 0x03, 0xf0, 0xca, 0xfb, 0x9d, 0xf8, 0x0f, 0x30,
-  0x43, 0xea, 0x09, 0x03, 0x4a, 0xea, 0x03, 0x03, 0xb8, 0xf1, 0x00, 0x0f,
-  0x01, 0xd0, 0xc8, 0xf8, 0x00, 0x30, 0xa8, 0xb2, 0x04, 0xb0, 0xbd, 0xe8,
-  0xf0, 0x87, 0x31, 0x68, 0xff, 0xf7, 0x00, 0xfa, 0x00, 0x28, 0x7f, 0xf4,
-  0x12, 0xaf, 0x80, 0x20, 0x04, 0xb0, 0xbd, 0xe8, 0xf0, 0x87, 0x26, 0x2f,
-  0x4f, 0xf4, 0x00, 0x75, 0x7f, 0xf7, 0x35, 0xaf, 0x3a, 0x2f, 0x3f, 0xf4,
-  0x43, 0xaf, 0xe3, 0xe7, 0x73, 0x68, 0x09, 0xf1, 0x01, 0x09, 0x99, 0x45,
-  0xff, 0xf4, 0x05, 0xaf, 0xb8, 0xf1, 0x00, 0x0f, 0xe9, 0xd0, 0xc8, 0xf8,
-  0x00, 0x00, 0xe6, 0xe7, 0x08, 0x2f, 0x08, 0xbf, 0x04, 0x23, 0x4f, 0xf0,
-  0x02, 0x00, 0x08, 0xbf, 0x63, 0x76, 0x04, 0xb0, 0xbd, 0xe8, 0xf0, 0x87,
-  0x20, 0x46, 0x31, 0x68, 0x01, 0x93, 0xff, 0xf7, 0xd5, 0xf9, 0x01, 0x9b,
-  0xc6, 0xe7, 0x4f, 0xea, 0x03, 0x29, 0xff, 0x23, 0x8d, 0xf8, 0x0f, 0x30,
-  0xfa, 0xf7, 0xc8, 0xfd, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x01, 0xf0,
-  0x03, 0xfe, 0x07, 0x46, 0x0d, 0xe0, 0x00, 0xbf, 0x8c, 0xbd, 0x00, 0x20,
-  0xfa, 0xf7, 0xbc, 0xfd, 0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72, 0x01, 0xf0,
-  0xf7, 0xfd, 0xf3, 0x68, 0xc0, 0x1b, 0x98, 0x42, 0x61, 0xd2, 0x63, 0x68,
-  0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68, 0x9b, 0x07, 0xee, 0xd5, 0x01, 0x23,
-  0xff, 0x21, 0x0d, 0xf1, 0x0f, 0x02, 0x03, 0xf0, 0x63, 0xfb, 0x9d, 0xf8,
-  0x0f, 0x30, 0x53, 0xea, 0x09, 0x03, 0x99, 0xd0, 0x99, 0x07, 0x4c, 0xbf,
-  0x4f, 0xf4, 0x84, 0x65, 0x4f, 0xf4, 0x80, 0x65, 0x4f, 0xea, 0x83, 0x22,
-  0x02, 0xf4, 0x80, 0x62, 0x48, 0xbf, 0x42, 0xf0, 0x20, 0x02, 0x13, 0xf0,
-  0x04, 0x0f, 0x18, 0xbf, 0x2a, 0x46, 0x13, 0xf0, 0x08, 0x0f, 0x18, 0xbf,
-  0x2a, 0x46, 0x13, 0xf0, 0x10, 0x0f, 0x08, 0xbf, 0x15, 0x46, 0x9a, 0x06,
-  0x48, 0xbf, 0x45, 0xf0, 0x20, 0x05, 0x5f, 0x06, 0x48, 0xbf, 0x45, 0xf4,
-  0x00, 0x75, 0x1e, 0x06, 0x48, 0xbf, 0x45, 0xf0, 0x04, 0x05, 0x9c, 0x05,
-  0x48, 0xbf, 0x45, 0xf4, 0x00, 0x75, 0xd8, 0x04, 0x48, 0xbf, 0x45, 0xf4,
-  0x00, 0x75, 0x99, 0x04, 0x48, 0xbf, 0x45, 0xf0, 0x04, 0x05, 0x5a, 0x04,
-  0x48, 0xbf, 0x45, 0xf0, 0x04, 0x05, 0x63, 0xe7, 0x63, 0x68, 0x1b, 0x68,
-  0x18, 0x68, 0xdb, 0xe6, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xff, 0xe6,
-  0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0x23, 0xe7, 0x63, 0x68, 0x1b, 0x68,
-  0x18, 0x68, 0x47, 0xe7, 0xb8, 0xf1, 0x00, 0x0f, 0x0b, 0xd0, 0x26, 0x2f,
-  0xc8, 0xf8, 0x00, 0x30, 0x0d, 0xdc, 0x07, 0x2f, 0x0f, 0xdd, 0x00, 0x25,
-  0x98, 0xe6, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0x9f, 0xe7, 0x26, 0x2f,
-  0x09, 0xdc, 0x07, 0x2f, 0xf5, 0xdc, 0x45, 0x46, 0x43, 0xe7, 0x3a, 0x2f,
-  0x01, 0xd1, 0x00, 0x25, 0x98, 0xe6, 0x1d, 0x46, 0x3b, 0xe7, 0x3a, 0x2f,
-  0xf9, 0xd0, 0x45, 0x46, 0x39, 0xe7, 0x00, 0xbf, 0x00, 0x21, 0xfd, 0x23,
-  0x70, 0xb5, 0x42, 0x68, 0x82, 0xb0, 0x04, 0x46, 0x11, 0x73, 0x8d, 0xf8,
-  0x04, 0x30, 0xfa, 0xf7, 0x31, 0xfd, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23,
-  0x01, 0xf0, 0x6c, 0xfd, 0x14, 0x4e, 0x05, 0x46, 0x0a, 0xe0, 0xfa, 0xf7,
-  0x27, 0xfd, 0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72, 0x01, 0xf0, 0x62, 0xfd,
-  0x33, 0x69, 0x40, 0x1b, 0x98, 0x42, 0x17, 0xd2, 0x63, 0x68, 0x1b, 0x68,
-  0x18, 0x68, 0xc3, 0x68, 0x9b, 0x07, 0xee, 0xd5, 0x01, 0x22, 0x01, 0xa9,
-  0x03, 0xf0, 0x88, 0xfa, 0x31, 0x68, 0x20, 0x46, 0xff, 0xf7, 0x14, 0xf9,
-  0x00, 0x22, 0x65, 0x68, 0x0d, 0x21, 0x20, 0x46, 0x01, 0xab, 0x6a, 0x61,
-  0xff, 0xf7, 0x14, 0xfe, 0x02, 0xb0, 0x70, 0xbd, 0x63, 0x68, 0x1b, 0x68,
-  0x18, 0x68, 0xe9, 0xe7, 0x8c, 0xbd, 0x00, 0x20, 0xf0, 0xb5, 0x04, 0x46,
-  0x83, 0xb0, 0xfd, 0xf7, 0x19, 0xf8, 0x63, 0x68, 0x18, 0x68, 0x30, 0x30,
-  0x02, 0xf0, 0x5e, 0xff, 0x63, 0x68, 0x5a, 0x68, 0x51, 0x1c, 0x5f, 0xd0,
-  0x4f, 0xf0, 0x00, 0x03, 0x43, 0xec, 0x40, 0x20, 0xff, 0x23, 0x8d, 0xf8,
-  0x07, 0x30, 0xfa, 0xf7, 0xe9, 0xfc, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23,
-  0x01, 0xf0, 0x24, 0xfd, 0x31, 0x4e, 0x05, 0x46, 0x0a, 0xe0, 0xfa, 0xf7,
-  0xdf, 0xfc, 0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72, 0x01, 0xf0, 0x1a, 0xfd,
-  0x33, 0x69, 0x40, 0x1b, 0x98, 0x42, 0x4c, 0xd2, 0x63, 0x68, 0x1b, 0x68,
-  0x18, 0x68, 0xc3, 0x68, 0x9f, 0x07, 0xee, 0xd5, 0x01, 0x22, 0x0d, 0xf1,
-  0x07, 0x01, 0x03, 0xf0, 0x3f, 0xfa, 0x63, 0x68, 0x1f, 0x7b, 0x00, 0x2f,
-  0x37, 0xd1, 0x5a, 0x68, 0x51, 0x1c, 0x27, 0xd0, 0x4f, 0xf0, 0x01, 0x03,
-  0x43, 0xec, 0x40, 0x20, 0xff, 0x23, 0x8d, 0xf8, 0x07, 0x30, 0xfa, 0xf7,
-  0xbb, 0xfc, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x01, 0xf0, 0xf6, 0xfc,
-  0x1a, 0x4e, 0x05, 0x46, 0x0a, 0xe0, 0xfa, 0xf7, 0xb1, 0xfc, 0x4f, 0xf4,
-  0x7a, 0x72, 0x00, 0x23, 0x01, 0xf0, 0xec, 0xfc, 0x32, 0x69, 0x43, 0x1b,
-  0x93, 0x42, 0x22, 0xd2, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68,
-  0x9b, 0x07, 0xee, 0xd5, 0x01, 0x22, 0x0d, 0xf1, 0x07, 0x01, 0x03, 0xf0,
-  0x11, 0xfa, 0x63, 0x68, 0x18, 0x68, 0x30, 0x30, 0x02, 0xf0, 0xaa, 0xff,
-  0x20, 0x46, 0xfc, 0xf7, 0xb7, 0xff, 0x38, 0x46, 0x03, 0xb0, 0xf0, 0xbd,
-  0x1f, 0x7b, 0x00, 0x2f, 0xf2, 0xd0, 0x20, 0x46, 0xff, 0xf7, 0x50, 0xff,
-  0x63, 0x68, 0x07, 0x46, 0xc1, 0xe7, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68,
-  0xb4, 0xe7, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xde, 0xe7, 0x00, 0xbf,
-  0x8c, 0xbd, 0x00, 0x20, 0x2d, 0xe9, 0xf0, 0x4f, 0x04, 0x46, 0x8b, 0xb0,
-  0xcd, 0xe9, 0x03, 0x32, 0x07, 0x91, 0xfc, 0xf7, 0x93, 0xff, 0x63, 0x68,
-  0x18, 0x68, 0x30, 0x30, 0x02, 0xf0, 0xd8, 0xfe, 0x63, 0x68, 0x5b, 0x68,
-  0x5a, 0x1c, 0x00, 0xf0, 0x2d, 0x82, 0x4f, 0xf0, 0x00, 0x02, 0x42, 0xec,
-  0x40, 0x30, 0xff, 0x23, 0x8d, 0xf8, 0x24, 0x30, 0xfa, 0xf7, 0x62, 0xfc,
-  0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x01, 0xf0, 0x9d, 0xfc, 0x93, 0x4e,
-  0x05, 0x46, 0x0b, 0xe0, 0xfa, 0xf7, 0x58, 0xfc, 0x4f, 0xf4, 0x7a, 0x72,
-  0x00, 0x23, 0x01, 0xf0, 0x93, 0xfc, 0x32, 0x69, 0x43, 0x1b, 0x93, 0x42,
-  0x80, 0xf0, 0x0c, 0x82, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68,
-  0x9b, 0x07, 0xed, 0xd5, 0x01, 0x22, 0x09, 0xa9, 0x03, 0xf0, 0xb8, 0xf9,
-  0x73, 0x68, 0x05, 0x93, 0xdd, 0xe9, 0x03, 0x23, 0x13, 0x44, 0x06, 0x93,
-  0x23, 0x7e, 0x13, 0xf0, 0x03, 0x03, 0x40, 0xf0, 0xcb, 0x80, 0x03, 0x9a,
-  0x00, 0x2a, 0x00, 0xf0, 0xc7, 0x80, 0xe2, 0x6b, 0x06, 0x99, 0x91, 0x42,
-  0x00, 0xf2, 0xc2, 0x80, 0x62, 0x68, 0x11, 0x7b, 0x00, 0x29, 0x40, 0xf0,
-  0xe6, 0x80, 0x03, 0x9b, 0x31, 0x68, 0x01, 0x2b, 0x00, 0xf0, 0x1e, 0x81,
-  0x20, 0x46, 0xff, 0xf7, 0x27, 0xf8, 0x00, 0x28, 0x63, 0xd0, 0x73, 0x68,
-  0xcb, 0xb1, 0x00, 0x25, 0x12, 0x21, 0x20, 0x46, 0x04, 0x9a, 0xff, 0xf7,
-  0x23, 0xf9, 0xff, 0x28, 0x03, 0x46, 0x00, 0xf0, 0x3c, 0x81, 0x1d, 0x07,
-  0x00, 0xf1, 0xca, 0x80, 0x58, 0x07, 0x00, 0xf1, 0xd3, 0x81, 0x13, 0xf0,
-  0x12, 0x0f, 0x02, 0xd0, 0x4f, 0xf4, 0x00, 0x75, 0x4c, 0xe0, 0x13, 0xf0,
-  0x60, 0x0f, 0x40, 0xf0, 0x97, 0x80, 0x4f, 0xf0, 0x00, 0x0b, 0x4f, 0xf0,
-  0xff, 0x09, 0x5d, 0x46, 0x5f, 0x46, 0x03, 0x9b, 0xdd, 0xf8, 0x1c, 0xa0,
-  0x0d, 0xf1, 0x24, 0x08, 0x01, 0x93, 0xfa, 0xf7, 0xf7, 0xfb, 0x4f, 0xf4,
-  0x7a, 0x72, 0x00, 0x23, 0x01, 0xf0, 0x32, 0xfc, 0x83, 0x46, 0x02, 0x97,
-  0x8d, 0xf8, 0x24, 0x90, 0xfa, 0xf7, 0xec, 0xfb, 0x4f, 0xf4, 0x7a, 0x72,
-  0x00, 0x23, 0x01, 0xf0, 0x27, 0xfc, 0x07, 0x46, 0x0b, 0xe0, 0xfa, 0xf7,
-  0xe3, 0xfb, 0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72, 0x01, 0xf0, 0x1e, 0xfc,
-  0xf3, 0x68, 0xc0, 0x1b, 0x98, 0x42, 0x80, 0xf0, 0x06, 0x81, 0x63, 0x68,
-  0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68, 0x99, 0x07, 0xed, 0xd5, 0x01, 0x23,
-  0x42, 0x46, 0xff, 0x21, 0x03, 0xf0, 0x8a, 0xf9, 0x9d, 0xf8, 0x24, 0x30,
-  0xfe, 0x2b, 0x00, 0xf0, 0xfa, 0x80, 0xfa, 0xf7, 0xc7, 0xfb, 0x00, 0x23,
-  0x4f, 0xf4, 0x7a, 0x72, 0x01, 0xf0, 0x02, 0xfc, 0x33, 0x68, 0xa0, 0xeb,
-  0x0b, 0x00, 0x98, 0x42, 0xcc, 0xd3, 0x80, 0x25, 0x73, 0x68, 0x00, 0x27,
-  0x00, 0x2b, 0x4e, 0xd0, 0x00, 0x22, 0x0c, 0x21, 0x20, 0x46, 0xff, 0xf7,
-  0xbd, 0xf8, 0xff, 0x28, 0x00, 0xf0, 0xcd, 0x80, 0x10, 0xf0, 0x0c, 0x0f,
-  0x00, 0xf0, 0xbd, 0x80, 0x63, 0x68, 0x5a, 0x68, 0x51, 0x1c, 0x26, 0xd0,
-  0x4f, 0xf0, 0x01, 0x03, 0x43, 0xec, 0x40, 0x20, 0xff, 0x23, 0x8d, 0xf8,
-  0x24, 0x30, 0xfa, 0xf7, 0x9f, 0xfb, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23,
-  0x01, 0xf0, 0xda, 0xfb, 0x07, 0x46, 0x0b, 0xe0, 0xfa, 0xf7, 0x96, 0xfb,
-  0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x01, 0xf0, 0xd1, 0xfb, 0x32, 0x69,
-  0xc3, 0x1b, 0x93, 0x42, 0x80, 0xf0, 0x46, 0x81, 0x63, 0x68, 0x1b, 0x68,
-  0x18, 0x68, 0xc3, 0x68, 0x9b, 0x07, 0xed, 0xd5, 0x01, 0x22, 0x09, 0xa9,
-  0x03, 0xf0, 0xf6, 0xf8, 0x63, 0x68, 0x18, 0x68, 0x30, 0x30, 0x02, 0xf0,
-  0x8f, 0xfe, 0x20, 0x46, 0xfc, 0xf7, 0x9c, 0xfe, 0x28, 0x46, 0x0b, 0xb0,
-  0xbd, 0xe8, 0xf0, 0x8f, 0x12, 0xf0, 0x60, 0x0f, 0x31, 0x68, 0x00, 0xf0,
-  0x1e, 0x81, 0x20, 0x46, 0xfe, 0xf7, 0x72, 0xff, 0x73, 0x68, 0x04, 0x25,
-  0x00, 0x27, 0x00, 0x2b, 0xb0, 0xd1, 0x31, 0x68, 0x20, 0x46, 0xfe, 0xf7,
-  0x69, 0xff, 0x05, 0x9b, 0x01, 0x3b, 0x05, 0x93, 0x7f, 0xf4, 0x22, 0xaf,
-  0xb2, 0xe7, 0x13, 0x46, 0x03, 0x9a, 0xbb, 0x46, 0x01, 0x2a, 0x00, 0xf0,
-  0x09, 0x81, 0x72, 0x68, 0x1d, 0x46, 0x00, 0x2a, 0x00, 0xf0, 0x00, 0x81,
-  0x00, 0x22, 0x0c, 0x21, 0x20, 0x46, 0xff, 0xf7, 0x59, 0xf8, 0xff, 0x28,
-  0x02, 0x46, 0x00, 0xf0, 0x1c, 0x81, 0x05, 0x07, 0x40, 0xf1, 0x0e, 0x81,
-  0x4f, 0xf4, 0x80, 0x75, 0x88, 0xe7, 0x13, 0x73, 0x6f, 0xf0, 0x02, 0x03,
-  0x8d, 0xf8, 0x24, 0x30, 0xfa, 0xf7, 0x3e, 0xfb, 0x4f, 0xf4, 0x7a, 0x72,
-  0x00, 0x23, 0x01, 0xf0, 0x79, 0xfb, 0x05, 0x46, 0x0d, 0xe0, 0x00, 0xbf,
-  0x8c, 0xbd, 0x00, 0x20, 0xfa, 0xf7, 0x32, 0xfb, 0x4f, 0xf4, 0x7a, 0x72,
-  0x00, 0x23, 0x01, 0xf0, 0x6d, 0xfb, 0x32, 0x69, 0x43, 0x1b, 0x93, 0x42,
-  0x4b, 0xd2, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68, 0x9f, 0x07,
-  0xee, 0xd5, 0x0d, 0xf1, 0x24, 0x08, 0x01, 0x22, 0x41, 0x46, 0x03, 0xf0,
-  0x91, 0xf8, 0x31, 0x68, 0x20, 0x46, 0xfe, 0xf7, 0x1d, 0xff, 0x00, 0x22,
-  0x60, 0x68, 0x0d, 0x21, 0x42, 0x61, 0x43, 0x46, 0x20, 0x46, 0xff, 0xf7,
-  0x1d, 0xfc, 0x05, 0x46, 0x00, 0x28, 0x7f, 0xf4, 0x51, 0xaf, 0x03, 0x9b,
-  0x31, 0x68, 0x01, 0x2b, 0x7f, 0xf4, 0xe2, 0xae, 0x20, 0x46, 0xfe, 0xf7,
-  0x09, 0xff, 0x00, 0x28, 0x3f, 0xf4, 0x45, 0xaf, 0x73, 0x68, 0x00, 0x2b,
-  0x3f, 0xf4, 0xf9, 0xae, 0x00, 0x25, 0x11, 0x21, 0x20, 0x46, 0x04, 0x9a,
-  0xff, 0xf7, 0x02, 0xf8, 0xff, 0x28, 0x03, 0x46, 0x7f, 0xf4, 0xdf, 0xae,
-  0x73, 0x68, 0x01, 0x35, 0x9d, 0x42, 0xf2, 0xd3, 0x31, 0xe7, 0x10, 0xf0,
-  0x12, 0x0f, 0x31, 0x68, 0x03, 0xd1, 0x10, 0xf0, 0x60, 0x0f, 0x3f, 0xf4,
-  0x7f, 0xaf, 0x20, 0x46, 0xfe, 0xf7, 0xe8, 0xfe, 0x36, 0xe7, 0x73, 0x68,
-  0x01, 0x37, 0x9f, 0x42, 0xff, 0xf4, 0x26, 0xaf, 0x30, 0xe7, 0x63, 0x68,
-  0x1b, 0x68, 0x18, 0x68, 0xb5, 0xe7, 0x73, 0x68, 0x01, 0x35, 0x9d, 0x42,
-  0xff, 0xf4, 0xb6, 0xae, 0x15, 0xe7, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68,
-  0xfb, 0xe6, 0x63, 0x68, 0x52, 0x46, 0x18, 0x68, 0x00, 0x21, 0x4f, 0xf4,
-  0x00, 0x73, 0x02, 0x9f, 0xfe, 0xf7, 0x3c, 0xfd, 0x3d, 0xb1, 0x28, 0x46,
-  0x4f, 0xf4, 0x00, 0x71, 0x00, 0xf0, 0x86, 0xff, 0xb8, 0x42, 0x7f, 0xf4,
-  0x75, 0xaf, 0x63, 0x68, 0x4f, 0xf4, 0x00, 0x71, 0x18, 0x68, 0xfe, 0xf7,
-  0x6b, 0xfd, 0x63, 0x68, 0x01, 0x46, 0x18, 0x68, 0x02, 0xf0, 0xe8, 0xfe,
-  0x00, 0x28, 0x3f, 0xf4, 0xf2, 0xae, 0x8d, 0xf8, 0x24, 0x90, 0xfa, 0xf7,
-  0xab, 0xfa, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x01, 0xf0, 0xe6, 0xfa,
-  0x05, 0x46, 0x0a, 0xe0, 0xfa, 0xf7, 0xa2, 0xfa, 0x00, 0x23, 0x4f, 0xf4,
-  0x7a, 0x72, 0x01, 0xf0, 0xdd, 0xfa, 0xf3, 0x68, 0x40, 0x1b, 0x98, 0x42,
-  0x40, 0xd2, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68, 0x9a, 0x07,
-  0xee, 0xd5, 0x01, 0x23, 0x42, 0x46, 0xff, 0x21, 0x03, 0xf0, 0x4a, 0xf8,
-  0x9d, 0xf8, 0x24, 0x70, 0x8d, 0xf8, 0x24, 0x90, 0x3f, 0x02, 0xfa, 0xf7,
-  0x87, 0xfa, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x01, 0xf0, 0xc2, 0xfa,
-  0x05, 0x46, 0x0a, 0xe0, 0xfa, 0xf7, 0x7e, 0xfa, 0x00, 0x23, 0x4f, 0xf4,
-  0x7a, 0x72, 0x01, 0xf0, 0xb9, 0xfa, 0xf3, 0x68, 0x40, 0x1b, 0x98, 0x42,
-  0x18, 0xd2, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68, 0x9b, 0x07,
-  0xee, 0xd5, 0x01, 0x23, 0x42, 0x46, 0xff, 0x21, 0x03, 0xf0, 0x26, 0xf8,
-  0x01, 0x9a, 0x9d, 0xf8, 0x24, 0x30, 0x01, 0x3a, 0x47, 0xea, 0x03, 0x07,
-  0x55, 0x46, 0x0a, 0xf5, 0x00, 0x73, 0x01, 0x92, 0x3f, 0xf4, 0xff, 0xae,
-  0x9a, 0x46, 0x62, 0xe6, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xe8, 0xe7,
-  0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc0, 0xe7, 0x31, 0x68, 0x20, 0x46,
-  0xfe, 0xf7, 0x54, 0xfe, 0x50, 0x46, 0x4f, 0xf4, 0x00, 0x71, 0x00, 0xf0,
-  0x11, 0xff, 0x83, 0x45, 0x7f, 0xf4, 0x00, 0xaf, 0x00, 0x25, 0x99, 0xe6,
-  0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xbb, 0xe6, 0x63, 0x68, 0x1b, 0x68,
-  0x18, 0x68, 0xf5, 0xe5, 0x0a, 0x4e, 0xf7, 0xe5, 0x02, 0x25, 0x7d, 0xe6,
-  0x50, 0x07, 0xfb, 0xd4, 0x12, 0xf0, 0x12, 0x0f, 0x3f, 0xf4, 0xbe, 0xae,
-  0x20, 0x46, 0x31, 0x68, 0xfe, 0xf7, 0x34, 0xfe, 0x22, 0xe6, 0x73, 0x68,
-  0x01, 0x35, 0x9d, 0x42, 0xff, 0xf4, 0xd6, 0xae, 0x6b, 0xe6, 0x00, 0xbf,
-  0x8c, 0xbd, 0x00, 0x20, 0x2d, 0xe9, 0xf0, 0x4f, 0x83, 0xb0, 0x00, 0x28,
-  0x00, 0xf0, 0xa9, 0x80, 0x1d, 0x46, 0x03, 0x7e, 0x06, 0x46, 0x13, 0xf0,
-  0x03, 0x04, 0x40, 0xf0, 0xa2, 0x80, 0x00, 0x2d, 0x00, 0xf0, 0x9f, 0x80,
-  0x90, 0x46, 0xc2, 0x6b, 0x05, 0xeb, 0x08, 0x03, 0x9a, 0x42, 0x40, 0xf2,
-  0x98, 0x80, 0x0f, 0x46, 0xfc, 0xf7, 0x2a, 0xfd, 0x73, 0x68, 0x18, 0x68,
-  0x30, 0x30, 0x02, 0xf0, 0x6f, 0xfc, 0x73, 0x68, 0x5a, 0x68, 0x51, 0x1c,
-  0x27, 0xd0, 0x44, 0xec, 0x40, 0x20, 0xff, 0x23, 0x8d, 0xf8, 0x04, 0x30,
-  0xfa, 0xf7, 0xfc, 0xf9, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x01, 0xf0,
-  0x37, 0xfa, 0xdf, 0xf8, 0x1c, 0x93, 0x04, 0x46, 0x0c, 0xe0, 0xfa, 0xf7,
-  0xf1, 0xf9, 0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72, 0x01, 0xf0, 0x2c, 0xfa,
-  0xd9, 0xf8, 0x10, 0x30, 0x00, 0x1b, 0x98, 0x42, 0x80, 0xf0, 0x2c, 0x81,
-  0x73, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68, 0x9b, 0x07, 0xec, 0xd5,
-  0x01, 0x22, 0x01, 0xa9, 0x02, 0xf0, 0x50, 0xff, 0x73, 0x68, 0x01, 0x2d,
-  0x00, 0xf0, 0x26, 0x81, 0xdf, 0xf8, 0xdc, 0xa2, 0xda, 0xf8, 0x04, 0x90,
-  0x1a, 0x7b, 0x52, 0xb1, 0x1a, 0x69, 0x42, 0x45, 0x00, 0xf0, 0xd8, 0x80,
-  0x30, 0x46, 0xff, 0xf7, 0x8f, 0xfc, 0x04, 0x46, 0x00, 0x28, 0x40, 0xf0,
-  0xad, 0x80, 0x30, 0x46, 0xda, 0xf8, 0x00, 0x10, 0xfe, 0xf7, 0xc6, 0xfd,
-  0x00, 0x28, 0x00, 0xf0, 0xa2, 0x80, 0xda, 0xf8, 0x04, 0x30, 0x00, 0x24,
-  0x00, 0x2b, 0x52, 0xd0, 0x42, 0x46, 0x19, 0x21, 0x30, 0x46, 0xfe, 0xf7,
-  0xbf, 0xfe, 0xff, 0x28, 0x00, 0xf0, 0x8f, 0x80, 0x03, 0x07, 0x3d, 0xd5,
-  0x4f, 0xf4, 0x80, 0x74, 0x73, 0x68, 0x5a, 0x68, 0x51, 0x1c, 0x27, 0xd0,
-  0x4f, 0xf0, 0x01, 0x03, 0x43, 0xec, 0x40, 0x20, 0xff, 0x23, 0x8d, 0xf8,
-  0x04, 0x30, 0xfa, 0xf7, 0xa1, 0xf9, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23,
-  0x01, 0xf0, 0xdc, 0xf9, 0x99, 0x4f, 0x05, 0x46, 0x0b, 0xe0, 0xfa, 0xf7,
-  0x97, 0xf9, 0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72, 0x01, 0xf0, 0xd2, 0xf9,
-  0x3b, 0x69, 0x40, 0x1b, 0x98, 0x42, 0x80, 0xf0, 0xd7, 0x80, 0x73, 0x68,
-  0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68, 0x9b, 0x07, 0xed, 0xd5, 0x01, 0x22,
-  0x01, 0xa9, 0x02, 0xf0, 0xf7, 0xfe, 0x73, 0x68, 0x18, 0x68, 0x30, 0x30,
-  0x02, 0xf0, 0x90, 0xfc, 0x30, 0x46, 0xfc, 0xf7, 0x9d, 0xfc, 0x20, 0x46,
-  0x03, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x04, 0x24, 0x20, 0x46, 0x03, 0xb0,
-  0xbd, 0xe8, 0xf0, 0x8f, 0x44, 0x07, 0x76, 0xd4, 0x10, 0xf0, 0x12, 0x0f,
-  0x73, 0x68, 0x5b, 0xd1, 0x10, 0xf0, 0x60, 0x0f, 0x02, 0xd0, 0x04, 0x24,
-  0xb9, 0xe7, 0x73, 0x68, 0x5d, 0x61, 0x05, 0xe0, 0x01, 0x3d, 0x07, 0xf5,
-  0x00, 0x77, 0x08, 0xf1, 0x01, 0x08, 0x34, 0xd0, 0xfc, 0x22, 0x39, 0x46,
-  0x30, 0x46, 0xff, 0xf7, 0x79, 0xf8, 0x04, 0x46, 0x00, 0x28, 0xf1, 0xd0,
-  0x73, 0x68, 0x30, 0x46, 0x5c, 0x69, 0xff, 0xf7, 0x15, 0xfc, 0x30, 0x46,
-  0xda, 0xf8, 0x00, 0x10, 0xfe, 0xf7, 0x50, 0xfd, 0xc8, 0xb1, 0xda, 0xf8,
-  0x04, 0x30, 0x4f, 0xf0, 0x00, 0x0b, 0xc3, 0xb3, 0x00, 0x22, 0x37, 0x21,
-  0x30, 0x46, 0xfe, 0xf7, 0x4b, 0xfe, 0xda, 0xf8, 0x00, 0x10, 0x30, 0x46,
-  0xfe, 0xf7, 0x40, 0xfd, 0x00, 0x22, 0x16, 0x21, 0x30, 0x46, 0xfe, 0xf7,
-  0x41, 0xfe, 0xff, 0x28, 0x00, 0xf0, 0xa2, 0x80, 0x10, 0xf0, 0x7e, 0x0f,
-  0x23, 0xd0, 0xb9, 0xf1, 0x01, 0x09, 0x73, 0x68, 0x7f, 0xf4, 0x58, 0xaf,
-  0x4f, 0xf4, 0x80, 0x64, 0x7b, 0xe7, 0x01, 0x22, 0x73, 0x68, 0xc3, 0xf8,
-  0x10, 0x80, 0x1a, 0x73, 0x75, 0xe7, 0xda, 0xf8, 0x04, 0x30, 0x01, 0x34,
-  0x9c, 0x42, 0xff, 0xf4, 0x63, 0xaf, 0x80, 0x24, 0x73, 0x68, 0x6c, 0xe7,
-  0xb0, 0xf5, 0x80, 0x6f, 0x73, 0x68, 0x7f, 0xf4, 0x68, 0xaf, 0xb9, 0xf1,
-  0x01, 0x09, 0x7f, 0xf4, 0x3d, 0xaf, 0x62, 0xe7, 0x4f, 0xf4, 0x00, 0x74,
-  0x5f, 0xe7, 0x04, 0x22, 0x30, 0x46, 0x0d, 0xeb, 0x02, 0x01, 0xfe, 0xf7,
-  0x5b, 0xfd, 0x01, 0x9b, 0x1b, 0xba, 0x00, 0x28, 0xd1, 0xd1, 0xb9, 0xf1,
-  0x01, 0x09, 0xa4, 0xeb, 0x03, 0x05, 0x73, 0x68, 0xd0, 0xd0, 0x00, 0x2d,
-  0x7f, 0xf4, 0x26, 0xaf, 0xcc, 0xe7, 0x02, 0x24, 0x73, 0x68, 0x48, 0xe7,
-  0x5a, 0x69, 0x2a, 0x44, 0x5a, 0x61, 0x05, 0xe0, 0x01, 0x3d, 0x07, 0xf5,
-  0x00, 0x77, 0x08, 0xf1, 0x01, 0x08, 0xc2, 0xd0, 0xfc, 0x22, 0x39, 0x46,
-  0x30, 0x46, 0xff, 0xf7, 0x07, 0xf8, 0x04, 0x46, 0x00, 0x28, 0xf1, 0xd0,
-  0x73, 0x68, 0x30, 0x46, 0x5c, 0x69, 0xff, 0xf7, 0xa3, 0xfb, 0x30, 0x46,
-  0xda, 0xf8, 0x00, 0x10, 0xfe, 0xf7, 0xde, 0xfc, 0x00, 0x28, 0xa6, 0xd0,
-  0xda, 0xf8, 0x04, 0x30, 0x4f, 0xf0, 0x00, 0x0b, 0x00, 0x2b, 0xc4, 0xd0,
-  0x00, 0x22, 0x37, 0x21, 0x30, 0x46, 0xfe, 0xf7, 0xd7, 0xfd, 0xda, 0xf8,
-  0x00, 0x10, 0x30, 0x46, 0xfe, 0xf7, 0xcc, 0xfc, 0x00, 0x22, 0x16, 0x21,
-  0x30, 0x46, 0xfe, 0xf7, 0xcd, 0xfd, 0xff, 0x28, 0x8c, 0xd1, 0xda, 0xf8,
-  0x04, 0x30, 0x0b, 0xf1, 0x01, 0x0b, 0x9b, 0x45, 0xe8, 0xd3, 0x88, 0xe7,
-  0x73, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xd5, 0xe6, 0x73, 0x68, 0x1b, 0x68,
-  0x18, 0x68, 0x2a, 0xe7, 0x1b, 0x7b, 0x2b, 0xb1, 0x30, 0x46, 0xff, 0xf7,
-  0x71, 0xfb, 0x04, 0x46, 0x00, 0x28, 0xb1, 0xd1, 0xdf, 0xf8, 0x80, 0xa0,
-  0x30, 0x46, 0xda, 0xf8, 0x00, 0x10, 0xfe, 0xf7, 0xa7, 0xfc, 0xe0, 0xb1,
-  0xda, 0xf8, 0x04, 0x30, 0xdb, 0xb1, 0x00, 0x24, 0x42, 0x46, 0x18, 0x21,
-  0x30, 0x46, 0xfe, 0xf7, 0xa3, 0xfd, 0xff, 0x28, 0x0c, 0xd0, 0x01, 0x07,
-  0x1e, 0xd5, 0x4f, 0xf4, 0x80, 0x74, 0x99, 0xe7, 0xda, 0xf8, 0x04, 0x30,
-  0x0b, 0xf1, 0x01, 0x0b, 0x9b, 0x45, 0xff, 0xf4, 0x45, 0xaf, 0x58, 0xe7,
-  0xda, 0xf8, 0x04, 0x30, 0x01, 0x34, 0x9c, 0x42, 0xe6, 0xd3, 0x80, 0x24,
-  0x8a, 0xe7, 0xfe, 0x22, 0x39, 0x46, 0x30, 0x46, 0xfe, 0xf7, 0x9e, 0xff,
-  0x00, 0x22, 0x0d, 0x21, 0x30, 0x46, 0x01, 0xab, 0xff, 0xf7, 0x84, 0xf9,
-  0x04, 0x46, 0x7d, 0xe7, 0x42, 0x07, 0x3f, 0xf5, 0x7a, 0xaf, 0x10, 0xf0,
-  0x12, 0x0f, 0x04, 0xd1, 0x10, 0xf0, 0x60, 0x0f, 0xe9, 0xd0, 0x04, 0x24,
-  0x72, 0xe7, 0x4f, 0xf4, 0x00, 0x74, 0x6f, 0xe7, 0x8c, 0xbd, 0x00, 0x20,
-  0x2d, 0xe9, 0xf0, 0x43, 0x04, 0x46, 0x83, 0xb0, 0xfc, 0xf7, 0x7e, 0xfb,
-  0x20, 0x46, 0xfc, 0xf7, 0x83, 0xfb, 0x23, 0x7e, 0x13, 0xf0, 0x02, 0x02,
-  0x40, 0xf0, 0x1c, 0x81, 0xd9, 0x07, 0x40, 0xf1, 0x19, 0x81, 0x63, 0x68,
-  0x62, 0x76, 0x18, 0x68, 0x15, 0x46, 0x30, 0x30, 0x02, 0xf0, 0xb6, 0xfa,
-  0x63, 0x68, 0x5b, 0x68, 0x5a, 0x1c, 0x24, 0xd0, 0x45, 0xec, 0x40, 0x30,
-  0xff, 0x23, 0x8d, 0xf8, 0x04, 0x30, 0xfa, 0xf7, 0x43, 0xf8, 0x4f, 0xf4,
-  0x7a, 0x72, 0x00, 0x23, 0x01, 0xf0, 0x7e, 0xf8, 0xac, 0x4e, 0x05, 0x46,
-  0x0b, 0xe0, 0xfa, 0xf7, 0x39, 0xf8, 0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72,
-  0x01, 0xf0, 0x74, 0xf8, 0x33, 0x69, 0x40, 0x1b, 0x98, 0x42, 0x80, 0xf0,
-  0x9d, 0x81, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68, 0x9f, 0x07,
-  0xed, 0xd5, 0x01, 0x22, 0x01, 0xa9, 0x02, 0xf0, 0x99, 0xfd, 0x20, 0x46,
-  0xfe, 0xf7, 0x9e, 0xfe, 0x01, 0x28, 0x40, 0xf0, 0xea, 0x80, 0x00, 0x25,
-  0x4f, 0xf4, 0xd5, 0x72, 0x08, 0x21, 0x20, 0x46, 0x01, 0xab, 0x01, 0x95,
-  0xff, 0xf7, 0x22, 0xf9, 0x00, 0x28, 0x00, 0xf0, 0x11, 0x81, 0x02, 0x28,
-  0x40, 0xf0, 0xe1, 0x80, 0x03, 0x25, 0x95, 0x4e, 0x20, 0x46, 0x31, 0x68,
-  0xfe, 0xf7, 0x0e, 0xfc, 0x68, 0xb1, 0x73, 0x68, 0x6b, 0xb1, 0x00, 0x27,
-  0x01, 0x22, 0x3b, 0x21, 0x20, 0x46, 0xfe, 0xf7, 0x0b, 0xfd, 0xff, 0x28,
-  0x00, 0xf0, 0x7f, 0x81, 0x10, 0xf0, 0x7e, 0x0f, 0x01, 0xd0, 0x01, 0x3d,
-  0xea, 0xd1, 0x00, 0x22, 0x3a, 0x21, 0x20, 0x46, 0x01, 0xab, 0xff, 0xf7,
-  0xff, 0xf8, 0x00, 0x28, 0x40, 0xf0, 0xc1, 0x80, 0x01, 0x9b, 0xd9, 0x02,
-  0x40, 0xf1, 0xf5, 0x80, 0x67, 0x7e, 0xa7, 0xf1, 0x02, 0x07, 0xb7, 0xfa,
-  0x87, 0xf7, 0x7f, 0x09, 0xbf, 0x07, 0xf9, 0xf7, 0xe3, 0xff, 0x4f, 0xf4,
-  0x7a, 0x72, 0x00, 0x23, 0x01, 0xf0, 0x1e, 0xf8, 0x80, 0x46, 0xd6, 0xf8,
-  0x00, 0x90, 0x49, 0x46, 0x20, 0x46, 0xfe, 0xf7, 0xdb, 0xfb, 0x00, 0x28,
-  0x00, 0xf0, 0xe3, 0x80, 0x73, 0x68, 0x00, 0x2b, 0x00, 0xf0, 0xfd, 0x81,
-  0x00, 0x25, 0x00, 0x22, 0x37, 0x21, 0x20, 0x46, 0xfe, 0xf7, 0xd4, 0xfc,
-  0x31, 0x68, 0x20, 0x46, 0xfe, 0xf7, 0xca, 0xfb, 0x3a, 0x46, 0x29, 0x21,
-  0x20, 0x46, 0xfe, 0xf7, 0xcb, 0xfc, 0xff, 0x28, 0x00, 0xf0, 0xd2, 0x80,
-  0x02, 0x07, 0x01, 0x90, 0x00, 0xf0, 0x01, 0x03, 0x00, 0xf1, 0xc4, 0x80,
-  0x45, 0x07, 0x00, 0xf1, 0x3c, 0x81, 0x10, 0xf0, 0x12, 0x0f, 0x00, 0xf0,
-  0x2b, 0x81, 0x4f, 0xf4, 0x00, 0x75, 0x63, 0xb1, 0xf9, 0xf7, 0xac, 0xff,
-  0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x00, 0xf0, 0xe7, 0xff, 0xd6, 0xf8,
-  0x00, 0x90, 0xa0, 0xeb, 0x08, 0x00, 0x48, 0x45, 0xc5, 0xd3, 0x00, 0x2d,
-  0x40, 0xf0, 0xff, 0x81, 0x01, 0x9d, 0x00, 0x2d, 0x40, 0xf0, 0xc9, 0x81,
-  0x63, 0x7e, 0x02, 0x2b, 0x00, 0xf0, 0x06, 0x82, 0x01, 0x23, 0x63, 0x76,
-  0x20, 0x46, 0x31, 0x68, 0xfe, 0xf7, 0x94, 0xfb, 0x00, 0x28, 0x5e, 0xd0,
-  0x73, 0x68, 0xb3, 0xb1, 0x00, 0x22, 0x37, 0x21, 0x20, 0x46, 0xfe, 0xf7,
-  0x91, 0xfc, 0x31, 0x68, 0x20, 0x46, 0xfe, 0xf7, 0x87, 0xfb, 0x00, 0x22,
-  0x2a, 0x21, 0x20, 0x46, 0xfe, 0xf7, 0x88, 0xfc, 0xff, 0x28, 0x00, 0xf0,
-  0xfb, 0x81, 0x10, 0xf0, 0x1e, 0x0f, 0x48, 0xd1, 0x10, 0xf0, 0x60, 0x0f,
-  0x45, 0xd1, 0x63, 0x7e, 0x03, 0x2b, 0x00, 0xf0, 0x99, 0x80, 0x4f, 0xf4,
-  0xcc, 0x61, 0x46, 0x4a, 0x46, 0x48, 0x00, 0xf0, 0xdb, 0xfc, 0x63, 0x68,
-  0x5a, 0x68, 0x51, 0x1c, 0x26, 0xd0, 0x4f, 0xf0, 0x01, 0x03, 0x43, 0xec,
-  0x40, 0x20, 0xff, 0x23, 0x8d, 0xf8, 0x04, 0x30, 0xf9, 0xf7, 0x5e, 0xff,
-  0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x00, 0xf0, 0x99, 0xff, 0x05, 0x46,
-  0x0b, 0xe0, 0xf9, 0xf7, 0x55, 0xff, 0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72,
-  0x00, 0xf0, 0x90, 0xff, 0x33, 0x69, 0x40, 0x1b, 0x98, 0x42, 0x80, 0xf0,
-  0xc1, 0x80, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68, 0x9f, 0x07,
-  0xed, 0xd5, 0x01, 0x22, 0x01, 0xa9, 0x02, 0xf0, 0xb5, 0xfc, 0x63, 0x68,
-  0x18, 0x68, 0x30, 0x30, 0x02, 0xf0, 0x4e, 0xfa, 0x20, 0x46, 0xfc, 0xf7,
-  0x5b, 0xfa, 0x20, 0x7e, 0x03, 0xb0, 0xbd, 0xe8, 0xf0, 0x83, 0x40, 0xf2,
-  0x82, 0x51, 0x2a, 0x4a, 0x2a, 0x48, 0x00, 0xf0, 0x9f, 0xfc, 0x40, 0xf2,
-  0x5a, 0x61, 0x29, 0x4a, 0x25, 0x48, 0x00, 0xf0, 0x99, 0xfc, 0x63, 0x68,
-  0x5a, 0x68, 0x51, 0x1c, 0xe4, 0xd0, 0x4f, 0xf0, 0x01, 0x03, 0x43, 0xec,
-  0x40, 0x20, 0xff, 0x23, 0x8d, 0xf8, 0x04, 0x30, 0xf9, 0xf7, 0x1c, 0xff,
-  0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x00, 0xf0, 0x57, 0xff, 0x19, 0x4e,
-  0x05, 0x46, 0x0a, 0xe0, 0xf9, 0xf7, 0x12, 0xff, 0x00, 0x23, 0x4f, 0xf4,
-  0x7a, 0x72, 0x00, 0xf0, 0x4d, 0xff, 0x33, 0x69, 0x40, 0x1b, 0x98, 0x42,
-  0x7e, 0xd2, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68, 0x9f, 0x07,
-  0xbd, 0xd4, 0xed, 0xe7, 0x63, 0x7e, 0x02, 0x2b, 0x7f, 0xf4, 0xee, 0xae,
-  0x01, 0x9b, 0xc3, 0xf3, 0x0b, 0x03, 0xb3, 0xf5, 0xd5, 0x7f, 0x3f, 0xf4,
-  0xe7, 0xae, 0x04, 0x23, 0x63, 0x76, 0xc4, 0xe7, 0x4f, 0xf4, 0x80, 0x75,
-  0x41, 0xe7, 0x01, 0x9b, 0x80, 0x25, 0x03, 0xf0, 0x01, 0x03, 0x3c, 0xe7,
-  0x73, 0x68, 0x01, 0x35, 0x9d, 0x42, 0xff, 0xf4, 0x18, 0xaf, 0x80, 0x25,
-  0x01, 0x90, 0x35, 0xe7, 0x8c, 0xbd, 0x00, 0x20, 0xb4, 0xa2, 0x00, 0x20,
-  0xa0, 0xa6, 0x00, 0x20, 0x44, 0xa2, 0x00, 0x20, 0x90, 0xa6, 0x00, 0x20,
-  0x98, 0xa2, 0x00, 0x20, 0x20, 0x46, 0x00, 0xf0, 0xe3, 0xf9, 0x20, 0x46,
-  0xfe, 0xf7, 0xe4, 0xfe, 0xe0, 0x63, 0x00, 0x28, 0x00, 0xf0, 0xd2, 0x80,
-  0x20, 0x46, 0x31, 0x68, 0xfe, 0xf7, 0xce, 0xfa, 0x70, 0xb1, 0x73, 0x68,
-  0x00, 0x25, 0x00, 0x2b, 0x4d, 0xd0, 0x00, 0x22, 0x0a, 0x21, 0x20, 0x46,
-  0xfe, 0xf7, 0xca, 0xfb, 0xff, 0x28, 0x00, 0xf0, 0x27, 0x81, 0x10, 0xf0,
-  0x7e, 0x0f, 0x42, 0xd0, 0x63, 0x68, 0x5a, 0x68, 0x51, 0x1c, 0x3f, 0xf4,
-  0x75, 0xaf, 0x4f, 0xf0, 0x01, 0x03, 0x43, 0xec, 0x40, 0x20, 0xff, 0x23,
-  0x8d, 0xf8, 0x04, 0x30, 0xf9, 0xf7, 0xac, 0xfe, 0x4f, 0xf4, 0x7a, 0x72,
-  0x00, 0x23, 0x00, 0xf0, 0xe7, 0xfe, 0x05, 0x46, 0x0a, 0xe0, 0xf9, 0xf7,
-  0xa3, 0xfe, 0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0xf0, 0xde, 0xfe,
-  0x33, 0x69, 0x40, 0x1b, 0x98, 0x42, 0x0f, 0xd2, 0x63, 0x68, 0x1b, 0x68,
-  0x18, 0x68, 0xc3, 0x68, 0x9f, 0x07, 0x3f, 0xf5, 0x4e, 0xaf, 0xec, 0xe7,
-  0x63, 0x68, 0x01, 0x22, 0x1b, 0x68, 0x01, 0xa9, 0x18, 0x68, 0x02, 0xf0,
-  0xff, 0xfb, 0x64, 0xe6, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0x40, 0xe7,
-  0x00, 0xf0, 0x60, 0x05, 0x00, 0x3d, 0x18, 0xbf, 0x01, 0x25, 0xad, 0x00,
-  0xcf, 0xe6, 0x73, 0x68, 0x01, 0x37, 0x9f, 0x42, 0xff, 0xf4, 0x74, 0xae,
-  0x7d, 0xe6, 0x02, 0x25, 0xc7, 0xe6, 0x10, 0x22, 0x20, 0x46, 0x04, 0xf1,
-  0x2a, 0x01, 0xfe, 0xf7, 0xc5, 0xfa, 0x05, 0x46, 0x00, 0x28, 0x40, 0xf0,
-  0xa5, 0x80, 0x20, 0x46, 0x31, 0x68, 0xfe, 0xf7, 0x6d, 0xfa, 0x00, 0x28,
-  0x41, 0xd0, 0x73, 0x68, 0x53, 0xb1, 0x4f, 0xf4, 0x00, 0x72, 0x10, 0x21,
-  0x20, 0x46, 0xfe, 0xf7, 0x69, 0xfb, 0xff, 0x28, 0x33, 0xd0, 0x10, 0xf0,
-  0x7e, 0x0f, 0x34, 0xd1, 0x23, 0x7e, 0x62, 0x68, 0x23, 0xf0, 0x01, 0x03,
-  0x23, 0x76, 0x53, 0x68, 0x58, 0x1c, 0x26, 0xd0, 0x4f, 0xf0, 0x01, 0x02,
-  0x42, 0xec, 0x40, 0x30, 0xff, 0x23, 0x8d, 0xf8, 0x04, 0x30, 0xf9, 0xf7,
-  0x49, 0xfe, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x00, 0xf0, 0x84, 0xfe,
-  0x05, 0x46, 0x0b, 0xe0, 0xf9, 0xf7, 0x40, 0xfe, 0x00, 0x23, 0x4f, 0xf4,
-  0x7a, 0x72, 0x00, 0xf0, 0x7b, 0xfe, 0x33, 0x69, 0x40, 0x1b, 0x98, 0x42,
-  0x80, 0xf0, 0xbc, 0x80, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68,
-  0x9b, 0x07, 0xed, 0xd5, 0x01, 0x22, 0x01, 0xa9, 0x02, 0xf0, 0xa0, 0xfb,
-  0x62, 0x68, 0x10, 0x68, 0xe9, 0xe6, 0x73, 0x68, 0x01, 0x35, 0x9d, 0x42,
-  0xbf, 0xd3, 0x63, 0x68, 0x5a, 0x68, 0x51, 0x1c, 0x3f, 0xf4, 0xe0, 0xae,
-  0x4f, 0xf0, 0x01, 0x03, 0x43, 0xec, 0x40, 0x20, 0xff, 0x23, 0x8d, 0xf8,
-  0x04, 0x30, 0xf9, 0xf7, 0x17, 0xfe, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23,
-  0x00, 0xf0, 0x52, 0xfe, 0x05, 0x46, 0x0b, 0xe0, 0xf9, 0xf7, 0x0e, 0xfe,
-  0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0xf0, 0x49, 0xfe, 0x33, 0x69,
-  0x40, 0x1b, 0x98, 0x42, 0xbf, 0xf4, 0x7a, 0xaf, 0x63, 0x68, 0x1b, 0x68,
-  0x18, 0x68, 0xc3, 0x68, 0x9a, 0x07, 0x3f, 0xf5, 0xb8, 0xae, 0xeb, 0xe7,
-  0x63, 0x68, 0x5a, 0x68, 0x51, 0x1c, 0x3f, 0xf4, 0xb7, 0xae, 0x4f, 0xf0,
-  0x01, 0x03, 0x43, 0xec, 0x40, 0x20, 0xff, 0x23, 0x8d, 0xf8, 0x04, 0x30,
-  0xf9, 0xf7, 0xee, 0xfd, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x00, 0xf0,
-  0x29, 0xfe, 0x05, 0x46, 0x0b, 0xe0, 0xf9, 0xf7, 0xe5, 0xfd, 0x00, 0x23,
-  0x4f, 0xf4, 0x7a, 0x72, 0x00, 0xf0, 0x20, 0xfe, 0x33, 0x69, 0x40, 0x1b,
-  0x98, 0x42, 0xbf, 0xf4, 0x51, 0xaf, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68,
-  0xc3, 0x68, 0x9f, 0x07, 0x3f, 0xf5, 0x8f, 0xae, 0xeb, 0xe7, 0x01, 0x93,
-  0x32, 0xe6, 0x04, 0x23, 0x40, 0xf2, 0xb2, 0x51, 0x2b, 0x4a, 0x63, 0x76,
-  0x2b, 0x48, 0x00, 0xf0, 0x39, 0xfb, 0x52, 0xe6, 0x63, 0x68, 0x5a, 0x68,
-  0x51, 0x1c, 0x3f, 0xf4, 0x83, 0xae, 0x4f, 0xf0, 0x01, 0x03, 0x43, 0xec,
-  0x40, 0x20, 0xff, 0x23, 0x8d, 0xf8, 0x04, 0x30, 0xf9, 0xf7, 0xba, 0xfd,
-  0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x00, 0xf0, 0xf5, 0xfd, 0x05, 0x46,
-  0x0b, 0xe0, 0xf9, 0xf7, 0xb1, 0xfd, 0x00, 0x23, 0x4f, 0xf4, 0x7a, 0x72,
-  0x00, 0xf0, 0xec, 0xfd, 0x33, 0x69, 0x40, 0x1b, 0x98, 0x42, 0xbf, 0xf4,
-  0x1d, 0xaf, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68, 0x9f, 0x07,
-  0x3f, 0xf5, 0x5b, 0xae, 0xeb, 0xe7, 0x04, 0x23, 0x40, 0xf2, 0xb2, 0x51,
-  0x12, 0x4a, 0x63, 0x76, 0x12, 0x48, 0x00, 0xf0, 0x07, 0xfb, 0x66, 0xe6,
-  0x73, 0x68, 0x01, 0x35, 0x9d, 0x42, 0xff, 0xf4, 0xcc, 0xae, 0xd5, 0xe6,
-  0x2a, 0x46, 0x3a, 0x21, 0x20, 0x46, 0x01, 0xab, 0xfe, 0xf7, 0x96, 0xfe,
-  0x00, 0x28, 0x7f, 0xf4, 0xf3, 0xad, 0x01, 0x9b, 0x58, 0x00, 0x7f, 0xf5,
-  0xef, 0xad, 0x03, 0x23, 0x63, 0x76, 0xeb, 0xe5, 0x73, 0x68, 0x01, 0x35,
-  0x9d, 0x42, 0xff, 0xf4, 0xef, 0xad, 0x4a, 0xe6, 0x63, 0x68, 0x1b, 0x68,
-  0x18, 0x68, 0x45, 0xe7, 0x7c, 0xa2, 0x00, 0x20, 0x90, 0xa6, 0x00, 0x20,
-  0xf0, 0xb5, 0x04, 0x46, 0x43, 0x68, 0x83, 0xb0, 0x18, 0x68, 0x30, 0x30,
-  0x01, 0xf0, 0xd2, 0xff, 0x20, 0x46, 0xfe, 0xf7, 0xe3, 0xfb, 0x63, 0x68,
-  0x07, 0x46, 0x5a, 0x68, 0x51, 0x1c, 0x27, 0xd0, 0x4f, 0xf0, 0x01, 0x03,
-  0x43, 0xec, 0x40, 0x20, 0xff, 0x23, 0x8d, 0xf8, 0x07, 0x30, 0xf9, 0xf7,
-  0x59, 0xfd, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x00, 0xf0, 0x94, 0xfd,
-  0x12, 0x4e, 0x05, 0x46, 0x0a, 0xe0, 0xf9, 0xf7, 0x4f, 0xfd, 0x4f, 0xf4,
-  0x7a, 0x72, 0x00, 0x23, 0x00, 0xf0, 0x8a, 0xfd, 0x32, 0x69, 0x43, 0x1b,
-  0x93, 0x42, 0x12, 0xd2, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68, 0xc3, 0x68,
-  0x9b, 0x07, 0xee, 0xd5, 0x01, 0x22, 0x0d, 0xf1, 0x07, 0x01, 0x02, 0xf0,
-  0xaf, 0xfa, 0x63, 0x68, 0x18, 0x68, 0x30, 0x30, 0x02, 0xf0, 0x48, 0xf8,
-  0x38, 0x46, 0x03, 0xb0, 0xf0, 0xbd, 0x63, 0x68, 0x1b, 0x68, 0x18, 0x68,
-  0xee, 0xe7, 0x00, 0xbf, 0x8c, 0xbd, 0x00, 0x20, 0xf8, 0xb5, 0x04, 0x46,
-  0x14, 0x4a, 0x15, 0x4d, 0x15, 0x49, 0xc0, 0xe9, 0xb0, 0x52, 0xdf, 0xf8,
-  0x60, 0xc0, 0x42, 0x68, 0x13, 0x4f, 0x14, 0x4e, 0x14, 0x4b, 0xc0, 0xe9,
-  0xb3, 0x76, 0xc0, 0xf8, 0xbc, 0xc2, 0xc0, 0xf8, 0xc8, 0x12, 0x50, 0x68,
-  0xc4, 0xf8, 0xb8, 0x32, 0x43, 0x1c, 0x0d, 0xd0, 0xf8, 0xf7, 0x46, 0xfe,
-  0x62, 0x68, 0x4f, 0xf0, 0x01, 0x03, 0x50, 0x68, 0x43, 0xec, 0x40, 0x00,
-  0x43, 0xec, 0x44, 0x00, 0x43, 0xec, 0x40, 0x00, 0x13, 0x7a, 0x03, 0xb9,
-  0xf8, 0xbd, 0x51, 0x7a, 0xbd, 0xe8, 0xf8, 0x40, 0xf8, 0xf7, 0x24, 0xbe,
-  0x49, 0x67, 0x00, 0x20, 0xf9, 0x6b, 0x00, 0x20, 0x45, 0x66, 0x00, 0x20,
-  0x69, 0x61, 0x00, 0x20, 0xc1, 0x5b, 0x00, 0x20, 0x79, 0x6f, 0x00, 0x20,
-  0xf1, 0x57, 0x00, 0x20, 0x43, 0x68, 0x1b, 0x68, 0x19, 0x69, 0x18, 0x68,
-  0x00, 0xf0, 0x58, 0xbc, 0x43, 0x68, 0x02, 0x49, 0x1b, 0x68, 0x18, 0x68,
-  0x00, 0xf0, 0x52, 0xbc, 0x80, 0x1a, 0x06, 0x00, 0x43, 0x68, 0x5b, 0x68,
-  0x5a, 0x1c, 0x32, 0xd0, 0x4f, 0xf0, 0x50, 0x41, 0x01, 0x22, 0x70, 0xb5,
-  0x49, 0x68, 0x02, 0xfa, 0x03, 0xf6, 0x0e, 0x40, 0x00, 0x3e, 0x84, 0xb0,
-  0x04, 0x46, 0x18, 0xbf, 0x01, 0x26, 0x42, 0xec, 0x40, 0x30, 0x4f, 0xf0,
-  0xff, 0x33, 0xcd, 0xe9, 0x01, 0x33, 0xad, 0xf8, 0x0c, 0x30, 0xf9, 0xf7,
-  0xc9, 0xfc, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0x00, 0xf0, 0x04, 0xfd,
-  0x05, 0x46, 0x60, 0x68, 0x0a, 0x23, 0x00, 0x22, 0x01, 0xa9, 0x00, 0x68,
-  0x02, 0xf0, 0x76, 0xf9, 0xf9, 0xf7, 0xba, 0xfc, 0x4f, 0xf4, 0x7a, 0x72,
-  0x00, 0x23, 0x00, 0xf0, 0xf5, 0xfc, 0x85, 0x42, 0xef, 0xd0, 0x63, 0x68,
-  0x5b, 0x68, 0x46, 0xec, 0x40, 0x30, 0x04, 0xb0, 0x70, 0xbd, 0x70, 0x47,
-  0xbf, 0xf3, 0x4f, 0x8f, 0x05, 0x49, 0x06, 0x4b, 0xca, 0x68, 0x02, 0xf4,
-  0xe0, 0x62, 0x13, 0x43, 0xcb, 0x60, 0xbf, 0xf3, 0x4f, 0x8f, 0x00, 0xbf,
-  0xfd, 0xe7, 0x00, 0xbf, 0x00, 0xed, 0x00, 0xe0, 0x04, 0x00, 0xfa, 0x05,
-  0x00, 0x21, 0x10, 0xb4, 0x06, 0x4c, 0x42, 0x1e, 0x73, 0x30, 0x12, 0xf8,
-  0x01, 0x3f, 0x83, 0xea, 0x41, 0x03, 0x90, 0x42, 0xe1, 0x5c, 0xf8, 0xd1,
-  0x08, 0x46, 0x5d, 0xf8, 0x04, 0x4b, 0x70, 0x47, 0xb4, 0xb8, 0x00, 0x20,
-  0x05, 0x46, 0x00, 0xb5, 0x15, 0x4c, 0x83, 0xb0, 0x78, 0x22, 0x00, 0x21,
-  0x20, 0x46, 0x00, 0xf0, 0x7f, 0xfe, 0x00, 0x23, 0x12, 0x4a, 0x13, 0x49,
-  0x22, 0x60, 0x2a, 0x68, 0xd1, 0xe9, 0x00, 0x01, 0xc4, 0xe9, 0x02, 0x01,
-  0x22, 0x61, 0x6a, 0x68, 0x20, 0x46, 0x62, 0x61, 0xaa, 0x68, 0xa2, 0x61,
-  0xea, 0x68, 0xe2, 0x61, 0x2a, 0x69, 0x22, 0x62, 0x6a, 0x69, 0x62, 0x62,
-  0xaa, 0x69, 0xa2, 0x62, 0xea, 0x69, 0xe2, 0x62, 0x8d, 0xf8, 0x07, 0x30,
-  0xff, 0xf7, 0xc8, 0xff, 0x84, 0xf8, 0x74, 0x00, 0xbf, 0xf3, 0x4f, 0x8f,
-  0x00, 0xbe, 0xff, 0xf7, 0xaf, 0xff, 0x00, 0xbf, 0x10, 0x01, 0x00, 0x20,
-  0x04, 0x03, 0x02, 0x01, 0xb0, 0xbf, 0x00, 0x20, 0x04, 0x20, 0x5f, 0xea,
-  0x0e, 0x01, 0x08, 0x42, 0x02, 0xd0, 0xef, 0xf3, 0x09, 0x80, 0x01, 0xe0,
-  0xef, 0xf3, 0x08, 0x80, 0x41, 0x69, 0xff, 0xf7, 0xbf, 0xbf, 0x00, 0xbf,
-  0x05, 0x46, 0x14, 0x4c, 0x08, 0xb5, 0x78, 0x22, 0x00, 0x21, 0x20, 0x46,
-  0x00, 0xf0, 0x3e, 0xfe, 0x11, 0x49, 0x12, 0x4b, 0x21, 0x60, 0xd3, 0xe9,
-  0x00, 0x23, 0xc4, 0xe9, 0x02, 0x23, 0x2b, 0x68, 0x20, 0x46, 0x23, 0x61,
-  0x6b, 0x68, 0x63, 0x61, 0xab, 0x68, 0xa3, 0x61, 0xeb, 0x68, 0xe3, 0x61,
-  0x2b, 0x69, 0x23, 0x62, 0x6b, 0x69, 0x63, 0x62, 0xab, 0x69, 0xa3, 0x62,
-  0xeb, 0x69, 0xe3, 0x62, 0xff, 0xf7, 0x8a, 0xff, 0x84, 0xf8, 0x74, 0x00,
-  0xbf, 0xf3, 0x4f, 0x8f, 0x00, 0xbe, 0xff, 0xf7, 0x71, 0xff, 0x00, 0xbf,
-  0x10, 0x01, 0x00, 0x20, 0xbe, 0xba, 0xfe, 0xca, 0xb0, 0xbf, 0x00, 0x20,
-  0x04, 0x20, 0x5f, 0xea, 0x0e, 0x01, 0x08, 0x42, 0x02, 0xd0, 0xef, 0xf3,
-  0x09, 0x80, 0x01, 0xe0, 0xef, 0xf3, 0x08, 0x80, 0x41, 0x69, 0xff, 0xf7,
-  0xc3, 0xbf, 0x00, 0xbf, 0x00, 0x28, 0x00, 0xf0, 0xc1, 0x80, 0x00, 0x29,
-  0x00, 0xf0, 0xc1, 0x80, 0x2d, 0xe9, 0xf0, 0x43, 0x05, 0x46, 0x60, 0x4c,
-  0x00, 0x20, 0x0a, 0xe0, 0x15, 0xf8, 0x01, 0x2b, 0x01, 0x39, 0x82, 0xea,
-  0x10, 0x22, 0x34, 0xf8, 0x12, 0x00, 0x80, 0xea, 0x03, 0x00, 0x00, 0xf0,
-  0xab, 0x80, 0x03, 0x02, 0x6a, 0x07, 0x9b, 0xb2, 0xf0, 0xd1, 0x21, 0xf0,
-  0x07, 0x0e, 0x01, 0xf0, 0x07, 0x04, 0x42, 0xba, 0xc9, 0x08, 0xae, 0x44,
-  0x92, 0xb2, 0x45, 0xd0, 0x05, 0xeb, 0xc1, 0x01, 0xa1, 0xf1, 0x08, 0x0c,
-  0x51, 0x49, 0xa5, 0xf1, 0x08, 0x00, 0x50, 0xf8, 0x08, 0x3f, 0x45, 0x68,
-  0x5a, 0x40, 0x02, 0xf0, 0xff, 0x03, 0x2e, 0x0e, 0xc2, 0xf3, 0x07, 0x28,
-  0x03, 0xf5, 0xe0, 0x63, 0x31, 0xf8, 0x16, 0x70, 0x08, 0xf5, 0xc0, 0x68,
-  0xc2, 0xf3, 0x07, 0x46, 0x31, 0xf8, 0x13, 0x30, 0x31, 0xf8, 0x18, 0x90,
-  0x06, 0xf5, 0xa0, 0x66, 0x12, 0x0e, 0x31, 0xf8, 0x16, 0x80, 0x7b, 0x40,
-  0x02, 0xf5, 0x80, 0x62, 0x05, 0xf0, 0xff, 0x06, 0x31, 0xf8, 0x12, 0x70,
-  0x83, 0xea, 0x09, 0x03, 0xc5, 0xf3, 0x07, 0x22, 0x06, 0xf5, 0x40, 0x76,
-  0x83, 0xea, 0x08, 0x03, 0x02, 0xf5, 0x00, 0x72, 0x31, 0xf8, 0x16, 0x60,
-  0xc5, 0xf3, 0x07, 0x45, 0x31, 0xf8, 0x12, 0x80, 0x7b, 0x40, 0x05, 0xf5,
-  0x80, 0x75, 0x31, 0xf8, 0x15, 0x20, 0x73, 0x40, 0x83, 0xea, 0x08, 0x03,
-  0x53, 0x40, 0x60, 0x45, 0x9a, 0xb2, 0xc2, 0xd1, 0x52, 0xba, 0x90, 0xb2,
-  0x00, 0x2c, 0x55, 0xd0, 0x9e, 0xf8, 0x00, 0x20, 0x2d, 0x4b, 0x82, 0xea,
-  0x10, 0x22, 0x33, 0xf8, 0x12, 0x20, 0x01, 0x2c, 0x82, 0xea, 0x00, 0x22,
-  0x90, 0xb2, 0x49, 0xd0, 0x9e, 0xf8, 0x01, 0x20, 0x02, 0x2c, 0x82, 0xea,
-  0x10, 0x22, 0x33, 0xf8, 0x12, 0x20, 0x4f, 0xea, 0x00, 0x20, 0x80, 0xb2,
-  0x80, 0xea, 0x02, 0x00, 0x3c, 0xd0, 0x9e, 0xf8, 0x02, 0x20, 0x03, 0x2c,
-  0x82, 0xea, 0x10, 0x22, 0x33, 0xf8, 0x12, 0x20, 0x4f, 0xea, 0x00, 0x20,
-  0x80, 0xb2, 0x80, 0xea, 0x02, 0x00, 0x2f, 0xd0, 0x9e, 0xf8, 0x03, 0x20,
-  0x04, 0x2c, 0x82, 0xea, 0x10, 0x22, 0x33, 0xf8, 0x12, 0x20, 0x4f, 0xea,
-  0x00, 0x20, 0x80, 0xb2, 0x80, 0xea, 0x02, 0x00, 0x22, 0xd0, 0x9e, 0xf8,
-  0x04, 0x20, 0x05, 0x2c, 0x82, 0xea, 0x10, 0x22, 0x33, 0xf8, 0x12, 0x20,
-  0x4f, 0xea, 0x00, 0x20, 0x80, 0xb2, 0x80, 0xea, 0x02, 0x00, 0x15, 0xd0,
-  0x9e, 0xf8, 0x05, 0x20, 0x06, 0x2c, 0x82, 0xea, 0x10, 0x22, 0x33, 0xf8,
-  0x12, 0x20, 0x4f, 0xea, 0x00, 0x20, 0x80, 0xb2, 0x80, 0xea, 0x02, 0x00,
-  0x08, 0xd0, 0x9e, 0xf8, 0x06, 0x10, 0x02, 0x02, 0x81, 0xea, 0x10, 0x21,
-  0x33, 0xf8, 0x11, 0x00, 0x92, 0xb2, 0x50, 0x40, 0xbd, 0xe8, 0xf0, 0x83,
-  0x4f, 0xf6, 0xff, 0x70, 0x70, 0x47, 0x08, 0x46, 0x70, 0x47, 0x00, 0xbf,
-  0xb4, 0xb6, 0x00, 0x20, 0xb4, 0xa6, 0x00, 0x20, 0xff, 0xf7, 0x30, 0xbf,
-  0x70, 0xb5, 0x04, 0x46, 0xfb, 0xf7, 0x8a, 0xfe, 0xa0, 0xb1, 0x20, 0x46,
-  0xf8, 0xf7, 0xfc, 0xfb, 0x05, 0x46, 0x88, 0xb1, 0x20, 0x46, 0xf8, 0xf7,
-  0xf7, 0xfb, 0x04, 0x46, 0x20, 0xb1, 0xfb, 0xf7, 0x4d, 0xfe, 0x20, 0x7e,
-  0x83, 0x07, 0x06, 0xd4, 0x28, 0x46, 0xd5, 0xf8, 0xb8, 0x32, 0xbd, 0xe8,
-  0x70, 0x40, 0x18, 0x47, 0x03, 0x20, 0x70, 0xbd, 0x04, 0x20, 0x70, 0xbd,
-  0x38, 0xb5, 0x0c, 0x46, 0x15, 0x46, 0xf8, 0xf7, 0xe1, 0xfb, 0xf0, 0xb1,
-  0x21, 0x46, 0x2a, 0x46, 0x04, 0x9b, 0xd0, 0xf8, 0xc4, 0x42, 0xa0, 0x47,
-  0x20, 0x28, 0x1c, 0xd8, 0x20, 0x28, 0x12, 0xd8, 0xdf, 0xe8, 0x00, 0xf0,
-  0x20, 0x11, 0x13, 0x11, 0x13, 0x11, 0x11, 0x11, 0x15, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x00, 0x01, 0x20,
-  0x38, 0xbd, 0x04, 0x20, 0x38, 0xbd, 0x03, 0x20, 0x38, 0xbd, 0x02, 0x20,
-  0x38, 0xbd, 0x40, 0x28, 0xf9, 0xd0, 0x80, 0x28, 0x14, 0xbf, 0x01, 0x20,
-  0x03, 0x20, 0x38, 0xbd, 0x00, 0x20, 0x38, 0xbd, 0x38, 0xb5, 0x0c, 0x46,
-  0x15, 0x46, 0xf8, 0xf7, 0xad, 0xfb, 0xf0, 0xb1, 0x21, 0x46, 0x2a, 0x46,
-  0x04, 0x9b, 0xd0, 0xf8, 0xc0, 0x42, 0xa0, 0x47, 0x20, 0x28, 0x1c, 0xd8,
-  0x20, 0x28, 0x12, 0xd8, 0xdf, 0xe8, 0x00, 0xf0, 0x20, 0x11, 0x13, 0x11,
-  0x13, 0x11, 0x11, 0x11, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x17, 0x00, 0x01, 0x20, 0x38, 0xbd, 0x04, 0x20,
-  0x38, 0xbd, 0x03, 0x20, 0x38, 0xbd, 0x02, 0x20, 0x38, 0xbd, 0x40, 0x28,
-  0xf9, 0xd0, 0x80, 0x28, 0x14, 0xbf, 0x01, 0x20, 0x03, 0x20, 0x38, 0xbd,
-  0x00, 0x20, 0x38, 0xbd, 0x38, 0xb5, 0x0c, 0x46, 0x15, 0x46, 0xf8, 0xf7,
-  0x79, 0xfb, 0x60, 0xb1, 0x01, 0x2c, 0x0c, 0xd0, 0x03, 0x2c, 0x05, 0xd0,
-  0x3c, 0xb9, 0xd0, 0xf8, 0xc8, 0x32, 0x98, 0x47, 0x00, 0x20, 0x38, 0xbd,
-  0x01, 0x23, 0x2b, 0x60, 0xfa, 0xe7, 0x04, 0x20, 0x38, 0xbd, 0xd0, 0xf8,
-  0xcc, 0x32, 0x98, 0x47, 0x00, 0x22, 0x03, 0x46, 0xb0, 0xfa, 0x80, 0xf0,
-  0x6a, 0x60, 0x2b, 0x60, 0x40, 0x09, 0x38, 0xbd, 0x70, 0x47, 0x00, 0xbf,
-  0x0c, 0xb4, 0x30, 0xb5, 0xc3, 0xb0, 0x46, 0xac, 0x54, 0xf8, 0x04, 0x5b,
-  0x00, 0x21, 0x4f, 0xf4, 0x80, 0x72, 0x02, 0xa8, 0x00, 0xf0, 0x84, 0xfc,
-  0x23, 0x46, 0x2a, 0x46, 0x4f, 0xf4, 0x80, 0x71, 0x02, 0xa8, 0x01, 0x94,
-  0xfb, 0xf7, 0x28, 0xfb, 0x04, 0x46, 0x02, 0xa8, 0xff, 0xf7, 0xe6, 0xff,
-  0x20, 0x46, 0x43, 0xb0, 0xbd, 0xe8, 0x30, 0x40, 0x02, 0xb0, 0x70, 0x47,
-  0x01, 0x46, 0x02, 0x4a, 0x02, 0x48, 0xf8, 0xf7, 0x19, 0xbc, 0x00, 0xbf,
-  0xe4, 0xa2, 0x00, 0x20, 0x64, 0xde, 0x04, 0x20, 0x10, 0xb5, 0x05, 0x4c,
-  0x82, 0xb0, 0x01, 0x46, 0x0f, 0x23, 0x00, 0x22, 0x00, 0x94, 0x03, 0x48,
-  0xf8, 0xf7, 0x36, 0xfc, 0x02, 0xb0, 0x10, 0xbd, 0x08, 0xa3, 0x00, 0x20,
-  0x64, 0xde, 0x04, 0x20, 0x10, 0xb5, 0x04, 0x46, 0x04, 0xf1, 0x2f, 0x44,
-  0x04, 0xf5, 0x60, 0x04, 0x08, 0x4b, 0x24, 0x0d, 0x82, 0xb0, 0xa4, 0x00,
-  0x00, 0x93, 0x22, 0x46, 0xe3, 0x1c, 0x06, 0x48, 0xf8, 0xf7, 0x20, 0xfc,
-  0x84, 0x42, 0xcc, 0xbf, 0x4f, 0xf0, 0xff, 0x30, 0x00, 0x1b, 0x02, 0xb0,
-  0x10, 0xbd, 0x00, 0xbf, 0x28, 0xa3, 0x00, 0x20, 0xec, 0xbf, 0x00, 0x20,
-  0x2d, 0xe9, 0xf0, 0x47, 0x0f, 0x46, 0x05, 0x46, 0xf8, 0xf7, 0xc6, 0xfb,
-  0x01, 0x22, 0x97, 0xf8, 0x04, 0xa0, 0x97, 0xf9, 0x05, 0xc0, 0x05, 0xf1,
-  0x2f, 0x4e, 0xdf, 0xf8, 0xd4, 0x80, 0x0e, 0xf5, 0x60, 0x0e, 0x02, 0xfa,
-  0x0a, 0xf2, 0x4f, 0xea, 0x1e, 0x5e, 0xbc, 0xf1, 0x00, 0x0f, 0x58, 0xf8,
-  0x2e, 0x60, 0x02, 0xf1, 0xff, 0x32, 0xca, 0xf1, 0x20, 0x04, 0x35, 0xdb,
-  0xa4, 0x45, 0x03, 0xdc, 0x02, 0xfa, 0x0c, 0xf3, 0x33, 0x42, 0x06, 0xd0,
-  0x4f, 0xf0, 0xff, 0x34, 0xf8, 0xf7, 0xb6, 0xfb, 0x20, 0x46, 0xbd, 0xe8,
-  0xf0, 0x87, 0xd5, 0xf8, 0x68, 0x31, 0xf9, 0x79, 0x00, 0x2b, 0x41, 0xd1,
-  0x4b, 0x07, 0x31, 0xd4, 0x64, 0x46, 0x02, 0xfa, 0x0c, 0xf2, 0x16, 0x42,
-  0x33, 0xd1, 0x39, 0x68, 0xba, 0xf1, 0x00, 0x0f, 0x10, 0xd0, 0x67, 0x46,
-  0x01, 0xeb, 0x4a, 0x0a, 0x31, 0xf8, 0x02, 0x3b, 0x07, 0xf1, 0x12, 0x09,
-  0xb3, 0xf5, 0x00, 0x5f, 0x38, 0xbf, 0x63, 0x44, 0x51, 0x45, 0x07, 0xf1,
-  0x01, 0x07, 0x45, 0xf8, 0x29, 0x30, 0xf1, 0xd1, 0x32, 0x43, 0x48, 0xf8,
-  0x2e, 0x20, 0xf8, 0xf7, 0x8d, 0xfb, 0x20, 0x46, 0xbd, 0xe8, 0xf0, 0x87,
-  0x00, 0x2c, 0x02, 0xda, 0x13, 0xe0, 0x01, 0x3c, 0x11, 0xd3, 0x02, 0xfa,
-  0x04, 0xf3, 0x33, 0x42, 0xa4, 0x46, 0xf8, 0xd1, 0xd5, 0xf8, 0x68, 0x11,
-  0xfb, 0x79, 0x91, 0xb9, 0x5b, 0x07, 0xce, 0xd5, 0x6f, 0xf0, 0x0a, 0x04,
-  0xf8, 0xf7, 0x76, 0xfb, 0x20, 0x46, 0xbd, 0xe8, 0xf0, 0x87, 0x6f, 0xf0,
-  0x08, 0x04, 0xf8, 0xf7, 0x6f, 0xfb, 0x20, 0x46, 0xbd, 0xe8, 0xf0, 0x87,
-  0xc9, 0x07, 0xbd, 0xd5, 0xee, 0xe7, 0xd9, 0x07, 0xbb, 0xd5, 0xeb, 0xe7,
-  0xdc, 0xbf, 0x00, 0x20, 0x10, 0xb5, 0x04, 0x46, 0xf8, 0xf7, 0x4e, 0xfb,
-  0x00, 0x23, 0x04, 0xf1, 0x2f, 0x42, 0x08, 0x49, 0x02, 0xf5, 0x60, 0x02,
-  0x12, 0x0d, 0x41, 0xf8, 0x22, 0x30, 0x03, 0xf1, 0x12, 0x02, 0x44, 0xf8,
-  0x22, 0x30, 0x01, 0x33, 0x20, 0x2b, 0xf8, 0xd1, 0xbd, 0xe8, 0x10, 0x40,
-  0xf8, 0xf7, 0x4c, 0xbb, 0xdc, 0xbf, 0x00, 0x20, 0x2d, 0xe9, 0xf0, 0x41,
-  0xd0, 0xf8, 0x68, 0x41, 0x9d, 0xf8, 0x18, 0x60, 0x12, 0x1b, 0x1f, 0x2a,
-  0x38, 0xd8, 0x4e, 0xf2, 0x9f, 0x04, 0x4e, 0xf2, 0x80, 0x05, 0x4f, 0xf4,
-  0x00, 0x38, 0x01, 0xeb, 0x41, 0x0c, 0x00, 0x2e, 0x18, 0xbf, 0x25, 0x46,
-  0x00, 0xeb, 0xcc, 0x04, 0x04, 0xf5, 0x43, 0x54, 0x00, 0xeb, 0xcc, 0x0c,
-  0x05, 0x2b, 0xdc, 0xf8, 0xdc, 0x70, 0x4f, 0xea, 0x41, 0x0e, 0xdc, 0xf8,
-  0xcc, 0x60, 0xc4, 0xf8, 0x0c, 0x80, 0x0c, 0xd9, 0x54, 0x01, 0x05, 0x3b,
-  0x44, 0xf0, 0xa0, 0x54, 0x05, 0x32, 0x05, 0x2b, 0xcc, 0xf8, 0xdc, 0x40,
-  0x02, 0xf0, 0x1f, 0x02, 0xcc, 0xf8, 0xd8, 0x50, 0xf2, 0xd8, 0x71, 0x44,
-  0x00, 0xeb, 0xc1, 0x01, 0x00, 0x20, 0x52, 0x01, 0x42, 0xea, 0x83, 0x63,
-  0xc1, 0xf8, 0xdc, 0x30, 0xc1, 0xf8, 0xd8, 0x50, 0xc1, 0xf8, 0xdc, 0x70,
-  0xc1, 0xf8, 0xcc, 0x60, 0xbd, 0xe8, 0xf0, 0x81, 0x6f, 0xf0, 0x04, 0x00,
-  0xfa, 0xe7, 0x00, 0xbf, 0xf0, 0xb5, 0x01, 0x25, 0x04, 0x68, 0x8d, 0x40,
-  0x24, 0xea, 0x05, 0x04, 0x04, 0x60, 0xb3, 0xb3, 0xd3, 0xe9, 0x01, 0x56,
-  0x1f, 0x68, 0xdc, 0x68, 0x01, 0xeb, 0x41, 0x03, 0x00, 0xeb, 0xc3, 0x03,
-  0xc3, 0xf8, 0xc8, 0x70, 0x4f, 0xea, 0x41, 0x0c, 0xc3, 0xf8, 0xd0, 0x60,
-  0xc3, 0xf8, 0xcc, 0x50, 0xc3, 0xf8, 0xdc, 0x40, 0x0c, 0xeb, 0x01, 0x03,
-  0x4f, 0xf0, 0x01, 0x35, 0x00, 0xeb, 0xc3, 0x0c, 0x4f, 0xf0, 0x00, 0x46,
-  0x00, 0xeb, 0xc3, 0x0e, 0x01, 0x23, 0x0e, 0xf5, 0x86, 0x5e, 0x0c, 0x1d,
-  0x01, 0xf1, 0x08, 0x07, 0x8d, 0x40, 0xce, 0xf8, 0x10, 0x60, 0x03, 0xfa,
-  0x04, 0xf4, 0xce, 0xf8, 0x10, 0x60, 0x02, 0xf0, 0x1f, 0x02, 0x85, 0x60,
-  0xbb, 0x40, 0x00, 0xf5, 0x00, 0x50, 0x04, 0x60, 0x0e, 0xf1, 0x10, 0x0e,
-  0x03, 0x60, 0x00, 0x20, 0xcc, 0xf8, 0xd8, 0x20, 0xf0, 0xbd, 0x4f, 0xf4,
-  0x80, 0x37, 0x4f, 0xf4, 0x40, 0x26, 0x4f, 0xf4, 0xf8, 0x35, 0x01, 0xeb,
-  0x41, 0x04, 0x00, 0xeb, 0xc4, 0x04, 0xc4, 0xf8, 0xc8, 0x70, 0x4f, 0xea,
-  0x41, 0x0c, 0xc4, 0xf8, 0xd0, 0x60, 0xc4, 0xf8, 0xcc, 0x50, 0xc4, 0xf8,
-  0xdc, 0x30, 0xc5, 0xe7, 0x38, 0x4b, 0x2d, 0xe9, 0xf0, 0x47, 0x98, 0x42,
-  0x14, 0xbf, 0x4f, 0xf4, 0x00, 0x23, 0x4f, 0xf4, 0x80, 0x23, 0x07, 0x46,
-  0x0e, 0x46, 0x34, 0x4d, 0x34, 0x4c, 0x35, 0x4a, 0x2b, 0x60, 0x23, 0x60,
-  0x95, 0x68, 0x33, 0xea, 0x05, 0x05, 0xfb, 0xd1, 0x06, 0x20, 0xf9, 0xf7,
-  0x7b, 0xf9, 0x39, 0x46, 0x4f, 0xf0, 0x02, 0x0a, 0x51, 0xf8, 0x04, 0xef,
-  0x4f, 0xea, 0xd6, 0x59, 0x4f, 0xea, 0x46, 0x2c, 0x01, 0xf5, 0x40, 0x58,
-  0x63, 0x46, 0x4a, 0x46, 0x54, 0x46, 0x0e, 0xea, 0x0a, 0x0e, 0xc8, 0xf8,
-  0x00, 0xa0, 0x08, 0xe0, 0x13, 0xeb, 0x0c, 0x03, 0x04, 0xf1, 0x02, 0x04,
-  0x42, 0xeb, 0x09, 0x02, 0xb4, 0xf5, 0x80, 0x7f, 0x03, 0xd0, 0x98, 0x42,
-  0x75, 0xeb, 0x02, 0x0a, 0xf2, 0xd2, 0x4f, 0xf4, 0x80, 0x73, 0xc4, 0xeb,
-  0x04, 0x22, 0x01, 0xe0, 0x01, 0x2b, 0x30, 0xd0, 0xb0, 0xfb, 0xf2, 0xfc,
-  0x66, 0x45, 0x99, 0x46, 0xa2, 0xeb, 0x04, 0x02, 0x03, 0xf1, 0xff, 0x33,
-  0xf4, 0xd2, 0x09, 0xfb, 0x04, 0xf9, 0x1d, 0x02, 0x3c, 0x61, 0x02, 0x24,
-  0x3b, 0x46, 0x03, 0x26, 0x3a, 0x68, 0x01, 0xf5, 0x00, 0x51, 0x6a, 0x40,
-  0x07, 0xf5, 0x80, 0x5c, 0x02, 0xf4, 0x7f, 0x42, 0xcc, 0xf8, 0x00, 0x20,
-  0xc1, 0xf8, 0x00, 0xe0, 0x7d, 0x68, 0xc8, 0xf8, 0x00, 0x40, 0x53, 0xf8,
-  0x24, 0x2b, 0x25, 0x40, 0x82, 0xf0, 0x07, 0x02, 0x02, 0xf0, 0xcf, 0x02,
-  0x03, 0xf5, 0x00, 0x53, 0xcc, 0xf8, 0x00, 0x20, 0xb0, 0xfb, 0xf9, 0xf0,
-  0x0d, 0x60, 0x1e, 0x60, 0x0c, 0x60, 0xbd, 0xe8, 0xf0, 0x87, 0xa1, 0x46,
-  0xd8, 0xe7, 0x00, 0xbf, 0x00, 0x00, 0x08, 0x40, 0x00, 0x20, 0x02, 0x40,
-  0x00, 0x30, 0x02, 0x40, 0x00, 0x00, 0x02, 0x40, 0x2d, 0xe9, 0xf0, 0x47,
-  0x06, 0x46, 0x4f, 0xf0, 0x02, 0x09, 0x06, 0x20, 0x0d, 0x46, 0xf9, 0xf7,
-  0x0f, 0xf9, 0x31, 0x46, 0x4c, 0x46, 0x51, 0xf8, 0x04, 0x7f, 0x86, 0x46,
-  0x4f, 0xea, 0xd5, 0x5c, 0x68, 0x02, 0x01, 0xf5, 0x40, 0x5a, 0x4f, 0xf0,
-  0x00, 0x08, 0x03, 0x46, 0x62, 0x46, 0x27, 0x40, 0xca, 0xf8, 0x00, 0x90,
-  0x07, 0xe0, 0x1b, 0x18, 0x04, 0xf1, 0x02, 0x04, 0x42, 0xeb, 0x0c, 0x02,
-  0xb4, 0xf5, 0x80, 0x7f, 0x03, 0xd0, 0x9e, 0x45, 0x78, 0xeb, 0x02, 0x09,
-  0xf3, 0xd2, 0x4f, 0xf4, 0x80, 0x73, 0xc4, 0xeb, 0x04, 0x22, 0x01, 0xe0,
-  0x01, 0x2b, 0x1a, 0xd0, 0xbe, 0xfb, 0xf2, 0xfc, 0xac, 0x45, 0x18, 0x46,
-  0xa2, 0xeb, 0x04, 0x02, 0x03, 0xf1, 0xff, 0x33, 0xf4, 0xd9, 0x04, 0xfb,
-  0x00, 0xf0, 0x1b, 0x02, 0x34, 0x61, 0x32, 0x68, 0x01, 0xf5, 0x00, 0x51,
-  0x53, 0x40, 0x03, 0xf4, 0x7f, 0x43, 0x06, 0xf5, 0x80, 0x56, 0x33, 0x60,
-  0xbe, 0xfb, 0xf0, 0xf0, 0x0f, 0x60, 0xbd, 0xe8, 0xf0, 0x87, 0x20, 0x46,
-  0x00, 0x23, 0xed, 0xe7, 0x38, 0xb5, 0x03, 0x46, 0x06, 0x20, 0x1c, 0x69,
-  0x1d, 0x68, 0xf9, 0xf7, 0xc5, 0xf8, 0xc5, 0xf3, 0x07, 0x25, 0x05, 0xfb,
-  0x04, 0x44, 0xb0, 0xfb, 0xf4, 0xf0, 0x38, 0xbd, 0x08, 0xb5, 0x05, 0x20,
-  0xf9, 0xf7, 0xba, 0xf8, 0x01, 0x4b, 0x18, 0x60, 0x08, 0xbd, 0x00, 0xbf,
-  0xb8, 0xbf, 0x00, 0x20, 0x03, 0xbd, 0x00, 0xbf, 0x10, 0xb5, 0x04, 0x46,
-  0xf9, 0xf7, 0xea, 0xfa, 0x23, 0x46, 0xbd, 0xe8, 0x10, 0x40, 0x18, 0x47,
-  0xf0, 0xb5, 0x05, 0x46, 0x87, 0xb0, 0x19, 0x20, 0x17, 0x46, 0x0e, 0x46,
-  0xf8, 0xf7, 0x8c, 0xfa, 0x00, 0x21, 0x04, 0x46, 0x19, 0x20, 0xf8, 0xf7,
-  0x71, 0xfa, 0x00, 0x21, 0xcd, 0xe9, 0x04, 0x65, 0x03, 0x97, 0x00, 0x26,
-  0x00, 0x27, 0x01, 0x22, 0x4f, 0xf0, 0x50, 0x43, 0x8c, 0x46, 0xcd, 0xe9,
-  0x00, 0x67, 0x02, 0x92, 0xa9, 0xb1, 0x1a, 0x6d, 0x95, 0x07, 0xfc, 0xd5,
-  0x59, 0x65, 0x40, 0xbf, 0x1a, 0x6d, 0xd0, 0x07, 0x03, 0xd4, 0x20, 0xbf,
-  0x1a, 0x6d, 0xd2, 0x07, 0xfb, 0xd5, 0x9a, 0x6d, 0x8a, 0x42, 0x0b, 0xd0,
-  0x4f, 0xf0, 0x00, 0x0c, 0x0d, 0xeb, 0x8c, 0x02, 0x11, 0x68, 0xe9, 0xe7,
-  0x9a, 0x6d, 0x1a, 0x6d, 0xd6, 0x07, 0xfb, 0xd4, 0x40, 0xbf, 0xe4, 0xe7,
-  0x0c, 0xf1, 0x01, 0x0c, 0xbc, 0xf1, 0x06, 0x0f, 0xf0, 0xd1, 0x21, 0x46,
-  0x19, 0x20, 0x07, 0xb0, 0xbd, 0xe8, 0xf0, 0x40, 0xf8, 0xf7, 0x3c, 0xba,
-  0x0c, 0x4b, 0x0d, 0x4a, 0x93, 0x42, 0x0e, 0xd3, 0x9c, 0x46, 0x03, 0xf2,
-  0xf4, 0x71, 0x0b, 0x4a, 0x92, 0x68, 0xcc, 0xf8, 0xf4, 0x07, 0x0a, 0x48,
-  0xcc, 0xf8, 0xf8, 0x37, 0xcc, 0xf8, 0xfc, 0x07, 0x08, 0x48, 0xff, 0xf7,
-  0xab, 0xbf, 0x4f, 0xf0, 0xff, 0x33, 0x40, 0xf2, 0xf3, 0x71, 0x9c, 0x46,
-  0xed, 0xe7, 0x00, 0xbf, 0x00, 0x08, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20,
-  0x00, 0xed, 0x00, 0xe0, 0xe9, 0x7f, 0x00, 0x20, 0xe5, 0x7f, 0x00, 0x20,
-  0x53, 0xb9, 0x4a, 0xb9, 0x00, 0x29, 0x08, 0xbf, 0x00, 0x28, 0x1c, 0xbf,
-  0x4f, 0xf0, 0xff, 0x31, 0x4f, 0xf0, 0xff, 0x30, 0x00, 0xf0, 0xb2, 0xb9,
-  0xad, 0xf1, 0x08, 0x0c, 0x6d, 0xe9, 0x04, 0xce, 0x00, 0xf0, 0x06, 0xf8,
-  0xdd, 0xf8, 0x04, 0xe0, 0xdd, 0xe9, 0x02, 0x23, 0x04, 0xb0, 0x70, 0x47,
-  0x2d, 0xe9, 0xf0, 0x4f, 0x8c, 0x46, 0x09, 0x9e, 0x04, 0x46, 0x0f, 0x46,
-  0x00, 0x2b, 0x48, 0xd1, 0x8a, 0x42, 0x15, 0x46, 0x5e, 0xd9, 0xb2, 0xfa,
-  0x82, 0xf3, 0x3b, 0xb1, 0xc3, 0xf1, 0x20, 0x02, 0x9f, 0x40, 0x9d, 0x40,
-  0x9c, 0x40, 0x20, 0xfa, 0x02, 0xf2, 0x17, 0x43, 0x4f, 0xea, 0x15, 0x4e,
-  0x1f, 0xfa, 0x85, 0xfc, 0x22, 0x0c, 0xb7, 0xfb, 0xfe, 0xf1, 0x0e, 0xfb,
-  0x11, 0x77, 0x01, 0xfb, 0x0c, 0xf0, 0x42, 0xea, 0x07, 0x42, 0x90, 0x42,
-  0x07, 0xd9, 0xaa, 0x18, 0x01, 0xf1, 0xff, 0x37, 0x02, 0xd2, 0x90, 0x42,
-  0x00, 0xf2, 0x58, 0x81, 0x39, 0x46, 0x12, 0x1a, 0xa4, 0xb2, 0xb2, 0xfb,
-  0xfe, 0xf0, 0x0e, 0xfb, 0x10, 0x22, 0x00, 0xfb, 0x0c, 0xfc, 0x44, 0xea,
-  0x02, 0x44, 0xa4, 0x45, 0x0b, 0xd9, 0x2c, 0x19, 0x00, 0xf1, 0xff, 0x32,
-  0x2c, 0xbf, 0x01, 0x27, 0x00, 0x27, 0xa4, 0x45, 0x02, 0xd9, 0x00, 0x2f,
-  0x00, 0xf0, 0x43, 0x81, 0x10, 0x46, 0x40, 0xea, 0x01, 0x40, 0xa4, 0xeb,
-  0x0c, 0x04, 0x00, 0x21, 0x1e, 0xb1, 0xdc, 0x40, 0x00, 0x23, 0xc6, 0xe9,
-  0x00, 0x43, 0xbd, 0xe8, 0xf0, 0x8f, 0x8b, 0x42, 0x06, 0xd9, 0x0e, 0xb1,
-  0xc6, 0xe9, 0x00, 0x01, 0x00, 0x21, 0x08, 0x46, 0xbd, 0xe8, 0xf0, 0x8f,
-  0xb3, 0xfa, 0x83, 0xf1, 0x00, 0x29, 0x51, 0xd1, 0x63, 0x45, 0xc0, 0xf0,
-  0x16, 0x81, 0x82, 0x42, 0x40, 0xf2, 0x13, 0x81, 0x08, 0x46, 0x00, 0x2e,
-  0xe7, 0xd0, 0xc6, 0xe9, 0x00, 0x47, 0xe4, 0xe7, 0x00, 0x2a, 0x00, 0xf0,
-  0xaf, 0x80, 0xb2, 0xfa, 0x82, 0xf3, 0x00, 0x2b, 0x40, 0xf0, 0xc2, 0x80,
-  0x8a, 0x1a, 0x4f, 0xea, 0x15, 0x4e, 0xaf, 0xb2, 0x01, 0x21, 0x20, 0x0c,
-  0xb2, 0xfb, 0xfe, 0xfc, 0x0e, 0xfb, 0x1c, 0x22, 0x40, 0xea, 0x02, 0x42,
-  0x07, 0xfb, 0x0c, 0xf0, 0x90, 0x42, 0x0e, 0xd9, 0xaa, 0x18, 0x0c, 0xf1,
-  0xff, 0x38, 0x2c, 0xbf, 0x4f, 0xf0, 0x01, 0x09, 0x4f, 0xf0, 0x00, 0x09,
-  0x90, 0x42, 0x03, 0xd9, 0xb9, 0xf1, 0x00, 0x0f, 0x00, 0xf0, 0xf0, 0x80,
-  0xc4, 0x46, 0x12, 0x1a, 0xa4, 0xb2, 0xb2, 0xfb, 0xfe, 0xf0, 0x0e, 0xfb,
-  0x10, 0x22, 0x00, 0xfb, 0x07, 0xf7, 0x44, 0xea, 0x02, 0x44, 0xa7, 0x42,
-  0x0e, 0xd9, 0x2c, 0x19, 0x00, 0xf1, 0xff, 0x32, 0x2c, 0xbf, 0x4f, 0xf0,
-  0x01, 0x0e, 0x4f, 0xf0, 0x00, 0x0e, 0xa7, 0x42, 0x03, 0xd9, 0xbe, 0xf1,
-  0x00, 0x0f, 0x00, 0xf0, 0xd2, 0x80, 0x10, 0x46, 0xe4, 0x1b, 0x40, 0xea,
-  0x0c, 0x40, 0x99, 0xe7, 0xc1, 0xf1, 0x20, 0x05, 0x8b, 0x40, 0x0c, 0xfa,
-  0x01, 0xf4, 0x00, 0xfa, 0x01, 0xf9, 0x22, 0xfa, 0x05, 0xf7, 0x2c, 0xfa,
-  0x05, 0xfc, 0x8a, 0x40, 0x1f, 0x43, 0x20, 0xfa, 0x05, 0xf3, 0x38, 0x0c,
-  0x23, 0x43, 0x1f, 0xfa, 0x87, 0xfe, 0x1c, 0x0c, 0xbc, 0xfb, 0xf0, 0xf8,
-  0x00, 0xfb, 0x18, 0xcc, 0x44, 0xea, 0x0c, 0x44, 0x08, 0xfb, 0x0e, 0xfc,
-  0xa4, 0x45, 0x0e, 0xd9, 0x3c, 0x19, 0x08, 0xf1, 0xff, 0x3a, 0x2c, 0xbf,
-  0x4f, 0xf0, 0x01, 0x0b, 0x4f, 0xf0, 0x00, 0x0b, 0xa4, 0x45, 0x03, 0xd9,
-  0xbb, 0xf1, 0x00, 0x0f, 0x00, 0xf0, 0xb8, 0x80, 0xd0, 0x46, 0xa4, 0xeb,
-  0x0c, 0x04, 0x1f, 0xfa, 0x83, 0xfc, 0xb4, 0xfb, 0xf0, 0xf3, 0x00, 0xfb,
-  0x13, 0x44, 0x03, 0xfb, 0x0e, 0xfe, 0x4c, 0xea, 0x04, 0x44, 0xa6, 0x45,
-  0x0e, 0xd9, 0x3c, 0x19, 0x03, 0xf1, 0xff, 0x30, 0x2c, 0xbf, 0x4f, 0xf0,
-  0x01, 0x0c, 0x4f, 0xf0, 0x00, 0x0c, 0xa6, 0x45, 0x03, 0xd9, 0xbc, 0xf1,
-  0x00, 0x0f, 0x00, 0xf0, 0x9f, 0x80, 0x03, 0x46, 0x43, 0xea, 0x08, 0x40,
-  0xa4, 0xeb, 0x0e, 0x04, 0xa0, 0xfb, 0x02, 0xec, 0x64, 0x45, 0x73, 0x46,
-  0xe0, 0x46, 0x02, 0xd3, 0x07, 0xd1, 0xf1, 0x45, 0x05, 0xd2, 0xbe, 0xeb,
-  0x02, 0x03, 0x6c, 0xeb, 0x07, 0x0c, 0x01, 0x38, 0xe0, 0x46, 0x5e, 0xb1,
-  0xb9, 0xeb, 0x03, 0x02, 0x64, 0xeb, 0x08, 0x04, 0x04, 0xfa, 0x05, 0xf5,
-  0x22, 0xfa, 0x01, 0xf3, 0xcc, 0x40, 0x1d, 0x43, 0xc6, 0xe9, 0x00, 0x54,
-  0x00, 0x21, 0x32, 0xe7, 0x42, 0x08, 0x2f, 0x46, 0x4b, 0x08, 0xac, 0x46,
-  0x42, 0xea, 0xc1, 0x72, 0xae, 0x46, 0xc4, 0x07, 0x11, 0x0c, 0x92, 0xb2,
-  0x41, 0xea, 0x03, 0x41, 0x42, 0xea, 0x01, 0x42, 0xb1, 0xfb, 0xf5, 0xf1,
-  0xb3, 0xfb, 0xf5, 0xf0, 0x1f, 0x23, 0xa2, 0xeb, 0x0c, 0x02, 0x41, 0xea,
-  0x00, 0x41, 0x42, 0xe7, 0x9d, 0x40, 0xc3, 0xf1, 0x20, 0x02, 0x99, 0x40,
-  0x9c, 0x40, 0x2c, 0xfa, 0x02, 0xfc, 0x4f, 0xea, 0x15, 0x4e, 0x20, 0xfa,
-  0x02, 0xf2, 0xaf, 0xb2, 0xbc, 0xfb, 0xfe, 0xf8, 0x0a, 0x43, 0x0e, 0xfb,
-  0x18, 0xcc, 0x11, 0x0c, 0x41, 0xea, 0x0c, 0x41, 0x08, 0xfb, 0x07, 0xfc,
-  0x8c, 0x45, 0x50, 0xd9, 0x69, 0x18, 0x08, 0xf1, 0xff, 0x30, 0x2c, 0xbf,
-  0x4f, 0xf0, 0x01, 0x09, 0x4f, 0xf0, 0x00, 0x09, 0x8c, 0x45, 0x02, 0xd9,
-  0xb9, 0xf1, 0x00, 0x0f, 0x30, 0xd0, 0xa1, 0xeb, 0x0c, 0x01, 0xb1, 0xfb,
-  0xfe, 0xf8, 0x08, 0xfb, 0x07, 0xfc, 0x0e, 0xfb, 0x18, 0x11, 0x92, 0xb2,
-  0x42, 0xea, 0x01, 0x42, 0x62, 0x45, 0x34, 0xd2, 0xaa, 0x18, 0x08, 0xf1,
-  0xff, 0x31, 0x2c, 0xbf, 0x4f, 0xf0, 0x01, 0x09, 0x4f, 0xf0, 0x00, 0x09,
-  0x62, 0x45, 0xbe, 0xd2, 0xb9, 0xf1, 0x00, 0x0f, 0xbb, 0xd1, 0xa8, 0xf1,
-  0x02, 0x01, 0x2a, 0x44, 0xb7, 0xe7, 0x84, 0x1a, 0x6c, 0xeb, 0x03, 0x02,
-  0x01, 0x20, 0x17, 0x46, 0xe7, 0xe6, 0x2c, 0x44, 0x02, 0x38, 0x2b, 0xe7,
-  0xac, 0xf1, 0x02, 0x0c, 0x2a, 0x44, 0x0c, 0xe7, 0x02, 0x39, 0x2a, 0x44,
-  0xa5, 0xe6, 0x2c, 0x44, 0x02, 0x38, 0xba, 0xe6, 0xa5, 0xeb, 0x0c, 0x0c,
-  0xa8, 0xf1, 0x02, 0x00, 0x61, 0x44, 0xb1, 0xfb, 0xfe, 0xf8, 0x08, 0xfb,
-  0x07, 0xfc, 0xca, 0xe7, 0xa8, 0xf1, 0x02, 0x08, 0x3c, 0x44, 0x44, 0xe7,
-  0x02, 0x3b, 0x3c, 0x44, 0x5e, 0xe7, 0x41, 0x46, 0x91, 0xe7, 0xa1, 0xeb,
-  0x0c, 0x01, 0x40, 0x46, 0xb1, 0xfb, 0xfe, 0xf8, 0x08, 0xfb, 0x07, 0xfc,
-  0xb9, 0xe7, 0x00, 0xbf, 0x70, 0x47, 0x00, 0xbf, 0x83, 0x07, 0x30, 0xb5,
-  0x46, 0xd0, 0x84, 0x18, 0x84, 0x46, 0x04, 0xe0, 0x03, 0xf8, 0x01, 0x1b,
-  0x9d, 0x07, 0x04, 0xd0, 0x9c, 0x46, 0xa4, 0x45, 0x63, 0x46, 0xf7, 0xd1,
-  0x30, 0xbd, 0x01, 0x3a, 0x02, 0x44, 0xa2, 0xeb, 0x0c, 0x02, 0x03, 0x2a,
-  0x29, 0xd9, 0xcc, 0xb2, 0x0f, 0x2a, 0x04, 0xeb, 0x04, 0x24, 0x04, 0xeb,
-  0x04, 0x44, 0x2f, 0xd9, 0xa2, 0xf1, 0x10, 0x0c, 0x03, 0xf1, 0x10, 0x05,
-  0x2c, 0xf0, 0x0f, 0x0c, 0xac, 0x44, 0xc3, 0xe9, 0x00, 0x44, 0xc3, 0xe9,
-  0x02, 0x44, 0x10, 0x33, 0x63, 0x45, 0xf8, 0xd1, 0x12, 0xf0, 0x0c, 0x0f,
-  0x02, 0xf0, 0x0f, 0x0e, 0x18, 0xd0, 0x2e, 0xf0, 0x03, 0x0c, 0xae, 0xf1,
-  0x04, 0x05, 0x1a, 0x46, 0x9c, 0x44, 0x42, 0xf8, 0x04, 0x4b, 0x62, 0x45,
-  0xfb, 0xd1, 0x25, 0xf0, 0x03, 0x04, 0x04, 0x33, 0x0e, 0xf0, 0x03, 0x02,
-  0x23, 0x44, 0x00, 0x2a, 0xcc, 0xd0, 0xc9, 0xb2, 0x1a, 0x44, 0x03, 0xf8,
-  0x01, 0x1b, 0x93, 0x42, 0xfb, 0xd1, 0x30, 0xbd, 0x72, 0x46, 0xf4, 0xe7,
-  0x03, 0x46, 0xc6, 0xe7, 0x96, 0x46, 0xe0, 0xe7, 0x84, 0x46, 0x41, 0xea,
-  0x00, 0x03, 0x13, 0xf0, 0x03, 0x03, 0x49, 0xd1, 0x40, 0x3a, 0x23, 0xd3,
-  0x0b, 0x68, 0x03, 0x60, 0x4b, 0x68, 0x43, 0x60, 0x8b, 0x68, 0x83, 0x60,
-  0xcb, 0x68, 0xc3, 0x60, 0x0b, 0x69, 0x03, 0x61, 0x4b, 0x69, 0x43, 0x61,
-  0x8b, 0x69, 0x83, 0x61, 0xcb, 0x69, 0xc3, 0x61, 0x0b, 0x6a, 0x03, 0x62,
-  0x4b, 0x6a, 0x43, 0x62, 0x8b, 0x6a, 0x83, 0x62, 0xcb, 0x6a, 0xc3, 0x62,
-  0x0b, 0x6b, 0x03, 0x63, 0x4b, 0x6b, 0x43, 0x63, 0x8b, 0x6b, 0x83, 0x63,
-  0xcb, 0x6b, 0xc3, 0x63, 0x40, 0x30, 0x40, 0x31, 0x40, 0x3a, 0xdb, 0xd2,
-  0x30, 0x32, 0x0b, 0xd3, 0x0b, 0x68, 0x03, 0x60, 0x4b, 0x68, 0x43, 0x60,
-  0x8b, 0x68, 0x83, 0x60, 0xcb, 0x68, 0xc3, 0x60, 0x10, 0x30, 0x10, 0x31,
-  0x10, 0x3a, 0xf3, 0xd2, 0x0c, 0x32, 0x05, 0xd3, 0x51, 0xf8, 0x04, 0x3b,
-  0x40, 0xf8, 0x04, 0x3b, 0x04, 0x3a, 0xf9, 0xd2, 0x04, 0x32, 0x08, 0xd0,
-  0xd2, 0x07, 0x1c, 0xbf, 0x11, 0xf8, 0x01, 0x3b, 0x00, 0xf8, 0x01, 0x3b,
-  0x01, 0xd3, 0x0b, 0x88, 0x03, 0x80, 0x60, 0x46, 0x70, 0x47, 0x00, 0xbf,
-  0x08, 0x2a, 0x13, 0xd3, 0x8b, 0x07, 0xb1, 0xd0, 0x10, 0xf0, 0x03, 0x03,
-  0xae, 0xd0, 0xc3, 0xf1, 0x04, 0x03, 0xd2, 0x1a, 0xdb, 0x07, 0x1c, 0xbf,
-  0x11, 0xf8, 0x01, 0x3b, 0x00, 0xf8, 0x01, 0x3b, 0xa4, 0xd3, 0x31, 0xf8,
-  0x02, 0x3b, 0x20, 0xf8, 0x02, 0x3b, 0x9f, 0xe7, 0x04, 0x3a, 0xd9, 0xd3,
-  0x01, 0x3a, 0x11, 0xf8, 0x01, 0x3b, 0x00, 0xf8, 0x01, 0x3b, 0xf9, 0xd2,
-  0x0b, 0x78, 0x03, 0x70, 0x4b, 0x78, 0x43, 0x70, 0x8b, 0x78, 0x83, 0x70,
-  0x60, 0x46, 0x70, 0x47, 0x20, 0xf0, 0x03, 0x01, 0x10, 0xf0, 0x03, 0x00,
-  0xc0, 0xf1, 0x00, 0x00, 0x51, 0xf8, 0x04, 0x3b, 0x00, 0xf1, 0x04, 0x0c,
-  0x4f, 0xea, 0xcc, 0x0c, 0x6f, 0xf0, 0x00, 0x02, 0x1c, 0xbf, 0x22, 0xfa,
-  0x0c, 0xf2, 0x13, 0x43, 0x4f, 0xf0, 0x01, 0x0c, 0x4c, 0xea, 0x0c, 0x2c,
-  0x4c, 0xea, 0x0c, 0x4c, 0xa3, 0xeb, 0x0c, 0x02, 0x22, 0xea, 0x03, 0x02,
-  0x12, 0xea, 0xcc, 0x12, 0x04, 0xbf, 0x51, 0xf8, 0x04, 0x3b, 0x04, 0x30,
-  0xf4, 0xd0, 0xc2, 0xf1, 0x00, 0x01, 0x02, 0xea, 0x01, 0x02, 0xb2, 0xfa,
-  0x82, 0xf2, 0xc2, 0xf1, 0x1f, 0x02, 0x00, 0xeb, 0xd2, 0x00, 0x70, 0x47,
-  0xf8, 0xb5, 0x00, 0xbf, 0x2d, 0xe9, 0xf0, 0x4f, 0x00, 0x26, 0xad, 0xf5,
-  0x07, 0x7d, 0x0d, 0xf1, 0x18, 0x08, 0x4f, 0xf4, 0x00, 0x72, 0xff, 0x21,
-  0x40, 0x46, 0xff, 0xf7, 0xfd, 0xfe, 0x4f, 0xf0, 0x01, 0x09, 0x4f, 0xf4,
-  0x7f, 0x07, 0xb3, 0x46, 0x35, 0x46, 0xb2, 0x46, 0x34, 0x46, 0x32, 0x46,
-  0x10, 0xee, 0x18, 0x30, 0xd8, 0x00, 0xfb, 0xd4, 0x83, 0xf0, 0x80, 0x6c,
-  0x83, 0xf0, 0x80, 0x70, 0xcc, 0xf3, 0x80, 0x6c, 0xc0, 0xf3, 0x00, 0x60,
-  0x84, 0x45, 0x03, 0xf0, 0x80, 0x61, 0x03, 0xf0, 0x80, 0x7e, 0xed, 0xd0,
-  0xd8, 0xb2, 0x00, 0x29, 0x3c, 0xd0, 0xbe, 0xf1, 0x00, 0x0f, 0xe7, 0xd1,
-  0x9e, 0x28, 0x44, 0xd0, 0x9f, 0x28, 0x21, 0xd1, 0x00, 0x2c, 0x2a, 0xd0,
-  0x69, 0x1c, 0x01, 0x3c, 0x89, 0xb2, 0xa4, 0xb2, 0x40, 0xee, 0x14, 0x70,
-  0x10, 0xee, 0x10, 0x30, 0x18, 0xf8, 0x05, 0x20, 0x83, 0xea, 0x02, 0x43,
-  0x03, 0xf4, 0x7f, 0x03, 0x20, 0xee, 0x10, 0x30, 0x10, 0xee, 0x18, 0x30,
-  0xdd, 0x01, 0xfb, 0xd5, 0xd8, 0x00, 0xf9, 0xd5, 0x60, 0xee, 0x14, 0x70,
-  0x22, 0x1e, 0x18, 0xbf, 0x01, 0x22, 0x0d, 0x46, 0x52, 0x00, 0xc3, 0xe7,
-  0xdb, 0x00, 0xc1, 0xd4, 0x10, 0xee, 0x18, 0x30, 0xd9, 0x01, 0xf9, 0xd4,
-  0x10, 0xee, 0x18, 0x30, 0xd9, 0x01, 0xf7, 0xd5, 0xf4, 0xe7, 0xd8, 0x00,
-  0xb6, 0xd4, 0x10, 0xee, 0x18, 0x30, 0xd9, 0x01, 0xf9, 0xd4, 0x10, 0xee,
-  0x18, 0x30, 0xd9, 0x01, 0xf7, 0xd5, 0xf4, 0xe7, 0x9e, 0x28, 0x4f, 0xea,
-  0x13, 0x43, 0x1b, 0xd0, 0x9f, 0x28, 0x33, 0xd0, 0x10, 0xee, 0x18, 0x30,
-  0x59, 0x01, 0xfb, 0xd5, 0xd8, 0x00, 0xf9, 0xd5, 0xa0, 0xe7, 0x40, 0xee,
-  0x14, 0x70, 0x10, 0xee, 0x10, 0x30, 0x83, 0xea, 0x02, 0x43, 0x03, 0xf4,
-  0x7f, 0x03, 0x20, 0xee, 0x10, 0x30, 0x10, 0xee, 0x18, 0x30, 0xd9, 0x01,
-  0xfb, 0xd5, 0xdb, 0x00, 0xf9, 0xd5, 0x60, 0xee, 0x14, 0x70, 0x8d, 0xe7,
-  0xdb, 0xb2, 0x01, 0x3b, 0x08, 0x2b, 0xe1, 0xd8, 0x01, 0xa0, 0x50, 0xf8,
-  0x23, 0xf0, 0x00, 0xbf, 0x43, 0x88, 0x00, 0x20, 0x0d, 0x87, 0x00, 0x20,
-  0x39, 0x88, 0x00, 0x20, 0x0d, 0x87, 0x00, 0x20, 0x13, 0x88, 0x00, 0x20,
-  0xfd, 0x87, 0x00, 0x20, 0xd5, 0x87, 0x00, 0x20, 0xbd, 0x87, 0x00, 0x20,
-  0xa7, 0x87, 0x00, 0x20, 0xba, 0xf1, 0x00, 0x0f, 0x07, 0xd1, 0x00, 0x2e,
-  0xc6, 0xd1, 0xb5, 0xf5, 0x00, 0x7f, 0x69, 0xd2, 0x00, 0x26, 0xb2, 0x46,
-  0xc0, 0xe7, 0x08, 0xf8, 0x05, 0x30, 0x0a, 0xf1, 0xff, 0x3a, 0x01, 0x35,
-  0xad, 0xb2, 0x1f, 0xfa, 0x8a, 0xfa, 0x00, 0x2e, 0xb6, 0xd1, 0xba, 0xf1,
-  0x00, 0x0f, 0xb3, 0xd1, 0xeb, 0xe7, 0x19, 0xf0, 0x01, 0x03, 0x48, 0xd1,
-  0x1e, 0x46, 0x4f, 0xf4, 0x00, 0x7a, 0x01, 0x22, 0x1d, 0x46, 0x0b, 0xf1,
-  0x01, 0x0b, 0xa7, 0xe7, 0x19, 0xf0, 0x01, 0x03, 0x3d, 0xd1, 0x06, 0xb3,
-  0x1e, 0x46, 0x4f, 0xf4, 0x00, 0x7a, 0x01, 0x22, 0x1d, 0x46, 0xd8, 0xf8,
-  0x00, 0xb0, 0x9b, 0xe7, 0x19, 0xf0, 0x01, 0x03, 0x31, 0xd1, 0x01, 0x22,
-  0x0b, 0xf1, 0x01, 0x0b, 0x18, 0x46, 0x00, 0x92, 0x41, 0x46, 0x5a, 0x46,
-  0x02, 0x93, 0xff, 0xf7, 0x11, 0xf9, 0x02, 0x9b, 0x78, 0xbb, 0x05, 0x46,
-  0x4f, 0xf4, 0x00, 0x74, 0x02, 0x22, 0x87, 0xe7, 0x19, 0xf0, 0x01, 0x03,
-  0x1d, 0xd1, 0x00, 0x2e, 0x39, 0xd1, 0x01, 0x26, 0x1d, 0x46, 0x4f, 0xf0,
-  0x04, 0x0a, 0x32, 0x46, 0x7c, 0xe7, 0x19, 0xf0, 0x01, 0x03, 0x12, 0xd1,
-  0x18, 0x46, 0x05, 0xaa, 0x01, 0x21, 0x05, 0x93, 0x02, 0x93, 0xff, 0xf7,
-  0x5d, 0xf9, 0x02, 0x9b, 0x02, 0x46, 0x90, 0xb9, 0x05, 0x9b, 0x05, 0x46,
-  0x04, 0x24, 0xc8, 0xf8, 0x00, 0x30, 0x69, 0xe7, 0x19, 0xf0, 0x01, 0x02,
-  0x2f, 0xd0, 0xff, 0x22, 0x64, 0xe7, 0x00, 0x20, 0xff, 0xf7, 0xc6, 0xf8,
-  0x40, 0xf3, 0x00, 0x02, 0x81, 0x46, 0xd2, 0xb2, 0x5c, 0xe7, 0x1c, 0x46,
-  0xff, 0x22, 0x59, 0xe7, 0x01, 0x23, 0x00, 0x93, 0x00, 0x23, 0x5a, 0x46,
-  0x41, 0x46, 0x18, 0x46, 0x00, 0x25, 0xff, 0xf7, 0x07, 0xf9, 0x42, 0x1b,
-  0x18, 0xbf, 0x01, 0x22, 0x52, 0x42, 0x2e, 0x46, 0xaa, 0x46, 0xd2, 0xb2,
-  0x48, 0xe7, 0x01, 0x22, 0x00, 0x92, 0xd8, 0xf8, 0x00, 0xb0, 0x18, 0x46,
-  0x5a, 0x46, 0x41, 0x46, 0x02, 0x93, 0xff, 0xf7, 0xc1, 0xf8, 0x02, 0x9b,
-  0x06, 0x46, 0xe8, 0xb9, 0x4f, 0xf4, 0x00, 0x74, 0x02, 0x22, 0x05, 0x46,
-  0x36, 0xe7, 0x10, 0x46, 0x03, 0x91, 0x02, 0x92, 0xf7, 0xf7, 0x9a, 0xfc,
-  0x02, 0x9a, 0x90, 0xf8, 0x2a, 0x40, 0x13, 0x46, 0x03, 0x99, 0x44, 0xfa,
-  0x03, 0xf0, 0x00, 0xf0, 0x01, 0x00, 0x98, 0x40, 0x01, 0x33, 0x08, 0x2b,
-  0x41, 0xea, 0x00, 0x01, 0xf5, 0xd1, 0x00, 0x25, 0x01, 0x24, 0x88, 0xf8,
-  0x00, 0x10, 0x1d, 0xe7, 0x1e, 0x46, 0xff, 0x22, 0x1c, 0x46, 0x19, 0xe7,
-  0x00, 0x68, 0x70, 0x47, 0x23, 0x4b, 0x70, 0xb5, 0x1c, 0x68, 0x04, 0x44,
-  0x31, 0xbb, 0x4f, 0xf4, 0x7f, 0x00, 0x60, 0xee, 0x14, 0x00, 0x4f, 0xf0,
-  0x50, 0x42, 0x53, 0x68, 0x1e, 0x01, 0xfc, 0xd4, 0x10, 0xee, 0x18, 0x30,
-  0xa3, 0xf5, 0x80, 0x41, 0x0d, 0x04, 0xf6, 0xd4, 0x51, 0x68, 0xc9, 0x01,
-  0xf3, 0xd4, 0x40, 0xee, 0x14, 0x00, 0x10, 0xee, 0x10, 0x10, 0x14, 0xfa,
-  0x83, 0xf3, 0xa3, 0xf5, 0x80, 0x43, 0x1b, 0x78, 0x81, 0xea, 0x03, 0x43,
-  0x03, 0xf4, 0x7f, 0x03, 0x20, 0xee, 0x10, 0x30, 0x53, 0x68, 0xdb, 0x01,
-  0xfc, 0xd5, 0x60, 0xee, 0x14, 0x00, 0xde, 0xe7, 0x2e, 0x20, 0xf7, 0xf7,
-  0xb9, 0xfc, 0x2e, 0x25, 0x4f, 0xf0, 0x01, 0x06, 0x46, 0xec, 0x44, 0x50,
-  0x4f, 0xf0, 0x00, 0x03, 0x43, 0xec, 0x40, 0x50, 0x4f, 0xf4, 0x00, 0x42,
-  0x00, 0x21, 0x07, 0x48, 0xff, 0xf7, 0x76, 0xfd, 0x4f, 0xf4, 0x00, 0x42,
-  0x21, 0x46, 0x04, 0x48, 0xff, 0xf7, 0xbe, 0xfd, 0x46, 0xec, 0x40, 0x50,
-  0x01, 0x4c, 0xbc, 0xe7, 0xe4, 0xbc, 0x00, 0x20, 0x60, 0xde, 0x00, 0x20,
-  0x22, 0x4b, 0x70, 0xb5, 0x1c, 0x68, 0x04, 0x44, 0x19, 0xbb, 0x4f, 0xf4,
-  0x7f, 0x00, 0x60, 0xee, 0x14, 0x00, 0x4f, 0xf0, 0x50, 0x42, 0x53, 0x68,
-  0x1d, 0x01, 0xfc, 0xd4, 0x10, 0xee, 0x18, 0x30, 0x99, 0xb2, 0xb1, 0xf5,
-  0x40, 0x4f, 0xf6, 0xd2, 0x51, 0x68, 0xc9, 0x01, 0xf3, 0xd4, 0x40, 0xee,
-  0x14, 0x00, 0x10, 0xee, 0x10, 0x10, 0x9b, 0xb2, 0xe3, 0x5c, 0x81, 0xea,
-  0x03, 0x43, 0x03, 0xf4, 0x7f, 0x03, 0x20, 0xee, 0x10, 0x30, 0x53, 0x68,
-  0xdb, 0x01, 0xfc, 0xd5, 0x60, 0xee, 0x14, 0x00, 0xe1, 0xe7, 0x2e, 0x20,
-  0xf7, 0xf7, 0x70, 0xfc, 0x2e, 0x25, 0x4f, 0xf0, 0x01, 0x06, 0x46, 0xec,
-  0x44, 0x50, 0x4f, 0xf0, 0x00, 0x03, 0x43, 0xec, 0x40, 0x50, 0x4f, 0xf4,
-  0x40, 0x42, 0x00, 0x21, 0x07, 0x48, 0xff, 0xf7, 0x2d, 0xfd, 0x4f, 0xf4,
-  0x40, 0x42, 0x21, 0x46, 0x04, 0x48, 0xff, 0xf7, 0x75, 0xfd, 0x46, 0xec,
-  0x40, 0x50, 0x02, 0x4c, 0xbf, 0xe7, 0x00, 0xbf, 0xe4, 0xbc, 0x00, 0x20,
-  0x60, 0xde, 0x00, 0x20, 0x2d, 0xe9, 0xf0, 0x43, 0x4b, 0x4b, 0x83, 0xb0,
-  0x04, 0x46, 0x0d, 0x46, 0x01, 0x93, 0x00, 0x29, 0x71, 0xd1, 0x0e, 0x46,
-  0x48, 0x4f, 0x4f, 0xf4, 0x7f, 0x0c, 0x60, 0xee, 0x14, 0xc0, 0x4f, 0xf0,
-  0x50, 0x43, 0xd7, 0xf8, 0x00, 0xe0, 0x45, 0x4f, 0x5a, 0x68, 0x59, 0x68,
-  0x12, 0x01, 0x58, 0x68, 0xfa, 0xd4, 0x10, 0xee, 0x18, 0x20, 0x1f, 0xfa,
-  0x82, 0xf8, 0xa8, 0xf5, 0x80, 0x49, 0x19, 0xf4, 0x00, 0x4f, 0xf1, 0xd1,
-  0xc9, 0x01, 0x20, 0xd4, 0x40, 0xee, 0x14, 0xc0, 0x02, 0xa8, 0x00, 0xeb,
-  0x69, 0x31, 0x11, 0xf8, 0x04, 0x1c, 0xc2, 0xf3, 0x0c, 0x02, 0x22, 0x44,
-  0x02, 0xeb, 0x41, 0x32, 0x94, 0x42, 0x22, 0xd8, 0x0d, 0xb3, 0x11, 0x1b,
-  0x8e, 0x42, 0x1e, 0xd9, 0x79, 0x5c, 0x10, 0xee, 0x10, 0x20, 0x82, 0xea,
-  0x01, 0x42, 0x02, 0xf4, 0x7f, 0x02, 0x20, 0xee, 0x10, 0x20, 0x5a, 0x68,
-  0xd0, 0x01, 0xfc, 0xd5, 0x60, 0xee, 0x14, 0xc0, 0xce, 0xe7, 0x41, 0x01,
-  0xcc, 0xd4, 0xa8, 0xf5, 0xa0, 0x42, 0xb2, 0xf5, 0x00, 0x6f, 0x0b, 0xd2,
-  0x10, 0xee, 0x18, 0x20, 0x12, 0x0c, 0x8d, 0xf8, 0x04, 0x20, 0x5a, 0x68,
-  0x52, 0x01, 0xfc, 0xd5, 0xbe, 0xe7, 0x1e, 0xf8, 0x02, 0x10, 0xde, 0xe7,
-  0xa8, 0xf5, 0xe0, 0x42, 0xb2, 0xf5, 0x00, 0x6f, 0x05, 0xd2, 0x10, 0xee,
-  0x18, 0x20, 0x12, 0x0c, 0x8d, 0xf8, 0x05, 0x20, 0xed, 0xe7, 0x08, 0xf5,
-  0xe0, 0x42, 0x92, 0xb2, 0xb2, 0xf5, 0x00, 0x6f, 0x05, 0xd2, 0x10, 0xee,
-  0x18, 0x20, 0x12, 0x0c, 0x8d, 0xf8, 0x06, 0x20, 0xe1, 0xe7, 0x08, 0xf5,
-  0xa0, 0x42, 0x92, 0xb2, 0xb2, 0xf5, 0x00, 0x6f, 0xdb, 0xd2, 0x10, 0xee,
-  0x18, 0x20, 0x12, 0x0c, 0x8d, 0xf8, 0x07, 0x20, 0xd5, 0xe7, 0x2e, 0x20,
-  0xf7, 0xf7, 0xd4, 0xfb, 0x2e, 0x26, 0x4f, 0xf0, 0x01, 0x08, 0x48, 0xec,
-  0x44, 0x60, 0x4f, 0xf0, 0x00, 0x03, 0x43, 0xec, 0x40, 0x60, 0x0a, 0x4f,
-  0x4f, 0xf4, 0x80, 0x22, 0x00, 0x21, 0x09, 0x48, 0xff, 0xf7, 0x90, 0xfc,
-  0x39, 0x68, 0x4f, 0xf4, 0x80, 0x22, 0x21, 0x44, 0x05, 0x48, 0xff, 0xf7,
-  0xd7, 0xfc, 0x48, 0xec, 0x40, 0x60, 0x4f, 0xf4, 0x80, 0x26, 0x70, 0xe7,
-  0x00, 0x01, 0x02, 0x03, 0xe4, 0xbc, 0x00, 0x20, 0x60, 0xde, 0x00, 0x20,
-  0x2d, 0xe9, 0xf0, 0x43, 0x45, 0x4b, 0x83, 0xb0, 0x04, 0x46, 0x0d, 0x46,
-  0x01, 0x93, 0x00, 0x29, 0x65, 0xd1, 0x0e, 0x46, 0x42, 0x4f, 0x4f, 0xf4,
-  0x7f, 0x0c, 0x60, 0xee, 0x14, 0xc0, 0x4f, 0xf0, 0x50, 0x43, 0xd7, 0xf8,
-  0x00, 0xe0, 0x3f, 0x4f, 0x5a, 0x68, 0x59, 0x68, 0x12, 0x01, 0x58, 0x68,
-  0xfa, 0xd4, 0x10, 0xee, 0x18, 0x20, 0x1f, 0xfa, 0x82, 0xf8, 0xa8, 0xf5,
-  0x80, 0x49, 0x19, 0xf4, 0x00, 0x4f, 0xf1, 0xd1, 0xc9, 0x01, 0x20, 0xd4,
-  0x40, 0xee, 0x14, 0xc0, 0x02, 0xa8, 0x00, 0xeb, 0x69, 0x31, 0x11, 0xf8,
-  0x04, 0x1c, 0xc2, 0xf3, 0x0c, 0x02, 0x22, 0x44, 0x02, 0xeb, 0x41, 0x32,
-  0x94, 0x42, 0x22, 0xd8, 0x0d, 0xb3, 0x11, 0x1b, 0x8e, 0x42, 0x1e, 0xd9,
-  0x79, 0x5c, 0x10, 0xee, 0x10, 0x20, 0x82, 0xea, 0x01, 0x42, 0x02, 0xf4,
-  0x7f, 0x02, 0x20, 0xee, 0x10, 0x20, 0x5a, 0x68, 0xd0, 0x01, 0xfc, 0xd5,
-  0x60, 0xee, 0x14, 0xc0, 0xce, 0xe7, 0x41, 0x01, 0xcc, 0xd4, 0xa8, 0xf5,
-  0xc0, 0x42, 0xb2, 0xf5, 0x00, 0x6f, 0x0b, 0xd2, 0x10, 0xee, 0x18, 0x20,
-  0x12, 0x0c, 0x8d, 0xf8, 0x05, 0x20, 0x5a, 0x68, 0x52, 0x01, 0xfc, 0xd5,
-  0xbe, 0xe7, 0x1e, 0xf8, 0x02, 0x10, 0xde, 0xe7, 0x88, 0xf4, 0x00, 0x42,
-  0xb2, 0xf5, 0x00, 0x6f, 0x05, 0xd2, 0x10, 0xee, 0x18, 0x20, 0x12, 0x0c,
-  0x8d, 0xf8, 0x06, 0x20, 0xed, 0xe7, 0x08, 0xf5, 0xc0, 0x42, 0x92, 0xb2,
-  0xb2, 0xf5, 0x00, 0x6f, 0xe7, 0xd2, 0x10, 0xee, 0x18, 0x20, 0x12, 0x0c,
-  0x8d, 0xf8, 0x07, 0x20, 0xe1, 0xe7, 0x2e, 0x20, 0xf7, 0xf7, 0x40, 0xfb,
-  0x2e, 0x26, 0x4f, 0xf0, 0x01, 0x08, 0x48, 0xec, 0x44, 0x60, 0x4f, 0xf0,
-  0x00, 0x03, 0x43, 0xec, 0x40, 0x60, 0x0a, 0x4f, 0x4f, 0xf4, 0x80, 0x22,
-  0x00, 0x21, 0x09, 0x48, 0xff, 0xf7, 0xfc, 0xfb, 0x39, 0x68, 0x4f, 0xf4,
-  0x80, 0x22, 0x21, 0x44, 0x05, 0x48, 0xff, 0xf7, 0x43, 0xfc, 0x48, 0xec,
-  0x40, 0x60, 0x4f, 0xf4, 0x80, 0x26, 0x7c, 0xe7, 0x00, 0x01, 0x02, 0x03,
-  0xe4, 0xbc, 0x00, 0x20, 0x60, 0xde, 0x00, 0x20, 0x2d, 0xe9, 0xf0, 0x43,
-  0x4a, 0x4b, 0xdf, 0xf8, 0x30, 0x81, 0x83, 0xb0, 0x04, 0x46, 0x0e, 0x46,
-  0xd8, 0xf8, 0x00, 0x50, 0x01, 0x93, 0x00, 0x29, 0x6b, 0xd1, 0x8e, 0x46,
-  0x4f, 0xf4, 0x7f, 0x0c, 0x60, 0xee, 0x14, 0xc0, 0x4f, 0xf0, 0x50, 0x43,
-  0x42, 0x4f, 0x5a, 0x68, 0x59, 0x68, 0x12, 0x01, 0x58, 0x68, 0xfa, 0xd4,
-  0x10, 0xee, 0x18, 0x20, 0x1f, 0xfa, 0x82, 0xf8, 0xa8, 0xf5, 0x80, 0x49,
-  0x19, 0xf4, 0x00, 0x4f, 0xf1, 0xd1, 0xc9, 0x01, 0x20, 0xd4, 0x40, 0xee,
-  0x14, 0xc0, 0x02, 0xa8, 0x00, 0xeb, 0x69, 0x31, 0x11, 0xf8, 0x04, 0x1c,
-  0xc2, 0xf3, 0x0c, 0x02, 0x22, 0x44, 0x02, 0xeb, 0x41, 0x32, 0x94, 0x42,
-  0x22, 0xd8, 0x0e, 0xb3, 0x11, 0x1b, 0x8e, 0x45, 0x1e, 0xd9, 0x79, 0x5c,
-  0x10, 0xee, 0x10, 0x20, 0x82, 0xea, 0x01, 0x42, 0x02, 0xf4, 0x7f, 0x02,
-  0x20, 0xee, 0x10, 0x20, 0x5a, 0x68, 0xd0, 0x01, 0xfc, 0xd5, 0x60, 0xee,
-  0x14, 0xc0, 0xce, 0xe7, 0x41, 0x01, 0xcc, 0xd4, 0xa8, 0xf5, 0xc0, 0x42,
-  0xb2, 0xf5, 0x00, 0x6f, 0x0a, 0xd2, 0x10, 0xee, 0x18, 0x20, 0x12, 0x0c,
-  0x8d, 0xf8, 0x04, 0x20, 0x5a, 0x68, 0x52, 0x01, 0xfc, 0xd5, 0xbe, 0xe7,
-  0xa9, 0x5c, 0xdf, 0xe7, 0xa8, 0xf5, 0xd0, 0x42, 0xb2, 0xf5, 0x00, 0x6f,
-  0x05, 0xd2, 0x10, 0xee, 0x18, 0x20, 0x12, 0x0c, 0x8d, 0xf8, 0x05, 0x20,
-  0xee, 0xe7, 0xa8, 0xf5, 0xe0, 0x42, 0xb2, 0xf5, 0x00, 0x6f, 0x05, 0xd2,
-  0x10, 0xee, 0x18, 0x20, 0x12, 0x0c, 0x8d, 0xf8, 0x06, 0x20, 0xe3, 0xe7,
-  0xa8, 0xf5, 0xf0, 0x48, 0xb8, 0xf5, 0x00, 0x6f, 0xde, 0xd2, 0x10, 0xee,
-  0x18, 0x20, 0x12, 0x0c, 0x8d, 0xf8, 0x07, 0x20, 0xd8, 0xe7, 0x2e, 0x20,
-  0xf7, 0xf7, 0xa2, 0xfa, 0x2e, 0x27, 0x4f, 0xf0, 0x01, 0x09, 0x49, 0xec,
-  0x44, 0x70, 0x4f, 0xf0, 0x00, 0x03, 0x43, 0xec, 0x40, 0x70, 0x4f, 0xf4,
-  0x80, 0x22, 0x00, 0x21, 0x08, 0x48, 0xff, 0xf7, 0x5f, 0xfb, 0x4f, 0xf4,
-  0x80, 0x22, 0x29, 0x19, 0x05, 0x48, 0xff, 0xf7, 0xa7, 0xfb, 0x49, 0xec,
-  0x40, 0x70, 0x4f, 0xf4, 0x80, 0x2e, 0xd8, 0xf8, 0x00, 0x50, 0x75, 0xe7,
-  0x00, 0x01, 0x02, 0x03, 0x60, 0xde, 0x00, 0x20, 0xe4, 0xbc, 0x00, 0x20,
-  0x4f, 0xf4, 0x80, 0x73, 0x2d, 0xe9, 0xf0, 0x43, 0x83, 0xb0, 0x04, 0x46,
-  0x0d, 0x46, 0xad, 0xf8, 0x04, 0x30, 0x00, 0x29, 0x59, 0xd1, 0x0e, 0x46,
-  0x3b, 0x4f, 0x4f, 0xf4, 0x7f, 0x0c, 0x60, 0xee, 0x14, 0xc0, 0x4f, 0xf0,
-  0x50, 0x43, 0xd7, 0xf8, 0x00, 0xe0, 0x38, 0x4f, 0x5a, 0x68, 0x59, 0x68,
-  0x12, 0x01, 0x58, 0x68, 0xfa, 0xd4, 0x10, 0xee, 0x18, 0x20, 0x1f, 0xfa,
-  0x82, 0xf8, 0xa8, 0xf5, 0x80, 0x49, 0x19, 0xf4, 0x00, 0x4f, 0xf1, 0xd1,
-  0xc9, 0x01, 0x20, 0xd4, 0x40, 0xee, 0x14, 0xc0, 0x02, 0xa9, 0x01, 0xeb,
-  0xd8, 0x38, 0x18, 0xf8, 0x04, 0x1c, 0xc2, 0xf3, 0x0d, 0x02, 0x22, 0x44,
-  0x02, 0xeb, 0x81, 0x32, 0x94, 0x42, 0x22, 0xd8, 0x0d, 0xb3, 0x11, 0x1b,
-  0x8e, 0x42, 0x1e, 0xd9, 0x79, 0x5c, 0x10, 0xee, 0x10, 0x20, 0x82, 0xea,
-  0x01, 0x42, 0x02, 0xf4, 0x7f, 0x02, 0x20, 0xee, 0x10, 0x20, 0x5a, 0x68,
-  0xd0, 0x01, 0xfc, 0xd5, 0x60, 0xee, 0x14, 0xc0, 0xce, 0xe7, 0x41, 0x01,
-  0xcc, 0xd4, 0xa8, 0xf5, 0xc0, 0x42, 0xb2, 0xf5, 0x00, 0x6f, 0x0b, 0xd2,
-  0x10, 0xee, 0x18, 0x20, 0x12, 0x0c, 0x8d, 0xf8, 0x04, 0x20, 0x5a, 0x68,
-  0x52, 0x01, 0xfc, 0xd5, 0xbe, 0xe7, 0x1e, 0xf8, 0x02, 0x10, 0xde, 0xe7,
-  0xa8, 0xf5, 0xe0, 0x48, 0xb8, 0xf5, 0x00, 0x6f, 0xf3, 0xd2, 0x10, 0xee,
-  0x18, 0x20, 0x12, 0x0c, 0x8d, 0xf8, 0x05, 0x20, 0xed, 0xe7, 0x2e, 0x20,
-  0xf7, 0xf7, 0x18, 0xfa, 0x2e, 0x26, 0x4f, 0xf0, 0x01, 0x08, 0x48, 0xec,
-  0x44, 0x60, 0x4f, 0xf0, 0x00, 0x03, 0x43, 0xec, 0x40, 0x60, 0x09, 0x4f,
-  0x4f, 0xf4, 0x80, 0x22, 0x00, 0x21, 0x08, 0x48, 0xff, 0xf7, 0xd4, 0xfa,
-  0x39, 0x68, 0x4f, 0xf4, 0x80, 0x22, 0x21, 0x44, 0x04, 0x48, 0xff, 0xf7,
-  0x1b, 0xfb, 0x48, 0xec, 0x40, 0x60, 0x4f, 0xf4, 0x80, 0x26, 0x88, 0xe7,
-  0xe4, 0xbc, 0x00, 0x20, 0x60, 0xde, 0x00, 0x20, 0x00, 0x23, 0x30, 0xb5,
-  0x85, 0xb0, 0x4f, 0xf4, 0x7f, 0x0c, 0x01, 0x93, 0x02, 0x46, 0xcd, 0xe9,
-  0x02, 0x33, 0x60, 0xee, 0x14, 0xc0, 0x4f, 0xf0, 0x50, 0x43, 0x4b, 0x49,
-  0x4b, 0x48, 0x09, 0x68, 0x01, 0xeb, 0x02, 0x0e, 0x5a, 0x68, 0x5c, 0x68,
-  0x15, 0x01, 0x59, 0x68, 0xfa, 0xd4, 0x10, 0xee, 0x18, 0x50, 0xaa, 0xb2,
-  0xb2, 0xf5, 0x40, 0x4f, 0xf4, 0xd2, 0xe4, 0x01, 0x1a, 0xd4, 0x40, 0xee,
-  0x14, 0xc0, 0x10, 0xee, 0x10, 0x10, 0x52, 0x0b, 0x0d, 0xeb, 0x42, 0x02,
-  0x92, 0x88, 0xc5, 0xf3, 0x0c, 0x05, 0xc2, 0xf3, 0x0b, 0x02, 0x0e, 0xeb,
-  0x42, 0x32, 0x52, 0x5d, 0x81, 0xea, 0x02, 0x42, 0x02, 0xf4, 0x7f, 0x02,
-  0x20, 0xee, 0x10, 0x20, 0x5a, 0x68, 0xd2, 0x01, 0xfc, 0xd5, 0x60, 0xee,
-  0x14, 0xc0, 0xd7, 0xe7, 0x11, 0xf0, 0x80, 0x61, 0xd4, 0xd1, 0x02, 0x40,
-  0xb2, 0xf5, 0xd0, 0x4f, 0x53, 0xd0, 0x30, 0xd8, 0xb2, 0xf5, 0x40, 0x5f,
-  0x3d, 0xd0, 0x0b, 0xd8, 0xb2, 0xf5, 0x00, 0x5f, 0x50, 0xd0, 0x51, 0xd8,
-  0xb2, 0xf5, 0x80, 0x5f, 0x0e, 0xd0, 0xb2, 0xf5, 0xc0, 0x5f, 0x1e, 0xd1,
-  0x01, 0x22, 0x0a, 0xe0, 0xb2, 0xf5, 0xb0, 0x4f, 0xfa, 0xd0, 0x40, 0xd8,
-  0xb2, 0xf5, 0x60, 0x5f, 0x27, 0xd0, 0xb2, 0xf5, 0xa0, 0x4f, 0x12, 0xd1,
-  0x00, 0x22, 0x10, 0xee, 0x18, 0x10, 0x04, 0xac, 0xed, 0x07, 0xc1, 0xf3,
-  0x07, 0x41, 0x04, 0xeb, 0x42, 0x04, 0x1e, 0xd5, 0x14, 0xf8, 0x0c, 0x4c,
-  0x52, 0x00, 0x44, 0xea, 0x01, 0x21, 0x6a, 0x44, 0xc1, 0xf3, 0x0b, 0x01,
-  0x91, 0x80, 0x5a, 0x68, 0x52, 0x01, 0xfc, 0xd5, 0x9e, 0xe7, 0xb2, 0xf5,
-  0x20, 0x4f, 0x23, 0xd0, 0x14, 0xd8, 0xb2, 0xf5, 0x10, 0x4f, 0xe1, 0xd0,
-  0x24, 0xd8, 0xb2, 0xf5, 0xe0, 0x4f, 0x04, 0xd0, 0xb2, 0xf5, 0xf0, 0x4f,
-  0xed, 0xd1, 0x05, 0x22, 0xd9, 0xe7, 0x04, 0x22, 0xd7, 0xe7, 0x34, 0xf8,
-  0x0c, 0x4c, 0x52, 0x00, 0x04, 0xf4, 0x7f, 0x44, 0x21, 0x43, 0xde, 0xe7,
-  0xb2, 0xf5, 0x30, 0x4f, 0xf3, 0xd0, 0xb2, 0xf5, 0x38, 0x4f, 0xee, 0xd0,
-  0xb2, 0xf5, 0x28, 0x4f, 0xd9, 0xd1, 0x03, 0x22, 0xc5, 0xe7, 0xb2, 0xf5,
-  0xc0, 0x4f, 0xd4, 0xd1, 0x02, 0x22, 0xc0, 0xe7, 0xb2, 0xf5, 0x20, 0x5f,
-  0xf5, 0xd0, 0xce, 0xe7, 0xb2, 0xf5, 0x18, 0x4f, 0xac, 0xd0, 0xca, 0xe7,
-  0xe4, 0xbc, 0x00, 0x20, 0x00, 0xf8, 0xff, 0xff, 0x00, 0x23, 0x30, 0xb5,
-  0x83, 0xb0, 0x4f, 0xf4, 0x7f, 0x0c, 0x00, 0x93, 0x02, 0x46, 0xad, 0xf8,
-  0x04, 0x30, 0x60, 0xee, 0x14, 0xc0, 0x4f, 0xf0, 0x50, 0x43, 0x39, 0x49,
-  0x39, 0x48, 0x09, 0x68, 0x01, 0xeb, 0x02, 0x0e, 0x5a, 0x68, 0x5c, 0x68,
-  0x15, 0x01, 0x59, 0x68, 0xfa, 0xd4, 0x10, 0xee, 0x18, 0x50, 0xaa, 0xb2,
-  0xb2, 0xf5, 0x40, 0x4f, 0xf4, 0xd2, 0xe4, 0x01, 0x1a, 0xd4, 0x40, 0xee,
-  0x14, 0xc0, 0x10, 0xee, 0x10, 0x10, 0x92, 0x0b, 0x0d, 0xeb, 0x42, 0x02,
-  0x12, 0x88, 0xc5, 0xf3, 0x0d, 0x05, 0xc2, 0xf3, 0x0b, 0x02, 0x0e, 0xeb,
-  0x82, 0x32, 0x52, 0x5d, 0x81, 0xea, 0x02, 0x42, 0x02, 0xf4, 0x7f, 0x02,
-  0x20, 0xee, 0x10, 0x20, 0x5a, 0x68, 0xd2, 0x01, 0xfc, 0xd5, 0x60, 0xee,
-  0x14, 0xc0, 0xd7, 0xe7, 0x11, 0xf0, 0x80, 0x61, 0xd4, 0xd1, 0x02, 0x40,
-  0xb2, 0xf5, 0xc0, 0x4f, 0x0a, 0xd0, 0x21, 0xd8, 0xb2, 0xf5, 0x40, 0x5f,
-  0x34, 0xd0, 0x35, 0xd8, 0xb2, 0xf5, 0x80, 0x5f, 0x03, 0xd0, 0xb2, 0xf5,
-  0x00, 0x5f, 0x13, 0xd1, 0x01, 0x21, 0x10, 0xee, 0x18, 0x20, 0xc2, 0xf3,
-  0x07, 0x44, 0xed, 0x07, 0x02, 0xaa, 0x02, 0xeb, 0x41, 0x02, 0x19, 0xd5,
-  0x12, 0xf8, 0x08, 0x2c, 0x49, 0x00, 0x42, 0xea, 0x04, 0x24, 0x0d, 0xeb,
-  0x01, 0x02, 0xc4, 0xf3, 0x0b, 0x01, 0x11, 0x80, 0x5a, 0x68, 0x52, 0x01,
-  0xfc, 0xd5, 0xad, 0xe7, 0xb2, 0xf5, 0x20, 0x4f, 0xe4, 0xd0, 0x0e, 0xd8,
-  0xb2, 0xf5, 0xe0, 0x4f, 0x0e, 0xd0, 0xb2, 0xf5, 0x10, 0x4f, 0xf1, 0xd1,
-  0x00, 0x21, 0xdc, 0xe7, 0x32, 0xf8, 0x08, 0x2c, 0x49, 0x00, 0x02, 0xf4,
-  0x7f, 0x42, 0x14, 0x43, 0xe3, 0xe7, 0xb2, 0xf5, 0x30, 0x4f, 0xe5, 0xd1,
-  0x02, 0x21, 0xd0, 0xe7, 0xb2, 0xf5, 0xa0, 0x4f, 0xcd, 0xd0, 0xdf, 0xe7,
-  0xe4, 0xbc, 0x00, 0x20, 0x00, 0xf8, 0xff, 0xff, 0x43, 0x1e, 0x3a, 0x30,
-  0x01, 0xe0, 0x83, 0x42, 0x05, 0xd0, 0x13, 0xf8, 0x01, 0x2f, 0xff, 0x2a,
-  0xf9, 0xd0, 0x00, 0x20, 0x70, 0x47, 0x01, 0x20, 0x70, 0x47, 0x00, 0xbf,
-  0x2d, 0xe9, 0xf8, 0x43, 0x07, 0x46, 0x2e, 0x20, 0xf7, 0xf7, 0xb8, 0xf8,
-  0x2e, 0x25, 0x4f, 0xf0, 0x01, 0x06, 0x46, 0xec, 0x44, 0x50, 0x4f, 0xf0,
-  0x00, 0x03, 0x43, 0xec, 0x40, 0x50, 0x4f, 0xf4, 0x00, 0x42, 0x00, 0x21,
-  0x47, 0x48, 0xff, 0xf7, 0x75, 0xf9, 0x47, 0x4b, 0x4f, 0xf4, 0x00, 0x42,
-  0x1c, 0x68, 0x44, 0x48, 0xe1, 0x19, 0xff, 0xf7, 0xbb, 0xf9, 0x46, 0xec,
-  0x40, 0x50, 0x07, 0xf5, 0x80, 0x43, 0x1c, 0x44, 0x41, 0x4e, 0x04, 0xf5,
-  0xec, 0x58, 0x20, 0x46, 0xff, 0xf7, 0xca, 0xff, 0x60, 0xbb, 0xa4, 0x46,
-  0x35, 0x46, 0x04, 0xf1, 0x30, 0x09, 0xae, 0x46, 0xdc, 0xf8, 0x00, 0x00,
-  0xdc, 0xf8, 0x04, 0x10, 0xdc, 0xf8, 0x08, 0x20, 0xdc, 0xf8, 0x0c, 0x30,
-  0x0c, 0xf1, 0x10, 0x0c, 0xcc, 0x45, 0xae, 0xe8, 0x0f, 0x00, 0x05, 0xf1,
-  0x10, 0x05, 0xee, 0xd1, 0xbc, 0xf8, 0x00, 0x30, 0x04, 0xf1, 0x33, 0x00,
-  0x2b, 0x80, 0x94, 0xf8, 0x32, 0x30, 0x3c, 0x36, 0x06, 0xf8, 0x0a, 0x3c,
-  0xff, 0xf7, 0x8a, 0xfb, 0x03, 0x46, 0x04, 0xf1, 0x37, 0x00, 0x46, 0xf8,
-  0x08, 0x3c, 0xff, 0xf7, 0x83, 0xfb, 0x3b, 0x34, 0x44, 0x45, 0x46, 0xf8,
-  0x04, 0x0c, 0xce, 0xd1, 0x4f, 0xf4, 0x7f, 0x0c, 0x60, 0xee, 0x14, 0xc0,
-  0x00, 0x26, 0x23, 0x4b, 0x4f, 0xf0, 0x50, 0x42, 0x03, 0xeb, 0x07, 0x0e,
-  0x30, 0x46, 0x49, 0xf6, 0x81, 0x57, 0x55, 0x68, 0x53, 0x68, 0x03, 0xf0,
-  0x80, 0x73, 0x10, 0xee, 0x18, 0x10, 0x2d, 0x01, 0x8c, 0xb2, 0x1f, 0xd4,
-  0x55, 0x68, 0x6d, 0x01, 0x01, 0xd4, 0xbc, 0x42, 0x22, 0xd0, 0xa4, 0xf5,
-  0x80, 0x45, 0x2d, 0x04, 0x16, 0xd4, 0x00, 0x2b, 0xeb, 0xd1, 0x40, 0xee,
-  0x14, 0xc0, 0x10, 0xee, 0x10, 0x30, 0x1e, 0xfa, 0x81, 0xf1, 0xa1, 0xf5,
-  0x80, 0x41, 0x09, 0x78, 0x83, 0xea, 0x01, 0x43, 0x03, 0xf4, 0x7f, 0x03,
-  0x20, 0xee, 0x10, 0x30, 0x53, 0x68, 0xdb, 0x01, 0xfc, 0xd5, 0x60, 0xee,
-  0x14, 0xc0, 0xd6, 0xe7, 0x00, 0x2b, 0xd4, 0xd1, 0x00, 0x2c, 0xd2, 0xd1,
-  0x00, 0x2e, 0xd0, 0xd0, 0xbd, 0xe8, 0xf8, 0x83, 0x10, 0xee, 0x18, 0x00,
-  0xc0, 0xf3, 0x07, 0x40, 0x54, 0x68, 0x66, 0x01, 0xfc, 0xd5, 0x60, 0xee,
-  0x14, 0xc0, 0x01, 0x26, 0x00, 0x2b, 0xc2, 0xd1, 0xd5, 0xe7, 0x00, 0xbf,
-  0x60, 0xde, 0x00, 0x20, 0xe4, 0xbc, 0x00, 0x20, 0x60, 0xc0, 0x00, 0x20,
-  0x70, 0xb5, 0x05, 0x46, 0x82, 0xb0, 0x38, 0x48, 0xfe, 0xf7, 0xf8, 0xfe,
-  0x2e, 0x20, 0xf7, 0xf7, 0x0d, 0xf8, 0x2e, 0x24, 0x4f, 0xf0, 0x01, 0x06,
-  0x46, 0xec, 0x44, 0x40, 0x4f, 0xf0, 0x00, 0x03, 0x43, 0xec, 0x40, 0x40,
-  0x4f, 0xf4, 0x00, 0x32, 0x00, 0x21, 0x30, 0x48, 0xff, 0xf7, 0xca, 0xf8,
-  0x2f, 0x4b, 0x4f, 0xf4, 0x00, 0x32, 0x19, 0x68, 0x2c, 0x48, 0x29, 0x44,
-  0xff, 0xf7, 0x10, 0xf9, 0x46, 0xec, 0x40, 0x40, 0x4f, 0xf4, 0x80, 0x73,
-  0x4f, 0xf4, 0x7f, 0x04, 0xad, 0xf8, 0x04, 0x30, 0x60, 0xee, 0x14, 0x40,
-  0x4f, 0xf0, 0x50, 0x43, 0x24, 0x4d, 0x5a, 0x68, 0x59, 0x68, 0x12, 0x01,
-  0x58, 0x68, 0xfa, 0xd4, 0x10, 0xee, 0x18, 0xc0, 0x1f, 0xfa, 0x8c, 0xf2,
-  0xa2, 0xf5, 0x80, 0x4e, 0x1e, 0xf4, 0x00, 0x4f, 0xf1, 0xd1, 0xce, 0x01,
-  0x1a, 0xd4, 0x40, 0xee, 0x14, 0x40, 0x10, 0xee, 0x10, 0x10, 0x02, 0xa8,
-  0x00, 0xeb, 0xd2, 0x32, 0x12, 0xf8, 0x04, 0x2c, 0xcc, 0xf3, 0x0d, 0x0c,
-  0x05, 0xeb, 0x82, 0x32, 0x12, 0xf8, 0x0c, 0x20, 0x81, 0xea, 0x02, 0x42,
-  0x02, 0xf4, 0x7f, 0x02, 0x20, 0xee, 0x10, 0x20, 0x5a, 0x68, 0xd0, 0x01,
-  0xfc, 0xd5, 0x60, 0xee, 0x14, 0x40, 0xd4, 0xe7, 0x41, 0x01, 0xd2, 0xd4,
-  0xa2, 0xf5, 0xc0, 0x41, 0xb1, 0xf5, 0x00, 0x6f, 0x08, 0xd2, 0x10, 0xee,
-  0x18, 0x20, 0x12, 0x0c, 0x8d, 0xf8, 0x04, 0x20, 0x5a, 0x68, 0x52, 0x01,
-  0xfc, 0xd5, 0xc4, 0xe7, 0xa2, 0xf5, 0xe0, 0x42, 0xb2, 0xf5, 0x00, 0x6f,
-  0xf6, 0xd2, 0x10, 0xee, 0x18, 0x20, 0x12, 0x0c, 0x8d, 0xf8, 0x05, 0x20,
-  0xf0, 0xe7, 0x00, 0xbf, 0x31, 0x86, 0x00, 0x20, 0x60, 0xde, 0x00, 0x20,
-  0xe4, 0xbc, 0x00, 0x20, 0x70, 0xb5, 0x61, 0x4b, 0x61, 0x4a, 0x84, 0xb0,
-  0x61, 0x48, 0xda, 0x60, 0x01, 0xa9, 0x03, 0xab, 0x02, 0xaa, 0xf7, 0xf7,
-  0xa9, 0xff, 0x18, 0xb9, 0x5d, 0x49, 0x5e, 0x48, 0xf6, 0xf7, 0xd0, 0xff,
-  0x01, 0x98, 0xdd, 0xe9, 0x02, 0x12, 0xf7, 0xf7, 0xdd, 0xfe, 0x00, 0x24,
-  0xfa, 0xf7, 0x54, 0xf8, 0x20, 0x46, 0xf6, 0xf7, 0x81, 0xff, 0x20, 0x46,
-  0x01, 0x21, 0x01, 0x34, 0xf6, 0xf7, 0x4e, 0xff, 0x18, 0x2c, 0xf5, 0xd1,
-  0x00, 0x26, 0x46, 0xec, 0x44, 0x60, 0x01, 0x23, 0x46, 0xec, 0x44, 0x30,
-  0x02, 0x23, 0x46, 0xec, 0x44, 0x30, 0x03, 0x23, 0x46, 0xec, 0x44, 0x30,
-  0x04, 0x23, 0x46, 0xec, 0x44, 0x30, 0x05, 0x23, 0x46, 0xec, 0x44, 0x30,
-  0x06, 0x23, 0x46, 0xec, 0x44, 0x30, 0x07, 0x23, 0x46, 0xec, 0x44, 0x30,
-  0x08, 0x23, 0x46, 0xec, 0x44, 0x30, 0x09, 0x23, 0x46, 0xec, 0x44, 0x30,
-  0x0a, 0x23, 0x46, 0xec, 0x44, 0x30, 0x0b, 0x23, 0x46, 0xec, 0x44, 0x30,
-  0x0c, 0x23, 0x46, 0xec, 0x44, 0x30, 0x0d, 0x23, 0x46, 0xec, 0x44, 0x30,
-  0x0e, 0x23, 0x46, 0xec, 0x44, 0x30, 0x0f, 0x23, 0x46, 0xec, 0x44, 0x30,
-  0x20, 0x46, 0xf6, 0xf7, 0x47, 0xff, 0x46, 0xec, 0x44, 0x40, 0x1a, 0x20,
-  0xf6, 0xf7, 0x42, 0xff, 0x1a, 0x23, 0x46, 0xec, 0x44, 0x30, 0x1c, 0x20,
-  0xf6, 0xf7, 0x3c, 0xff, 0x1c, 0x23, 0x46, 0xec, 0x44, 0x30, 0x1b, 0x20,
-  0xf6, 0xf7, 0x36, 0xff, 0x1b, 0x23, 0x46, 0xec, 0x44, 0x30, 0x2f, 0x20,
-  0xf6, 0xf7, 0x30, 0xff, 0x2f, 0x23, 0x46, 0xec, 0x44, 0x30, 0x30, 0x46,
-  0xff, 0xf7, 0x6c, 0xfe, 0x3c, 0x23, 0x2c, 0x4a, 0x03, 0xfb, 0x00, 0x23,
-  0x93, 0xf8, 0x32, 0x10, 0x4b, 0x1e, 0x09, 0x2b, 0x42, 0xd8, 0xdf, 0xe8,
-  0x03, 0xf0, 0x05, 0x05, 0x0c, 0x13, 0x1a, 0x21, 0x28, 0x2f, 0x35, 0x3b,
-  0x3c, 0x23, 0x03, 0xfb, 0x00, 0x23, 0x01, 0x21, 0x98, 0x6b, 0xff, 0xf7,
-  0x2b, 0xfa, 0x3c, 0x23, 0x03, 0xfb, 0x00, 0x23, 0x01, 0x21, 0x98, 0x6b,
-  0xff, 0xf7, 0xba, 0xfa, 0x3c, 0x23, 0x03, 0xfb, 0x00, 0x23, 0x01, 0x21,
-  0x98, 0x6b, 0xff, 0xf7, 0x69, 0xfa, 0x3c, 0x23, 0x03, 0xfb, 0x00, 0x23,
-  0x01, 0x21, 0x98, 0x6b, 0xff, 0xf7, 0xe0, 0xfb, 0x3c, 0x23, 0x03, 0xfb,
-  0x00, 0x23, 0x01, 0x21, 0x98, 0x6b, 0xff, 0xf7, 0x77, 0xfc, 0x3c, 0x23,
-  0x03, 0xfb, 0x00, 0x23, 0x01, 0x21, 0x98, 0x6b, 0xff, 0xf7, 0x3e, 0xfb,
-  0x3c, 0x23, 0x03, 0xfb, 0x00, 0x23, 0x98, 0x6b, 0xff, 0xf7, 0xf2, 0xfc,
-  0x3c, 0x23, 0x03, 0xfb, 0x00, 0x23, 0x98, 0x6b, 0xff, 0xf7, 0x94, 0xfd,
-  0x3c, 0x23, 0x03, 0xfb, 0x00, 0x23, 0x98, 0x6b, 0xff, 0xf7, 0xc8, 0xfe,
-  0x07, 0x48, 0xfa, 0xf7, 0x6f, 0xf8, 0x00, 0x20, 0x04, 0xb0, 0x70, 0xbd,
-  0x00, 0x00, 0x0d, 0x40, 0x02, 0x02, 0x00, 0x40, 0x90, 0xd0, 0x03, 0x00,
-  0x44, 0x9c, 0x00, 0x20, 0x60, 0xc0, 0x00, 0x20, 0x78, 0x9c, 0x00, 0x20,
-  0x4f, 0xf0, 0x50, 0x43, 0x10, 0xb5, 0x02, 0x68, 0x93, 0xf9, 0x00, 0x40,
-  0xef, 0xf3, 0x10, 0x83, 0x72, 0xb6, 0xd2, 0xe8, 0xcf, 0xcf, 0x01, 0x21,
-  0xbc, 0xf1, 0x00, 0x0f, 0xf9, 0xd1, 0xc2, 0xe8, 0x4c, 0x1f, 0xbc, 0xf1,
-  0x00, 0x0f, 0xf4, 0xd1, 0xbf, 0xf3, 0x5f, 0x8f, 0x90, 0xf9, 0x04, 0x20,
-  0x00, 0x2a, 0x1c, 0xdb, 0x00, 0x21, 0x02, 0x68, 0xc2, 0xe8, 0x8f, 0x1f,
-  0x83, 0xf3, 0x10, 0x88, 0x20, 0xbf, 0x02, 0x68, 0xef, 0xf3, 0x10, 0x83,
-  0x72, 0xb6, 0xd2, 0xe8, 0xcf, 0xef, 0x5f, 0xf0, 0x01, 0x0c, 0xbe, 0xf1,
-  0x00, 0x0f, 0xf8, 0xd1, 0xc2, 0xe8, 0x4e, 0xcf, 0xbe, 0xf1, 0x00, 0x0f,
-  0xf3, 0xd1, 0xbf, 0xf3, 0x5f, 0x8f, 0x90, 0xf9, 0x04, 0x20, 0x00, 0x2a,
-  0xe3, 0xda, 0x00, 0x22, 0x01, 0x68, 0x04, 0x71, 0xc1, 0xe8, 0x8f, 0x2f,
-  0x83, 0xf3, 0x10, 0x88, 0x10, 0xbd, 0x00, 0xbf, 0x4f, 0xf0, 0x50, 0x41,
-  0x2d, 0xe9, 0xf0, 0x41, 0x00, 0x27, 0x04, 0x46, 0x16, 0x46, 0x1d, 0x46,
-  0xd1, 0xf8, 0x00, 0x80, 0x08, 0xe0, 0xc1, 0xe8, 0x8f, 0x7f, 0x8c, 0xf3,
-  0x10, 0x88, 0x30, 0x46, 0x29, 0x46, 0xf7, 0xf7, 0xc1, 0xfc, 0xe8, 0xb9,
-  0x21, 0x68, 0xef, 0xf3, 0x10, 0x8c, 0x72, 0xb6, 0xd1, 0xe8, 0xcf, 0x2f,
-  0x01, 0x23, 0x00, 0x2a, 0xfa, 0xd1, 0xc1, 0xe8, 0x42, 0x3f, 0x00, 0x2a,
-  0xf6, 0xd1, 0xbf, 0xf3, 0x5f, 0x8f, 0x94, 0xf9, 0x04, 0x30, 0x21, 0x68,
-  0x00, 0x2b, 0xe2, 0xda, 0x00, 0x23, 0x84, 0xf8, 0x04, 0x80, 0xc1, 0xe8,
-  0x8f, 0x3f, 0x8c, 0xf3, 0x10, 0x88, 0x01, 0x20, 0xbd, 0xe8, 0xf0, 0x81,
-  0x00, 0x20, 0xbd, 0xe8, 0xf0, 0x81, 0x00, 0xbf, 0x30, 0xb5, 0x04, 0x68,
-  0xef, 0xf3, 0x10, 0x8c, 0x72, 0xb6, 0xd4, 0xe8, 0xcf, 0xef, 0x01, 0x25,
-  0xbe, 0xf1, 0x00, 0x0f, 0xf9, 0xd1, 0xc4, 0xe8, 0x4e, 0x5f, 0xbe, 0xf1,
-  0x00, 0x0f, 0xf4, 0xd1, 0xbf, 0xf3, 0x5f, 0x8f, 0x90, 0xf9, 0x04, 0x40,
-  0x05, 0x68, 0x00, 0x2c, 0x10, 0xdb, 0x00, 0x21, 0xc5, 0xe8, 0x8f, 0x1f,
-  0x8c, 0xf3, 0x10, 0x88, 0x4f, 0xf0, 0x50, 0x45, 0x95, 0xf9, 0x00, 0x50,
-  0xa5, 0x42, 0x01, 0xd1, 0x08, 0x46, 0x30, 0xbd, 0xbd, 0xe8, 0x30, 0x40,
-  0xff, 0xf7, 0xa2, 0xbf, 0x4f, 0xf0, 0x50, 0x42, 0x12, 0x68, 0x00, 0x23,
-  0x02, 0x71, 0xc5, 0xe8, 0x8f, 0x3f, 0x8c, 0xf3, 0x10, 0x88, 0x01, 0x20,
-  0x30, 0xbd, 0x00, 0xbf, 0x03, 0x68, 0xef, 0xf3, 0x10, 0x82, 0x72, 0xb6,
-  0xd3, 0xe8, 0xcf, 0xcf, 0x01, 0x21, 0xbc, 0xf1, 0x00, 0x0f, 0xf9, 0xd1,
-  0xc3, 0xe8, 0x4c, 0x1f, 0xbc, 0xf1, 0x00, 0x0f, 0xf4, 0xd1, 0xbf, 0xf3,
-  0x5f, 0x8f, 0x4f, 0xf0, 0xff, 0x0c, 0x00, 0x23, 0x01, 0x68, 0x80, 0xf8,
-  0x04, 0xc0, 0xc1, 0xe8, 0x8f, 0x3f, 0x82, 0xf3, 0x10, 0x88, 0x40, 0xbf,
-  0x70, 0x47, 0x00, 0xbf, 0x70, 0xb5, 0x00, 0x24, 0x4f, 0xf0, 0xa0, 0x45,
-  0x01, 0x26, 0x00, 0xe0, 0x01, 0x34, 0xf6, 0xf7, 0x91, 0xfd, 0x84, 0x42,
-  0x18, 0xd2, 0x20, 0x46, 0xf6, 0xf7, 0x8e, 0xfd, 0x00, 0x28, 0xf5, 0xd0,
-  0x02, 0x78, 0x02, 0x2a, 0xf2, 0xd1, 0x43, 0x68, 0xda, 0x69, 0xd3, 0xf8,
-  0x48, 0x32, 0x0a, 0x2a, 0x06, 0xfa, 0x03, 0xf3, 0xea, 0xd1, 0xd5, 0xf8,
-  0x0c, 0x24, 0x1a, 0x42, 0xe6, 0xd0, 0xc5, 0xf8, 0x0c, 0x34, 0x00, 0xf0,
-  0x29, 0xf8, 0xe1, 0xe7, 0x70, 0xbd, 0x00, 0xbf, 0x70, 0xb5, 0x00, 0x24,
-  0x4f, 0xf0, 0xa0, 0x45, 0x01, 0x26, 0x00, 0xe0, 0x01, 0x34, 0xf6, 0xf7,
-  0x6b, 0xfd, 0x84, 0x42, 0x18, 0xd2, 0x20, 0x46, 0xf6, 0xf7, 0x68, 0xfd,
-  0x00, 0x28, 0xf5, 0xd0, 0x02, 0x78, 0x02, 0x2a, 0xf2, 0xd1, 0x43, 0x68,
-  0xda, 0x69, 0xd3, 0xf8, 0x48, 0x32, 0x0b, 0x2a, 0x06, 0xfa, 0x03, 0xf3,
-  0xea, 0xd1, 0xd5, 0xf8, 0x1c, 0x24, 0x1a, 0x42, 0xe6, 0xd0, 0xc5, 0xf8,
-  0x1c, 0x34, 0x00, 0xf0, 0x03, 0xf8, 0xe1, 0xe7, 0x70, 0xbd, 0x00, 0xbf,
-  0x2d, 0xe9, 0xf0, 0x41, 0x45, 0x68, 0x04, 0x46, 0x95, 0xf8, 0x80, 0x32,
-  0x02, 0x2b, 0x59, 0xd0, 0x03, 0x2b, 0x01, 0xd0, 0xbd, 0xe8, 0xf0, 0x81,
-  0xd5, 0xf8, 0x48, 0x22, 0x93, 0x01, 0x03, 0xf1, 0xa0, 0x43, 0x1b, 0x69,
-  0x5b, 0x01, 0xf5, 0xd4, 0xd5, 0xf8, 0xb8, 0x32, 0x13, 0xf1, 0x01, 0x1f,
-  0x94, 0xbf, 0x1a, 0x46, 0x1a, 0x04, 0xb2, 0xf1, 0x7f, 0x4f, 0x28, 0xbf,
-  0x12, 0x02, 0xb2, 0xf1, 0x70, 0x4f, 0x28, 0xbf, 0x12, 0x01, 0xb2, 0xf1,
-  0x40, 0x4f, 0x28, 0xbf, 0x92, 0x00, 0x00, 0x2a, 0xb8, 0xbf, 0x52, 0x00,
-  0xc2, 0xf3, 0x02, 0x72, 0x02, 0x2a, 0x75, 0xd0, 0x05, 0x2a, 0x76, 0xd0,
-  0x06, 0x2a, 0x0b, 0xbf, 0x3e, 0x4a, 0x3f, 0x4a, 0x40, 0xf2, 0x6a, 0x21,
-  0x40, 0xf2, 0x6f, 0x21, 0x3d, 0x48, 0xfe, 0xf7, 0xb9, 0xf9, 0x08, 0x22,
-  0x63, 0x68, 0x85, 0xf8, 0xb4, 0x22, 0x93, 0xf8, 0xb4, 0x22, 0x20, 0x46,
-  0x00, 0x2a, 0x42, 0xd1, 0xd3, 0xe9, 0xa3, 0x21, 0x01, 0x32, 0x8a, 0x42,
-  0xc3, 0xf8, 0x8c, 0x22, 0x3b, 0xd2, 0xf9, 0xf7, 0xf9, 0xff, 0x02, 0x21,
-  0x64, 0x68, 0xd4, 0xe9, 0xa4, 0x23, 0x93, 0x42, 0x84, 0xf8, 0x80, 0x12,
-  0xb4, 0xd2, 0xd4, 0xf8, 0x88, 0x02, 0x5a, 0x1c, 0x80, 0x21, 0xc4, 0xf8,
-  0x94, 0x22, 0x00, 0xeb, 0x43, 0x20, 0xfa, 0xf7, 0x01, 0xf9, 0xc4, 0xe9,
-  0xa8, 0x01, 0xa7, 0xe7, 0xd5, 0xf8, 0x44, 0x32, 0x9b, 0x01, 0x03, 0xf1,
-  0xa0, 0x43, 0x1b, 0x69, 0x58, 0x01, 0x9f, 0xd4, 0xd5, 0xf8, 0x48, 0x22,
-  0x93, 0x01, 0x03, 0xf1, 0xa0, 0x40, 0x01, 0x69, 0x49, 0x01, 0x97, 0xd4,
-  0x03, 0x21, 0x4f, 0xf0, 0x01, 0x0e, 0x85, 0xf8, 0x80, 0x12, 0xd5, 0xf8,
-  0x50, 0x62, 0xa9, 0x69, 0x06, 0xf1, 0x08, 0x0c, 0x4f, 0x68, 0x0e, 0xfa,
-  0x0c, 0xf8, 0x18, 0xea, 0x07, 0x0f, 0x08, 0xd1, 0x51, 0xf8, 0x2c, 0x20,
-  0xc5, 0xf8, 0xb8, 0x22, 0x87, 0xe7, 0xbd, 0xe8, 0xf0, 0x41, 0xfa, 0xf7,
-  0x5d, 0xb8, 0x01, 0xeb, 0x8c, 0x07, 0x01, 0xf1, 0x2f, 0x41, 0x01, 0xf5,
-  0x60, 0x01, 0x09, 0x0d, 0x04, 0x36, 0x06, 0xeb, 0xc1, 0x06, 0x10, 0x49,
-  0x07, 0x60, 0x01, 0xea, 0x42, 0x32, 0x42, 0xea, 0x46, 0x42, 0x42, 0xf0,
-  0x09, 0x02, 0x05, 0xf5, 0x2e, 0x71, 0x41, 0x60, 0xc0, 0xf8, 0x08, 0xe0,
-  0xc2, 0x60, 0x6a, 0xe7, 0x2b, 0x46, 0x00, 0x22, 0x95, 0xe7, 0x08, 0x4a,
-  0x40, 0xf2, 0x65, 0x21, 0x04, 0x48, 0xfe, 0xf7, 0x47, 0xf9, 0x07, 0x22,
-  0x63, 0x68, 0x8c, 0xe7, 0x84, 0x9d, 0x00, 0x20, 0xb4, 0x9d, 0x00, 0x20,
-  0x5c, 0xa4, 0x00, 0x20, 0xfd, 0xff, 0x01, 0xfc, 0x54, 0x9d, 0x00, 0x20,
-  0x70, 0xb5, 0x04, 0x46, 0x0d, 0x46, 0xf7, 0xf7, 0xc5, 0xfb, 0x4f, 0xf4,
-  0x7a, 0x72, 0x00, 0x23, 0xfe, 0xf7, 0x00, 0xfc, 0x06, 0x46, 0x63, 0x6a,
-  0x9b, 0x01, 0x03, 0xf1, 0xa0, 0x42, 0x12, 0x69, 0x51, 0x01, 0x06, 0xd4,
-  0x22, 0x6a, 0x92, 0x01, 0x02, 0xf1, 0xa0, 0x42, 0x12, 0x69, 0x52, 0x01,
-  0x0b, 0xd5, 0xf7, 0xf7, 0xaf, 0xfb, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23,
-  0xfe, 0xf7, 0xea, 0xfb, 0x80, 0x1b, 0xa8, 0x42, 0xe7, 0xd3, 0x63, 0x6a,
-  0x9b, 0x01, 0x03, 0xf1, 0xa0, 0x43, 0x1b, 0x69, 0x5b, 0x01, 0x06, 0xd4,
-  0x23, 0x6a, 0x9b, 0x01, 0x03, 0xf1, 0xa0, 0x43, 0x1b, 0x69, 0x5e, 0x01,
-  0x34, 0xd5, 0x01, 0x20, 0x23, 0x68, 0xda, 0x68, 0xde, 0x68, 0xdd, 0x68,
-  0xd9, 0x68, 0xdb, 0x68, 0x89, 0x07, 0x01, 0xd5, 0xd9, 0x07, 0x1b, 0xd4,
-  0x4f, 0xf0, 0xa0, 0x40, 0x01, 0x23, 0x65, 0x6a, 0x24, 0x6a, 0xa9, 0x01,
-  0xa2, 0x01, 0xab, 0x40, 0x01, 0x44, 0x15, 0x18, 0xed, 0x68, 0xcd, 0x68,
-  0xc0, 0xf8, 0x64, 0x34, 0xcb, 0x68, 0x5b, 0x01, 0xfc, 0xd4, 0x01, 0x21,
-  0xa1, 0x40, 0x02, 0xf1, 0xa0, 0x43, 0xc0, 0xf8, 0x64, 0x14, 0xd8, 0x68,
-  0x10, 0xf0, 0x80, 0x60, 0xfb, 0xd1, 0x70, 0xbd, 0x00, 0x28, 0xe1, 0xd1,
-  0x02, 0xf0, 0x10, 0x03, 0x06, 0xf0, 0x08, 0x06, 0x33, 0x43, 0x05, 0xf0,
-  0x04, 0x05, 0x2b, 0x43, 0x08, 0xbf, 0x01, 0x20, 0xd6, 0xd1, 0x70, 0xbd,
-  0xf7, 0xf7, 0x62, 0xfb, 0x4f, 0xf4, 0x7a, 0x72, 0x00, 0x23, 0xfe, 0xf7,
-  0x9d, 0xfb, 0x06, 0x46, 0x09, 0xe0, 0xf7, 0xf7, 0x59, 0xfb, 0x4f, 0xf4,
-  0x7a, 0x72, 0x00, 0x23, 0xfe, 0xf7, 0x94, 0xfb, 0x80, 0x1b, 0xa8, 0x42,
-  0x07, 0xd2, 0x23, 0x68, 0xda, 0x68, 0xd0, 0x06, 0xf1, 0xd4, 0xd8, 0x68,
-  0xc0, 0xf3, 0x00, 0x10, 0xb1, 0xe7, 0x23, 0x68, 0xf9, 0xe7, 0x00, 0xbf,
-  0x2d, 0xe9, 0xf0, 0x47, 0x87, 0x6a, 0x04, 0x46, 0x98, 0x46, 0x27, 0xf0,
-  0x30, 0x07, 0x00, 0x29, 0x56, 0xd0, 0xe6, 0x6a, 0x47, 0xf0, 0x10, 0x07,
-  0xa7, 0x62, 0x26, 0xf0, 0xc0, 0x06, 0x00, 0x2a, 0x55, 0xd0, 0x46, 0xf0,
-  0x40, 0x06, 0x4f, 0xf0, 0xa0, 0x4e, 0xd4, 0xe9, 0x08, 0x59, 0x01, 0x23,
-  0x4f, 0xea, 0x85, 0x1c, 0x20, 0x68, 0xf4, 0x44, 0xe6, 0x62, 0x03, 0xfa,
-  0x05, 0xf5, 0xcc, 0xf8, 0x00, 0x10, 0x03, 0xfa, 0x09, 0xf3, 0x4f, 0xea,
-  0x89, 0x11, 0x71, 0x44, 0x1d, 0x43, 0x00, 0xf1, 0x08, 0x0a, 0xcc, 0xf8,
-  0x04, 0xa0, 0xcc, 0xf8, 0x08, 0x80, 0xcc, 0xf8, 0x10, 0x70, 0xc1, 0xf8,
-  0x00, 0xa0, 0x4a, 0x60, 0xc1, 0xf8, 0x08, 0x80, 0x0e, 0x61, 0xce, 0xf8,
-  0x50, 0x54, 0xfe, 0xf7, 0xc5, 0xfa, 0x05, 0x46, 0x4f, 0xea, 0xc8, 0x00,
-  0xf7, 0xf7, 0xb4, 0xff, 0x06, 0x46, 0x28, 0x46, 0x0f, 0x46, 0xf7, 0xf7,
-  0xaf, 0xff, 0x02, 0x46, 0x0b, 0x46, 0x30, 0x46, 0x39, 0x46, 0xf7, 0xf7,
-  0x3b, 0xff, 0xf7, 0xf7, 0x87, 0xff, 0x9f, 0xed, 0x0f, 0x6a, 0x07, 0xee,
-  0x10, 0x0a, 0xf7, 0xee, 0x08, 0x6a, 0xf1, 0xee, 0x00, 0x7a, 0x27, 0xee,
-  0x06, 0x7a, 0xe7, 0xee, 0x26, 0x7a, 0xfc, 0xee, 0xe7, 0x7a, 0x20, 0x46,
-  0xbd, 0xe8, 0xf0, 0x47, 0x17, 0xee, 0x90, 0x1a, 0xff, 0xf7, 0x1c, 0xbf,
-  0xe6, 0x6a, 0x05, 0x49, 0xa7, 0x62, 0x26, 0xf0, 0xc0, 0x06, 0x00, 0x2a,
-  0xa9, 0xd1, 0x03, 0x4a, 0xa9, 0xe7, 0x00, 0xbf, 0x00, 0x00, 0x7a, 0x44,
-  0x98, 0x9a, 0x00, 0x20, 0xc4, 0xbd, 0x00, 0x20, 0xff, 0x00, 0x00, 0x00,
-  0x70, 0xb5, 0x1d, 0x46, 0x84, 0x46, 0x1c, 0x46, 0x15, 0xb3, 0xc4, 0xb1,
-  0xdc, 0xf8, 0x0c, 0x60, 0x04, 0xf1, 0x08, 0x0e, 0xb6, 0x07, 0x06, 0xd5,
-  0x75, 0x45, 0x33, 0xd2, 0x11, 0xf8, 0x01, 0x0b, 0x01, 0x3c, 0xcc, 0xf8,
-  0x08, 0x00, 0xdc, 0xf8, 0x0c, 0x00, 0x40, 0x07, 0xed, 0xd5, 0xdc, 0xf8,
-  0x08, 0x60, 0x01, 0x3d, 0x02, 0xf8, 0x01, 0x6b, 0x00, 0x2d, 0xe6, 0xd1,
-  0x08, 0xe0, 0xdc, 0xf8, 0x0c, 0x60, 0x76, 0x07, 0xf3, 0xd4, 0xdc, 0xf8,
-  0x0c, 0x60, 0x76, 0x07, 0xef, 0xd4, 0xf6, 0xe7, 0x6c, 0xb1, 0xdc, 0xf8,
-  0x0c, 0x20, 0x90, 0x07, 0xfb, 0xd5, 0x14, 0xf1, 0x08, 0x0f, 0x08, 0xd0,
-  0x11, 0xf8, 0x01, 0x2b, 0x01, 0x3c, 0xcc, 0xf8, 0x08, 0x20, 0x00, 0x2c,
-  0xf1, 0xd1, 0x18, 0x46, 0x70, 0xbd, 0xdc, 0xf8, 0x0c, 0x20, 0x92, 0x07,
-  0xeb, 0xd5, 0xdc, 0xf8, 0x0c, 0x20, 0x92, 0x07, 0xf7, 0xd4, 0xe6, 0xe7,
-  0xdc, 0xf8, 0x0c, 0x00, 0x40, 0x07, 0xd0, 0xd4, 0xbe, 0xe7, 0x00, 0xbf,
-  0x84, 0x46, 0x10, 0x46, 0x6a, 0xb3, 0x01, 0x39, 0x00, 0xb5, 0x01, 0xeb,
-  0x02, 0x0e, 0xdc, 0xf8, 0x0c, 0x30, 0x9b, 0x07, 0xfb, 0xd5, 0x11, 0xf8,
-  0x01, 0x3f, 0x71, 0x45, 0xcc, 0xf8, 0x08, 0x30, 0xf5, 0xd1, 0xdc, 0xf8,
-  0x0c, 0x30, 0x59, 0x07, 0x05, 0xd5, 0xdc, 0xf8, 0x08, 0x30, 0xdc, 0xf8,
-  0x0c, 0x30, 0x59, 0x07, 0xf9, 0xd4, 0xdc, 0xf8, 0x0c, 0x30, 0xda, 0x06,
-  0x06, 0xd5, 0xdc, 0xf8, 0x0c, 0x30, 0xda, 0x06, 0xf7, 0xd4, 0x01, 0xe0,
-  0xdc, 0xf8, 0x08, 0x30, 0xdc, 0xf8, 0x0c, 0x30, 0x5b, 0x07, 0xf9, 0xd4,
-  0x01, 0x23, 0xcc, 0xf8, 0x20, 0x30, 0x5d, 0xf8, 0x04, 0xfb, 0xdc, 0xf8,
-  0x08, 0x30, 0xdc, 0xf8, 0x0c, 0x30, 0x59, 0x07, 0xf9, 0xd4, 0xdc, 0xf8,
-  0x0c, 0x30, 0xda, 0x06, 0x06, 0xd5, 0xdc, 0xf8, 0x0c, 0x30, 0xda, 0x06,
-  0xf7, 0xd4, 0x01, 0xe0, 0xdc, 0xf8, 0x08, 0x30, 0xdc, 0xf8, 0x0c, 0x30,
-  0x5b, 0x07, 0xf9, 0xd4, 0x01, 0x23, 0xcc, 0xf8, 0x20, 0x30, 0x70, 0x47,
-  0x70, 0xb5, 0x1d, 0x46, 0x84, 0x46, 0x1c, 0x46, 0x05, 0xb3, 0xb4, 0xb1,
-  0xdc, 0xf8, 0x0c, 0x60, 0x04, 0xf1, 0x08, 0x0e, 0xb6, 0x07, 0x04, 0xd5,
-  0x75, 0x45, 0x2f, 0xd2, 0xcc, 0xf8, 0x08, 0x10, 0x01, 0x3c, 0xdc, 0xf8,
-  0x0c, 0x00, 0x40, 0x07, 0xef, 0xd5, 0xdc, 0xf8, 0x08, 0x60, 0x01, 0x3d,
-  0x02, 0xf8, 0x01, 0x6b, 0x00, 0x2d, 0xe8, 0xd1, 0x08, 0xe0, 0xdc, 0xf8,
-  0x0c, 0x60, 0x76, 0x07, 0xf3, 0xd4, 0xdc, 0xf8, 0x0c, 0x60, 0x76, 0x07,
-  0xef, 0xd4, 0xf6, 0xe7, 0x5c, 0xb1, 0xdc, 0xf8, 0x0c, 0x20, 0x90, 0x07,
-  0xfb, 0xd5, 0x14, 0xf1, 0x08, 0x0f, 0x06, 0xd0, 0x01, 0x3c, 0xcc, 0xf8,
-  0x08, 0x10, 0x00, 0x2c, 0xf3, 0xd1, 0x18, 0x46, 0x70, 0xbd, 0xdc, 0xf8,
-  0x0c, 0x20, 0x92, 0x07, 0xed, 0xd5, 0xdc, 0xf8, 0x0c, 0x20, 0x92, 0x07,
-  0xf7, 0xd4, 0xe8, 0xe7, 0xdc, 0xf8, 0x0c, 0x00, 0x40, 0x07, 0xd2, 0xd4,
-  0xc2, 0xe7, 0x00, 0xbf, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x63,
-  0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x6f, 0x66, 0x20, 0x25, 0x75, 0x20, 0x6b,
-  0x48, 0x7a, 0x20, 0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65,
-  0x20, 0x65, 0x78, 0x61, 0x63, 0x74, 0x6c, 0x79, 0x20, 0x61, 0x63, 0x68,
-  0x69, 0x65, 0x76, 0x65, 0x64, 0x00, 0x00, 0x00, 0x44, 0x65, 0x62, 0x75,
-  0x67, 0x3a, 0x20, 0x55, 0x6e, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74,
-  0x65, 0x64, 0x20, 0x52, 0x4f, 0x4d, 0x20, 0x6d, 0x61, 0x70, 0x70, 0x65,
-  0x72, 0x3a, 0x20, 0x25, 0x64, 0x0a, 0x00, 0x00, 0x0a, 0x2a, 0x2a, 0x2a,
-  0x20, 0x50, 0x41, 0x4e, 0x49, 0x43, 0x20, 0x2a, 0x2a, 0x2a, 0x0a, 0x00,
-  0x48, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6c, 0x61,
-  0x72, 0x6d, 0x20, 0x25, 0x64, 0x20, 0x61, 0x6c, 0x72, 0x65, 0x61, 0x64,
-  0x79, 0x20, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x65, 0x64, 0x00, 0x00, 0x00,
-  0x48, 0x61, 0x72, 0x64, 0x20, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x00,
-  0x52, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x00, 0x62, 0x6f, 0x6f, 0x74,
-  0x32, 0x5f, 0x77, 0x32, 0x35, 0x71, 0x30, 0x38, 0x30, 0x00, 0x00, 0x00,
-  0x30, 0x2e, 0x31, 0x00, 0x32, 0x2e, 0x32, 0x2e, 0x30, 0x00, 0x00, 0x00,
-  0x70, 0x69, 0x63, 0x6f, 0x32, 0x00, 0x00, 0x00, 0x6d, 0x75, 0x6c, 0x74,
-  0x69, 0x72, 0x6f, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x44, 0x65, 0x63, 0x20,
-  0x32, 0x31, 0x20, 0x32, 0x30, 0x32, 0x35, 0x00, 0x66, 0x6e, 0x69, 0x2b,
-  0x00, 0x00, 0x00, 0x00, 0x66, 0x6e, 0x69, 0x00, 0x6e, 0x61, 0x6e, 0x00,
-  0x66, 0x6e, 0x69, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x6f, 0x20, 0x53,
-  0x44, 0x20, 0x63, 0x61, 0x72, 0x64, 0x20, 0x64, 0x65, 0x74, 0x65, 0x63,
-  0x74, 0x65, 0x64, 0x21, 0x0d, 0x0a, 0x00, 0x00, 0x25, 0x64, 0x3a, 0x00,
-  0x53, 0x44, 0x49, 0x4f, 0x20, 0x63, 0x61, 0x72, 0x64, 0x20, 0x72, 0x65,
-  0x70, 0x6f, 0x72, 0x74, 0x73, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20,
-  0x43, 0x52, 0x43, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2c, 0x20, 0x73,
-  0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x25, 0x6c, 0x78, 0x0a, 0x00, 0x00,
-  0x53, 0x44, 0x49, 0x4f, 0x20, 0x63, 0x61, 0x72, 0x64, 0x20, 0x72, 0x65,
-  0x70, 0x6f, 0x72, 0x74, 0x73, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20,
-  0x66, 0x61, 0x69, 0x6c, 0x75, 0x72, 0x65, 0x2c, 0x20, 0x73, 0x74, 0x61,
-  0x74, 0x75, 0x73, 0x20, 0x25, 0x6c, 0x78, 0x0a, 0x00, 0x00, 0x00, 0x00,
-  0x53, 0x44, 0x49, 0x4f, 0x20, 0x63, 0x61, 0x72, 0x64, 0x20, 0x72, 0x65,
-  0x70, 0x6f, 0x72, 0x74, 0x73, 0x20, 0x75, 0x6e, 0x6b, 0x6e, 0x6f, 0x77,
-  0x6e, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74,
-  0x75, 0x73, 0x20, 0x25, 0x6c, 0x78, 0x0a, 0x00, 0x25, 0x73, 0x3a, 0x20,
-  0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x20, 0x77, 0x61, 0x69, 0x74,
-  0x69, 0x6e, 0x67, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x73, 0x70,
-  0x6f, 0x6e, 0x73, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x72, 0x70, 0x32, 0x30,
-  0x34, 0x30, 0x5f, 0x73, 0x64, 0x69, 0x6f, 0x5f, 0x63, 0x6f, 0x6d, 0x6d,
-  0x61, 0x6e, 0x64, 0x5f, 0x52, 0x31, 0x28, 0x30, 0x78, 0x25, 0x68, 0x78,
-  0x29, 0x0a, 0x00, 0x00, 0x72, 0x70, 0x32, 0x30, 0x34, 0x30, 0x5f, 0x73,
-  0x64, 0x69, 0x6f, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x5f,
-  0x52, 0x31, 0x28, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 0x52, 0x43, 0x20,
-  0x65, 0x72, 0x72, 0x6f, 0x72, 0x2c, 0x20, 0x63, 0x61, 0x6c, 0x63, 0x75,
-  0x6c, 0x61, 0x74, 0x65, 0x64, 0x20, 0x30, 0x78, 0x25, 0x68, 0x78, 0x2c,
-  0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x68, 0x61, 0x73, 0x20,
-  0x30, 0x78, 0x25, 0x68, 0x78, 0x0a, 0x00, 0x00, 0x25, 0x64, 0x20, 0x72,
-  0x70, 0x32, 0x30, 0x34, 0x30, 0x5f, 0x73, 0x64, 0x69, 0x6f, 0x5f, 0x63,
-  0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x5f, 0x52, 0x31, 0x28, 0x25, 0x64,
-  0x29, 0x3a, 0x20, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x20,
-  0x72, 0x65, 0x70, 0x6c, 0x79, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x25, 0x64,
-  0x0a, 0x00, 0x00, 0x00, 0x53, 0x44, 0x49, 0x4f, 0x20, 0x63, 0x68, 0x65,
-  0x63, 0x6b, 0x73, 0x75, 0x6d, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20,
-  0x69, 0x6e, 0x20, 0x72, 0x65, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e,
-  0x3a, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x25, 0x64, 0x20, 0x63,
-  0x61, 0x6c, 0x63, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x20, 0x30, 0x78,
-  0x25, 0x6c, 0x6c, 0x78, 0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65,
-  0x64, 0x20, 0x30, 0x78, 0x25, 0x6c, 0x6c, 0x78, 0x0a, 0x00, 0x00, 0x00,
-  0x72, 0x70, 0x32, 0x30, 0x34, 0x30, 0x5f, 0x73, 0x64, 0x69, 0x6f, 0x5f,
-  0x74, 0x78, 0x5f, 0x70, 0x6f, 0x6c, 0x6c, 0x28, 0x29, 0x20, 0x74, 0x69,
-  0x6d, 0x65, 0x6f, 0x75, 0x74, 0x0a, 0x00, 0x00, 0x55, 0x6e, 0x6b, 0x6e,
-  0x6f, 0x77, 0x6e, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00,
-  0x25, 0x73, 0x20, 0x61, 0x74, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x25,
-  0x64, 0x3b, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x64,
-  0x65, 0x20, 0x25, 0x64, 0x0a, 0x00, 0x00, 0x00, 0x25, 0x73, 0x2c, 0x25,
-  0x64, 0x20, 0x53, 0x44, 0x49, 0x4f, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x72,
-  0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f,
-  0x20, 0x43, 0x4d, 0x44, 0x38, 0x20, 0x53, 0x45, 0x4e, 0x44, 0x5f, 0x49,
-  0x46, 0x5f, 0x43, 0x4f, 0x4e, 0x44, 0x2c, 0x20, 0x73, 0x74, 0x61, 0x74,
-  0x75, 0x73, 0x20, 0x30, 0x78, 0x25, 0x78, 0x20, 0x72, 0x65, 0x70, 0x6c,
-  0x79, 0x20, 0x30, 0x78, 0x25, 0x6c, 0x78, 0x0a, 0x00, 0x00, 0x00, 0x00,
-  0x53, 0x44, 0x49, 0x4f, 0x20, 0x63, 0x61, 0x72, 0x64, 0x20, 0x69, 0x6e,
-  0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x20, 0x74, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x0a, 0x00, 0x00, 0x00,
-  0x25, 0x73, 0x2c, 0x25, 0x64, 0x20, 0x53, 0x44, 0x49, 0x4f, 0x20, 0x66,
-  0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x65, 0x74,
-  0x20, 0x42, 0x4c, 0x4f, 0x43, 0x4b, 0x4c, 0x45, 0x4e, 0x0a, 0x00, 0x00,
-  0x73, 0x64, 0x5f, 0x73, 0x64, 0x69, 0x6f, 0x5f, 0x73, 0x74, 0x6f, 0x70,
-  0x54, 0x72, 0x61, 0x6e, 0x73, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e,
-  0x28, 0x29, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x0a, 0x00,
-  0x73, 0x64, 0x5f, 0x73, 0x64, 0x69, 0x6f, 0x5f, 0x77, 0x72, 0x69, 0x74,
-  0x65, 0x53, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x28, 0x25, 0x6c, 0x75, 0x29,
-  0x20, 0x66, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x3a, 0x20, 0x25, 0x73, 0x20,
-  0x28, 0x25, 0x64, 0x29, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x64, 0x5f, 0x73,
-  0x64, 0x69, 0x6f, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x53, 0x65, 0x63,
-  0x74, 0x6f, 0x72, 0x73, 0x28, 0x2c, 0x25, 0x6c, 0x75, 0x2c, 0x2c, 0x25,
-  0x7a, 0x75, 0x29, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x3a, 0x20,
-  0x25, 0x73, 0x20, 0x28, 0x25, 0x64, 0x29, 0x0a, 0x00, 0x00, 0x00, 0x00,
-  0x73, 0x64, 0x5f, 0x73, 0x64, 0x69, 0x6f, 0x5f, 0x72, 0x65, 0x61, 0x64,
-  0x53, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x28, 0x2c, 0x25, 0x6c, 0x75, 0x2c,
-  0x29, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x3a, 0x20, 0x25, 0x73,
-  0x20, 0x28, 0x25, 0x64, 0x29, 0x0a, 0x00, 0x00, 0x73, 0x64, 0x5f, 0x73,
-  0x64, 0x69, 0x6f, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x53, 0x65, 0x63, 0x74,
-  0x6f, 0x72, 0x73, 0x28, 0x25, 0x6c, 0x64, 0x2c, 0x2e, 0x2e, 0x2e, 0x2c,
-  0x25, 0x64, 0x29, 0x20, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x3a,
-  0x20, 0x25, 0x73, 0x20, 0x28, 0x25, 0x64, 0x29, 0x0a, 0x00, 0x00, 0x00,
-  0x53, 0x44, 0x49, 0x4f, 0x3a, 0x20, 0x4f, 0x4b, 0x00, 0x00, 0x00, 0x00,
-  0x53, 0x44, 0x49, 0x4f, 0x3a, 0x20, 0x62, 0x75, 0x73, 0x79, 0x00, 0x00,
-  0x53, 0x44, 0x49, 0x4f, 0x3a, 0x20, 0x54, 0x69, 0x6d, 0x65, 0x64, 0x20,
-  0x6f, 0x75, 0x74, 0x20, 0x77, 0x61, 0x69, 0x74, 0x69, 0x6e, 0x67, 0x20,
-  0x66, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65,
-  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x63, 0x61, 0x72, 0x64, 0x00, 0x00,
-  0x53, 0x44, 0x49, 0x4f, 0x3a, 0x20, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e,
-  0x73, 0x65, 0x20, 0x43, 0x52, 0x43, 0x20, 0x69, 0x73, 0x20, 0x77, 0x72,
-  0x6f, 0x6e, 0x67, 0x00, 0x53, 0x44, 0x49, 0x4f, 0x3a, 0x20, 0x52, 0x65,
-  0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x61,
-  0x6e, 0x64, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x64, 0x6f, 0x65, 0x73,
-  0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x20, 0x77,
-  0x68, 0x61, 0x74, 0x20, 0x77, 0x61, 0x73, 0x20, 0x73, 0x65, 0x6e, 0x74,
-  0x00, 0x00, 0x00, 0x00, 0x53, 0x44, 0x49, 0x4f, 0x3a, 0x20, 0x54, 0x69,
-  0x6d, 0x65, 0x64, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x77, 0x61, 0x69, 0x74,
-  0x69, 0x6e, 0x67, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x64, 0x61, 0x74, 0x61,
-  0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x00, 0x00, 0x53, 0x44, 0x49, 0x4f,
-  0x3a, 0x20, 0x43, 0x52, 0x43, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x64, 0x61,
-  0x74, 0x61, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x69, 0x73,
-  0x20, 0x77, 0x72, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x53, 0x44, 0x49, 0x4f,
-  0x3a, 0x20, 0x43, 0x61, 0x72, 0x64, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x72,
-  0x74, 0x73, 0x20, 0x62, 0x61, 0x64, 0x20, 0x43, 0x52, 0x43, 0x20, 0x66,
-  0x6f, 0x72, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00,
-  0x53, 0x44, 0x49, 0x4f, 0x3a, 0x20, 0x43, 0x61, 0x72, 0x64, 0x20, 0x72,
-  0x65, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65,
-  0x20, 0x66, 0x61, 0x69, 0x6c, 0x75, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00,
-  0x25, 0x73, 0x3a, 0x20, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x57, 0x72,
-  0x69, 0x74, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x63, 0x63, 0x65,
-  0x70, 0x74, 0x65, 0x64, 0x2e, 0x20, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e,
-  0x73, 0x65, 0x20, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x3a, 0x20, 0x30, 0x78,
-  0x25, 0x78, 0x2c, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x62,
-  0x69, 0x74, 0x73, 0x3a, 0x20, 0x25, 0x64, 0x25, 0x64, 0x25, 0x64, 0x0a,
-  0x00, 0x00, 0x00, 0x00, 0x4e, 0x6f, 0x20, 0x64, 0x69, 0x73, 0x6b, 0x2c,
-  0x20, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x6e, 0x6f,
-  0x74, 0x20, 0x70, 0x75, 0x74, 0x20, 0x53, 0x44, 0x20, 0x63, 0x61, 0x72,
-  0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x53, 0x50, 0x49, 0x20,
-  0x69, 0x64, 0x6c, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x0a, 0x00,
-  0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x20, 0x77, 0x61, 0x69, 0x74,
-  0x69, 0x6e, 0x67, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x61, 0x72, 0x64,
-  0x0a, 0x00, 0x00, 0x00, 0x46, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74,
-  0x6f, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65,
-  0x20, 0x63, 0x61, 0x72, 0x64, 0x0a, 0x00, 0x00, 0x53, 0x44, 0x20, 0x53,
-  0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 0x64, 0x20, 0x43, 0x61, 0x70, 0x61,
-  0x63, 0x69, 0x74, 0x79, 0x20, 0x4d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20,
-  0x43, 0x61, 0x72, 0x64, 0x20, 0x75, 0x6e, 0x73, 0x75, 0x70, 0x70, 0x6f,
-  0x72, 0x74, 0x65, 0x64, 0x0a, 0x00, 0x00, 0x00, 0x44, 0x4d, 0x41, 0x20,
-  0x63, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x20, 0x25, 0x64, 0x20, 0x69,
-  0x73, 0x20, 0x61, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x63, 0x6c,
-  0x61, 0x69, 0x6d, 0x65, 0x64, 0x00, 0x00, 0x00, 0x4e, 0x6f, 0x20, 0x44,
-  0x4d, 0x41, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x73, 0x20,
-  0x61, 0x72, 0x65, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c,
-  0x65, 0x00, 0x00, 0x00, 0x4e, 0x6f, 0x20, 0x50, 0x49, 0x4f, 0x20, 0x73,
-  0x74, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x63, 0x68, 0x69, 0x6e, 0x65,
-  0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61,
-  0x62, 0x6c, 0x65, 0x00, 0x06, 0x00, 0x52, 0x50, 0xd3, 0xf0, 0x75, 0x42,
-  0xdc, 0x9c, 0x00, 0x20, 0x06, 0x00, 0x52, 0x50, 0xe1, 0x82, 0x88, 0x7f,
-  0xe4, 0x9c, 0x00, 0x20, 0x06, 0x00, 0x52, 0x50, 0x3a, 0xbc, 0xa9, 0x11,
-  0xf4, 0x9c, 0x00, 0x20, 0x06, 0x00, 0x52, 0x50, 0xab, 0xb3, 0x60, 0x53,
-  0xf8, 0x9c, 0x00, 0x20, 0x06, 0x00, 0x52, 0x50, 0xbb, 0xff, 0x3c, 0xb6,
-  0x00, 0x9d, 0x00, 0x20, 0x06, 0x00, 0x52, 0x50, 0x86, 0x1c, 0x03, 0x02,
-  0x08, 0x9d, 0x00, 0x20, 0x06, 0x00, 0x52, 0x50, 0x54, 0x22, 0xa2, 0x9d,
-  0x14, 0x9d, 0x00, 0x20, 0x05, 0x00, 0x52, 0x50, 0xde, 0x65, 0xf4, 0x68,
-  0xd0, 0xbe, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x40,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x40, 0x8f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xc3, 0x40,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xf8, 0x40, 0x00, 0x00, 0x00, 0x00,
-  0x80, 0x84, 0x2e, 0x41, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x12, 0x63, 0x41,
-  0x00, 0x00, 0x00, 0x00, 0x84, 0xd7, 0x97, 0x41, 0x00, 0x00, 0x00, 0x00,
-  0x65, 0xcd, 0xcd, 0x41, 0x0d, 0x0a, 0x00, 0x00, 0x73, 0x64, 0x5f, 0x63,
-  0x61, 0x72, 0x64, 0x5f, 0x64, 0x65, 0x74, 0x65, 0x63, 0x74, 0x00, 0x00,
-  0x72, 0x70, 0x32, 0x30, 0x34, 0x30, 0x5f, 0x73, 0x64, 0x69, 0x6f, 0x5f,
-  0x74, 0x78, 0x5f, 0x70, 0x6f, 0x6c, 0x6c, 0x00, 0x73, 0x64, 0x69, 0x6f,
-  0x5f, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79, 0x5f, 0x72, 0x78, 0x5f, 0x63,
-  0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x73, 0x00, 0x00, 0x00, 0x00,
-  0x72, 0x70, 0x32, 0x30, 0x34, 0x30, 0x5f, 0x73, 0x64, 0x69, 0x6f, 0x5f,
-  0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x5f, 0x52, 0x31, 0x00, 0x00,
-  0x63, 0x68, 0x65, 0x63, 0x6b, 0x5f, 0x73, 0x64, 0x69, 0x6f, 0x5f, 0x77,
-  0x72, 0x69, 0x74, 0x65, 0x5f, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73,
-  0x65, 0x00, 0x00, 0x00, 0x00, 0x12, 0x24, 0x36, 0x48, 0x5a, 0x6c, 0x7e,
-  0x90, 0x82, 0xb4, 0xa6, 0xd8, 0xca, 0xfc, 0xee, 0x32, 0x20, 0x16, 0x04,
-  0x7a, 0x68, 0x5e, 0x4c, 0xa2, 0xb0, 0x86, 0x94, 0xea, 0xf8, 0xce, 0xdc,
-  0x64, 0x76, 0x40, 0x52, 0x2c, 0x3e, 0x08, 0x1a, 0xf4, 0xe6, 0xd0, 0xc2,
-  0xbc, 0xae, 0x98, 0x8a, 0x56, 0x44, 0x72, 0x60, 0x1e, 0x0c, 0x3a, 0x28,
-  0xc6, 0xd4, 0xe2, 0xf0, 0x8e, 0x9c, 0xaa, 0xb8, 0xc8, 0xda, 0xec, 0xfe,
-  0x80, 0x92, 0xa4, 0xb6, 0x58, 0x4a, 0x7c, 0x6e, 0x10, 0x02, 0x34, 0x26,
-  0xfa, 0xe8, 0xde, 0xcc, 0xb2, 0xa0, 0x96, 0x84, 0x6a, 0x78, 0x4e, 0x5c,
-  0x22, 0x30, 0x06, 0x14, 0xac, 0xbe, 0x88, 0x9a, 0xe4, 0xf6, 0xc0, 0xd2,
-  0x3c, 0x2e, 0x18, 0x0a, 0x74, 0x66, 0x50, 0x42, 0x9e, 0x8c, 0xba, 0xa8,
-  0xd6, 0xc4, 0xf2, 0xe0, 0x0e, 0x1c, 0x2a, 0x38, 0x46, 0x54, 0x62, 0x70,
-  0x82, 0x90, 0xa6, 0xb4, 0xca, 0xd8, 0xee, 0xfc, 0x12, 0x00, 0x36, 0x24,
-  0x5a, 0x48, 0x7e, 0x6c, 0xb0, 0xa2, 0x94, 0x86, 0xf8, 0xea, 0xdc, 0xce,
-  0x20, 0x32, 0x04, 0x16, 0x68, 0x7a, 0x4c, 0x5e, 0xe6, 0xf4, 0xc2, 0xd0,
-  0xae, 0xbc, 0x8a, 0x98, 0x76, 0x64, 0x52, 0x40, 0x3e, 0x2c, 0x1a, 0x08,
-  0xd4, 0xc6, 0xf0, 0xe2, 0x9c, 0x8e, 0xb8, 0xaa, 0x44, 0x56, 0x60, 0x72,
-  0x0c, 0x1e, 0x28, 0x3a, 0x4a, 0x58, 0x6e, 0x7c, 0x02, 0x10, 0x26, 0x34,
-  0xda, 0xc8, 0xfe, 0xec, 0x92, 0x80, 0xb6, 0xa4, 0x78, 0x6a, 0x5c, 0x4e,
-  0x30, 0x22, 0x14, 0x06, 0xe8, 0xfa, 0xcc, 0xde, 0xa0, 0xb2, 0x84, 0x96,
-  0x2e, 0x3c, 0x0a, 0x18, 0x66, 0x74, 0x42, 0x50, 0xbe, 0xac, 0x9a, 0x88,
-  0xf6, 0xe4, 0xd2, 0xc0, 0x1c, 0x0e, 0x38, 0x2a, 0x54, 0x46, 0x70, 0x62,
-  0x8c, 0x9e, 0xa8, 0xba, 0xc4, 0xd6, 0xe0, 0xf2, 0x80, 0xa5, 0x00, 0x20,
-  0x09, 0xff, 0x01, 0x00, 0x3e, 0x20, 0xbe, 0x24, 0x04, 0x61, 0x42, 0x01,
-  0x80, 0xe1, 0x01, 0x41, 0x85, 0x01, 0xa0, 0x21, 0x20, 0x81, 0x00, 0x00,
-  0x9c, 0xa5, 0x00, 0x20, 0x05, 0xff, 0x01, 0x00, 0x22, 0xa0, 0x20, 0x20,
-  0xbe, 0x23, 0x04, 0x42, 0x43, 0x00, 0x00, 0x00, 0xb0, 0xa5, 0x00, 0x20,
-  0x12, 0xff, 0x01, 0x00, 0xe3, 0xb1, 0x4d, 0xa1, 0x61, 0x11, 0x60, 0x61,
-  0x28, 0x71, 0x01, 0xe1, 0x81, 0xf1, 0x01, 0x61, 0x47, 0x11, 0x80, 0xe1,
-  0x28, 0x71, 0x42, 0xa1, 0x31, 0x11, 0x42, 0xa1, 0xcd, 0x11, 0x01, 0x41,
-  0x4f, 0x11, 0x20, 0x81, 0xc0, 0xa0, 0x00, 0x20, 0xcc, 0xa0, 0x00, 0x20,
-  0xd8, 0xa0, 0x00, 0x20, 0x08, 0xa1, 0x00, 0x20, 0x24, 0xa1, 0x00, 0x20,
-  0x60, 0xa1, 0x00, 0x20, 0x88, 0xa1, 0x00, 0x20, 0xac, 0xa1, 0x00, 0x20,
-  0xd4, 0xa1, 0x00, 0x20, 0x73, 0x64, 0x5f, 0x73, 0x64, 0x69, 0x6f, 0x5f,
-  0x72, 0x65, 0x61, 0x64, 0x53, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x73, 0x00,
-  0x73, 0x64, 0x5f, 0x73, 0x64, 0x69, 0x6f, 0x5f, 0x72, 0x65, 0x61, 0x64,
-  0x53, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x00, 0x00, 0x73, 0x64, 0x5f, 0x73,
-  0x64, 0x69, 0x6f, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x53, 0x65, 0x63,
-  0x74, 0x6f, 0x72, 0x73, 0x00, 0x00, 0x00, 0x00, 0x73, 0x64, 0x5f, 0x73,
-  0x64, 0x69, 0x6f, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x53, 0x65, 0x63,
-  0x74, 0x6f, 0x72, 0x00, 0x73, 0x64, 0x5f, 0x73, 0x64, 0x69, 0x6f, 0x5f,
-  0x73, 0x74, 0x6f, 0x70, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x6d, 0x69, 0x73,
-  0x73, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x67, 0x53,
-  0x44, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x73, 0x64, 0x5f, 0x73,
-  0x64, 0x69, 0x6f, 0x5f, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x00, 0x00, 0x00,
-  0x73, 0x65, 0x6e, 0x64, 0x5f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x00, 0x00,
-  0x73, 0x64, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x5f, 0x6d, 0x65, 0x64, 0x69,
-  0x75, 0x6d, 0x00, 0x00, 0x73, 0x64, 0x5f, 0x63, 0x61, 0x72, 0x64, 0x5f,
-  0x73, 0x70, 0x69, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x21, 0x20, 0x42, 0x30, 0x63, 0x40, 0x84, 0x50, 0xa5,
-  0x60, 0xc6, 0x70, 0xe7, 0x81, 0x08, 0x91, 0x29, 0xa1, 0x4a, 0xb1, 0x6b,
-  0xc1, 0x8c, 0xd1, 0xad, 0xe1, 0xce, 0xf1, 0xef, 0x12, 0x31, 0x02, 0x10,
-  0x32, 0x73, 0x22, 0x52, 0x52, 0xb5, 0x42, 0x94, 0x72, 0xf7, 0x62, 0xd6,
-  0x93, 0x39, 0x83, 0x18, 0xb3, 0x7b, 0xa3, 0x5a, 0xd3, 0xbd, 0xc3, 0x9c,
-  0xf3, 0xff, 0xe3, 0xde, 0x24, 0x62, 0x34, 0x43, 0x04, 0x20, 0x14, 0x01,
-  0x64, 0xe6, 0x74, 0xc7, 0x44, 0xa4, 0x54, 0x85, 0xa5, 0x6a, 0xb5, 0x4b,
-  0x85, 0x28, 0x95, 0x09, 0xe5, 0xee, 0xf5, 0xcf, 0xc5, 0xac, 0xd5, 0x8d,
-  0x36, 0x53, 0x26, 0x72, 0x16, 0x11, 0x06, 0x30, 0x76, 0xd7, 0x66, 0xf6,
-  0x56, 0x95, 0x46, 0xb4, 0xb7, 0x5b, 0xa7, 0x7a, 0x97, 0x19, 0x87, 0x38,
-  0xf7, 0xdf, 0xe7, 0xfe, 0xd7, 0x9d, 0xc7, 0xbc, 0x48, 0xc4, 0x58, 0xe5,
-  0x68, 0x86, 0x78, 0xa7, 0x08, 0x40, 0x18, 0x61, 0x28, 0x02, 0x38, 0x23,
-  0xc9, 0xcc, 0xd9, 0xed, 0xe9, 0x8e, 0xf9, 0xaf, 0x89, 0x48, 0x99, 0x69,
-  0xa9, 0x0a, 0xb9, 0x2b, 0x5a, 0xf5, 0x4a, 0xd4, 0x7a, 0xb7, 0x6a, 0x96,
-  0x1a, 0x71, 0x0a, 0x50, 0x3a, 0x33, 0x2a, 0x12, 0xdb, 0xfd, 0xcb, 0xdc,
-  0xfb, 0xbf, 0xeb, 0x9e, 0x9b, 0x79, 0x8b, 0x58, 0xbb, 0x3b, 0xab, 0x1a,
-  0x6c, 0xa6, 0x7c, 0x87, 0x4c, 0xe4, 0x5c, 0xc5, 0x2c, 0x22, 0x3c, 0x03,
-  0x0c, 0x60, 0x1c, 0x41, 0xed, 0xae, 0xfd, 0x8f, 0xcd, 0xec, 0xdd, 0xcd,
-  0xad, 0x2a, 0xbd, 0x0b, 0x8d, 0x68, 0x9d, 0x49, 0x7e, 0x97, 0x6e, 0xb6,
-  0x5e, 0xd5, 0x4e, 0xf4, 0x3e, 0x13, 0x2e, 0x32, 0x1e, 0x51, 0x0e, 0x70,
-  0xff, 0x9f, 0xef, 0xbe, 0xdf, 0xdd, 0xcf, 0xfc, 0xbf, 0x1b, 0xaf, 0x3a,
-  0x9f, 0x59, 0x8f, 0x78, 0x91, 0x88, 0x81, 0xa9, 0xb1, 0xca, 0xa1, 0xeb,
-  0xd1, 0x0c, 0xc1, 0x2d, 0xf1, 0x4e, 0xe1, 0x6f, 0x10, 0x80, 0x00, 0xa1,
-  0x30, 0xc2, 0x20, 0xe3, 0x50, 0x04, 0x40, 0x25, 0x70, 0x46, 0x60, 0x67,
-  0x83, 0xb9, 0x93, 0x98, 0xa3, 0xfb, 0xb3, 0xda, 0xc3, 0x3d, 0xd3, 0x1c,
-  0xe3, 0x7f, 0xf3, 0x5e, 0x02, 0xb1, 0x12, 0x90, 0x22, 0xf3, 0x32, 0xd2,
-  0x42, 0x35, 0x52, 0x14, 0x62, 0x77, 0x72, 0x56, 0xb5, 0xea, 0xa5, 0xcb,
-  0x95, 0xa8, 0x85, 0x89, 0xf5, 0x6e, 0xe5, 0x4f, 0xd5, 0x2c, 0xc5, 0x0d,
-  0x34, 0xe2, 0x24, 0xc3, 0x14, 0xa0, 0x04, 0x81, 0x74, 0x66, 0x64, 0x47,
-  0x54, 0x24, 0x44, 0x05, 0xa7, 0xdb, 0xb7, 0xfa, 0x87, 0x99, 0x97, 0xb8,
-  0xe7, 0x5f, 0xf7, 0x7e, 0xc7, 0x1d, 0xd7, 0x3c, 0x26, 0xd3, 0x36, 0xf2,
-  0x06, 0x91, 0x16, 0xb0, 0x66, 0x57, 0x76, 0x76, 0x46, 0x15, 0x56, 0x34,
-  0xd9, 0x4c, 0xc9, 0x6d, 0xf9, 0x0e, 0xe9, 0x2f, 0x99, 0xc8, 0x89, 0xe9,
-  0xb9, 0x8a, 0xa9, 0xab, 0x58, 0x44, 0x48, 0x65, 0x78, 0x06, 0x68, 0x27,
-  0x18, 0xc0, 0x08, 0xe1, 0x38, 0x82, 0x28, 0xa3, 0xcb, 0x7d, 0xdb, 0x5c,
-  0xeb, 0x3f, 0xfb, 0x1e, 0x8b, 0xf9, 0x9b, 0xd8, 0xab, 0xbb, 0xbb, 0x9a,
-  0x4a, 0x75, 0x5a, 0x54, 0x6a, 0x37, 0x7a, 0x16, 0x0a, 0xf1, 0x1a, 0xd0,
-  0x2a, 0xb3, 0x3a, 0x92, 0xfd, 0x2e, 0xed, 0x0f, 0xdd, 0x6c, 0xcd, 0x4d,
-  0xbd, 0xaa, 0xad, 0x8b, 0x9d, 0xe8, 0x8d, 0xc9, 0x7c, 0x26, 0x6c, 0x07,
-  0x5c, 0x64, 0x4c, 0x45, 0x3c, 0xa2, 0x2c, 0x83, 0x1c, 0xe0, 0x0c, 0xc1,
-  0xef, 0x1f, 0xff, 0x3e, 0xcf, 0x5d, 0xdf, 0x7c, 0xaf, 0x9b, 0xbf, 0xba,
-  0x8f, 0xd9, 0x9f, 0xf8, 0x6e, 0x17, 0x7e, 0x36, 0x4e, 0x55, 0x5e, 0x74,
-  0x2e, 0x93, 0x3e, 0xb2, 0x0e, 0xd1, 0x1e, 0xf0, 0x00, 0x00, 0x33, 0x31,
-  0x66, 0x62, 0x55, 0x53, 0xcc, 0xc4, 0xff, 0xf5, 0xaa, 0xa6, 0x99, 0x97,
-  0x89, 0xa9, 0xba, 0x98, 0xef, 0xcb, 0xdc, 0xfa, 0x45, 0x6d, 0x76, 0x5c,
-  0x23, 0x0f, 0x10, 0x3e, 0x03, 0x73, 0x30, 0x42, 0x65, 0x11, 0x56, 0x20,
-  0xcf, 0xb7, 0xfc, 0x86, 0xa9, 0xd5, 0x9a, 0xe4, 0x8a, 0xda, 0xb9, 0xeb,
-  0xec, 0xb8, 0xdf, 0x89, 0x46, 0x1e, 0x75, 0x2f, 0x20, 0x7c, 0x13, 0x4d,
-  0x06, 0xe6, 0x35, 0xd7, 0x60, 0x84, 0x53, 0xb5, 0xca, 0x22, 0xf9, 0x13,
-  0xac, 0x40, 0x9f, 0x71, 0x8f, 0x4f, 0xbc, 0x7e, 0xe9, 0x2d, 0xda, 0x1c,
-  0x43, 0x8b, 0x70, 0xba, 0x25, 0xe9, 0x16, 0xd8, 0x05, 0x95, 0x36, 0xa4,
-  0x63, 0xf7, 0x50, 0xc6, 0xc9, 0x51, 0xfa, 0x60, 0xaf, 0x33, 0x9c, 0x02,
-  0x8c, 0x3c, 0xbf, 0x0d, 0xea, 0x5e, 0xd9, 0x6f, 0x40, 0xf8, 0x73, 0xc9,
-  0x26, 0x9a, 0x15, 0xab, 0x0d, 0xcc, 0x3e, 0xfd, 0x6b, 0xae, 0x58, 0x9f,
-  0xc1, 0x08, 0xf2, 0x39, 0xa7, 0x6a, 0x94, 0x5b, 0x84, 0x65, 0xb7, 0x54,
-  0xe2, 0x07, 0xd1, 0x36, 0x48, 0xa1, 0x7b, 0x90, 0x2e, 0xc3, 0x1d, 0xf2,
-  0x0e, 0xbf, 0x3d, 0x8e, 0x68, 0xdd, 0x5b, 0xec, 0xc2, 0x7b, 0xf1, 0x4a,
-  0xa4, 0x19, 0x97, 0x28, 0x87, 0x16, 0xb4, 0x27, 0xe1, 0x74, 0xd2, 0x45,
-  0x4b, 0xd2, 0x78, 0xe3, 0x2d, 0xb0, 0x1e, 0x81, 0x0b, 0x2a, 0x38, 0x1b,
-  0x6d, 0x48, 0x5e, 0x79, 0xc7, 0xee, 0xf4, 0xdf, 0xa1, 0x8c, 0x92, 0xbd,
-  0x82, 0x83, 0xb1, 0xb2, 0xe4, 0xe1, 0xd7, 0xd0, 0x4e, 0x47, 0x7d, 0x76,
-  0x28, 0x25, 0x1b, 0x14, 0x08, 0x59, 0x3b, 0x68, 0x6e, 0x3b, 0x5d, 0x0a,
-  0xc4, 0x9d, 0xf7, 0xac, 0xa2, 0xff, 0x91, 0xce, 0x81, 0xf0, 0xb2, 0xc1,
-  0xe7, 0x92, 0xd4, 0xa3, 0x4d, 0x34, 0x7e, 0x05, 0x2b, 0x56, 0x18, 0x67,
-  0x1b, 0x98, 0x28, 0xa9, 0x7d, 0xfa, 0x4e, 0xcb, 0xd7, 0x5c, 0xe4, 0x6d,
-  0xb1, 0x3e, 0x82, 0x0f, 0x92, 0x31, 0xa1, 0x00, 0xf4, 0x53, 0xc7, 0x62,
-  0x5e, 0xf5, 0x6d, 0xc4, 0x38, 0x97, 0x0b, 0xa6, 0x18, 0xeb, 0x2b, 0xda,
-  0x7e, 0x89, 0x4d, 0xb8, 0xd4, 0x2f, 0xe7, 0x1e, 0xb2, 0x4d, 0x81, 0x7c,
-  0x91, 0x42, 0xa2, 0x73, 0xf7, 0x20, 0xc4, 0x11, 0x5d, 0x86, 0x6e, 0xb7,
-  0x3b, 0xe4, 0x08, 0xd5, 0x1d, 0x7e, 0x2e, 0x4f, 0x7b, 0x1c, 0x48, 0x2d,
-  0xd1, 0xba, 0xe2, 0x8b, 0xb7, 0xd8, 0x84, 0xe9, 0x94, 0xd7, 0xa7, 0xe6,
-  0xf2, 0xb5, 0xc1, 0x84, 0x58, 0x13, 0x6b, 0x22, 0x3e, 0x71, 0x0d, 0x40,
-  0x1e, 0x0d, 0x2d, 0x3c, 0x78, 0x6f, 0x4b, 0x5e, 0xd2, 0xc9, 0xe1, 0xf8,
-  0xb4, 0xab, 0x87, 0x9a, 0x97, 0xa4, 0xa4, 0x95, 0xf1, 0xc6, 0xc2, 0xf7,
-  0x5b, 0x60, 0x68, 0x51, 0x3d, 0x02, 0x0e, 0x33, 0x16, 0x54, 0x25, 0x65,
-  0x70, 0x36, 0x43, 0x07, 0xda, 0x90, 0xe9, 0xa1, 0xbc, 0xf2, 0x8f, 0xc3,
-  0x9f, 0xfd, 0xac, 0xcc, 0xf9, 0x9f, 0xca, 0xae, 0x53, 0x39, 0x60, 0x08,
-  0x35, 0x5b, 0x06, 0x6a, 0x15, 0x27, 0x26, 0x16, 0x73, 0x45, 0x40, 0x74,
-  0xd9, 0xe3, 0xea, 0xd2, 0xbf, 0x81, 0x8c, 0xb0, 0x9c, 0x8e, 0xaf, 0xbf,
-  0xfa, 0xec, 0xc9, 0xdd, 0x50, 0x4a, 0x63, 0x7b, 0x36, 0x28, 0x05, 0x19,
-  0x10, 0xb2, 0x23, 0x83, 0x76, 0xd0, 0x45, 0xe1, 0xdc, 0x76, 0xef, 0x47,
-  0xba, 0x14, 0x89, 0x25, 0x99, 0x1b, 0xaa, 0x2a, 0xff, 0x79, 0xcc, 0x48,
-  0x55, 0xdf, 0x66, 0xee, 0x33, 0xbd, 0x00, 0x8c, 0x13, 0xc1, 0x20, 0xf0,
-  0x75, 0xa3, 0x46, 0x92, 0xdf, 0x05, 0xec, 0x34, 0xb9, 0x67, 0x8a, 0x56,
-  0x9a, 0x68, 0xa9, 0x59, 0xfc, 0x0a, 0xcf, 0x3b, 0x56, 0xac, 0x65, 0x9d,
-  0x30, 0xce, 0x03, 0xff, 0x00, 0x00, 0x37, 0x30, 0x6e, 0x60, 0x59, 0x50,
-  0xdc, 0xc0, 0xeb, 0xf0, 0xb2, 0xa0, 0x85, 0x90, 0xa9, 0xa1, 0x9e, 0x91,
-  0xc7, 0xc1, 0xf0, 0xf1, 0x75, 0x61, 0x42, 0x51, 0x1b, 0x01, 0x2c, 0x31,
-  0x43, 0x63, 0x74, 0x53, 0x2d, 0x03, 0x1a, 0x33, 0x9f, 0xa3, 0xa8, 0x93,
-  0xf1, 0xc3, 0xc6, 0xf3, 0xea, 0xc2, 0xdd, 0xf2, 0x84, 0xa2, 0xb3, 0x92,
-  0x36, 0x02, 0x01, 0x32, 0x58, 0x62, 0x6f, 0x52, 0x86, 0xc6, 0xb1, 0xf6,
-  0xe8, 0xa6, 0xdf, 0x96, 0x5a, 0x06, 0x6d, 0x36, 0x34, 0x66, 0x03, 0x56,
-  0x2f, 0x67, 0x18, 0x57, 0x41, 0x07, 0x76, 0x37, 0xf3, 0xa7, 0xc4, 0x97,
-  0x9d, 0xc7, 0xaa, 0xf7, 0xc5, 0xa5, 0xf2, 0x95, 0xab, 0xc5, 0x9c, 0xf5,
-  0x19, 0x65, 0x2e, 0x55, 0x77, 0x05, 0x40, 0x35, 0x6c, 0x04, 0x5b, 0x34,
-  0x02, 0x64, 0x35, 0x54, 0xb0, 0xc4, 0x87, 0xf4, 0xde, 0xa4, 0xe9, 0x94,
-  0x1d, 0xad, 0x2a, 0x9d, 0x73, 0xcd, 0x44, 0xfd, 0xc1, 0x6d, 0xf6, 0x5d,
-  0xaf, 0x0d, 0x98, 0x3d, 0xb4, 0x0c, 0x83, 0x3c, 0xda, 0x6c, 0xed, 0x5c,
-  0x68, 0xcc, 0x5f, 0xfc, 0x06, 0xac, 0x31, 0x9c, 0x5e, 0xce, 0x69, 0xfe,
-  0x30, 0xae, 0x07, 0x9e, 0x82, 0x0e, 0xb5, 0x3e, 0xec, 0x6e, 0xdb, 0x5e,
-  0xf7, 0x6f, 0xc0, 0x5f, 0x99, 0x0f, 0xae, 0x3f, 0x2b, 0xaf, 0x1c, 0x9f,
-  0x45, 0xcf, 0x72, 0xff, 0x9b, 0x6b, 0xac, 0x5b, 0xf5, 0x0b, 0xc2, 0x3b,
-  0x47, 0xab, 0x70, 0x9b, 0x29, 0xcb, 0x1e, 0xfb, 0x32, 0xca, 0x05, 0xfa,
-  0x5c, 0xaa, 0x6b, 0x9a, 0xee, 0x0a, 0xd9, 0x3a, 0x80, 0x6a, 0xb7, 0x5a,
-  0xd8, 0x08, 0xef, 0x38, 0xb6, 0x68, 0x81, 0x58, 0x04, 0xc8, 0x33, 0xf8,
-  0x6a, 0xa8, 0x5d, 0x98, 0x71, 0xa9, 0x46, 0x99, 0x1f, 0xc9, 0x28, 0xf9,
-  0xad, 0x69, 0x9a, 0x59, 0xc3, 0x09, 0xf4, 0x39, 0x3b, 0x5a, 0x0c, 0x6a,
-  0x55, 0x3a, 0x62, 0x0a, 0xe7, 0x9a, 0xd0, 0xaa, 0x89, 0xfa, 0xbe, 0xca,
-  0x92, 0xfb, 0xa5, 0xcb, 0xfc, 0x9b, 0xcb, 0xab, 0x4e, 0x3b, 0x79, 0x0b,
-  0x20, 0x5b, 0x17, 0x6b, 0x78, 0x39, 0x4f, 0x09, 0x16, 0x59, 0x21, 0x69,
-  0xa4, 0xf9, 0x93, 0xc9, 0xca, 0x99, 0xfd, 0xa9, 0xd1, 0x98, 0xe6, 0xa8,
-  0xbf, 0xf8, 0x88, 0xc8, 0x0d, 0x58, 0x3a, 0x68, 0x63, 0x38, 0x54, 0x08,
-  0xbd, 0x9c, 0x8a, 0xac, 0xd3, 0xfc, 0xe4, 0xcc, 0x61, 0x5c, 0x56, 0x6c,
-  0x0f, 0x3c, 0x38, 0x0c, 0x14, 0x3d, 0x23, 0x0d, 0x7a, 0x5d, 0x4d, 0x6d,
-  0xc8, 0xfd, 0xff, 0xcd, 0xa6, 0x9d, 0x91, 0xad, 0xfe, 0xff, 0xc9, 0xcf,
-  0x90, 0x9f, 0xa7, 0xaf, 0x22, 0x3f, 0x15, 0x0f, 0x4c, 0x5f, 0x7b, 0x6f,
-  0x57, 0x5e, 0x60, 0x6e, 0x39, 0x3e, 0x0e, 0x0e, 0x8b, 0x9e, 0xbc, 0xae,
-  0xe5, 0xfe, 0xd2, 0xce, 0x26, 0xf7, 0x11, 0xc7, 0x48, 0x97, 0x7f, 0xa7,
-  0xfa, 0x37, 0xcd, 0x07, 0x94, 0x57, 0xa3, 0x67, 0x8f, 0x56, 0xb8, 0x66,
-  0xe1, 0x36, 0xd6, 0x06, 0x53, 0x96, 0x64, 0xa6, 0x3d, 0xf6, 0x0a, 0xc6,
-  0x65, 0x94, 0x52, 0xa4, 0x0b, 0xf4, 0x3c, 0xc4, 0xb9, 0x54, 0x8e, 0x64,
-  0xd7, 0x34, 0xe0, 0x04, 0xcc, 0x35, 0xfb, 0x05, 0xa2, 0x55, 0x95, 0x65,
-  0x10, 0xf5, 0x27, 0xc5, 0x7e, 0x95, 0x49, 0xa5, 0xa0, 0x31, 0x97, 0x01,
-  0xce, 0x51, 0xf9, 0x61, 0x7c, 0xf1, 0x4b, 0xc1, 0x12, 0x91, 0x25, 0xa1,
-  0x09, 0x90, 0x3e, 0xa0, 0x67, 0xf0, 0x50, 0xc0, 0xd5, 0x50, 0xe2, 0x60,
-  0xbb, 0x30, 0x8c, 0x00, 0xe3, 0x52, 0xd4, 0x62, 0x8d, 0x32, 0xba, 0x02,
-  0x3f, 0x92, 0x08, 0xa2, 0x51, 0xf2, 0x66, 0xc2, 0x4a, 0xf3, 0x7d, 0xc3,
-  0x24, 0x93, 0x13, 0xa3, 0x96, 0x33, 0xa1, 0x03, 0xf8, 0x53, 0xcf, 0x63,
-  0x00, 0x00, 0x76, 0xb4, 0xed, 0x68, 0x9b, 0xdc, 0xca, 0xf1, 0xbc, 0x45,
-  0x27, 0x99, 0x51, 0x2d, 0x85, 0xc3, 0xf3, 0x77, 0x68, 0xab, 0x1e, 0x1f,
-  0x4f, 0x32, 0x39, 0x86, 0xa2, 0x5a, 0xd4, 0xee, 0x1b, 0xa7, 0x6d, 0x13,
-  0xf6, 0xcf, 0x80, 0x7b, 0xd1, 0x56, 0xa7, 0xe2, 0x3c, 0x3e, 0x4a, 0x8a,
-  0x9e, 0x64, 0xe8, 0xd0, 0x73, 0x0c, 0x05, 0xb8, 0x54, 0x95, 0x22, 0x21,
-  0xb9, 0xfd, 0xcf, 0x49, 0x37, 0x4e, 0x41, 0xfa, 0xda, 0x26, 0xac, 0x92,
-  0xfd, 0xbf, 0x8b, 0x0b, 0x10, 0xd7, 0x66, 0x63, 0xb2, 0x8d, 0xc4, 0x39,
-  0x5f, 0xe5, 0x29, 0x51, 0x78, 0x7c, 0x0e, 0xc8, 0x95, 0x14, 0xe3, 0xa0,
-  0x2c, 0xe9, 0x5a, 0x5d, 0xc1, 0x81, 0xb7, 0x35, 0xe6, 0x18, 0x90, 0xac,
-  0x0b, 0x70, 0x7d, 0xc4, 0xa9, 0x2a, 0xdf, 0x9e, 0x44, 0x42, 0x32, 0xf6,
-  0x63, 0xdb, 0x15, 0x6f, 0x8e, 0xb3, 0xf8, 0x07, 0x6e, 0x9c, 0x18, 0x28,
-  0x83, 0xf4, 0xf5, 0x40, 0xa4, 0x6d, 0xd2, 0xd9, 0x49, 0x05, 0x3f, 0xb1,
-  0xeb, 0x5f, 0x9d, 0xeb, 0x06, 0x37, 0x70, 0x83, 0x21, 0xae, 0x57, 0x1a,
-  0xcc, 0xc6, 0xba, 0x72, 0x75, 0x3b, 0x03, 0x8f, 0x98, 0x53, 0xee, 0xe7,
-  0xbf, 0xca, 0xc9, 0x7e, 0x52, 0xa2, 0x24, 0x16, 0xf0, 0xf8, 0x86, 0x4c,
-  0x1d, 0x90, 0x6b, 0x24, 0x3a, 0x09, 0x4c, 0xbd, 0xd7, 0x61, 0xa1, 0xd5,
-  0x59, 0xd2, 0x2f, 0x66, 0xb4, 0xba, 0xc2, 0x0e, 0x93, 0x23, 0xe5, 0x97,
-  0x7e, 0x4b, 0x08, 0xff, 0xdc, 0x11, 0xaa, 0xa5, 0x31, 0x79, 0x47, 0xcd,
-  0x16, 0xe0, 0x60, 0x54, 0xfb, 0x88, 0x8d, 0x3c, 0x42, 0x75, 0x34, 0xc1,
-  0xaf, 0x1d, 0xd9, 0xa9, 0x88, 0x84, 0xfe, 0x30, 0x65, 0xec, 0x13, 0x58,
-  0xc7, 0xb6, 0xb1, 0x02, 0x2a, 0xde, 0x5c, 0x6a, 0x0d, 0x47, 0x7b, 0xf3,
-  0xe0, 0x2f, 0x96, 0x9b, 0xdd, 0x38, 0xab, 0x8c, 0x30, 0x50, 0x46, 0xe4,
-  0x17, 0xc9, 0x61, 0x7d, 0xfa, 0xa1, 0x8c, 0x15, 0x58, 0xfb, 0x2e, 0x4f,
-  0xb5, 0x93, 0xc3, 0x27, 0x92, 0x0a, 0xe4, 0xbe, 0x7f, 0x62, 0x09, 0xd6,
-  0xc6, 0x9f, 0xb0, 0x2b, 0x2b, 0xf7, 0x5d, 0x43, 0x0c, 0x6e, 0x7a, 0xda,
-  0xe1, 0x06, 0x97, 0xb2, 0x43, 0x5c, 0x35, 0xe8, 0xae, 0x34, 0xd8, 0x80,
-  0x89, 0xad, 0xff, 0x19, 0x64, 0xc5, 0x12, 0x71, 0xea, 0x76, 0x9c, 0xc2,
-  0x07, 0x1e, 0x71, 0xaa, 0x20, 0x87, 0x56, 0x33, 0xcd, 0xef, 0xbb, 0x5b,
-  0x6f, 0xb5, 0x19, 0x01, 0x82, 0xdd, 0xf4, 0x69, 0xa5, 0x44, 0xd3, 0xf0,
-  0x48, 0x2c, 0x3e, 0x98, 0xf1, 0xd1, 0x87, 0x65, 0x1c, 0xb9, 0x6a, 0x0d,
-  0x3b, 0x20, 0x4d, 0x94, 0xd6, 0x48, 0xa0, 0xfc, 0x74, 0x12, 0x02, 0xa6,
-  0x99, 0x7a, 0xef, 0xce, 0xbe, 0xe3, 0xc8, 0x57, 0x53, 0x8b, 0x25, 0x3f,
-  0xb3, 0xa4, 0xc5, 0x10, 0x5e, 0xcc, 0x28, 0x78, 0x79, 0x55, 0x0f, 0xe1,
-  0x94, 0x3d, 0xe2, 0x89, 0x36, 0x67, 0x40, 0xd3, 0xdb, 0x0f, 0xad, 0xbb,
-  0xfc, 0x96, 0x8a, 0x22, 0x11, 0xfe, 0x67, 0x4a, 0xa8, 0x03, 0xde, 0xb7,
-  0x45, 0x6b, 0x33, 0xdf, 0x62, 0xf2, 0x14, 0x46, 0x8f, 0x9a, 0xf9, 0x2e,
-  0x2d, 0xc0, 0x5b, 0x74, 0xc0, 0xa8, 0xb6, 0x1c, 0xe7, 0x31, 0x91, 0x85,
-  0x0a, 0x59, 0x7c, 0xed, 0x84, 0xea, 0xf2, 0x5e, 0x69, 0x82, 0x1f, 0x36,
-  0x4e, 0x1b, 0x38, 0xaf, 0xa3, 0x73, 0xd5, 0xc7, 0x01, 0x29, 0x77, 0x9d,
-  0xec, 0x41, 0x9a, 0xf5, 0xcb, 0xd8, 0xbd, 0x6c, 0x26, 0xb0, 0x50, 0x04,
-  0x9f, 0x4d, 0xe9, 0xf9, 0x72, 0x25, 0x04, 0x91, 0x55, 0xbc, 0x23, 0x08,
-  0xb8, 0xd4, 0xce, 0x60, 0x1a, 0x8e, 0x6c, 0x3a, 0xf7, 0xe6, 0x81, 0x52,
-  0xd0, 0x7f, 0xa6, 0xcb, 0x3d, 0x17, 0x4b, 0xa3, 0x00, 0x00, 0xaa, 0x51,
-  0x44, 0x83, 0xee, 0xd2, 0x89, 0x06, 0x23, 0x57, 0xcd, 0x85, 0x67, 0xd4,
-  0x02, 0x2d, 0xa8, 0x7c, 0x46, 0xae, 0xec, 0xff, 0x8b, 0x2b, 0x21, 0x7a,
-  0xcf, 0xa8, 0x65, 0xf9, 0x04, 0x5a, 0xae, 0x0b, 0x40, 0xd9, 0xea, 0x88,
-  0x8d, 0x5c, 0x27, 0x0d, 0xc9, 0xdf, 0x63, 0x8e, 0x06, 0x77, 0xac, 0x26,
-  0x42, 0xf4, 0xe8, 0xa5, 0x8f, 0x71, 0x25, 0x20, 0xcb, 0xf2, 0x61, 0xa3,
-  0x08, 0xb4, 0xa2, 0xe5, 0x4c, 0x37, 0xe6, 0x66, 0x81, 0xb2, 0x2b, 0xe3,
-  0xc5, 0x31, 0x6f, 0x60, 0x0a, 0x99, 0xa0, 0xc8, 0x4e, 0x1a, 0xe4, 0x4b,
-  0x83, 0x9f, 0x29, 0xce, 0xc7, 0x1c, 0x6d, 0x4d, 0x0c, 0xee, 0xa6, 0xbf,
-  0x48, 0x6d, 0xe2, 0x3c, 0x85, 0xe8, 0x2f, 0xb9, 0xc1, 0x6b, 0x6b, 0x3a,
-  0x0e, 0xc3, 0xa4, 0x92, 0x4a, 0x40, 0xe0, 0x11, 0x87, 0xc5, 0x2d, 0x94,
-  0xc3, 0x46, 0x69, 0x17, 0x11, 0x68, 0xbb, 0x39, 0x55, 0xeb, 0xff, 0xba,
-  0x98, 0x6e, 0x32, 0x3f, 0xdc, 0xed, 0x76, 0xbc, 0x13, 0x45, 0xb9, 0x14,
-  0x57, 0xc6, 0xfd, 0x97, 0x9a, 0x43, 0x30, 0x12, 0xde, 0xc0, 0x74, 0x91,
-  0x15, 0x32, 0xbf, 0x63, 0x51, 0xb1, 0xfb, 0xe0, 0x9c, 0x34, 0x36, 0x65,
-  0xd8, 0xb7, 0x72, 0xe6, 0x17, 0x1f, 0xbd, 0x4e, 0x53, 0x9c, 0xf9, 0xcd,
-  0x9e, 0x19, 0x34, 0x48, 0xda, 0x9a, 0x70, 0xcb, 0x19, 0xdc, 0xb3, 0x8d,
-  0x5d, 0x5f, 0xf7, 0x0e, 0x90, 0xda, 0x3a, 0x8b, 0xd4, 0x59, 0x7e, 0x08,
-  0x1b, 0xf1, 0xb1, 0xa0, 0x5f, 0x72, 0xf5, 0x23, 0x92, 0xf7, 0x38, 0xa6,
-  0xd6, 0x74, 0x7c, 0x25, 0x1d, 0x86, 0xb7, 0xd7, 0x59, 0x05, 0xf3, 0x54,
-  0x94, 0x80, 0x3e, 0xd1, 0xd0, 0x03, 0x7a, 0x52, 0x1f, 0xab, 0xb5, 0xfa,
-  0x5b, 0x28, 0xf1, 0x79, 0x96, 0xad, 0x3c, 0xfc, 0xd2, 0x2e, 0x78, 0x7f,
-  0x22, 0xd0, 0x88, 0x81, 0x66, 0x53, 0xcc, 0x02, 0xab, 0xd6, 0x01, 0x87,
-  0xef, 0x55, 0x45, 0x04, 0x20, 0xfd, 0x8a, 0xac, 0x64, 0x7e, 0xce, 0x2f,
-  0xa9, 0xfb, 0x03, 0xaa, 0xed, 0x78, 0x47, 0x29, 0x26, 0x8a, 0x8c, 0xdb,
-  0x62, 0x09, 0xc8, 0x58, 0xaf, 0x8c, 0x05, 0xdd, 0xeb, 0x0f, 0x41, 0x5e,
-  0x24, 0xa7, 0x8e, 0xf6, 0x60, 0x24, 0xca, 0x75, 0xad, 0xa1, 0x07, 0xf0,
-  0xe9, 0x22, 0x43, 0x73, 0x2a, 0x64, 0x80, 0x35, 0x6e, 0xe7, 0xc4, 0xb6,
-  0xa3, 0x62, 0x09, 0x33, 0xe7, 0xe1, 0x4d, 0xb0, 0x28, 0x49, 0x82, 0x18,
-  0x6c, 0xca, 0xc6, 0x9b, 0xa1, 0x4f, 0x0b, 0x1e, 0xe5, 0xcc, 0x4f, 0x9d,
-  0x2e, 0x3e, 0x84, 0x6f, 0x6a, 0xbd, 0xc0, 0xec, 0xa7, 0x38, 0x0d, 0x69,
-  0xe3, 0xbb, 0x49, 0xea, 0x2c, 0x13, 0x86, 0x42, 0x68, 0x90, 0xc2, 0xc1,
-  0xa5, 0x15, 0x0f, 0x44, 0xe1, 0x96, 0x4b, 0xc7, 0x33, 0xb8, 0x99, 0xe9,
-  0x77, 0x3b, 0xdd, 0x6a, 0xba, 0xbe, 0x10, 0xef, 0xfe, 0x3d, 0x54, 0x6c,
-  0x31, 0x95, 0x9b, 0xc4, 0x75, 0x16, 0xdf, 0x47, 0xb8, 0x93, 0x12, 0xc2,
-  0xfc, 0x10, 0x56, 0x41, 0x37, 0xe2, 0x9d, 0xb3, 0x73, 0x61, 0xd9, 0x30,
-  0xbe, 0xe4, 0x14, 0xb5, 0xfa, 0x67, 0x50, 0x36, 0x35, 0xcf, 0x9f, 0x9e,
-  0x71, 0x4c, 0xdb, 0x1d, 0xbc, 0xc9, 0x16, 0x98, 0xf8, 0x4a, 0x52, 0x1b,
-  0x3b, 0x0c, 0x91, 0x5d, 0x7f, 0x8f, 0xd5, 0xde, 0xb2, 0x0a, 0x18, 0x5b,
-  0xf6, 0x89, 0x5c, 0xd8, 0x39, 0x21, 0x93, 0x70, 0x7d, 0xa2, 0xd7, 0xf3,
-  0xb0, 0x27, 0x1a, 0x76, 0xf4, 0xa4, 0x5e, 0xf5, 0x3f, 0x56, 0x95, 0x07,
-  0x7b, 0xd5, 0xd1, 0x84, 0xb6, 0x50, 0x1c, 0x01, 0xf2, 0xd3, 0x58, 0x82,
-  0x3d, 0x7b, 0x97, 0x2a, 0x79, 0xf8, 0xd3, 0xa9, 0xb4, 0x7d, 0x1e, 0x2c,
-  0xf0, 0xfe, 0x5a, 0xaf, 0x00, 0x00, 0x45, 0xa0, 0x8b, 0x40, 0xce, 0xe0,
-  0x06, 0xa1, 0x43, 0x01, 0x8d, 0xe1, 0xc8, 0x41, 0x0d, 0x42, 0x48, 0xe2,
-  0x86, 0x02, 0xc3, 0xa2, 0x0b, 0xe3, 0x4e, 0x43, 0x80, 0xa3, 0xc5, 0x03,
-  0x1a, 0x84, 0x5f, 0x24, 0x91, 0xc4, 0xd4, 0x64, 0x1c, 0x25, 0x59, 0x85,
-  0x97, 0x65, 0xd2, 0xc5, 0x17, 0xc6, 0x52, 0x66, 0x9c, 0x86, 0xd9, 0x26,
-  0x11, 0x67, 0x54, 0xc7, 0x9a, 0x27, 0xdf, 0x87, 0x35, 0x08, 0x70, 0xa8,
-  0xbe, 0x48, 0xfb, 0xe8, 0x33, 0xa9, 0x76, 0x09, 0xb8, 0xe9, 0xfd, 0x49,
-  0x38, 0x4a, 0x7d, 0xea, 0xb3, 0x0a, 0xf6, 0xaa, 0x3e, 0xeb, 0x7b, 0x4b,
-  0xb5, 0xab, 0xf0, 0x0b, 0x2f, 0x8c, 0x6a, 0x2c, 0xa4, 0xcc, 0xe1, 0x6c,
-  0x29, 0x2d, 0x6c, 0x8d, 0xa2, 0x6d, 0xe7, 0xcd, 0x22, 0xce, 0x67, 0x6e,
-  0xa9, 0x8e, 0xec, 0x2e, 0x24, 0x6f, 0x61, 0xcf, 0xaf, 0x2f, 0xea, 0x8f,
-  0x6a, 0x10, 0x2f, 0xb0, 0xe1, 0x50, 0xa4, 0xf0, 0x6c, 0xb1, 0x29, 0x11,
-  0xe7, 0xf1, 0xa2, 0x51, 0x67, 0x52, 0x22, 0xf2, 0xec, 0x12, 0xa9, 0xb2,
-  0x61, 0xf3, 0x24, 0x53, 0xea, 0xb3, 0xaf, 0x13, 0x70, 0x94, 0x35, 0x34,
-  0xfb, 0xd4, 0xbe, 0x74, 0x76, 0x35, 0x33, 0x95, 0xfd, 0x75, 0xb8, 0xd5,
-  0x7d, 0xd6, 0x38, 0x76, 0xf6, 0x96, 0xb3, 0x36, 0x7b, 0x77, 0x3e, 0xd7,
-  0xf0, 0x37, 0xb5, 0x97, 0x5f, 0x18, 0x1a, 0xb8, 0xd4, 0x58, 0x91, 0xf8,
-  0x59, 0xb9, 0x1c, 0x19, 0xd2, 0xf9, 0x97, 0x59, 0x52, 0x5a, 0x17, 0xfa,
-  0xd9, 0x1a, 0x9c, 0xba, 0x54, 0xfb, 0x11, 0x5b, 0xdf, 0xbb, 0x9a, 0x1b,
-  0x45, 0x9c, 0x00, 0x3c, 0xce, 0xdc, 0x8b, 0x7c, 0x43, 0x3d, 0x06, 0x9d,
-  0xc8, 0x7d, 0x8d, 0xdd, 0x48, 0xde, 0x0d, 0x7e, 0xc3, 0x9e, 0x86, 0x3e,
-  0x4e, 0x7f, 0x0b, 0xdf, 0xc5, 0x3f, 0x80, 0x9f, 0xd4, 0x20, 0x91, 0x80,
-  0x5f, 0x60, 0x1a, 0xc0, 0xd2, 0x81, 0x97, 0x21, 0x59, 0xc1, 0x1c, 0x61,
-  0xd9, 0x62, 0x9c, 0xc2, 0x52, 0x22, 0x17, 0x82, 0xdf, 0xc3, 0x9a, 0x63,
-  0x54, 0x83, 0x11, 0x23, 0xce, 0xa4, 0x8b, 0x04, 0x45, 0xe4, 0x00, 0x44,
-  0xc8, 0x05, 0x8d, 0xa5, 0x43, 0x45, 0x06, 0xe5, 0xc3, 0xe6, 0x86, 0x46,
-  0x48, 0xa6, 0x0d, 0x06, 0xc5, 0x47, 0x80, 0xe7, 0x4e, 0x07, 0x0b, 0xa7,
-  0xe1, 0x28, 0xa4, 0x88, 0x6a, 0x68, 0x2f, 0xc8, 0xe7, 0x89, 0xa2, 0x29,
-  0x6c, 0xc9, 0x29, 0x69, 0xec, 0x6a, 0xa9, 0xca, 0x67, 0x2a, 0x22, 0x8a,
-  0xea, 0xcb, 0xaf, 0x6b, 0x61, 0x8b, 0x24, 0x2b, 0xfb, 0xac, 0xbe, 0x0c,
-  0x70, 0xec, 0x35, 0x4c, 0xfd, 0x0d, 0xb8, 0xad, 0x76, 0x4d, 0x33, 0xed,
-  0xf6, 0xee, 0xb3, 0x4e, 0x7d, 0xae, 0x38, 0x0e, 0xf0, 0x4f, 0xb5, 0xef,
-  0x7b, 0x0f, 0x3e, 0xaf, 0xbe, 0x30, 0xfb, 0x90, 0x35, 0x70, 0x70, 0xd0,
-  0xb8, 0x91, 0xfd, 0x31, 0x33, 0xd1, 0x76, 0x71, 0xb3, 0x72, 0xf6, 0xd2,
-  0x38, 0x32, 0x7d, 0x92, 0xb5, 0xd3, 0xf0, 0x73, 0x3e, 0x93, 0x7b, 0x33,
-  0xa4, 0xb4, 0xe1, 0x14, 0x2f, 0xf4, 0x6a, 0x54, 0xa2, 0x15, 0xe7, 0xb5,
-  0x29, 0x55, 0x6c, 0xf5, 0xa9, 0xf6, 0xec, 0x56, 0x22, 0xb6, 0x67, 0x16,
-  0xaf, 0x57, 0xea, 0xf7, 0x24, 0x17, 0x61, 0xb7, 0x8b, 0x38, 0xce, 0x98,
-  0x00, 0x78, 0x45, 0xd8, 0x8d, 0x99, 0xc8, 0x39, 0x06, 0xd9, 0x43, 0x79,
-  0x86, 0x7a, 0xc3, 0xda, 0x0d, 0x3a, 0x48, 0x9a, 0x80, 0xdb, 0xc5, 0x7b,
-  0x0b, 0x9b, 0x4e, 0x3b, 0x91, 0xbc, 0xd4, 0x1c, 0x1a, 0xfc, 0x5f, 0x5c,
-  0x97, 0x1d, 0xd2, 0xbd, 0x1c, 0x5d, 0x59, 0xfd, 0x9c, 0xfe, 0xd9, 0x5e,
-  0x17, 0xbe, 0x52, 0x1e, 0x9a, 0x5f, 0xdf, 0xff, 0x11, 0x1f, 0x54, 0xbf,
-  0x00, 0x00, 0xb8, 0x61, 0x60, 0xe3, 0xd8, 0x82, 0xc1, 0xc6, 0x79, 0xa7,
-  0xa1, 0x25, 0x19, 0x44, 0x93, 0xad, 0x2b, 0xcc, 0xf3, 0x4e, 0x4b, 0x2f,
-  0x52, 0x6b, 0xea, 0x0a, 0x32, 0x88, 0x8a, 0xe9, 0x37, 0x7b, 0x8f, 0x1a,
-  0x57, 0x98, 0xef, 0xf9, 0xf6, 0xbd, 0x4e, 0xdc, 0x96, 0x5e, 0x2e, 0x3f,
-  0xa4, 0xd6, 0x1c, 0xb7, 0xc4, 0x35, 0x7c, 0x54, 0x65, 0x10, 0xdd, 0x71,
-  0x05, 0xf3, 0xbd, 0x92, 0x6e, 0xf6, 0xd6, 0x97, 0x0e, 0x15, 0xb6, 0x74,
-  0xaf, 0x30, 0x17, 0x51, 0xcf, 0xd3, 0x77, 0xb2, 0xfd, 0x5b, 0x45, 0x3a,
-  0x9d, 0xb8, 0x25, 0xd9, 0x3c, 0x9d, 0x84, 0xfc, 0x5c, 0x7e, 0xe4, 0x1f,
-  0x59, 0x8d, 0xe1, 0xec, 0x39, 0x6e, 0x81, 0x0f, 0x98, 0x4b, 0x20, 0x2a,
-  0xf8, 0xa8, 0x40, 0xc9, 0xca, 0x20, 0x72, 0x41, 0xaa, 0xc3, 0x12, 0xa2,
-  0x0b, 0xe6, 0xb3, 0x87, 0x6b, 0x05, 0xd3, 0x64, 0xdd, 0xec, 0x65, 0x8d,
-  0xbd, 0x0f, 0x05, 0x6e, 0x1c, 0x2a, 0xa4, 0x4b, 0x7c, 0xc9, 0xc4, 0xa8,
-  0x4e, 0x41, 0xf6, 0x20, 0x2e, 0xa2, 0x96, 0xc3, 0x8f, 0x87, 0x37, 0xe6,
-  0xef, 0x64, 0x57, 0x05, 0xea, 0x97, 0x52, 0xf6, 0x8a, 0x74, 0x32, 0x15,
-  0x2b, 0x51, 0x93, 0x30, 0x4b, 0xb2, 0xf3, 0xd3, 0x79, 0x3a, 0xc1, 0x5b,
-  0x19, 0xd9, 0xa1, 0xb8, 0xb8, 0xfc, 0x00, 0x9d, 0xd8, 0x1f, 0x60, 0x7e,
-  0xb3, 0x1a, 0x0b, 0x7b, 0xd3, 0xf9, 0x6b, 0x98, 0x72, 0xdc, 0xca, 0xbd,
-  0x12, 0x3f, 0xaa, 0x5e, 0x20, 0xb7, 0x98, 0xd6, 0x40, 0x54, 0xf8, 0x35,
-  0xe1, 0x71, 0x59, 0x10, 0x81, 0x92, 0x39, 0xf3, 0x84, 0x61, 0x3c, 0x00,
-  0xe4, 0x82, 0x5c, 0xe3, 0x45, 0xa7, 0xfd, 0xc6, 0x25, 0x44, 0x9d, 0x25,
-  0x17, 0xcc, 0xaf, 0xad, 0x77, 0x2f, 0xcf, 0x4e, 0xd6, 0x0a, 0x6e, 0x6b,
-  0xb6, 0xe9, 0x0e, 0x88, 0xab, 0xf9, 0x13, 0x98, 0xcb, 0x1a, 0x73, 0x7b,
-  0x6a, 0x3f, 0xd2, 0x5e, 0x0a, 0xdc, 0xb2, 0xbd, 0x38, 0x54, 0x80, 0x35,
-  0x58, 0xb7, 0xe0, 0xd6, 0xf9, 0x92, 0x41, 0xf3, 0x99, 0x71, 0x21, 0x10,
-  0x9c, 0x82, 0x24, 0xe3, 0xfc, 0x61, 0x44, 0x00, 0x5d, 0x44, 0xe5, 0x25,
-  0x3d, 0xa7, 0x85, 0xc6, 0x0f, 0x2f, 0xb7, 0x4e, 0x6f, 0xcc, 0xd7, 0xad,
-  0xce, 0xe9, 0x76, 0x88, 0xae, 0x0a, 0x16, 0x6b, 0xc5, 0x0f, 0x7d, 0x6e,
-  0xa5, 0xec, 0x1d, 0x8d, 0x04, 0xc9, 0xbc, 0xa8, 0x64, 0x2a, 0xdc, 0x4b,
-  0x56, 0xa2, 0xee, 0xc3, 0x36, 0x41, 0x8e, 0x20, 0x97, 0x64, 0x2f, 0x05,
-  0xf7, 0x87, 0x4f, 0xe6, 0xf2, 0x74, 0x4a, 0x15, 0x92, 0x97, 0x2a, 0xf6,
-  0x33, 0xb2, 0x8b, 0xd3, 0x53, 0x51, 0xeb, 0x30, 0x61, 0xd9, 0xd9, 0xb8,
-  0x01, 0x3a, 0xb9, 0x5b, 0xa0, 0x1f, 0x18, 0x7e, 0xc0, 0xfc, 0x78, 0x9d,
-  0x76, 0x15, 0xce, 0x74, 0x16, 0xf6, 0xae, 0x97, 0xb7, 0xd3, 0x0f, 0xb2,
-  0xd7, 0x30, 0x6f, 0x51, 0xe5, 0xb8, 0x5d, 0xd9, 0x85, 0x5b, 0x3d, 0x3a,
-  0x24, 0x7e, 0x9c, 0x1f, 0x44, 0x9d, 0xfc, 0xfc, 0x41, 0x6e, 0xf9, 0x0f,
-  0x21, 0x8d, 0x99, 0xec, 0x80, 0xa8, 0x38, 0xc9, 0xe0, 0x4b, 0x58, 0x2a,
-  0xd2, 0xc3, 0x6a, 0xa2, 0xb2, 0x20, 0x0a, 0x41, 0x13, 0x05, 0xab, 0x64,
-  0x73, 0xe6, 0xcb, 0x87, 0x18, 0xe3, 0xa0, 0x82, 0x78, 0x00, 0xc0, 0x61,
-  0xd9, 0x25, 0x61, 0x44, 0xb9, 0xc6, 0x01, 0xa7, 0x8b, 0x4e, 0x33, 0x2f,
-  0xeb, 0xad, 0x53, 0xcc, 0x4a, 0x88, 0xf2, 0xe9, 0x2a, 0x6b, 0x92, 0x0a,
-  0x2f, 0x98, 0x97, 0xf9, 0x4f, 0x7b, 0xf7, 0x1a, 0xee, 0x5e, 0x56, 0x3f,
-  0x8e, 0xbd, 0x36, 0xdc, 0xbc, 0x35, 0x04, 0x54, 0xdc, 0xd6, 0x64, 0xb7,
-  0x7d, 0xf3, 0xc5, 0x92, 0x1d, 0x10, 0xa5, 0x71, 0x00, 0x00, 0x47, 0xd3,
-  0x8f, 0xa6, 0xc8, 0x75, 0x0f, 0x6d, 0x48, 0xbe, 0x80, 0xcb, 0xc7, 0x18,
-  0x1e, 0xda, 0x59, 0x09, 0x91, 0x7c, 0xd6, 0xaf, 0x11, 0xb7, 0x56, 0x64,
-  0x9e, 0x11, 0xd9, 0xc2, 0x3d, 0xb4, 0x7a, 0x67, 0xb2, 0x12, 0xf5, 0xc1,
-  0x32, 0xd9, 0x75, 0x0a, 0xbd, 0x7f, 0xfa, 0xac, 0x23, 0x6e, 0x64, 0xbd,
-  0xac, 0xc8, 0xeb, 0x1b, 0x2c, 0x03, 0x6b, 0xd0, 0xa3, 0xa5, 0xe4, 0x76,
-  0x7b, 0x68, 0x3c, 0xbb, 0xf4, 0xce, 0xb3, 0x1d, 0x74, 0x05, 0x33, 0xd6,
-  0xfb, 0xa3, 0xbc, 0x70, 0x65, 0xb2, 0x22, 0x61, 0xea, 0x14, 0xad, 0xc7,
-  0x6a, 0xdf, 0x2d, 0x0c, 0xe5, 0x79, 0xa2, 0xaa, 0x46, 0xdc, 0x01, 0x0f,
-  0xc9, 0x7a, 0x8e, 0xa9, 0x49, 0xb1, 0x0e, 0x62, 0xc6, 0x17, 0x81, 0xc4,
-  0x58, 0x06, 0x1f, 0xd5, 0xd7, 0xa0, 0x90, 0x73, 0x57, 0x6b, 0x10, 0xb8,
-  0xd8, 0xcd, 0x9f, 0x1e, 0xf6, 0xd0, 0xb1, 0x03, 0x79, 0x76, 0x3e, 0xa5,
-  0xf9, 0xbd, 0xbe, 0x6e, 0x76, 0x1b, 0x31, 0xc8, 0xe8, 0x0a, 0xaf, 0xd9,
-  0x67, 0xac, 0x20, 0x7f, 0xe7, 0x67, 0xa0, 0xb4, 0x68, 0xc1, 0x2f, 0x12,
-  0xcb, 0x64, 0x8c, 0xb7, 0x44, 0xc2, 0x03, 0x11, 0xc4, 0x09, 0x83, 0xda,
-  0x4b, 0xaf, 0x0c, 0x7c, 0xd5, 0xbe, 0x92, 0x6d, 0x5a, 0x18, 0x1d, 0xcb,
-  0xda, 0xd3, 0x9d, 0x00, 0x55, 0x75, 0x12, 0xa6, 0x8d, 0xb8, 0xca, 0x6b,
-  0x02, 0x1e, 0x45, 0xcd, 0x82, 0xd5, 0xc5, 0x06, 0x0d, 0x73, 0x4a, 0xa0,
-  0x93, 0x62, 0xd4, 0xb1, 0x1c, 0xc4, 0x5b, 0x17, 0x9c, 0x0f, 0xdb, 0xdc,
-  0x13, 0xa9, 0x54, 0x7a, 0xb0, 0x0c, 0xf7, 0xdf, 0x3f, 0xaa, 0x78, 0x79,
-  0xbf, 0x61, 0xf8, 0xb2, 0x30, 0xc7, 0x77, 0x14, 0xae, 0xd6, 0xe9, 0x05,
-  0x21, 0x70, 0x66, 0xa3, 0xa1, 0xbb, 0xe6, 0x68, 0x2e, 0x1d, 0x69, 0xce,
-  0xfd, 0x81, 0xba, 0x52, 0x72, 0x27, 0x35, 0xf4, 0xf2, 0xec, 0xb5, 0x3f,
-  0x7d, 0x4a, 0x3a, 0x99, 0xe3, 0x5b, 0xa4, 0x88, 0x6c, 0xfd, 0x2b, 0x2e,
-  0xec, 0x36, 0xab, 0xe5, 0x63, 0x90, 0x24, 0x43, 0xc0, 0x35, 0x87, 0xe6,
-  0x4f, 0x93, 0x08, 0x40, 0xcf, 0x58, 0x88, 0x8b, 0x40, 0xfe, 0x07, 0x2d,
-  0xde, 0xef, 0x99, 0x3c, 0x51, 0x49, 0x16, 0x9a, 0xd1, 0x82, 0x96, 0x51,
-  0x5e, 0x24, 0x19, 0xf7, 0x86, 0xe9, 0xc1, 0x3a, 0x09, 0x4f, 0x4e, 0x9c,
-  0x89, 0x84, 0xce, 0x57, 0x06, 0x22, 0x41, 0xf1, 0x98, 0x33, 0xdf, 0xe0,
-  0x17, 0x95, 0x50, 0x46, 0x97, 0x5e, 0xd0, 0x8d, 0x18, 0xf8, 0x5f, 0x2b,
-  0xbb, 0x5d, 0xfc, 0x8e, 0x34, 0xfb, 0x73, 0x28, 0xb4, 0x30, 0xf3, 0xe3,
-  0x3b, 0x96, 0x7c, 0x45, 0xa5, 0x87, 0xe2, 0x54, 0x2a, 0x21, 0x6d, 0xf2,
-  0xaa, 0xea, 0xed, 0x39, 0x25, 0x4c, 0x62, 0x9f, 0x0b, 0x51, 0x4c, 0x82,
-  0x84, 0xf7, 0xc3, 0x24, 0x04, 0x3c, 0x43, 0xef, 0x8b, 0x9a, 0xcc, 0x49,
-  0x15, 0x8b, 0x52, 0x58, 0x9a, 0x2d, 0xdd, 0xfe, 0x1a, 0xe6, 0x5d, 0x35,
-  0x95, 0x40, 0xd2, 0x93, 0x36, 0xe5, 0x71, 0x36, 0xb9, 0x43, 0xfe, 0x90,
-  0x39, 0x88, 0x7e, 0x5b, 0xb6, 0x2e, 0xf1, 0xfd, 0x28, 0x3f, 0x6f, 0xec,
-  0xa7, 0x99, 0xe0, 0x4a, 0x27, 0x52, 0x60, 0x81, 0xa8, 0xf4, 0xef, 0x27,
-  0x70, 0x39, 0x37, 0xea, 0xff, 0x9f, 0xb8, 0x4c, 0x7f, 0x54, 0x38, 0x87,
-  0xf0, 0xf2, 0xb7, 0x21, 0x6e, 0xe3, 0x29, 0x30, 0xe1, 0x45, 0xa6, 0x96,
-  0x61, 0x8e, 0x26, 0x5d, 0xee, 0x28, 0xa9, 0xfb, 0x4d, 0x8d, 0x0a, 0x5e,
-  0xc2, 0x2b, 0x85, 0xf8, 0x42, 0xe0, 0x05, 0x33, 0xcd, 0x46, 0x8a, 0x95,
-  0x53, 0x57, 0x14, 0x84, 0xdc, 0xf1, 0x9b, 0x22, 0x5c, 0x3a, 0x1b, 0xe9,
-  0xd3, 0x9c, 0x94, 0x4f, 0x00, 0x00, 0x21, 0x10, 0x42, 0x20, 0x63, 0x30,
-  0x84, 0x40, 0xa5, 0x50, 0xc6, 0x60, 0xe7, 0x70, 0x08, 0x81, 0x29, 0x91,
-  0x4a, 0xa1, 0x6b, 0xb1, 0x8c, 0xc1, 0xad, 0xd1, 0xce, 0xe1, 0xef, 0xf1,
-  0x31, 0x12, 0x10, 0x02, 0x73, 0x32, 0x52, 0x22, 0xb5, 0x52, 0x94, 0x42,
-  0xf7, 0x72, 0xd6, 0x62, 0x39, 0x93, 0x18, 0x83, 0x7b, 0xb3, 0x5a, 0xa3,
-  0xbd, 0xd3, 0x9c, 0xc3, 0xff, 0xf3, 0xde, 0xe3, 0x62, 0x24, 0x43, 0x34,
-  0x20, 0x04, 0x01, 0x14, 0xe6, 0x64, 0xc7, 0x74, 0xa4, 0x44, 0x85, 0x54,
-  0x6a, 0xa5, 0x4b, 0xb5, 0x28, 0x85, 0x09, 0x95, 0xee, 0xe5, 0xcf, 0xf5,
-  0xac, 0xc5, 0x8d, 0xd5, 0x53, 0x36, 0x72, 0x26, 0x11, 0x16, 0x30, 0x06,
-  0xd7, 0x76, 0xf6, 0x66, 0x95, 0x56, 0xb4, 0x46, 0x5b, 0xb7, 0x7a, 0xa7,
-  0x19, 0x97, 0x38, 0x87, 0xdf, 0xf7, 0xfe, 0xe7, 0x9d, 0xd7, 0xbc, 0xc7,
-  0xc4, 0x48, 0xe5, 0x58, 0x86, 0x68, 0xa7, 0x78, 0x40, 0x08, 0x61, 0x18,
-  0x02, 0x28, 0x23, 0x38, 0xcc, 0xc9, 0xed, 0xd9, 0x8e, 0xe9, 0xaf, 0xf9,
-  0x48, 0x89, 0x69, 0x99, 0x0a, 0xa9, 0x2b, 0xb9, 0xf5, 0x5a, 0xd4, 0x4a,
-  0xb7, 0x7a, 0x96, 0x6a, 0x71, 0x1a, 0x50, 0x0a, 0x33, 0x3a, 0x12, 0x2a,
-  0xfd, 0xdb, 0xdc, 0xcb, 0xbf, 0xfb, 0x9e, 0xeb, 0x79, 0x9b, 0x58, 0x8b,
-  0x3b, 0xbb, 0x1a, 0xab, 0xa6, 0x6c, 0x87, 0x7c, 0xe4, 0x4c, 0xc5, 0x5c,
-  0x22, 0x2c, 0x03, 0x3c, 0x60, 0x0c, 0x41, 0x1c, 0xae, 0xed, 0x8f, 0xfd,
-  0xec, 0xcd, 0xcd, 0xdd, 0x2a, 0xad, 0x0b, 0xbd, 0x68, 0x8d, 0x49, 0x9d,
-  0x97, 0x7e, 0xb6, 0x6e, 0xd5, 0x5e, 0xf4, 0x4e, 0x13, 0x3e, 0x32, 0x2e,
-  0x51, 0x1e, 0x70, 0x0e, 0x9f, 0xff, 0xbe, 0xef, 0xdd, 0xdf, 0xfc, 0xcf,
-  0x1b, 0xbf, 0x3a, 0xaf, 0x59, 0x9f, 0x78, 0x8f, 0x88, 0x91, 0xa9, 0x81,
-  0xca, 0xb1, 0xeb, 0xa1, 0x0c, 0xd1, 0x2d, 0xc1, 0x4e, 0xf1, 0x6f, 0xe1,
-  0x80, 0x10, 0xa1, 0x00, 0xc2, 0x30, 0xe3, 0x20, 0x04, 0x50, 0x25, 0x40,
-  0x46, 0x70, 0x67, 0x60, 0xb9, 0x83, 0x98, 0x93, 0xfb, 0xa3, 0xda, 0xb3,
-  0x3d, 0xc3, 0x1c, 0xd3, 0x7f, 0xe3, 0x5e, 0xf3, 0xb1, 0x02, 0x90, 0x12,
-  0xf3, 0x22, 0xd2, 0x32, 0x35, 0x42, 0x14, 0x52, 0x77, 0x62, 0x56, 0x72,
-  0xea, 0xb5, 0xcb, 0xa5, 0xa8, 0x95, 0x89, 0x85, 0x6e, 0xf5, 0x4f, 0xe5,
-  0x2c, 0xd5, 0x0d, 0xc5, 0xe2, 0x34, 0xc3, 0x24, 0xa0, 0x14, 0x81, 0x04,
-  0x66, 0x74, 0x47, 0x64, 0x24, 0x54, 0x05, 0x44, 0xdb, 0xa7, 0xfa, 0xb7,
-  0x99, 0x87, 0xb8, 0x97, 0x5f, 0xe7, 0x7e, 0xf7, 0x1d, 0xc7, 0x3c, 0xd7,
-  0xd3, 0x26, 0xf2, 0x36, 0x91, 0x06, 0xb0, 0x16, 0x57, 0x66, 0x76, 0x76,
-  0x15, 0x46, 0x34, 0x56, 0x4c, 0xd9, 0x6d, 0xc9, 0x0e, 0xf9, 0x2f, 0xe9,
-  0xc8, 0x99, 0xe9, 0x89, 0x8a, 0xb9, 0xab, 0xa9, 0x44, 0x58, 0x65, 0x48,
-  0x06, 0x78, 0x27, 0x68, 0xc0, 0x18, 0xe1, 0x08, 0x82, 0x38, 0xa3, 0x28,
-  0x7d, 0xcb, 0x5c, 0xdb, 0x3f, 0xeb, 0x1e, 0xfb, 0xf9, 0x8b, 0xd8, 0x9b,
-  0xbb, 0xab, 0x9a, 0xbb, 0x75, 0x4a, 0x54, 0x5a, 0x37, 0x6a, 0x16, 0x7a,
-  0xf1, 0x0a, 0xd0, 0x1a, 0xb3, 0x2a, 0x92, 0x3a, 0x2e, 0xfd, 0x0f, 0xed,
-  0x6c, 0xdd, 0x4d, 0xcd, 0xaa, 0xbd, 0x8b, 0xad, 0xe8, 0x9d, 0xc9, 0x8d,
-  0x26, 0x7c, 0x07, 0x6c, 0x64, 0x5c, 0x45, 0x4c, 0xa2, 0x3c, 0x83, 0x2c,
-  0xe0, 0x1c, 0xc1, 0x0c, 0x1f, 0xef, 0x3e, 0xff, 0x5d, 0xcf, 0x7c, 0xdf,
-  0x9b, 0xaf, 0xba, 0xbf, 0xd9, 0x8f, 0xf8, 0x9f, 0x17, 0x6e, 0x36, 0x7e,
-  0x55, 0x4e, 0x74, 0x5e, 0x93, 0x2e, 0xb2, 0x3e, 0xd1, 0x0e, 0xf0, 0x1e,
-  0x00, 0x09, 0x12, 0x1b, 0x24, 0x2d, 0x36, 0x3f, 0x48, 0x41, 0x5a, 0x53,
-  0x6c, 0x65, 0x7e, 0x77, 0x19, 0x10, 0x0b, 0x02, 0x3d, 0x34, 0x2f, 0x26,
-  0x51, 0x58, 0x43, 0x4a, 0x75, 0x7c, 0x67, 0x6e, 0x32, 0x3b, 0x20, 0x29,
-  0x16, 0x1f, 0x04, 0x0d, 0x7a, 0x73, 0x68, 0x61, 0x5e, 0x57, 0x4c, 0x45,
-  0x2b, 0x22, 0x39, 0x30, 0x0f, 0x06, 0x1d, 0x14, 0x63, 0x6a, 0x71, 0x78,
-  0x47, 0x4e, 0x55, 0x5c, 0x64, 0x6d, 0x76, 0x7f, 0x40, 0x49, 0x52, 0x5b,
-  0x2c, 0x25, 0x3e, 0x37, 0x08, 0x01, 0x1a, 0x13, 0x7d, 0x74, 0x6f, 0x66,
-  0x59, 0x50, 0x4b, 0x42, 0x35, 0x3c, 0x27, 0x2e, 0x11, 0x18, 0x03, 0x0a,
-  0x56, 0x5f, 0x44, 0x4d, 0x72, 0x7b, 0x60, 0x69, 0x1e, 0x17, 0x0c, 0x05,
-  0x3a, 0x33, 0x28, 0x21, 0x4f, 0x46, 0x5d, 0x54, 0x6b, 0x62, 0x79, 0x70,
-  0x07, 0x0e, 0x15, 0x1c, 0x23, 0x2a, 0x31, 0x38, 0x41, 0x48, 0x53, 0x5a,
-  0x65, 0x6c, 0x77, 0x7e, 0x09, 0x00, 0x1b, 0x12, 0x2d, 0x24, 0x3f, 0x36,
-  0x58, 0x51, 0x4a, 0x43, 0x7c, 0x75, 0x6e, 0x67, 0x10, 0x19, 0x02, 0x0b,
-  0x34, 0x3d, 0x26, 0x2f, 0x73, 0x7a, 0x61, 0x68, 0x57, 0x5e, 0x45, 0x4c,
-  0x3b, 0x32, 0x29, 0x20, 0x1f, 0x16, 0x0d, 0x04, 0x6a, 0x63, 0x78, 0x71,
-  0x4e, 0x47, 0x5c, 0x55, 0x22, 0x2b, 0x30, 0x39, 0x06, 0x0f, 0x14, 0x1d,
-  0x25, 0x2c, 0x37, 0x3e, 0x01, 0x08, 0x13, 0x1a, 0x6d, 0x64, 0x7f, 0x76,
-  0x49, 0x40, 0x5b, 0x52, 0x3c, 0x35, 0x2e, 0x27, 0x18, 0x11, 0x0a, 0x03,
-  0x74, 0x7d, 0x66, 0x6f, 0x50, 0x59, 0x42, 0x4b, 0x17, 0x1e, 0x05, 0x0c,
-  0x33, 0x3a, 0x21, 0x28, 0x5f, 0x56, 0x4d, 0x44, 0x7b, 0x72, 0x69, 0x60,
-  0x0e, 0x07, 0x1c, 0x15, 0x2a, 0x23, 0x38, 0x31, 0x46, 0x4f, 0x54, 0x5d,
-  0x62, 0x6b, 0x70, 0x79, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x90, 0xbc, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xa8, 0xbc, 0x00, 0x20, 0x21, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x24, 0x00, 0x00, 0x00,
-  0x23, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x50, 0xd6, 0xdc, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xd0, 0xbe, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0xb5, 0x48, 0x68, 0x01, 0x31, 0x8e, 0x46, 0x00, 0x47, 0x70, 0x46,
-  0x09, 0x38, 0x01, 0x49, 0x88, 0x47, 0x01, 0xbd, 0x89, 0x07, 0x00, 0x20,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xbe, 0x00, 0x20,
-  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xd0, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x40, 0x1f, 0x00, 0x00, 0xe8, 0x03, 0x00, 0x00, 0xe8, 0x03, 0x00, 0x00,
-  0xe8, 0x03, 0x00, 0x00, 0xa0, 0x0f, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xe8, 0x03, 0x00, 0x00,
-  0x88, 0x13, 0x00, 0x00, 0xe8, 0x03, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00,
-  0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x71, 0x16, 0x00, 0x20, 0xe5, 0x15, 0x00, 0x20, 0x19, 0x16, 0x00, 0x20,
-  0x05, 0x17, 0x00, 0x20, 0x51, 0x16, 0x00, 0x20, 0x49, 0x15, 0x00, 0x20,
-  0x99, 0x16, 0x00, 0x20, 0x35, 0x15, 0x00, 0x20, 0x81, 0x08, 0x00, 0x20,
-  0x9d, 0x16, 0x00, 0x20, 0x19, 0x0c, 0x00, 0x20, 0x95, 0x15, 0x00, 0x20,
-  0x85, 0x16, 0x00, 0x20, 0x35, 0x16, 0x00, 0x20, 0x8d, 0x04, 0x00, 0x20,
-  0xb5, 0x04, 0x00, 0x20, 0xb5, 0x01, 0x00, 0x20, 0xd1, 0x7f, 0x00, 0x20,
-  0xd3, 0xde, 0xff, 0xff, 0xfe, 0x01, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00,
-  0x7c, 0x42, 0xff, 0xff, 0x79, 0x35, 0x12, 0xab
-};
-unsigned int ___pico_multirom_build_multirom_bin_len = 48848;
@@ -0,0 +1,131 @@
+// MSX PICOVERSE PROJECT
+// (c) 2025 Cristiano Goncalves
+// The Retro Hacker
+//
+// romdb.h - Database of known ROM dumps compiled into the tools: the SHA-1 of a dump gives its mapper and its title
+//
+// The table (romdb_table.h) is generated by romdbgen (tool/utils) from the list in tool/romdb/romdb.txt. A dump is
+// found by the first 8 bytes of its SHA-1 with a minimal perfect hash: the key picks a bucket, the displacement of the
+// bucket turns the key into its slot, and the key stored there tells a known dump from an unknown one. A lookup is one
+// SHA-1 and two table reads, a dump costs 13 bytes and its title, a bucket of about four dumps 2 bytes.
+//
+// This file is shared as-is by the multirom and loadrom tools of the RP2040 and RP2350.
+//
+// This work is licensed  under a "Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International
+// License". https://creativecommons.org/licenses/by-nc-sa/4.0/
+
+#ifndef ROMDB_H
+#define ROMDB_H
+
+#include <stdint.h>
+#include <string.h>
+#include "romdb_table.h"
+
+// Slot of a key for a displacement, romdbgen places the dumps with the same function.
+static inline uint32_t romdb_slot(uint64_t key, uint32_t displacement, uint32_t count) {
+    uint64_t x = key ^ ((uint64_t)displacement * 0x9E3779B97F4A7C15ull);
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ull;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBull;
+    x ^= x >> 31;
+    return (uint32_t)(x % count);
+}
+
+static inline uint32_t romdb_rotate(uint32_t value, int bits) {
+    return (value << bits) | (value >> (32 - bits));
+}
+
+// Run the SHA-1 compression on a 64 byte block.
+static inline void romdb_sha1_block(uint32_t hash[5], const uint8_t *block) {
+    uint32_t w[80];
+    for (int i = 0; i < 16; i++) {
+        w[i] = ((uint32_t)block[4 * i] << 24) | ((uint32_t)block[4 * i + 1] << 16) | ((uint32_t)block[4 * i + 2] << 8) |
+               block[4 * i + 3];
+    }
+    for (int i = 16; i < 80; i++) {
+        w[i] = romdb_rotate(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+    }
+
+    uint32_t a = hash[0], b = hash[1], c = hash[2], d = hash[3], e = hash[4];
+    for (int i = 0; i < 80; i++) {
+        uint32_t f, k;
+        if (i < 20) {
+            f = (b & c) | (~b & d);
+            k = 0x5A827999;
+        } else if (i < 40) {
+            f = b ^ c ^ d;
+            k = 0x6ED9EBA1;
+        } else if (i < 60) {
+            f = (b & c) | (b & d) | (c & d);
+            k = 0x8F1BBCDC;
+        } else {
+            f = b ^ c ^ d;
+            k = 0xCA62C1D6;
+        }
+        uint32_t const t = romdb_rotate(a, 5) + f + e + k + w[i];
+        e = d;
+        d = c;
+        c = romdb_rotate(b, 30);
+        b = a;
+        a = t;
+    }
+    hash[0] += a;
+    hash[1] += b;
+    hash[2] += c;
+    hash[3] += d;
+    hash[4] += e;
+}
+
+// Key of a dump: the first 8 bytes of its SHA-1, big endian like the SHA-1 written in hexadecimal.
+static inline uint64_t romdb_key(const uint8_t *data, size_t length) {
+    uint32_t hash[5] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0 };
+    uint8_t tail[128];
+    size_t const whole = length & ~(size_t)63;
+    size_t const rest = length - whole;
+    size_t const tail_size = (rest < 56) ? 64 : 128;
+    uint64_t const bits = (uint64_t)length * 8;
+
+    for (size_t at = 0; at < whole; at += 64) {
+        romdb_sha1_block(hash, data + at);
+    }
+    memset(tail, 0, sizeof(tail));
+    memcpy(tail, data + whole, rest);
+    tail[rest] = 0x80;
+    for (int i = 0; i < 8; i++) {
+        tail[tail_size - 1 - i] = (uint8_t)(bits >> (8 * i));
+    }
+    for (size_t at = 0; at < tail_size; at += 64) {
+        romdb_sha1_block(hash, tail + at);
+    }
+    return ((uint64_t)hash[0] << 32) | hash[1];
+}
+
+// Find a dump by its key. Returns its index, or -1 when it is not in the database.
+static inline int romdb_find(uint64_t key) {
+#if ROMDB_COUNT > 0
+    uint32_t const slot = romdb_slot(key, romdb_displacements[key % ROMDB_BUCKETS], ROMDB_COUNT);
+    return (romdb_keys[slot] == key) ? (int)slot : -1;
+#else
+    (void)key;
+    return -1;
+#endif
+}
+
+// Identify a ROM. Returns the index of its dump, or -1 when it is not in the database (without hashing the ROM when
+// the database is empty).
+static inline int romdb_identify(const uint8_t *data, size_t length) {
+    return (ROMDB_COUNT > 0) ? romdb_find(romdb_key(data, length)) : -1;
+}
+
+// Mapper code of a dump (the mapper tags of the tools, 1 PL-16 to 15 SCC+).
+static inline uint8_t romdb_mapper(int index) {
+    return romdb_mappers[index];
+}
+
+// Clean title of a dump.
+static inline const char *romdb_title(int index) {
+    return romdb_names + romdb_titles[index];
+}
+
+#endif
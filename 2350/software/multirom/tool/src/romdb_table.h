@@ -0,0 +1,31 @@
+// Generated by romdbgen from romdb/romdb.txt, do not edit
+
+#ifndef ROMDB_TABLE_H
+#define ROMDB_TABLE_H
+
+#define ROMDB_COUNT 2
+#define ROMDB_BUCKETS 1
+#define ROMDB_ID "39611e55"
+
+static const uint16_t romdb_displacements[1] = {
+    1,
+};
+
+static const uint64_t romdb_keys[3] = {
+    0x3480b5940822dec8ull, 0x197014d5fa6fd91full, 0
+};
+
+static const uint8_t romdb_mappers[3] = {
+    6, 6, 0
+};
+
+static const uint32_t romdb_titles[3] = {
+    0, 43, 86
+};
+
+static const char romdb_names[] =
+    "Nextor 2.1.4 (MSX PICOVERSE 2040 MultiROM)" "\0"
+    "Nextor 2.1.4 (MSX PICOVERSE 2350 MultiROM)" "\0"
+    "";
+
+#endif